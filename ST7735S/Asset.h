@@ -0,0 +1,61 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Asset registry entries for images and fonts kept in flash.
+ *
+ * An Asset describes const data by reference: nothing is copied, the
+ * drawing functions read the pixels straight from where the linker put
+ * them. The registry images/assets.h is generated by host/assetgen
+ * (make -C host assets) from the images and fonts of the project and from
+ * BMP / PPM / PNG files; it defines asset_table[], one AssetId per entry
+ * and asset_find().
+ *
+ * @code
+ * #include "images/assets.h"
+ * tft.Paint_DrawImage(asset_table[ASSET_EKIMEMO_BMP], 0, 0);
+ * tft.Paint_DrawImage(*asset_find("gImage_0inch96_1_q565"), 0, 0);
+ * @endcode
+ */
+
+#ifndef MBED_ASSET_H
+#define MBED_ASSET_H
+
+#include <stdint.h>
+#include <string.h>
+
+/** layout of Asset::data */
+enum AssetFormat {
+    ASSET_RGB565,       // 16 bit R5 G6 B5 pixels, low byte first (Paint_DrawImage)
+    ASSET_Q565,         // Q565 compressed image with header (Q565.h)
+    ASSET_MONO,         // 1 bit per pixel, leftmost pixel in the MSB, rows of stride bytes
+    ASSET_GLCD_FONT,    // GLCD font for set_font(unsigned char *)
+    ASSET_ATLAS_FONT    // GlyphAtlas for set_font(const GlyphAtlas *)
+};
+
+/** one registry entry */
+struct Asset {
+    const char *name;
+    uint8_t format;     // AssetFormat
+    uint16_t width;     // pixels, character cell width for fonts
+    uint16_t height;
+    uint16_t stride;    // bytes per row, 0 for fonts and Q565
+    const void *data;
+    uint32_t size;      // bytes of data
+};
+
+/** Look up an asset by name
+ *
+ * @returns the entry, NULL if no entry has the name
+ */
+inline const Asset *asset_lookup(const Asset *table, int count, const char *name)
+{
+    for (int i = 0; i < count; i++) {
+        if (strcmp(table[i].name, name) == 0) {
+            return &table[i];
+        }
+    }
+    return NULL;
+}
+
+#endif
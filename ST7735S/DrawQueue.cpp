@@ -0,0 +1,10 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "DrawQueue_impl.h"
+
+template class ST7735SDrawQueue<ST7735S_160x80>;
+template class ST7735SDrawQueue<ST7735S_80x160>;
+template class ST7735SDrawQueue<ST7735S_128x160>;
@@ -0,0 +1,222 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MBED_DRAWQUEUE_H
+#define MBED_DRAWQUEUE_H
+
+#include "mbed.h"
+#include "ST7735S.h"
+
+/** number of commands the queue holds, a power of two */
+#ifndef ST7735S_QUEUE_DEPTH
+#define ST7735S_QUEUE_DEPTH 32
+#endif
+
+/** longest string of a text command, longer strings take several commands */
+#ifndef ST7735S_QUEUE_TEXT
+#define ST7735S_QUEUE_TEXT 16
+#endif
+
+/** pixels a push_pixels() command carries, longer runs take several
+ *  commands; every slot of the ring grows with it */
+#ifndef ST7735S_QUEUE_PIXELS
+#define ST7735S_QUEUE_PIXELS 16
+#endif
+
+/** stack of the transmit thread (bytes) */
+#ifndef ST7735S_QUEUE_STACK
+#define ST7735S_QUEUE_STACK 2048
+#endif
+
+/** Drawing commands executed on a transmit thread
+ *
+ * The application thread queues commands into a single-producer /
+ * single-consumer ring and goes on with its work while a dedicated thread
+ * draws them on the display. The ring itself needs no lock: only the
+ * application writes the head index and only the transmit thread the
+ * tail. EventFlags wake the transmit thread when commands arrive and the
+ * application when it waits for space.
+ *
+ * A full queue blocks the application until the transmit thread has
+ * taken a command (back-pressure); stats() counts these stalls.
+ * sync() returns once every queued command has been drawn.
+ *
+ * Images and bitmaps are queued by pointer and have to stay unchanged
+ * until they are drawn, strings are copied. The span interface of the
+ * display (begin_region, push_pixels / push_repeat, end_region) is queued
+ * too; push_pixels() copies the pixels into the queue, ST7735S_QUEUE_PIXELS
+ * per command, so a row buffer can be refilled right after the call. While
+ * the queue runs the display belongs to the transmit thread; call sync()
+ * before using it directly.
+ *
+ * cls(), text() and blitbit() take their colors as parameters; the
+ * foreground and background color of the display are restored after each
+ * of them.
+ *
+ * @code
+ * DrawQueue q(tft);
+ * q.fillrect(0, 0, 159, 15, Navy);
+ * q.text(2, 2, "12:34", White, Navy);
+ * q.flush();
+ * // ... compute the next frame ...
+ * q.sync();
+ * @endcode
+ *
+ * DrawQueue draws on a ST7735S, ST7735SDrawQueue<Panel> on the driver of
+ * another panel.
+ */
+template <class Panel>
+class ST7735SDrawQueue {
+public:
+
+    /** queue counters */
+    struct Stats {
+        uint32_t commands;          // commands queued
+        uint32_t executed;          // commands drawn by the transmit thread
+        uint32_t stalls;            // pushes that waited for a free slot
+        uint32_t syncs;             // sync() calls that had to wait
+        uint32_t max_depth;         // most commands queued at once
+    };
+
+    /** Create a queue and start its transmit thread
+    *
+    * @param tft display the commands are drawn on
+    * @param priority priority of the transmit thread
+    */
+    ST7735SDrawQueue(ST7735SDisplay<Panel> &tft, osPriority priority = osPriorityNormal);
+
+    /** Draw what is queued and stop the transmit thread
+    *
+    */
+    ~ST7735SDrawQueue();
+
+    /** Queue a drawing command, same parameters as on the display
+    *
+    */
+    void pixel(int x, int y, int color);
+    void line(int x0, int y0, int x1, int y1, int color);
+    void rect(int x0, int y0, int x1, int y1, int color);
+    void fillrect(int x0, int y0, int x1, int y1, int color);
+    void cls(int color);
+
+    /** Queue Paint_DrawImage, image has to stay valid until it is drawn
+    *
+    */
+    void image(const unsigned char *image, int x, int y, int w, int h);
+
+    /** Queue a window of 32 bit colors (GraphicsDisplay::blit), colors
+    *   has to stay valid until it is drawn
+    *
+    */
+    void blit(int x, int y, int w, int h, const int *colors);
+
+    /** Queue a 1 bit bitmap (GraphicsDisplay::blitbit), bits has to stay
+    *   valid until it is drawn
+    *
+    * @param fg,bg colors of set / cleared bits
+    */
+    void blitbit(int x, int y, int w, int h, const char *bits, int fg, int bg);
+
+    /** Queue a string at pixel position x, y in the current font
+    *
+    * @param s string, copied into the queue
+    * @param fg,bg text colors
+    */
+    void text(int x, int y, const char *s, int fg, int bg);
+
+    /** Queue the start of a region, see ST7735SDisplay::begin_region;
+    *   queue no other drawing command until end_region()
+    *
+    * @param x,y top left corner
+    * @param w,h size
+    */
+    void begin_region(int x, int y, int w, int h);
+
+    /** Queue pixels of the region, copied into the queue
+    *
+    * @param colour 16 bit colors
+    * @param n number of pixels
+    */
+    void push_pixels(const uint16_t *colour, int n);
+
+    /** Queue the same color n times into the region
+    *
+    */
+    void push_repeat(int colour, int n);
+
+    /** Queue the end of the region
+    *
+    */
+    void end_region(void);
+
+    /** Queue a flush() of the display
+    *
+    */
+    void flush(void);
+
+    /** Wait until every queued command has been drawn
+    *
+    */
+    void sync(void);
+
+    /** commands waiting or being drawn */
+    int depth(void);
+
+    /** counters since the queue was created */
+    Stats stats(void);
+
+private:
+    enum Op {
+        OP_PIXEL, OP_LINE, OP_RECT, OP_FILLRECT, OP_CLS, OP_IMAGE, OP_BLIT,
+        OP_BLITBIT, OP_TEXT, OP_REGION, OP_PIXELS, OP_REPEAT, OP_END_REGION,
+        OP_FLUSH, OP_STOP
+    };
+
+    struct Command {
+        uint8_t op;
+        int16_t x0, y0, x1, y1;
+        int color;
+        int bg;
+        union {
+            const void *ptr;
+            char text[ST7735S_QUEUE_TEXT];
+            uint16_t pixels[ST7735S_QUEUE_PIXELS];
+            int count;
+        };
+    };
+
+    /** Claim the next free slot, waits while the ring is full
+    *
+    */
+    Command &slot(int op);
+
+    /** Publish the slot returned by slot() to the transmit thread
+    *
+    */
+    void push(void);
+
+    /** body of the transmit thread */
+    void run(void);
+
+    /** draw one command on the display */
+    void execute(const Command &c);
+
+    ST7735SDisplay<Panel> &_tft;
+    Command _ring[ST7735S_QUEUE_DEPTH];
+    volatile uint32_t _head;    // next slot to fill, written by the application
+    volatile uint32_t _tail;    // next slot to draw, written by the transmit thread
+    EventFlags _flags;
+    Thread _thread;
+    Stats _stats;
+    volatile uint32_t _executed;
+};
+
+extern template class ST7735SDrawQueue<ST7735S_160x80>;
+extern template class ST7735SDrawQueue<ST7735S_80x160>;
+extern template class ST7735SDrawQueue<ST7735S_128x160>;
+
+typedef ST7735SDrawQueue<ST7735S_PANEL> DrawQueue;
+
+#endif
@@ -0,0 +1,356 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Member definitions of ST7735SDrawQueue, instantiated by DrawQueue.cpp
+ * for the descriptors of ST7735SPanel.h (see ST7735S_impl.h for others) */
+
+#ifndef MBED_DRAWQUEUE_IMPL_H
+#define MBED_DRAWQUEUE_IMPL_H
+
+#include <string.h>
+#include "DrawQueue.h"
+
+#if (ST7735S_QUEUE_DEPTH & (ST7735S_QUEUE_DEPTH - 1)) != 0
+#error "ST7735S_QUEUE_DEPTH has to be a power of two"
+#endif
+
+#define QUEUE_CMD_FLAG      (1UL << 0)  // commands were queued
+#define QUEUE_SPACE_FLAG    (1UL << 1)  // a command was drawn
+
+template <class Panel>
+ST7735SDrawQueue<Panel>::ST7735SDrawQueue(ST7735SDisplay<Panel> &tft, osPriority priority)
+    : _tft(tft), _head(0), _tail(0), _thread(priority, ST7735S_QUEUE_STACK, NULL, "ST7735S"), _executed(0)
+{
+    memset(&_stats, 0, sizeof(_stats));
+    _thread.start(callback(this, &ST7735SDrawQueue::run));
+}
+
+template <class Panel>
+ST7735SDrawQueue<Panel>::~ST7735SDrawQueue()
+{
+    slot(OP_STOP);
+    push();
+    _thread.join();
+}
+
+template <class Panel>
+typename ST7735SDrawQueue<Panel>::Command &ST7735SDrawQueue<Panel>::slot(int op)
+{
+    uint32_t head = _head;
+
+    // back-pressure: the slot is free once the transmit thread moved past it
+    if (head - core_util_atomic_load_u32(&_tail) == ST7735S_QUEUE_DEPTH) {
+        _stats.stalls++;
+        while (head - core_util_atomic_load_u32(&_tail) == ST7735S_QUEUE_DEPTH) {
+            _flags.wait_any(QUEUE_SPACE_FLAG);
+        }
+    }
+    Command &c = _ring[head & (ST7735S_QUEUE_DEPTH - 1)];
+    c.op = op;
+    return c;
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::push(void)
+{
+    // the store publishes the command filled in by slot()
+    uint32_t head = _head + 1;
+    core_util_atomic_store_u32(&_head, head);
+    _flags.set(QUEUE_CMD_FLAG);
+
+    uint32_t n = head - core_util_atomic_load_u32(&_tail);
+    if (n > _stats.max_depth) {
+        _stats.max_depth = n;
+    }
+    _stats.commands++;
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::run(void)
+{
+    uint32_t tail = _tail;
+
+    while (true) {
+        while (core_util_atomic_load_u32(&_head) == tail) {
+            _flags.wait_any(QUEUE_CMD_FLAG);
+        }
+        const Command &c = _ring[tail & (ST7735S_QUEUE_DEPTH - 1)];
+        if (c.op == OP_STOP) {
+            return;
+        }
+        execute(c);
+
+        // release the slot only after drawing, sync() relies on it
+        tail++;
+        core_util_atomic_store_u32(&_tail, tail);
+        core_util_atomic_store_u32(&_executed, _executed + 1);
+        _flags.set(QUEUE_SPACE_FLAG);
+    }
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::execute(const Command &c)
+{
+    int fg = _tft.foreground_color();
+    int bg = _tft.background_color();
+
+    switch (c.op) {
+        case OP_PIXEL:
+            _tft.pixel(c.x0, c.y0, c.color);
+            break;
+        case OP_LINE:
+            _tft.line(c.x0, c.y0, c.x1, c.y1, c.color);
+            break;
+        case OP_RECT:
+            _tft.rect(c.x0, c.y0, c.x1, c.y1, c.color);
+            break;
+        case OP_FILLRECT:
+            _tft.fillrect(c.x0, c.y0, c.x1, c.y1, c.color);
+            break;
+        case OP_CLS:
+            _tft.background(c.color);
+            _tft.cls();
+            _tft.background(bg);
+            break;
+        case OP_IMAGE:
+            _tft.Paint_DrawImage((const unsigned char *)c.ptr, c.x0, c.y0, c.x1, c.y1);
+            break;
+        case OP_BLIT:
+            _tft.blit(c.x0, c.y0, c.x1, c.y1, (const int *)c.ptr);
+            break;
+        case OP_BLITBIT:
+            _tft.foreground(c.color);
+            _tft.background(c.bg);
+            _tft.blitbit(c.x0, c.y0, c.x1, c.y1, (const char *)c.ptr);
+            _tft.foreground(fg);
+            _tft.background(bg);
+            break;
+        case OP_TEXT: {
+            // x1 is the cursor of a continued string, -1 starts at x0, y0
+            char s[ST7735S_QUEUE_TEXT + 1];
+            memcpy(s, c.text, ST7735S_QUEUE_TEXT);
+            s[ST7735S_QUEUE_TEXT] = 0;
+            _tft.foreground(c.color);
+            _tft.background(c.bg);
+            if (c.x1 < 0) {
+                _tft.locate(c.x0, c.y0);
+            }
+            _tft.puts(s);
+            _tft.foreground(fg);
+            _tft.background(bg);
+            break;
+        }
+        case OP_REGION:
+            _tft.begin_region(c.x0, c.y0, c.x1, c.y1);
+            break;
+        case OP_PIXELS:
+            _tft.push_pixels(c.pixels, c.x0);
+            break;
+        case OP_REPEAT:
+            _tft.push_repeat(c.color, c.count);
+            break;
+        case OP_END_REGION:
+            _tft.end_region();
+            break;
+        case OP_FLUSH:
+            _tft.flush();
+            break;
+    }
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::pixel(int x, int y, int color)
+{
+    Command &c = slot(OP_PIXEL);
+    c.x0 = x;
+    c.y0 = y;
+    c.color = color;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::line(int x0, int y0, int x1, int y1, int color)
+{
+    Command &c = slot(OP_LINE);
+    c.x0 = x0;
+    c.y0 = y0;
+    c.x1 = x1;
+    c.y1 = y1;
+    c.color = color;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::rect(int x0, int y0, int x1, int y1, int color)
+{
+    Command &c = slot(OP_RECT);
+    c.x0 = x0;
+    c.y0 = y0;
+    c.x1 = x1;
+    c.y1 = y1;
+    c.color = color;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::fillrect(int x0, int y0, int x1, int y1, int color)
+{
+    Command &c = slot(OP_FILLRECT);
+    c.x0 = x0;
+    c.y0 = y0;
+    c.x1 = x1;
+    c.y1 = y1;
+    c.color = color;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::cls(int color)
+{
+    Command &c = slot(OP_CLS);
+    c.color = color;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::image(const unsigned char *image, int x, int y, int w, int h)
+{
+    Command &c = slot(OP_IMAGE);
+    c.x0 = x;
+    c.y0 = y;
+    c.x1 = w;
+    c.y1 = h;
+    c.ptr = image;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::blit(int x, int y, int w, int h, const int *colors)
+{
+    Command &c = slot(OP_BLIT);
+    c.x0 = x;
+    c.y0 = y;
+    c.x1 = w;
+    c.y1 = h;
+    c.ptr = colors;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::blitbit(int x, int y, int w, int h, const char *bits, int fg, int bg)
+{
+    Command &c = slot(OP_BLITBIT);
+    c.x0 = x;
+    c.y0 = y;
+    c.x1 = w;
+    c.y1 = h;
+    c.color = fg;
+    c.bg = bg;
+    c.ptr = bits;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::text(int x, int y, const char *s, int fg, int bg)
+{
+    int len = strlen(s);
+    bool first = true;
+
+    // split into pieces of ST7735S_QUEUE_TEXT, the cursor carries on
+    do {
+        int n = (len < ST7735S_QUEUE_TEXT) ? len : ST7735S_QUEUE_TEXT;
+        Command &c = slot(OP_TEXT);
+        c.x0 = x;
+        c.y0 = y;
+        c.x1 = first ? -1 : 0;
+        c.color = fg;
+        c.bg = bg;
+        memset(c.text, 0, ST7735S_QUEUE_TEXT);
+        memcpy(c.text, s, n);
+        push();
+        s += n;
+        len -= n;
+        first = false;
+    } while (len > 0);
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::begin_region(int x, int y, int w, int h)
+{
+    Command &c = slot(OP_REGION);
+    c.x0 = x;
+    c.y0 = y;
+    c.x1 = w;
+    c.y1 = h;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::push_pixels(const uint16_t *colour, int n)
+{
+    const int max = ST7735S_QUEUE_PIXELS;
+
+    // x0 pixels copied per command, the caller may reuse colour at once
+    while (n > 0) {
+        int m = (n < max) ? n : max;
+        Command &c = slot(OP_PIXELS);
+        c.x0 = m;
+        memcpy(c.pixels, colour, m * sizeof(uint16_t));
+        push();
+        colour += m;
+        n -= m;
+    }
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::push_repeat(int colour, int n)
+{
+    Command &c = slot(OP_REPEAT);
+    c.color = colour;
+    c.count = n;
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::end_region(void)
+{
+    slot(OP_END_REGION);
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::flush(void)
+{
+    slot(OP_FLUSH);
+    push();
+}
+
+template <class Panel>
+void ST7735SDrawQueue<Panel>::sync(void)
+{
+    if (core_util_atomic_load_u32(&_tail) == _head) {
+        return;
+    }
+    _stats.syncs++;
+    while (core_util_atomic_load_u32(&_tail) != _head) {
+        _flags.wait_any(QUEUE_SPACE_FLAG);
+    }
+}
+
+template <class Panel>
+int ST7735SDrawQueue<Panel>::depth(void)
+{
+    return _head - core_util_atomic_load_u32(&_tail);
+}
+
+template <class Panel>
+typename ST7735SDrawQueue<Panel>::Stats ST7735SDrawQueue<Panel>::stats(void)
+{
+    Stats s = _stats;
+    s.executed = core_util_atomic_load_u32(&_executed);
+    return s;
+}
+
+#endif
@@ -0,0 +1,41 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Row-major glyph atlas used by ST7735S::set_font(const GlyphAtlas *).
+ *
+ * The GLCD fonts store every character as a full hor x vert matrix in
+ * columns, one bit per pixel with the vertical line split over bpl bytes.
+ * An atlas keeps only the tight bounding box of the ink of every glyph,
+ * stored row by row with the leftmost pixel in the most significant bit
+ * and every row padded to whole bytes, so a renderer can expand a row
+ * byte by byte straight into the pixel stream.
+ *
+ * Atlases are generated from the GLCD font arrays by host/fontconv
+ * (make -C host atlas) into fonts/<font>_atlas.h.
+ */
+
+#ifndef MBED_GLYPHATLAS_H
+#define MBED_GLYPHATLAS_H
+
+#include <stdint.h>
+
+/** one character of a GlyphAtlas */
+struct AtlasGlyph {
+    uint16_t offset;    // first row of the glyph in GlyphAtlas::bitmap
+    uint8_t advance;    // width of the character in pixel, ch[0] of the GLCD font
+    uint8_t x, y;       // top left corner of the ink inside the character cell
+    uint8_t w, h;       // size of the ink, 0 x 0 for blank characters
+};
+
+/** row-major font */
+struct GlyphAtlas {
+    uint8_t first;      // first character code
+    uint8_t count;      // number of characters
+    uint8_t width;      // character cell width, hor of the GLCD font
+    uint8_t height;     // character cell height, vert of the GLCD font
+    const AtlasGlyph *glyphs;
+    const uint8_t *bitmap;
+};
+
+#endif
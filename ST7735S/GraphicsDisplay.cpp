@@ -138,32 +138,69 @@ void GraphicsDisplay::putp(int colour) {
     }
 }
 
-void GraphicsDisplay::fill(int x, int y, int w, int h, int colour) { 
+void GraphicsDisplay::begin_region(int x, int y, int w, int h) {
     window(x, y, w, h);
-    for(int i=0; i<w*h; i++) {
+}
+
+void GraphicsDisplay::push_pixels(const uint16_t *colour, int n) {
+    for(int i=0; i<n; i++) {
+        putp(colour[i]);
+    }
+}
+
+void GraphicsDisplay::push_repeat(int colour, int n) {
+    for(int i=0; i<n; i++) {
         putp(colour);
     }
 }
+
+void GraphicsDisplay::end_region() {
+}
+
+void GraphicsDisplay::fill(int x, int y, int w, int h, int colour) { 
+    begin_region(x, y, w, h);
+    push_repeat(colour, w*h);
+    end_region();
+}
     
 void GraphicsDisplay::cls() {
     fill(0, 0, width(), height(), _background);
 }
     
 void GraphicsDisplay::blit(int x, int y, int w, int h, const int *colour) { 
-    window(x, y, w, h);
-    for(int i=0; i<w*h; i++) {
-        putp(colour[i]);
+    uint16_t buf[32];
+    int n = w*h;
+    begin_region(x, y, w, h);
+    // narrow the colours in chunks
+    for(int i=0; i<n; i+=32) {
+        int m = (n-i < 32) ? n-i : 32;
+        for(int k=0; k<m; k++) {
+            buf[k] = colour[i+k];
+        }
+        push_pixels(buf, m);
     }
+    end_region();
 }
     
 void GraphicsDisplay::blitbit(int x, int y, int w, int h, const char* colour) {
-    window(x, y, w, h);
-    for(int i = 0; i < w*h; i++) {
-        char byte = colour[i >> 3];
-        int offset = i & 0x7;
-        int c = ((byte << offset) & 0x80) ? _foreground : _background;
-        putp(c);
+    int n = w*h;
+    int run = 0;
+    bool set = false;
+    begin_region(x, y, w, h);
+    // runs of equal bits become one push_repeat
+    for(int i = 0; i < n; i++) {
+        bool bit = (colour[i >> 3] << (i & 0x7)) & 0x80;
+        if((run > 0) && (bit != set)) {
+            push_repeat(set ? _foreground : _background, run);
+            run = 0;
+        }
+        set = bit;
+        run++;
+    }
+    if(run > 0) {
+        push_repeat(set ? _foreground : _background, run);
     }
+    end_region();
 }
     
 int GraphicsDisplay::columns() { 
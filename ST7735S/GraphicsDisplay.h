@@ -9,11 +9,17 @@
  * (locate, printf, putc, cls, window, putp, fill, blit, blitbit) 
  * will come for free. You can also provide a specialised implementation
  * of window and putp to speed up the results
+ *
+ * fill, blit and blitbit stream whole regions through begin_region,
+ * push_pixels / push_repeat and end_region. The defaults fall back to
+ * window and putp; a display that implements the four gets bulk
+ * transfers for every drawing function built on them.
  */
 
 #ifndef MBED_GRAPHICSDISPLAY_H
 #define MBED_GRAPHICSDISPLAY_H
 
+#include <stdint.h>
 #include "TextDisplay.h"
 
 class GraphicsDisplay : public TextDisplay {
@@ -28,6 +34,12 @@ public:
         
     virtual void window(int x, int y, int w, int h);
     virtual void putp(int colour);
+
+    // span interface: pixels of a w x h region, row by row
+    virtual void begin_region(int x, int y, int w, int h);
+    virtual void push_pixels(const uint16_t *colour, int n);
+    virtual void push_repeat(int colour, int n);
+    virtual void end_region();
     
     virtual void cls();
     virtual void fill(int x, int y, int w, int h, int colour);
@@ -0,0 +1,89 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MBED_NUMBERFIELD_H
+#define MBED_NUMBERFIELD_H
+
+#include "mbed.h"
+#include "ST7735S.h"
+
+/** longest string a NumberField keeps, including the terminating zero */
+#ifndef ST7735S_FIELD_SIZE
+#define ST7735S_FIELD_SIZE 16
+#endif
+
+/** Text field that only redraws the characters that changed
+ *
+ * The field remembers the string drawn last. update() draws the new string
+ * with fixed-advance digits in TEXT_OPAQUE mode, skipping every character
+ * that is already on the panel at the same position, so a clock or a
+ * counter sends one or two glyphs per update instead of the whole string.
+ * Once a character with a different width is drawn, everything right of
+ * it is redrawn; a shorter string clears the rest of the old one. The
+ * field ends at the right edge of the display: characters that would not
+ * fit are dropped instead of wrapping to the next line.
+ *
+ * The field uses the font and colors selected on the display at update();
+ * after changing them call invalidate() so the next update draws it all.
+ *
+ * @code
+ * NumberField clock(tft, 20, 23);
+ * tft.set_font(&Neu42x35_atlas);
+ * clock.printf("%02d:%02d", h, m);
+ * @endcode
+ *
+ * NumberField draws on a ST7735S, ST7735SNumberField<Panel> on the driver
+ * of another panel.
+ */
+template <class Panel>
+class ST7735SNumberField {
+public:
+
+    /** Create a field
+    *
+    * @param tft display to draw on
+    * @param x,y top left corner of the field
+    */
+    ST7735SNumberField(ST7735SDisplay<Panel> &tft, int x, int y);
+
+    /** Draw a string into the field, only changed characters are sent
+    *
+    * @param s string, longer strings are cut to ST7735S_FIELD_SIZE - 1
+    *          characters and at the right edge of the display
+    */
+    void update(const char *s);
+
+    /** Format and draw a string like printf
+    *
+    */
+    void printf(const char *format, ...);
+
+    /** Forget what is on the panel, the next update() draws everything
+    *
+    */
+    void invalidate(void);
+
+    /** characters sent / skipped by update() since the field was created */
+    uint32_t drawn(void);
+    uint32_t skipped(void);
+
+private:
+    ST7735SDisplay<Panel> &_tft;
+    int _x, _y;
+    char _text[ST7735S_FIELD_SIZE];
+    int _len;
+    int _end;           // x right of the last character on the panel
+    bool _valid;
+    uint32_t _drawn;
+    uint32_t _skipped;
+};
+
+extern template class ST7735SNumberField<ST7735S_160x80>;
+extern template class ST7735SNumberField<ST7735S_80x160>;
+extern template class ST7735SNumberField<ST7735S_128x160>;
+
+typedef ST7735SNumberField<ST7735S_PANEL> NumberField;
+
+#endif
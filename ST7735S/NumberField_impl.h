@@ -0,0 +1,106 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Member definitions of ST7735SNumberField, instantiated by NumberField.cpp
+ * for the descriptors of ST7735SPanel.h (see ST7735S_impl.h for others) */
+
+#ifndef MBED_NUMBERFIELD_IMPL_H
+#define MBED_NUMBERFIELD_IMPL_H
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "NumberField.h"
+
+template <class Panel>
+ST7735SNumberField<Panel>::ST7735SNumberField(ST7735SDisplay<Panel> &tft, int x, int y)
+    : _tft(tft), _x(x), _y(y), _len(0), _end(x), _valid(false), _drawn(0), _skipped(0)
+{
+    _text[0] = 0;
+}
+
+template <class Panel>
+void ST7735SNumberField<Panel>::update(const char *s)
+{
+    typename ST7735SDisplay<Panel>::TextMode mode = _tft.text_mode();
+    bool fixed = _tft.fixed_digits();
+    bool shifted = !_valid;     // positions differ from the last string from here on
+    int len = strlen(s);
+    int x = _x;
+
+    if (len > ST7735S_FIELD_SIZE - 1) {
+        len = ST7735S_FIELD_SIZE - 1;
+    }
+
+    _tft.set_text_mode(ST7735SDisplay<Panel>::TEXT_OPAQUE);
+    _tft.set_fixed_digits(true);
+
+    for (int i = 0; i < len; i++) {
+        int adv = _tft.char_width(s[i]);
+
+        // the display would wrap it to the next line, out of the field
+        if (x + adv > _tft.width()) {
+            len = i;
+            break;
+        }
+        if (!shifted && (i < _len) && (_text[i] == s[i])) {
+            _skipped++;
+        } else {
+            if ((i >= _len) || (_tft.char_width(_text[i]) != adv)) {
+                shifted = true;
+            }
+            _tft.locate(x, _y);
+            _tft.character(x, _y, s[i]);
+            _drawn++;
+        }
+        x += adv;
+    }
+
+    // clear what is left of a longer old string
+    if (_valid && (x < _end)) {
+        _tft.fillrect(x, _y, _end - 1, _y + _tft.char_height() - 1, _tft.background_color());
+    }
+
+    memcpy(_text, s, len);
+    _text[len] = 0;
+    _len = len;
+    _end = x;
+    _valid = true;
+
+    _tft.set_text_mode(mode);
+    _tft.set_fixed_digits(fixed);
+}
+
+template <class Panel>
+void ST7735SNumberField<Panel>::printf(const char *format, ...)
+{
+    char buf[ST7735S_FIELD_SIZE];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    update(buf);
+}
+
+template <class Panel>
+void ST7735SNumberField<Panel>::invalidate(void)
+{
+    _valid = false;
+}
+
+template <class Panel>
+uint32_t ST7735SNumberField<Panel>::drawn(void)
+{
+    return _drawn;
+}
+
+template <class Panel>
+uint32_t ST7735SNumberField<Panel>::skipped(void)
+{
+    return _skipped;
+}
+
+#endif
@@ -0,0 +1,180 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Q565, a QOI style compressed format for RGB565 images.
+ *
+ * An image starts with an 8 byte header
+ *
+ *   'Q' '5' '6' '5' width (16 bit LE) height (16 bit LE)
+ *
+ * followed by the pixels row by row as a stream of ops. The decoder keeps
+ * the previous pixel (initially 0x0000) and an index of 64 recently seen
+ * colors at (r * 3 + g * 5 + b * 7) % 64 of their R5 G6 B5 channels:
+ *
+ *   00iiiiii           INDEX  color at index i
+ *   01rrggbb           DIFF   r += rr - 2, g += gg - 2, b += bb - 2
+ *   10gggggg rrrrbbbb  LUMA   dg = gggggg - 32, g += dg,
+ *                             r += (dg >> 1) + rrrr - 8, b += (dg >> 1) + bbbb - 8
+ *   11nnnnnn           RUN    previous pixel nnnnnn + 1 times (1..62)
+ *   11111110 hi lo     RGB    color, big endian
+ *
+ * Channels wrap around (modulo 32 / 64 / 32). Every pixel coming from
+ * DIFF, LUMA or RGB is stored in the index. Images are written by
+ * host/imgconv (make -C host images) into images/<source>_q565.h.
+ */
+
+#ifndef MBED_Q565_H
+#define MBED_Q565_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define Q565_OP_INDEX   0x00
+#define Q565_OP_DIFF    0x40
+#define Q565_OP_LUMA    0x80
+#define Q565_OP_RUN     0xC0
+#define Q565_OP_RGB     0xFE
+#define Q565_MASK       0xC0
+#define Q565_HEADER     8
+#define Q565_RUN_MAX    62
+
+/** index slot of a R5 G6 B5 color */
+inline int q565_hash(uint16_t c)
+{
+    return ((c >> 11) * 3 + ((c >> 5) & 0x3F) * 5 + (c & 0x1F) * 7) & 0x3F;
+}
+
+/** Streaming Q565 decoder, no allocation, 136 bytes of state
+ *
+ * @code
+ * Q565Decoder dec(image_q565);
+ * uint16_t line[32];
+ * while (int n = dec.decode(line, 32)) {
+ *     // n pixels, row by row
+ * }
+ * @endcode
+ */
+class Q565Decoder {
+public:
+
+    /** Start decoding an image
+    *
+    * @param data image with header, width() is 0 if the header is wrong
+    */
+    Q565Decoder(const uint8_t *data) : _p(data + Q565_HEADER), _px(0), _run(0), _w(0), _h(0), _left(0)
+    {
+        memset(_index, 0, sizeof(_index));
+        if (memcmp(data, "Q565", 4) == 0) {
+            _w = data[4] | (data[5] << 8);
+            _h = data[6] | (data[7] << 8);
+            _left = _w * _h;
+        }
+    }
+
+    int width() const
+    {
+        return _w;
+    }
+
+    int height() const
+    {
+        return _h;
+    }
+
+    /** pixels not decoded yet */
+    int left() const
+    {
+        return _left;
+    }
+
+    /** Decode the next pixels
+    *
+    * @param out receives up to n R5 G6 B5 pixels
+    * @param n pixels wanted
+    * @returns pixels decoded, less than n at the end of the image
+    */
+    int decode(uint16_t *out, int n)
+    {
+        if (n > _left) {
+            n = _left;
+        }
+        _left -= n;
+
+        const uint8_t *p = _p;
+        int px = _px;
+        int run = _run;
+        for (int i = 0; i < n; i++) {
+            if (run > 0) {
+                run--;
+                out[i] = px;
+                continue;
+            }
+            int op = *p++;
+            if (op == Q565_OP_RGB) {
+                px = (p[0] << 8) | p[1];
+                p += 2;
+            } else {
+                switch (op & Q565_MASK) {
+                    case Q565_OP_INDEX:
+                        px = _index[op];
+                        out[i] = px;
+                        continue;
+                    case Q565_OP_DIFF:
+                        px = pack(r(px) + ((op >> 4) & 0x03) - 2,
+                                  g(px) + ((op >> 2) & 0x03) - 2,
+                                  b(px) + (op & 0x03) - 2);
+                        break;
+                    case Q565_OP_LUMA: {
+                        int dg = (op & 0x3F) - 32;
+                        int rb = *p++;
+                        px = pack(r(px) + (dg >> 1) + (rb >> 4) - 8,
+                                  g(px) + dg,
+                                  b(px) + (dg >> 1) + (rb & 0x0F) - 8);
+                        break;
+                    }
+                    default:
+                        run = op & 0x3F;
+                        out[i] = px;
+                        continue;
+                }
+            }
+            _index[q565_hash(px)] = px;
+            out[i] = px;
+        }
+        _p = p;
+        _px = px;
+        _run = run;
+        return n;
+    }
+
+private:
+    static int r(int c)
+    {
+        return c >> 11;
+    }
+
+    static int g(int c)
+    {
+        return (c >> 5) & 0x3F;
+    }
+
+    static int b(int c)
+    {
+        return c & 0x1F;
+    }
+
+    static int pack(int r, int g, int b)
+    {
+        return ((r & 0x1F) << 11) | ((g & 0x3F) << 5) | (b & 0x1F);
+    }
+
+    const uint8_t *_p;
+    uint16_t _px;
+    int _run;
+    int _w, _h;
+    int _left;
+    uint16_t _index[64];
+};
+
+#endif
@@ -8,6 +8,9 @@
 
 #include "mbed.h"
 #include "GraphicsDisplay.h"
+#include "GlyphAtlas.h"
+#include "Q565.h"
+#include "Asset.h"
 
 #define RGB(r,g,b)  (((r&0xF8)<<8)|((g&0xFC)<<3)|((b&0xF8)>>3)) // 5 red | 6 green | 5 blue
 
@@ -81,6 +84,13 @@
 
 #define ST7735_GCV        0xFC
 
+#include "ST7735SPanel.h"
+
+/* panel of the ST7735S class, one of the descriptors in ST7735SPanel.h */
+#ifndef ST7735S_PANEL
+#define ST7735S_PANEL ST7735S_160x80
+#endif
+
 /* some RGB color definitions */
 
 #define Black           0x0000      /*   0,   0,   0 */
@@ -102,21 +112,184 @@
 #define Orange          0xFD20      /* 255, 165,   0 */
 #define GreenYellow     0xAFE5      /* 173, 255,  47 */
 
-const int _width = 160;
-const int _height = 80;
+/* GRAM rows of the controller, the direction SCRLAR / VSCSAD scroll in */
+#define ST7735S_GRAM_ROWS 162
+#define ST7735S_GRAM_COLS 132
+
+/* size of the staging buffer used to stream pixel data in SPI block writes (bytes, even) */
+#ifndef ST7735S_STAGE_SIZE
+#define ST7735S_STAGE_SIZE 128
+#endif
+
+/* size of each of the two buffers of the asynchronous transfer (bytes, even) */
+#ifndef ST7735S_ASYNC_CHUNK
+#define ST7735S_ASYNC_CHUNK 512
+#endif
 
-class ST7735S : public GraphicsDisplay {
+/* number of dirty rectangles tracked in FRAMEBUFFER mode */
+#ifndef ST7735S_DIRTY_RECTS
+#define ST7735S_DIRTY_RECTS 8
+#endif
+
+/* default cost of opening a window in flush(), in bytes of pixel data.
+ * A window takes 11 bytes on the wire (CASET, RASET, RAMWR and 8 address
+ * bytes) plus CS / D/C switching; host/st7735s_bench --window-cost showed
+ * the fewest total bytes around 64, as merging early avoids forced merges later */
+#ifndef ST7735S_WINDOW_COST
+#define ST7735S_WINDOW_COST 64
+#endif
+
+/* SPI clock for writes and for GRAM reads (150 ns minimum read cycle) */
+#ifndef ST7735S_SPI_HZ
+#define ST7735S_SPI_HZ 20000000
+#endif
+#ifndef ST7735S_READ_HZ
+#define ST7735S_READ_HZ 6000000
+#endif
+
+/* pixels read / blended per batch by draw_image_blend; rows longer than a
+ * batch are blended in pieces */
+#ifndef ST7735S_BLEND_PIXELS
+#define ST7735S_BLEND_PIXELS 256
+#endif
+
+/* bitmap() rebuilds its 4 KB expansion table for a new fg / bg pair only
+ * for at least this many pixels, smaller bitmaps are expanded per pixel */
+#ifndef ST7735S_BITMAP_LUT_MIN
+#define ST7735S_BITMAP_LUT_MIN 256
+#endif
+
+/* pixels draw_image_q565 decodes at a time into its line buffer */
+#ifndef ST7735S_DECODE_PIXELS
+#define ST7735S_DECODE_PIXELS 64
+#endif
+
+/* init sequence. The default keeps the margins of the original driver for
+ * modules with a slow supply ramp or a long reset RC: a 10 ms reset pulse,
+ * SWRESET, SLPOUT and 120 ms before the panel registers. ST7735S_INIT_FAST
+ * (config option ST7735S-INIT-FAST) uses the minimums of the ST7735S
+ * datasheet instead, without SWRESET and with the registers written while
+ * the controller waits for SLPOUT to be allowed. */
+#ifndef ST7735S_INIT_FAST
+#define ST7735S_INIT_FAST 0
+#endif
+#if ST7735S_INIT_FAST
+#ifndef ST7735S_T_RESET_US
+#define ST7735S_T_RESET_US 10       /* RESX low pulse */
+#endif
+#ifndef ST7735S_T_RESET_MS
+#define ST7735S_T_RESET_MS 5        /* RESX high to the first command */
+#endif
+#ifndef ST7735S_T_SLPOUT_MS
+#define ST7735S_T_SLPOUT_MS 120     /* RESX high to SLPOUT */
+#endif
+#ifndef ST7735S_T_WAKE_MS
+#define ST7735S_T_WAKE_MS 5         /* SLPOUT to the next command */
+#endif
+#else
+#ifndef ST7735S_T_RESET_US
+#define ST7735S_T_RESET_US 10000    /* RESX low pulse */
+#endif
+#ifndef ST7735S_T_RESET_MS
+#define ST7735S_T_RESET_MS 120      /* RESX high to the first command */
+#endif
+#ifndef ST7735S_T_SWRESET_MS
+#define ST7735S_T_SWRESET_MS 150    /* SWRESET to the next command */
+#endif
+#ifndef ST7735S_T_WAKE_MS
+#define ST7735S_T_WAKE_MS 120       /* SLPOUT to the next command */
+#endif
+#endif
+
+/* tile size in pixels of the FLUSH_TILES flush mode */
+#ifndef ST7735S_TILE_SIZE
+#define ST7735S_TILE_SIZE 16
+#endif
+
+/** Driver of a ST7735S panel described by a ST7735SPanel.h descriptor
+ *
+ * The init sequence and the inversion come from the descriptor at compile
+ * time. Size, offsets and MADCTL are members initialized from it, since
+ * set_orientation() changes them at runtime. ST7735S is the driver of
+ * ST7735S_PANEL (the 0.96" 160 x 80 module by default); other panels are
+ * used as ST7735SDisplay<ST7735S_128x160> and so on, a descriptor outside
+ * ST7735SPanel.h is instantiated through ST7735S_impl.h.
+ */
+template <class Panel>
+class ST7735SDisplay : public GraphicsDisplay {
 public:
 
+    /** How drawing functions reach the panel
+    *
+    *   DIRECT      every primitive is sent to the controller right away
+    *   FRAMEBUFFER primitives render into a _width x _height RGB565 buffer
+    *               in RAM, flush() sends the parts that changed
+    */
+    enum RenderMode {
+        DIRECT,
+        FRAMEBUFFER
+    };
+
+    /** How flush() decides what to send in FRAMEBUFFER mode
+    *
+    *   FLUSH_RECTS every dirty rectangle is sent
+    *   FLUSH_TILES the dirty tiles are hashed and only tiles whose content
+    *               differs from what was sent last are transmitted
+    */
+    enum FlushMode {
+        FLUSH_RECTS,
+        FLUSH_TILES
+    };
+
+    /** Pixel format on the SPI bus (COLMOD)
+    *
+    *   COLOR_RGB565 16 bit per pixel, 2 bytes per pixel
+    *   COLOR_RGB444 12 bit per pixel, 2 pixels in 3 bytes; colors are
+    *                given as RGB565 and reduced to 4 bit per channel
+    */
+    enum ColorMode {
+        COLOR_RGB565,
+        COLOR_RGB444
+    };
+
+    /** How character() paints a glyph
+    *
+    *   TEXT_CELL        the whole hor x vert cell of the font is painted,
+    *                    glyph in foreground on background
+    *   TEXT_OPAQUE      only the advance of the glyph (its width plus the
+    *                    gap, see set_char_gap) is painted, full cell height
+    *   TEXT_TRANSPARENT only the foreground pixels of the glyph are drawn,
+    *                    one window per horizontal run, so text can be put
+    *                    over an image without repainting it
+    */
+    enum TextMode {
+        TEXT_CELL,
+        TEXT_OPAQUE,
+        TEXT_TRANSPARENT
+    };
+
+    /** counters of flush() in FRAMEBUFFER mode */
+    struct FlushStats {
+        uint32_t flushes;           // flush() / flush_async() calls
+        uint32_t windows;           // windows opened to send dirty rectangles or tiles
+        uint32_t pixels_sent;       // pixels sent
+        uint32_t pixels_skipped;    // pixels not sent because they were not damaged or unchanged
+        uint32_t tiles_sent;        // FLUSH_TILES: dirty tiles with new content
+        uint32_t tiles_skipped;     // FLUSH_TILES: dirty tiles with the content already on the panel
+    };
+
     /** Create a ST7735_TFT object connected to SPI and three pins. ST7735 requires rs pin to toggle between data/command
       *
       * @param mosi,miso,sclk SPI
       * @param cs pin connected to CS of display (called SS for 'Slave Select' in ST7735 datasheet)
       * @param rs pin connected to RS of display (called D/CX in ST7735 datasheet)
       * @param reset pin connected to RESET of display
+      * @param mode DIRECT or FRAMEBUFFER (allocates _width * _height * 2 bytes)
       *
       */ 
-    ST7735S(PinName mosi, PinName miso, PinName sclk, PinName cs, PinName rs, PinName reset, const char* name = "TFT");
+    ST7735SDisplay(PinName mosi, PinName miso, PinName sclk, PinName cs, PinName rs, PinName reset, const char* name = "TFT", RenderMode mode = DIRECT);
+
+    virtual ~ST7735SDisplay();
 
     /** Get the width of the screen in pixel
     *
@@ -124,14 +297,20 @@ public:
     * @returns width of screen in pixel
     *
     */    
-    virtual int width();
+    virtual int width()
+    {
+        return _width;
+    }
 
     /** Get the height of the screen in pixel
     *
     * @returns height of screen in pixel 
     *
     */     
-    virtual int height();
+    virtual int height()
+    {
+        return _height;
+    }
 
     /** Draw a pixel at x,y with color 
     *  
@@ -156,8 +335,8 @@ public:
     * @param r radius
     * @param color 16 bit color
     *
-    * use circle with different radius,
-    * can miss some pixel
+    * midpoint scanline fill, one horizontal span per row;
+    * covers every pixel of circle() with the same radius
     */    
     void fillcircle(int x, int y, int r, int color); 
 
@@ -253,6 +432,109 @@ public:
     */    
     void Paint_DrawImage(const unsigned char *image, uint16_t xStart, uint16_t yStart, uint16_t W_Image, uint16_t H_Image);
 
+    /** paint an image of the asset registry
+    *
+    * @param asset ASSET_RGB565, ASSET_Q565 or ASSET_MONO entry, fonts are
+    *        ignored
+    * @param xStart, yStart upper left corner
+    *
+    *   the image is clipped to the screen and read from where it is
+    *   stored; RGB565 rows of stride bytes are sent row by row when only
+    *   part of a row is visible, MONO images are drawn with bitmap() in
+    *   the foreground and background colors
+    */
+    void Paint_DrawImage(const Asset &asset, int xStart, int yStart);
+
+    /** paint a Q565 compressed image
+    *
+    * @param image image with header, see Q565.h
+    * @param xStart, yStart upper left corner, the image is clipped to the screen
+    *
+    *   the image is decoded ST7735S_DECODE_PIXELS at a time into a line
+    *   buffer on the stack and streamed like Paint_DrawImage
+    */
+    void draw_image_q565(const unsigned char *image, int xStart, int yStart);
+
+    /** paint a bitmap on the TFT without blocking
+    *
+    * @param *image pointer to the bitmap data, same format as Paint_DrawImage
+    * @param xStart, yStart : upper left corner
+    * @param W_Image width of bitmap
+    * @param H_Image high of bitmap
+    * @param done called when the transfer is finished, from interrupt
+    *             context and before the driver is released, so it must not draw
+    *
+    *   The pixels are byte swapped into two ST7735S_ASYNC_CHUNK buffers and
+    *   sent with SPI::transfer(), the next chunk is prepared while the
+    *   previous one is on the bus. The image must stay valid until done.
+    *   A transfer still in progress is waited for first; every other
+    *   drawing function waits for the transfer to finish as well.
+    *   Without DEVICE_SPI_ASYNCH the image is drawn blocking.
+    */
+    void draw_image_async(const unsigned char *image, uint16_t xStart, uint16_t yStart, uint16_t W_Image, uint16_t H_Image, Callback<void()> done = nullptr);
+
+    /** send the damaged parts of the framebuffer to the panel
+    *
+    *   every drawing call records the rectangle it touched. Rectangles are
+    *   merged as long as one window over their union costs less than two
+    *   windows (see set_window_cost), flush() opens one window per
+    *   remaining rectangle. Does nothing in DIRECT mode.
+    */
+    void flush(void);
+
+    /** mark the whole screen as damaged, the next flush() sends everything
+    *
+    */
+    void invalidate(void);
+
+    /** select how flush() decides what to send
+    *
+    * @param mode FLUSH_RECTS (default) or FLUSH_TILES
+    *
+    *   FLUSH_TILES keeps a 32 bit hash per ST7735S_TILE_SIZE square tile of
+    *   the content last sent. Redrawing identical pixels (printf of an
+    *   unchanged value, the same image again) then costs no bus traffic.
+    */
+    void set_flush_mode(FlushMode mode);
+
+    /** set the cost model used to merge dirty rectangles
+    *
+    * @param bytes overhead of one window expressed in bytes of pixel data
+    */
+    void set_window_cost(int bytes);
+
+    /** get the flush() counters
+    *
+    */
+    const FlushStats &flush_stats(void);
+
+    /** send the framebuffer to the panel without blocking
+    *
+    * @param done called when the transfer is finished, same rules as draw_image_async
+    *
+    *   the buffer is kept in SPI byte order, so it is handed to
+    *   SPI::transfer() as is. Always sends the whole buffer.
+    *   Drawing waits for the transfer to finish.
+    */
+    void flush_async(Callback<void()> done = nullptr);
+
+    /** get the framebuffer
+    *
+    * @returns _width * _height pixels in SPI byte order, NULL in DIRECT mode
+    */
+    uint16_t *framebuffer(void);
+
+    /** check for an asynchronous transfer in progress
+    *
+    * @returns true while a transfer started by draw_image_async is running
+    */
+    bool async_busy(void);
+
+    /** wait until the asynchronous transfer is finished
+    *
+    */
+    void async_wait(void);
+
     /** select the font to use
     *
     * @param f pointer to font array 
@@ -263,10 +545,87 @@ public:
     *   - the vertial size in pixel
     *   - the horizontal size in pixel
     *   - the number of byte per vertical line
-    *   you also have to change the array to char[]
+    *   the array stays const, the font is read from flash by reference
     *
     */  
-    void set_font(unsigned char* f);
+    void set_font(const unsigned char* f);
+
+    /** select the pixel format on the bus
+    *
+    * @param mode COLOR_RGB565 (default) or COLOR_RGB444
+    *
+    *   COLOR_RGB444 cuts the pixel data by 25 %. All drawing functions and
+    *   the framebuffer keep working with RGB565 colors, the pixels are
+    *   packed while they are streamed. Single pixels cost a window each
+    *   in this mode, as the controller only writes after 12 bits.
+    */
+    void set_color_mode(ColorMode mode);
+
+    /** get the pixel format on the bus */
+    ColorMode color_mode(void);
+
+    /** select how characters are painted
+    *
+    * @param mode TEXT_CELL (default), TEXT_OPAQUE or TEXT_TRANSPARENT
+    *
+    *   TEXT_OPAQUE sends the cell only up to the next character, so narrow
+    *   glyphs of big fonts cost a fraction of the bytes. A narrower glyph
+    *   printed over a wider one leaves the right part of the old glyph.
+    */
+    void set_text_mode(TextMode mode);
+
+    /** set the space between characters
+    *
+    * @param gap pixels added to the width of a glyph to get the advance, default 2
+    */
+    void set_char_gap(int gap);
+
+    /** give all digits the advance of the widest one
+    *
+    * @param enable true: '0' .. '9' advance by the same width (tabular digits)
+    *
+    *   numbers then keep their positions when digits change, and in
+    *   TEXT_OPAQUE mode a digit always covers the one it replaces
+    */
+    void set_fixed_digits(bool enable);
+
+    /** current text mode and digit setting */
+    TextMode text_mode(void);
+    bool fixed_digits(void);
+
+    /** current foreground / background color set with foreground() / background() */
+    int foreground_color(void);
+    int background_color(void);
+
+    /** get the advance of a character in the active font
+    *
+    * @param c character
+    * @returns pixels from this character to the next one
+    */
+    int char_width(int c);
+
+    /** get the height of the character cell of the active font
+    *
+    */
+    int char_height(void);
+
+    /** select a precompiled font
+    *
+    * @param atlas row-major glyph atlas, see GlyphAtlas.h
+    *
+    *   renders the same pixels as the GLCD font the atlas was generated
+    *   from, but expands whole glyph rows instead of decoding the column
+    *   matrix bit by bit, and streams the empty parts of the cell as runs
+    *   of background color.
+    */
+    void set_font(const GlyphAtlas *atlas);
+
+    /** select a font of the asset registry
+    *
+    * @param asset ASSET_GLCD_FONT or ASSET_ATLAS_FONT entry, other formats
+    *        are ignored
+    */
+    void set_font(const Asset &asset);
 
     /** display on/off
     *
@@ -277,14 +636,196 @@ public:
     */
     void disp(int enable);
 
+    /** Draw a 1 bit per pixel bitmap
+    *
+    * @param x,y top left corner, the bitmap is clipped to the screen
+    * @param w,h size of the bitmap
+    * @param bits pixels, leftmost pixel in the most significant bit
+    * @param stride bytes per row, 0 if the rows follow each other without
+    *        padding like in blitbit()
+    * @param fg,bg colors of set / cleared bits
+    *
+    *   every source byte is expanded to 8 pixels in wire format with a
+    *   256 entry table built for the fg / bg pair and copied into the
+    *   staging buffer (or the framebuffer) as a whole
+    */
+    void bitmap(int x, int y, int w, int h, const uint8_t *bits, int stride, int fg, int bg);
+
+    /** GraphicsDisplay::blitbit through bitmap(), in the foreground and
+    *   background colors
+    *
+    */
+    virtual void blitbit(int x, int y, int w, int h, const char *colour);
+
+    /** Start a region for push_pixels() / push_repeat(), the span
+    *   interface of GraphicsDisplay used by fill, blit and blitbit
+    *
+    * @param x,y top left corner
+    * @param w,h size, a region not completely on the screen is drawn
+    *        through pixel() and clipped
+    */
+    virtual void begin_region(int x, int y, int w, int h);
+
+    /** Stream pixels into the region started by begin_region()
+    *
+    * @param colour 16 bit colors
+    * @param n number of pixels
+    */
+    virtual void push_pixels(const uint16_t *colour, int n);
+
+    /** Stream the same color n times into the region
+    *
+    */
+    virtual void push_repeat(int colour, int n);
+
+    /** Send the remaining pixels of the region
+    *
+    */
+    virtual void end_region();
+
+    /** Read pixels back from the controller GRAM (RAMRD)
+    *
+    * @param x0,y0 top left corner
+    * @param x1,y1 bottom right corner, the rectangle has to be on the screen
+    * @param buf receives the pixels row by row as RGB565
+    * @returns number of pixels read, 0 if the rectangle is not on the
+    *          screen or the display was created without MISO
+    *
+    *   the controller sends a dummy byte and then 18 bit pixels (6 bit R,
+    *   G, B left aligned in 3 bytes), which are reduced to RGB565. The read
+    *   runs at ST7735S_READ_HZ. Panel SDA / SDO has to reach MISO. In
+    *   FRAMEBUFFER mode the pixels come from the buffer, in COLOR_RGB444
+    *   reduced to what the panel holds.
+    */
+    int read_region(int x0, int y0, int x1, int y1, uint16_t *buf);
+
+    /** Blend an image over the panel content
+    *
+    * @param image 16 bit R5 G6 B5 pixels, low byte first, as Paint_DrawImage
+    * @param alpha 8 bit opacity per pixel (255 opaque), NULL for all 255
+    * @param xStart,yStart top left corner, the image is clipped to the screen
+    * @param W_Image,H_Image size of the image
+    * @param opacity opacity of the whole image, multiplied with alpha
+    * @returns false if the content cannot be read back (no MISO)
+    *
+    *   the covered pixels are read with read_region(), blended and written
+    *   back in batches of ST7735S_BLEND_PIXELS, so overlays need no
+    *   framebuffer
+    */
+    bool draw_image_blend(const unsigned char *image, const uint8_t *alpha, int xStart, int yStart, int W_Image, int H_Image, int opacity = 255);
+
+    /** Rotate the screen
+    *
+    * @param orientation 0, 1, 2 or 3: the content is rotated by 0, 90,
+    *                    180 or 270 degrees clockwise against the panel
+    *                    orientation given by the panel descriptor
+    * @param mirror mirror the content left to right
+    *
+    *   the controller does the rotation: MADCTL is reprogrammed and
+    *   width / height and the address offsets follow, so all drawing
+    *   stays in the natural address order and images are sent as they
+    *   are. The panel content is kept, scrolling is reset. In FRAMEBUFFER
+    *   mode pending changes are flushed and the buffer is rearranged to
+    *   the new orientation.
+    */
+    void set_orientation(int orientation, bool mirror = false);
+
+    /** get the orientation set by set_orientation() */
+    int orientation(void);
+
+    /** Define the part of the screen that scrolls in hardware
+    *
+    * @param x0 first line of the scroll area
+    * @param x1 last line of the scroll area
+    *
+    *   the controller scrolls along its GRAM rows. They run along x on
+    *   panels whose MADCTL exchanges rows and columns (landscape, like the
+    *   160 x 80 module), the area is then a range of columns over the full
+    *   height; on portrait panels it is a range of rows over the full
+    *   width. Lines before x0 and after x1 stay fixed. The content is not
+    *   changed, the scroll position is 0.
+    */
+    void scroll_area(int x0, int x1);
+
+    /** Scroll the scroll area content
+    *
+    * @param n lines to move the content to the left (up), negative to the right (down)
+    *
+    *   only moves the start address (VSCSAD), no pixel data is sent. The
+    *   columns leaving at one edge come back at the other one.
+    */
+    void scroll(int n);
+
+    /** Scroll and stream the exposed lines from an image
+    *
+    * @param image first pixel of the first new line, same format as Paint_DrawImage
+    * @param stride pixels from one image row to the next
+    * @param n lines to scroll and send
+    *
+    *   per call only n columns of _height pixels (n rows of _width pixels
+    *   on portrait panels) go over the bus
+    */
+    void scroll_image(const unsigned char *image, int stride, int n);
+
+    /** Get the line to draw to while the screen is scrolled
+    *
+    * @param x screen column (row on portrait panels)
+    * @returns the line to pass to the drawing functions so the pixels show at x
+    */
+    int scroll_column(int x);
+
+    /** End scrolling, the whole GRAM is shown unscrolled again
+    *
+    */
+    void scroll_reset(void);
+
     SPI _spi;
     DigitalOut _cs;
     DigitalOut _rs;
     DigitalOut _reset;
-    unsigned char* _font;
+    const unsigned char* _font;
+    const GlyphAtlas *_atlas;
+    TextMode _text_mode;
+    int _char_gap;
+    bool _fixed_digits;
+    int _digit_adv;         // advance of the widest digit, -1 when not known
    
 protected:
 
+    // tiles of the screen, the same number in every orientation
+    static const int _tiles_n = ((Panel::width + ST7735S_TILE_SIZE - 1) / ST7735S_TILE_SIZE) *
+                                ((Panel::height + ST7735S_TILE_SIZE - 1) / ST7735S_TILE_SIZE);
+
+    /** the controller scrolls along its GRAM rows: along x when MADCTL
+    *   exchanges rows and columns, along y otherwise
+    */
+    bool scroll_along_x(void)
+    {
+        return (_madctl & ST7735_MADCTL_MV) != 0;
+    }
+
+    /** GRAM row of line 0 of the scroll axis without mirroring */
+    int scroll_offset(void)
+    {
+        return scroll_along_x() ? _x_off : _y_off;
+    }
+
+    /** MADCTL mirrors the scroll axis, the GRAM rows run against it */
+    bool scroll_flipped(void)
+    {
+        return (_madctl & (scroll_along_x() ? ST7735_MADCTL_MX : ST7735_MADCTL_MY)) != 0;
+    }
+
+    /** Map a screen position in an orientation to the panel's native orientation
+    *
+    */
+    static void to_native(int orientation, bool mirror, int x, int y, int &nx, int &ny);
+
+    /** Map a position in the native orientation to the screen in an orientation
+    *
+    */
+    static void from_native(int orientation, bool mirror, int nx, int ny, int &x, int &y);
+
     /** draw a horizontal line
     *
     * @param x0 horizontal start
@@ -304,6 +845,37 @@ protected:
     */
     void vline(int y0, int y1, int x, int color);
 
+    /** draw a character of the atlas font at the text cursor
+    *
+    * @param c char to print
+    */
+    void character_atlas(int c);
+
+    /** width of a glyph without the gap, ch[0] of the GLCD font */
+    int glyph_width(int c);
+
+    /** pixels from one character to the next
+    *
+    * @param w width of the glyph
+    * @param hor width of the character cell
+    */
+    int char_advance(int w, int hor)
+    {
+        int adv = ((w + _char_gap) < hor) ? w + _char_gap : hor;
+        return (adv > 0) ? adv : 1;
+    }
+
+    /** size of the character cell of the active font */
+    int font_width(void)
+    {
+        return (_atlas != NULL) ? _atlas->width : _font[1];
+    }
+
+    int font_height(void)
+    {
+        return (_atlas != NULL) ? _atlas->height : _font[2];
+    }
+
     /** Set draw window region
     *
     * @param x horizontal position
@@ -313,6 +885,11 @@ protected:
     */    
     void window (unsigned int x, unsigned int y, unsigned int w, unsigned int h);
 
+    /** Set CASET / RASET for window() and read_region(), without a memory command
+    *
+    */
+    void addr_window (unsigned int x, unsigned int y, unsigned int w, unsigned int h);
+
     /** Set draw window region to whole screen
     *
     */  
@@ -337,6 +914,25 @@ protected:
     */   
     void wr_cmd(int value);
 
+    /** Write a command and its parameters with one CS assertion
+    *
+    * @param cmd command
+    * @param args parameters, sent as one block write
+    * @param n number of parameters
+    */
+    void wr_cmd_args(int cmd, const uint8_t *args, int n);
+
+    /** Send an init table, see ST7735SPanel.h
+    *
+    * @param t first entry of the table
+    */
+    void wr_table(const uint8_t *t);
+
+    /** Send the panel registers: inversion, the init table of the panel,
+    * COLMOD and MADCTL
+    */
+    void wr_panel_regs(void);
+
     /** write data to the LCD controller
     *
     * @param data to be written 
@@ -351,9 +947,286 @@ protected:
     */   
     void wr_reg (unsigned char reg, unsigned short val);
 
+    /** Open a region for the following pixel writes
+    *
+    * @param x0,y0 top left corner
+    * @param x1,y1 down right corner
+    *
+    *   sets the controller window and starts RAMWR data, or in FRAMEBUFFER
+    *   mode places the framebuffer cursor. Pixels fill the region row by
+    *   row like the controller address counter does.
+    */
+    void region(int x0, int y0, int x1, int y1);
+
+    /** Start streaming pixel data after RAMWR
+    *
+    *   pixels are collected in the staging buffer and sent with SPI block writes
+    */
+    void wr_pixels_begin(void);
+
+    /** Stream one pixel
+    *
+    * @param color 16 bit color
+    */
+    void wr_pixel(int color)
+    {
+        if (_fb != NULL) {
+            fb_pixel(color);
+            return;
+        }
+        if (_rgb444) {
+            wr_pixel444(rgb444(color));
+            return;
+        }
+        _stage[_stage_len++] = color >> 8;
+        _stage[_stage_len++] = color;
+        if (_stage_len == ST7735S_STAGE_SIZE) {
+            wr_stage();
+        }
+    }
+
+    /** convert a RGB565 color to 12 bit R4 G4 B4 */
+    static int rgb444(int color)
+    {
+        return ((color >> 4) & 0xF00) | ((color >> 3) & 0x0F0) | ((color >> 1) & 0x00F);
+    }
+
+    /** Stream one 12 bit pixel, two pixels are packed into 3 bytes
+    *
+    * @param c 12 bit R4 G4 B4 color
+    */
+    void wr_pixel444(int c)
+    {
+        if (_pend < 0) {
+            _pend = c;
+            return;
+        }
+        if (_stage_len > ST7735S_STAGE_SIZE - 3) {
+            wr_stage();
+        }
+        _stage[_stage_len++] = _pend >> 4;
+        _stage[_stage_len++] = (_pend << 4) | (c >> 8);
+        _stage[_stage_len++] = c;
+        _pend = -1;
+    }
+
+    /** Stage the pixel of an incomplete 12 bit pair, padded to whole bytes
+    *
+    */
+    void wr_pending444(void);
+
+    /** Stream the same color count times
+    *
+    * @param color 16 bit color
+    * @param count number of pixels
+    */
+    void wr_color(int color, int count);
+
+    /** wr_color() in COLOR_RGB444, packs whole pairs in the staging buffer
+    *
+    * @param c 12 bit color
+    * @param count number of pixels
+    */
+    void wr_color444(int c, int count);
+
+    /** Stream pixels of a bitmap
+    *
+    * @param image 16 bit R5 G6 B5 pixels, low byte first
+    * @param count number of pixels
+    */
+    void wr_image(const unsigned char *image, int count);
+
+    /** Stream a row of a 1 bit per pixel bitmap
+    *
+    * @param bits pixels, leftmost pixel in the most significant bit
+    * @param count number of pixels
+    *
+    *   set bits are sent in the foreground color, cleared bits in the
+    *   background color
+    */
+    void wr_bits(const uint8_t *bits, int count);
+
+    /** wr_bits() in COLOR_RGB444, two pixels at a time from a 4 entry table
+    *
+    */
+    void wr_bits444(const uint8_t *bits, int count);
+
+    /** Send the remaining staged pixels and end the transfer
+    *
+    */
+    void wr_pixels_end(void);
+
+    /** Build _bit_lut for fg / bg in the current wire format
+    *
+    * @param count pixels about to be drawn
+    * @returns false if the table is not built because count is too small
+    */
+    bool bit_lut(int fg, int bg, int count);
+
+    /** Byte of a bitmap starting at any bit, the pixels right of n are undefined
+    *
+    */
+    static uint8_t bit_byte(const uint8_t *bits, int bit, int n)
+    {
+        const uint8_t *p = bits + (bit >> 3);
+        int s = bit & 0x07;
+        if (s == 0) {
+            return p[0];
+        }
+        // the next byte only holds pixels when the run crosses it
+        return (s + n > 8) ? (uint8_t)((p[0] << s) | (p[1] >> (8 - s))) : (uint8_t)(p[0] << s);
+    }
+
+    /** Send the staging buffer
+    *
+    */
+    void wr_stage(void);
+
+    /** convert a color to the SPI byte order kept in the framebuffer */
+    static uint16_t fb_swap(int color)
+    {
+        return (uint16_t)(((color & 0xFF) << 8) | ((color >> 8) & 0xFF));
+    }
+
+    /** Write one pixel at the framebuffer cursor, clipped to the screen
+    *
+    * @param color 16 bit color
+    */
+    void fb_pixel(int color)
+    {
+        if (((unsigned int)_fb_x < (unsigned int)_width) && ((unsigned int)_fb_y < (unsigned int)_height)) {
+            _fb[_fb_y * _width + _fb_x] = fb_swap(color);
+        }
+        if (++_fb_x > _rx1) {
+            _fb_x = _rx0;
+            if (++_fb_y > _ry1) {
+                _fb_y = _ry0;
+            }
+        }
+    }
+
+    /** Write the same color count times at the framebuffer cursor
+    *
+    */
+    void fb_color(int color, int count);
+
+    struct DirtyRect {
+        int16_t x0, y0, x1, y1;
+    };
+
+    static DirtyRect rect_union(const DirtyRect &a, const DirtyRect &b)
+    {
+        DirtyRect u = { a.x0 < b.x0 ? a.x0 : b.x0, a.y0 < b.y0 ? a.y0 : b.y0,
+                        a.x1 > b.x1 ? a.x1 : b.x1, a.y1 > b.y1 ? a.y1 : b.y1 };
+        return u;
+    }
+
+    static int rect_area(const DirtyRect &r)
+    {
+        return (r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1);
+    }
+
+    /** Hash the framebuffer content of a tile
+    *
+    * @param tx,ty tile position
+    */
+    uint32_t tile_hash(int tx, int ty);
+
+    /** flush() for FLUSH_TILES
+    *
+    */
+    void flush_tiles(void);
+
+    /** send a rectangle of the framebuffer
+    *
+    */
+    void flush_rect(int x0, int y0, int x1, int y1);
+
+    /** Record a damaged rectangle of the framebuffer
+    *
+    * @param x0,y0 top left corner
+    * @param x1,y1 down right corner
+    */
+    void damage(int x0, int y0, int x1, int y1);
+
+    /** Byte swap the next chunk of the asynchronous transfer into a buffer
+    *
+    * @param i buffer index
+    */
+    void async_fill(int i);
+
+    /** SPI transfer completion handler of the asynchronous transfer
+    *
+    */
+    void async_event(int event);
+
     unsigned int char_x;
     unsigned int char_y;
 
+    // shadow of the controller CASET / RASET registers
+    unsigned int _caset_s, _caset_e;
+    unsigned int _raset_s, _raset_e;
+    bool _caset_ok;
+    bool _raset_ok;
+
+    // RAMWR address counter while pixel() streams: position of the next
+    // pixel and window it runs in, valid until the next command
+    bool _ram_ok;
+    int _ram_x, _ram_y;
+    int _ram_x0, _ram_y0, _ram_x1, _ram_y1;
+    int _last_x, _last_y;
+
+    // screen geometry in the current orientation
+    int _width, _height;
+    int _x_off, _y_off;     // CASET / RASET address of the pixel at 0, 0
+    uint8_t _madctl;
+    int _orientation;
+    bool _mirror;
+
+    int _scroll_x0;         // first line of the scroll area
+    int _scroll_w;          // lines in the scroll area, 0 when not scrolling
+    int _scroll_pos;        // content offset inside the scroll area
+
+    uint16_t *_fb;          // framebuffer, NULL in DIRECT mode
+    int _rx0, _ry0, _rx1, _ry1;
+    int _fb_x, _fb_y;
+
+    DirtyRect _dirty[ST7735S_DIRTY_RECTS];
+    int _dirty_n;
+    int _window_cost;
+    FlushStats _flush_stats;
+    FlushMode _flush_mode;
+    int _tiles_x, _tiles_y;
+    uint32_t _tile_hash[_tiles_n];          // index ty * _tiles_x + tx
+    bool _tile_known[_tiles_n];             // hash matches the panel content
+
+    bool _readable;         // MISO connected, RAMRD possible
+    bool _span_clip;        // region of begin_region() goes through pixel()
+    uint8_t (*_bit_lut)[16];  // bitmap(): 8 pixels per source byte, 16 bytes RGB565 or 12 bytes RGB444
+    int _lut_fg, _lut_bg;   // colors of _bit_lut, -1 when not built
+    bool _lut_444;          // _bit_lut holds packed RGB444
+    bool _rgb444;           // COLOR_RGB444 on the bus
+    int _pend;              // first pixel of an incomplete 12 bit pair, -1 if none
+
+    char _stage[ST7735S_STAGE_SIZE];
+    int _stage_len;
+
+    char _async_buf[2][ST7735S_ASYNC_CHUNK];
+    int _async_len[2];
+    int _async_cur;
+    const unsigned char *_async_src;
+    bool _async_be;         // _async_src holds pixels in SPI byte order (the framebuffer)
+    int _async_left;
+    volatile bool _async_busy;
+    Callback<void()> _async_done;
+    EventFlags _async_flags;
+
 };
 
+extern template class ST7735SDisplay<ST7735S_160x80>;
+extern template class ST7735SDisplay<ST7735S_80x160>;
+extern template class ST7735SDisplay<ST7735S_128x160>;
+
+typedef ST7735SDisplay<ST7735S_PANEL> ST7735S;
+
 #endif
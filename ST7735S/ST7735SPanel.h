@@ -0,0 +1,127 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MBED_ST7735SPANEL_H
+#define MBED_ST7735SPANEL_H
+
+#include <stdint.h>
+
+/* Panel descriptors for ST7735SDisplay, included by ST7735S.h.
+ *
+ * A panel is a struct of compile-time constants:
+ *
+ *   width, height      visible pixels in the orientation set by madctl
+ *   x_offset, y_offset CASET / RASET address of the top left visible pixel
+ *   madctl             MADCTL value sent by init()
+ *   invert             INVON instead of INVOFF (IPS panels)
+ *   init_table()       panel specific commands sent by init() while the
+ *                      controller still sleeps after the reset: command,
+ *                      number of parameters (| ST7735S_INIT_DELAY if a
+ *                      delay in ms follows the parameters), parameters,
+ *                      [delay], ..., ended by ST7735S_INIT_END
+ *
+ * The descriptor gives the native orientation, ST7735SDisplay::set_orientation
+ * derives MADCTL and the offsets of the other ones from it at runtime; only
+ * the init table and the inversion stay compile-time. The descriptors below
+ * are instantiated by ST7735S.cpp, NumberField.cpp and DrawQueue.cpp. For a
+ * new one, include ST7735S_impl.h (and NumberField_impl.h, DrawQueue_impl.h
+ * when used) in a source file of the application and add
+ *
+ *   template class ST7735SDisplay<MyPanel>;
+ *
+ * and the same for ST7735SNumberField / ST7735SDrawQueue.
+ */
+
+#define ST7735S_INIT_END    0xFF    /* not a command of the controller */
+#define ST7735S_INIT_DELAY  0x80    /* flag in the parameter count */
+
+/* MADCTL bits */
+#define ST7735_MADCTL_MY  0x80
+#define ST7735_MADCTL_MX  0x40
+#define ST7735_MADCTL_MV  0x20
+#define ST7735_MADCTL_ML  0x10
+#define ST7735_MADCTL_BGR 0x08
+
+/* 0.96" IPS module: frame rate, power and gamma settings of the panel */
+constexpr uint8_t ST7735S_init_096[] = {
+    ST7735_FRMCTR1, 3,  0x05, 0x3A, 0x3A,
+    ST7735_FRMCTR2, 3,  0x05, 0x3A, 0x3A,
+    ST7735_FRMCTR3, 6,  0x05, 0x3A, 0x3A, 0x05, 0x3A, 0x3A,
+    ST7735_INVCTR,  1,  0x03,
+    ST7735_PWCTR1,  3,  0x62, 0x02, 0x04,
+    ST7735_PWCTR2,  1,  0xC0,
+    ST7735_PWCTR3,  2,  0x0D, 0x00,
+    ST7735_PWCTR4,  2,  0x8D, 0x6A,
+    ST7735_PWCTR5,  2,  0x8D, 0xEE,
+    ST7735_VMCTR1,  1,  0x0E,
+    ST7735_GMCTRP1, 16, 0x10, 0x0E, 0x02, 0x03, 0x0E, 0x07, 0x02, 0x07,
+                        0x0A, 0x12, 0x27, 0x37, 0x00, 0x0D, 0x0E, 0x10,
+    ST7735_GMCTRN1, 16, 0x10, 0x0E, 0x03, 0x03, 0x0F, 0x06, 0x02, 0x08,
+                        0x0A, 0x13, 0x26, 0x36, 0x00, 0x0D, 0x0E, 0x10,
+    ST7735S_INIT_END
+};
+
+/* 1.8" TN module with a 128 x 160 panel */
+constexpr uint8_t ST7735S_init_18[] = {
+    ST7735_FRMCTR1, 3,  0x01, 0x2C, 0x2D,
+    ST7735_FRMCTR2, 3,  0x01, 0x2C, 0x2D,
+    ST7735_FRMCTR3, 6,  0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D,
+    ST7735_INVCTR,  1,  0x07,
+    ST7735_PWCTR1,  3,  0xA2, 0x02, 0x84,
+    ST7735_PWCTR2,  1,  0xC5,
+    ST7735_PWCTR3,  2,  0x0A, 0x00,
+    ST7735_PWCTR4,  2,  0x8A, 0x2A,
+    ST7735_PWCTR5,  2,  0x8A, 0xEE,
+    ST7735_VMCTR1,  1,  0x0E,
+    ST7735_GMCTRP1, 16, 0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D,
+                        0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10,
+    ST7735_GMCTRN1, 16, 0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29, 0x2D,
+                        0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10,
+    ST7735S_INIT_END
+};
+
+/** 0.96" 160 x 80 IPS module in landscape, the panel this driver was written for */
+struct ST7735S_160x80 {
+    static const int width = 160;
+    static const int height = 80;
+    static const int x_offset = 1;
+    static const int y_offset = 26;
+    static const uint8_t madctl = ST7735_MADCTL_MY | ST7735_MADCTL_MV | ST7735_MADCTL_BGR;
+    static const bool invert = true;
+    static const uint8_t *init_table()
+    {
+        return ST7735S_init_096;
+    }
+};
+
+/** 0.96" 80 x 160 IPS module in portrait */
+struct ST7735S_80x160 {
+    static const int width = 80;
+    static const int height = 160;
+    static const int x_offset = 26;
+    static const int y_offset = 1;
+    static const uint8_t madctl = ST7735_MADCTL_MY | ST7735_MADCTL_MX | ST7735_MADCTL_BGR;
+    static const bool invert = true;
+    static const uint8_t *init_table()
+    {
+        return ST7735S_init_096;
+    }
+};
+
+/** 1.8" 128 x 160 module in portrait */
+struct ST7735S_128x160 {
+    static const int width = 128;
+    static const int height = 160;
+    static const int x_offset = 0;
+    static const int y_offset = 0;
+    static const uint8_t madctl = ST7735_MADCTL_MY | ST7735_MADCTL_MX | ST7735_MADCTL_BGR;
+    static const bool invert = false;
+    static const uint8_t *init_table()
+    {
+        return ST7735S_init_18;
+    }
+};
+
+#endif
@@ -0,0 +1,2155 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Member definitions of ST7735SDisplay. ST7735S.cpp instantiates them for
+ * the descriptors of ST7735SPanel.h. For a descriptor of your own, include
+ * this file (and NumberField_impl.h, DrawQueue_impl.h if those are used)
+ * in one source file and instantiate the classes there:
+ *
+ *   #include "ST7735S_impl.h"
+ *
+ *   template class ST7735SDisplay<MyPanel>;
+ */
+
+#ifndef MBED_ST7735S_IMPL_H
+#define MBED_ST7735S_IMPL_H
+
+#include "ST7735S.h"
+#include "mbed.h"
+
+#define ASYNC_DONE_FLAG 0x01
+
+template <class Panel>
+ST7735SDisplay<Panel>::ST7735SDisplay(PinName mosi, PinName miso, PinName sclk, PinName cs, PinName rs, PinName reset, const char *name, RenderMode mode)
+    : GraphicsDisplay(name), _spi(mosi, miso, sclk), _cs(cs), _rs(rs), _reset(reset), _font(NULL), _atlas(NULL), _text_mode(TEXT_CELL), _char_gap(2), _fixed_digits(false), _digit_adv(-1), _fb(NULL), _dirty_n(0), _window_cost(ST7735S_WINDOW_COST), _flush_mode(FLUSH_RECTS), _rgb444(false), _pend(-1), _stage_len(0), _async_busy(false)
+{
+    _readable = (miso != NC);
+    _span_clip = false;
+    _bit_lut = NULL;
+    _lut_fg = -1;
+    _lut_bg = -1;
+    _lut_444 = false;
+    _width = Panel::width;
+    _height = Panel::height;
+    _x_off = Panel::x_offset;
+    _y_off = Panel::y_offset;
+    _madctl = Panel::madctl;
+    _orientation = 0;
+    _mirror = false;
+    _tiles_x = (_width + ST7735S_TILE_SIZE - 1) / ST7735S_TILE_SIZE;
+    _tiles_y = (_height + ST7735S_TILE_SIZE - 1) / ST7735S_TILE_SIZE;
+    if (mode == FRAMEBUFFER) {
+        _fb = new uint16_t[_width * _height];
+        memset(_fb, 0, _width * _height * sizeof(uint16_t));
+    }
+    memset(&_flush_stats, 0, sizeof(_flush_stats));
+    invalidate();
+    init();
+    char_x = 0;
+    char_y = 0;
+}
+
+template <class Panel>
+ST7735SDisplay<Panel>::~ST7735SDisplay()
+{
+    async_wait();
+    delete[] _fb;
+    delete[] _bit_lut;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_cmd(int cmd)
+{
+    if (_async_busy) {
+        async_wait();
+    }
+    if (cmd == ST7735_SWRESET) {
+        _caset_ok = false;
+        _raset_ok = false;
+    }
+    _ram_ok = false;
+    _rs = 0; // rs low, cs low for transmitting command
+    _cs = 0;
+    _spi.write(cmd);
+    _cs = 1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_cmd_args(int cmd, const uint8_t *args, int n)
+{
+    if (_async_busy) {
+        async_wait();
+    }
+    _ram_ok = false;
+    _rs = 0;
+    _cs = 0;
+    _spi.write(cmd);
+    if (n > 0) {
+        _rs = 1;
+        _spi.write((const char *)args, n, NULL, 0);
+    }
+    _cs = 1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_table(const uint8_t *t)
+{
+    while (t[0] != ST7735S_INIT_END) {
+        int n = t[1] & ~ST7735S_INIT_DELAY;
+        wr_cmd_args(t[0], &t[2], n);
+        if (t[1] & ST7735S_INIT_DELAY) {
+            ThisThread::sleep_for(std::chrono::milliseconds(t[2 + n]));
+            t++;
+        }
+        t += 2 + n;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_panel_regs(void)
+{
+    wr_cmd_args(Panel::invert ? ST7735_INVON : ST7735_INVOFF, NULL, 0);
+    wr_table(Panel::init_table());
+
+    uint8_t colmod = _rgb444 ? 0x03 : 0x05;
+    uint8_t madctl = _madctl;
+    wr_cmd_args(ST7735_COLMOD, &colmod, 1);
+    wr_cmd_args(ST7735_MADCTL, &madctl, 1);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_dat(int dat)
+{
+    if (_async_busy) {
+        async_wait();
+    }
+    _rs = 1; // rs high, cs low for transmitting data
+    _cs = 0;                         
+    _spi.write(dat);                                                           
+    _cs = 1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_reg (unsigned char reg, unsigned short val)
+{
+    wr_cmd(reg);
+    wr_dat(val);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_pixels_begin(void)
+{
+    _rs = 1;
+    _cs = 0;
+    _stage_len = 0;
+    _pend = -1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_pending444(void)
+{
+    if (_pend < 0) {
+        return;
+    }
+    // the controller stores the pixel after 12 bits, the last 4 bits are dropped
+    if (_stage_len > ST7735S_STAGE_SIZE - 2) {
+        wr_stage();
+    }
+    _stage[_stage_len++] = _pend >> 4;
+    _stage[_stage_len++] = _pend << 4;
+    _pend = -1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_stage(void)
+{
+    if (_stage_len > 0) {
+        _spi.write(_stage, _stage_len, NULL, 0);
+        _stage_len = 0;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::region(int x0, int y0, int x1, int y1)
+{
+    if (_fb != NULL) {
+        if (_async_busy) {
+            async_wait();
+        }
+        _rx0 = x0;
+        _rx1 = x1;
+        _ry0 = y0;
+        _ry1 = y1;
+        _fb_x = x0;
+        _fb_y = y0;
+        damage(x0, y0, x1, y1);
+        return;
+    }
+    window(x0, y0, x1, y1);
+    wr_pixels_begin();
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::damage(int x0, int y0, int x1, int y1)
+{
+    // clip to the screen
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= _width) x1 = _width - 1;
+    if (y1 >= _height) y1 = _height - 1;
+    if ((x0 > x1) || (y0 > y1)) {
+        return;
+    }
+
+    DirtyRect n = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1 };
+    bool merged = true;
+
+    // merge with every rect where one window over the union costs less than two
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < _dirty_n; i++) {
+            DirtyRect u = rect_union(n, _dirty[i]);
+            if (rect_area(u) * 2 <= (rect_area(n) + rect_area(_dirty[i])) * 2 + _window_cost) {
+                n = u;
+                _dirty[i] = _dirty[--_dirty_n];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (_dirty_n == ST7735S_DIRTY_RECTS) {
+        // no room left: merge with the rect adding the fewest pixels
+        int best = 0;
+        int best_cost = 0x7FFFFFFF;
+        for (int i = 0; i < _dirty_n; i++) {
+            int cost = rect_area(rect_union(n, _dirty[i])) - rect_area(_dirty[i]);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best = i;
+            }
+        }
+        n = rect_union(n, _dirty[best]);
+        _dirty[best] = _dirty[--_dirty_n];
+        damage(n.x0, n.y0, n.x1, n.y1);
+        return;
+    }
+    _dirty[_dirty_n++] = n;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::invalidate(void)
+{
+    _dirty_n = 0;
+    damage(0, 0, _width - 1, _height - 1);
+    memset(_tile_known, 0, sizeof(_tile_known));
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_flush_mode(FlushMode mode)
+{
+    // hashes are not maintained by FLUSH_RECTS
+    if (mode != _flush_mode) {
+        memset(_tile_known, 0, sizeof(_tile_known));
+    }
+    _flush_mode = mode;
+}
+
+template <class Panel>
+uint32_t ST7735SDisplay<Panel>::tile_hash(int tx, int ty)
+{
+    int x0 = tx * ST7735S_TILE_SIZE;
+    int y0 = ty * ST7735S_TILE_SIZE;
+    int x1 = (x0 + ST7735S_TILE_SIZE < _width) ? x0 + ST7735S_TILE_SIZE : _width;
+    int y1 = (y0 + ST7735S_TILE_SIZE < _height) ? y0 + ST7735S_TILE_SIZE : _height;
+    uint32_t h = 2166136261u;       // FNV-1a over 16 bit pixels
+
+    for (int y = y0; y < y1; y++) {
+        const uint16_t *p = &_fb[y * _width];
+        for (int x = x0; x < x1; x++) {
+            h = (h ^ p[x]) * 16777619u;
+        }
+    }
+    return h;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::flush_rect(int x0, int y0, int x1, int y1)
+{
+    int w = x1 - x0 + 1;
+
+    window(x0, y0, x1, y1);
+    wr_pixels_begin();
+    if (_rgb444) {
+        for (int y = y0; y <= y1; y++) {
+            const uint16_t *p = &_fb[y * _width + x0];
+            for (int i = 0; i < w; i++) {
+                wr_pixel444(rgb444(fb_swap(p[i])));
+            }
+        }
+        wr_pending444();
+        wr_stage();
+        _cs = 1;
+        return;
+    }
+    if (w == _width) {
+        _spi.write((const char *)&_fb[y0 * _width], w * (y1 - y0 + 1) * 2, NULL, 0);
+    } else {
+        for (int y = y0; y <= y1; y++) {
+            _spi.write((const char *)&_fb[y * _width + x0], w * 2, NULL, 0);
+        }
+    }
+    _cs = 1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::flush_tiles(void)
+{
+    bool changed[_tiles_n];
+    int sent = 0;
+    int windows = 0;
+    DirtyRect pending = { 0, 0, -1, -1 };
+
+    for (int ty = 0; ty < _tiles_y; ty++) {
+        int y0 = ty * ST7735S_TILE_SIZE;
+        int y1 = (y0 + ST7735S_TILE_SIZE < _height) ? y0 + ST7735S_TILE_SIZE - 1 : _height - 1;
+
+        for (int tx = 0; tx < _tiles_x; tx++) {
+            int x0 = tx * ST7735S_TILE_SIZE;
+            int x1 = x0 + ST7735S_TILE_SIZE - 1;
+            bool dirty = false;
+
+            changed[tx] = false;
+            for (int i = 0; (i < _dirty_n) && !dirty; i++) {
+                const DirtyRect &r = _dirty[i];
+                dirty = (r.x0 <= x1) && (r.x1 >= x0) && (r.y0 <= y1) && (r.y1 >= y0);
+            }
+            if (!dirty) {
+                continue;
+            }
+            uint32_t h = tile_hash(tx, ty);
+            int t = ty * _tiles_x + tx;
+            if (_tile_known[t] && (_tile_hash[t] == h)) {
+                _flush_stats.tiles_skipped++;
+                continue;
+            }
+            _tile_hash[t] = h;
+            _tile_known[t] = true;
+            changed[tx] = true;
+            _flush_stats.tiles_sent++;
+        }
+
+        // one window per run of changed tiles, extended downwards while
+        // the next tile row has a run at the same columns
+        for (int tx = 0; tx < _tiles_x; tx++) {
+            if (!changed[tx]) {
+                continue;
+            }
+            int end = tx;
+            while ((end + 1 < _tiles_x) && changed[end + 1]) {
+                end++;
+            }
+            int x0 = tx * ST7735S_TILE_SIZE;
+            int x1 = ((end + 1) * ST7735S_TILE_SIZE < _width) ? (end + 1) * ST7735S_TILE_SIZE - 1 : _width - 1;
+            if ((pending.x0 == x0) && (pending.x1 == x1) && (pending.y1 + 1 == y0)) {
+                pending.y1 = y1;
+            } else {
+                if (pending.x1 >= 0) {
+                    flush_rect(pending.x0, pending.y0, pending.x1, pending.y1);
+                    sent += rect_area(pending);
+                    windows++;
+                }
+                DirtyRect r = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1 };
+                pending = r;
+            }
+            tx = end;
+        }
+    }
+    if (pending.x1 >= 0) {
+        flush_rect(pending.x0, pending.y0, pending.x1, pending.y1);
+        sent += rect_area(pending);
+        windows++;
+    }
+
+    _flush_stats.flushes++;
+    _flush_stats.windows += windows;
+    _flush_stats.pixels_sent += sent;
+    _flush_stats.pixels_skipped += _width * _height - sent;
+    _dirty_n = 0;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_window_cost(int bytes)
+{
+    _window_cost = bytes;
+}
+
+template <class Panel>
+const typename ST7735SDisplay<Panel>::FlushStats &ST7735SDisplay<Panel>::flush_stats(void)
+{
+    return _flush_stats;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::fb_color(int color, int count)
+{
+    uint16_t c = fb_swap(color);
+
+    while (count > 0) {
+        int n = _rx1 - _fb_x + 1;
+        if (n > count) {
+            n = count;
+        }
+        if ((_fb_y >= 0) && (_fb_y < _height)) {
+            int x0 = (_fb_x < 0) ? 0 : _fb_x;
+            int x1 = (_fb_x + n > _width) ? _width : _fb_x + n;
+            uint16_t *p = &_fb[_fb_y * _width];
+            for (int x = x0; x < x1; x++) {
+                p[x] = c;
+            }
+        }
+        count -= n;
+        _fb_x += n;
+        if (_fb_x > _rx1) {
+            _fb_x = _rx0;
+            if (++_fb_y > _ry1) {
+                _fb_y = _ry0;
+            }
+        }
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_color(int color, int count)
+{
+    if (_fb != NULL) {
+        fb_color(color, count);
+        return;
+    }
+    if (_rgb444) {
+        wr_color444(rgb444(color), count);
+        return;
+    }
+    while ((count > 0) && (_stage_len < ST7735S_STAGE_SIZE)) {
+        _stage[_stage_len++] = color >> 8;
+        _stage[_stage_len++] = color;
+        count--;
+    }
+    if (count == 0) {
+        return;
+    }
+    wr_stage();
+
+    // fill the staging buffer with the color once and send it as often as needed
+    for (int i = 0; i < ST7735S_STAGE_SIZE; i += 2) {
+        _stage[i] = color >> 8;
+        _stage[i + 1] = color;
+    }
+    while (count >= ST7735S_STAGE_SIZE / 2) {
+        _spi.write(_stage, ST7735S_STAGE_SIZE, NULL, 0);
+        count -= ST7735S_STAGE_SIZE / 2;
+    }
+    _stage_len = count * 2;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_color444(int c, int count)
+{
+    char b0 = c >> 4, b1 = (c << 4) | (c >> 8), b2 = c;
+
+    // complete a pair that was started before
+    if ((count > 0) && (_pend >= 0)) {
+        wr_pixel444(c);
+        count--;
+    }
+    while ((count >= 2) && (_stage_len <= ST7735S_STAGE_SIZE - 3)) {
+        _stage[_stage_len++] = b0;
+        _stage[_stage_len++] = b1;
+        _stage[_stage_len++] = b2;
+        count -= 2;
+    }
+    if (count >= 2) {
+        wr_stage();
+
+        // the pattern repeats every 3 bytes, fill whole pairs once and send them as often as needed
+        const int pairs = ST7735S_STAGE_SIZE / 3;
+        for (int i = 0; i < pairs * 3; i += 3) {
+            _stage[i] = b0;
+            _stage[i + 1] = b1;
+            _stage[i + 2] = b2;
+        }
+        while (count >= pairs * 2) {
+            _spi.write(_stage, pairs * 3, NULL, 0);
+            count -= pairs * 2;
+        }
+        _stage_len = (count / 2) * 3;
+        count &= 1;
+    }
+    if (count > 0) {
+        _pend = c;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_image(const unsigned char *image, int count)
+{
+    if (_fb != NULL) {
+        for (int i = 0; i < count; i++) {
+            fb_pixel(image[0] | (image[1] << 8));
+            image += 2;
+        }
+        return;
+    }
+    if (_rgb444) {
+        if ((count > 0) && (_pend >= 0)) {
+            wr_pixel444(rgb444(image[0] | (image[1] << 8)));
+            image += 2;
+            count--;
+        }
+        while (count >= 2) {
+            if (_stage_len > ST7735S_STAGE_SIZE - 3) {
+                wr_stage();
+            }
+            int a = rgb444(image[0] | (image[1] << 8));
+            int b = rgb444(image[2] | (image[3] << 8));
+            _stage[_stage_len++] = a >> 4;
+            _stage[_stage_len++] = (a << 4) | (b >> 8);
+            _stage[_stage_len++] = b;
+            image += 4;
+            count -= 2;
+        }
+        if (count > 0) {
+            _pend = rgb444(image[0] | (image[1] << 8));
+        }
+        return;
+    }
+    while (count > 0) {
+        while ((count > 0) && (_stage_len < ST7735S_STAGE_SIZE)) {
+            _stage[_stage_len++] = image[1];
+            _stage[_stage_len++] = image[0];
+            image += 2;
+            count--;
+        }
+        if (_stage_len == ST7735S_STAGE_SIZE) {
+            wr_stage();
+        }
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_bits(const uint8_t *bits, int count)
+{
+    if (_fb != NULL) {
+        if ((_fb_x >= 0) && (_fb_x + count <= _rx1 + 1) && (_fb_x + count <= _width) &&
+                ((unsigned int)_fb_y < (unsigned int)_height)) {
+            // the run stays on one visible framebuffer row
+            uint16_t fg = fb_swap(_foreground);
+            uint16_t bg = fb_swap(_background);
+            uint16_t *p = &_fb[_fb_y * _width + _fb_x];
+            for (int i = 0; i < count; i++) {
+                p[i] = (bits[i >> 3] & (0x80 >> (i & 0x07))) ? fg : bg;
+            }
+            _fb_x += count;
+            if (_fb_x > _rx1) {
+                _fb_x = _rx0;
+                if (++_fb_y > _ry1) {
+                    _fb_y = _ry0;
+                }
+            }
+            return;
+        }
+        for (int i = 0; i < count; i++) {
+            fb_pixel((bits[i >> 3] & (0x80 >> (i & 0x07))) ? _foreground : _background);
+        }
+        return;
+    }
+
+    if (_rgb444) {
+        wr_bits444(bits, count);
+        return;
+    }
+
+    char fg_hi = _foreground >> 8, fg_lo = _foreground;
+    char bg_hi = _background >> 8, bg_lo = _background;
+
+    while (count > 0) {
+        uint8_t b = *bits++;
+        int n = (count < 8) ? count : 8;
+
+        // whole bytes go into the staging buffer without a bounds check per pixel
+        if (_stage_len > ST7735S_STAGE_SIZE - 16) {
+            wr_stage();
+        }
+        char *p = &_stage[_stage_len];
+        for (int k = 0; k < n; k++) {
+            bool set = (b & 0x80) != 0;
+            *p++ = set ? fg_hi : bg_hi;
+            *p++ = set ? fg_lo : bg_lo;
+            b <<= 1;
+        }
+        _stage_len += n * 2;
+        count -= n;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_bits444(const uint8_t *bits, int count)
+{
+    int fg = rgb444(_foreground);
+    int bg = rgb444(_background);
+    char pair[4][3];
+
+    // the 3 bytes of each combination of two pixels, index bit 1 is the first pixel
+    for (int i = 0; i < 4; i++) {
+        int a = (i & 2) ? fg : bg;
+        int b = (i & 1) ? fg : bg;
+        pair[i][0] = a >> 4;
+        pair[i][1] = (a << 4) | (b >> 8);
+        pair[i][2] = b;
+    }
+
+    int i = 0;
+    if ((count > 0) && (_pend >= 0)) {
+        wr_pixel444((bits[0] & 0x80) ? fg : bg);
+        i = 1;
+    }
+    while (i + 1 < count) {
+        if (_stage_len > ST7735S_STAGE_SIZE - 3) {
+            wr_stage();
+        }
+        // i and i + 1 share a byte when i is even
+        int k = ((bits[i >> 3] << (i & 0x07)) & 0x80) ? 2 : 0;
+        if ((bits[(i + 1) >> 3] << ((i + 1) & 0x07)) & 0x80) {
+            k |= 1;
+        }
+        const char *p = pair[k];
+        _stage[_stage_len++] = p[0];
+        _stage[_stage_len++] = p[1];
+        _stage[_stage_len++] = p[2];
+        i += 2;
+    }
+    if (i < count) {
+        _pend = ((bits[i >> 3] << (i & 0x07)) & 0x80) ? fg : bg;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::wr_pixels_end(void)
+{
+    if (_fb != NULL) {
+        return;
+    }
+    if (_rgb444) {
+        wr_pending444();
+    }
+    wr_stage();
+    _cs = 1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::init()
+{    
+    // init SPI
+    _spi.format(8, 3);
+    _spi.frequency(ST7735S_SPI_HZ);
+    
+    _caset_ok = false;
+    _raset_ok = false;
+    _ram_ok = false;
+    _last_x = -1;
+    _last_y = -1;
+    _scroll_w = 0;
+
+#if ST7735S_INIT_FAST
+    // the hardware reset makes SWRESET unnecessary; the panel registers
+    // are written while the controller waits for SLPOUT to be allowed
+    _reset = 0;
+    wait_us(ST7735S_T_RESET_US);
+    _reset = 1;
+    ThisThread::sleep_for(std::chrono::milliseconds(ST7735S_T_RESET_MS));
+
+    wr_panel_regs();
+
+    // sending the registers takes well under a millisecond at 20 MHz
+    ThisThread::sleep_for(std::chrono::milliseconds(ST7735S_T_SLPOUT_MS - ST7735S_T_RESET_MS));
+    wr_cmd_args(ST7735_SLPOUT, NULL, 0);
+    ThisThread::sleep_for(std::chrono::milliseconds(ST7735S_T_WAKE_MS));
+#else
+    // RESX is low since the construction of _reset
+    _reset = 0;
+    ThisThread::sleep_for(std::chrono::milliseconds(ST7735S_T_RESET_US / 1000));
+    _reset = 1;
+    ThisThread::sleep_for(std::chrono::milliseconds(ST7735S_T_RESET_MS));
+
+    wr_cmd(ST7735_SWRESET);
+    ThisThread::sleep_for(std::chrono::milliseconds(ST7735S_T_SWRESET_MS));
+    wr_cmd(ST7735_SLPOUT);
+    ThisThread::sleep_for(std::chrono::milliseconds(ST7735S_T_WAKE_MS));
+
+    wr_panel_regs();
+#endif
+
+    //wr_cmd(ST7735_DISPON);
+
+    WindowMax ();
+}
+
+/* GRAM position of a column / row address under a MADCTL value */
+static void madctl_map(uint8_t madctl, int col, int row, int &px, int &py)
+{
+    bool mv = (madctl & ST7735_MADCTL_MV) != 0;
+
+    if (madctl & ST7735_MADCTL_MX) {
+        col = (mv ? ST7735S_GRAM_ROWS : ST7735S_GRAM_COLS) - 1 - col;
+    }
+    if (madctl & ST7735_MADCTL_MY) {
+        row = (mv ? ST7735S_GRAM_COLS : ST7735S_GRAM_ROWS) - 1 - row;
+    }
+    px = mv ? row : col;
+    py = mv ? col : row;
+}
+
+/* column / row address of a GRAM position under a MADCTL value */
+static void madctl_unmap(uint8_t madctl, int px, int py, int &col, int &row)
+{
+    bool mv = (madctl & ST7735_MADCTL_MV) != 0;
+
+    col = mv ? py : px;
+    row = mv ? px : py;
+    if (madctl & ST7735_MADCTL_MX) {
+        col = (mv ? ST7735S_GRAM_ROWS : ST7735S_GRAM_COLS) - 1 - col;
+    }
+    if (madctl & ST7735_MADCTL_MY) {
+        row = (mv ? ST7735S_GRAM_COLS : ST7735S_GRAM_ROWS) - 1 - row;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::to_native(int orientation, bool mirror, int x, int y, int &nx, int &ny)
+{
+    if (mirror) {
+        x = ((orientation & 1) ? Panel::height : Panel::width) - 1 - x;
+    }
+    switch (orientation) {
+        case 1:
+            nx = Panel::width - 1 - y;
+            ny = x;
+            break;
+        case 2:
+            nx = Panel::width - 1 - x;
+            ny = Panel::height - 1 - y;
+            break;
+        case 3:
+            nx = y;
+            ny = Panel::height - 1 - x;
+            break;
+        default:
+            nx = x;
+            ny = y;
+            break;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::from_native(int orientation, bool mirror, int nx, int ny, int &x, int &y)
+{
+    switch (orientation) {
+        case 1:
+            x = ny;
+            y = Panel::width - 1 - nx;
+            break;
+        case 2:
+            x = Panel::width - 1 - nx;
+            y = Panel::height - 1 - ny;
+            break;
+        case 3:
+            x = Panel::height - 1 - ny;
+            y = nx;
+            break;
+        default:
+            x = nx;
+            y = ny;
+            break;
+    }
+    if (mirror) {
+        x = ((orientation & 1) ? Panel::height : Panel::width) - 1 - x;
+    }
+}
+
+template <class Panel>
+bool ST7735SDisplay<Panel>::bit_lut(int fg, int bg, int count)
+{
+    bool pack = (_fb == NULL) && _rgb444;
+
+    if ((_bit_lut != NULL) && (fg == _lut_fg) && (bg == _lut_bg) && (pack == _lut_444)) {
+        return true;
+    }
+    if (count < ST7735S_BITMAP_LUT_MIN) {
+        return false;
+    }
+    if (_bit_lut == NULL) {
+        _bit_lut = new uint8_t[256][16];
+    }
+    for (int b = 0; b < 256; b++) {
+        uint8_t *p = _bit_lut[b];
+        if (pack) {
+            // 4 pairs of 12 bit pixels in 3 bytes each
+            int f = rgb444(fg), g = rgb444(bg);
+            for (int k = 0; k < 8; k += 2) {
+                int c0 = ((b << k) & 0x80) ? f : g;
+                int c1 = ((b << k) & 0x40) ? f : g;
+                *p++ = c0 >> 4;
+                *p++ = (c0 << 4) | (c1 >> 8);
+                *p++ = c1;
+            }
+        } else {
+            // SPI byte order, the framebuffer holds the same bytes
+            for (int k = 0; k < 8; k++) {
+                int c = ((b << k) & 0x80) ? fg : bg;
+                *p++ = c >> 8;
+                *p++ = c;
+            }
+        }
+    }
+    _lut_fg = fg;
+    _lut_bg = bg;
+    _lut_444 = pack;
+    return true;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::bitmap(int x, int y, int w, int h, const uint8_t *bits, int stride, int fg, int bg)
+{
+    int x0 = (x < 0) ? 0 : x;
+    int y0 = (y < 0) ? 0 : y;
+    int x1 = (x + w > _width) ? _width - 1 : x + w - 1;
+    int y1 = (y + h > _height) ? _height - 1 : y + h - 1;
+
+    if ((x0 > x1) || (y0 > y1)) {
+        return;
+    }
+    int row_bits = (stride > 0) ? stride * 8 : w;
+    int cw = x1 - x0 + 1;
+    int bit = (y0 - y) * row_bits + (x0 - x);
+    bool lut = bit_lut(fg, bg, cw * (y1 - y0 + 1));
+
+    region(x0, y0, x1, y1);
+    for (int yy = y0; yy <= y1; yy++, bit += row_bits) {
+        int b = bit;
+        int n = cw;
+        if (!lut) {
+            for (int i = 0; i < n; i++, b++) {
+                wr_pixel(((bits[b >> 3] << (b & 0x07)) & 0x80) ? fg : bg);
+            }
+            continue;
+        }
+        if (_fb != NULL) {
+            // rows of the clipped region are contiguous in the framebuffer
+            uint8_t *p = (uint8_t *)&_fb[yy * _width + x0];
+            while (n > 0) {
+                int m = (n < 8) ? n : 8;
+                memcpy(p, _bit_lut[bit_byte(bits, b, m)], m * 2);
+                p += m * 2;
+                b += m;
+                n -= m;
+            }
+            continue;
+        }
+        if (_lut_444) {
+            // realign to whole pairs after an odd row
+            if (_pend >= 0) {
+                wr_pixel444(((bits[b >> 3] << (b & 0x07)) & 0x80) ? rgb444(fg) : rgb444(bg));
+                b++;
+                n--;
+            }
+            while (n > 0) {
+                int m = (n < 8) ? n : 8;
+                uint8_t v = bit_byte(bits, b, m);
+                if (_stage_len > ST7735S_STAGE_SIZE - 12) {
+                    wr_stage();
+                }
+                memcpy(&_stage[_stage_len], _bit_lut[v], m / 2 * 3);
+                _stage_len += m / 2 * 3;
+                if (m & 1) {
+                    _pend = ((v << (m - 1)) & 0x80) ? rgb444(fg) : rgb444(bg);
+                }
+                b += m;
+                n -= m;
+            }
+            continue;
+        }
+        while (n > 0) {
+            int m = (n < 8) ? n : 8;
+            if (_stage_len > ST7735S_STAGE_SIZE - 16) {
+                wr_stage();
+            }
+            memcpy(&_stage[_stage_len], _bit_lut[bit_byte(bits, b, m)], m * 2);
+            _stage_len += m * 2;
+            b += m;
+            n -= m;
+        }
+    }
+    wr_pixels_end();
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::blitbit(int x, int y, int w, int h, const char *colour)
+{
+    bitmap(x, y, w, h, (const uint8_t *)colour, 0, _foreground, _background);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::begin_region(int x, int y, int w, int h)
+{
+    _span_clip = (x < 0) || (y < 0) || (w <= 0) || (h <= 0) || (x + w > _width) || (y + h > _height);
+    if (_span_clip) {
+        GraphicsDisplay::begin_region(x, y, w, h);
+        return;
+    }
+    region(x, y, x + w - 1, y + h - 1);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::push_pixels(const uint16_t *colour, int n)
+{
+    if (_span_clip) {
+        GraphicsDisplay::push_pixels(colour, n);
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        wr_pixel(colour[i]);
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::push_repeat(int colour, int n)
+{
+    if (_span_clip) {
+        GraphicsDisplay::push_repeat(colour, n);
+        return;
+    }
+    wr_color(colour, n);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::end_region()
+{
+    if (!_span_clip) {
+        wr_pixels_end();
+    }
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::read_region(int x0, int y0, int x1, int y1, uint16_t *buf)
+{
+    if ((x0 < 0) || (y0 < 0) || (x1 >= _width) || (y1 >= _height) || (x0 > x1) || (y0 > y1)) {
+        return 0;
+    }
+    int w = x1 - x0 + 1;
+    int n = w * (y1 - y0 + 1);
+
+    if (_fb != NULL) {
+        if (_async_busy) {
+            async_wait();
+        }
+        for (int y = y0; y <= y1; y++) {
+            const uint16_t *p = &_fb[y * _width + x0];
+            for (int i = 0; i < w; i++) {
+                int c = fb_swap(p[i]);
+                if (_rgb444) {
+                    // 4 bit per channel, expanded like the controller does
+                    int r = (c >> 12) & 0x0F, g = (c >> 7) & 0x0F, b = (c >> 1) & 0x0F;
+                    c = (((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3));
+                }
+                *buf++ = c;
+            }
+        }
+        return n;
+    }
+    if (!_readable) {
+        return 0;
+    }
+
+    if (_async_busy) {
+        async_wait();
+    }
+    addr_window(x0, y0, x1, y1);
+    _ram_ok = false;
+
+    // CS stays low from RAMRD to the last pixel, a rising CS ends the read
+    _spi.frequency(ST7735S_READ_HZ);
+    _rs = 0;
+    _cs = 0;
+    _spi.write(ST7735_RAMRD);
+    _rs = 1;
+    _spi.write(NULL, 0, _stage, 1);     // dummy byte
+
+    // whole pixels of 3 bytes per block read
+    const int chunk = ST7735S_STAGE_SIZE / 3;
+    for (int k = 0; k < n; k += chunk) {
+        int m = (n - k < chunk) ? n - k : chunk;
+        _spi.write(NULL, 0, _stage, m * 3);
+        for (int i = 0; i < m; i++) {
+            const uint8_t *p = (const uint8_t *)&_stage[i * 3];
+            *buf++ = ((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3);
+        }
+    }
+    _cs = 1;
+    _spi.frequency(ST7735S_SPI_HZ);
+    return n;
+}
+
+template <class Panel>
+bool ST7735SDisplay<Panel>::draw_image_blend(const unsigned char *image, const uint8_t *alpha, int xStart, int yStart, int W_Image, int H_Image, int opacity)
+{
+    uint16_t buf[ST7735S_BLEND_PIXELS];
+    int x0 = (xStart < 0) ? 0 : xStart;
+    int y0 = (yStart < 0) ? 0 : yStart;
+    int x1 = (xStart + W_Image > _width) ? _width - 1 : xStart + W_Image - 1;
+    int y1 = (yStart + H_Image > _height) ? _height - 1 : yStart + H_Image - 1;
+
+    if ((x0 > x1) || (y0 > y1)) {
+        return true;
+    }
+    // whole rows per batch, a row longer than the batch in pieces
+    int w = (x1 - x0 + 1 < ST7735S_BLEND_PIXELS) ? x1 - x0 + 1 : ST7735S_BLEND_PIXELS;
+    int rows = ST7735S_BLEND_PIXELS / w;
+
+    for (int y = y0; y <= y1; y += rows) {
+        int ye = (y + rows - 1 < y1) ? y + rows - 1 : y1;
+        for (int xs = x0; xs <= x1; xs += w) {
+            int xe = (xs + w - 1 < x1) ? xs + w - 1 : x1;
+            int n = xe - xs + 1;
+            if (read_region(xs, y, xe, ye, buf) == 0) {
+                return false;
+            }
+            uint16_t *p = buf;
+            for (int j = y; j <= ye; j++) {
+                int i0 = (j - yStart) * W_Image + (xs - xStart);
+                for (int i = i0; i < i0 + n; i++) {
+                    int a = (alpha != NULL) ? alpha[i] * opacity / 255 : opacity;
+                    int fg = image[i * 2] | (image[i * 2 + 1] << 8);
+
+                    // blend R, B and G in parallel, G moved to the upper half word
+                    a = (a + 4) >> 3;
+                    uint32_t f = (fg | (fg << 16)) & 0x07E0F81F;
+                    uint32_t b = (*p | (*p << 16)) & 0x07E0F81F;
+                    uint32_t c = ((((f - b) * a) >> 5) + b) & 0x07E0F81F;
+                    *p++ = (uint16_t)((c >> 16) | c);
+                }
+            }
+            region(xs, y, xe, ye);
+            p = buf;
+            for (int i = 0; i < n * (ye - y + 1); i++) {
+                wr_pixel(*p++);
+            }
+            wr_pixels_end();
+        }
+    }
+    return true;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_orientation(int orientation, bool mirror)
+{
+    orientation &= 3;
+    scroll_reset();
+    if (_fb != NULL) {
+        // the buffer has to match the panel before it is rearranged
+        flush();
+        async_wait();
+    }
+
+    // GRAM positions the new 0, 0 and its neighbours in x and y have to land on
+    int px[3], py[3];
+    for (int i = 0; i < 3; i++) {
+        int nx, ny;
+        to_native(orientation, mirror, (i == 1) ? 1 : 0, (i == 2) ? 1 : 0, nx, ny);
+        madctl_map(Panel::madctl, nx + Panel::x_offset, ny + Panel::y_offset, px[i], py[i]);
+    }
+
+    // the MADCTL whose address order walks the GRAM that way; ML and BGR are kept
+    for (int m = 0; m < 8; m++) {
+        uint8_t madctl = (Panel::madctl & ~(ST7735_MADCTL_MY | ST7735_MADCTL_MX | ST7735_MADCTL_MV)) | (m << 5);
+        int col, row, qx, qy, rx, ry;
+        madctl_unmap(madctl, px[0], py[0], col, row);
+        madctl_map(madctl, col + 1, row, qx, qy);
+        madctl_map(madctl, col, row + 1, rx, ry);
+        if ((qx == px[1]) && (qy == py[1]) && (rx == px[2]) && (ry == py[2])) {
+            _madctl = madctl;
+            _x_off = col;
+            _y_off = row;
+            break;
+        }
+    }
+
+    if (_fb != NULL) {
+        uint16_t *fb = new uint16_t[Panel::width * Panel::height];
+        int w = (orientation & 1) ? Panel::height : Panel::width;
+        for (int ny = 0; ny < Panel::height; ny++) {
+            for (int nx = 0; nx < Panel::width; nx++) {
+                int x0, y0, x1, y1;
+                from_native(_orientation, _mirror, nx, ny, x0, y0);
+                from_native(orientation, mirror, nx, ny, x1, y1);
+                fb[y1 * w + x1] = _fb[y0 * _width + x0];
+            }
+        }
+        delete[] _fb;
+        _fb = fb;
+        memset(_tile_known, 0, sizeof(_tile_known));
+    }
+
+    _orientation = orientation;
+    _mirror = mirror;
+    _width = (orientation & 1) ? Panel::height : Panel::width;
+    _height = (orientation & 1) ? Panel::width : Panel::height;
+    _tiles_x = (_width + ST7735S_TILE_SIZE - 1) / ST7735S_TILE_SIZE;
+    _tiles_y = (_height + ST7735S_TILE_SIZE - 1) / ST7735S_TILE_SIZE;
+    _last_x = -1;
+    _last_y = -1;
+
+    wr_cmd_args(ST7735_MADCTL, &_madctl, 1);
+    // the address windows are interpreted anew
+    _caset_ok = false;
+    _raset_ok = false;
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::orientation(void)
+{
+    return _orientation;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::scroll_area(int x0, int x1)
+{
+    // GRAM row of the first line; the rows run backwards when MADCTL mirrors the scroll axis
+    int vsa = x1 - x0 + 1;
+    int tfa = scroll_flipped() ? ST7735S_GRAM_ROWS - 1 - (x1 + scroll_offset()) : x0 + scroll_offset();
+    int bfa = ST7735S_GRAM_ROWS - tfa - vsa;
+    uint8_t scrlar[6] = { (uint8_t)(tfa >> 8), (uint8_t)tfa, (uint8_t)(vsa >> 8), (uint8_t)vsa, (uint8_t)(bfa >> 8), (uint8_t)bfa };
+
+    wr_cmd_args(ST7735_SCRLAR, scrlar, 6);
+
+    _scroll_x0 = x0;
+    _scroll_w = vsa;
+    _scroll_pos = 0;
+    scroll(0);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::scroll(int n)
+{
+    if (_scroll_w == 0) {
+        return;
+    }
+    _scroll_pos = ((_scroll_pos + n) % _scroll_w + _scroll_w) % _scroll_w;
+
+    int tfa = scroll_flipped() ? ST7735S_GRAM_ROWS - _scroll_x0 - _scroll_w - scroll_offset() : _scroll_x0 + scroll_offset();
+    int ssa = tfa + (scroll_flipped() ? (_scroll_w - _scroll_pos) % _scroll_w : _scroll_pos);
+    uint8_t vscsad[2] = { (uint8_t)(ssa >> 8), (uint8_t)ssa };
+
+    wr_cmd_args(ST7735_VSCSAD, vscsad, 2);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::scroll_image(const unsigned char *image, int stride, int n)
+{
+    if ((_scroll_w == 0) || (n <= 0) || (n > _scroll_w)) {
+        return;
+    }
+    scroll(n);
+
+    // the exposed lines are contiguous in the GRAM unless they wrap around the area
+    int k = 0;
+    while (k < n) {
+        int x = scroll_column(_scroll_x0 + _scroll_w - n + k);
+        int len = _scroll_x0 + _scroll_w - x;
+        if (len > n - k) {
+            len = n - k;
+        }
+        if (scroll_along_x()) {
+            region(x, 0, x + len - 1, _height - 1);
+            for (int y = 0; y < _height; y++) {
+                wr_image(image + (y * stride + k) * 2, len);
+            }
+        } else {
+            region(0, x, _width - 1, x + len - 1);
+            for (int y = 0; y < len; y++) {
+                wr_image(image + (k + y) * stride * 2, _width);
+            }
+        }
+        wr_pixels_end();
+        k += len;
+    }
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::scroll_column(int x)
+{
+    if ((_scroll_w == 0) || (x < _scroll_x0) || (x >= _scroll_x0 + _scroll_w)) {
+        return x;
+    }
+    return _scroll_x0 + (x - _scroll_x0 + _scroll_pos) % _scroll_w;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::scroll_reset(void)
+{
+    if (_scroll_w == 0) {
+        return;
+    }
+    // the whole GRAM as scroll area at start address 0
+    scroll_area(-scroll_offset(), ST7735S_GRAM_ROWS - 1 - scroll_offset());
+    _scroll_w = 0;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::pixel(int x, int y, int color)
+{
+    if ((x >= _width) || (y >= _height))
+        return;
+
+    if (_fb != NULL) {
+        if (_async_busy) {
+            async_wait();
+        }
+        if ((x >= 0) && (y >= 0)) {
+            _fb[y * _width + x] = fb_swap(color);
+            damage(x, y, x, y);
+        }
+        return;
+    }
+
+    if ((x < 0) || (y < 0)) {
+        return;
+    }
+
+    if (_rgb444) {
+        // a 12 bit pixel is only stored together with the next one or at the
+        // end of the write, so the address counter cannot be followed
+        int c = rgb444(color);
+        char dat[2] = { (char)(c >> 4), (char)(c << 4) };
+        window(x, y, x, y);
+        _rs = 1;
+        _cs = 0;
+        _spi.write(dat, 2, NULL, 0);
+        _cs = 1;
+        _ram_ok = false;
+        return;
+    }
+
+    char dat[2] = { (char)(color >> 8), (char)color };
+
+    if (!_ram_ok || (x != _ram_x) || (y != _ram_y)) {
+        // open a window from this pixel to the screen edge, so the address
+        // counter already points to the next pixel of a run: a column when
+        // the previous pixel was right above, a row otherwise
+        if ((x == _last_x) && (y == _last_y + 1)) {
+            window(x, y, x, _height - 1);
+            _ram_x0 = x;
+            _ram_x1 = x;
+            _ram_y0 = y;
+            _ram_y1 = _height - 1;
+        } else {
+            window(x, y, _width - 1, y);
+            _ram_x0 = x;
+            _ram_x1 = _width - 1;
+            _ram_y0 = y;
+            _ram_y1 = y;
+        }
+    }
+    _rs = 1;
+    _cs = 0;
+    _spi.write(dat, 2, NULL, 0);
+    _cs = 1;
+
+    // follow the address counter
+    _last_x = x;
+    _last_y = y;
+    _ram_ok = true;
+    _ram_x = x + 1;
+    _ram_y = y;
+    if (_ram_x > _ram_x1) {
+        _ram_x = _ram_x0;
+        if (++_ram_y > _ram_y1) {
+            _ram_y = _ram_y0;
+        }
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::window (unsigned int x, unsigned int y, unsigned int w, unsigned int h)
+{
+    addr_window(x, y, w, h);
+    wr_cmd(ST7735_RAMWR);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::addr_window (unsigned int x, unsigned int y, unsigned int w, unsigned int h)
+{
+    x += _x_off;
+    w += _x_off;
+    y += _y_off;
+    h += _y_off;
+
+    // the controller keeps CASET / RASET, only send what changed
+    if (!_caset_ok || (x != _caset_s) || (w != _caset_e)) {
+        uint8_t caset[4] = { (uint8_t)(x >> 8), (uint8_t)x, (uint8_t)(w >> 8), (uint8_t)w };     // XSTART, XEND
+        wr_cmd_args(ST7735_CASET, caset, 4);
+        _caset_s = x;
+        _caset_e = w;
+        _caset_ok = true;
+    }
+
+    if (!_raset_ok || (y != _raset_s) || (h != _raset_e)) {
+        uint8_t raset[4] = { (uint8_t)(y >> 8), (uint8_t)y, (uint8_t)(h >> 8), (uint8_t)h };     // YSTART, YEND
+        wr_cmd_args(ST7735_RASET, raset, 4);
+        _raset_s = y;
+        _raset_e = h;
+        _raset_ok = true;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::WindowMax (void)
+{
+    window(0, 0, _width - 1,  _height - 1);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::cls (void)
+{
+    region(0, 0, _width - 1, _height - 1);
+    wr_color(_background, _width * _height);
+    wr_pixels_end();
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::circle(int x0, int y0, int r, int color)
+{
+    int xx, yy;
+    int xs;
+    int di;
+
+    if (r == 0) {       /* no radius */
+        return;
+    }
+
+    /* Bresenham midpoint walk over the octant from 90 to 45 degree.
+     * Points that share yy form a horizontal span in the octants next to
+     * the vertical axis and a vertical span in the octants next to the
+     * horizontal axis, so each run is sent as one window. */
+    di = 3 - 2*r;
+    xx = 0;
+    yy = r;
+    xs = 0;
+    for (;;) {
+        bool last = (xx >= yy) || (r == 1);
+        int ny = yy;
+
+        if (!last) {
+            if (di < 0) {
+                di += 4*xx + 6;
+            } else {
+                di += 4*(xx - yy) + 10;
+                ny--;
+            }
+        }
+        if (last || (ny != yy)) {
+            /* run xs..xx on row / column yy is complete */
+            if (xs == 0) {
+                hline(x0 - xx, x0 + xx, y0 + yy, color);
+                hline(x0 - xx, x0 + xx, y0 - yy, color);
+                vline(x0 + yy, y0 - xx, y0 + xx, color);
+                vline(x0 - yy, y0 - xx, y0 + xx, color);
+            } else {
+                hline(x0 + xs, x0 + xx, y0 + yy, color);
+                hline(x0 - xx, x0 - xs, y0 + yy, color);
+                hline(x0 + xs, x0 + xx, y0 - yy, color);
+                hline(x0 - xx, x0 - xs, y0 - yy, color);
+                vline(x0 + yy, y0 + xs, y0 + xx, color);
+                vline(x0 + yy, y0 - xx, y0 - xs, color);
+                vline(x0 - yy, y0 + xs, y0 + xx, color);
+                vline(x0 - yy, y0 - xx, y0 - xs, color);
+            }
+            xs = xx + 1;
+        }
+        if (last) {
+            break;
+        }
+        xx++;
+        yy = ny;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::fillcircle(int x, int y, int r, int color)
+{
+    int xx = 0;
+    int yy = r;
+    int di = 3 - 2*r;
+
+    /* midpoint scanline fill: every row inside the circle is sent once as
+     * a single span, rows at distance xx while walking the octant and rows
+     * at distance yy when the walk leaves them */
+    while (xx <= yy) {
+        hline(x - yy, x + yy, y + xx, color);
+        if (xx != 0) {
+            hline(x - yy, x + yy, y - xx, color);
+        }
+        if (di < 0) {
+            di += 4*xx + 6;
+        } else {
+            if (yy > xx) {
+                hline(x - xx, x + xx, y + yy, color);
+                hline(x - xx, x + xx, y - yy, color);
+            }
+            di += 4*(xx - yy) + 10;
+            yy--;
+        }
+        xx++;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::hline(int x0, int x1, int y, int color)
+{
+    if ((y < 0) || (y >= _height)) {
+        return;
+    }
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (x1 >= _width) {
+        x1 = _width - 1;
+    }
+    if (x0 > x1) {
+        return;
+    }
+    int w = x1 - x0 + 1;
+    region(x0, y, x1, y);
+    wr_color(color, w);
+    wr_pixels_end();
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::vline(int x, int y0, int y1, int color)
+{
+    if ((x < 0) || (x >= _width)) {
+        return;
+    }
+    if (y0 < 0) {
+        y0 = 0;
+    }
+    if (y1 >= _height) {
+        y1 = _height - 1;
+    }
+    if (y0 > y1) {
+        return;
+    }
+    int h = y1 - y0 + 1;
+    region(x, y0, x, y1);
+    wr_color(color, h);
+    wr_pixels_end();
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::line(int x0, int y0, int x1, int y1, int color)
+{
+    int   dx = 0, dy = 0;
+    int   dx_sym = 0, dy_sym = 0;
+    int   dx_x2 = 0, dy_x2 = 0;
+    int   di = 0;
+
+    dx = x1-x0;
+    dy = y1-y0;
+
+    if (dx == 0) {        /* vertical line */
+        if (y1 > y0)
+            vline(x0,y0,y1,color);
+        else
+            vline(x0,y1,y0,color);
+        return;
+    }
+
+    if (dx > 0) {
+        dx_sym = 1;
+    } else {
+        dx_sym = -1;
+    }
+    if (dy == 0) {        /* horizontal line */
+        if (x1 > x0)
+            hline(x0,x1,y0,color);
+        else
+            hline(x1,x0,y0,color);
+        return;
+    }
+
+    if (dy > 0) {
+        dy_sym = 1;
+    } else {
+        dy_sym = -1;
+    }
+
+    dx = dx_sym*dx;
+    dy = dy_sym*dy;
+
+    dx_x2 = dx*2;
+    dy_x2 = dy*2;
+
+    if (dx >= dy) {
+        di = dy_x2 - dx;
+        while (x0 != x1) {
+            pixel(x0, y0, color);
+            x0 += dx_sym;
+            if (di<0) {
+                di += dy_x2;
+            } else {
+                di += dy_x2 - dx_x2;
+                y0 += dy_sym;
+            }
+        }
+        pixel(x0, y0, color);
+    } else {
+        di = dx_x2 - dy;
+        while (y0 != y1) {
+            pixel(x0, y0, color);
+            y0 += dy_sym;
+            if (di < 0) {
+                di += dx_x2;
+            } else {
+                di += dx_x2 - dy_x2;
+                x0 += dx_sym;
+            }
+        }
+        pixel(x0, y0, color);
+    }
+    return;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::rect(int x0, int y0, int x1, int y1, int color)
+{
+    if (x1 > x0)
+        hline(x0,x1,y0,color);
+    else 
+        hline(x1,x0,y0,color);
+
+    if (y1 > y0)
+        vline(x0,y0,y1,color);
+    else
+        vline(x0,y1,y0,color);
+
+    if (x1 > x0)
+        hline(x0,x1,y1,color);
+    else
+        hline(x1,x0,y1,color);
+
+    if (y1 > y0)
+        vline(x1,y0,y1,color);
+    else
+        vline(x1,y1,y0,color);
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::fillrect(int x0, int y0, int x1, int y1, int color)
+{
+    int h = y1 - y0 + 1;
+    int w = x1 - x0 + 1;
+    int fill_size = h * w;
+
+    region(x0, y0, x1, y1);
+    wr_color(color, fill_size);
+    wr_pixels_end();
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::locate(int x, int y)
+{
+    char_x = x;
+    char_y = y;
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::columns()
+{
+    return (_width / font_width());
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::rows()
+{
+    return (_height / font_height());
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::_putc(int value)
+{
+    if (value == '\n') {    // new line
+        char_x = 0;
+        char_y = char_y + font_height();
+        if (char_y >= _height - (unsigned int )font_height()) {
+            char_y = 0;
+        }
+    } else {
+        character(char_x, char_y, value);
+    }
+    return value;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::character(int x, int y, int c)
+{
+    unsigned int hor, vert, offset, bpl;
+    const unsigned char* ch;
+    unsigned char z;
+    int adv;
+
+    if ((c < 31) || (c > 127)) return;   // test char range
+
+    if (_atlas != NULL) {
+        character_atlas(c);
+        return;
+    }
+
+    // read font parameter from start of array
+    offset = _font[0];  // bytes / char
+    hor = _font[1];     // get hor size of font
+    vert = _font[2];    // get vert size of font
+    bpl = _font[3];     // bytes per line
+
+    ch = &_font[((c -32) * offset) + 4];   // start of char bitmap
+    adv = char_width(c);                        // x offset to next char
+
+    // TEXT_CELL keeps the full cell width when wrapping
+    if (char_x + ((_text_mode == TEXT_CELL) ? hor : adv) > (unsigned int)_width) {
+        char_x = 0;
+        char_y = char_y + vert;
+        if (char_y >= _height - (unsigned int)_font[2]) {
+            char_y = 0;
+        }
+    }
+
+    if (_text_mode == TEXT_TRANSPARENT) {
+        // one hline per run of set pixels
+        for (unsigned int j = 0; j < vert; j++) {            //  vert line
+            int run = -1;
+            for (unsigned int i = 0; i <= hor; i++) {        //  horz line
+                bool set = false;
+                if (i < hor) {
+                    z =  ch[bpl * i + ((j & 0xF8) >> 3) + 1];
+                    set = (z & (1 << (j & 0x07))) != 0;
+                }
+                if (set && (run < 0)) {
+                    run = i;
+                } else if (!set && (run >= 0)) {
+                    hline(char_x + run, char_x + i - 1, char_y + j, _foreground);
+                    run = -1;
+                }
+            }
+        }
+    } else {
+        unsigned int cols = (_text_mode == TEXT_CELL) ? hor : (unsigned int)adv;
+
+        region(char_x, char_y, char_x + cols - 1, char_y + vert - 1); // char box
+        for (unsigned int j = 0; j < vert; j++) {            //  vert line
+            for (unsigned int i = 0; i < cols; i++) {        //  horz line
+                z =  ch[bpl * i + ((j & 0xF8) >> 3) + 1];
+                if (( z & (1 << (j & 0x07)) ) == 0x00) {
+                    wr_pixel(_background);
+                } else {
+                    wr_pixel(_foreground);
+                }
+            }
+        }
+        wr_pixels_end();
+    }
+
+    char_x += adv;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::character_atlas(int c)
+{
+    const GlyphAtlas *a = _atlas;
+    int hor = a->width;
+    int vert = a->height;
+
+    if ((c < a->first) || (c >= a->first + a->count)) return;
+
+    const AtlasGlyph *g = &a->glyphs[c - a->first];
+    const uint8_t *bits = &a->bitmap[g->offset];
+    int stride = (g->w + 7) >> 3;
+    int adv = char_width(c);
+
+    if (char_x + ((_text_mode == TEXT_CELL) ? hor : adv) > (unsigned int)_width) {
+        char_x = 0;
+        char_y = char_y + vert;
+        if (char_y >= _height - (unsigned int)vert) {
+            char_y = 0;
+        }
+    }
+
+    if (_text_mode == TEXT_TRANSPARENT) {
+        // one hline per run of set pixels
+        int x0 = char_x + g->x;
+        int y = char_y + g->y;
+        for (int j = 0; j < g->h; j++) {
+            int run = -1;
+            for (int i = 0; i <= g->w; i++) {
+                bool set = (i < g->w) && (bits[i >> 3] & (0x80 >> (i & 0x07)));
+                if (set && (run < 0)) {
+                    run = i;
+                } else if (!set && (run >= 0)) {
+                    hline(x0 + run, x0 + i - 1, y + j, _foreground);
+                    run = -1;
+                }
+            }
+            bits += stride;
+        }
+        char_x += adv;
+        return;
+    }
+
+    int cols = (_text_mode == TEXT_CELL) ? hor : adv;
+    int ink = (g->x < cols) ? g->w : 0;     // ink columns inside the painted part
+    if (g->x + ink > cols) {
+        ink = cols - g->x;
+    }
+
+    region(char_x, char_y, char_x + cols - 1, char_y + vert - 1); // char box
+    if ((g->h == 0) || (ink == 0)) {
+        wr_color(_background, cols * vert);
+    } else {
+        // background above and left of the ink, the ink rows, background below
+        wr_color(_background, g->y * cols + g->x);
+        for (int j = 0; j < g->h; j++) {
+            if (j > 0) {
+                wr_color(_background, cols - ink);
+            }
+            wr_bits(bits, ink);
+            bits += stride;
+        }
+        wr_color(_background, (cols - g->x - ink) + (vert - g->y - g->h) * cols);
+    }
+    wr_pixels_end();
+
+    char_x += adv;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_text_mode(TextMode mode)
+{
+    _text_mode = mode;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_char_gap(int gap)
+{
+    _char_gap = gap;
+    _digit_adv = -1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_fixed_digits(bool enable)
+{
+    _fixed_digits = enable;
+}
+
+template <class Panel>
+typename ST7735SDisplay<Panel>::TextMode ST7735SDisplay<Panel>::text_mode(void)
+{
+    return _text_mode;
+}
+
+template <class Panel>
+bool ST7735SDisplay<Panel>::fixed_digits(void)
+{
+    return _fixed_digits;
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::foreground_color(void)
+{
+    return _foreground;
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::background_color(void)
+{
+    return _background;
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::glyph_width(int c)
+{
+    if (_atlas != NULL) {
+        if ((c < _atlas->first) || (c >= _atlas->first + _atlas->count)) {
+            return 0;
+        }
+        return _atlas->glyphs[c - _atlas->first].advance;
+    }
+    if ((c < 32) || (c > 127)) {
+        return 0;
+    }
+    return _font[((c - 32) * _font[0]) + 4];
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::char_width(int c)
+{
+    if (_fixed_digits && (c >= '0') && (c <= '9')) {
+        if (_digit_adv < 0) {
+            for (int d = '0'; d <= '9'; d++) {
+                int adv = char_advance(glyph_width(d), font_width());
+                if (adv > _digit_adv) {
+                    _digit_adv = adv;
+                }
+            }
+        }
+        return _digit_adv;
+    }
+    return char_advance(glyph_width(c), font_width());
+}
+
+template <class Panel>
+int ST7735SDisplay<Panel>::char_height(void)
+{
+    return font_height();
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_font(const unsigned char* f)
+{
+    _font = f;
+    _atlas = NULL;
+    _digit_adv = -1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_font(const GlyphAtlas *atlas)
+{
+    _atlas = atlas;
+    _digit_adv = -1;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_font(const Asset &asset)
+{
+    if (asset.format == ASSET_GLCD_FONT) {
+        set_font((const unsigned char *)asset.data);
+    } else if (asset.format == ASSET_ATLAS_FONT) {
+        set_font((const GlyphAtlas *)asset.data);
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::Paint_DrawImage(const unsigned char *image, uint16_t xStart, uint16_t yStart, uint16_t W_Image, uint16_t H_Image)
+{
+    region(xStart, yStart, xStart + W_Image - 1, yStart + H_Image - 1);
+    wr_image(image, W_Image * H_Image);
+    wr_pixels_end();
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::Paint_DrawImage(const Asset &asset, int xStart, int yStart)
+{
+    const unsigned char *data = (const unsigned char *)asset.data;
+
+    switch (asset.format) {
+        case ASSET_RGB565: {
+            int x0 = (xStart < 0) ? 0 : xStart;
+            int y0 = (yStart < 0) ? 0 : yStart;
+            int x1 = (xStart + asset.width > _width) ? _width - 1 : xStart + asset.width - 1;
+            int y1 = (yStart + asset.height > _height) ? _height - 1 : yStart + asset.height - 1;
+            if ((x0 > x1) || (y0 > y1)) {
+                break;
+            }
+            region(x0, y0, x1, y1);
+            if ((x1 - x0 + 1) * 2 == asset.stride) {
+                // whole rows, one run
+                wr_image(data + (y0 - yStart) * asset.stride, (x1 - x0 + 1) * (y1 - y0 + 1));
+            } else {
+                for (int y = y0; y <= y1; y++) {
+                    wr_image(data + (y - yStart) * asset.stride + (x0 - xStart) * 2, x1 - x0 + 1);
+                }
+            }
+            wr_pixels_end();
+            break;
+        }
+        case ASSET_Q565:
+            draw_image_q565(data, xStart, yStart);
+            break;
+        case ASSET_MONO:
+            bitmap(xStart, yStart, asset.width, asset.height, data, asset.stride, _foreground, _background);
+            break;
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::draw_image_q565(const unsigned char *image, int xStart, int yStart)
+{
+    Q565Decoder dec(image);
+    uint16_t line[ST7735S_DECODE_PIXELS];
+    int w = dec.width();
+    int x0 = (xStart < 0) ? 0 : xStart;
+    int y0 = (yStart < 0) ? 0 : yStart;
+    int x1 = (xStart + w > _width) ? _width - 1 : xStart + w - 1;
+    int y1 = (yStart + dec.height() > _height) ? _height - 1 : yStart + dec.height() - 1;
+
+    if ((x0 > x1) || (y0 > y1)) {
+        return;
+    }
+    region(x0, y0, x1, y1);
+    // rows above the screen are decoded and dropped, rows below never decoded
+    for (int y = yStart; y <= y1; y++) {
+        for (int x = xStart; x < xStart + w;) {
+            int n = dec.decode(line, (xStart + w - x < ST7735S_DECODE_PIXELS) ? xStart + w - x : ST7735S_DECODE_PIXELS);
+            if (y >= y0) {
+                int i0 = (x < x0) ? x0 - x : 0;
+                int i1 = (x + n - 1 > x1) ? x1 - x : n - 1;
+                for (int i = i0; i <= i1; i++) {
+                    wr_pixel(line[i]);
+                }
+            }
+            x += n;
+        }
+    }
+    wr_pixels_end();
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::draw_image_async(const unsigned char *image, uint16_t xStart, uint16_t yStart, uint16_t W_Image, uint16_t H_Image, Callback<void()> done)
+{
+#if DEVICE_SPI_ASYNCH
+    if (_fb != NULL) {
+        Paint_DrawImage(image, xStart, yStart, W_Image, H_Image);
+        if (done) {
+            done();
+        }
+        return;
+    }
+
+    window(xStart, yStart, xStart + W_Image - 1, yStart + H_Image - 1);
+    _async_src = image;
+    _async_be = false;
+    _async_left = W_Image * H_Image * 2;
+    _async_done = done;
+    async_fill(0);
+    async_fill(1);
+    _async_cur = 0;
+
+    _async_flags.clear(ASYNC_DONE_FLAG);
+    _async_busy = true;
+    _rs = 1;
+    _cs = 0;
+    _spi.transfer(_async_buf[0], _async_len[0], (char *)NULL, 0, callback(this, &ST7735SDisplay::async_event), SPI_EVENT_COMPLETE);
+#else
+    Paint_DrawImage(image, xStart, yStart, W_Image, H_Image);
+    if (done) {
+        done();
+    }
+#endif
+}
+
+template <class Panel>
+bool ST7735SDisplay<Panel>::async_busy(void)
+{
+    return _async_busy;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::async_wait(void)
+{
+    if (_async_busy) {
+        _async_flags.wait_any(ASYNC_DONE_FLAG, osWaitForever, false);
+    }
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::async_fill(int i)
+{
+    if (_rgb444) {
+        // 4 source bytes become 3, an odd last pixel is sent as 2 bytes
+        int n = (_async_left < ST7735S_ASYNC_CHUNK / 3 * 4) ? _async_left : ST7735S_ASYNC_CHUNK / 3 * 4;
+        int hi = _async_be ? 0 : 1;
+        const unsigned char *src = _async_src;
+        char *buf = _async_buf[i];
+        int len = 0;
+
+        for (int k = 0; k < n; k += 4) {
+            int a = rgb444((src[k + hi] << 8) | src[k + 1 - hi]);
+            if (k + 2 < n) {
+                int b = rgb444((src[k + 2 + hi] << 8) | src[k + 3 - hi]);
+                buf[len++] = a >> 4;
+                buf[len++] = (a << 4) | (b >> 8);
+                buf[len++] = b;
+            } else {
+                buf[len++] = a >> 4;
+                buf[len++] = a << 4;
+            }
+        }
+        _async_src += n;
+        _async_left -= n;
+        _async_len[i] = len;
+        return;
+    }
+
+    int n = (_async_left < ST7735S_ASYNC_CHUNK) ? _async_left : ST7735S_ASYNC_CHUNK;
+    char *buf = _async_buf[i];
+
+    for (int k = 0; k < n; k += 2) {
+        buf[k] = _async_src[k + 1];
+        buf[k + 1] = _async_src[k];
+    }
+    _async_src += n;
+    _async_left -= n;
+    _async_len[i] = n;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::async_event(int event)
+{
+#if DEVICE_SPI_ASYNCH
+    int sent = _async_cur;
+    int next = sent ^ 1;
+
+    if ((event & SPI_EVENT_COMPLETE) && (_async_len[next] > 0)) {
+        // keep the bus busy with the prepared chunk, then refill the sent one
+        _async_cur = next;
+        _spi.transfer(_async_buf[next], _async_len[next], (char *)NULL, 0, callback(this, &ST7735SDisplay::async_event), SPI_EVENT_COMPLETE);
+        async_fill(sent);
+        return;
+    }
+
+    _cs = 1;
+    if (_async_done) {
+        _async_done();
+    }
+    _async_busy = false;
+    _async_flags.set(ASYNC_DONE_FLAG);
+#endif
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::flush(void)
+{
+    if (_fb == NULL) {
+        return;
+    }
+    if (_flush_mode == FLUSH_TILES) {
+        flush_tiles();
+        return;
+    }
+
+    // overlapping rectangles may cost more than a single full screen window
+    int cost = 0;
+    for (int i = 0; i < _dirty_n; i++) {
+        cost += rect_area(_dirty[i]) * 2 + _window_cost;
+    }
+    if (cost > _width * _height * 2 + _window_cost) {
+        DirtyRect all = { 0, 0, (int16_t)(_width - 1), (int16_t)(_height - 1) };
+        _dirty[0] = all;
+        _dirty_n = 1;
+    }
+
+    int sent = 0;
+    for (int i = 0; i < _dirty_n; i++) {
+        const DirtyRect &r = _dirty[i];
+        flush_rect(r.x0, r.y0, r.x1, r.y1);
+        sent += rect_area(r);
+    }
+
+    _flush_stats.flushes++;
+    _flush_stats.windows += _dirty_n;
+    _flush_stats.pixels_sent += sent;
+    _flush_stats.pixels_skipped += _width * _height - sent;
+    _dirty_n = 0;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::flush_async(Callback<void()> done)
+{
+#if DEVICE_SPI_ASYNCH
+    if (_fb == NULL) {
+        if (done) {
+            done();
+        }
+        return;
+    }
+
+    WindowMax();
+    _flush_stats.flushes++;
+    _flush_stats.windows++;
+    _flush_stats.pixels_sent += _width * _height;
+    _dirty_n = 0;
+    memset(_tile_known, 0, sizeof(_tile_known));
+    _async_done = done;
+    _async_cur = 0;
+
+    if (_rgb444) {
+        // the framebuffer is packed chunk by chunk like an image
+        _async_src = (const unsigned char *)_fb;
+        _async_be = true;
+        _async_left = _width * _height * 2;
+        async_fill(0);
+        async_fill(1);
+        _async_flags.clear(ASYNC_DONE_FLAG);
+        _async_busy = true;
+        _rs = 1;
+        _cs = 0;
+        _spi.transfer(_async_buf[0], _async_len[0], (char *)NULL, 0, callback(this, &ST7735SDisplay::async_event), SPI_EVENT_COMPLETE);
+        return;
+    }
+
+    _async_len[1] = 0;
+    _async_left = 0;
+
+    _async_flags.clear(ASYNC_DONE_FLAG);
+    _async_busy = true;
+    _rs = 1;
+    _cs = 0;
+    _spi.transfer((const char *)_fb, _width * _height * 2, (char *)NULL, 0, callback(this, &ST7735SDisplay::async_event), SPI_EVENT_COMPLETE);
+#else
+    flush();
+    if (done) {
+        done();
+    }
+#endif
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::set_color_mode(ColorMode mode)
+{
+    _rgb444 = (mode == COLOR_RGB444);
+    wr_cmd(ST7735_COLMOD);
+    wr_dat(_rgb444 ? 0x03 : 0x05);
+}
+
+template <class Panel>
+typename ST7735SDisplay<Panel>::ColorMode ST7735SDisplay<Panel>::color_mode(void)
+{
+    return _rgb444 ? COLOR_RGB444 : COLOR_RGB565;
+}
+
+template <class Panel>
+uint16_t *ST7735SDisplay<Panel>::framebuffer(void)
+{
+    return _fb;
+}
+
+template <class Panel>
+void ST7735SDisplay<Panel>::disp(int enable)
+{
+    if (enable) {
+        wr_cmd(ST7735_DISPON);
+    }
+    else {
+        wr_cmd(ST7735_DISPOFF);
+    }
+}
+
+#endif
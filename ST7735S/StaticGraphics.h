@@ -0,0 +1,368 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Static dispatch variant of the GraphicsDisplay drawing functions.
+ *
+ * StaticGraphics<Driver> is a CRTP base: the drawing loops call pixel(),
+ * width(), height() and the span functions of the concrete driver without
+ * virtual calls, so they inline into the loops and the dimensions of a
+ * driver with compile-time size fold to constants. A driver derives from
+ * StaticGraphics<Driver> and provides
+ *
+ *   int width(), int height()
+ *   void pixel(int x, int y, int colour)
+ *
+ * and optionally begin_region / push_pixels / push_repeat / end_region,
+ * which otherwise fall back to pixel() like in GraphicsDisplay.
+ *
+ * The inlining needs the driver functions in a header, like StaticCanvas.
+ * The ST7735S driver is not one: its pixel and span functions are compiled
+ * in ST7735S.cpp and clip through the virtual pixel(), so a static front
+ * end would only skip the vtable on the way in. Only the functions above
+ * are provided, no circles or text, so this is no drop-in for
+ * GraphicsDisplay; GraphicsAdapter<Driver> puts a static driver behind the
+ * virtual interface for those (text output, code written against
+ * GraphicsDisplay).
+ */
+
+#ifndef MBED_STATICGRAPHICS_H
+#define MBED_STATICGRAPHICS_H
+
+#include <stdint.h>
+#include <string.h>
+#include "GraphicsDisplay.h"
+
+template <class Driver>
+class StaticGraphics {
+public:
+
+    /** Start a region for push_pixels() / push_repeat(), default through pixel()
+    *
+    */
+    void begin_region(int x, int y, int w, int h)
+    {
+        _x = _x1 = x;
+        _y = y;
+        _x2 = x + w - 1;
+    }
+
+    void push_pixels(const uint16_t *colour, int n)
+    {
+        for (int i = 0; i < n; i++) {
+            put(colour[i]);
+        }
+    }
+
+    void push_repeat(int colour, int n)
+    {
+        for (int i = 0; i < n; i++) {
+            put(colour);
+        }
+    }
+
+    void end_region()
+    {
+    }
+
+    /** Fill a w x h region with a color
+    *
+    */
+    void fill(int x, int y, int w, int h, int colour)
+    {
+        driver().begin_region(x, y, w, h);
+        driver().push_repeat(colour, w * h);
+        driver().end_region();
+    }
+
+    /** Fill the screen with a color
+    *
+    */
+    void cls(int colour)
+    {
+        fill(0, 0, driver().width(), driver().height(), colour);
+    }
+
+    /** Draw a w x h region of 16 bit colors, row by row
+    *
+    */
+    void blit(int x, int y, int w, int h, const uint16_t *colour)
+    {
+        driver().begin_region(x, y, w, h);
+        driver().push_pixels(colour, w * h);
+        driver().end_region();
+    }
+
+    /** Draw a 1 bit bitmap, bits continue from row to row like in
+    *   GraphicsDisplay::blitbit
+    *
+    * @param fg,bg colors of set / cleared bits
+    */
+    void blitbit(int x, int y, int w, int h, const char *bits, int fg, int bg)
+    {
+        int n = w * h;
+        int run = 0;
+        bool set = false;
+        driver().begin_region(x, y, w, h);
+        for (int i = 0; i < n; i++) {
+            bool bit = (bits[i >> 3] << (i & 0x7)) & 0x80;
+            if ((run > 0) && (bit != set)) {
+                driver().push_repeat(set ? fg : bg, run);
+                run = 0;
+            }
+            set = bit;
+            run++;
+        }
+        if (run > 0) {
+            driver().push_repeat(set ? fg : bg, run);
+        }
+        driver().end_region();
+    }
+
+    /** Draw a line, horizontal and vertical lines as a region
+    *
+    */
+    void line(int x0, int y0, int x1, int y1, int colour)
+    {
+        if (y0 == y1) {
+            if (x0 > x1) {
+                int t = x0;
+                x0 = x1;
+                x1 = t;
+            }
+            fill(x0, y0, x1 - x0 + 1, 1, colour);
+            return;
+        }
+        if (x0 == x1) {
+            if (y0 > y1) {
+                int t = y0;
+                y0 = y1;
+                y1 = t;
+            }
+            fill(x0, y0, 1, y1 - y0 + 1, colour);
+            return;
+        }
+        // Bresenham
+        int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+        int dy = (y1 > y0) ? y0 - y1 : y1 - y0;
+        int sx = (x0 < x1) ? 1 : -1;
+        int sy = (y0 < y1) ? 1 : -1;
+        int err = dx + dy;
+        while (true) {
+            driver().pixel(x0, y0, colour);
+            if ((x0 == x1) && (y0 == y1)) {
+                break;
+            }
+            int e2 = 2 * err;
+            if (e2 >= dy) {
+                err += dy;
+                x0 += sx;
+            }
+            if (e2 <= dx) {
+                err += dx;
+                y0 += sy;
+            }
+        }
+    }
+
+    /** Draw the outline of a rectangle
+    *
+    */
+    void rect(int x0, int y0, int x1, int y1, int colour)
+    {
+        line(x0, y0, x1, y0, colour);
+        line(x0, y1, x1, y1, colour);
+        line(x0, y0, x0, y1, colour);
+        line(x1, y0, x1, y1, colour);
+    }
+
+    /** Fill a rectangle given by two corners, clipped to the screen
+    *
+    */
+    void fillrect(int x0, int y0, int x1, int y1, int colour)
+    {
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+        if (x1 >= driver().width()) x1 = driver().width() - 1;
+        if (y1 >= driver().height()) y1 = driver().height() - 1;
+        if ((x0 <= x1) && (y0 <= y1)) {
+            fill(x0, y0, x1 - x0 + 1, y1 - y0 + 1, colour);
+        }
+    }
+
+protected:
+    Driver &driver()
+    {
+        return static_cast<Driver &>(*this);
+    }
+
+    /** pixel at the cursor of the default region, row by row */
+    void put(int colour)
+    {
+        driver().pixel(_x, _y, colour);
+        if (++_x > _x2) {
+            _x = _x1;
+            _y++;
+        }
+    }
+
+    int _x, _y, _x1, _x2;
+};
+
+/** Off-screen W x H RGB565 canvas with compile-time size
+ *
+ * Useful to compose sprites before sending them with Paint_DrawImage or
+ * blit, and as the reference target of the dispatch benchmark.
+ */
+template <int W, int H>
+class StaticCanvas : public StaticGraphics<StaticCanvas<W, H> > {
+public:
+    StaticCanvas() : _p(_buf), _col(0), _w(0), _clip(false)
+    {
+        memset(_buf, 0, sizeof(_buf));
+    }
+
+    static int width()
+    {
+        return W;
+    }
+
+    static int height()
+    {
+        return H;
+    }
+
+    void pixel(int x, int y, int colour)
+    {
+        if (((unsigned)x < (unsigned)W) && ((unsigned)y < (unsigned)H)) {
+            _buf[y * W + x] = colour;
+        }
+    }
+
+    /** regions not completely on the canvas are clipped through pixel() */
+    void begin_region(int x, int y, int w, int h)
+    {
+        _clip = (x < 0) || (y < 0) || (x + w > W) || (y + h > H);
+        if (_clip) {
+            StaticGraphics<StaticCanvas>::begin_region(x, y, w, h);
+            return;
+        }
+        _p = &_buf[y * W + x];
+        _col = 0;
+        _w = w;
+    }
+
+    void push_pixels(const uint16_t *colour, int n)
+    {
+        if (_clip) {
+            StaticGraphics<StaticCanvas>::push_pixels(colour, n);
+            return;
+        }
+        while (n > 0) {
+            int m = row(n);
+            for (int i = 0; i < m; i++) {
+                _p[_col + i] = colour[i];
+            }
+            colour += m;
+            n -= m;
+            advance(m);
+        }
+    }
+
+    void push_repeat(int colour, int n)
+    {
+        if (_clip) {
+            StaticGraphics<StaticCanvas>::push_repeat(colour, n);
+            return;
+        }
+        while (n > 0) {
+            int m = row(n);
+            for (int i = 0; i < m; i++) {
+                _p[_col + i] = colour;
+            }
+            n -= m;
+            advance(m);
+        }
+    }
+
+    uint16_t *buffer()
+    {
+        return _buf;
+    }
+
+private:
+    /** pixels of n left in the current row of the region */
+    int row(int n)
+    {
+        return (n < _w - _col) ? n : _w - _col;
+    }
+
+    void advance(int m)
+    {
+        _col += m;
+        if (_col == _w) {
+            _col = 0;
+            _p += W;
+        }
+    }
+
+    uint16_t _buf[W * H];
+    uint16_t *_p;
+    int _col;
+    int _w;
+    bool _clip;
+};
+
+/** GraphicsDisplay on top of a static driver
+ *
+ * The virtual functions forward to the driver, so everything written
+ * against GraphicsDisplay / TextDisplay (printf, character, cls) works
+ * with it.
+ */
+template <class Driver>
+class GraphicsAdapter : public GraphicsDisplay {
+public:
+    GraphicsAdapter(Driver &driver, const char *name = NULL) : GraphicsDisplay(name), _driver(driver)
+    {
+    }
+
+    virtual void pixel(int x, int y, int colour)
+    {
+        _driver.pixel(x, y, colour);
+    }
+
+    virtual int width()
+    {
+        return _driver.width();
+    }
+
+    virtual int height()
+    {
+        return _driver.height();
+    }
+
+    virtual void begin_region(int x, int y, int w, int h)
+    {
+        _driver.begin_region(x, y, w, h);
+    }
+
+    virtual void push_pixels(const uint16_t *colour, int n)
+    {
+        _driver.push_pixels(colour, n);
+    }
+
+    virtual void push_repeat(int colour, int n)
+    {
+        _driver.push_repeat(colour, n);
+    }
+
+    virtual void end_region()
+    {
+        _driver.end_region();
+    }
+
+private:
+    Driver &_driver;
+};
+
+#endif
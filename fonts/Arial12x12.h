@@ -3,6 +3,9 @@
 //GLCD FontName : Arial12x12
 //GLCD FontSize : 12 x 12
 
+#ifndef ARIAL12X12_H
+#define ARIAL12X12_H
+
 /** Arial Font with 12*12 matrix to use with SPI_TFT lib
  */ 
 const unsigned char Arial12x12[] = {
@@ -104,3 +107,5 @@ const unsigned char Arial12x12[] = {
         0x07, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Code for char ~
         0x08, 0x00, 0x00, 0xFE, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // Code for char 
         };
+
+#endif
@@ -0,0 +1,165 @@
+//Glyph atlas of Arial12x12.h generated by host/fontconv, do not edit
+//Cell 12 x 12, 96 characters from 0x20, 804 bitmap bytes
+
+#ifndef ARIAL12X12_ATLAS_H
+#define ARIAL12X12_ATLAS_H
+
+#include "GlyphAtlas.h"
+
+const uint8_t Arial12x12_atlas_bitmap[] = {
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0xA0, 0xA0, 0xA0, 0x14, 0x14, 0xFE, 0x28,
+        0x28, 0xFE, 0x28, 0x50, 0x50, 0x70, 0xA8, 0xA0, 0xA0, 0x70, 0x28, 0xA8, 0xA8, 0x70, 0x20, 0x62,
+        0x00, 0x94, 0x00, 0x94, 0x00, 0x98, 0x00, 0x6B, 0x00, 0x0C, 0x80, 0x14, 0x80, 0x14, 0x80, 0x23,
+        0x00, 0x30, 0x48, 0x48, 0x50, 0x60, 0x94, 0x88, 0x8C, 0x72, 0x80, 0x80, 0x80, 0x20, 0x40, 0x40,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x40, 0x40, 0x80, 0x20, 0xF8, 0x20, 0x50, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x80, 0x80, 0x80, 0xE0,
+        0x80, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88,
+        0x88, 0x88, 0x70, 0x20, 0x60, 0xA0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x88, 0x08, 0x08,
+        0x10, 0x10, 0x20, 0x40, 0xF8, 0x70, 0x88, 0x08, 0x08, 0x30, 0x08, 0x08, 0x88, 0x70, 0x10, 0x30,
+        0x30, 0x50, 0x50, 0x90, 0xF8, 0x10, 0x10, 0x78, 0x40, 0x80, 0xF0, 0x88, 0x08, 0x08, 0x88, 0x70,
+        0x70, 0x88, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x70, 0xF8, 0x10, 0x10, 0x20, 0x20, 0x20, 0x40,
+        0x40, 0x40, 0x70, 0x88, 0x88, 0x88, 0x70, 0x88, 0x88, 0x88, 0x70, 0x70, 0x88, 0x88, 0x88, 0x98,
+        0x68, 0x08, 0x88, 0x70, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80,
+        0x18, 0x60, 0x80, 0x60, 0x18, 0xFC, 0x00, 0x00, 0xFC, 0xC0, 0x30, 0x08, 0x30, 0xC0, 0x70, 0x88,
+        0x88, 0x08, 0x10, 0x20, 0x20, 0x00, 0x20, 0x0F, 0x00, 0x30, 0xC0, 0x40, 0x40, 0x4D, 0x20, 0x93,
+        0x20, 0xA2, 0x20, 0xA2, 0x20, 0xA2, 0x40, 0x9F, 0x80, 0x40, 0x20, 0x20, 0xC0, 0x1F, 0x00, 0x10,
+        0x28, 0x28, 0x28, 0x44, 0x7C, 0x44, 0x82, 0x82, 0xF8, 0x84, 0x84, 0x84, 0xFC, 0x84, 0x84, 0x84,
+        0xF8, 0x38, 0x44, 0x82, 0x80, 0x80, 0x80, 0x82, 0x44, 0x38, 0xF8, 0x84, 0x82, 0x82, 0x82, 0x82,
+        0x82, 0x84, 0xF8, 0xFC, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x80, 0xFC, 0xF8, 0x80, 0x80, 0x80,
+        0xF0, 0x80, 0x80, 0x80, 0x80, 0x38, 0x44, 0x82, 0x80, 0x8E, 0x82, 0x82, 0x44, 0x38, 0x82, 0x82,
+        0x82, 0x82, 0xFE, 0x82, 0x82, 0x82, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x88, 0x70, 0x82, 0x84, 0x88, 0x90, 0xA0, 0xD0, 0x88,
+        0x84, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x82, 0xC6, 0xC6, 0xAA, 0xAA,
+        0xAA, 0xAA, 0x92, 0x92, 0x82, 0xC2, 0xA2, 0xA2, 0x92, 0x8A, 0x8A, 0x86, 0x82, 0x38, 0x44, 0x82,
+        0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0xF8, 0x84, 0x84, 0x84, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x38,
+        0x44, 0x82, 0x82, 0x82, 0x82, 0x9A, 0x44, 0x3A, 0xFC, 0x82, 0x82, 0x82, 0xFC, 0x88, 0x84, 0x84,
+        0x82, 0x78, 0x84, 0x84, 0x80, 0x78, 0x04, 0x84, 0x84, 0x78, 0xFE, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x10, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x82, 0x82, 0x44, 0x44,
+        0x44, 0x28, 0x28, 0x10, 0x10, 0x84, 0x20, 0x8A, 0x20, 0x8A, 0x40, 0x4A, 0x40, 0x51, 0x40, 0x51,
+        0x40, 0x51, 0x40, 0x20, 0x80, 0x20, 0x80, 0x82, 0x44, 0x44, 0x28, 0x10, 0x28, 0x44, 0x44, 0x82,
+        0x82, 0x44, 0x44, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7E, 0x04, 0x08, 0x08, 0x10, 0x20, 0x20,
+        0x40, 0xFE, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x80, 0x80, 0x40,
+        0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0xC0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+        0xC0, 0x20, 0x50, 0x50, 0x88, 0x88, 0xFE, 0x80, 0x40, 0x70, 0x88, 0x08, 0x78, 0x88, 0x98, 0x68,
+        0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0xC8, 0xB0, 0x60, 0x90, 0x80, 0x80, 0x80, 0x90, 0x60,
+        0x08, 0x08, 0x68, 0x98, 0x88, 0x88, 0x88, 0x88, 0x78, 0x70, 0x88, 0x88, 0xF8, 0x80, 0x88, 0x70,
+        0x30, 0x40, 0xE0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x68, 0x98, 0x88, 0x88, 0x88, 0x98, 0x68,
+        0x08, 0xF0, 0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x40, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,
+        0x80, 0x88, 0x90, 0xA0, 0xE0, 0x90, 0x90, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0xB3, 0x00, 0xCC, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0xB0,
+        0xC8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0xB0, 0xC8, 0x88,
+        0x88, 0x88, 0xC8, 0xB0, 0x80, 0x80, 0x68, 0x98, 0x88, 0x88, 0x88, 0x98, 0x68, 0x08, 0x08, 0xA0,
+        0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70, 0x40, 0x40, 0xE0,
+        0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x50,
+        0x50, 0x50, 0x20, 0x20, 0x88, 0x80, 0x88, 0x80, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x22, 0x00,
+        0x22, 0x00, 0x88, 0x50, 0x50, 0x20, 0x50, 0x50, 0x88, 0x88, 0x88, 0x50, 0x50, 0x50, 0x20, 0x20,
+        0x20, 0x40, 0xF8, 0x10, 0x10, 0x20, 0x40, 0x40, 0xF8, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40,
+        0x40, 0x40, 0x40, 0x20, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x40, 0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x64, 0x98, 0xFE, 0x82, 0x82, 0x82,
+        0x82, 0x82, 0x82, 0xFE,
+};
+
+const AtlasGlyph Arial12x12_atlas_glyphs[] = {
+        {     0,  7,  0,  0,  0,  0 },  // Code for char 0x20
+        {     0,  2,  1,  0,  1,  9 },  // Code for char !
+        {     9,  3,  0,  0,  3,  3 },  // Code for char "
+        {    12,  7,  0,  0,  7,  9 },  // Code for char #
+        {    21,  6,  1,  0,  5, 10 },  // Code for char $
+        {    31, 10,  1,  0,  9,  9 },  // Code for char %
+        {    49,  8,  1,  0,  7,  9 },  // Code for char &
+        {    58,  2,  1,  0,  1,  3 },  // Code for char '
+        {    61,  4,  1,  0,  3, 11 },  // Code for char (
+        {    72,  3,  0,  0,  3, 11 },  // Code for char )
+        {    83,  5,  0,  0,  5,  4 },  // Code for char *
+        {    87,  6,  1,  2,  5,  5 },  // Code for char +
+        {    92,  2,  1,  8,  1,  3 },  // Code for char ,
+        {    95,  3,  0,  5,  3,  1 },  // Code for char -
+        {    96,  2,  1,  8,  1,  1 },  // Code for char .
+        {    97,  3,  0,  0,  3,  9 },  // Code for char /
+        {   106,  6,  1,  0,  5,  9 },  // Code for char 0
+        {   115,  6,  1,  0,  3,  9 },  // Code for char 1
+        {   124,  6,  1,  0,  5,  9 },  // Code for char 2
+        {   133,  6,  1,  0,  5,  9 },  // Code for char 3
+        {   142,  6,  1,  0,  5,  9 },  // Code for char 4
+        {   151,  6,  1,  0,  5,  9 },  // Code for char 5
+        {   160,  6,  1,  0,  5,  9 },  // Code for char 6
+        {   169,  6,  1,  0,  5,  9 },  // Code for char 7
+        {   178,  6,  1,  0,  5,  9 },  // Code for char 8
+        {   187,  6,  1,  0,  5,  9 },  // Code for char 9
+        {   196,  2,  1,  2,  1,  7 },  // Code for char :
+        {   203,  2,  1,  6,  1,  5 },  // Code for char ;
+        {   208,  6,  1,  2,  5,  5 },  // Code for char <
+        {   213,  6,  0,  3,  6,  4 },  // Code for char =
+        {   217,  6,  1,  2,  5,  5 },  // Code for char >
+        {   222,  6,  1,  0,  5,  9 },  // Code for char ?
+        {   231, 12,  1,  0, 11, 12 },  // Code for char @
+        {   255,  7,  0,  0,  7,  9 },  // Code for char A
+        {   264,  7,  1,  0,  6,  9 },  // Code for char B
+        {   273,  8,  1,  0,  7,  9 },  // Code for char C
+        {   282,  8,  1,  0,  7,  9 },  // Code for char D
+        {   291,  7,  1,  0,  6,  9 },  // Code for char E
+        {   300,  6,  1,  0,  5,  9 },  // Code for char F
+        {   309,  8,  1,  0,  7,  9 },  // Code for char G
+        {   318,  8,  1,  0,  7,  9 },  // Code for char H
+        {   327,  2,  1,  0,  1,  9 },  // Code for char I
+        {   336,  5,  0,  0,  5,  9 },  // Code for char J
+        {   345,  8,  1,  0,  7,  9 },  // Code for char K
+        {   354,  7,  1,  0,  6,  9 },  // Code for char L
+        {   363,  8,  1,  0,  7,  9 },  // Code for char M
+        {   372,  8,  1,  0,  7,  9 },  // Code for char N
+        {   381,  8,  1,  0,  7,  9 },  // Code for char O
+        {   390,  7,  1,  0,  6,  9 },  // Code for char P
+        {   399,  8,  1,  0,  7,  9 },  // Code for char Q
+        {   408,  8,  1,  0,  7,  9 },  // Code for char R
+        {   417,  7,  1,  0,  6,  9 },  // Code for char S
+        {   426,  7,  0,  0,  7,  9 },  // Code for char T
+        {   435,  8,  1,  0,  7,  9 },  // Code for char U
+        {   444,  7,  0,  0,  7,  9 },  // Code for char V
+        {   453, 11,  0,  0, 11,  9 },  // Code for char W
+        {   471,  7,  0,  0,  7,  9 },  // Code for char X
+        {   480,  7,  0,  0,  7,  9 },  // Code for char Y
+        {   489,  7,  0,  0,  7,  9 },  // Code for char Z
+        {   498,  3,  1,  0,  2, 11 },  // Code for char [
+        {   509,  3,  0,  0,  3,  9 },  // Code for char 0x5C
+        {   518,  2,  0,  0,  2, 11 },  // Code for char ]
+        {   529,  5,  0,  0,  5,  5 },  // Code for char ^
+        {   534,  7,  0, 10,  7,  1 },  // Code for char _
+        {   535,  3,  1,  0,  2,  2 },  // Code for char `
+        {   537,  6,  1,  2,  5,  7 },  // Code for char a
+        {   544,  6,  1,  0,  5,  9 },  // Code for char b
+        {   553,  5,  1,  2,  4,  7 },  // Code for char c
+        {   560,  6,  1,  0,  5,  9 },  // Code for char d
+        {   569,  6,  1,  2,  5,  7 },  // Code for char e
+        {   576,  4,  0,  0,  4,  9 },  // Code for char f
+        {   585,  6,  1,  2,  5,  9 },  // Code for char g
+        {   594,  6,  1,  0,  5,  9 },  // Code for char h
+        {   603,  2,  1,  0,  1,  9 },  // Code for char i
+        {   612,  2,  0,  0,  2, 11 },  // Code for char j
+        {   623,  6,  1,  0,  5,  9 },  // Code for char k
+        {   632,  2,  1,  0,  1,  9 },  // Code for char l
+        {   641, 10,  1,  2,  9,  7 },  // Code for char m
+        {   655,  6,  1,  2,  5,  7 },  // Code for char n
+        {   662,  6,  1,  2,  5,  7 },  // Code for char o
+        {   669,  6,  1,  2,  5,  9 },  // Code for char p
+        {   678,  6,  1,  2,  5,  9 },  // Code for char q
+        {   687,  4,  1,  2,  3,  7 },  // Code for char r
+        {   694,  6,  1,  2,  5,  7 },  // Code for char s
+        {   701,  3,  0,  0,  3,  9 },  // Code for char t
+        {   710,  6,  1,  2,  5,  7 },  // Code for char u
+        {   717,  5,  0,  2,  5,  7 },  // Code for char v
+        {   724,  9,  0,  2,  9,  7 },  // Code for char w
+        {   738,  5,  0,  2,  5,  7 },  // Code for char x
+        {   745,  5,  0,  2,  5,  9 },  // Code for char y
+        {   754,  5,  0,  2,  5,  7 },  // Code for char z
+        {   761,  3,  0,  0,  3, 11 },  // Code for char {
+        {   772,  2,  1,  0,  1, 11 },  // Code for char |
+        {   783,  4,  1,  0,  3, 11 },  // Code for char }
+        {   794,  7,  1,  4,  6,  2 },  // Code for char ~
+        {   796,  8,  1,  1,  7,  8 },  // Code for char 0x7F
+};
+
+/** Arial12x12 as row-major glyph atlas, see GlyphAtlas.h */
+const GlyphAtlas Arial12x12_atlas = { 0x20, 96, 12, 12, Arial12x12_atlas_glyphs, Arial12x12_atlas_bitmap };
+
+#endif
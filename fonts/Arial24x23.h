@@ -5,6 +5,9 @@
 //GLCD FontName : @Arial_Unicode_MS24x23
 //GLCD FontSize : 24 x 23
 
+#ifndef ARIAL24X23_H
+#define ARIAL24X23_H
+
 /** Arial Font with 24x23 pixel matrix for uas with the SPI_TFT lib
 */
 const unsigned char Arial24x23[] = {
@@ -107,3 +110,5 @@ const unsigned char Arial24x23[] = {
         0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // Code for char 
         };
 
+
+#endif
@@ -0,0 +1,299 @@
+//Glyph atlas of Arial24x23.h generated by host/fontconv, do not edit
+//Cell 24 x 23, 96 characters from 0x20, 2955 bitmap bytes
+
+#ifndef ARIAL24X23_ATLAS_H
+#define ARIAL24X23_ATLAS_H
+
+#include "GlyphAtlas.h"
+
+const uint8_t Arial24x23_atlas_bitmap[] = {
+        0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x08, 0x18, 0x18, 0x10, 0x10, 0x20, 0x20, 0x00, 0x00, 0x60,
+        0xC0, 0x33, 0x66, 0x66, 0x44, 0x44, 0xCC, 0x00, 0xE7, 0x00, 0xC6, 0x01, 0x8C, 0x01, 0x8C, 0x03,
+        0x18, 0x1F, 0xFE, 0x3F, 0xFE, 0x06, 0x30, 0x0C, 0x60, 0x0C, 0x60, 0x7F, 0xF8, 0x7F, 0xF8, 0x31,
+        0x80, 0x31, 0x80, 0x63, 0x00, 0x63, 0x00, 0xC6, 0x00, 0x00, 0x40, 0x03, 0xF0, 0x0F, 0xF8, 0x1C,
+        0xB8, 0x18, 0x98, 0x31, 0x18, 0x31, 0x00, 0x39, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x04,
+        0x60, 0xC4, 0x60, 0xC4, 0x60, 0xC8, 0xC0, 0xEB, 0x80, 0xFF, 0x00, 0x7C, 0x00, 0x10, 0x00, 0x20,
+        0x00, 0x07, 0x80, 0xC0, 0x0C, 0xC1, 0x80, 0x18, 0xC3, 0x00, 0x18, 0xC6, 0x00, 0x31, 0x8C, 0x00,
+        0x31, 0x98, 0x00, 0x33, 0x30, 0x00, 0x32, 0x30, 0x00, 0x1C, 0x60, 0x00, 0x00, 0xCF, 0x00, 0x01,
+        0x99, 0x00, 0x03, 0x31, 0x80, 0x06, 0x33, 0x00, 0x0C, 0x63, 0x00, 0x18, 0x63, 0x00, 0x18, 0x66,
+        0x00, 0x30, 0x64, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x78, 0x01, 0xFC, 0x03, 0x9C, 0x03, 0x0C, 0x06,
+        0x18, 0x07, 0x70, 0x03, 0xE0, 0x03, 0x80, 0x0F, 0x80, 0x19, 0xC6, 0x30, 0xCC, 0x60, 0x78, 0x60,
+        0x70, 0xE0, 0x70, 0xE1, 0xF8, 0x7F, 0x9C, 0x3E, 0x10, 0x30, 0x60, 0x60, 0x40, 0x40, 0xC0, 0x00,
+        0x80, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x10, 0x00, 0x30, 0x00, 0x60,
+        0x00, 0x60, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+        0x00, 0x80, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x40, 0x00, 0x02, 0x00, 0x07, 0x00, 0x03,
+        0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03,
+        0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60,
+        0x00, 0xC0, 0x00, 0x80, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x6D, 0x80, 0xFF, 0x00, 0x1C, 0x00, 0x66,
+        0x00, 0xC4, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x7F, 0xF8, 0xFF,
+        0xF8, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x30, 0x60, 0x20, 0x40, 0x80,
+        0xFC, 0xFC, 0x60, 0xC0, 0x00, 0x38, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80,
+        0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00,
+        0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x07, 0xF0, 0x0E, 0x38, 0x18, 0x18, 0x18, 0x18,
+        0x30, 0x18, 0x30, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0xC0,
+        0xC1, 0x80, 0xE3, 0x80, 0xFF, 0x00, 0x7C, 0x00, 0x03, 0x06, 0x0E, 0x36, 0xEC, 0x8C, 0x0C, 0x18,
+        0x18, 0x18, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0x00, 0x7C, 0x01, 0xFE, 0x03, 0x06, 0x06,
+        0x06, 0x0C, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0xE0, 0x01, 0xC0, 0x07,
+        0x00, 0x0E, 0x00, 0x18, 0x00, 0x30, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x01, 0xF0, 0x03, 0xF8, 0x06,
+        0x18, 0x0C, 0x1C, 0x18, 0x18, 0x00, 0x18, 0x00, 0x70, 0x03, 0xC0, 0x03, 0xE0, 0x00, 0x70, 0x00,
+        0x30, 0x00, 0x30, 0x60, 0x60, 0xE0, 0x60, 0x60, 0xC0, 0x7F, 0x80, 0x3E, 0x00, 0x00, 0x06, 0x00,
+        0x1C, 0x00, 0x3C, 0x00, 0x6C, 0x00, 0xD8, 0x01, 0x98, 0x03, 0x18, 0x06, 0x30, 0x0C, 0x30, 0x18,
+        0x30, 0x30, 0x60, 0x7F, 0xF8, 0xFF, 0xF8, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0x80, 0x07,
+        0xFE, 0x07, 0xFC, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x1B, 0xE0, 0x1F, 0xF0, 0x38, 0x70, 0x00,
+        0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x60, 0x60, 0xE0, 0xE0, 0x61, 0xC0, 0x7F, 0x80, 0x3E,
+        0x00, 0x01, 0xF0, 0x07, 0xF8, 0x0E, 0x1C, 0x1C, 0x1C, 0x18, 0x00, 0x30, 0x00, 0x37, 0xC0, 0x6F,
+        0xE0, 0x78, 0xE0, 0x60, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0x80, 0xFF,
+        0x00, 0x3C, 0x00, 0x0F, 0xFE, 0x1F, 0xFC, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01,
+        0x80, 0x03, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x38, 0x00, 0x30, 0x00, 0x60,
+        0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x07, 0x1C, 0x06, 0x18, 0x0C, 0x18, 0x0C,
+        0x18, 0x0E, 0x30, 0x07, 0xE0, 0x0F, 0xE0, 0x38, 0x70, 0x70, 0x30, 0x60, 0x30, 0x60, 0x70, 0xE0,
+        0x60, 0xE1, 0xC0, 0x7F, 0x80, 0x3E, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x07, 0x1C, 0x0C, 0x0C, 0x18,
+        0x0C, 0x18, 0x0C, 0x18, 0x1C, 0x38, 0x18, 0x18, 0x78, 0x1F, 0xD8, 0x0F, 0x30, 0x00, 0x30, 0x00,
+        0x60, 0xC0, 0xC0, 0xE1, 0x80, 0xFF, 0x00, 0x3E, 0x00, 0x0C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0xC0, 0x06, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+        0x60, 0x20, 0x40, 0x80, 0x00, 0x30, 0x00, 0xE0, 0x07, 0xC0, 0x1E, 0x00, 0xF8, 0x00, 0xC0, 0x00,
+        0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x01, 0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x08, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x03, 0xE0,
+        0x00, 0xF0, 0x00, 0x30, 0x01, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0x70, 0x00, 0x80, 0x00, 0x07, 0xC0,
+        0x1F, 0xE0, 0x30, 0x60, 0x60, 0x60, 0xC0, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x03, 0x80, 0x06, 0x00,
+        0x1C, 0x00, 0x38, 0x00, 0x30, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xC0, 0x00,
+        0x00, 0x07, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0xF0, 0x1C, 0x01, 0xC0, 0x06, 0x03, 0x00, 0x06, 0x06,
+        0x0F, 0x36, 0x0C, 0x3F, 0xF6, 0x18, 0x71, 0xE6, 0x30, 0xC0, 0xC6, 0x31, 0x80, 0xC6, 0x63, 0x01,
+        0x86, 0x63, 0x01, 0x8C, 0x63, 0x03, 0x0C, 0xC6, 0x07, 0x18, 0xC7, 0x1E, 0x70, 0xC3, 0xF7, 0xC0,
+        0xE1, 0xC7, 0x80, 0x60, 0x00, 0x0C, 0x70, 0x00, 0x38, 0x3E, 0x01, 0xE0, 0x1F, 0xFF, 0x80, 0x07,
+        0xFE, 0x00, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x36, 0x00, 0x36, 0x00, 0x66, 0x00, 0xC6, 0x01, 0x86,
+        0x01, 0x86, 0x03, 0x06, 0x06, 0x06, 0x0F, 0xFE, 0x0F, 0xFE, 0x18, 0x06, 0x30, 0x06, 0x30, 0x06,
+        0x60, 0x06, 0xC0, 0x06, 0x03, 0xFC, 0x07, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x06, 0x0C, 0x04,
+        0x0C, 0x0C, 0x1F, 0xF0, 0x1F, 0xF8, 0x18, 0x1C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x60, 0x18,
+        0x60, 0x30, 0x7F, 0xE0, 0xFF, 0x80, 0x00, 0xFC, 0x03, 0xFE, 0x07, 0x07, 0x0C, 0x07, 0x18, 0x03,
+        0x30, 0x03, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x0C, 0xC0, 0x18,
+        0xE0, 0x30, 0x70, 0xF0, 0x7F, 0xC0, 0x1F, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x07,
+        0x00, 0x06, 0x03, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x03, 0x00, 0x18, 0x03, 0x00,
+        0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x0C, 0x00, 0x60,
+        0x18, 0x00, 0x60, 0x70, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF,
+        0x80, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+        0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+        0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
+        0x80, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+        0x0C, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+        0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00,
+        0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x80, 0x07, 0x83, 0xC0, 0x0E, 0x01, 0xC0, 0x18, 0x00, 0xC0,
+        0x30, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x3F, 0x80, 0x60, 0x7F, 0x80, 0xC0,
+        0x03, 0x00, 0xC0, 0x03, 0x00, 0xE0, 0x03, 0x00, 0x60, 0x06, 0x00, 0x78, 0x3E, 0x00, 0x3F, 0xF8,
+        0x00, 0x0F, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x06, 0x01, 0x80, 0x06, 0x01, 0x80, 0x06, 0x01, 0x80,
+        0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x18,
+        0x06, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18,
+        0x00, 0x60, 0x18, 0x00, 0xC0, 0x30, 0x00, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x18, 0x18,
+        0x18, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+        0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80,
+        0x61, 0x00, 0xC3, 0x00, 0xE6, 0x00, 0xFE, 0x00, 0x78, 0x00, 0x03, 0x00, 0xE0, 0x06, 0x01, 0x80,
+        0x06, 0x03, 0x00, 0x06, 0x0E, 0x00, 0x0C, 0x18, 0x00, 0x0C, 0x30, 0x00, 0x0C, 0xE0, 0x00, 0x19,
+        0xC0, 0x00, 0x1B, 0x80, 0x00, 0x1E, 0xC0, 0x00, 0x3C, 0xE0, 0x00, 0x30, 0x60, 0x00, 0x30, 0x30,
+        0x00, 0x60, 0x30, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0xC0, 0x0C, 0x00, 0x03, 0x00, 0x06,
+        0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,
+        0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x03,
+        0x80, 0x78, 0x07, 0x80, 0x70, 0x07, 0x80, 0xF0, 0x07, 0x81, 0xB0, 0x0D, 0x81, 0xE0, 0x0D, 0x83,
+        0x60, 0x0D, 0x86, 0x60, 0x19, 0x86, 0xC0, 0x19, 0x8C, 0xC0, 0x19, 0x8C, 0xC0, 0x31, 0x99, 0x80,
+        0x33, 0x31, 0x80, 0x33, 0x31, 0x80, 0x63, 0x63, 0x00, 0x63, 0xC3, 0x00, 0x63, 0xC3, 0x00, 0xC3,
+        0x86, 0x00, 0x03, 0x00, 0xC0, 0x07, 0x01, 0x80, 0x07, 0x81, 0x80, 0x07, 0x81, 0x80, 0x0D, 0x83,
+        0x00, 0x0D, 0x83, 0x00, 0x0D, 0x83, 0x00, 0x18, 0xC6, 0x00, 0x18, 0xC6, 0x00, 0x18, 0xC6, 0x00,
+        0x30, 0xCC, 0x00, 0x30, 0x6C, 0x00, 0x30, 0x6C, 0x00, 0x60, 0x78, 0x00, 0x60, 0x78, 0x00, 0x60,
+        0x78, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0x00, 0x07, 0x03, 0x80, 0x0C, 0x01,
+        0x80, 0x18, 0x01, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x01, 0x80,
+        0x40, 0x01, 0x80, 0xC0, 0x03, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00, 0x60, 0x1C, 0x00, 0x70,
+        0x78, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xFE, 0x07, 0xFF, 0x06, 0x03, 0x06, 0x03,
+        0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x06, 0x18, 0x0E, 0x1F, 0xFC, 0x1F, 0xF0, 0x30, 0x00, 0x30, 0x00,
+        0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0x00,
+        0x07, 0x03, 0x80, 0x0C, 0x01, 0x80, 0x18, 0x01, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x60,
+        0x00, 0xC0, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0xC0, 0x03, 0x00, 0xC0, 0x06, 0x00, 0xE0, 0x8E,
+        0x00, 0x61, 0xFC, 0x00, 0x70, 0x70, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0x9C, 0x00, 0x00, 0x08, 0x00,
+        0x03, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x06, 0x01, 0x80, 0x06, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C,
+        0x01, 0x80, 0x0C, 0x07, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x18, 0x30, 0x00, 0x30, 0x38,
+        0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00,
+        0xC0, 0x0C, 0x00, 0x01, 0xF8, 0x07, 0xFC, 0x0E, 0x0C, 0x0C, 0x0C, 0x18, 0x0C, 0x18, 0x00, 0x1C,
+        0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x78, 0x00, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x30, 0xE0,
+        0xE0, 0xFF, 0xC0, 0x3F, 0x00, 0x7F, 0xFE, 0xFF, 0xFC, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06,
+        0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30,
+        0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x0C, 0x03, 0x18, 0x06, 0x18, 0x06, 0x18, 0x06, 0x30,
+        0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0xC0, 0x30, 0xC0, 0x30, 0xC0,
+        0x60, 0xC0, 0x60, 0xC0, 0xC0, 0xFF, 0x80, 0x7F, 0x00, 0xC0, 0x0E, 0xC0, 0x0C, 0xC0, 0x18, 0xC0,
+        0x30, 0xC0, 0x30, 0xC0, 0x60, 0xC0, 0xC0, 0xC1, 0xC0, 0xC1, 0x80, 0xC3, 0x00, 0xC6, 0x00, 0xC6,
+        0x00, 0xCC, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0x30, 0x0E, 0x04, 0x30, 0x1E,
+        0x04, 0x30, 0x3E, 0x0C, 0x60, 0x3E, 0x0C, 0x60, 0x6C, 0x18, 0x60, 0xCC, 0x18, 0x60, 0xCC, 0x30,
+        0x61, 0x8C, 0x30, 0x63, 0x0C, 0x60, 0x63, 0x0C, 0x60, 0x66, 0x0C, 0xC0, 0x6C, 0x0D, 0x80, 0xEC,
+        0x0D, 0x80, 0xF8, 0x1B, 0x00, 0xF0, 0x1E, 0x00, 0xF0, 0x1E, 0x00, 0xE0, 0x1C, 0x00, 0x01, 0x80,
+        0x1C, 0x01, 0xC0, 0x30, 0x00, 0xC0, 0x60, 0x00, 0xC1, 0xC0, 0x00, 0x63, 0x80, 0x00, 0x66, 0x00,
+        0x00, 0x7C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x78, 0x00, 0x01, 0xD8, 0x00, 0x03,
+        0x9C, 0x00, 0x07, 0x0C, 0x00, 0x0C, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x30, 0x06, 0x00, 0xE0, 0x03,
+        0x00, 0xC0, 0x07, 0xC0, 0x0C, 0x60, 0x18, 0x60, 0x30, 0x70, 0x60, 0x30, 0xC0, 0x39, 0x80, 0x1B,
+        0x00, 0x1E, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+        0x00, 0x60, 0x00, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x01, 0xC0, 0x00,
+        0x03, 0x80, 0x00, 0x06, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x60, 0x00, 0x01, 0xC0,
+        0x00, 0x03, 0x80, 0x00, 0x06, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x60, 0x00, 0x00,
+        0x7F, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00,
+        0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xF8, 0x00,
+        0xF0, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+        0xC0, 0xC0, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01,
+        0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C,
+        0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0x03,
+        0x00, 0x07, 0x80, 0x0F, 0x80, 0x0D, 0x80, 0x19, 0x80, 0x31, 0x80, 0x61, 0x80, 0x61, 0x80, 0xC1,
+        0x80, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0x60, 0x07, 0xE0, 0x0F, 0xF0, 0x18, 0x30,
+        0x30, 0x30, 0x01, 0xF0, 0x1F, 0xE0, 0x7E, 0x60, 0x60, 0xE0, 0xC0, 0xC0, 0xC3, 0xC0, 0xFE, 0xC0,
+        0x78, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0D, 0xE0, 0x0F, 0xF0,
+        0x1E, 0x30, 0x18, 0x10, 0x18, 0x10, 0x30, 0x30, 0x30, 0x30, 0x30, 0x20, 0x60, 0x60, 0x70, 0xC0,
+        0x7F, 0x80, 0xCE, 0x00, 0x07, 0x80, 0x1F, 0xC0, 0x31, 0xC0, 0x60, 0xC0, 0x60, 0x00, 0xC0, 0x00,
+        0xC0, 0x00, 0xC0, 0x00, 0xC3, 0x00, 0xC6, 0x00, 0xFE, 0x00, 0x78, 0x00, 0x00, 0x0C, 0x00, 0x18,
+        0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x07, 0xB0, 0x1F, 0xB0, 0x30, 0xE0, 0x60, 0xE0, 0x40, 0xE0,
+        0xC0, 0xC0, 0xC0, 0xC0, 0x81, 0xC0, 0xC1, 0x80, 0xC7, 0x80, 0xFD, 0x80, 0x7B, 0x00, 0x07, 0x80,
+        0x1F, 0xC0, 0x30, 0xE0, 0x60, 0x60, 0x7F, 0xC0, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xC1, 0x80,
+        0xC3, 0x00, 0xFE, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00,
+        0x3F, 0x80, 0x7F, 0x80, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+        0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0xE6, 0x03, 0xF6, 0x07, 0x1C, 0x0C, 0x0C,
+        0x0C, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x18, 0x30, 0x18, 0x70, 0x1F, 0xB0, 0x0F, 0x60,
+        0x00, 0x60, 0x60, 0xC0, 0xE1, 0xC0, 0x7F, 0x80, 0x3E, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00,
+        0x06, 0x00, 0x0C, 0x00, 0x0D, 0xF0, 0x0F, 0xF8, 0x1E, 0x38, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30,
+        0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x03, 0x06, 0x00, 0x00,
+        0x00, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0x01, 0x80, 0x03,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C,
+        0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60,
+        0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C,
+        0x00, 0x0C, 0x1C, 0x0C, 0x30, 0x18, 0x60, 0x19, 0xC0, 0x1B, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x33,
+        0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0xC0, 0xC0, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C,
+        0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0x0D, 0xE3, 0xC0, 0x0F, 0xFF, 0xE0,
+        0x1C, 0x38, 0x60, 0x18, 0x30, 0x60, 0x18, 0x30, 0x60, 0x30, 0x60, 0xC0, 0x30, 0x60, 0xC0, 0x30,
+        0x60, 0xC0, 0x60, 0xC1, 0x80, 0x60, 0xC1, 0x80, 0x60, 0xC1, 0x80, 0xC1, 0x83, 0x00, 0x0D, 0xF0,
+        0x0F, 0xF8, 0x1E, 0x38, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60,
+        0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x07, 0x80, 0x1F, 0xC0, 0x30, 0xE0, 0x60, 0x60, 0x40, 0x60,
+        0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xC1, 0x80, 0xC3, 0x00, 0xFE, 0x00, 0x78, 0x00, 0x06, 0xF0,
+        0x07, 0xF8, 0x0E, 0x1C, 0x0C, 0x1C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x38, 0x30,
+        0x38, 0x60, 0x3F, 0xC0, 0x6F, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x00,
+        0x07, 0x30, 0x1F, 0xB0, 0x30, 0xE0, 0x60, 0xE0, 0x60, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC0,
+        0xC1, 0x80, 0xC3, 0x80, 0xFD, 0x80, 0x7B, 0x00, 0x03, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00,
+        0x0C, 0x00, 0x0D, 0xE0, 0x0F, 0xC0, 0x1C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00,
+        0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x07, 0xC0, 0x1F, 0xE0, 0x38, 0xE0,
+        0x30, 0x60, 0x38, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x01, 0x80, 0xC1, 0x80, 0xE3, 0x80, 0xFF, 0x00,
+        0x7C, 0x00, 0x04, 0x0C, 0x0C, 0x18, 0x7F, 0xFF, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0,
+        0xF0, 0xF0, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60,
+        0x60, 0xE0, 0xC0, 0xC0, 0xE3, 0xC0, 0xFE, 0xC0, 0x79, 0x80, 0xC0, 0x60, 0xC0, 0xC0, 0xC1, 0x80,
+        0xC1, 0x80, 0xC3, 0x00, 0xC6, 0x00, 0xCE, 0x00, 0xCC, 0x00, 0xD8, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+        0xE0, 0x00, 0x60, 0xE0, 0xC0, 0x61, 0xE1, 0x80, 0x61, 0xE1, 0x80, 0x63, 0x63, 0x00, 0x63, 0xE6,
+        0x00, 0x66, 0xE6, 0x00, 0xEC, 0xEC, 0x00, 0xCC, 0xCC, 0x00, 0xD8, 0xD8, 0x00, 0xF0, 0xF0, 0x00,
+        0xF0, 0xF0, 0x00, 0xE0, 0xE0, 0x00, 0x0E, 0x07, 0x06, 0x0C, 0x07, 0x18, 0x03, 0x30, 0x03, 0x60,
+        0x01, 0xC0, 0x03, 0x80, 0x06, 0xC0, 0x0C, 0xC0, 0x18, 0x60, 0x30, 0x60, 0xE0, 0x70, 0x0C, 0x06,
+        0x0C, 0x0C, 0x0C, 0x18, 0x0C, 0x38, 0x0C, 0x30, 0x0E, 0x60, 0x0E, 0xC0, 0x0E, 0xC0, 0x0F, 0x80,
+        0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0xF0, 0x00, 0xE0, 0x00,
+        0x0F, 0xFE, 0x1F, 0xFE, 0x00, 0x18, 0x00, 0x30, 0x00, 0xE0, 0x01, 0x80, 0x03, 0x00, 0x0E, 0x00,
+        0x18, 0x00, 0x30, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x80, 0x01, 0xC0, 0x03, 0x00, 0x06, 0x00,
+        0x04, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xE0, 0x00,
+        0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+        0xE0, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00,
+        0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00,
+        0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00,
+        0x02, 0x07, 0x03, 0x01, 0x03, 0x03, 0x02, 0x06, 0x06, 0x06, 0x03, 0x06, 0x0C, 0x08, 0x18, 0x10,
+        0x30, 0x30, 0x20, 0x60, 0x80, 0x3E, 0x20, 0x7F, 0xE0, 0xC7, 0xC0,
+};
+
+const AtlasGlyph Arial24x23_atlas_glyphs[] = {
+        {     0, 13,  0,  0,  0,  0 },  // Code for char 0x20
+        {     0, 10,  2,  1,  8, 17 },  // Code for char !
+        {    17, 13,  5,  1,  8,  6 },  // Code for char "
+        {    23, 17,  1,  1, 16, 17 },  // Code for char #
+        {    57, 16,  3,  0, 13, 20 },  // Code for char $
+        {    97, 22,  4,  1, 18, 18 },  // Code for char %
+        {   151, 17,  2,  1, 15, 17 },  // Code for char &
+        {   185,  9,  5,  1,  4,  6 },  // Code for char '
+        {   191, 23, 14,  0,  9, 22 },  // Code for char (
+        {   235,  9,  0,  0,  9, 21 },  // Code for char )
+        {   277, 14,  5,  1,  9,  7 },  // Code for char *
+        {   291, 16,  3,  4, 13, 12 },  // Code for char +
+        {   315,  5,  1, 16,  4,  5 },  // Code for char ,
+        {   320,  9,  3, 11,  6,  2 },  // Code for char -
+        {   322,  5,  2, 16,  3,  2 },  // Code for char .
+        {   324, 13,  0,  1, 13, 17 },  // Code for char /
+        {   358, 17,  3,  1, 13, 17 },  // Code for char 0
+        {   392, 17,  7,  1,  8, 17 },  // Code for char 1
+        {   409, 17,  1,  1, 15, 17 },  // Code for char 2
+        {   443, 17,  2,  1, 14, 17 },  // Code for char 3
+        {   477, 17,  1,  1, 15, 17 },  // Code for char 4
+        {   511, 17,  2,  1, 15, 17 },  // Code for char 5
+        {   545, 17,  3,  1, 14, 17 },  // Code for char 6
+        {   579, 17,  3,  1, 15, 17 },  // Code for char 7
+        {   613, 17,  2,  1, 14, 17 },  // Code for char 8
+        {   647, 17,  2,  1, 14, 17 },  // Code for char 9
+        {   681, 10,  2,  6,  6, 12 },  // Code for char :
+        {   693,  8,  1,  6,  7, 15 },  // Code for char ;
+        {   708, 17,  5,  4, 12, 11 },  // Code for char <
+        {   730, 16,  4,  6, 12,  7 },  // Code for char =
+        {   744, 15,  3,  4, 12, 11 },  // Code for char >
+        {   766, 16,  5,  1, 11, 17 },  // Code for char ?
+        {   800, 23,  0,  1, 23, 22 },  // Code for char @
+        {   866, 15,  0,  1, 15, 17 },  // Code for char A
+        {   900, 16,  1,  1, 15, 17 },  // Code for char B
+        {   934, 17,  1,  1, 16, 17 },  // Code for char C
+        {   968, 18,  1,  1, 17, 17 },  // Code for char D
+        {  1019, 20,  2,  1, 18, 17 },  // Code for char E
+        {  1070, 19,  2,  1, 17, 17 },  // Code for char F
+        {  1121, 20,  2,  1, 18, 17 },  // Code for char G
+        {  1172, 20,  2,  1, 18, 17 },  // Code for char H
+        {  1223, 10,  2,  1,  8, 17 },  // Code for char I
+        {  1240, 15,  2,  1, 13, 17 },  // Code for char J
+        {  1274, 21,  2,  1, 19, 17 },  // Code for char K
+        {  1325, 13,  2,  1, 11, 17 },  // Code for char L
+        {  1359, 23,  2,  1, 21, 17 },  // Code for char M
+        {  1410, 20,  2,  1, 18, 17 },  // Code for char N
+        {  1461, 20,  2,  1, 18, 17 },  // Code for char O
+        {  1512, 18,  2,  1, 16, 17 },  // Code for char P
+        {  1546, 20,  2,  1, 18, 18 },  // Code for char Q
+        {  1600, 19,  2,  1, 17, 17 },  // Code for char R
+        {  1651, 16,  2,  1, 14, 17 },  // Code for char S
+        {  1685, 17,  2,  1, 15, 17 },  // Code for char T
+        {  1719, 18,  2,  1, 16, 17 },  // Code for char U
+        {  1753, 17,  2,  1, 15, 17 },  // Code for char V
+        {  1787, 24,  2,  1, 22, 17 },  // Code for char W
+        {  1838, 22,  0,  1, 22, 17 },  // Code for char X
+        {  1889, 18,  2,  1, 16, 17 },  // Code for char Y
+        {  1923, 20,  0,  1, 20, 17 },  // Code for char Z
+        {  1974, 12,  0,  1, 12, 22 },  // Code for char [
+        {  2018,  8,  5,  1,  3, 17 },  // Code for char 0x5C
+        {  2035, 11,  0,  1, 11, 22 },  // Code for char ]
+        {  2079, 13,  4,  1,  9,  9 },  // Code for char ^
+        {  2097, 21,  0, 21, 21,  2 },  // Code for char _
+        {  2103, 10,  7,  1,  3,  3 },  // Code for char `
+        {  2106, 14,  2,  6, 12, 12 },  // Code for char a
+        {  2130, 13,  1,  1, 12, 17 },  // Code for char b
+        {  2164, 12,  2,  6, 10, 12 },  // Code for char c
+        {  2188, 16,  2,  1, 14, 17 },  // Code for char d
+        {  2222, 13,  2,  6, 11, 12 },  // Code for char e
+        {  2246, 14,  2,  1, 12, 17 },  // Code for char f
+        {  2280, 15,  0,  6, 15, 17 },  // Code for char g
+        {  2314, 14,  1,  1, 13, 17 },  // Code for char h
+        {  2348,  9,  1,  1,  8, 17 },  // Code for char i
+        {  2365,  9,  0,  1,  9, 21 },  // Code for char j
+        {  2407, 15,  1,  1, 14, 17 },  // Code for char k
+        {  2441,  9,  1,  1,  8, 17 },  // Code for char l
+        {  2458, 20,  1,  6, 19, 12 },  // Code for char m
+        {  2494, 14,  1,  6, 13, 12 },  // Code for char n
+        {  2518, 14,  3,  6, 11, 12 },  // Code for char o
+        {  2542, 14,  0,  6, 14, 17 },  // Code for char p
+        {  2576, 14,  2,  6, 12, 17 },  // Code for char q
+        {  2610, 12,  1,  6, 11, 12 },  // Code for char r
+        {  2634, 13,  2,  6, 11, 12 },  // Code for char s
+        {  2658, 10,  2,  2,  8, 16 },  // Code for char t
+        {  2674, 15,  2,  6, 13, 12 },  // Code for char u
+        {  2698, 13,  2,  6, 11, 12 },  // Code for char v
+        {  2722, 20,  2,  6, 18, 12 },  // Code for char w
+        {  2758, 16,  0,  6, 16, 12 },  // Code for char x
+        {  2782, 15,  0,  6, 15, 17 },  // Code for char y
+        {  2816, 15,  0,  6, 15, 12 },  // Code for char z
+        {  2840, 24, 14,  0, 10, 22 },  // Code for char {
+        {  2884, 10,  0,  1, 10, 22 },  // Code for char |
+        {  2928,  8,  0,  0,  8, 21 },  // Code for char }
+        {  2949, 15,  4,  8, 11,  3 },  // Code for char ~
+        {  2955,  1,  0,  0,  0,  0 },  // Code for char 0x7F
+};
+
+/** Arial24x23 as row-major glyph atlas, see GlyphAtlas.h */
+const GlyphAtlas Arial24x23_atlas = { 0x20, 96, 24, 23, Arial24x23_atlas_glyphs, Arial24x23_atlas_bitmap };
+
+#endif
@@ -5,6 +5,9 @@
 //GLCD FontName : @Arial_Unicode_MS28x28
 //GLCD FontSize : 28 x 28
 
+#ifndef ARIAL28X28_H
+#define ARIAL28X28_H
+
 /** Arial Font italic with 27*28 pixel matrix for use with SPI_TFT lib
 */
 const unsigned char Arial28x28[] = {
@@ -491,3 +494,5 @@ const unsigned char Arial28x28[] = {
 
 };
 
+
+#endif
@@ -0,0 +1,334 @@
+//Glyph atlas of Arial28x28.h generated by host/fontconv, do not edit
+//Cell 28 x 28, 96 characters from 0x20, 3513 bitmap bytes
+
+#ifndef ARIAL28X28_ATLAS_H
+#define ARIAL28X28_ATLAS_H
+
+#include "GlyphAtlas.h"
+
+const uint8_t Arial28x28_atlas_bitmap[] = {
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x42, 0x06, 0x0C, 0x06, 0x0C,
+        0x0E, 0x1C, 0x0C, 0x18, 0x0C, 0x18, 0x0C, 0x18, 0xFF, 0xFE, 0xFF, 0xFE, 0x18, 0x30, 0x18, 0x30,
+        0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0xFF, 0xFE, 0xFF, 0xFE, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60,
+        0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x3F, 0xF0, 0x73, 0x78, 0xE3, 0x38,
+        0xE3, 0x1C, 0xE3, 0x1C, 0xE3, 0x00, 0xF3, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8,
+        0x03, 0x38, 0x03, 0x1C, 0xE3, 0x1C, 0xE3, 0x1C, 0xF3, 0x1C, 0x73, 0x38, 0x7B, 0x78, 0x3F, 0xF0,
+        0x0F, 0xC0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3E, 0x00, 0xC0, 0x7F, 0x01, 0x80, 0x63, 0x01,
+        0x80, 0xC1, 0x83, 0x00, 0xC1, 0x83, 0x00, 0xC1, 0x86, 0x00, 0xC1, 0x8E, 0x00, 0xC1, 0x8C, 0x00,
+        0x63, 0x18, 0x00, 0x7F, 0x18, 0x00, 0x3C, 0x30, 0x00, 0x00, 0x31, 0xF0, 0x00, 0x63, 0xF8, 0x00,
+        0x63, 0x18, 0x00, 0xC6, 0x0C, 0x01, 0xC6, 0x0C, 0x01, 0x86, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06,
+        0x0C, 0x06, 0x03, 0x18, 0x06, 0x03, 0xF8, 0x0C, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x1F, 0xE0, 0x00,
+        0x1C, 0xF0, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x18, 0x60, 0x00, 0x1C,
+        0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x71, 0xC7, 0x00, 0x70, 0xE7,
+        0x00, 0xE0, 0x7E, 0x00, 0xE0, 0x3E, 0x00, 0xE0, 0x1E, 0x00, 0xE0, 0x1E, 0x00, 0x70, 0x3F, 0x00,
+        0x78, 0xF3, 0x80, 0x3F, 0xE1, 0xC0, 0x0F, 0x80, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x40,
+        0x04, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+        0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x1C, 0x0E, 0x04, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x30,
+        0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x60, 0x60, 0xC0,
+        0xC0, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0x4C, 0x80, 0xFF, 0xC0, 0x3F, 0x00, 0x1E, 0x00, 0x3F, 0x00,
+        0x73, 0x80, 0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+        0xFF, 0xFC, 0xFF, 0xFC, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+        0xE0, 0xE0, 0xE0, 0x20, 0x20, 0x40, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x03, 0x03, 0x06,
+        0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60,
+        0xC0, 0xC0, 0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xE0, 0x78, 0xF0, 0x70, 0x70, 0x70, 0x78, 0xE0, 0x38,
+        0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38,
+        0xF0, 0x78, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x03, 0x07, 0x0F, 0x1F,
+        0x7F, 0xF7, 0xE7, 0x87, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+        0x07, 0x0F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0x00, 0x38, 0x00,
+        0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C,
+        0x00, 0x38, 0x00, 0x70, 0x00, 0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x80, 0x3F, 0xC0, 0x7F,
+        0xE0, 0x70, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x07, 0xC0, 0x07,
+        0xC0, 0x07, 0xF0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38, 0xE0, 0x38, 0xF0, 0x38, 0x78, 0xF0, 0x7F,
+        0xF0, 0x3F, 0xE0, 0x0F, 0x80, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0x70, 0x07,
+        0x70, 0x06, 0x70, 0x0C, 0x70, 0x1C, 0x70, 0x18, 0x70, 0x30, 0x70, 0x60, 0x70, 0xE0, 0x70, 0xFF,
+        0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x3F,
+        0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x67, 0x80, 0x7F,
+        0xE0, 0xFF, 0xF0, 0xF0, 0xF0, 0xE0, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0xE0, 0x38, 0xF0,
+        0x78, 0x70, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x0F, 0x80, 0x07, 0xC0, 0x1F, 0xE0, 0x3F, 0xF0, 0x78,
+        0x78, 0x70, 0x38, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE7, 0xC0, 0xEF, 0xE0, 0xFF, 0xF0, 0xF8,
+        0xF0, 0xF0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF0, 0x3F, 0xF0, 0x1F,
+        0xE0, 0x0F, 0x80, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x01,
+        0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E,
+        0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0F, 0x80, 0x1F,
+        0xC0, 0x3F, 0xE0, 0x78, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x38, 0xE0, 0x3F,
+        0xE0, 0x0F, 0x80, 0x3F, 0xE0, 0x70, 0xF0, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF8,
+        0x78, 0x7F, 0xF0, 0x3F, 0xE0, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0xC0, 0x7F, 0xE0, 0x78, 0xF0, 0xF0,
+        0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x78, 0x78, 0xF8, 0x7F, 0xF8, 0x3F, 0xB8, 0x1F,
+        0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0xE0, 0x70, 0xF0, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F,
+        0x00, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x20,
+        0x20, 0x40, 0xC0, 0x00, 0x04, 0x00, 0x1C, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78,
+        0x00, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1C, 0x00,
+        0x04, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+        0xFC, 0xFF, 0xFC, 0x80, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00,
+        0x78, 0x00, 0x1C, 0x00, 0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x7C, 0x00, 0xF0, 0x00, 0x80, 0x00, 0x0F,
+        0x80, 0x3F, 0xE0, 0x78, 0xF0, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+        0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xF0,
+        0x00, 0x07, 0xC0, 0x78, 0x00, 0x0F, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x07,
+        0x00, 0x30, 0x3C, 0xE3, 0x00, 0x30, 0xFF, 0xE3, 0x00, 0x61, 0xE3, 0xE1, 0x80, 0x61, 0xC1, 0xE1,
+        0x80, 0xC3, 0x81, 0xC1, 0x80, 0xC3, 0x81, 0xC1, 0x80, 0xC7, 0x01, 0xC1, 0x80, 0xC7, 0x01, 0xC1,
+        0x80, 0xC7, 0x01, 0xC3, 0x00, 0xC7, 0x03, 0xC3, 0x00, 0xC7, 0x03, 0x86, 0x00, 0xC7, 0x87, 0x86,
+        0x00, 0x63, 0x8F, 0x9C, 0x00, 0x61, 0xFB, 0xF8, 0x00, 0x70, 0xF1, 0xE0, 0x00, 0x38, 0x00, 0x00,
+        0xC0, 0x1C, 0x00, 0x01, 0x80, 0x0E, 0x00, 0x07, 0x00, 0x07, 0xC0, 0x1E, 0x00, 0x03, 0xFF, 0xF8,
+        0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xB0,
+        0x00, 0x03, 0xB8, 0x00, 0x03, 0xB8, 0x00, 0x03, 0x18, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00,
+        0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x3F,
+        0xFF, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x70, 0x01, 0xC0, 0x70, 0x01, 0xC0, 0xE0, 0x00,
+        0xE0, 0xE0, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF8, 0xE0, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C,
+        0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x38, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF8, 0xE0, 0x1C, 0xE0, 0x0E,
+        0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x1E, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xE0, 0x03, 0xF8,
+        0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x3E, 0x0F, 0x80, 0x78, 0x03, 0x80, 0x70, 0x03, 0xC0,
+        0x70, 0x01, 0x80, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
+        0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x01, 0x80, 0x70, 0x01, 0xC0, 0x70, 0x03, 0x80, 0x78, 0x07,
+        0x80, 0x3E, 0x0F, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xF0, 0x00,
+        0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0xE0, 0x1E, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x00, 0xE0,
+        0x07, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03,
+        0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x00,
+        0xE0, 0x1E, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE,
+        0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFC,
+        0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+        0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x00, 0xE0, 0x00,
+        0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00,
+        0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+        0x01, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x3E, 0x03, 0xE0, 0x3C, 0x00, 0xE0, 0x78,
+        0x00, 0xF0, 0x70, 0x00, 0x60, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x1F,
+        0xF0, 0xE0, 0x1F, 0xF0, 0xE0, 0x1F, 0xF0, 0xE0, 0x00, 0x70, 0x70, 0x00, 0x70, 0x78, 0x00, 0x70,
+        0x3C, 0x00, 0x70, 0x3F, 0x03, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0xE0,
+        0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+        0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+        0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xF1, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x1F, 0x00, 0xE0, 0x07, 0x80, 0xE0, 0x0E, 0x00, 0xE0, 0x1C,
+        0x00, 0xE0, 0x38, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0xE0, 0x00, 0xE1, 0xC0, 0x00, 0xE3, 0x80, 0x00,
+        0xE7, 0x00, 0x00, 0xEF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xF9, 0xC0, 0x00, 0xF1, 0xC0, 0x00, 0xE0,
+        0xE0, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x0E,
+        0x00, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+        0xF8, 0xF8, 0x03, 0xE0, 0xF8, 0x03, 0xE0, 0xF8, 0x03, 0xE0, 0xFC, 0x07, 0xE0, 0xFC, 0x07, 0xE0,
+        0xEC, 0x06, 0xE0, 0xEE, 0x06, 0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0x0E, 0xE0, 0xE6, 0x0C, 0xE0, 0xE7,
+        0x1C, 0xE0, 0xE7, 0x1C, 0xE0, 0xE7, 0x1C, 0xE0, 0xE3, 0x18, 0xE0, 0xE3, 0xB8, 0xE0, 0xE3, 0xB8,
+        0xE0, 0xE3, 0xB8, 0xE0, 0xE3, 0xB0, 0xE0, 0xE1, 0xF0, 0xE0, 0xE1, 0xF0, 0xE0, 0xE1, 0xF0, 0xE0,
+        0xE0, 0x07, 0xF0, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x07, 0xEE, 0x07, 0xE7, 0x07,
+        0xE7, 0x07, 0xE3, 0x87, 0xE1, 0x87, 0xE1, 0xC7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE0, 0x77, 0xE0, 0x37,
+        0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0x01, 0xF8, 0x00, 0x0F, 0xFF, 0x00,
+        0x1F, 0xFF, 0x80, 0x3E, 0x07, 0xC0, 0x38, 0x01, 0xC0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0xE0,
+        0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00,
+        0x70, 0xE0, 0x00, 0x70, 0x70, 0x00, 0xE0, 0x78, 0x00, 0xE0, 0x38, 0x01, 0xC0, 0x3E, 0x07, 0xC0,
+        0x1F, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xF0, 0xFF, 0xF8, 0xFF, 0xFC, 0xE0,
+        0x1E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x3E, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF,
+        0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3E, 0x07, 0xC0, 0x38,
+        0x01, 0xC0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00,
+        0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0x70, 0x00, 0xE0,
+        0x70, 0x11, 0xE0, 0x38, 0x3D, 0xC0, 0x3E, 0x0F, 0xC0, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01,
+        0xF8, 0xF0, 0x00, 0x00, 0x60, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xE0, 0x0F,
+        0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x0F, 0x80,
+        0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x3C, 0x00, 0xE0,
+        0x1E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0xC0, 0xE0, 0x01,
+        0xC0, 0xE0, 0x00, 0xE0, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x78, 0x3C, 0x70, 0x0E, 0x70, 0x0E,
+        0x70, 0x00, 0x78, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x1E, 0x00, 0x0F,
+        0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x07, 0x7C, 0x1E, 0x3F, 0xFE, 0x1F, 0xFC, 0x07, 0xF0, 0xFF, 0xFF,
+        0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00,
+        0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01,
+        0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
+        0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0xE0, 0x07, 0xE0,
+        0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+        0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x07, 0x70, 0x0E, 0x78,
+        0x1E, 0x3F, 0xFC, 0x1F, 0xF8, 0x0F, 0xE0, 0xE0, 0x00, 0xE0, 0x70, 0x01, 0xC0, 0x70, 0x01, 0xC0,
+        0x70, 0x01, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x1C, 0x07, 0x00, 0x1C,
+        0x07, 0x00, 0x1C, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x07, 0x1C,
+        0x00, 0x07, 0x1C, 0x00, 0x07, 0x9C, 0x00, 0x03, 0xB8, 0x00, 0x03, 0xB8, 0x00, 0x03, 0xB8, 0x00,
+        0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0xE0, 0x1F, 0x00, 0xE0, 0xE0, 0x1F,
+        0x01, 0xC0, 0x60, 0x3B, 0x81, 0xC0, 0x70, 0x3B, 0x81, 0xC0, 0x70, 0x3B, 0x81, 0xC0, 0x70, 0x73,
+        0x83, 0x80, 0x70, 0x73, 0xC3, 0x80, 0x38, 0x71, 0xC3, 0x80, 0x38, 0x71, 0xC3, 0x80, 0x38, 0xE1,
+        0xC7, 0x00, 0x38, 0xE1, 0xC7, 0x00, 0x38, 0xE1, 0xE7, 0x00, 0x1C, 0xE0, 0xE7, 0x00, 0x1D, 0xC0,
+        0xEE, 0x00, 0x1D, 0xC0, 0xEE, 0x00, 0x1D, 0xC0, 0xEE, 0x00, 0x1D, 0xC0, 0xEE, 0x00, 0x0F, 0x80,
+        0x7C, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x70, 0x01, 0xC0, 0x38, 0x03, 0x80,
+        0x1C, 0x07, 0x00, 0x1E, 0x0F, 0x00, 0x0E, 0x0E, 0x00, 0x07, 0x1C, 0x00, 0x03, 0xB8, 0x00, 0x03,
+        0xB8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xB8,
+        0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x0E, 0x0E, 0x00, 0x1C, 0x07, 0x00, 0x3C, 0x07, 0x80,
+        0x38, 0x03, 0x80, 0x70, 0x01, 0xC0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0x70, 0x01, 0xC0, 0x78,
+        0x01, 0xC0, 0x38, 0x03, 0x80, 0x1C, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x07, 0x1C,
+        0x00, 0x03, 0x9C, 0x00, 0x03, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00,
+        0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+        0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x07,
+        0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x80,
+        0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFC, 0xC0, 0xC0, 0x60,
+        0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x06,
+        0x03, 0x03, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+        0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0x02, 0x00, 0x07,
+        0x00, 0x07, 0x00, 0x0D, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x38, 0x60, 0x30, 0x60, 0x60, 0x30, 0x60,
+        0x30, 0xC0, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x70, 0x38, 0x18, 0x0F, 0xE0, 0x3F,
+        0xF0, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0x00, 0x38, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0x38, 0xF0,
+        0x38, 0xE0, 0x38, 0xE0, 0x78, 0xF0, 0xF8, 0x7F, 0xB8, 0x3E, 0x1C, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE7, 0x80, 0xFF, 0xE0, 0xF8, 0xF0, 0xF0, 0x70, 0xE0,
+        0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x70, 0xF8,
+        0xF0, 0xEF, 0xE0, 0xE7, 0x80, 0x0F, 0x80, 0x3F, 0xC0, 0x78, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x70, 0x70, 0x70, 0x78, 0xE0, 0x3F,
+        0xC0, 0x0F, 0x80, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x0F,
+        0x38, 0x3F, 0xF8, 0x78, 0xF8, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+        0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF8, 0x3F, 0xB8, 0x0F, 0x38, 0x0F, 0x80, 0x3F,
+        0xE0, 0x78, 0xF0, 0x70, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xFF, 0xF8, 0xFF, 0xF8, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF0, 0x3F, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x80, 0x38,
+        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+        0x00, 0x38, 0x00, 0x38, 0x00, 0x0F, 0x38, 0x3F, 0xB8, 0x78, 0xF8, 0x70, 0x78, 0xE0, 0x38, 0xE0,
+        0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF8, 0x3F,
+        0xF8, 0x0F, 0x38, 0x00, 0x38, 0xE0, 0x38, 0xE0, 0x70, 0x70, 0xF0, 0x7F, 0xE0, 0x1F, 0x80, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE7, 0xC0, 0xEF, 0xF0, 0xF8,
+        0x78, 0xF0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+        0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x70,
+        0x70, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+        0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x38, 0xE0, 0xF0, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEE,
+        0x00, 0xFE, 0x00, 0xFF, 0x00, 0xF3, 0x80, 0xE1, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0xE0,
+        0x38, 0xE0, 0x1C, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE7, 0xC3, 0xE0, 0xEF, 0xE7, 0xF0, 0xF8, 0xFC,
+        0x78, 0xF0, 0x78, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38,
+        0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0,
+        0x70, 0x38, 0xE0, 0x70, 0x38, 0xE7, 0xC0, 0xEF, 0xF0, 0xF8, 0x78, 0xF0, 0x38, 0xE0, 0x38, 0xE0,
+        0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+        0x38, 0xE0, 0x38, 0x0F, 0x80, 0x3F, 0xE0, 0x78, 0xF0, 0x70, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+        0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xE0, 0x0F,
+        0x80, 0xE7, 0x80, 0xEF, 0xE0, 0xF8, 0xF0, 0xF0, 0x70, 0xF0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+        0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x70, 0xF8, 0xF0, 0xFF, 0xE0, 0xE7, 0x80, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0F, 0x38, 0x3F, 0xB8, 0x78,
+        0xF8, 0x70, 0x78, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+        0x38, 0x70, 0x78, 0x78, 0xF8, 0x3F, 0xF8, 0x0F, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+        0x38, 0x00, 0x38, 0x00, 0x38, 0xE7, 0x00, 0xEF, 0x80, 0xF9, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+        0x00, 0xE0, 0x00, 0x1F, 0x00, 0x7F, 0xC0, 0xF1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0x00, 0x7E,
+        0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0xF0, 0x7F, 0xE0, 0x1F,
+        0x80, 0x08, 0x38, 0x38, 0x38, 0x38, 0xFE, 0xFE, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+        0x38, 0x38, 0x38, 0x3E, 0x1E, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+        0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0xF8, 0x7F,
+        0xB8, 0x1F, 0x38, 0xE0, 0x0E, 0x70, 0x1C, 0x70, 0x1C, 0x70, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x3C,
+        0x38, 0x1C, 0x70, 0x1C, 0x70, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x07,
+        0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x71, 0xB1, 0xC0, 0x71, 0xB1, 0xC0,
+        0x71, 0xB1, 0xC0, 0x71, 0xB1, 0xC0, 0x73, 0xBB, 0x80, 0x3B, 0x1B, 0x80, 0x3B, 0x1B, 0x80, 0x3B,
+        0x1B, 0x80, 0x3B, 0x1B, 0x80, 0x1E, 0x0F, 0x00, 0x1E, 0x0F, 0x00, 0x1E, 0x0F, 0x00, 0xE0, 0x1C,
+        0x70, 0x38, 0x38, 0x70, 0x1C, 0xE0, 0x1C, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+        0x0F, 0xC0, 0x1C, 0xE0, 0x1C, 0xE0, 0x38, 0x70, 0x70, 0x38, 0xE0, 0x1C, 0xE0, 0x0E, 0xE0, 0x1C,
+        0x70, 0x1C, 0x70, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x1C, 0x70, 0x1C, 0x70, 0x1E, 0x60, 0x0E, 0xE0,
+        0x0E, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00,
+        0x0E, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+        0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00,
+        0xFF, 0xF8, 0xFF, 0xF8, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60,
+        0xC0, 0xC0, 0x60, 0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0C, 0x06, 0xC0, 0xC0,
+        0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+        0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60,
+        0x60, 0x60, 0x70, 0x30, 0x18, 0x18, 0x30, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0,
+        0x80, 0x7E, 0x04, 0xFF, 0xFC, 0xFF, 0xFC, 0x81, 0xF8,
+};
+
+const AtlasGlyph Arial28x28_atlas_glyphs[] = {
+        {     0, 15,  0,  0,  0,  0 },  // Code for char 0x20
+        {     0,  5,  2,  1,  3, 21 },  // Code for char !
+        {    21,  9,  1,  1,  8,  7 },  // Code for char "
+        {    28, 15,  0,  1, 15, 21 },  // Code for char #
+        {    70, 15,  1,  0, 14, 25 },  // Code for char $
+        {   120, 24,  2,  1, 22, 22 },  // Code for char %
+        {   186, 19,  1,  1, 18, 21 },  // Code for char &
+        {   249,  4,  1,  1,  3,  7 },  // Code for char '
+        {   256, 20, 13,  1,  7, 26 },  // Code for char (
+        {   282,  5,  0,  2,  5, 24 },  // Code for char )
+        {   306, 10,  0,  1, 10,  9 },  // Code for char *
+        {   324, 15,  1,  5, 14, 14 },  // Code for char +
+        {   352,  5,  2, 19,  3,  7 },  // Code for char ,
+        {   359,  9,  1, 13,  8,  3 },  // Code for char -
+        {   362,  5,  2, 19,  3,  3 },  // Code for char .
+        {   365,  8,  0,  1,  8, 21 },  // Code for char /
+        {   386, 15,  1,  1, 13, 21 },  // Code for char 0
+        {   428, 15,  2,  1,  8, 21 },  // Code for char 1
+        {   449, 15,  1,  1, 13, 21 },  // Code for char 2
+        {   491, 15,  1,  1, 13, 21 },  // Code for char 3
+        {   533, 15,  0,  1, 15, 21 },  // Code for char 4
+        {   575, 15,  1,  1, 13, 21 },  // Code for char 5
+        {   617, 15,  1,  1, 13, 21 },  // Code for char 6
+        {   659, 15,  1,  1, 13, 21 },  // Code for char 7
+        {   701, 15,  1,  1, 13, 21 },  // Code for char 8
+        {   743, 15,  1,  1, 13, 21 },  // Code for char 9
+        {   785,  5,  2,  7,  3, 15 },  // Code for char :
+        {   800,  5,  2,  7,  3, 19 },  // Code for char ;
+        {   819, 15,  1,  4, 14, 15 },  // Code for char <
+        {   849, 15,  1,  7, 14,  9 },  // Code for char =
+        {   867, 15,  1,  4, 14, 14 },  // Code for char >
+        {   895, 14,  1,  1, 13, 21 },  // Code for char ?
+        {   937, 28,  2,  1, 26, 27 },  // Code for char @
+        {  1045, 19,  0,  1, 19, 21 },  // Code for char A
+        {  1108, 17,  2,  1, 15, 21 },  // Code for char B
+        {  1150, 19,  1,  1, 18, 21 },  // Code for char C
+        {  1213, 19,  2,  1, 17, 21 },  // Code for char D
+        {  1276, 17,  2,  1, 15, 21 },  // Code for char E
+        {  1318, 16,  2,  1, 14, 21 },  // Code for char F
+        {  1360, 21,  1,  1, 20, 21 },  // Code for char G
+        {  1423, 18,  2,  1, 16, 21 },  // Code for char H
+        {  1465,  5,  2,  1,  3, 21 },  // Code for char I
+        {  1486, 12,  1,  1, 11, 21 },  // Code for char J
+        {  1528, 19,  2,  1, 17, 21 },  // Code for char K
+        {  1591, 15,  2,  1, 13, 21 },  // Code for char L
+        {  1633, 21,  2,  1, 19, 21 },  // Code for char M
+        {  1696, 18,  2,  1, 16, 21 },  // Code for char N
+        {  1738, 21,  1,  1, 20, 21 },  // Code for char O
+        {  1801, 17,  2,  1, 15, 21 },  // Code for char P
+        {  1843, 21,  1,  1, 20, 22 },  // Code for char Q
+        {  1909, 21,  2,  1, 19, 21 },  // Code for char R
+        {  1972, 17,  1,  1, 16, 21 },  // Code for char S
+        {  2014, 17,  0,  1, 17, 21 },  // Code for char T
+        {  2077, 18,  2,  1, 16, 21 },  // Code for char U
+        {  2119, 19,  0,  1, 19, 21 },  // Code for char V
+        {  2182, 27,  0,  1, 27, 21 },  // Code for char W
+        {  2266, 19,  0,  1, 19, 21 },  // Code for char X
+        {  2329, 19,  0,  1, 19, 21 },  // Code for char Y
+        {  2392, 17,  1,  1, 16, 21 },  // Code for char Z
+        {  2434,  7,  1,  1,  6, 27 },  // Code for char [
+        {  2461,  8,  0,  1,  8, 21 },  // Code for char 0x5C
+        {  2482,  6,  0,  1,  6, 27 },  // Code for char ]
+        {  2509, 14,  1,  1, 13, 11 },  // Code for char ^
+        {  2531, 24,  0, 26, 24,  2 },  // Code for char _
+        {  2537,  6,  1,  1,  5,  4 },  // Code for char `
+        {  2541, 15,  1,  7, 14, 15 },  // Code for char a
+        {  2571, 14,  1,  1, 13, 21 },  // Code for char b
+        {  2613, 13,  1,  7, 12, 15 },  // Code for char c
+        {  2643, 14,  1,  1, 13, 21 },  // Code for char d
+        {  2685, 14,  1,  7, 13, 15 },  // Code for char e
+        {  2715,  9,  0,  1,  9, 21 },  // Code for char f
+        {  2757, 14,  1,  7, 13, 21 },  // Code for char g
+        {  2799, 14,  1,  1, 13, 21 },  // Code for char h
+        {  2841,  4,  1,  1,  3, 21 },  // Code for char i
+        {  2862,  4,  0,  1,  4, 27 },  // Code for char j
+        {  2889, 15,  1,  1, 14, 21 },  // Code for char k
+        {  2931,  4,  1,  1,  3, 21 },  // Code for char l
+        {  2952, 22,  1,  7, 21, 15 },  // Code for char m
+        {  2997, 14,  1,  7, 13, 15 },  // Code for char n
+        {  3027, 14,  1,  7, 13, 15 },  // Code for char o
+        {  3057, 14,  1,  7, 13, 21 },  // Code for char p
+        {  3099, 14,  1,  7, 13, 21 },  // Code for char q
+        {  3141, 10,  1,  7,  9, 15 },  // Code for char r
+        {  3171, 13,  1,  7, 12, 15 },  // Code for char s
+        {  3201,  7,  0,  2,  7, 20 },  // Code for char t
+        {  3221, 14,  1,  7, 13, 15 },  // Code for char u
+        {  3251, 15,  0,  7, 15, 15 },  // Code for char v
+        {  3281, 20,  1,  7, 19, 15 },  // Code for char w
+        {  3326, 14,  0,  7, 14, 15 },  // Code for char x
+        {  3356, 15,  0,  7, 15, 21 },  // Code for char y
+        {  3398, 14,  1,  7, 13, 15 },  // Code for char z
+        {  3428, 20, 13,  1,  7, 26 },  // Code for char {
+        {  3454,  5,  3,  1,  2, 27 },  // Code for char |
+        {  3481,  5,  0,  2,  5, 24 },  // Code for char }
+        {  3505, 15,  1, 10, 14,  4 },  // Code for char ~
+        {  3513,  1,  0,  0,  0,  0 },  // Code for char 0x7F
+};
+
+/** Arial28x28 as row-major glyph atlas, see GlyphAtlas.h */
+const GlyphAtlas Arial28x28_atlas = { 0x20, 96, 28, 28, Arial28x28_atlas_glyphs, Arial28x28_atlas_bitmap };
+
+#endif
@@ -0,0 +1,482 @@
+//Glyph atlas of font_big.h generated by host/fontconv, do not edit
+//Cell 42 x 35, 96 characters from 0x20, 5887 bitmap bytes
+
+#ifndef NEU42X35_ATLAS_H
+#define NEU42X35_ATLAS_H
+
+#include "GlyphAtlas.h"
+
+const uint8_t Neu42x35_atlas_bitmap[] = {
+        0x30, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+        0x30, 0x00, 0x70, 0xF8, 0xF8, 0x70, 0x39, 0xC0, 0x7B, 0xC0, 0x7B, 0xC0, 0x7B, 0xC0, 0xFB, 0xC0,
+        0xF7, 0x80, 0xF7, 0x80, 0xE7, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x3C, 0x78, 0x00, 0x00, 0x7C,
+        0x78, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
+        0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x03, 0xC3,
+        0xC0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
+        0xFC, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x1E, 0x00, 0x00, 0x1E, 0x3E,
+        0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3C,
+        0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+        0xC0, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x3C,
+        0x00, 0x00, 0xF8, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
+        0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3C, 0x0F, 0x80, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x3C,
+        0x07, 0x80, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x3C, 0x0F, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+        0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x18,
+        0x00, 0x00, 0x1F, 0xF8, 0x00, 0x78, 0x00, 0x7F, 0xFE, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0x01, 0xF0,
+        0x00, 0xFF, 0xFF, 0x07, 0xE0, 0x00, 0xF8, 0x1F, 0x0F, 0xC0, 0x00, 0xF0, 0x0F, 0x1F, 0x80, 0x00,
+        0xF8, 0x1F, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
+        0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F,
+        0xCF, 0xFC, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0x7F, 0xFF, 0x80, 0x00, 0x7E, 0x7F,
+        0xFF, 0x80, 0x00, 0xFC, 0x7C, 0x07, 0x80, 0x01, 0xF8, 0x78, 0x07, 0x80, 0x03, 0xF0, 0x7C, 0x0F,
+        0x80, 0x07, 0xE0, 0x7F, 0xFF, 0x80, 0x0F, 0xC0, 0x7F, 0xFF, 0x00, 0x07, 0x80, 0x3F, 0xFE, 0x00,
+        0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8,
+        0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C,
+        0x00, 0x1E, 0x00, 0x7C, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0x07, 0xDF, 0xE0, 0x00, 0x07, 0xFF, 0x80,
+        0xC0, 0x3F, 0xFE, 0x01, 0xE0, 0x7F, 0x3F, 0x81, 0xE0, 0xFC, 0x0F, 0xC1, 0xE0, 0xF0, 0x03, 0xF1,
+        0xE0, 0xF0, 0x00, 0xFD, 0xE0, 0xF0, 0x00, 0x7F, 0xE0, 0xF8, 0x00, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF,
+        0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x70, 0x38, 0x78, 0x78,
+        0x78, 0xF8, 0xF0, 0xF0, 0xE0, 0x0E, 0x1F, 0x3E, 0x7C, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0E, 0x70, 0xF8, 0x7C, 0x3E, 0x1F,
+        0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x3E, 0x7C, 0xF8,
+        0x70, 0x01, 0x80, 0x63, 0xC6, 0xF3, 0xCF, 0xFB, 0xDF, 0x7F, 0xFE, 0x3F, 0xFC, 0x3F, 0xFC, 0x7F,
+        0xFE, 0xFB, 0xDF, 0xF3, 0xCF, 0x63, 0xC6, 0x01, 0x80, 0x03, 0x00, 0x07, 0x80, 0x07, 0x80, 0x7F,
+        0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0x7F, 0xF8, 0x07, 0x80, 0x07, 0x80, 0x03, 0x00, 0x38, 0x78, 0x78,
+        0x78, 0xF0, 0xF0, 0xF0, 0xE0, 0x7F, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFC, 0x70, 0xF8, 0xF8,
+        0x70, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E,
+        0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xE0,
+        0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00,
+        0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00,
+        0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+        0x00, 0xF8, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
+        0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x03,
+        0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03,
+        0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03,
+        0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xFC, 0x00, 0x07,
+        0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF8,
+        0x00, 0x7C, 0xFE, 0xFE, 0x7E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+        0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x0C, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
+        0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x3F,
+        0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0,
+        0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+        0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
+        0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+        0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
+        0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+        0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0x60, 0x00, 0x00, 0x18, 0xF0, 0x00, 0x00, 0x3C, 0xF0,
+        0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0,
+        0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0,
+        0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+        0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00,
+        0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x7F,
+        0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xF0,
+        0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
+        0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00,
+        0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+        0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F,
+        0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+        0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+        0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x01, 0xF8, 0xF0, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x78, 0xF0,
+        0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x78, 0xFC, 0x00, 0x01, 0xF8, 0x7F,
+        0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x7F,
+        0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
+        0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
+        0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x01, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+        0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+        0xF8, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F,
+        0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0,
+        0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F,
+        0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0xF8, 0x00, 0x03, 0xF0, 0xF0,
+        0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x03, 0xF0, 0xFF,
+        0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x07,
+        0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xE0, 0xF8,
+        0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0,
+        0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
+        0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+        0x07, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x60, 0xF0, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60,
+        0xF0, 0xF0, 0x60, 0x3C, 0x7C, 0x7C, 0x38, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
+        0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+        0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0x80, 0x7F, 0xFE, 0xFF, 0xFE,
+        0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFC, 0xE0, 0x00,
+        0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00,
+        0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
+        0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF,
+        0x80, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0,
+        0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x7F,
+        0xF8, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+        0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC,
+        0xF8, 0x00, 0x3E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xF0, 0x7E, 0x1E, 0xF0, 0x7F, 0x1E, 0xF0,
+        0x03, 0x9E, 0xF1, 0xFF, 0x9E, 0xF3, 0xFF, 0x9E, 0xF7, 0x03, 0x9E, 0xF7, 0x03, 0x9E, 0xF7, 0x03,
+        0x9E, 0xF7, 0x03, 0x9E, 0xF3, 0xFF, 0xFE, 0xF0, 0xFF, 0xFC, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x78, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0,
+        0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x3E, 0x78,
+        0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0xF8, 0x1E, 0x00, 0x00, 0xF0, 0x1F,
+        0x00, 0x01, 0xE0, 0x0F, 0x80, 0x03, 0xE0, 0x07, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xFF, 0xFF,
+        0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x00,
+        0x78, 0x3C, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1E, 0x70, 0x00, 0x00,
+        0x0C, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+        0xE0, 0xF0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+        0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+        0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
+        0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
+        0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
+        0x00, 0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+        0xF0, 0xF0, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+        0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+        0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+        0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+        0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
+        0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+        0x00, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+        0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+        0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1F,
+        0xC0, 0xF0, 0x00, 0x3F, 0xE0, 0xF0, 0x00, 0x3F, 0xE0, 0xF0, 0x00, 0x1F, 0xE0, 0xF0, 0x00, 0x01,
+        0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF8, 0x00, 0x07,
+        0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC,
+        0x00, 0x60, 0x00, 0x00, 0x60, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
+        0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0x60, 0x00, 0x00, 0x60, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0x00,
+        0x60, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+        0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+        0xF0, 0x03, 0xF0, 0x7F, 0xE0, 0xFF, 0xE0, 0xFF, 0x80, 0x7E, 0x00, 0x60, 0x00, 0x1E, 0x00, 0xF0,
+        0x00, 0x7F, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0xF0,
+        0x3F, 0xC0, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF3, 0xFC, 0x00, 0x00, 0xF7, 0xF0, 0x00, 0x00, 0xFF,
+        0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xF7,
+        0xF8, 0x00, 0x00, 0xF1, 0xFE, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xF0, 0x1F, 0xC0, 0x00, 0xF0,
+        0x07, 0xF0, 0x00, 0xF0, 0x03, 0xFC, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0x3F, 0x80, 0x60,
+        0x00, 0x0F, 0x00, 0x60, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+        0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+        0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+        0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+        0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
+        0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x70, 0x00, 0x00, 0x00, 0x38,
+        0xF8, 0x00, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0xFF,
+        0x00, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0xF7, 0xC0,
+        0x00, 0x0F, 0xBC, 0xF3, 0xE0, 0x00, 0x1F, 0x3C, 0xF1, 0xF0, 0x00, 0x3E, 0x3C, 0xF0, 0xF8, 0x00,
+        0x7C, 0x3C, 0xF0, 0x7C, 0x00, 0xFC, 0x3C, 0xF0, 0x7E, 0x00, 0xF8, 0x3C, 0xF0, 0x3F, 0x01, 0xF0,
+        0x3C, 0xF0, 0x1F, 0x03, 0xE0, 0x3C, 0xF0, 0x0F, 0x87, 0xC0, 0x3C, 0xF0, 0x07, 0xCF, 0x80, 0x3C,
+        0xF0, 0x03, 0xFF, 0x80, 0x3C, 0xF0, 0x03, 0xFF, 0x00, 0x3C, 0xF0, 0x01, 0xFE, 0x00, 0x3C, 0xF0,
+        0x00, 0xFC, 0x00, 0x3C, 0x60, 0x00, 0x78, 0x00, 0x18, 0x70, 0x00, 0x00, 0x60, 0xF8, 0x00, 0x00,
+        0xF0, 0xFE, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x80, 0x00, 0xF0, 0xFF, 0xC0, 0x00,
+        0xF0, 0xF3, 0xE0, 0x00, 0xF0, 0xF1, 0xF8, 0x00, 0xF0, 0xF0, 0xFC, 0x00, 0xF0, 0xF0, 0x7E, 0x00,
+        0xF0, 0xF0, 0x3F, 0x00, 0xF0, 0xF0, 0x0F, 0xC0, 0xF0, 0xF0, 0x07, 0xE0, 0xF0, 0xF0, 0x03, 0xF0,
+        0xF0, 0xF0, 0x01, 0xF8, 0xF0, 0xF0, 0x00, 0x7E, 0xF0, 0xF0, 0x00, 0x3F, 0xF0, 0xF0, 0x00, 0x1F,
+        0xF0, 0xF0, 0x00, 0x0F, 0xF0, 0xF0, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x01, 0xF0, 0x60, 0x00, 0x00,
+        0xE0, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+        0xE0, 0xFC, 0x00, 0x07, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01,
+        0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01,
+        0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01,
+        0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xFC, 0x00, 0x07, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+        0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
+        0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x01,
+        0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01,
+        0xE0, 0xF0, 0x00, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+        0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
+        0x00, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+        0xF0, 0xFC, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x03, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
+        0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
+        0xE0, 0x00, 0x00, 0x01, 0xC0, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+        0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01,
+        0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x03, 0xE0, 0xFF, 0xFF, 0xFF,
+        0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0xF7, 0xF8, 0x00,
+        0x00, 0xF1, 0xFE, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0xF0, 0x03, 0xFE,
+        0x00, 0xF0, 0x00, 0x7F, 0x80, 0xF0, 0x00, 0x1F, 0xC0, 0x60, 0x00, 0x07, 0x80, 0x0F, 0xF0, 0x00,
+        0x3F, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+        0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF,
+        0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+        0x00, 0x00, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x7F,
+        0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+        0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+        0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+        0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x18,
+        0x00, 0x60, 0x00, 0x00, 0x60, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+        0xF0, 0xF8, 0x00, 0x01, 0xF0, 0xFC, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
+        0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x70, 0x00, 0x00, 0x0E, 0xF8, 0x00, 0x00,
+        0x1F, 0x78, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00,
+        0x78, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0xC0, 0x03,
+        0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x78, 0x1F,
+        0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00, 0x1F, 0xF8,
+        0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xC0,
+        0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0x80, 0xF8, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x3F,
+        0x00, 0x07, 0xC0, 0x7C, 0x00, 0x3F, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x7F, 0x80, 0x0F, 0x80, 0x3C,
+        0x00, 0x7F, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0xFB, 0xC0, 0x1F, 0x00, 0x1E, 0x00, 0xF3, 0xC0, 0x1E,
+        0x00, 0x0F, 0x00, 0xF1, 0xE0, 0x3E, 0x00, 0x0F, 0x01, 0xE1, 0xE0, 0x3C, 0x00, 0x07, 0x81, 0xE1,
+        0xF0, 0x7C, 0x00, 0x07, 0x83, 0xC0, 0xF0, 0x78, 0x00, 0x07, 0xC3, 0xC0, 0xF8, 0x78, 0x00, 0x03,
+        0xC7, 0xC0, 0x78, 0xF0, 0x00, 0x03, 0xE7, 0x80, 0x7C, 0xF0, 0x00, 0x01, 0xEF, 0x80, 0x3D, 0xE0,
+        0x00, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
+        0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x00,
+        0x38, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x7C, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x07,
+        0xE0, 0x1F, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x80, 0x07, 0xE0, 0x3E, 0x00, 0x03, 0xF0, 0x7C,
+        0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xC0,
+        0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFD, 0xF0, 0x00, 0x01, 0xF8, 0xF8,
+        0x00, 0x03, 0xF0, 0x7C, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x3F, 0x00, 0x07,
+        0xC0, 0x7E, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x01, 0xF0, 0x70, 0x00, 0x00, 0xF0, 0x60, 0x00, 0x01,
+        0xC0, 0xF8, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x3F,
+        0x00, 0x1F, 0x80, 0x7E, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x03, 0xF3, 0xF0,
+        0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00,
+        0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00,
+        0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00,
+        0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+        0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0,
+        0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7E, 0x00,
+        0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00,
+        0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+        0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x00, 0x7E, 0xFF, 0xFF,
+        0xFE, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE,
+        0xFF, 0xFF, 0x7E, 0x70, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
+        0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC,
+        0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0,
+        0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
+        0x00, 0x0F, 0x00, 0x00, 0x06, 0x7E, 0xFF, 0xFF, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x7F, 0xFF, 0xFF, 0x7E, 0x06, 0x00, 0x0F, 0x00, 0x1F,
+        0x80, 0x39, 0xC0, 0x70, 0xE0, 0xE0, 0x70, 0xC0, 0x30, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+        0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x06,
+        0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0,
+        0x00, 0x00, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0,
+        0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0,
+        0xF0, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80,
+        0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE,
+        0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+        0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
+        0xFF, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
+        0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+        0xFF, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+        0x0F, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
+        0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+        0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF,
+        0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE,
+        0xF8, 0x00, 0x7E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xFF, 0xFF, 0xFE, 0xFF,
+        0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xF0,
+        0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0,
+        0xFF, 0xC0, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00,
+        0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+        0xF0, 0x00, 0xF0, 0x00, 0x60, 0x00, 0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFE, 0xFF,
+        0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+        0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+        0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0xFF, 0x00,
+        0x1F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xE0, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE,
+        0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+        0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+        0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60, 0x00, 0x06, 0x70, 0xF8, 0xF8, 0x70, 0x00, 0x30,
+        0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x30,
+        0x00, 0xE0, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF0, 0x00, 0xF0,
+        0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+        0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x7F, 0xF0, 0xFF, 0xE0,
+        0xFF, 0xC0, 0x7F, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+        0xF0, 0x00, 0x00, 0xF0, 0x00, 0xE0, 0xF0, 0x03, 0xF0, 0xF0, 0x0F, 0xE0, 0xF0, 0x3F, 0x80, 0xF0,
+        0xFE, 0x00, 0xF3, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0,
+        0x00, 0xFF, 0xF0, 0x00, 0xF3, 0xFC, 0x00, 0xF0, 0xFF, 0x00, 0xF0, 0x3F, 0xC0, 0xF0, 0x0F, 0xF0,
+        0xF0, 0x03, 0xF0, 0x60, 0x00, 0xE0, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0x0F, 0xFE, 0x3F, 0xF8,
+        0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+        0xF8, 0x03, 0xF0, 0x0F, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0,
+        0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01,
+        0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0,
+        0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07,
+        0x80, 0x60, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0xFF,
+        0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+        0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+        0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60, 0x00, 0x06, 0x07, 0xFF, 0xF0, 0x1F,
+        0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+        0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+        0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x07,
+        0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+        0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+        0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+        0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x7F,
+        0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0,
+        0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0,
+        0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF8, 0x00, 0x07, 0x80, 0xFF,
+        0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
+        0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00,
+        0x00, 0x07, 0x80, 0x07, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0xFF, 0xC0, 0xF8, 0x00, 0xF0, 0x00, 0xF0,
+        0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+        0x00, 0xF0, 0x00, 0xF0, 0x00, 0x60, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF8, 0x00,
+        0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x7F,
+        0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,
+        0xF8, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0x0C, 0x00, 0x1E,
+        0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x7F, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0x7F, 0xF8, 0x1E,
+        0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+        0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x60, 0x00, 0x03, 0x00, 0xF0, 0x00, 0x07,
+        0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07,
+        0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07,
+        0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF8, 0x00, 0x0F, 0x80, 0xFF, 0xFF, 0xFF,
+        0x80, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x70, 0x00, 0x00,
+        0x70, 0xF8, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x03,
+        0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x1F, 0x00, 0x03, 0xE0, 0x3E,
+        0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7D, 0xF0,
+        0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0x80,
+        0x00, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0xC0, 0x01, 0xC0, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0xF0,
+        0x01, 0xF0, 0x03, 0xC0, 0x78, 0x03, 0xF0, 0x03, 0xC0, 0x78, 0x07, 0xF8, 0x07, 0x80, 0x3C, 0x07,
+        0xFC, 0x07, 0x80, 0x3C, 0x0F, 0xBC, 0x0F, 0x00, 0x1E, 0x0F, 0x3E, 0x1F, 0x00, 0x1E, 0x1E, 0x1E,
+        0x1E, 0x00, 0x0F, 0x1E, 0x1F, 0x3E, 0x00, 0x0F, 0x3C, 0x0F, 0x3C, 0x00, 0x07, 0xBC, 0x07, 0xFC,
+        0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
+        0x01, 0xF0, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x0E, 0xF8, 0x00, 0x3F,
+        0x7C, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0x83, 0xF0, 0x07, 0xC7, 0xE0, 0x03, 0xFF, 0x80, 0x01,
+        0xFF, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xC7, 0xE0, 0x1F, 0x81,
+        0xF0, 0x3F, 0x00, 0xFC, 0x7C, 0x00, 0x7E, 0xF8, 0x00, 0x1F, 0x60, 0x00, 0x0E, 0x60, 0x00, 0x03,
+        0x00, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07,
+        0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07,
+        0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF8, 0x00, 0x07,
+        0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
+        0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFE,
+        0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x7F,
+        0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00,
+        0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80,
+        0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x38, 0x00,
+        0x38, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+        0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xC0,
+        0x0F, 0x80, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0x7C,
+        0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+        0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x07,
+        0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+        0x00, 0x3F, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+        0x00, 0x7F, 0xFE, 0x00, 0xC0, 0xFF, 0xFE, 0x01, 0xE0, 0xF0, 0x1E, 0x01, 0xE0, 0xF0, 0x0F, 0x01,
+        0xE0, 0xF0, 0x0F, 0x01, 0xE0, 0xF0, 0x0F, 0xFF, 0xE0, 0x60, 0x0F, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
+        0x80, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xFC, 0xFF, 0xFE, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0,
+        0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0,
+        0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0,
+        0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xFF, 0xFE, 0x7F, 0xFC,
+};
+
+const AtlasGlyph Neu42x35_atlas_glyphs[] = {
+        {     0, 22,  0,  0,  0,  0 },  // Code for char 0x20
+        {     0,  6,  1,  7,  5, 22 },  // Code for char !
+        {    22, 11,  1,  7, 10,  8 },  // Code for char "
+        {    38, 26,  1,  8, 25, 21 },  // Code for char #
+        {   122, 26,  1,  5, 25, 26 },  // Code for char $
+        {   226, 34,  1,  7, 33, 23 },  // Code for char %
+        {   341, 30,  1,  7, 29, 22 },  // Code for char &
+        {   429,  6,  1,  7,  5,  8 },  // Code for char '
+        {   437,  9,  1,  7,  8, 22 },  // Code for char (
+        {   459,  9,  1,  7,  8, 22 },  // Code for char )
+        {   481, 18,  2, 10, 16, 12 },  // Code for char *
+        {   505, 14,  0, 13, 14, 10 },  // Code for char +
+        {   525,  6,  1, 24,  5,  8 },  // Code for char ,
+        {   533, 16,  1, 18, 15,  4 },  // Code for char -
+        {   541,  6,  1, 25,  5,  4 },  // Code for char .
+        {   545, 25,  0,  7, 25, 22 },  // Code for char /
+        {   633, 28,  2,  7, 26, 22 },  // Code for char 0
+        {   721, 10,  3,  7,  7, 22 },  // Code for char 1
+        {   743, 29,  1,  7, 28, 22 },  // Code for char 2
+        {   831, 30,  2,  7, 28, 22 },  // Code for char 3
+        {   919, 31,  1,  7, 30, 22 },  // Code for char 4
+        {  1007, 29,  1,  7, 28, 22 },  // Code for char 5
+        {  1095, 30,  1,  7, 29, 22 },  // Code for char 6
+        {  1183, 29,  1,  7, 28, 22 },  // Code for char 7
+        {  1271, 29,  1,  7, 28, 22 },  // Code for char 8
+        {  1359, 29,  1,  7, 28, 22 },  // Code for char 9
+        {  1447,  5,  1, 17,  4, 12 },  // Code for char :
+        {  1459,  7,  1, 17,  6, 15 },  // Code for char ;
+        {  1474, 18,  1, 11, 17, 14 },  // Code for char <
+        {  1516, 16,  1, 15, 15,  9 },  // Code for char =
+        {  1534, 18,  1, 11, 17, 14 },  // Code for char >
+        {  1576, 19,  1,  7, 18, 22 },  // Code for char ?
+        {  1642, 24,  1,  6, 23, 21 },  // Code for char @
+        {  1705, 31,  0,  7, 31, 22 },  // Code for char A
+        {  1793, 29,  1,  7, 28, 22 },  // Code for char B
+        {  1881, 26,  1,  7, 25, 22 },  // Code for char C
+        {  1969, 29,  1,  7, 28, 22 },  // Code for char D
+        {  2057, 26,  1,  7, 25, 22 },  // Code for char E
+        {  2145, 26,  1,  7, 25, 22 },  // Code for char F
+        {  2233, 28,  1,  7, 27, 22 },  // Code for char G
+        {  2321, 29,  1,  7, 28, 22 },  // Code for char H
+        {  2409,  5,  1,  7,  4, 22 },  // Code for char I
+        {  2431, 13,  1,  7, 12, 22 },  // Code for char J
+        {  2475, 26,  1,  7, 25, 22 },  // Code for char K
+        {  2563, 26,  1,  7, 25, 22 },  // Code for char L
+        {  2651, 39,  1,  7, 38, 22 },  // Code for char M
+        {  2761, 29,  1,  7, 28, 22 },  // Code for char N
+        {  2849, 28,  1,  7, 27, 22 },  // Code for char O
+        {  2937, 28,  1,  7, 27, 22 },  // Code for char P
+        {  3025, 29,  1,  7, 28, 25 },  // Code for char Q
+        {  3125, 28,  1,  7, 27, 22 },  // Code for char R
+        {  3213, 25,  1,  7, 24, 22 },  // Code for char S
+        {  3279, 25,  1,  7, 24, 22 },  // Code for char T
+        {  3345, 29,  1,  7, 28, 22 },  // Code for char U
+        {  3433, 32,  0,  7, 32, 22 },  // Code for char V
+        {  3521, 42,  0,  7, 42, 22 },  // Code for char W
+        {  3653, 28,  0,  7, 28, 22 },  // Code for char X
+        {  3741, 28,  1,  7, 27, 22 },  // Code for char Y
+        {  3829, 26,  1,  7, 25, 22 },  // Code for char Z
+        {  3917,  9,  1,  7,  8, 22 },  // Code for char [
+        {  3939, 24,  0,  7, 24, 22 },  // Code for char 0x5C
+        {  4005,  9,  1,  7,  8, 22 },  // Code for char ]
+        {  4027, 13,  1,  3, 12,  7 },  // Code for char ^
+        {  4041, 27,  0, 31, 27,  4 },  // Code for char _
+        {  4057, 10,  3,  4,  7,  7 },  // Code for char `
+        {  4064, 27,  1, 11, 26, 18 },  // Code for char a
+        {  4136, 25,  1,  7, 24, 22 },  // Code for char b
+        {  4202, 26,  1, 11, 25, 18 },  // Code for char c
+        {  4274, 26,  2,  7, 24, 22 },  // Code for char d
+        {  4340, 24,  1, 11, 23, 18 },  // Code for char e
+        {  4394, 12,  1,  7, 11, 22 },  // Code for char f
+        {  4438, 25,  1, 12, 24, 22 },  // Code for char g
+        {  4504, 26,  2,  7, 24, 22 },  // Code for char h
+        {  4570,  6,  1,  7,  5, 22 },  // Code for char i
+        {  4592, 12,  0,  7, 12, 26 },  // Code for char j
+        {  4644, 21,  1,  7, 20, 22 },  // Code for char k
+        {  4710,  5,  1,  7,  4, 22 },  // Code for char l
+        {  4732, 34,  1, 11, 33, 18 },  // Code for char m
+        {  4822, 25,  1, 11, 24, 18 },  // Code for char n
+        {  4876, 25,  1, 11, 24, 18 },  // Code for char o
+        {  4930, 25,  1, 11, 24, 23 },  // Code for char p
+        {  4999, 26,  1, 11, 25, 23 },  // Code for char q
+        {  5091, 12,  1, 11, 11, 18 },  // Code for char r
+        {  5127, 22,  1, 11, 21, 18 },  // Code for char s
+        {  5181, 14,  0,  7, 14, 22 },  // Code for char t
+        {  5225, 26,  1, 12, 25, 17 },  // Code for char u
+        {  5293, 29,  0, 12, 29, 18 },  // Code for char v
+        {  5365, 36,  1, 12, 35, 17 },  // Code for char w
+        {  5450, 25,  1, 12, 24, 17 },  // Code for char x
+        {  5501, 26,  1, 12, 25, 22 },  // Code for char y
+        {  5589, 25,  1, 12, 24, 17 },  // Code for char z
+        {  5640, 11,  1,  3, 10, 29 },  // Code for char {
+        {  5698,  5,  1,  5,  4, 29 },  // Code for char |
+        {  5727, 11,  1,  3, 10, 29 },  // Code for char }
+        {  5785, 28,  1,  9, 27, 11 },  // Code for char ~
+        {  5829, 17,  2,  0, 15, 29 },  // Code for char 0x7F
+};
+
+/** Neu42x35 as row-major glyph atlas, see GlyphAtlas.h */
+const GlyphAtlas Neu42x35_atlas = { 0x20, 96, 42, 35, Neu42x35_atlas_glyphs, Neu42x35_atlas_bitmap };
+
+#endif
@@ -5,6 +5,9 @@
 //GLCD FontName : Neu42x35
 //GLCD FontSize : 42 x 35
 
+#ifndef FONT_BIG_H
+#define FONT_BIG_H
+
 /** big font 42*35 pixel matrix for use with the SPI_TFT lib
 */
 const unsigned char Neu42x35[] = {
@@ -109,3 +112,5 @@ const unsigned char Neu42x35[] = {
         
         
         
+
+#endif
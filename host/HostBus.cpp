@@ -0,0 +1,106 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include "HostBus.h"
+
+HostBus &HostBus::instance()
+{
+    static HostBus bus;
+    return bus;
+}
+
+HostBus::HostBus() : _hz(1000000), _now(0)
+{
+    for (int i = 0; i < 64; i++) {
+        _pins[i] = 0;
+    }
+    reset_stats();
+}
+
+void HostBus::attach(HostDevice *dev)
+{
+    _devices.push_back(dev);
+}
+
+void HostBus::detach(HostDevice *dev)
+{
+    _devices.erase(std::remove(_devices.begin(), _devices.end(), dev), _devices.end());
+}
+
+void HostBus::pin_write(PinName pin, int value)
+{
+    if ((pin < 0) || (pin >= 64)) {
+        return;
+    }
+    value = value ? 1 : 0;
+    if (_pins[pin] == value) {
+        return;
+    }
+    _pins[pin] = value;
+    for (size_t i = 0; i < _devices.size(); i++) {
+        _devices[i]->pin_changed(pin, value);
+    }
+}
+
+int HostBus::pin_read(PinName pin) const
+{
+    if ((pin < 0) || (pin >= 64)) {
+        return 0;
+    }
+    return _pins[pin];
+}
+
+void HostBus::spi_frequency(int hz)
+{
+    if (hz > 0) {
+        _hz = hz;
+    }
+}
+
+int HostBus::spi_hz() const
+{
+    return _hz;
+}
+
+uint8_t HostBus::spi_transfer(uint8_t out)
+{
+    int in = 0xFF;
+    for (size_t i = 0; i < _devices.size(); i++) {
+        int r = _devices[i]->spi_transfer(out);
+        if (r >= 0) {
+            in = r;
+        }
+    }
+    _stats.spi_bytes++;
+    _now += 8000000000ULL / (uint64_t)_hz;
+    return (uint8_t)in;
+}
+
+void HostBus::spi_transaction()
+{
+    _stats.spi_transactions++;
+}
+
+const HostBus::Stats &HostBus::stats() const
+{
+    return _stats;
+}
+
+void HostBus::reset_stats()
+{
+    _stats.spi_transactions = 0;
+    _stats.spi_bytes = 0;
+}
+
+void HostBus::advance(uint64_t ns)
+{
+    _now += ns;
+}
+
+uint64_t HostBus::now_ns() const
+{
+    return _now;
+}
@@ -0,0 +1,119 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host side wiring between the SPI / DigitalOut stand-ins and the
+ * simulated devices. The bus keeps the pin levels, forwards every pin
+ * change and every SPI byte to the attached devices and runs a virtual
+ * clock so bus time and sleep_for() delays can be accounted for.
+ */
+
+#ifndef HOST_HOSTBUS_H
+#define HOST_HOSTBUS_H
+
+#include <stdint.h>
+#include <vector>
+#include "PinNames.h"
+
+/** A simulated device sitting on the host bus
+ */
+class HostDevice {
+public:
+    virtual ~HostDevice() {}
+
+    /** called whenever a DigitalOut changes its level
+    *
+    * @param pin pin that changed
+    * @param value new pin level
+    */
+    virtual void pin_changed(PinName pin, int value) = 0;
+
+    /** called for every byte shifted out on SPI
+    *
+    * @param out byte on MOSI
+    * @returns byte driven on MISO, or -1 when the device is not selected
+    */
+    virtual int spi_transfer(uint8_t out) = 0;
+};
+
+class HostBus {
+public:
+
+    /** bus level counters */
+    struct Stats {
+        uint32_t spi_transactions;  // SPI::write calls, single byte or block
+        uint32_t spi_bytes;         // bytes shifted, selected or not
+    };
+
+    /** Get the bus shared by all stand-ins of the process
+    *
+    */
+    static HostBus &instance();
+
+    /** attach / detach a simulated device
+    *
+    */
+    void attach(HostDevice *dev);
+    void detach(HostDevice *dev);
+
+    /** drive a pin, forwarded to the attached devices on a level change
+    *
+    * @param pin pin name
+    * @param value new level
+    */
+    void pin_write(PinName pin, int value);
+
+    /** read back the level last driven on a pin
+    *
+    */
+    int pin_read(PinName pin) const;
+
+    /** set the SPI clock used to account bus time
+    *
+    * @param hz SPI clock frequency
+    */
+    void spi_frequency(int hz);
+
+    /** SPI clock set last
+    *
+    */
+    int spi_hz() const;
+
+    /** shift one byte over SPI
+    *
+    * @param out byte on MOSI
+    * @returns byte on MISO (0xFF when no device drives it)
+    */
+    uint8_t spi_transfer(uint8_t out);
+
+    /** count one SPI::write call
+    *
+    */
+    void spi_transaction();
+
+    /** counters */
+    const Stats &stats() const;
+    void reset_stats();
+
+    /** advance the virtual clock
+    *
+    * @param ns nanoseconds
+    */
+    void advance(uint64_t ns);
+
+    /** current virtual time in nanoseconds
+    *
+    */
+    uint64_t now_ns() const;
+
+private:
+    HostBus();
+
+    std::vector<HostDevice *> _devices;
+    int _pins[64];
+    int _hz;
+    uint64_t _now;
+    Stats _stats;
+};
+
+#endif
@@ -0,0 +1,19 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host stand-in for the RP2040 PinNames.h
+ */
+
+#ifndef HOST_PINNAMES_H
+#define HOST_PINNAMES_H
+
+typedef enum {
+    p0 = 0, p1, p2, p3, p4, p5, p6, p7, p8, p9,
+    p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
+    p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
+
+    NC = -1
+} PinName;
+
+#endif
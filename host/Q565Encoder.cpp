@@ -0,0 +1,83 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "Q565Encoder.h"
+#include "Q565.h"
+
+std::vector<uint8_t> q565_encode(const uint16_t *pixels, int w, int h)
+{
+    std::vector<uint8_t> out;
+    uint16_t index[64] = { 0 };
+    int prev = 0;
+    int run = 0;
+
+    out.push_back('Q');
+    out.push_back('5');
+    out.push_back('6');
+    out.push_back('5');
+    out.push_back(w & 0xFF);
+    out.push_back(w >> 8);
+    out.push_back(h & 0xFF);
+    out.push_back(h >> 8);
+
+    for (int i = 0; i < w * h; i++) {
+        int px = pixels[i];
+        if (px == prev) {
+            if (++run == Q565_RUN_MAX) {
+                out.push_back(Q565_OP_RUN | (run - 1));
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0) {
+            out.push_back(Q565_OP_RUN | (run - 1));
+            run = 0;
+        }
+
+        int slot = q565_hash(px);
+        if (index[slot] == px) {
+            out.push_back(Q565_OP_INDEX | slot);
+            prev = px;
+            continue;
+        }
+        index[slot] = px;
+
+        int r = px >> 11, g = (px >> 5) & 0x3F, b = px & 0x1F;
+        int pr = prev >> 11, pg = (prev >> 5) & 0x3F, pb = prev & 0x1F;
+
+        // channel differences as the decoder adds them, modulo the channel size
+        int vr = (r - pr + 2) & 0x1F;
+        int vg = (g - pg + 2) & 0x3F;
+        int vb = (b - pb + 2) & 0x1F;
+        int dg = ((g - pg + 32) & 0x3F) - 32;
+        int lr = (r - pr - (dg >> 1) + 8) & 0x1F;
+        int lb = (b - pb - (dg >> 1) + 8) & 0x1F;
+
+        if ((vr < 4) && (vg < 4) && (vb < 4)) {
+            out.push_back(Q565_OP_DIFF | (vr << 4) | (vg << 2) | vb);
+        } else if ((lr < 16) && (lb < 16)) {
+            out.push_back(Q565_OP_LUMA | (dg + 32));
+            out.push_back((lr << 4) | lb);
+        } else {
+            out.push_back(Q565_OP_RGB);
+            out.push_back(px >> 8);
+            out.push_back(px & 0xFF);
+        }
+        prev = px;
+    }
+    if (run > 0) {
+        out.push_back(Q565_OP_RUN | (run - 1));
+    }
+    return out;
+}
+
+std::vector<uint16_t> q565_pixels(const unsigned char *image, int count)
+{
+    std::vector<uint16_t> px(count);
+    for (int i = 0; i < count; i++) {
+        px[i] = image[i * 2] | (image[i * 2 + 1] << 8);
+    }
+    return px;
+}
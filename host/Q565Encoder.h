@@ -0,0 +1,26 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host-side encoder of the Q565 image format, see ST7735S/Q565.h.
+ */
+
+#ifndef HOST_Q565ENCODER_H
+#define HOST_Q565ENCODER_H
+
+#include <stdint.h>
+#include <vector>
+
+/** Encode an image
+ *
+ * @param pixels w * h R5 G6 B5 pixels, row by row
+ * @returns the image with header
+ */
+std::vector<uint8_t> q565_encode(const uint16_t *pixels, int w, int h);
+
+/** Read pixels of the byte arrays used by Paint_DrawImage (low byte first)
+ *
+ */
+std::vector<uint16_t> q565_pixels(const unsigned char *image, int count);
+
+#endif
@@ -0,0 +1,451 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ST7735SModel.h"
+
+#define CMD_SWRESET     0x01
+#define CMD_SLPIN       0x10
+#define CMD_SLPOUT      0x11
+#define CMD_INVOFF      0x20
+#define CMD_INVON       0x21
+#define CMD_DISPOFF     0x28
+#define CMD_DISPON      0x29
+#define CMD_CASET       0x2A
+#define CMD_RASET       0x2B
+#define CMD_RAMWR       0x2C
+#define CMD_RAMRD       0x2E
+#define CMD_SCRLAR      0x33
+#define CMD_MADCTL      0x36
+#define CMD_VSCSAD      0x37
+#define CMD_COLMOD      0x3A
+
+#define MADCTL_MY       0x80
+#define MADCTL_MX       0x40
+#define MADCTL_MV       0x20
+
+// datasheet restrictions after reset / sleep out
+#define T_CMD_NS        5000000ULL      // 5 ms before the next command
+#define T_SLPOUT_NS     120000000ULL    // 120 ms before sleep out
+#define T_RESET_NS      10000ULL        // 10 us minimum RESX low pulse
+#define F_READ_MAX_HZ   6666666         // 150 ns minimum read clock cycle
+
+ST7735SModel::ST7735SModel(PinName cs, PinName rs, PinName reset)
+    : _cs_pin(cs), _rs_pin(rs), _reset_pin(reset), _busy_until(0), _sleep_out_at(0)
+{
+    HostBus &bus = HostBus::instance();
+    _cs = bus.pin_read(cs);
+    _rs = bus.pin_read(rs);
+    _in_reset = (reset != NC) && (bus.pin_read(reset) == 0);
+    _reset_at = bus.now_ns();
+    memset(_gram, 0, sizeof(_gram));
+    reset_state();
+    reset_stats();
+    viewport(1, 26, 160, 80, 0xA8);
+    bus.attach(this);
+}
+
+ST7735SModel::~ST7735SModel()
+{
+    HostBus::instance().detach(this);
+}
+
+void ST7735SModel::reset_state()
+{
+    _cmd = 0;
+    _argc = 0;
+    _pixc = 0;
+    _xs = 0;
+    _xe = gram_width - 1;
+    _ys = 0;
+    _ye = gram_height - 1;
+    _col = 0;
+    _row = 0;
+    _madctl = 0x00;
+    _colmod = 0x06;
+    _disp_on = false;
+    _sleep = true;
+    _inverted = false;
+    _tfa = 0;
+    _vsa = gram_height;
+    _bfa = 0;
+    _ssa = 0;
+}
+
+void ST7735SModel::busy_for(uint64_t ns, uint64_t sleep_out_ns)
+{
+    uint64_t now = HostBus::instance().now_ns();
+    _busy_until = now + ns;
+    _sleep_out_at = now + sleep_out_ns;
+}
+
+void ST7735SModel::viewport(int x, int y, int w, int h, uint8_t madctl)
+{
+    _vx = x;
+    _vy = y;
+    _vw = w;
+    _vh = h;
+    _vmadctl = madctl;
+}
+
+int ST7735SModel::width() const
+{
+    return _vw;
+}
+
+int ST7735SModel::height() const
+{
+    return _vh;
+}
+
+bool ST7735SModel::map(int col, int row, uint8_t madctl, int &px, int &py) const
+{
+    bool mv = (madctl & MADCTL_MV) != 0;
+    int cols = mv ? gram_height : gram_width;
+    int rows = mv ? gram_width : gram_height;
+
+    if ((col < 0) || (col >= cols) || (row < 0) || (row >= rows)) {
+        return false;
+    }
+    if (madctl & MADCTL_MX) {
+        col = cols - 1 - col;
+    }
+    if (madctl & MADCTL_MY) {
+        row = rows - 1 - row;
+    }
+    px = mv ? row : col;
+    py = mv ? col : row;
+    return true;
+}
+
+uint16_t ST7735SModel::visible(int x, int y) const
+{
+    int px, py;
+    if ((x < 0) || (x >= _vw) || (y < 0) || (y >= _vh)) {
+        return 0;
+    }
+    if (!map(_vx + x, _vy + y, _vmadctl, px, py)) {
+        return 0;
+    }
+    return _gram[scan_row(py)][px];
+}
+
+int ST7735SModel::scan_row(int line) const
+{
+    // lines of the scroll area show the GRAM from VSCSAD on, wrapping inside the area
+    if ((_tfa + _vsa + _bfa != gram_height) || (line < _tfa) || (line >= _tfa + _vsa)) {
+        return line;
+    }
+    return _tfa + (line - _tfa + _ssa - _tfa + _vsa) % _vsa;
+}
+
+uint16_t ST7735SModel::gram(int col, int row) const
+{
+    if ((col < 0) || (col >= gram_width) || (row < 0) || (row >= gram_height)) {
+        return 0;
+    }
+    return _gram[row][col];
+}
+
+bool ST7735SModel::write_ppm(const char *path) const
+{
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) {
+        return false;
+    }
+    fprintf(fp, "P6\n%d %d\n255\n", _vw, _vh);
+    for (int y = 0; y < _vh; y++) {
+        for (int x = 0; x < _vw; x++) {
+            uint16_t c = visible(x, y);
+            unsigned char rgb[3];
+            rgb[0] = (unsigned char)(((c >> 11) & 0x1F) * 255 / 31);
+            rgb[1] = (unsigned char)(((c >> 5) & 0x3F) * 255 / 63);
+            rgb[2] = (unsigned char)((c & 0x1F) * 255 / 31);
+            fwrite(rgb, 1, 3, fp);
+        }
+    }
+    fclose(fp);
+    return true;
+}
+
+uint32_t ST7735SModel::crc32() const
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (int y = 0; y < _vh; y++) {
+        for (int x = 0; x < _vw; x++) {
+            uint16_t c = visible(x, y);
+            uint8_t b[2] = { (uint8_t)(c >> 8), (uint8_t)c };
+            for (int i = 0; i < 2; i++) {
+                crc ^= b[i];
+                for (int k = 0; k < 8; k++) {
+                    crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+                }
+            }
+        }
+    }
+    return ~crc;
+}
+
+uint8_t ST7735SModel::madctl() const
+{
+    return _madctl;
+}
+
+uint8_t ST7735SModel::colmod() const
+{
+    return _colmod;
+}
+
+bool ST7735SModel::display_on() const
+{
+    return _disp_on;
+}
+
+bool ST7735SModel::sleeping() const
+{
+    return _sleep;
+}
+
+bool ST7735SModel::inverted() const
+{
+    return _inverted;
+}
+
+const ST7735SModel::Stats &ST7735SModel::stats() const
+{
+    return _stats;
+}
+
+void ST7735SModel::reset_stats()
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+void ST7735SModel::pin_changed(PinName pin, int value)
+{
+    if (pin == _cs_pin) {
+        _cs = value;
+        _stats.cs_toggles++;
+    } else if (pin == _rs_pin) {
+        _rs = value;
+        _stats.dc_toggles++;
+    } else if (pin == _reset_pin) {
+        uint64_t now = HostBus::instance().now_ns();
+        if (value == 0) {
+            if (!_in_reset) {
+                _reset_at = now;
+            }
+            _in_reset = 1;
+            reset_state();
+        } else if (_in_reset) {
+            _in_reset = 0;
+            if (now - _reset_at < T_RESET_NS) {
+                _stats.timing_violations++;
+            }
+            busy_for(T_CMD_NS, T_SLPOUT_NS);
+        }
+    }
+}
+
+int ST7735SModel::spi_transfer(uint8_t out)
+{
+    if ((_cs != 0) || _in_reset) {
+        return -1;
+    }
+    _stats.bytes++;
+    if (_rs == 0) {
+        _stats.cmd_bytes++;
+        command(out);
+    } else {
+        _stats.data_bytes++;
+        if (_cmd == CMD_RAMRD) {
+            return read_data();
+        }
+        data(out);
+    }
+    return -1;
+}
+
+void ST7735SModel::command(uint8_t cmd)
+{
+    uint64_t now = HostBus::instance().now_ns();
+
+    if ((now < _busy_until) || ((cmd == CMD_SLPOUT) && (now < _sleep_out_at))) {
+        _stats.timing_violations++;
+    }
+    _stats.cmd_count[cmd]++;
+    _cmd = cmd;
+    _argc = 0;
+
+    switch (cmd) {
+        case CMD_SWRESET:
+            reset_state();
+            busy_for(T_CMD_NS, T_SLPOUT_NS);
+            break;
+        case CMD_SLPIN:
+            _sleep = true;
+            busy_for(T_CMD_NS, T_SLPOUT_NS);
+            break;
+        case CMD_SLPOUT:
+            _sleep = false;
+            busy_for(T_CMD_NS, 0);
+            break;
+        case CMD_INVOFF:
+            _inverted = false;
+            break;
+        case CMD_INVON:
+            _inverted = true;
+            break;
+        case CMD_DISPOFF:
+            _disp_on = false;
+            break;
+        case CMD_DISPON:
+            _disp_on = true;
+            break;
+        case CMD_RAMWR:
+            _col = _xs;
+            _row = _ys;
+            _pixc = 0;
+            break;
+        case CMD_RAMRD:
+            _col = _xs;
+            _row = _ys;
+            _pixc = -1;     // dummy byte first
+            break;
+        default:
+            break;
+    }
+}
+
+void ST7735SModel::data(uint8_t dat)
+{
+    if (_cmd == CMD_RAMWR) {
+        _pix[_pixc++] = dat;
+        if (_colmod == 0x05) {
+            if (_pixc == 2) {
+                write_pixel((uint16_t)((_pix[0] << 8) | _pix[1]));
+                _pixc = 0;
+            }
+        } else if (_colmod == 0x03) {
+            // 12 bit: two pixels in 3 bytes, each stored once its 12 bits are in
+            if (_pixc == 2) {
+                write_pixel(rgb444_to_565((_pix[0] << 4) | (_pix[1] >> 4)));
+            } else if (_pixc == 3) {
+                write_pixel(rgb444_to_565(((_pix[1] & 0x0F) << 8) | _pix[2]));
+                _pixc = 0;
+            }
+        } else if (_pixc == 3) {
+            // 18 bit: 6 bit R, G, B left aligned in each byte
+            write_pixel((uint16_t)(((_pix[0] & 0xF8) << 8) | ((_pix[1] & 0xFC) << 3) | (_pix[2] >> 3)));
+            _pixc = 0;
+        }
+        return;
+    }
+
+    if (_argc < (int)sizeof(_args)) {
+        _args[_argc] = dat;
+    }
+    _argc++;
+
+    switch (_cmd) {
+        case CMD_CASET:
+            if (_argc == 4) {
+                _xs = (uint16_t)((_args[0] << 8) | _args[1]);
+                _xe = (uint16_t)((_args[2] << 8) | _args[3]);
+            }
+            break;
+        case CMD_RASET:
+            if (_argc == 4) {
+                _ys = (uint16_t)((_args[0] << 8) | _args[1]);
+                _ye = (uint16_t)((_args[2] << 8) | _args[3]);
+            }
+            break;
+        case CMD_SCRLAR:
+            if (_argc == 6) {
+                _tfa = (_args[0] << 8) | _args[1];
+                _vsa = (_args[2] << 8) | _args[3];
+                _bfa = (_args[4] << 8) | _args[5];
+            }
+            break;
+        case CMD_VSCSAD:
+            if (_argc == 2) {
+                _ssa = (_args[0] << 8) | _args[1];
+            }
+            break;
+        case CMD_MADCTL:
+            if (_argc == 1) {
+                _madctl = dat;
+            }
+            break;
+        case CMD_COLMOD:
+            if (_argc == 1) {
+                _colmod = dat & 0x07;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+uint16_t ST7735SModel::rgb444_to_565(int c)
+{
+    // expand each channel the way the controller does, by repeating the upper bits
+    int r = (c >> 8) & 0x0F;
+    int g = (c >> 4) & 0x0F;
+    int b = c & 0x0F;
+    return (uint16_t)((((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3)));
+}
+
+int ST7735SModel::read_data()
+{
+    if (HostBus::instance().spi_hz() > F_READ_MAX_HZ) {
+        _stats.timing_violations++;
+    }
+    if (_pixc < 0) {
+        _pixc = 0;
+        return 0x00;
+    }
+    if (_pixc == 0) {
+        // 18 bit: 6 bit R, G, B left aligned in each byte, R and B expanded from 5 bit
+        int px, py;
+        uint16_t c = 0;
+        if (map(_col, _row, _madctl, px, py)) {
+            c = _gram[py][px];
+        }
+        int r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+        _pix[0] = (uint8_t)(((r << 1) | (r >> 4)) << 2);
+        _pix[1] = (uint8_t)(g << 2);
+        _pix[2] = (uint8_t)(((b << 1) | (b >> 4)) << 2);
+        next_address();
+    }
+    int dat = _pix[_pixc];
+    _pixc = (_pixc + 1) % 3;
+    return dat;
+}
+
+void ST7735SModel::next_address()
+{
+    // address counter runs inside the CASET / RASET window and wraps
+    _col++;
+    if (_col > _xe) {
+        _col = _xs;
+        _row++;
+        if (_row > _ye) {
+            _row = _ys;
+        }
+    }
+}
+
+void ST7735SModel::write_pixel(uint16_t color)
+{
+    int px, py;
+
+    if (map(_col, _row, _madctl, px, py)) {
+        _gram[py][px] = color;
+    }
+    _stats.pixels++;
+    next_address();
+}
@@ -0,0 +1,150 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Software model of the ST7735S controller for host builds.
+ *
+ * The model listens to the CS, D/CX and RESET pins and to the SPI bytes on
+ * the HostBus and emulates the parts of the controller the driver relies
+ * on: command / parameter decoding, CASET / RASET windowing with the
+ * RAMWR / RAMRD address counter, the 12, 16 and 18 bit COLMOD pixel formats,
+ * MADCTL address mapping, SCRLAR / VSCSAD vertical scrolling of the GRAM
+ * rows and the 132 x 162 GRAM.
+ * The visible area of the 0.96" module (160 x 80 at column 1, row 26 in
+ * the landscape MADCTL used by ST7735S::init) is exposed as viewport.
+ */
+
+#ifndef HOST_ST7735SMODEL_H
+#define HOST_ST7735SMODEL_H
+
+#include <stdint.h>
+#include "HostBus.h"
+
+class ST7735SModel : public HostDevice {
+public:
+
+    /** GRAM size of the ST7735S in physical columns / rows */
+    static const int gram_width = 132;
+    static const int gram_height = 162;
+
+    /** counters collected while the model observes the bus */
+    struct Stats {
+        uint32_t bytes;             // bytes received while CS was low
+        uint32_t cmd_bytes;         // bytes received with D/CX low
+        uint32_t data_bytes;        // bytes received with D/CX high
+        uint32_t pixels;            // pixels written to GRAM
+        uint32_t cs_toggles;        // CS level changes
+        uint32_t dc_toggles;        // D/CX level changes
+        uint32_t timing_violations; // commands sent while the controller was busy, short reset pulses, reads above 6.67 MHz
+        uint32_t cmd_count[256];    // per command counters
+    };
+
+    /** Create a model attached to the HostBus
+    *
+    * @param cs pin connected to CS
+    * @param rs pin connected to D/CX
+    * @param reset pin connected to RESET
+    */
+    ST7735SModel(PinName cs, PinName rs, PinName reset);
+    virtual ~ST7735SModel();
+
+    /** Define the part of the GRAM visible on the panel
+    *
+    * @param x,y address of the top left visible pixel
+    * @param w,h size of the visible area
+    * @param madctl MADCTL value the address is given in
+    */
+    void viewport(int x, int y, int w, int h, uint8_t madctl);
+
+    /** size of the viewport */
+    int width() const;
+    int height() const;
+
+    /** Get a pixel of the viewport
+    *
+    * @param x,y position inside the viewport
+    * @returns 16 bit R5 G6 B5 color
+    */
+    uint16_t visible(int x, int y) const;
+
+    /** Get a pixel of the GRAM
+    *
+    * @param col,row physical GRAM position
+    * @returns 16 bit R5 G6 B5 color
+    */
+    uint16_t gram(int col, int row) const;
+
+    /** Save the viewport as binary PPM
+    *
+    * @param path output file
+    * @returns true on success
+    */
+    bool write_ppm(const char *path) const;
+
+    /** CRC-32 of the viewport content, to compare rendering results
+    *
+    */
+    uint32_t crc32() const;
+
+    /** controller state */
+    uint8_t madctl() const;
+    uint8_t colmod() const;
+    bool display_on() const;
+    bool sleeping() const;
+    bool inverted() const;
+
+    /** counters */
+    const Stats &stats() const;
+    void reset_stats();
+
+    virtual void pin_changed(PinName pin, int value);
+    virtual int spi_transfer(uint8_t out);
+
+private:
+    void reset_state();
+    void busy_for(uint64_t ns, uint64_t sleep_out_ns);
+    void command(uint8_t cmd);
+    void data(uint8_t dat);
+    void write_pixel(uint16_t color);
+    int read_data();
+    void next_address();
+    static uint16_t rgb444_to_565(int c);
+    bool map(int col, int row, uint8_t madctl, int &px, int &py) const;
+    int scan_row(int line) const;
+
+    PinName _cs_pin;
+    PinName _rs_pin;
+    PinName _reset_pin;
+    int _cs;
+    int _rs;
+    int _in_reset;
+
+    uint8_t _cmd;
+    uint8_t _args[16];
+    int _argc;
+
+    uint16_t _xs, _xe, _ys, _ye;
+    int _col, _row;
+    uint8_t _pix[3];
+    int _pixc;
+
+    uint8_t _madctl;
+    uint8_t _colmod;
+    bool _disp_on;
+    bool _sleep;
+    bool _inverted;
+    int _tfa, _vsa, _bfa;       // scroll area definition
+    int _ssa;                   // scroll start address
+
+    uint64_t _reset_at;         // start of the RESX low pulse
+    uint64_t _busy_until;
+    uint64_t _sleep_out_at;
+
+    int _vx, _vy, _vw, _vh;
+    uint8_t _vmadctl;
+
+    uint16_t _gram[gram_height][gram_width];
+    Stats _stats;
+};
+
+#endif
@@ -0,0 +1,16 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Object for make ram: references every entry of the asset registry, so
+ * size -A shows where the images and fonts land. Everything should be in
+ * .rodata (flash on the target), nothing in .data, which is copied to RAM
+ * at startup.
+ */
+
+#include "images/assets.h"
+
+const Asset *asset_ram(int id)
+{
+    return &asset_table[id];
+}
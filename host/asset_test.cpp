@@ -0,0 +1,170 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Asset registry test.
+ *
+ * Every image of asset_table[] is drawn with Paint_DrawImage(const Asset &)
+ * at a position on the screen and at positions clipped by each edge, and
+ * the screen has to match the same image drawn pixel by pixel from its raw
+ * data: the RGB565 entries from their bytes, the Q565 entries from the
+ * RGB565 source they were made from (Q565 is lossless). An ASSET_MONO entry,
+ * which the generated registry does not have, is checked the same way
+ * against its bits in the foreground and background color. The font entries
+ * have to print the same text as set_font() with the font itself. Runs in
+ * DIRECT and FRAMEBUFFER mode, the exit status is 2 on a mismatch.
+ *
+ *   st7735s_asset_test
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "ST7735SModel.h"
+
+#include "images/assets.h"
+
+#define MONO_W      21
+#define MONO_H      13
+#define MONO_STRIDE 3
+
+static const int places[][2] = {
+    { 17, 9 }, { -5, -3 }, { 101, 53 }, { -40, 30 }, { 20, -70 }, { 150, 75 }, { -200, 0 },
+};
+#define NPLACES ((int)(sizeof(places) / sizeof(places[0])))
+
+static int failures;
+
+static std::vector<uint16_t> screen(ST7735SModel &model)
+{
+    std::vector<uint16_t> s(model.width() * model.height());
+    for (int y = 0; y < model.height(); y++) {
+        for (int x = 0; x < model.width(); x++) {
+            s[y * model.width() + x] = model.visible(x, y);
+        }
+    }
+    return s;
+}
+
+static bool compare(ST7735SModel &model, const std::vector<uint16_t> &expect, const char *what, int x0, int y0)
+{
+    std::vector<uint16_t> got = screen(model);
+    for (size_t i = 0; i < got.size(); i++) {
+        if (got[i] != expect[i]) {
+            fprintf(stderr, "%s at %d,%d: %d,%d is %04X, expected %04X\n", what, x0, y0,
+                    (int)(i % model.width()), (int)(i / model.width()), got[i], expect[i]);
+            failures++;
+            return false;
+        }
+    }
+    return true;
+}
+
+/* the raw picture: RGB565 bytes, low byte first, or bits of MONO_STRIDE bytes per row */
+static void draw_raw(ST7735S &tft, const unsigned char *data, bool mono, int w, int h, int x0, int y0)
+{
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            int px = x0 + x, py = y0 + y;
+            if ((px < 0) || (py < 0) || (px >= tft.width()) || (py >= tft.height())) {
+                continue;
+            }
+            int c;
+            if (mono) {
+                c = (data[y * MONO_STRIDE + (x >> 3)] & (0x80 >> (x & 7))) ? White : Blue;
+            } else {
+                const unsigned char *p = data + (y * w + x) * 2;
+                c = p[0] | (p[1] << 8);
+            }
+            tft.pixel(px, py, c);
+        }
+    }
+    tft.flush();
+}
+
+static void check_image(ST7735SModel &model, ST7735S &tft, const Asset &asset, const unsigned char *raw, bool mono)
+{
+    for (int i = 0; i < NPLACES; i++) {
+        int x0 = places[i][0], y0 = places[i][1];
+        tft.cls();
+        draw_raw(tft, raw, mono, asset.width, asset.height, x0, y0);
+        std::vector<uint16_t> expect = screen(model);
+
+        tft.cls();
+        tft.Paint_DrawImage(asset, x0, y0);
+        tft.flush();
+        if (!compare(model, expect, asset.name, x0, y0)) {
+            return;
+        }
+    }
+}
+
+static void check_font(ST7735SModel &model, ST7735S &tft, const Asset &asset)
+{
+    static const char text[] = "Asset 0123 gjy";
+
+    tft.cls();
+    if (asset.format == ASSET_ATLAS_FONT) {
+        tft.set_font((const GlyphAtlas *)asset.data);
+    } else {
+        tft.set_font((const unsigned char *)asset.data);
+    }
+    tft.locate(3, 5);
+    tft.printf("%s", text);
+    tft.flush();
+    std::vector<uint16_t> expect = screen(model);
+
+    // another size first, so that an ignored entry prints in the wrong font
+    tft.cls();
+    tft.set_font((asset.height == 12) ? Arial28x28 : Arial12x12);
+    tft.set_font(asset);
+    tft.locate(3, 5);
+    tft.printf("%s", text);
+    tft.flush();
+    compare(model, expect, asset.name, 3, 5);
+}
+
+int main(void)
+{
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+    int fonts = 0;
+
+    // a ring with a cross, rows of MONO_STRIDE bytes of which the last bits are padding
+    static unsigned char mono[MONO_H * MONO_STRIDE];
+    for (int y = 0; y < MONO_H; y++) {
+        for (int x = 0; x < MONO_W; x++) {
+            int dx = 2 * x - (MONO_W - 1), dy = 2 * y - (MONO_H - 1);
+            int d = dx * dx + dy * dy;
+            if (((d >= 100) && (d <= 144)) || (x == y) || (x == MONO_W / 2)) {
+                mono[y * MONO_STRIDE + (x >> 3)] |= 0x80 >> (x & 7);
+            }
+        }
+        mono[y * MONO_STRIDE + 2] |= 0x07;      // padding bits, never drawn
+    }
+    const Asset mono_asset = { "mono", ASSET_MONO, MONO_W, MONO_H, MONO_STRIDE, mono, sizeof(mono) };
+
+    for (int render = 0; render < 2; render++) {
+        ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT",
+                    render ? ST7735S::FRAMEBUFFER : ST7735S::DIRECT);
+        tft.foreground(White);
+        tft.background(Blue);
+
+        check_image(model, tft, asset_table[ASSET_GIMAGE_0INCH96_1], gImage_0inch96_1, false);
+        check_image(model, tft, asset_table[ASSET_EKIMEMO_BMP], ekimemo_bmp, false);
+        check_image(model, tft, asset_table[ASSET_GIMAGE_0INCH96_1_Q565], gImage_0inch96_1, false);
+        check_image(model, tft, asset_table[ASSET_EKIMEMO_BMP_Q565], ekimemo_bmp, false);
+        check_image(model, tft, mono_asset, mono, true);
+
+        fonts = 0;
+        for (int i = 0; i < ASSET_COUNT; i++) {
+            if ((asset_table[i].format == ASSET_GLCD_FONT) || (asset_table[i].format == ASSET_ATLAS_FONT)) {
+                check_font(model, tft, asset_table[i]);
+                fonts++;
+            }
+        }
+    }
+
+    printf("assets: 2 modes x 5 images x %d places, %d fonts, %d failures\n", NPLACES, fonts, failures);
+    return failures ? 2 : 0;
+}
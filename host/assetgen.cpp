@@ -0,0 +1,700 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Generate the asset registry images/assets.h.
+ *
+ * The registry lists the images and fonts of the project (built in below)
+ * and the images of the manifest images/assets.txt, one per line:
+ *
+ *   name  file  [rgb565 | q565 | mono]
+ *
+ * file is a BMP (1 / 4 / 8 bit palette, 16 / 24 / 32 bit), binary or
+ * ASCII PPM or, when built with zlib, PNG (non interlaced, any color
+ * type) relative to the manifest. Transparent pixels are blended on
+ * black, mono sets the bits of pixels brighter than 50 %. Every manifest
+ * image is written as a const array to images/<name>.h, so it ends up in
+ * flash; the registry points at the arrays and copies nothing.
+ *
+ *   assetgen [dir]     dir defaults to ../images
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Asset.h"
+#include "GlyphAtlas.h"
+#include "Q565.h"
+#include "Q565Encoder.h"
+#ifdef ASSETGEN_PNG
+#include <zlib.h>
+#endif
+
+#include "images/ImageData.h"
+#include "images/ImageData_q565.h"
+#include "images/ekimemo.h"
+#include "images/ekimemo_q565.h"
+#include "fonts/Arial12x12.h"
+#include "fonts/Arial24x23.h"
+#include "fonts/Arial28x28.h"
+#include "fonts/font_big.h"
+#include "fonts/Arial12x12_atlas.h"
+#include "fonts/Arial24x23_atlas.h"
+#include "fonts/Arial28x28_atlas.h"
+#include "fonts/Neu42x35_atlas.h"
+
+struct Entry {
+    std::string name;
+    std::string header;     // relative to the images directory
+    int format;
+    int width, height, stride;
+    std::string size;       // C expression
+    unsigned bytes;
+};
+
+/* 8 bit RGBA pixels read from a file */
+struct Picture {
+    int width, height;
+    std::vector<uint8_t> rgba;
+};
+
+static const char *format_names[] = { "rgb565", "q565", "mono", "glcd_font", "atlas_font" };
+static const char *format_enums[] = { "ASSET_RGB565", "ASSET_Q565", "ASSET_MONO", "ASSET_GLCD_FONT", "ASSET_ATLAS_FONT" };
+
+static Entry image(const char *name, const char *header, unsigned bytes, int w, int h)
+{
+    return Entry { name, header, ASSET_RGB565, w, h, w * 2, std::string("sizeof(") + name + ")", bytes };
+}
+
+static Entry q565(const char *name, const char *header, const unsigned char *data, unsigned bytes)
+{
+    Q565Decoder dec(data);
+    return Entry { name, header, ASSET_Q565, dec.width(), dec.height(), 0, std::string("sizeof(") + name + ")", bytes };
+}
+
+static Entry glcd(const char *name, const char *header, const unsigned char *font, unsigned bytes)
+{
+    return Entry { name, header, ASSET_GLCD_FONT, font[1], font[2], 0, std::string("sizeof(") + name + ")", bytes };
+}
+
+static Entry atlas(const char *name, const char *header, const GlyphAtlas &a, unsigned bytes)
+{
+    std::string n(name);
+    return Entry { n, header, ASSET_ATLAS_FONT, a.width, a.height, 0,
+                   "sizeof(" + n + ") + sizeof(" + n + "_glyphs) + sizeof(" + n + "_bitmap)", bytes };
+}
+
+#define BYTES(a) ((unsigned)sizeof(a))
+#define ATLAS_BYTES(a) ((unsigned)(sizeof(a) + sizeof(a##_glyphs) + sizeof(a##_bitmap)))
+
+static std::vector<Entry> builtin(void)
+{
+    std::vector<Entry> e;
+    e.push_back(image("gImage_0inch96_1", "ImageData.h", BYTES(gImage_0inch96_1), 160, 80));
+    e.push_back(image("ekimemo_bmp", "ekimemo.h", BYTES(ekimemo_bmp), 160, 284));
+    e.push_back(q565("gImage_0inch96_1_q565", "ImageData_q565.h", gImage_0inch96_1_q565, BYTES(gImage_0inch96_1_q565)));
+    e.push_back(q565("ekimemo_bmp_q565", "ekimemo_q565.h", ekimemo_bmp_q565, BYTES(ekimemo_bmp_q565)));
+    e.push_back(glcd("Arial12x12", "../fonts/Arial12x12.h", Arial12x12, BYTES(Arial12x12)));
+    e.push_back(glcd("Arial24x23", "../fonts/Arial24x23.h", Arial24x23, BYTES(Arial24x23)));
+    e.push_back(glcd("Arial28x28", "../fonts/Arial28x28.h", Arial28x28, BYTES(Arial28x28)));
+    e.push_back(glcd("Neu42x35", "../fonts/font_big.h", Neu42x35, BYTES(Neu42x35)));
+    e.push_back(atlas("Arial12x12_atlas", "../fonts/Arial12x12_atlas.h", Arial12x12_atlas, ATLAS_BYTES(Arial12x12_atlas)));
+    e.push_back(atlas("Arial24x23_atlas", "../fonts/Arial24x23_atlas.h", Arial24x23_atlas, ATLAS_BYTES(Arial24x23_atlas)));
+    e.push_back(atlas("Arial28x28_atlas", "../fonts/Arial28x28_atlas.h", Arial28x28_atlas, ATLAS_BYTES(Arial28x28_atlas)));
+    e.push_back(atlas("Neu42x35_atlas", "../fonts/Neu42x35_atlas.h", Neu42x35_atlas, ATLAS_BYTES(Neu42x35_atlas)));
+    return e;
+}
+
+static bool read_file(const std::string &path, std::vector<uint8_t> &buf)
+{
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (fp == NULL) {
+        perror(path.c_str());
+        return false;
+    }
+    uint8_t chunk[4096];
+    size_t n;
+    buf.clear();
+    while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0) {
+        buf.insert(buf.end(), chunk, chunk + n);
+    }
+    fclose(fp);
+    return true;
+}
+
+static uint32_t le16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+/* channel of v under mask scaled to 8 bit, 255 without mask */
+static int channel(uint32_t v, uint32_t mask)
+{
+    if (mask == 0) {
+        return 255;
+    }
+    int shift = 0;
+    while (!(mask & (1u << shift))) {
+        shift++;
+    }
+    uint32_t max = mask >> shift;
+    return (int)(((v & mask) >> shift) * 255 / max);
+}
+
+static bool read_bmp(const std::vector<uint8_t> &f, Picture &pic, const char *path)
+{
+    if ((f.size() < 54) || (f[0] != 'B') || (f[1] != 'M')) {
+        return false;
+    }
+    uint32_t offset = le32(&f[10]);
+    uint32_t dib = le32(&f[14]);
+    int w = (int)le32(&f[18]);
+    int h = (int)le32(&f[22]);
+    int bpp = le16(&f[28]);
+    uint32_t compression = le32(&f[30]);
+    bool top_down = (h < 0);
+    if (top_down) {
+        h = -h;
+    }
+    if ((w <= 0) || (h <= 0) || ((compression != 0) && (compression != 3))) {
+        fprintf(stderr, "%s: unsupported BMP (compression %u)\n", path, compression);
+        return false;
+    }
+
+    uint32_t rmask = 0x7C00, gmask = 0x03E0, bmask = 0x001F, amask = 0;
+    if (bpp == 32) {
+        rmask = 0xFF0000;
+        gmask = 0x00FF00;
+        bmask = 0x0000FF;
+    }
+    if (compression == 3) {
+        // masks follow a 40 byte header, or are part of a V4 / V5 header
+        rmask = le32(&f[54]);
+        gmask = le32(&f[58]);
+        bmask = le32(&f[62]);
+        amask = (dib >= 56) ? le32(&f[66]) : 0;
+    }
+
+    const uint8_t *palette = &f[14 + dib];
+    size_t stride = ((size_t)w * bpp + 31) / 32 * 4;
+    if ((bpp != 1) && (bpp != 4) && (bpp != 8) && (bpp != 16) && (bpp != 24) && (bpp != 32)) {
+        fprintf(stderr, "%s: unsupported BMP depth %d\n", path, bpp);
+        return false;
+    }
+    if (offset + stride * h > f.size()) {
+        fprintf(stderr, "%s: truncated BMP\n", path);
+        return false;
+    }
+
+    pic.width = w;
+    pic.height = h;
+    pic.rgba.resize((size_t)w * h * 4);
+    for (int y = 0; y < h; y++) {
+        const uint8_t *row = &f[offset + stride * (top_down ? y : h - 1 - y)];
+        uint8_t *out = &pic.rgba[(size_t)y * w * 4];
+        for (int x = 0; x < w; x++, out += 4) {
+            if (bpp <= 8) {
+                int bit = x * bpp;
+                size_t i = (row[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1 << bpp) - 1);
+                if (14 + dib + i * 4 + 4 > offset) {
+                    fprintf(stderr, "%s: color %u not in the BMP palette\n", path, (unsigned)i);
+                    return false;
+                }
+                out[0] = palette[i * 4 + 2];
+                out[1] = palette[i * 4 + 1];
+                out[2] = palette[i * 4];
+                out[3] = 255;
+            } else if (bpp == 24) {
+                out[0] = row[x * 3 + 2];
+                out[1] = row[x * 3 + 1];
+                out[2] = row[x * 3];
+                out[3] = 255;
+            } else {
+                uint32_t v = (bpp == 16) ? le16(&row[x * 2]) : le32(&row[x * 4]);
+                out[0] = channel(v, rmask);
+                out[1] = channel(v, gmask);
+                out[2] = channel(v, bmask);
+                out[3] = channel(v, amask);
+            }
+        }
+    }
+    return true;
+}
+
+/* next number of a PPM header or ASCII body, skipping comments */
+static bool ppm_number(const std::vector<uint8_t> &f, size_t &pos, int &value)
+{
+    while (pos < f.size()) {
+        if (f[pos] == '#') {
+            while ((pos < f.size()) && (f[pos] != '\n')) {
+                pos++;
+            }
+        } else if (isspace(f[pos])) {
+            pos++;
+        } else {
+            break;
+        }
+    }
+    if ((pos >= f.size()) || !isdigit(f[pos])) {
+        return false;
+    }
+    value = 0;
+    while ((pos < f.size()) && isdigit(f[pos])) {
+        value = value * 10 + (f[pos++] - '0');
+    }
+    return true;
+}
+
+static bool read_ppm(const std::vector<uint8_t> &f, Picture &pic, const char *path)
+{
+    if ((f.size() < 3) || (f[0] != 'P') || ((f[1] != '6') && (f[1] != '3'))) {
+        return false;
+    }
+    size_t pos = 2;
+    int w, h, max;
+    if (!ppm_number(f, pos, w) || !ppm_number(f, pos, h) || !ppm_number(f, pos, max) ||
+            (w <= 0) || (h <= 0) || (max <= 0) || (max > 65535)) {
+        fprintf(stderr, "%s: bad PPM header\n", path);
+        return false;
+    }
+    bool binary = (f[1] == '6');
+    int bytes = (max > 255) ? 2 : 1;
+    pos++;     // single whitespace before binary data
+
+    pic.width = w;
+    pic.height = h;
+    pic.rgba.resize((size_t)w * h * 4);
+    for (size_t i = 0; i < (size_t)w * h * 4; i++) {
+        if ((i & 3) == 3) {
+            pic.rgba[i] = 255;
+            continue;
+        }
+        int v;
+        if (binary) {
+            if (pos + bytes > f.size()) {
+                fprintf(stderr, "%s: truncated PPM\n", path);
+                return false;
+            }
+            v = (bytes == 2) ? (f[pos] << 8) | f[pos + 1] : f[pos];
+            pos += bytes;
+        } else if (!ppm_number(f, pos, v)) {
+            fprintf(stderr, "%s: truncated PPM\n", path);
+            return false;
+        }
+        pic.rgba[i] = (uint8_t)((v > max ? max : v) * 255 / max);
+    }
+    return true;
+}
+
+#ifdef ASSETGEN_PNG
+static int paeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    if ((pa <= pb) && (pa <= pc)) {
+        return a;
+    }
+    return (pb <= pc) ? b : c;
+}
+
+static bool read_png(const std::vector<uint8_t> &f, Picture &pic, const char *path)
+{
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    if ((f.size() < 8) || (memcmp(&f[0], signature, 8) != 0)) {
+        return false;
+    }
+
+    int w = 0, h = 0, depth = 0, type = -1, interlace = 0;
+    std::vector<uint8_t> idat, palette, trns;
+    for (size_t pos = 8; pos + 12 <= f.size();) {
+        uint32_t len = be32(&f[pos]);
+        const uint8_t *data = &f[pos + 8];
+        if (pos + 12 + len > f.size()) {
+            break;
+        }
+        if (memcmp(&f[pos + 4], "IHDR", 4) == 0) {
+            w = be32(data);
+            h = be32(data + 4);
+            depth = data[8];
+            type = data[9];
+            interlace = data[12];
+        } else if (memcmp(&f[pos + 4], "PLTE", 4) == 0) {
+            palette.assign(data, data + len);
+        } else if (memcmp(&f[pos + 4], "tRNS", 4) == 0) {
+            trns.assign(data, data + len);
+        } else if (memcmp(&f[pos + 4], "IDAT", 4) == 0) {
+            idat.insert(idat.end(), data, data + len);
+        } else if (memcmp(&f[pos + 4], "IEND", 4) == 0) {
+            break;
+        }
+        pos += 12 + len;
+    }
+
+    static const int channels[7] = { 1, 0, 3, 1, 2, 0, 4 };
+    if ((w <= 0) || (h <= 0) || (type < 0) || (type > 6) || (channels[type] == 0) || interlace ||
+            ((type == 3) && palette.empty())) {
+        fprintf(stderr, "%s: unsupported PNG (type %d, interlace %d)\n", path, type, interlace);
+        return false;
+    }
+    int bits = channels[type] * depth;
+    int bpp = (bits + 7) / 8;
+    size_t stride = ((size_t)w * bits + 7) / 8;
+    uLongf size = (stride + 1) * h;
+    std::vector<uint8_t> raw(size);
+    if ((uncompress(raw.data(), &size, idat.data(), idat.size()) != Z_OK) || (size != raw.size())) {
+        fprintf(stderr, "%s: bad PNG image data\n", path);
+        return false;
+    }
+
+    // undo the filters in place, the filter byte precedes every row
+    std::vector<uint8_t> prev(stride, 0);
+    for (int y = 0; y < h; y++) {
+        uint8_t *row = &raw[y * (stride + 1) + 1];
+        int filter = row[-1];
+        for (size_t i = 0; i < stride; i++) {
+            int a = (i >= (size_t)bpp) ? row[i - bpp] : 0;
+            int b = prev[i];
+            int c = (i >= (size_t)bpp) ? prev[i - bpp] : 0;
+            switch (filter) {
+                case 1: row[i] += a; break;
+                case 2: row[i] += b; break;
+                case 3: row[i] += (a + b) / 2; break;
+                case 4: row[i] += paeth(a, b, c); break;
+            }
+        }
+        memcpy(prev.data(), row, stride);
+    }
+
+    pic.width = w;
+    pic.height = h;
+    pic.rgba.resize((size_t)w * h * 4);
+    int max = (1 << depth) - 1;
+    for (int y = 0; y < h; y++) {
+        const uint8_t *row = &raw[y * (stride + 1) + 1];
+        for (int x = 0; x < w; x++) {
+            // samples as 8 bit, 16 bit samples keep their high byte
+            int s[4];
+            int raw_s[4];
+            for (int c = 0; c < channels[type]; c++) {
+                int bit = (x * channels[type] + c) * depth;
+                int v;
+                if (depth == 16) {
+                    v = (row[bit >> 3] << 8) | row[(bit >> 3) + 1];
+                } else {
+                    v = (row[bit >> 3] >> (8 - depth - (bit & 7))) & max;
+                }
+                raw_s[c] = v;
+                s[c] = (depth == 16) ? v >> 8 : v * 255 / max;
+            }
+            uint8_t *out = &pic.rgba[((size_t)y * w + x) * 4];
+            out[3] = 255;
+            switch (type) {
+                case 0:
+                    out[0] = out[1] = out[2] = s[0];
+                    if ((trns.size() >= 2) && (raw_s[0] == (int)((trns[0] << 8) | trns[1]))) {
+                        out[3] = 0;
+                    }
+                    break;
+                case 2:
+                    out[0] = s[0];
+                    out[1] = s[1];
+                    out[2] = s[2];
+                    if ((trns.size() >= 6) && (raw_s[0] == (int)((trns[0] << 8) | trns[1])) &&
+                            (raw_s[1] == (int)((trns[2] << 8) | trns[3])) && (raw_s[2] == (int)((trns[4] << 8) | trns[5]))) {
+                        out[3] = 0;
+                    }
+                    break;
+                case 3: {
+                    size_t i = raw_s[0];
+                    if (i * 3 + 2 < palette.size()) {
+                        out[0] = palette[i * 3];
+                        out[1] = palette[i * 3 + 1];
+                        out[2] = palette[i * 3 + 2];
+                    }
+                    if (i < trns.size()) {
+                        out[3] = trns[i];
+                    }
+                    break;
+                }
+                case 4:
+                    out[0] = out[1] = out[2] = s[0];
+                    out[3] = s[1];
+                    break;
+                case 6:
+                    out[0] = s[0];
+                    out[1] = s[1];
+                    out[2] = s[2];
+                    out[3] = s[3];
+                    break;
+            }
+        }
+    }
+    return true;
+}
+#endif
+
+static bool read_picture(const std::string &path, Picture &pic)
+{
+    std::vector<uint8_t> f;
+    if (!read_file(path, f)) {
+        return false;
+    }
+    if ((f.size() >= 2) && (f[0] == 'B') && (f[1] == 'M')) {
+        return read_bmp(f, pic, path.c_str());
+    }
+    if ((f.size() >= 2) && (f[0] == 'P') && ((f[1] == '6') || (f[1] == '3'))) {
+        return read_ppm(f, pic, path.c_str());
+    }
+    if ((f.size() >= 4) && (memcmp(&f[1], "PNG", 3) == 0)) {
+#ifdef ASSETGEN_PNG
+        return read_png(f, pic, path.c_str());
+#else
+        fprintf(stderr, "%s: assetgen was built without zlib, no PNG support\n", path.c_str());
+        return false;
+#endif
+    }
+    fprintf(stderr, "%s: not a BMP, PPM or PNG file\n", path.c_str());
+    return false;
+}
+
+/* R5 G6 B5 pixels, alpha blended on black */
+static std::vector<uint16_t> rgb565(const Picture &pic)
+{
+    std::vector<uint16_t> px((size_t)pic.width * pic.height);
+    for (size_t i = 0; i < px.size(); i++) {
+        const uint8_t *p = &pic.rgba[i * 4];
+        int r = p[0] * p[3] / 255, g = p[1] * p[3] / 255, b = p[2] * p[3] / 255;
+        px[i] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    }
+    return px;
+}
+
+/* encoded bytes of a picture in an asset format */
+static std::vector<uint8_t> encode(const Picture &pic, int format, int &stride)
+{
+    std::vector<uint8_t> out;
+    std::vector<uint16_t> px = rgb565(pic);
+    stride = 0;
+    if (format == ASSET_RGB565) {
+        stride = pic.width * 2;
+        for (uint16_t c : px) {
+            out.push_back(c & 0xFF);
+            out.push_back(c >> 8);
+        }
+    } else if (format == ASSET_Q565) {
+        out = q565_encode(px.data(), pic.width, pic.height);
+    } else {
+        stride = (pic.width + 7) / 8;
+        out.assign((size_t)stride * pic.height, 0);
+        for (int y = 0; y < pic.height; y++) {
+            for (int x = 0; x < pic.width; x++) {
+                const uint8_t *p = &pic.rgba[((size_t)y * pic.width + x) * 4];
+                if ((p[0] * 299 + p[1] * 587 + p[2] * 114) * p[3] / 255 >= 128 * 1000) {
+                    out[y * stride + (x >> 3)] |= 0x80 >> (x & 7);
+                }
+            }
+        }
+    }
+    return out;
+}
+
+static std::string upper(const std::string &s)
+{
+    std::string u(s);
+    for (size_t i = 0; i < u.size(); i++) {
+        u[i] = isalnum((unsigned char)u[i]) ? toupper((unsigned char)u[i]) : '_';
+    }
+    return u;
+}
+
+/* true unless path exists and was not written by assetgen */
+static bool ours(const std::string &path)
+{
+    FILE *fp = fopen(path.c_str(), "r");
+    if (fp == NULL) {
+        return true;
+    }
+    char line[256] = "";
+    bool generated = (fgets(line, sizeof(line), fp) != NULL) && (strstr(line, "generated by host/assetgen") != NULL);
+    fclose(fp);
+    return generated;
+}
+
+static bool convert(const std::string &dir, const std::string &name, const std::string &file, int format, Entry &e)
+{
+    Picture pic;
+    if (!read_picture(dir + "/" + file, pic)) {
+        return false;
+    }
+    if ((pic.width > 0xFFFF) || (pic.height > 0xFFFF)) {
+        fprintf(stderr, "%s: too large\n", file.c_str());
+        return false;
+    }
+    int stride;
+    std::vector<uint8_t> data = encode(pic, format, stride);
+
+    std::string path = dir + "/" + name + ".h";
+    if (!ours(path)) {
+        fprintf(stderr, "%s: exists and was not generated by assetgen\n", path.c_str());
+        return false;
+    }
+    FILE *fp = fopen(path.c_str(), "w");
+    if (fp == NULL) {
+        perror(path.c_str());
+        return false;
+    }
+    std::string guard = upper(name) + "_H";
+    fprintf(fp, "//%s image of %s generated by host/assetgen, do not edit\n", format_names[format], file.c_str());
+    fprintf(fp, "//%d x %d, %u bytes\n\n", pic.width, pic.height, (unsigned)data.size());
+    fprintf(fp, "#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+    fprintf(fp, "/** %s, draw with ST7735S::Paint_DrawImage(asset_table[ASSET_%s], x, y) */\n",
+            name.c_str(), upper(name).c_str());
+    fprintf(fp, "const unsigned char %s[] = {", name.c_str());
+    for (size_t i = 0; i < data.size(); i++) {
+        fprintf(fp, "%s0x%02X,", (i % 16) ? " " : "\n        ", data[i]);
+    }
+    fprintf(fp, "\n};\n\n#endif\n");
+    fclose(fp);
+
+    e = Entry { name, name + ".h", format, pic.width, pic.height, stride, "sizeof(" + name + ")", (unsigned)data.size() };
+    return true;
+}
+
+static bool manifest(const std::string &dir, std::vector<Entry> &entries)
+{
+    std::string path = dir + "/assets.txt";
+    FILE *fp = fopen(path.c_str(), "r");
+    if (fp == NULL) {
+        return true;    // no images besides the built in ones
+    }
+    char line[512];
+    int n = 0;
+    bool ok = true;
+    while (ok && (fgets(line, sizeof(line), fp) != NULL)) {
+        n++;
+        char *hash = strchr(line, '#');
+        if (hash != NULL) {
+            *hash = '\0';
+        }
+        char name[128], file[256], format[32] = "rgb565";
+        int fields = sscanf(line, "%127s %255s %31s", name, file, format);
+        if (fields <= 0) {
+            continue;
+        }
+        int f = -1;
+        for (int i = ASSET_RGB565; i <= ASSET_MONO; i++) {
+            if (strcmp(format, format_names[i]) == 0) {
+                f = i;
+            }
+        }
+        bool ident = isalpha((unsigned char)name[0]) || (name[0] == '_');
+        for (char *p = name; *p; p++) {
+            ident = ident && (isalnum((unsigned char)*p) || (*p == '_'));
+        }
+        if ((fields < 2) || (f < 0) || !ident) {
+            fprintf(stderr, "%s:%d: expected name file [rgb565 | q565 | mono]\n", path.c_str(), n);
+            ok = false;
+            break;
+        }
+        Entry e;
+        ok = convert(dir, name, file, f, e);
+        if (ok) {
+            entries.push_back(e);
+        }
+    }
+    fclose(fp);
+    return ok;
+}
+
+static bool registry(const std::string &dir, const std::vector<Entry> &entries)
+{
+    // the ids share the ASSET_ prefix with the formats
+    for (size_t i = 0; i < entries.size(); i++) {
+        std::string id = upper(entries[i].name);
+        for (size_t j = 0; j < i; j++) {
+            if (upper(entries[j].name) == id) {
+                fprintf(stderr, "%s: duplicate asset ASSET_%s\n", entries[i].name.c_str(), id.c_str());
+                return false;
+            }
+        }
+        for (const char *f : format_enums) {
+            if ("ASSET_" + id == f) {
+                fprintf(stderr, "%s: asset id clashes with %s\n", entries[i].name.c_str(), f);
+                return false;
+            }
+        }
+    }
+
+    std::string path = dir + "/assets.h";
+    FILE *fp = fopen(path.c_str(), "w");
+    if (fp == NULL) {
+        perror(path.c_str());
+        return false;
+    }
+    unsigned total = 0;
+    for (const Entry &e : entries) {
+        total += e.bytes;
+    }
+    fprintf(fp, "//Asset registry generated by host/assetgen, do not edit\n");
+    fprintf(fp, "//%u assets, %u bytes of const data\n\n", (unsigned)entries.size(), total);
+    fprintf(fp, "#ifndef ASSETS_H\n#define ASSETS_H\n\n#include \"Asset.h\"\n");
+    for (size_t i = 0; i < entries.size(); i++) {
+        bool seen = false;
+        for (size_t j = 0; j < i; j++) {
+            seen = seen || (entries[j].header == entries[i].header);
+        }
+        if (!seen) {
+            fprintf(fp, "#include \"%s\"\n", entries[i].header.c_str());
+        }
+    }
+    fprintf(fp, "\nenum AssetId {\n");
+    for (const Entry &e : entries) {
+        fprintf(fp, "    ASSET_%s,\n", upper(e.name).c_str());
+    }
+    fprintf(fp, "    ASSET_COUNT\n};\n\n");
+    fprintf(fp, "/** images and fonts by reference, indexed by AssetId */\n");
+    fprintf(fp, "const Asset asset_table[ASSET_COUNT] = {\n");
+    for (const Entry &e : entries) {
+        const char *data = (e.format == ASSET_ATLAS_FONT) ? "&" : "";
+        fprintf(fp, "    { \"%s\", %s, %d, %d, %d, %s%s, %s },\n", e.name.c_str(), format_enums[e.format],
+                e.width, e.height, e.stride, data, e.name.c_str(), e.size.c_str());
+    }
+    fprintf(fp, "};\n\n");
+    fprintf(fp, "/** Look up an asset by name, NULL if there is none */\n");
+    fprintf(fp, "inline const Asset *asset_find(const char *name)\n{\n");
+    fprintf(fp, "    return asset_lookup(asset_table, ASSET_COUNT, name);\n}\n\n#endif\n");
+    fclose(fp);
+
+    printf("%-22s %-10s %9s %8s  %s\n", "asset", "format", "size", "bytes", "header");
+    for (const Entry &e : entries) {
+        char size[32];
+        snprintf(size, sizeof(size), "%d x %d", e.width, e.height);
+        printf("%-22s %-10s %9s %8u  %s\n", e.name.c_str(), format_names[e.format], size, e.bytes, e.header.c_str());
+    }
+    printf("%u assets, %u bytes of const data  %s\n", (unsigned)entries.size(), total, path.c_str());
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    std::string dir = (argc > 1) ? argv[1] : "../images";
+
+    std::vector<Entry> entries = builtin();
+    if (!manifest(dir, entries) || !registry(dir, entries)) {
+        return 1;
+    }
+    return 0;
+}
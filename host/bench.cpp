@@ -0,0 +1,560 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * SPI traffic benchmark for the ST7735S drawing primitives.
+ *
+ * Every workload runs a fixed sequence of calls against the controller
+ * model and reports, per workload and per call, the bytes on the wire,
+ * the number of commands, CS and D/C toggles and SPI::write transactions,
+ * plus the bus time at the SPI clock set by ST7735S::init. The CRC of the
+ * panel content allows to check that an optimization renders the same.
+ *
+ * All workloads run once per render mode and pixel format, followed by
+ * flush(); the exit status is 2 when a mode renders different panel
+ * content than DIRECT in the same pixel format or the controller timing
+ * is violated. boot_to_first_pixel constructs a new display, its bus_us
+ * is the time from power-up to the first pixel written.
+ *
+ *   st7735s_bench [--json] [-o file] [--window-cost bytes]
+ *
+ * --window-cost sets the cost model FRAMEBUFFER mode uses to merge dirty
+ * rectangles, to tune it against the measured bus time.
+ */
+
+#include <chrono>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "ST7735SModel.h"
+#include "NumberField.h"
+#include "DrawQueue.h"
+
+#include "fonts/Arial12x12.h"
+#include "fonts/font_big.h"
+#include "images/ImageData.h"
+#include "images/ekimemo.h"
+#include "images/ImageData_q565.h"
+
+struct Workload {
+    const char *name;
+    int calls;                  // primitive calls made by run()
+    void (*run)(ST7735S &tft);
+};
+
+struct Mode {
+    const char *name;
+    ST7735S::RenderMode mode;
+    ST7735S::FlushMode flush;
+    ST7735S::ColorMode color;
+};
+
+static const Mode modes[] = {
+    { "direct",         ST7735S::DIRECT,        ST7735S::FLUSH_RECTS,   ST7735S::COLOR_RGB565 },
+    { "framebuffer",    ST7735S::FRAMEBUFFER,   ST7735S::FLUSH_RECTS,   ST7735S::COLOR_RGB565 },
+    { "tiles",          ST7735S::FRAMEBUFFER,   ST7735S::FLUSH_TILES,   ST7735S::COLOR_RGB565 },
+    { "direct444",      ST7735S::DIRECT,        ST7735S::FLUSH_RECTS,   ST7735S::COLOR_RGB444 },
+    { "framebuffer444", ST7735S::FRAMEBUFFER,   ST7735S::FLUSH_RECTS,   ST7735S::COLOR_RGB444 },
+    { "tiles444",       ST7735S::FRAMEBUFFER,   ST7735S::FLUSH_TILES,   ST7735S::COLOR_RGB444 },
+};
+
+struct Result {
+    const Workload *w;
+    const Mode *m;
+    uint32_t bytes;
+    uint32_t commands;
+    uint32_t cs_toggles;
+    uint32_t dc_toggles;
+    uint32_t transactions;
+    uint64_t bus_ns;
+    uint64_t host_ns;
+    uint32_t tiles_sent;
+    uint32_t tiles_skipped;
+    uint32_t timing_violations;
+    uint32_t crc;
+};
+
+static uint32_t lcg(uint32_t &seed)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+static void run_pixel(ST7735S &tft)
+{
+    uint32_t seed = 1;
+    for (int i = 0; i < 1000; i++) {
+        tft.pixel(lcg(seed) % 160, lcg(seed) % 80, lcg(seed) & 0xFFFF);
+    }
+}
+
+static void run_line(ST7735S &tft)
+{
+    for (int i = 0; i < 16; i++) {
+        tft.line(80, 40, i * 10, 0, Red);
+        tft.line(80, 40, 159 - i * 10, 79, Green);
+    }
+}
+
+static void run_rect(ST7735S &tft)
+{
+    for (int i = 0; i < 16; i++) {
+        tft.rect(i * 2, i, 159 - i * 3, 79 - i * 2, White);
+    }
+}
+
+static void run_fillrect(ST7735S &tft)
+{
+    for (int i = 0; i < 16; i++) {
+        tft.fillrect((i % 4) * 40, (i / 4) * 20, (i % 4) * 40 + 39, (i / 4) * 20 + 19, i * 0x1111);
+    }
+}
+
+static void run_circle(ST7735S &tft)
+{
+    for (int r = 5; r <= 35; r += 5) {
+        tft.circle(80, 40, r, Yellow);
+    }
+}
+
+static void run_fillcircle(ST7735S &tft)
+{
+    tft.fillcircle(20, 40, 5, Red);
+    tft.fillcircle(50, 40, 10, Green);
+    tft.fillcircle(90, 40, 20, Blue);
+    tft.fillcircle(130, 40, 30, Yellow);
+}
+
+static void run_blitbit(ST7735S &tft)
+{
+    static const unsigned char icon[32] = {
+        0x01, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x0F, 0xF0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0xFF, 0xFF,
+        0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+    };
+
+    tft.foreground(Yellow);
+    tft.background(Navy);
+    for (int i = 0; i < 8; i++) {
+        tft.blitbit(i * 20, (i & 1) * 40 + 10, 16, 16, (const char *)icon);
+    }
+}
+
+/* 40 x 24 icons out of a 64 pixel wide sheet, the outer ones clipped */
+static void run_bitmap_sheet(ST7735S &tft)
+{
+    static uint8_t sheet[8 * 24];
+    for (int i = 0; i < (int)sizeof(sheet); i++) {
+        sheet[i] = (uint8_t)(i * 73 + (i >> 3));
+    }
+    for (int i = 0; i < 5; i++) {
+        tft.bitmap(i * 40 - 20, (i & 1) * 50 + 3, 40, 24, sheet + (i & 1), 8, White, Maroon);
+    }
+}
+
+static void run_char_small(ST7735S &tft)
+{
+    tft.set_font((unsigned char *) Arial12x12);
+    tft.foreground(Yellow);
+    tft.background(Navy);
+    tft.locate(2, 4);
+    tft.printf("ABCDabcd1234");
+}
+
+static void run_char_big(ST7735S &tft)
+{
+    tft.set_font((unsigned char *) Neu42x35);
+    tft.foreground(Yellow);
+    tft.background(DarkGrey);
+    tft.locate(20, 40 - (35 / 2));
+    tft.printf("12:34");
+}
+
+static void run_clock_redraw(ST7735S &tft)
+{
+    const char *times[3] = { "12:34", "12:34", "12:35" };
+
+    tft.set_font((unsigned char *) Neu42x35);
+    tft.foreground(Yellow);
+    tft.background(DarkGrey);
+    for (int i = 0; i < 3; i++) {
+        tft.locate(20, 40 - (35 / 2));
+        tft.printf("%s", times[i]);
+        tft.flush();
+    }
+}
+
+/* the DEMO_CLOCK loop of main.cpp */
+static void run_demo_clock(ST7735S &tft)
+{
+    char s[6];
+
+    tft.set_font((unsigned char *) Neu42x35);
+    tft.foreground(Yellow);
+    tft.background(DarkGrey);
+    for (int i = 0; i < 5; i++) {
+        tft.locate(20, 40 - (35 / 2));
+        sprintf(s, "12:3%c", i + '0');
+        tft.printf("%s", s);
+        tft.flush();
+    }
+}
+
+static void run_demo_clock_opaque(ST7735S &tft)
+{
+    tft.set_text_mode(ST7735S::TEXT_OPAQUE);
+    run_demo_clock(tft);
+    tft.set_text_mode(ST7735S::TEXT_CELL);
+}
+
+/* the DEMO_CLOCK loop through a NumberField */
+static void run_demo_clock_field(ST7735S &tft)
+{
+    NumberField clock(tft, 20, 40 - (35 / 2));
+
+    tft.set_font((unsigned char *) Neu42x35);
+    tft.foreground(Yellow);
+    tft.background(DarkGrey);
+    for (int i = 0; i < 5; i++) {
+        clock.printf("12:3%c", i + '0');
+        tft.flush();
+    }
+}
+
+static void run_char_big_transparent(ST7735S &tft)
+{
+    tft.set_text_mode(ST7735S::TEXT_TRANSPARENT);
+    run_char_big(tft);
+    tft.set_text_mode(ST7735S::TEXT_CELL);
+}
+
+/* a label over a photo, the text mode paints nothing but the glyphs */
+static void run_label_on_image(ST7735S &tft)
+{
+    tft.Paint_DrawImage(gImage_0inch96_1, 0, 0, 160, 80);
+    tft.set_font((unsigned char *) Arial12x12);
+    tft.set_text_mode(ST7735S::TEXT_TRANSPARENT);
+    tft.foreground(Red);
+    tft.locate(4, 4);
+    tft.printf("Label 12:34");
+    tft.set_text_mode(ST7735S::TEXT_CELL);
+}
+
+/* DEMO_SCROLL: 10 steps of 2 lines, re-sending the whole frame */
+static void run_scroll_redraw(ST7735S &tft)
+{
+    for (int i = 0; i < 20; i += 2) {
+        tft.Paint_DrawImage(ekimemo_bmp + (i * 160 * 2), 0, 0, 160, 80);
+        tft.flush();
+    }
+}
+
+/* 10 hardware scroll steps of 2 columns, streaming only the new columns */
+static void run_scroll_hw(ST7735S &tft)
+{
+    tft.scroll_area(0, 159);
+    for (int i = 0; i < 20; i += 2) {
+        tft.scroll_image(ekimemo_bmp + (80 * 160 + i) * 2, 160, 2);
+        tft.flush();
+    }
+    tft.scroll_reset();
+}
+
+static void run_image_redraw(ST7735S &tft)
+{
+    for (int i = 0; i < 2; i++) {
+        tft.Paint_DrawImage(gImage_0inch96_1, 0, 0, 160, 80);
+        tft.flush();
+    }
+}
+
+static void run_image_full(ST7735S &tft)
+{
+    tft.Paint_DrawImage(gImage_0inch96_1, 0, 0, 160, 80);
+}
+
+static void run_image_small(ST7735S &tft)
+{
+    for (int i = 0; i < 4; i++) {
+        tft.Paint_DrawImage(gImage_0inch96_1, i * 40, 20, 32, 32);
+    }
+}
+
+static void run_image_q565(ST7735S &tft)
+{
+    tft.draw_image_q565(gImage_0inch96_1_q565, 0, 0);
+}
+
+static void run_image_async(ST7735S &tft)
+{
+    tft.draw_image_async(gImage_0inch96_1, 0, 0, 160, 80);
+    tft.async_wait();
+}
+
+/* 32 x 32 overlay with a horizontal alpha ramp over the picture, read back
+ * from GRAM in DIRECT mode */
+static void run_blend(ST7735S &tft)
+{
+    static uint8_t alpha[32 * 32];
+    for (int i = 0; i < 32 * 32; i++) {
+        alpha[i] = (i % 32) * 255 / 31;
+    }
+    tft.Paint_DrawImage(gImage_0inch96_1, 0, 0, 160, 80);
+    for (int i = 0; i < 4; i++) {
+        tft.draw_image_blend(gImage_0inch96_1 + (80 * 160 - 32 * 32) * 2, alpha, i * 40, 20, 32, 32, 192);
+    }
+}
+
+/* a frame of bars and labels, drawn directly and through a DrawQueue;
+ * both have to send the same traffic */
+static void frame(ST7735S &tft, DrawQueue *q)
+{
+    char s[8];
+    tft.set_font((unsigned char *)Arial12x12);
+    for (int i = 0; i < 16; i++) {
+        int x = i * 10;
+        int h = 10 + (i * 37) % 60;
+        snprintf(s, sizeof(s), "%d", h);
+        if (q != NULL) {
+            q->fillrect(x, 0, x + 8, 79 - h, Black);
+            q->fillrect(x, 80 - h, x + 8, 79, (i & 1) ? Green : Blue);
+            q->text(x, 80 - h, s, White, Black);
+        } else {
+            tft.fillrect(x, 0, x + 8, 79 - h, Black);
+            tft.fillrect(x, 80 - h, x + 8, 79, (i & 1) ? Green : Blue);
+            tft.foreground(White);
+            tft.background(Black);
+            tft.locate(x, 80 - h);
+            tft.puts(s);
+        }
+    }
+
+    // a gradient through the span interface, the row buffer is refilled
+    // while the queue still holds the previous row
+    uint16_t row[20];
+    if (q != NULL) {
+        q->begin_region(130, 2, 28, 6);
+    } else {
+        tft.begin_region(130, 2, 28, 6);
+    }
+    for (int y = 0; y < 6; y++) {
+        for (int i = 0; i < 20; i++) {
+            row[i] = ((i + y) << 11) | (i << 6) | (31 - i);
+        }
+        if (q != NULL) {
+            q->push_pixels(row, 20);
+            q->push_repeat(White, 8);
+        } else {
+            tft.push_pixels(row, 20);
+            tft.push_repeat(White, 8);
+        }
+    }
+    if (q != NULL) {
+        q->end_region();
+    } else {
+        tft.end_region();
+    }
+}
+
+static void run_frame(ST7735S &tft)
+{
+    frame(tft, NULL);
+}
+
+static DrawQueue::Stats queue_stats;
+
+static void run_frame_queued(ST7735S &tft)
+{
+    DrawQueue q(tft);
+    frame(tft, &q);
+    q.flush();
+    q.sync();
+    queue_stats = q.stats();
+}
+
+static void run_cls(ST7735S &tft)
+{
+    tft.background(Navy);
+    tft.cls();
+}
+
+/* power-up to the first pixel on the panel, bus_us is the boot time;
+ * must stay the last workload as it resets the controller under tft */
+static void run_boot(ST7735S &tft)
+{
+    ST7735S boot(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "BOOT",
+                 (tft.framebuffer() != NULL) ? ST7735S::FRAMEBUFFER : ST7735S::DIRECT);
+    if (tft.color_mode() != boot.color_mode()) {
+        boot.set_color_mode(tft.color_mode());
+    }
+    boot.pixel(0, 0, White);
+    boot.flush();
+}
+
+static const Workload workloads[] = {
+    { "pixel",              1000,   run_pixel },
+    { "line",               32,     run_line },
+    { "rect",               16,     run_rect },
+    { "fillrect",           16,     run_fillrect },
+    { "circle",             7,      run_circle },
+    { "fillcircle",         4,      run_fillcircle },
+    { "blitbit_16x16",      8,      run_blitbit },
+    { "bitmap_40x24_sheet", 5,      run_bitmap_sheet },
+    { "character_12x12",    12,     run_char_small },
+    { "character_42x35",    5,      run_char_big },
+    { "demo_clock",         25,     run_demo_clock },
+    { "demo_clock_opaque",  25,     run_demo_clock_opaque },
+    { "demo_clock_field",   25,     run_demo_clock_field },
+    { "character_42x35_transparent", 5, run_char_big_transparent },
+    { "label_on_image",     12,     run_label_on_image },
+    { "clock_redraw",       15,     run_clock_redraw },
+    { "Paint_DrawImage_160x80", 1,  run_image_full },
+    { "Paint_DrawImage_32x32",  4,  run_image_small },
+    { "draw_image_async_160x80", 1, run_image_async },
+    { "draw_image_q565_160x80", 1,  run_image_q565 },
+    { "Paint_DrawImage_redraw", 2,  run_image_redraw },
+    { "scroll_redraw",      10,     run_scroll_redraw },
+    { "scroll_hw",          10,     run_scroll_hw },
+    { "blend_overlay_32x32", 4,     run_blend },
+    { "frame",              48,     run_frame },
+    { "frame_queued",       48,     run_frame_queued },
+    { "cls",                1,      run_cls },
+    { "boot_to_first_pixel", 1,     run_boot },
+};
+
+static Result measure(ST7735S &tft, ST7735SModel &model, const Mode &m, const Workload &w)
+{
+    HostBus &bus = HostBus::instance();
+    Result r;
+
+    tft.foreground(White);
+    tft.background(Black);
+    tft.cls();
+    tft.flush();
+
+    ST7735S::FlushStats fs = tft.flush_stats();
+    model.reset_stats();
+    bus.reset_stats();
+    uint64_t bus_start = bus.now_ns();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    w.run(tft);
+    tft.flush();
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+    r.w = &w;
+    r.m = &m;
+    r.bytes = model.stats().bytes;
+    r.commands = model.stats().cmd_bytes;
+    r.cs_toggles = model.stats().cs_toggles;
+    r.dc_toggles = model.stats().dc_toggles;
+    r.transactions = bus.stats().spi_transactions;
+    r.bus_ns = bus.now_ns() - bus_start;
+    r.host_ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    r.tiles_sent = tft.flush_stats().tiles_sent - fs.tiles_sent;
+    r.tiles_skipped = tft.flush_stats().tiles_skipped - fs.tiles_skipped;
+    r.timing_violations = model.stats().timing_violations;
+    r.crc = model.crc32();
+    return r;
+}
+
+static void print_csv(FILE *fp, const Result *res, int n)
+{
+    fprintf(fp, "workload,mode,calls,bytes,bytes_per_call,commands,commands_per_call,"
+                "cs_toggles,dc_toggles,spi_transactions,bus_us,host_us,tiles_sent,tiles_skipped,timing_violations,crc32\n");
+    for (int i = 0; i < n; i++) {
+        const Result &r = res[i];
+        fprintf(fp, "%s,%s,%d,%u,%.1f,%u,%.1f,%u,%u,%u,%.1f,%.1f,%u,%u,%u,%08x\n",
+                r.w->name, r.m->name, r.w->calls, r.bytes, (double)r.bytes / r.w->calls,
+                r.commands, (double)r.commands / r.w->calls,
+                r.cs_toggles, r.dc_toggles, r.transactions,
+                r.bus_ns / 1e3, r.host_ns / 1e3, r.tiles_sent, r.tiles_skipped, r.timing_violations, r.crc);
+    }
+}
+
+static void print_json(FILE *fp, const Result *res, int n)
+{
+    fprintf(fp, "[\n");
+    for (int i = 0; i < n; i++) {
+        const Result &r = res[i];
+        fprintf(fp, "  {\"workload\": \"%s\", \"mode\": \"%s\", \"calls\": %d, \"bytes\": %u, \"bytes_per_call\": %.1f, "
+                    "\"commands\": %u, \"commands_per_call\": %.1f, \"cs_toggles\": %u, \"dc_toggles\": %u, "
+                    "\"spi_transactions\": %u, \"bus_us\": %.1f, \"host_us\": %.1f, \"tiles_sent\": %u, \"tiles_skipped\": %u, \"timing_violations\": %u, \"crc32\": \"%08x\"}%s\n",
+                r.w->name, r.m->name, r.w->calls, r.bytes, (double)r.bytes / r.w->calls,
+                r.commands, (double)r.commands / r.w->calls,
+                r.cs_toggles, r.dc_toggles, r.transactions,
+                r.bus_ns / 1e3, r.host_ns / 1e3, r.tiles_sent, r.tiles_skipped, r.timing_violations, r.crc, (i + 1 < n) ? "," : "");
+    }
+    fprintf(fp, "]\n");
+}
+
+int main(int argc, char **argv)
+{
+    bool json = false;
+    const char *path = NULL;
+    int window_cost = -1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc)) {
+            path = argv[++i];
+        } else if ((strcmp(argv[i], "--window-cost") == 0) && (i + 1 < argc)) {
+            window_cost = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--json] [-o file] [--window-cost bytes]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+
+    const int nw = sizeof(workloads) / sizeof(workloads[0]);
+    const int nm = sizeof(modes) / sizeof(modes[0]);
+    const int n = nw * nm;
+    Result res[n];
+    int status = 0;
+    for (int j = 0; j < nm; j++) {
+        // results are compared against the first mode with the same pixel format
+        int ref = 0;
+        while (modes[ref].color != modes[j].color) {
+            ref++;
+        }
+        ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT", modes[j].mode);
+        tft.set_flush_mode(modes[j].flush);
+        tft.set_color_mode(modes[j].color);
+        if (window_cost >= 0) {
+            tft.set_window_cost(window_cost);
+        }
+        for (int i = 0; i < nw; i++) {
+            Result &r = res[i * nm + j];
+            r = measure(tft, model, modes[j], workloads[i]);
+            if (r.crc != res[i * nm + ref].crc) {
+                fprintf(stderr, "%s: %s renders differently than %s\n", r.w->name, r.m->name, modes[ref].name);
+                status = 2;
+            }
+            if (r.timing_violations != 0) {
+                fprintf(stderr, "%s: %s violates the controller timing\n", r.w->name, r.m->name);
+                status = 2;
+            }
+        }
+    }
+
+    fprintf(stderr, "frame_queued: %u commands, max depth %u of %d, %u stalls, %u syncs\n",
+            queue_stats.commands, queue_stats.max_depth, ST7735S_QUEUE_DEPTH, queue_stats.stalls, queue_stats.syncs);
+
+    FILE *fp = stdout;
+    if (path != NULL) {
+        fp = fopen(path, "w");
+        if (fp == NULL) {
+            fprintf(stderr, "cannot write %s\n", path);
+            return 1;
+        }
+    }
+    if (json) {
+        print_json(fp, res, n);
+    } else {
+        print_csv(fp, res, n);
+    }
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    return status;
+}
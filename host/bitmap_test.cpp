@@ -0,0 +1,114 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * 1 bpp bitmap test.
+ *
+ * Random bitmaps are drawn with bitmap() and compared with the same bits
+ * drawn by pixel() one by one. The sizes cover widths that are not a
+ * multiple of 8, bitmaps below ST7735S_BITMAP_LUT_MIN pixels (expanded per
+ * pixel) and above (expanded byte-wise through the lookup table), packed
+ * rows (stride 0) and rows of whole bytes, odd positions and placements
+ * clipped by the edges. Runs in DIRECT and FRAMEBUFFER mode, each in
+ * RGB565 and RGB444, the exit status is 2 on a mismatch.
+ *
+ *   st7735s_bitmap_test
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "ST7735SModel.h"
+
+static const int sizes[][2] = {
+    { 1, 1 }, { 7, 3 }, { 8, 8 }, { 13, 5 }, { 16, 16 }, { 15, 17 }, { 17, 15 },
+    { 33, 9 }, { 64, 4 }, { 61, 23 }, { 160, 80 }, { 100, 37 },
+};
+#define NSIZES ((int)(sizeof(sizes) / sizeof(sizes[0])))
+
+static const int places[][2] = {
+    { 0, 0 }, { 3, 1 }, { 37, 22 }, { -5, -2 }, { 150, 70 }, { -9, 60 },
+};
+#define NPLACES ((int)(sizeof(places) / sizeof(places[0])))
+
+static int failures;
+static uint32_t seed = 12345;
+
+static uint8_t rnd(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 16;
+}
+
+static std::vector<uint16_t> screen(ST7735SModel &model)
+{
+    std::vector<uint16_t> s(model.width() * model.height());
+    for (int y = 0; y < model.height(); y++) {
+        for (int x = 0; x < model.width(); x++) {
+            s[y * model.width() + x] = model.visible(x, y);
+        }
+    }
+    return s;
+}
+
+static void check(ST7735SModel &model, ST7735S &tft, const char *mode, int w, int h, int stride, int x0, int y0)
+{
+    int row_bits = stride ? stride * 8 : w;
+    std::vector<uint8_t> bits((row_bits * h + 7) / 8);
+    for (size_t i = 0; i < bits.size(); i++) {
+        bits[i] = rnd();
+    }
+    const int fg = 0xFFE0, bg = 0x0811;
+
+    tft.cls();
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            int b = y * row_bits + x;
+            tft.pixel(x0 + x, y0 + y, ((bits[b >> 3] << (b & 7)) & 0x80) ? fg : bg);
+        }
+    }
+    tft.flush();
+    std::vector<uint16_t> expect = screen(model);
+
+    tft.cls();
+    tft.bitmap(x0, y0, w, h, bits.data(), stride, fg, bg);
+    tft.flush();
+    std::vector<uint16_t> got = screen(model);
+
+    for (size_t i = 0; i < got.size(); i++) {
+        if (got[i] != expect[i]) {
+            fprintf(stderr, "%s %dx%d stride %d at %d,%d: %d,%d is %04X, expected %04X\n", mode, w, h, stride, x0, y0,
+                    (int)(i % model.width()), (int)(i / model.width()), got[i], expect[i]);
+            failures++;
+            return;
+        }
+    }
+}
+
+int main(void)
+{
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+    int n = 0;
+
+    for (int render = 0; render < 2; render++) {
+        ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT",
+                    render ? ST7735S::FRAMEBUFFER : ST7735S::DIRECT);
+        tft.background(Black);
+        for (int rgb444 = 0; rgb444 < 2; rgb444++) {
+            char mode[32];
+            snprintf(mode, sizeof(mode), "%s %s", render ? "framebuffer" : "direct", rgb444 ? "RGB444" : "RGB565");
+            tft.set_color_mode(rgb444 ? ST7735S::COLOR_RGB444 : ST7735S::COLOR_RGB565);
+            for (int s = 0; s < NSIZES; s++) {
+                int w = sizes[s][0], h = sizes[s][1];
+                for (int p = 0; p < NPLACES; p++) {
+                    check(model, tft, mode, w, h, 0, places[p][0], places[p][1]);
+                    check(model, tft, mode, w, h, (w + 7) / 8 + (p & 1), places[p][0], places[p][1]);
+                    n += 2;
+                }
+            }
+        }
+    }
+    printf("bitmap: %d bitmaps, LUT from %d pixels, %d failures\n", n, ST7735S_BITMAP_LUT_MIN, failures);
+    return failures ? 2 : 0;
+}
@@ -0,0 +1,135 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Circle test.
+ *
+ * circle() and fillcircle() are drawn for the radii 1 to 39 and compared
+ * with a reference computed from x^2 + y^2 alone: with a the smaller and b
+ * the larger of |dx| and |dy|, a pixel belongs to the outline when
+ * a^2 + b^2 - b < r^2 <= a^2 + b^2 + b (the midpoint walk over each octant)
+ * and to the filled circle when a^2 + b^2 - b < r^2. Besides, the filled
+ * circle has to cover every pixel of the outline and every row of it has
+ * to be one span, symmetric about the center. Centers near the edges check
+ * the clipping. DIRECT and FRAMEBUFFER mode, the exit status is 2 on a
+ * mismatch.
+ *
+ *   st7735s_circle_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "ST7735SModel.h"
+
+#define W   160
+#define H   80
+
+static int failures;
+
+static bool on_circle(int dx, int dy, int r, bool fill)
+{
+    int a = abs(dx), b = abs(dy);
+    if (a > b) {
+        int t = a;
+        a = b;
+        b = t;
+    }
+    if (fill) {
+        return a * a + b * b - b < r * r;
+    }
+    return (a * a + b * b - b < r * r) && (r * r <= a * a + b * b + b);
+}
+
+static std::vector<bool> draw(ST7735SModel &model, ST7735S &tft, int x0, int y0, int r, bool fill)
+{
+    std::vector<bool> set(W * H);
+    tft.cls();
+    if (fill) {
+        tft.fillcircle(x0, y0, r, White);
+    } else {
+        tft.circle(x0, y0, r, White);
+    }
+    tft.flush();
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            set[y * W + x] = (model.visible(x, y) == White);
+        }
+    }
+    return set;
+}
+
+static void check(ST7735SModel &model, ST7735S &tft, const char *mode, int x0, int y0, int r)
+{
+    std::vector<bool> outline = draw(model, tft, x0, y0, r, false);
+    std::vector<bool> filled = draw(model, tft, x0, y0, r, true);
+
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            bool o = on_circle(x - x0, y - y0, r, false);
+            bool f = on_circle(x - x0, y - y0, r, true);
+            if ((outline[y * W + x] != o) || (filled[y * W + x] != f)) {
+                fprintf(stderr, "%s circle %d,%d r %d: %d,%d is %d / %d, expected %d / %d\n", mode, x0, y0, r,
+                        x, y, (int)outline[y * W + x], (int)filled[y * W + x], (int)o, (int)f);
+                failures++;
+                return;
+            }
+            if (outline[y * W + x] && !filled[y * W + x]) {
+                fprintf(stderr, "%s circle %d,%d r %d: %d,%d of the outline is not filled\n", mode, x0, y0, r, x, y);
+                failures++;
+                return;
+            }
+        }
+    }
+
+    // one span per row, symmetric about x0, where the circle is on the screen
+    if ((x0 - r < 0) || (x0 + r >= W)) {
+        return;
+    }
+    for (int y = 0; y < H; y++) {
+        int first = -1, last = -1, n = 0;
+        for (int x = 0; x < W; x++) {
+            if (filled[y * W + x]) {
+                if (first < 0) {
+                    first = x;
+                }
+                last = x;
+                n++;
+            }
+        }
+        if ((n > 0) && ((n != last - first + 1) || (x0 - first != last - x0))) {
+            fprintf(stderr, "%s fillcircle %d,%d r %d: row %d is %d pixels in %d..%d\n", mode, x0, y0, r, y, n, first, last);
+            failures++;
+            return;
+        }
+    }
+}
+
+int main(void)
+{
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+    int n = 0;
+
+    for (int render = 0; render < 2; render++) {
+        ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT",
+                    render ? ST7735S::FRAMEBUFFER : ST7735S::DIRECT);
+        const char *mode = render ? "framebuffer" : "direct";
+        tft.background(Black);
+        for (int r = 1; r < 40; r++) {
+            check(model, tft, mode, 80, 40, r);
+            check(model, tft, mode, 79, 39, r);
+            n += 2;
+        }
+        // clipped by the edges
+        for (int r = 1; r < 40; r += 6) {
+            check(model, tft, mode, 3, 2, r);
+            check(model, tft, mode, 155, 77, r);
+            check(model, tft, mode, 80, -10, r);
+            n += 3;
+        }
+    }
+    printf("circle: %d circles and filled circles, %d failures\n", n, failures);
+    return failures ? 2 : 0;
+}
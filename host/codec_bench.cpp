@@ -0,0 +1,126 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Q565 size and decode throughput.
+ *
+ * For the images in images/ and a flat-colour UI screen rendered with
+ * StaticGraphics, reports the raw RGB565 size, the Q565 size (the bytes
+ * read from flash per full draw) and the decode speed on the host. Each
+ * image is also drawn with ST7735S::draw_image_q565, unclipped and
+ * clipped, and compared with the raw pixels drawn one by one; the exit
+ * status is 2 on a difference.
+ *
+ *   st7735s_codec [rounds]
+ */
+
+#include <chrono>
+#include <stdlib.h>
+#include <vector>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "StaticGraphics.h"
+#include "ST7735SModel.h"
+#include "Q565Encoder.h"
+
+#include "images/ImageData.h"
+#include "images/ekimemo.h"
+
+struct Image {
+    const char *name;
+    int width, height;
+    std::vector<uint16_t> pixels;
+};
+
+/* status bar, buttons and a gauge in a few flat colours */
+static Image ui_screen(void)
+{
+    static StaticCanvas<160, 80> c;
+    c.cls(0x2104);
+    c.fill(0, 0, 160, 12, 0x001F);
+    for (int i = 0; i < 4; i++) {
+        c.fill(4 + i * 39, 16, 35, 22, (i == 1) ? 0xFD20 : 0x4208);
+        c.rect(4 + i * 39, 16, 38 + i * 39, 37, 0xFFFF);
+    }
+    c.fill(4, 50, 152, 10, 0x0000);
+    c.fill(4, 50, 97, 10, 0x07E0);
+    for (int x = 4; x < 156; x += 19) {
+        c.line(x, 62, x, 66, 0xFFFF);
+    }
+    c.line(0, 75, 159, 70, 0xF800);
+    return Image { "ui_160x80", 160, 80, std::vector<uint16_t>(c.buffer(), c.buffer() + 160 * 80) };
+}
+
+static double seconds(std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b)
+{
+    return std::chrono::duration<double>(b - a).count();
+}
+
+/* draw_image_q565 at x, y against the pixels drawn one by one */
+static bool check_draw(ST7735S &tft, ST7735SModel &model, const Image &a, const std::vector<uint8_t> &q, int x, int y)
+{
+    tft.background(Black);
+    tft.cls();
+    tft.draw_image_q565(q.data(), x, y);
+    tft.flush();
+    uint32_t crc = model.crc32();
+
+    tft.cls();
+    for (int j = 0; j < a.height; j++) {
+        for (int i = 0; i < a.width; i++) {
+            tft.pixel(x + i, y + j, a.pixels[j * a.width + i]);
+        }
+    }
+    tft.flush();
+    return crc == model.crc32();
+}
+
+int main(int argc, char **argv)
+{
+    int rounds = (argc > 1) ? atoi(argv[1]) : 50;
+    int status = 0;
+
+    std::vector<Image> images;
+    images.push_back(Image { "gImage_0inch96_1", 160, 80, q565_pixels(gImage_0inch96_1, 160 * 80) });
+    images.push_back(Image { "ekimemo_bmp", 160, 284, q565_pixels(ekimemo_bmp, 160 * 284) });
+    images.push_back(ui_screen());
+
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+    ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT", ST7735S::DIRECT);
+
+    printf("image,width,height,raw_bytes,q565_bytes,ratio,decode_mpx_per_s\n");
+    for (const Image &a : images) {
+        int count = a.width * a.height;
+        std::vector<uint8_t> q = q565_encode(a.pixels.data(), a.width, a.height);
+        std::vector<uint16_t> line(ST7735S_DECODE_PIXELS);
+        std::vector<uint16_t> out(count);
+
+        // decode in line buffer sized chunks, like draw_image_q565
+        uint32_t sum = 0;
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            Q565Decoder dec(q.data());
+            while (int n = dec.decode(line.data(), ST7735S_DECODE_PIXELS)) {
+                sum += line[n - 1];
+            }
+        }
+        std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+        Q565Decoder dec(q.data());
+        dec.decode(out.data(), count);
+        if ((out != a.pixels) || (sum == 0xFFFFFFFF)) {
+            fprintf(stderr, "%s: round trip failed\n", a.name);
+            status = 2;
+        }
+
+        printf("%s,%d,%d,%d,%u,%.2f,%.1f\n", a.name, a.width, a.height, count * 2, (unsigned)q.size(),
+               count * 2.0 / q.size(), (double)count * rounds / seconds(t0, t1) / 1e6);
+
+        if (!check_draw(tft, model, a, q, 0, 0) || !check_draw(tft, model, a, q, -37, -11) ||
+                !check_draw(tft, model, a, q, 101, 53)) {
+            fprintf(stderr, "%s: draw_image_q565 differs from the pixels\n", a.name);
+            status = 2;
+        }
+    }
+    return status;
+}
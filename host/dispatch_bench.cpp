@@ -0,0 +1,164 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CPU microbenchmark of virtual against static dispatch.
+ *
+ * Every workload draws into a 160 x 80 StaticCanvas once through the
+ * virtual GraphicsDisplay interface (GraphicsAdapter) and once through
+ * StaticGraphics, and reports the CPU time per call of both. The canvas
+ * content has to be the same, the exit status is 2 otherwise.
+ *
+ *   st7735s_dispatch [rounds]
+ */
+
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+#include "mbed.h"
+#include "StaticGraphics.h"
+
+typedef StaticCanvas<160, 80> Canvas;
+
+static const uint8_t icon[32] = {
+    0x07, 0xE0, 0x18, 0x18, 0x20, 0x04, 0x40, 0x02, 0x4C, 0x32, 0x8C, 0x31, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x88, 0x11, 0x44, 0x22, 0x43, 0xC2, 0x20, 0x04, 0x18, 0x18, 0x07, 0xE0, 0x00, 0x00,
+};
+
+static int colours32[32 * 32];
+static uint16_t colours16[32 * 32];
+
+/* the virtual side only sees GraphicsDisplay, noinline keeps the compiler
+ * from devirtualizing the calls */
+__attribute__((noinline)) static void v_pixel(GraphicsDisplay &g)
+{
+    for (int y = 0; y < 80; y++) {
+        for (int x = 0; x < 160; x++) {
+            g.pixel(x, y, x ^ y);
+        }
+    }
+}
+
+__attribute__((noinline)) static void s_pixel(Canvas &c)
+{
+    for (int y = 0; y < 80; y++) {
+        for (int x = 0; x < 160; x++) {
+            c.pixel(x, y, x ^ y);
+        }
+    }
+}
+
+__attribute__((noinline)) static void v_fill(GraphicsDisplay &g)
+{
+    for (int i = 0; i < 16; i++) {
+        g.fill((i % 4) * 40, (i / 4) * 20, 40, 20, i * 0x1111);
+    }
+}
+
+__attribute__((noinline)) static void s_fill(Canvas &c)
+{
+    for (int i = 0; i < 16; i++) {
+        c.fill((i % 4) * 40, (i / 4) * 20, 40, 20, i * 0x1111);
+    }
+}
+
+__attribute__((noinline)) static void v_blit(GraphicsDisplay &g)
+{
+    for (int i = 0; i < 4; i++) {
+        g.blit(i * 40, 24, 32, 32, colours32);
+    }
+}
+
+__attribute__((noinline)) static void s_blit(Canvas &c)
+{
+    for (int i = 0; i < 4; i++) {
+        c.blit(i * 40, 24, 32, 32, colours16);
+    }
+}
+
+__attribute__((noinline)) static void v_blitbit(GraphicsDisplay &g)
+{
+    g.foreground(0xFFE0);
+    g.background(0x001F);
+    for (int i = 0; i < 8; i++) {
+        g.blitbit(i * 20, (i & 1) * 40 + 10, 16, 16, (const char *)icon);
+    }
+}
+
+__attribute__((noinline)) static void s_blitbit(Canvas &c)
+{
+    for (int i = 0; i < 8; i++) {
+        c.blitbit(i * 20, (i & 1) * 40 + 10, 16, 16, (const char *)icon, 0xFFE0, 0x001F);
+    }
+}
+
+/* partly off the canvas, the regions go through the clipped pixel path */
+__attribute__((noinline)) static void v_clipped(GraphicsDisplay &g)
+{
+    for (int i = 0; i < 8; i++) {
+        g.fill(i * 24 - 12, -8, 16, 96, i * 0x0841);
+    }
+}
+
+__attribute__((noinline)) static void s_clipped(Canvas &c)
+{
+    for (int i = 0; i < 8; i++) {
+        c.fill(i * 24 - 12, -8, 16, 96, i * 0x0841);
+    }
+}
+
+struct Workload {
+    const char *name;
+    int calls;
+    void (*v)(GraphicsDisplay &g);
+    void (*s)(Canvas &c);
+};
+
+static const Workload workloads[] = {
+    { "pixel",          160 * 80,   v_pixel,    s_pixel },
+    { "fill_40x20",     16,         v_fill,     s_fill },
+    { "blit_32x32",     4,          v_blit,     s_blit },
+    { "blitbit_16x16",  8,          v_blitbit,  s_blitbit },
+    { "fill_clipped",   8,          v_clipped,  s_clipped },
+};
+
+static double seconds(std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b)
+{
+    return std::chrono::duration<double>(b - a).count();
+}
+
+int main(int argc, char **argv)
+{
+    int rounds = (argc > 1) ? atoi(argv[1]) : 200;
+    int status = 0;
+
+    for (int i = 0; i < 32 * 32; i++) {
+        colours32[i] = colours16[i] = (uint16_t)(i * 37);
+    }
+
+    static Canvas vc, sc;
+    GraphicsAdapter<Canvas> adapter(vc);
+
+    printf("workload,calls,virtual_ns_per_call,static_ns_per_call,speedup\n");
+    for (const Workload &w : workloads) {
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            w.v(adapter);
+        }
+        std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            w.s(sc);
+        }
+        std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+        double vns = seconds(t0, t1) * 1e9 / rounds / w.calls;
+        double sns = seconds(t1, t2) * 1e9 / rounds / w.calls;
+        printf("%s,%d,%.1f,%.1f,%.2f\n", w.name, w.calls, vns, sns, vns / sns);
+        if (memcmp(vc.buffer(), sc.buffer(), 160 * 80 * 2) != 0) {
+            fprintf(stderr, "%s: virtual and static dispatch draw differently\n", w.name);
+            status = 2;
+        }
+    }
+
+    return status;
+}
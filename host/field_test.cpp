@@ -0,0 +1,99 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * NumberField test.
+ *
+ * A NumberField is updated through a sequence of strings: digits with
+ * fixed advance, characters of other widths, shorter and longer strings
+ * and a field running past the right edge of the display. After every
+ * update the panel has to hold exactly what a full redraw of the same
+ * string into a cleared screen gives (CRC of the controller GRAM), while
+ * the incremental updates have to skip characters. GLCD and atlas fonts,
+ * DIRECT and FRAMEBUFFER mode, the exit status is 2 on a mismatch.
+ *
+ *   st7735s_field_test
+ */
+
+#include <stdio.h>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "NumberField.h"
+#include "ST7735SModel.h"
+
+#include "fonts/Arial12x12.h"
+#include "fonts/Arial24x23_atlas.h"
+
+static const char *strings[] = {
+    "12:34", "12:35", "12:45", "13:00", "9:59", "10:00", "10:00", "1", "",
+    "88:88", "11:11", "-7.25", "1234567890", "123", "W1", "1W", "00:00",
+};
+#define NSTRINGS ((int)(sizeof(strings) / sizeof(strings[0])))
+
+static int failures;
+
+/* the font and colors of the field; text mode and fixed digits stay at
+ * their defaults to see that the field restores them */
+static void setup(ST7735S &tft, int font)
+{
+    if (font) {
+        tft.set_font(&Arial24x23_atlas);
+    } else {
+        tft.set_font((unsigned char *)Arial12x12);
+    }
+    tft.foreground(Yellow);
+    tft.background(Navy);
+}
+
+static void run(ST7735SModel &model, ST7735S::RenderMode render, int font, int x, int y)
+{
+    ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT", render);
+    const char *what = (render == ST7735S::DIRECT) ? "direct" : "framebuffer";
+
+    setup(tft, font);
+    for (int i = 0; i < NSTRINGS; i++) {
+        // strings 0..i one after the other
+        tft.cls();
+        NumberField field(tft, x, y);
+        for (int k = 0; k <= i; k++) {
+            field.update(strings[k]);
+        }
+        tft.flush();
+        uint32_t crc = model.crc32();
+        if ((i == 1) && (field.skipped() == 0)) {
+            fprintf(stderr, "%s font %d: \"%s\" after \"%s\" skipped nothing\n", what, font, strings[1], strings[0]);
+            failures++;
+        }
+        if ((tft.text_mode() != ST7735S::TEXT_CELL) || tft.fixed_digits()) {
+            fprintf(stderr, "%s font %d: the field changed the text mode of the display\n", what, font);
+            failures++;
+        }
+
+        // the last string drawn in full on a cleared screen
+        tft.cls();
+        NumberField full(tft, x, y);
+        full.update(strings[i]);
+        tft.flush();
+        if (model.crc32() != crc) {
+            fprintf(stderr, "%s font %d field %d,%d: \"%s\" after \"%s\" differs from a full redraw\n",
+                    what, font, x, y, strings[i], (i > 0) ? strings[i - 1] : "");
+            failures++;
+            return;
+        }
+    }
+}
+
+int main(void)
+{
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+
+    for (int render = 0; render < 2; render++) {
+        ST7735S::RenderMode mode = render ? ST7735S::FRAMEBUFFER : ST7735S::DIRECT;
+        for (int font = 0; font < 2; font++) {
+            run(model, mode, font, 5, 10);
+            run(model, mode, font, 110, 40);       // longer strings reach the right edge
+        }
+    }
+    printf("field: %d strings x 2 modes x 2 fonts x 2 places, %d failures\n", NSTRINGS, failures);
+    return failures ? 2 : 0;
+}
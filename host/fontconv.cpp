@@ -0,0 +1,159 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Convert the GLCD fonts in fonts/ to row-major glyph atlases.
+ *
+ * For every character the tight bounding box of the set pixels inside the
+ * hor x vert cell is searched, and the rows of that box are written MSB
+ * first, padded to whole bytes (see ST7735S/GlyphAtlas.h). The result is
+ * a header per font next to the source font:
+ *
+ *   fontconv [dir]     writes dir/<font>_atlas.h, dir defaults to ../fonts
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "GlyphAtlas.h"
+
+#include "fonts/Arial12x12.h"
+#include "fonts/Arial24x23.h"
+#include "fonts/Arial28x28.h"
+#include "fonts/font_big.h"
+
+struct Font {
+    const char *name;
+    const char *source;
+    const unsigned char *data;
+    size_t size;
+};
+
+static const Font fonts[] = {
+    { "Arial12x12", "Arial12x12.h", Arial12x12, sizeof(Arial12x12) },
+    { "Arial24x23", "Arial24x23.h", Arial24x23, sizeof(Arial24x23) },
+    { "Arial28x28", "Arial28x28.h", Arial28x28, sizeof(Arial28x28) },
+    { "Neu42x35",   "font_big.h",   Neu42x35,   sizeof(Neu42x35) },
+};
+
+static bool glcd_bit(const unsigned char *ch, int bpl, int i, int j)
+{
+    return (ch[bpl * i + (j >> 3) + 1] & (1 << (j & 0x07))) != 0;
+}
+
+static bool convert(const Font &f, const char *dir)
+{
+    int offset = f.data[0];
+    int hor = f.data[1];
+    int vert = f.data[2];
+    int bpl = f.data[3];
+    int count = (int)((f.size - 4) / offset);
+    std::vector<AtlasGlyph> glyphs;
+    std::vector<uint8_t> bitmap;
+
+    for (int c = 0; c < count; c++) {
+        const unsigned char *ch = &f.data[c * offset + 4];
+        int x0 = hor, y0 = vert, x1 = -1, y1 = -1;
+
+        for (int j = 0; j < vert; j++) {
+            for (int i = 0; i < hor; i++) {
+                if (glcd_bit(ch, bpl, i, j)) {
+                    if (i < x0) x0 = i;
+                    if (i > x1) x1 = i;
+                    if (j < y0) y0 = j;
+                    if (j > y1) y1 = j;
+                }
+            }
+        }
+
+        AtlasGlyph g;
+        g.offset = (uint16_t)bitmap.size();
+        g.advance = ch[0];
+        if (x1 < 0) {
+            g.x = g.y = g.w = g.h = 0;
+        } else {
+            g.x = (uint8_t)x0;
+            g.y = (uint8_t)y0;
+            g.w = (uint8_t)(x1 - x0 + 1);
+            g.h = (uint8_t)(y1 - y0 + 1);
+        }
+        for (int j = 0; j < g.h; j++) {
+            for (int b = 0; b < g.w; b += 8) {
+                uint8_t byte = 0;
+                for (int k = 0; (k < 8) && (b + k < g.w); k++) {
+                    if (glcd_bit(ch, bpl, g.x + b + k, g.y + j)) {
+                        byte |= 0x80 >> k;
+                    }
+                }
+                bitmap.push_back(byte);
+            }
+        }
+        if (bitmap.size() > 0xFFFF) {
+            fprintf(stderr, "%s: bitmap exceeds 16 bit offsets\n", f.name);
+            return false;
+        }
+        glyphs.push_back(g);
+    }
+
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s_atlas.h", dir, f.name);
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL) {
+        perror(path);
+        return false;
+    }
+
+    fprintf(fp, "//Glyph atlas of %s generated by host/fontconv, do not edit\n", f.source);
+    fprintf(fp, "//Cell %d x %d, %d characters from 0x20, %u bitmap bytes\n\n", hor, vert, count, (unsigned)bitmap.size());
+    char guard[64];
+    snprintf(guard, sizeof(guard), "%s_ATLAS_H", f.name);
+    for (char *p = guard; *p; p++) {
+        *p = toupper((unsigned char)*p);
+    }
+    fprintf(fp, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(fp, "#include \"GlyphAtlas.h\"\n\n");
+
+    fprintf(fp, "const uint8_t %s_atlas_bitmap[] = {", f.name);
+    for (size_t i = 0; i < bitmap.size(); i++) {
+        fprintf(fp, "%s0x%02X,", (i % 16) ? " " : "\n        ", bitmap[i]);
+    }
+    fprintf(fp, "\n};\n\n");
+
+    fprintf(fp, "const AtlasGlyph %s_atlas_glyphs[] = {\n", f.name);
+    for (size_t i = 0; i < glyphs.size(); i++) {
+        const AtlasGlyph &g = glyphs[i];
+        int c = 0x20 + (int)i;
+        fprintf(fp, "        { %5u, %2u, %2u, %2u, %2u, %2u },  // ",
+                g.offset, g.advance, g.x, g.y, g.w, g.h);
+        // no backslash at the end of a line comment
+        if ((c > 0x20) && (c < 0x7F) && (c != '\\')) {
+            fprintf(fp, "Code for char %c\n", c);
+        } else {
+            fprintf(fp, "Code for char 0x%02X\n", c);
+        }
+    }
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "/** %s as row-major glyph atlas, see GlyphAtlas.h */\n", f.name);
+    fprintf(fp, "const GlyphAtlas %s_atlas = { 0x20, %d, %d, %d, %s_atlas_glyphs, %s_atlas_bitmap };\n\n",
+            f.name, count, hor, vert, f.name, f.name);
+    fprintf(fp, "#endif\n");
+    fclose(fp);
+
+    printf("%-12s %3d glyphs, %6u -> %6u bytes  %s\n", f.name, count,
+           (unsigned)f.size, (unsigned)(bitmap.size() + glyphs.size() * sizeof(AtlasGlyph)), path);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = (argc > 1) ? argv[1] : "../fonts";
+
+    for (size_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        if (!convert(fonts[i], dir)) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CPU microbenchmark of the glyph renderers.
+ *
+ * Renders the printable characters of every font once from the GLCD
+ * column-major array and once from the generated glyph atlas, in every
+ * text mode. The CPU time is taken in FRAMEBUFFER mode without flush, so
+ * no bus traffic is involved; the wire bytes are counted in DIRECT mode
+ * against the controller model. Both renderers must produce the same framebuffer and
+ * the same panel content, the exit status is 2 otherwise.
+ *
+ *   st7735s_glyphs [rounds]
+ */
+
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "ST7735SModel.h"
+
+#include "fonts/Arial12x12.h"
+#include "fonts/Arial24x23.h"
+#include "fonts/Arial28x28.h"
+#include "fonts/font_big.h"
+#include "fonts/Arial12x12_atlas.h"
+#include "fonts/Arial24x23_atlas.h"
+#include "fonts/Arial28x28_atlas.h"
+#include "fonts/Neu42x35_atlas.h"
+
+struct FontPair {
+    const char *name;
+    const unsigned char *glcd;
+    const GlyphAtlas *atlas;
+};
+
+static const FontPair fonts[] = {
+    { "Arial12x12", Arial12x12, &Arial12x12_atlas },
+    { "Arial24x23", Arial24x23, &Arial24x23_atlas },
+    { "Arial28x28", Arial28x28, &Arial28x28_atlas },
+    { "Neu42x35",   Neu42x35,   &Neu42x35_atlas },
+};
+
+struct TextMode {
+    const char *name;
+    ST7735S::TextMode mode;
+};
+
+static const TextMode text_modes[] = {
+    { "cell",           ST7735S::TEXT_CELL },
+    { "opaque",         ST7735S::TEXT_OPAQUE },
+    { "transparent",    ST7735S::TEXT_TRANSPARENT },
+};
+
+static void select(ST7735S &tft, const FontPair &f, bool atlas)
+{
+    if (atlas) {
+        tft.set_font(f.atlas);
+    } else {
+        tft.set_font((unsigned char *) f.glcd);
+    }
+}
+
+static int print_all(ST7735S &tft)
+{
+    int n = 0;
+    tft.locate(0, 0);
+    for (int c = 0x20; c < 0x7F; c++) {
+        tft.putc(c);
+        n++;
+    }
+    return n;
+}
+
+/* ns per glyph in FRAMEBUFFER mode, the framebuffer is left in fb */
+static double cpu_ns(ST7735S &tft, const FontPair &f, bool atlas, int rounds, uint16_t *fb)
+{
+    int glyphs = 0;
+
+    select(tft, f, atlas);
+    tft.cls();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        glyphs += print_all(tft);
+    }
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    memcpy(fb, tft.framebuffer(), 160 * 80 * sizeof(uint16_t));
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() / glyphs;
+}
+
+/* wire bytes of one pass in DIRECT mode */
+static uint32_t wire_bytes(ST7735S &tft, ST7735SModel &model, const FontPair &f, bool atlas, uint32_t &crc)
+{
+    select(tft, f, atlas);
+    tft.cls();
+    model.reset_stats();
+    print_all(tft);
+    crc = model.crc32();
+    return model.stats().bytes;
+}
+
+int main(int argc, char **argv)
+{
+    int rounds = (argc > 1) ? atoi(argv[1]) : 200;
+    bool ok = true;
+    uint16_t fb_glcd[160 * 80];
+    uint16_t fb_atlas[160 * 80];
+
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+    ST7735S direct(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT", ST7735S::DIRECT);
+    ST7735S fb(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "FB", ST7735S::FRAMEBUFFER);
+
+    direct.foreground(White);
+    direct.background(Blue);
+    fb.foreground(White);
+    fb.background(Blue);
+
+    printf("font,text_mode,glcd_ns_per_glyph,atlas_ns_per_glyph,speedup,glcd_bytes,atlas_bytes,identical\n");
+    for (size_t k = 0; k < sizeof(fonts) / sizeof(fonts[0]) * 3; k++) {
+        const FontPair &f = fonts[k / 3];
+        const TextMode &t = text_modes[k % 3];
+        uint32_t crc_glcd, crc_atlas;
+
+        direct.set_text_mode(t.mode);
+        fb.set_text_mode(t.mode);
+
+        double t_glcd = cpu_ns(fb, f, false, rounds, fb_glcd);
+        double t_atlas = cpu_ns(fb, f, true, rounds, fb_atlas);
+        uint32_t b_glcd = wire_bytes(direct, model, f, false, crc_glcd);
+        uint32_t b_atlas = wire_bytes(direct, model, f, true, crc_atlas);
+        bool same = (memcmp(fb_glcd, fb_atlas, sizeof(fb_glcd)) == 0) && (crc_glcd == crc_atlas);
+
+        printf("%s,%s,%.1f,%.1f,%.2f,%u,%u,%s\n", f.name, t.name, t_glcd, t_atlas, t_glcd / t_atlas,
+               b_glcd, b_atlas, same ? "yes" : "no");
+        ok = ok && same;
+    }
+    return ok ? 0 : 2;
+}
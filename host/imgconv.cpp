@@ -0,0 +1,88 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Convert the RGB565 images in images/ to the Q565 format.
+ *
+ * Every image is encoded with q565_encode (see ST7735S/Q565.h), decoded
+ * again to check the round trip and written as a header next to the
+ * source image:
+ *
+ *   imgconv [dir]      writes dir/<source>_q565.h, dir defaults to ../images
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "Q565.h"
+#include "Q565Encoder.h"
+
+#include "images/ImageData.h"
+#include "images/ekimemo.h"
+
+struct Image {
+    const char *name;
+    const char *source;
+    const unsigned char *data;
+    int width, height;
+};
+
+static const Image images[] = {
+    { "gImage_0inch96_1",   "ImageData.h",  gImage_0inch96_1,   160, 80 },
+    { "ekimemo_bmp",        "ekimemo.h",    ekimemo_bmp,        160, 284 },
+};
+
+static bool convert(const Image &img, const char *dir)
+{
+    int count = img.width * img.height;
+    std::vector<uint16_t> px = q565_pixels(img.data, count);
+    std::vector<uint8_t> q = q565_encode(px.data(), img.width, img.height);
+
+    std::vector<uint16_t> back(count);
+    Q565Decoder dec(q.data());
+    if ((dec.decode(back.data(), count) != count) || (back != px)) {
+        fprintf(stderr, "%s: round trip failed\n", img.name);
+        return false;
+    }
+
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%.*s_q565.h", dir, (int)(strlen(img.source) - 2), img.source);
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL) {
+        perror(path);
+        return false;
+    }
+
+    fprintf(fp, "//Q565 image of %s generated by host/imgconv, do not edit\n", img.source);
+    fprintf(fp, "//%d x %d, %d -> %u bytes\n\n", img.width, img.height, count * 2, (unsigned)q.size());
+    char guard[64];
+    snprintf(guard, sizeof(guard), "%s_Q565_H", img.name);
+    for (char *p = guard; *p; p++) {
+        *p = toupper((unsigned char)*p);
+    }
+    fprintf(fp, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(fp, "/** %s compressed, draw with ST7735S::draw_image_q565 */\n", img.name);
+    fprintf(fp, "const unsigned char %s_q565[] = {", img.name);
+    for (size_t i = 0; i < q.size(); i++) {
+        fprintf(fp, "%s0x%02X,", (i % 16) ? " " : "\n        ", q[i]);
+    }
+    fprintf(fp, "\n};\n\n#endif\n");
+    fclose(fp);
+
+    printf("%-18s %3d x %3d, %6d -> %6u bytes  %s\n", img.name, img.width, img.height,
+           count * 2, (unsigned)q.size(), path);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = (argc > 1) ? argv[1] : "../images";
+
+    for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+        if (!convert(images[i], dir)) {
+            return 1;
+        }
+    }
+    return 0;
+}
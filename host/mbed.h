@@ -0,0 +1,449 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host stand-in for mbed.h. Provides just the parts of the Mbed OS API the
+ * ST7735S library uses, with SPI and DigitalOut routed to the HostBus so a
+ * simulated controller can observe the traffic.
+ */
+
+#ifndef HOST_MBED_H
+#define HOST_MBED_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+#include "mbed_config.h"
+#include "PinNames.h"
+#include "HostBus.h"
+
+#define DEVICE_SPI_ASYNCH   1
+
+#define SPI_EVENT_ERROR     (1 << 1)
+#define SPI_EVENT_COMPLETE  (1 << 2)
+#define SPI_EVENT_RX_OVERFLOW (1 << 3)
+#define SPI_EVENT_ALL       (SPI_EVENT_ERROR | SPI_EVENT_COMPLETE | SPI_EVENT_RX_OVERFLOW)
+
+#define osWaitForever       0xFFFFFFFFU
+
+typedef enum {
+    osPriorityLow           = 8,
+    osPriorityBelowNormal   = 16,
+    osPriorityNormal        = 24,
+    osPriorityAboveNormal   = 32,
+    osPriorityHigh          = 40,
+    osPriorityRealtime      = 48
+} osPriority;
+
+typedef int32_t osStatus;
+#define osOK                0
+
+/** Stand-ins for the mbed_atomic.h loads / stores, sequentially consistent
+ */
+inline uint32_t core_util_atomic_load_u32(const volatile uint32_t *valuePtr)
+{
+    return __atomic_load_n(valuePtr, __ATOMIC_SEQ_CST);
+}
+
+inline void core_util_atomic_store_u32(volatile uint32_t *valuePtr, uint32_t desiredValue)
+{
+    __atomic_store_n(valuePtr, desiredValue, __ATOMIC_SEQ_CST);
+}
+
+namespace mbed {
+
+template <typename F> class Callback;
+
+/** Stand-in for mbed::Callback
+ */
+template <typename R, typename... Args>
+class Callback<R(Args...)> {
+public:
+    Callback(std::nullptr_t = nullptr) {}
+
+    Callback(R (*func)(Args...))
+    {
+        if (func) {
+            _f = func;
+        }
+    }
+
+    template <typename T, typename U>
+    Callback(U *obj, R (T::*method)(Args...))
+    {
+        _f = [obj, method](Args... args) {
+            return (obj->*method)(args...);
+        };
+    }
+
+    R call(Args... args) const
+    {
+        return _f(args...);
+    }
+
+    R operator()(Args... args) const
+    {
+        return _f(args...);
+    }
+
+    explicit operator bool() const
+    {
+        return (bool)_f;
+    }
+
+private:
+    std::function<R(Args...)> _f;
+};
+
+template <typename T, typename U, typename R, typename... Args>
+Callback<R(Args...)> callback(U *obj, R (T::*method)(Args...))
+{
+    return Callback<R(Args...)>(obj, method);
+}
+
+typedef Callback<void(int)> event_callback_t;
+
+/** Stand-in for mbed::DigitalOut
+ */
+class DigitalOut {
+public:
+    DigitalOut(PinName pin) : _pin(pin)
+    {
+        write(0);
+    }
+
+    DigitalOut(PinName pin, int value) : _pin(pin)
+    {
+        write(value);
+    }
+
+    void write(int value)
+    {
+        HostBus::instance().pin_write(_pin, value);
+    }
+
+    int read()
+    {
+        return HostBus::instance().pin_read(_pin);
+    }
+
+    int is_connected()
+    {
+        return _pin != NC;
+    }
+
+    DigitalOut &operator= (int value)
+    {
+        write(value);
+        return *this;
+    }
+
+    operator int()
+    {
+        return read();
+    }
+
+private:
+    PinName _pin;
+};
+
+/** Stand-in for mbed::SPI (blocking API)
+ */
+class SPI {
+public:
+    SPI(PinName mosi, PinName miso, PinName sclk, PinName ssel = NC)
+        : _bits(8), _mode(0), _hz(1000000), _stop(false), _busy(false)
+    {
+    }
+
+    ~SPI()
+    {
+        if (_worker.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _cond.notify_all();
+            _worker.join();
+        }
+    }
+
+    void format(int bits, int mode = 0)
+    {
+        _bits = bits;
+        _mode = mode;
+    }
+
+    void frequency(int hz = 1000000)
+    {
+        _hz = hz;
+        HostBus::instance().spi_frequency(hz);
+    }
+
+    int write(int value)
+    {
+        HostBus::instance().spi_transaction();
+        return HostBus::instance().spi_transfer((uint8_t)value);
+    }
+
+    int write(const char *tx_buffer, int tx_length, char *rx_buffer, int rx_length)
+    {
+        int total = (tx_length > rx_length) ? tx_length : rx_length;
+        HostBus::instance().spi_transaction();
+        for (int i = 0; i < total; i++) {
+            uint8_t out = (i < tx_length) ? (uint8_t)tx_buffer[i] : 0xFF;
+            uint8_t in = HostBus::instance().spi_transfer(out);
+            if (i < rx_length) {
+                rx_buffer[i] = (char)in;
+            }
+        }
+        return total;
+    }
+
+    /** Start a non-blocking transfer, the bytes are shifted on a worker
+    *   thread which then calls the callback like the SPI interrupt would
+    *
+    * @returns 0 on success, -1 if a transfer is already in progress
+    */
+    int transfer(const char *tx_buffer, int tx_length, char *rx_buffer, int rx_length,
+                 const event_callback_t &callback, int event = SPI_EVENT_COMPLETE)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_busy) {
+            return -1;
+        }
+        if (!_worker.joinable()) {
+            _worker = std::thread(&SPI::worker, this);
+        }
+        Job job = { tx_buffer, tx_length, rx_buffer, rx_length, callback, event };
+        _jobs.push_back(job);
+        _busy = true;
+        lock.unlock();
+        _cond.notify_all();
+        return 0;
+    }
+
+    void abort_transfer() {}
+
+    void lock() {}
+    void unlock() {}
+
+private:
+    struct Job {
+        const char *tx;
+        int tx_length;
+        char *rx;
+        int rx_length;
+        event_callback_t callback;
+        int event;
+    };
+
+    void worker()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _cond.wait(lock, [this] { return _stop || !_jobs.empty(); });
+            if (_jobs.empty()) {
+                return;
+            }
+            Job job = _jobs.front();
+            _jobs.pop_front();
+            lock.unlock();
+            write(job.tx, job.tx_length, job.rx, job.rx_length);
+            lock.lock();
+            _busy = false;
+            lock.unlock();
+            if (job.callback && (job.event & SPI_EVENT_COMPLETE)) {
+                job.callback(SPI_EVENT_COMPLETE);
+            }
+            lock.lock();
+        }
+    }
+
+    int _bits;
+    int _mode;
+    int _hz;
+
+    std::thread _worker;
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::deque<Job> _jobs;
+    bool _stop;
+    bool _busy;
+};
+
+/** Stand-in for mbed::Stream, formatted output goes through _putc()
+ */
+class Stream {
+public:
+    Stream(const char *name = NULL) {}
+    virtual ~Stream() {}
+
+    int putc(int c)
+    {
+        return _putc(c);
+    }
+
+    int puts(const char *s)
+    {
+        while (*s) {
+            _putc(*s++);
+        }
+        return 0;
+    }
+
+    int printf(const char *format, ...)
+    {
+        va_list arg;
+        va_start(arg, format);
+        int r = vprintf(format, arg);
+        va_end(arg);
+        return r;
+    }
+
+    int vprintf(const char *format, va_list arg)
+    {
+        char buf[256];
+        int r = vsnprintf(buf, sizeof(buf), format, arg);
+        for (int i = 0; buf[i] != 0; i++) {
+            _putc(buf[i]);
+        }
+        return r;
+    }
+
+protected:
+    virtual int _putc(int c) = 0;
+    virtual int _getc() = 0;
+};
+
+} // namespace mbed
+
+namespace rtos {
+
+/** Stand-in for rtos::EventFlags
+ */
+class EventFlags {
+public:
+    EventFlags(const char *name = NULL) : _flags(0) {}
+
+    uint32_t set(uint32_t flags)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _flags |= flags;
+        _cond.notify_all();
+        return _flags;
+    }
+
+    uint32_t clear(uint32_t flags = 0x7fffffff)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        uint32_t old = _flags;
+        _flags &= ~flags;
+        return old;
+    }
+
+    uint32_t get() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _flags;
+    }
+
+    uint32_t wait_any(uint32_t flags = 0, uint32_t millisec = osWaitForever, bool clear = true)
+    {
+        return wait(flags, millisec, clear, false);
+    }
+
+    uint32_t wait_all(uint32_t flags = 0, uint32_t millisec = osWaitForever, bool clear = true)
+    {
+        return wait(flags, millisec, clear, true);
+    }
+
+private:
+    uint32_t wait(uint32_t flags, uint32_t millisec, bool clear, bool all)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto ready = [&] {
+            return all ? ((_flags & flags) == flags) : ((_flags & flags) != 0);
+        };
+        if (millisec == osWaitForever) {
+            _cond.wait(lock, ready);
+        } else if (!_cond.wait_for(lock, std::chrono::milliseconds(millisec), ready)) {
+            return 0xFFFFFFFEU;     // osFlagsErrorTimeout
+        }
+        uint32_t result = _flags;
+        if (clear) {
+            _flags &= ~flags;
+        }
+        return result;
+    }
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cond;
+    uint32_t _flags;
+};
+
+/** Stand-in for rtos::Thread, runs the task on a std::thread
+ */
+class Thread {
+public:
+    Thread(osPriority priority = osPriorityNormal, uint32_t stack_size = 4096,
+           unsigned char *stack_mem = NULL, const char *name = NULL)
+    {
+    }
+
+    ~Thread()
+    {
+        join();
+    }
+
+    osStatus start(mbed::Callback<void()> task)
+    {
+        _thread = std::thread([task] { task(); });
+        return osOK;
+    }
+
+    osStatus join()
+    {
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+        return osOK;
+    }
+
+private:
+    std::thread _thread;
+};
+
+namespace ThisThread {
+
+/** Stand-in for ThisThread::sleep_for, advances the virtual bus clock
+ */
+inline void sleep_for(std::chrono::milliseconds rel_time)
+{
+    HostBus::instance().advance((uint64_t)rel_time.count() * 1000000ULL);
+}
+
+} // namespace ThisThread
+} // namespace rtos
+
+/** Stand-in for wait_us, advances the virtual bus clock
+ */
+inline void wait_us(int us)
+{
+    HostBus::instance().advance((uint64_t)us * 1000ULL);
+}
+
+using namespace mbed;
+using namespace rtos;
+using namespace std::chrono_literals;
+
+#endif
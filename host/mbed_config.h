@@ -0,0 +1,19 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host stand-in for the generated mbed_config.h, with the
+ * RASPBERRY_PI_PICO overrides from mbed_app.json
+ */
+
+#ifndef HOST_MBED_CONFIG_H
+#define HOST_MBED_CONFIG_H
+
+#define ST7735S_MOSI    p11
+#define ST7735S_MISO    p24
+#define ST7735S_SCLK    p10
+#define ST7735S_CS      p9
+#define ST7735S_RS      p8
+#define ST7735S_RESET   p12
+
+#endif
@@ -0,0 +1,388 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Orientation test: every primitive in all four orientations, with and
+ * without mirroring, for all panel descriptors in DIRECT and FRAMEBUFFER
+ * mode, and for a descriptor of the test itself instantiated through
+ * ST7735S_impl.h as an application would.
+ *
+ * Each primitive is drawn alone on a cleared screen. The expected picture
+ * is built in screen coordinates from the primitive's definition alone:
+ * the circles from x^2 + y^2 (as in circle_test), text from the GLCD font
+ * data, also for the atlas font, bitmaps from their bits and the Q565
+ * image from the RGB565 data it was made from. It is mapped to the panel's
+ * native orientation (mirror left to right, then rotate clockwise) and
+ * compared with the GRAM of the controller model through its viewport.
+ * The exit status is 2 on a mismatch.
+ *
+ *   st7735s_orient_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "mbed.h"
+#include "ST7735S_impl.h"
+#include "ST7735SModel.h"
+
+#include "fonts/Arial12x12.h"
+#include "fonts/Arial12x12_atlas.h"
+#include "images/ImageData.h"
+#include "images/ImageData_q565.h"
+
+#define BG          0x0000
+#define FG          0xFFE0
+#define CIRCLE_R    9
+
+/* expected screen content, in the orientation under test */
+struct Picture {
+    int w, h;
+    std::vector<uint16_t> px;
+
+    Picture(int w, int h) : w(w), h(h), px(w * h, BG)
+    {
+    }
+
+    void set(int x, int y, uint16_t c)
+    {
+        if ((x >= 0) && (x < w) && (y >= 0) && (y < h)) {
+            px[y * w + x] = c;
+        }
+    }
+};
+
+/* 1.44" 128 x 128 module, not in ST7735SPanel.h */
+struct Panel_128x128 {
+    static const int width = 128;
+    static const int height = 128;
+    static const int x_offset = 2;
+    static const int y_offset = 3;
+    static const uint8_t madctl = ST7735_MADCTL_MY | ST7735_MADCTL_MX | ST7735_MADCTL_BGR;
+    static const bool invert = false;
+    static const uint8_t *init_table()
+    {
+        return ST7735S_init_18;
+    }
+};
+
+template class ST7735SDisplay<Panel_128x128>;
+
+static int failures;
+
+/* screen position to the native panel position: mirror, then rotate clockwise */
+static void native(int orientation, bool mirror, int w, int h, int x, int y, int &nx, int &ny)
+{
+    if (mirror) {
+        x = w - 1 - x;
+    }
+    switch (orientation) {
+        case 1:
+            nx = h - 1 - y;
+            ny = x;
+            break;
+        case 2:
+            nx = w - 1 - x;
+            ny = h - 1 - y;
+            break;
+        case 3:
+            nx = y;
+            ny = w - 1 - x;
+            break;
+        default:
+            nx = x;
+            ny = y;
+            break;
+    }
+}
+
+template <class Panel>
+static bool compare(ST7735SModel &model, const Picture &p, int orientation, bool mirror, const char *mode, const char *what)
+{
+    int bad = 0;
+    for (int y = 0; y < p.h; y++) {
+        for (int x = 0; x < p.w; x++) {
+            int nx, ny;
+            native(orientation, mirror, p.w, p.h, x, y, nx, ny);
+            uint16_t got = model.visible(nx, ny);
+            if (got != p.px[y * p.w + x]) {
+                if (bad == 0) {
+                    fprintf(stderr, "%dx%d %s orientation %d%s %s: screen %d,%d (native %d,%d) is %04X, expected %04X\n",
+                            Panel::width, Panel::height, mode, orientation, mirror ? " mirrored" : "", what,
+                            x, y, nx, ny, got, p.px[y * p.w + x]);
+                }
+                bad++;
+            }
+        }
+    }
+    if (bad > 0) {
+        fprintf(stderr, "  %d pixels differ\n", bad);
+        failures++;
+    }
+    return bad == 0;
+}
+
+/* with a the smaller and b the larger of |dx| and |dy|: the outline is
+ * a^2 + b^2 - b < r^2 <= a^2 + b^2 + b, the filled circle a^2 + b^2 - b < r^2 */
+static bool on_circle(int dx, int dy, int r, bool fill)
+{
+    int a = abs(dx), b = abs(dy);
+    if (a > b) {
+        int t = a;
+        a = b;
+        b = t;
+    }
+    if (fill) {
+        return a * a + b * b - b < r * r;
+    }
+    return (a * a + b * b - b < r * r) && (r * r <= a * a + b * b + b);
+}
+
+/* the GLCD cells of s at x, y, column by column from the font data */
+static void glcd_text(Picture &p, const unsigned char *f, int x, int y, const char *s)
+{
+    for (; *s; s++) {
+        const unsigned char *ch = &f[(*s - 32) * f[0] + 4];
+        for (int j = 0; j < f[2]; j++) {
+            for (int i = 0; i < f[1]; i++) {
+                bool set = ch[f[3] * i + (j >> 3) + 1] & (1 << (j & 7));
+                p.set(x + i, y + j, set ? FG : BG);
+            }
+        }
+        // glyph width and the default gap, at most the cell
+        x += (ch[0] + 2 < f[1]) ? ch[0] + 2 : f[1];
+    }
+}
+
+template <class Panel>
+static void run(ST7735SModel &model, typename ST7735SDisplay<Panel>::RenderMode render, int orientation, bool mirror)
+{
+    typedef ST7735SDisplay<Panel> Display;
+    Display tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT", render);
+    const char *mode = (render == Display::DIRECT) ? "direct" : "framebuffer";
+
+    tft.set_orientation(orientation, mirror);
+    int w = tft.width(), h = tft.height();
+    if ((w != (((orientation & 1) ? Panel::height : Panel::width))) ||
+            (h != (((orientation & 1) ? Panel::width : Panel::height)))) {
+        fprintf(stderr, "%dx%d orientation %d: screen is %d x %d\n", Panel::width, Panel::height, orientation, w, h);
+        failures++;
+        return;
+    }
+    tft.foreground(FG);
+    tft.background(BG);
+
+    // pixel
+    {
+        Picture p(w, h);
+        const int pos[4][3] = { { 3, 5, 0xF800 }, { 70, 2, 0x07E0 }, { 1, 60, 0x001F }, { 0, 0, 0xFFFF } };
+        tft.cls();
+        for (int i = 0; i < 4; i++) {
+            tft.pixel(pos[i][0], pos[i][1], pos[i][2]);
+            p.set(pos[i][0], pos[i][1], pos[i][2]);
+        }
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, "pixel");
+    }
+
+    // line: diagonal, horizontal, vertical
+    {
+        Picture p(w, h);
+        tft.cls();
+        tft.line(5, 5, 35, 35, 0xF81F);
+        tft.line(60, 70, 2, 70, 0x07FF);
+        tft.line(75, 3, 75, 50, 0xFD20);
+        for (int i = 0; i <= 30; i++) {
+            p.set(5 + i, 5 + i, 0xF81F);
+        }
+        for (int x = 2; x <= 60; x++) {
+            p.set(x, 70, 0x07FF);
+        }
+        for (int y = 3; y <= 50; y++) {
+            p.set(75, y, 0xFD20);
+        }
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, "line");
+    }
+
+    // rect and fillrect
+    {
+        Picture p(w, h);
+        tft.cls();
+        tft.rect(10, 12, 50, 40, 0x7BEF);
+        for (int x = 10; x <= 50; x++) {
+            p.set(x, 12, 0x7BEF);
+            p.set(x, 40, 0x7BEF);
+        }
+        for (int y = 12; y <= 40; y++) {
+            p.set(10, y, 0x7BEF);
+            p.set(50, y, 0x7BEF);
+        }
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, "rect");
+
+        Picture q(w, h);
+        tft.cls();
+        tft.fillrect(7, 9, 33, 21, 0x4A69);
+        for (int y = 9; y <= 21; y++) {
+            for (int x = 7; x <= 33; x++) {
+                q.set(x, y, 0x4A69);
+            }
+        }
+        tft.flush();
+        compare<Panel>(model, q, orientation, mirror, mode, "fillrect");
+    }
+
+    // circle and fillcircle, off-centre and one clipped by the top edge
+    for (int fill = 0; fill < 2; fill++) {
+        Picture p(w, h);
+        tft.cls();
+        if (fill) {
+            tft.fillcircle(40, 35, CIRCLE_R, FG);
+            tft.fillcircle(62, 4, CIRCLE_R - 2, 0xF800);
+        } else {
+            tft.circle(40, 35, CIRCLE_R, FG);
+            tft.circle(62, 4, CIRCLE_R - 2, 0xF800);
+        }
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                if (on_circle(x - 40, y - 35, CIRCLE_R, fill != 0)) {
+                    p.set(x, y, FG);
+                }
+                if (on_circle(x - 62, y - 4, CIRCLE_R - 2, fill != 0)) {
+                    p.set(x, y, 0xF800);
+                }
+            }
+        }
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, fill ? "fillcircle" : "circle");
+    }
+
+    // character, GLCD font and the atlas made from it
+    for (int atlas = 0; atlas < 2; atlas++) {
+        Picture p(w, h);
+        tft.cls();
+        if (atlas) {
+            tft.set_font(&Arial12x12_atlas);
+        } else {
+            tft.set_font(Arial12x12);
+        }
+        tft.locate(13, 17);
+        tft.printf("Ag");
+        glcd_text(p, Arial12x12, 13, 17, "Ag");
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, atlas ? "atlas character" : "character");
+    }
+
+    // Paint_DrawImage, low byte first
+    {
+        Picture p(w, h);
+        unsigned char image[20 * 12 * 2];
+        for (int i = 0; i < 20 * 12; i++) {
+            uint16_t c = 0x0821 * (i % 31) + (i / 31) + 1;
+            image[i * 2] = c & 0xFF;
+            image[i * 2 + 1] = c >> 8;
+            p.set(31 + i % 20, 44 + i / 20, c);
+        }
+        tft.cls();
+        tft.Paint_DrawImage(image, 31, 44, 20, 12);
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, "Paint_DrawImage");
+    }
+
+    // draw_image_q565, clipped by the left and top edge
+    {
+        Picture p(w, h);
+        for (int i = 0; i < 160 * 80; i++) {
+            p.set(i % 160 - 50, i / 160 - 7, gImage_0inch96_1[i * 2] | (gImage_0inch96_1[i * 2 + 1] << 8));
+        }
+        tft.cls();
+        tft.draw_image_q565(gImage_0inch96_1_q565, -50, -7);
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, "draw_image_q565");
+    }
+
+    // blit
+    {
+        Picture p(w, h);
+        int colour[9 * 7];
+        for (int i = 0; i < 9 * 7; i++) {
+            colour[i] = 0xF000 + i * 0x41;
+            p.set(50 + i % 9, 8 + i / 9, colour[i]);
+        }
+        tft.cls();
+        tft.blit(50, 8, 9, 7, colour);
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, "blit");
+    }
+
+    // blitbit, the bits continue from row to row
+    {
+        Picture p(w, h);
+        const char bits[9] = { (char)0xA5, 0x3C, (char)0xF0, 0x0F, 0x55, (char)0x81, 0x7E, 0x18, (char)0xC3 };
+        tft.foreground(0x07E0);
+        tft.background(0x001F);
+        tft.cls();
+        tft.blitbit(22, 61, 13, 5, bits);
+        for (int i = 0; i < 13 * 5; i++) {
+            p.set(22 + i % 13, 61 + i / 13, ((bits[i >> 3] << (i & 7)) & 0x80) ? 0x07E0 : 0x001F);
+        }
+        // cls() painted the new background
+        for (int i = 0; i < w * h; i++) {
+            int x = i % w, y = i / w;
+            if ((x < 22) || (x >= 22 + 13) || (y < 61) || (y >= 61 + 5)) {
+                p.px[i] = 0x001F;
+            }
+        }
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, "blitbit");
+        tft.foreground(FG);
+        tft.background(BG);
+    }
+
+    // bitmap, rows of 3 bytes of which the last bits are padding
+    {
+        Picture p(w, h);
+        const uint8_t bits[7 * 3] = {
+            0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xB6, 0xDB, 0x6F, 0x8F, 0x0F, 0x0F,
+            0xC3, 0x3C, 0xC3, 0x81, 0x81, 0x81, 0xAA, 0x55, 0xAA,
+        };
+        tft.cls();
+        tft.bitmap(37, 50, 19, 7, bits, 3, 0xF81F, 0x07E0);
+        for (int y = 0; y < 7; y++) {
+            for (int x = 0; x < 19; x++) {
+                p.set(37 + x, 50 + y, (bits[y * 3 + (x >> 3)] & (0x80 >> (x & 7))) ? 0xF81F : 0x07E0);
+            }
+        }
+        tft.flush();
+        compare<Panel>(model, p, orientation, mirror, mode, "bitmap");
+    }
+}
+
+template <class Panel>
+static void panel(void)
+{
+    typedef ST7735SDisplay<Panel> Display;
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+
+    // the visible GRAM area in the native orientation of the descriptor
+    model.viewport(Panel::x_offset, Panel::y_offset, Panel::width, Panel::height, Panel::madctl);
+
+    for (int render = 0; render < 2; render++) {
+        for (int orientation = 0; orientation < 4; orientation++) {
+            for (int mirror = 0; mirror < 2; mirror++) {
+                run<Panel>(model, render ? Display::FRAMEBUFFER : Display::DIRECT, orientation, mirror != 0);
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    panel<ST7735S_160x80>();
+    panel<ST7735S_80x160>();
+    panel<ST7735S_128x160>();
+    panel<Panel_128x128>();
+    printf("orientation: 4 panels x 2 modes x 4 orientations x 2 mirrors x 13 primitives, %d failures\n", failures);
+    return failures ? 2 : 0;
+}
@@ -0,0 +1,151 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * DrawQueue test.
+ *
+ * A sequence of overlapping commands of every kind is drawn once directly
+ * and once through a DrawQueue; after sync() the panel has to be the same,
+ * which only holds when the transmit thread draws in queue order. The
+ * sequence is several times longer than the ring, so the application has
+ * to stall (back-pressure) and the ring has to fill up completely. After
+ * sync() nothing may be left in the queue and every command has to be
+ * drawn. Pixels of push_pixels() are overwritten right after the call to
+ * see that they are copied, and the display colors have to be the same
+ * before and after the queue. DIRECT and FRAMEBUFFER mode, the exit
+ * status is 2 on a mismatch.
+ *
+ *   st7735s_queue_test
+ */
+
+#include <stdio.h>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "DrawQueue.h"
+#include "ST7735SModel.h"
+
+#include "fonts/Arial12x12.h"
+
+static const uint8_t icon[8] = { 0x3C, 0x42, 0xA5, 0x81, 0xA5, 0x99, 0x42, 0x3C };
+
+static int failures;
+
+/* the sequence, on the display when q is NULL */
+static void sequence(ST7735S &tft, DrawQueue *q)
+{
+    uint16_t row[40];
+    char s[8];
+
+    if (q != NULL) {
+        q->cls(Navy);
+    } else {
+        tft.background(Navy);
+        tft.cls();
+    }
+    for (int i = 0; i < 40; i++) {
+        // each command covers part of the one before, the order decides the result
+        int x = (i * 7) % 120, y = (i * 5) % 60;
+        int c = i * 0x0843;
+        snprintf(s, sizeof(s), "%d", i);
+        if (q != NULL) {
+            q->fillrect(x, y, x + 39, y + 19, c);
+            q->line(x, y + 19, x + 39, y, c ^ 0xFFFF);
+            q->rect(x + 2, y + 2, x + 20, y + 12, White);
+            q->pixel(x + 5, y + 5, Red);
+            q->blitbit(x + 10, y + 4, 8, 8, (const char *)icon, Yellow, c);
+            q->text(x + 22, y + 4, s, White, c);
+            q->begin_region(x + 30, y + 8, 20, 2);
+        } else {
+            tft.fillrect(x, y, x + 39, y + 19, c);
+            tft.line(x, y + 19, x + 39, y, c ^ 0xFFFF);
+            tft.rect(x + 2, y + 2, x + 20, y + 12, White);
+            tft.pixel(x + 5, y + 5, Red);
+            tft.foreground(Yellow);
+            tft.background(c);
+            tft.blitbit(x + 10, y + 4, 8, 8, (const char *)icon);
+            tft.foreground(White);
+            tft.locate(x + 22, y + 4);
+            tft.puts(s);
+            tft.begin_region(x + 30, y + 8, 20, 2);
+        }
+        for (int k = 0; k < 20; k++) {
+            row[k] = c + k * 0x0020;
+        }
+        if (q != NULL) {
+            q->push_pixels(row, 20);
+        } else {
+            tft.push_pixels(row, 20);
+        }
+        // the queue holds a copy, the buffer can change at once
+        for (int k = 0; k < 20; k++) {
+            row[k] = ~row[k];
+        }
+        if (q != NULL) {
+            q->push_pixels(row, 12);
+            q->push_repeat(c, 8);
+            q->end_region();
+        } else {
+            tft.push_pixels(row, 12);
+            tft.push_repeat(c, 8);
+            tft.end_region();
+        }
+    }
+    if (q != NULL) {
+        q->flush();
+    } else {
+        tft.flush();
+    }
+}
+
+static void run(ST7735SModel &model, ST7735S::RenderMode render)
+{
+    ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT", render);
+    const char *what = (render == ST7735S::DIRECT) ? "direct" : "framebuffer";
+    tft.set_font((unsigned char *)Arial12x12);
+
+    sequence(tft, NULL);
+    uint32_t crc = model.crc32();
+
+    tft.foreground(Green);
+    tft.background(Maroon);
+    tft.cls();
+    DrawQueue q(tft);
+    sequence(tft, &q);
+    q.sync();
+    DrawQueue::Stats st = q.stats();
+
+    if (model.crc32() != crc) {
+        fprintf(stderr, "%s: the queue draws differently than the display\n", what);
+        failures++;
+    }
+    if ((q.depth() != 0) || (st.executed != st.commands)) {
+        fprintf(stderr, "%s: after sync() %d commands queued, %u of %u drawn\n", what, q.depth(), st.executed, st.commands);
+        failures++;
+    }
+    if ((st.stalls == 0) || (st.max_depth != ST7735S_QUEUE_DEPTH)) {
+        fprintf(stderr, "%s: %u commands, %u stalls, max depth %u of %d\n", what, st.commands, st.stalls,
+                st.max_depth, ST7735S_QUEUE_DEPTH);
+        failures++;
+    }
+    if ((tft.foreground_color() != Green) || (tft.background_color() != Maroon)) {
+        fprintf(stderr, "%s: the queue left the colors at %04X / %04X\n", what, tft.foreground_color(), tft.background_color());
+        failures++;
+    }
+
+    // sync() on an empty queue returns at once
+    q.sync();
+    if (q.stats().syncs != st.syncs) {
+        fprintf(stderr, "%s: sync() on an empty queue waited\n", what);
+        failures++;
+    }
+}
+
+int main(void)
+{
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+
+    run(model, ST7735S::DIRECT);
+    run(model, ST7735S::FRAMEBUFFER);
+    printf("queue: 2 modes, %d failures\n", failures);
+    return failures ? 2 : 0;
+}
@@ -0,0 +1,155 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Readback test.
+ *
+ * Known colors, among them the edge values 0x0000, 0xFFFF and the lowest
+ * bit of every channel (0x0821), are drawn and read back with
+ * read_region(), which has to return exactly the colors drawn in COLOR_RGB565
+ * and the colors reduced to 4 bit per channel and expanded again in
+ * COLOR_RGB444, in DIRECT and FRAMEBUFFER mode, for a single pixel, a
+ * small rectangle and a rectangle read in several blocks.
+ *
+ * The RAMRD bytes of the controller model are checked on their own against
+ * a table of the 18 bit format (6 bit R, G, B left aligned, R and B
+ * expanded from 5 bit by repeating the MSB), so a wrong unpacking on both
+ * sides cannot cancel out. The exit status is 2 on a mismatch.
+ *
+ *   st7735s_readback_test
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "ST7735SModel.h"
+
+static const uint16_t colors[] = {
+    0x0000, 0xFFFF, 0x0821, 0xF800, 0x07E0, 0x001F, 0x8410, 0x7BEF,
+    0x1082, 0xF7DE, 0x0841, 0x1000, 0x0020, 0x0001, 0xA554, 0x5AAB,
+};
+#define NCOLORS ((int)(sizeof(colors) / sizeof(colors[0])))
+
+/* RAMRD bytes of the colors in the 18 bit format */
+static const uint8_t ramrd[][3] = {
+    { 0x00, 0x00, 0x00 }, { 0xFC, 0xFC, 0xFC }, { 0x08, 0x04, 0x08 }, { 0xFC, 0x00, 0x00 },
+    { 0x00, 0xFC, 0x00 }, { 0x00, 0x00, 0xFC }, { 0x84, 0x80, 0x84 }, { 0x78, 0x7C, 0x78 },
+};
+
+static int failures;
+
+static uint16_t color_at(int i)
+{
+    return colors[i % NCOLORS] ^ (uint16_t)((i / NCOLORS) * 0x0841);
+}
+
+/* a color as the panel holds it in COLOR_RGB444: 4 bit channels, expanded by repeating the upper bits */
+static uint16_t reduced444(uint16_t c)
+{
+    int r = c >> 12, g = (c >> 7) & 0x0F, b = (c >> 1) & 0x0F;
+    return (((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3));
+}
+
+static void check_region(ST7735S &tft, const char *what, bool rgb444, int x0, int y0, int w, int h)
+{
+    std::vector<unsigned char> image(w * h * 2);
+    for (int i = 0; i < w * h; i++) {
+        image[i * 2] = color_at(i) & 0xFF;
+        image[i * 2 + 1] = color_at(i) >> 8;
+    }
+    tft.background(0x3186);
+    tft.cls();
+    tft.Paint_DrawImage(image.data(), x0, y0, w, h);
+    tft.flush();
+
+    std::vector<uint16_t> buf(w * h, 0xDEAD);
+    int n = tft.read_region(x0, y0, x0 + w - 1, y0 + h - 1, buf.data());
+    if (n != w * h) {
+        fprintf(stderr, "%s %dx%d: read_region returned %d\n", what, w, h, n);
+        failures++;
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        uint16_t expect = rgb444 ? reduced444(color_at(i)) : color_at(i);
+        if (buf[i] != expect) {
+            fprintf(stderr, "%s %dx%d: pixel %d read %04X, expected %04X (drawn %04X)\n",
+                    what, w, h, i, buf[i], expect, color_at(i));
+            failures++;
+            return;
+        }
+    }
+}
+
+/* RAMRD straight on the bus, the screen pixels 0..7 of row 0 of the 160 x 80 panel */
+static void check_wire(ST7735S &tft)
+{
+    for (int i = 0; i < 8; i++) {
+        tft.pixel(i, 0, colors[i]);
+    }
+    tft.flush();
+
+    SPI spi(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK);
+    DigitalOut cs(ST7735S_CS, 1);
+    DigitalOut rs(ST7735S_RS, 1);
+    const uint8_t caset[4] = { 0, 1, 0, 8 };        // column offset 1 of the panel
+    const uint8_t raset[4] = { 0, 26, 0, 26 };      // row offset 26
+    const uint8_t *args[2] = { caset, raset };
+
+    spi.frequency(ST7735S_READ_HZ);
+    cs = 0;
+    for (int c = 0; c < 2; c++) {
+        rs = 0;
+        spi.write(0x2A + c);
+        rs = 1;
+        for (int i = 0; i < 4; i++) {
+            spi.write(args[c][i]);
+        }
+    }
+    rs = 0;
+    spi.write(0x2E);
+    rs = 1;
+    spi.write(0);       // dummy byte
+    for (int i = 0; i < 8; i++) {
+        for (int k = 0; k < 3; k++) {
+            int got = spi.write(0) & 0xFF;
+            if (got != ramrd[i][k]) {
+                fprintf(stderr, "RAMRD: color %04X byte %d is %02X, expected %02X\n", colors[i], k, got, ramrd[i][k]);
+                failures++;
+            }
+        }
+    }
+    cs = 1;
+    spi.frequency(ST7735S_SPI_HZ);
+}
+
+int main(void)
+{
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+
+    {
+        ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT");
+        check_wire(tft);
+    }
+
+    for (int render = 0; render < 2; render++) {
+        ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT",
+                    render ? ST7735S::FRAMEBUFFER : ST7735S::DIRECT);
+        for (int rgb444 = 0; rgb444 < 2; rgb444++) {
+            char what[32];
+            snprintf(what, sizeof(what), "%s %s", render ? "framebuffer" : "direct", rgb444 ? "RGB444" : "RGB565");
+            tft.set_color_mode(rgb444 ? ST7735S::COLOR_RGB444 : ST7735S::COLOR_RGB565);
+            check_region(tft, what, rgb444, 0, 0, 1, 1);
+            check_region(tft, what, rgb444, 159, 79, 1, 1);
+            check_region(tft, what, rgb444, 37, 21, 8, 4);
+            check_region(tft, what, rgb444, 3, 7, 150, 60);     // many RAMRD blocks
+        }
+    }
+
+    if (model.stats().timing_violations != 0) {
+        fprintf(stderr, "%u timing violations\n", model.stats().timing_violations);
+        failures++;
+    }
+    printf("readback: RAMRD format, 2 modes x 2 color modes x 4 regions, %d failures\n", failures);
+    return failures ? 2 : 0;
+}
@@ -0,0 +1,135 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Hardware scrolling test.
+ *
+ * The screen is filled with a part of ekimemo_bmp, then scroll_image()
+ * moves a scroll area step by step and streams the new lines from the
+ * image, several times around the area. After every step the picture the
+ * controller model scans out (GRAM rows through SCRLAR / VSCSAD) has to
+ * match the expected one: the lines of the area moved by n, the n new
+ * lines taken from the image, the lines outside the area unchanged. Runs
+ * for a full width and a partial area, on the landscape 160 x 80 panel
+ * (scrolling along x) and the portrait 128 x 160 panel (along y), in
+ * DIRECT and FRAMEBUFFER mode. The exit status is 2 on a mismatch.
+ *
+ *   st7735s_scroll_test
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "mbed.h"
+#include "ST7735S.h"
+#include "ST7735SModel.h"
+
+#include "images/ekimemo.h"
+
+#define IMAGE_W     160
+#define IMAGE_H     284
+
+static int failures;
+
+static uint16_t image_pixel(int x, int y)
+{
+    const unsigned char *p = ekimemo_bmp + (y * IMAGE_W + x) * 2;
+    return p[0] | (p[1] << 8);
+}
+
+static bool compare(ST7735SModel &model, const std::vector<uint16_t> &expect, int w, int h, const char *what, int step)
+{
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            uint16_t got = model.visible(x, y);
+            if (got != expect[y * w + x]) {
+                fprintf(stderr, "%s step %d: %d,%d is %04X, expected %04X\n", what, step, x, y, got, expect[y * w + x]);
+                failures++;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* steps of 1 to 4 lines through the area x0..x1, wrapping around it a few times */
+template <class Panel>
+static void run(ST7735SModel &model, typename ST7735SDisplay<Panel>::RenderMode render, int x0, int x1)
+{
+    typedef ST7735SDisplay<Panel> Display;
+    Display tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT", render);
+    int w = tft.width(), h = tft.height();
+    bool along_x = (w > h);     // the landscape panel exchanges rows and columns
+    char what[64];
+    snprintf(what, sizeof(what), "%dx%d %s area %d..%d", Panel::width, Panel::height,
+             (render == Display::DIRECT) ? "direct" : "framebuffer", x0, x1);
+
+    std::vector<uint16_t> expect(w * h);
+    for (int y = 0; y < h; y++) {
+        tft.Paint_DrawImage(ekimemo_bmp + y * IMAGE_W * 2, 0, y, w, 1);
+        for (int x = 0; x < w; x++) {
+            expect[y * w + x] = image_pixel(x, y);
+        }
+    }
+    tft.flush();
+    tft.scroll_area(x0, x1);
+    tft.flush();
+    if (!compare(model, expect, w, h, what, 0)) {
+        return;
+    }
+
+    int lines = x1 - x0 + 1;
+    int src = 0;
+    for (int step = 1, moved = 0; moved < 3 * lines; step++) {
+        int n = 1 + step % 4;
+        // new lines from further down (landscape) or further right (portrait) in the image
+        int row0 = along_x ? h : (IMAGE_H - h) / 2 + src % 40;
+        int col0 = along_x ? src % (IMAGE_W - n) : 0;
+        tft.scroll_image(ekimemo_bmp + (row0 * IMAGE_W + col0) * 2, IMAGE_W, n);
+        tft.flush();
+
+        // shift the area by n, the image lines come in at its end
+        std::vector<uint16_t> next(expect);
+        for (int l = x0; l <= x1; l++) {
+            for (int i = 0; i < (along_x ? h : w); i++) {
+                int k = l - (x1 - n + 1);
+                uint16_t c;
+                if (k >= 0) {
+                    c = along_x ? image_pixel(col0 + k, row0 + i) : image_pixel(col0 + i, row0 + k);
+                } else {
+                    c = along_x ? expect[i * w + l + n] : expect[(l + n) * w + i];
+                }
+                next[along_x ? i * w + l : l * w + i] = c;
+            }
+        }
+        expect.swap(next);
+        if (!compare(model, expect, w, h, what, step)) {
+            return;
+        }
+        src += n;
+        moved += n;
+    }
+    tft.scroll_reset();
+}
+
+template <class Panel>
+static void panel(int part0, int part1)
+{
+    typedef ST7735SDisplay<Panel> Display;
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+    model.viewport(Panel::x_offset, Panel::y_offset, Panel::width, Panel::height, Panel::madctl);
+    int lines = (Panel::width > Panel::height) ? Panel::width : Panel::height;
+
+    for (int render = 0; render < 2; render++) {
+        typename Display::RenderMode mode = render ? Display::FRAMEBUFFER : Display::DIRECT;
+        run<Panel>(model, mode, 0, lines - 1);
+        run<Panel>(model, mode, part0, part1);
+    }
+}
+
+int main(void)
+{
+    panel<ST7735S_160x80>(20, 99);
+    panel<ST7735S_128x160>(30, 129);
+    printf("scroll: 2 panels x 2 modes x full and partial area, %d failures\n", failures);
+    return failures ? 2 : 0;
+}
@@ -0,0 +1,83 @@
+/* Mbed Microcontroller Library
+ * Copyright (c) 2019-2022 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host demo: runs the ST7735S driver against the controller model and
+ * saves the emulated panel content of a few demo screens as PPM files.
+ */
+
+#include "mbed.h"
+#include "ST7735S.h"
+#include "ST7735SModel.h"
+
+#include "fonts/Arial12x12.h"
+#include "fonts/font_big.h"
+#include "images/ImageData.h"
+
+static volatile int async_completions = 0;
+
+static void async_done()
+{
+    async_completions++;
+}
+
+static void save(const ST7735SModel &model, const char *dir, const char *name)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.ppm", dir, name);
+    if (!model.write_ppm(path)) {
+        fprintf(stderr, "cannot write %s\n", path);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = (argc > 1) ? argv[1] : ".";
+
+    ST7735SModel model(ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+    ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+
+    printf("init: %u commands, %u bytes, %u timing violations, %.1f ms\n",
+           (unsigned)model.stats().cmd_bytes, (unsigned)model.stats().bytes,
+           (unsigned)model.stats().timing_violations, HostBus::instance().now_ns() / 1e6);
+
+    tft.background(Black);
+    tft.cls();
+    tft.disp(1);
+
+    tft.background(DarkGrey);
+    tft.foreground(White);
+    tft.cls();
+    for (int i = 0; i < 160; i += 16) {
+        tft.rect(i, 0, i + 15, 79, White);
+    }
+    tft.line(0, 0, 159, 79, Red);
+    tft.circle(80, 40, 30, Yellow);
+    tft.fillcircle(30, 40, 10, Green);
+    tft.fillrect(120, 10, 150, 30, Blue);
+    save(model, dir, "shapes");
+
+    tft.foreground(Yellow);
+    tft.background(Navy);
+    tft.cls();
+    tft.set_font((unsigned char *) Arial12x12);
+    tft.locate(2, 4);
+    tft.printf("ABCDabcd1234");
+    tft.set_font((unsigned char *) Neu42x35);
+    tft.locate(20, 40 - (35 / 2));
+    tft.printf("12:34");
+    save(model, dir, "text");
+
+    tft.Paint_DrawImage(gImage_0inch96_1, 0, 0, 160, 80);
+    save(model, dir, "bitmap");
+
+    // the frame goes out on the SPI worker thread, drawing on top waits for it
+    tft.background(Black);
+    tft.cls();
+    tft.draw_image_async(gImage_0inch96_1, 0, 0, 160, 80, async_done);
+    tft.fillrect(0, 70, 159, 79, Red);
+    printf("async: %d completion(s)\n", async_completions);
+    save(model, dir, "async");
+
+    return 0;
+}
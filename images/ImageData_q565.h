@@ -0,0 +1,143 @@
+//Q565 image of ImageData.h generated by host/imgconv, do not edit
+//160 x 80, 25600 -> 2111 bytes
+
+#ifndef GIMAGE_0INCH96_1_Q565_H
+#define GIMAGE_0INCH96_1_Q565_H
+
+/** gImage_0inch96_1 compressed, draw with ST7735S::draw_image_q565 */
+const unsigned char gImage_0inch96_1_q565[] = {
+        0x51, 0x35, 0x36, 0x35, 0xA0, 0x00, 0x50, 0x00, 0x55, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+        0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+        0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+        0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+        0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+        0xFD, 0xFD, 0xFD, 0xFD, 0xC1, 0x9C, 0x99, 0x86, 0x88, 0x8F, 0x88, 0x9C, 0x66, 0xA3, 0xAA, 0xA8,
+        0x99, 0x81, 0x88, 0x31, 0xC0, 0x91, 0x99, 0x86, 0x88, 0x97, 0x88, 0x59, 0xA8, 0xAA, 0xB2, 0x88,
+        0x31, 0xFD, 0xFD, 0xD3, 0xA6, 0x77, 0xFE, 0x4C, 0x66, 0xAA, 0x65, 0xA5, 0x77, 0x51, 0x99, 0xAB,
+        0xFE, 0x1A, 0x02, 0x83, 0xEF, 0x92, 0x88, 0xFE, 0x2A, 0xE3, 0xB5, 0x42, 0xA4, 0x88, 0x6E, 0x9B,
+        0x9A, 0x92, 0xBB, 0xFE, 0x42, 0x48, 0x31, 0xFD, 0xFD, 0xD2, 0xAB, 0x87, 0x20, 0x9D, 0xAA, 0x96,
+        0xAB, 0x11, 0x20, 0x6E, 0xFE, 0x4A, 0xE9, 0x9D, 0x76, 0xFE, 0x76, 0x89, 0x20, 0x9B, 0xAB, 0x9A,
+        0xAA, 0x11, 0x55, 0xFE, 0x42, 0x28, 0x31, 0xFD, 0xFD, 0xD2, 0xB9, 0x99, 0xFE, 0x55, 0x27, 0x1B,
+        0xC0, 0x8F, 0xDF, 0x62, 0xB7, 0x20, 0x19, 0xAA, 0x64, 0xB5, 0x31, 0xFE, 0x43, 0x86, 0xA8, 0x65,
+        0xAD, 0x54, 0xC0, 0x91, 0xCC, 0xFE, 0x8C, 0x51, 0x31, 0xFD, 0xD5, 0x66, 0xD6, 0x31, 0xE1, 0x97,
+        0x99, 0xB8, 0x43, 0x20, 0x16, 0x20, 0x99, 0xBB, 0xFE, 0x32, 0x65, 0x94, 0xBC, 0x6E, 0xAD, 0x54,
+        0x04, 0x1B, 0x16, 0x69, 0xFE, 0x29, 0xE4, 0x8D, 0xBC, 0x31, 0xFD, 0xD3, 0xFE, 0xDB, 0xD2, 0xFE,
+        0xC1, 0x2A, 0xA5, 0x78, 0xD6, 0x3B, 0xFE, 0xE4, 0xF6, 0xFE, 0xFF, 0xFF, 0xE0, 0x89, 0x9A, 0x8C,
+        0x41, 0xFE, 0x6E, 0x69, 0xC0, 0x16, 0xFE, 0x10, 0xE3, 0x66, 0x5A, 0x24, 0x1B, 0x25, 0x16, 0xFE,
+        0x2A, 0x24, 0xBF, 0xCE, 0x31, 0xFD, 0xD3, 0xFE, 0xD2, 0xAE, 0xA5, 0x68, 0x31, 0xD7, 0x9D, 0xA9,
+        0xFE, 0xC9, 0xAB, 0xFE, 0xE5, 0x36, 0x31, 0xE0, 0xBF, 0x89, 0x85, 0x99, 0xAC, 0xA5, 0x95, 0x9C,
+        0xA2, 0xB8, 0xFE, 0x90, 0xE7, 0x5A, 0xFE, 0x30, 0xC4, 0x9E, 0x68, 0xAC, 0x74, 0x92, 0x8B, 0x88,
+        0x88, 0x31, 0xC4, 0x2C, 0x9C, 0x88, 0x6E, 0xC0, 0x04, 0x2C, 0x31, 0xD5, 0x98, 0x88, 0xBD, 0x99,
+        0xB7, 0x88, 0x31, 0xDD, 0x09, 0x04, 0x09, 0x04, 0x09, 0x31, 0xC1, 0x99, 0x99, 0x8A, 0x88, 0x2C,
+        0x31, 0xC1, 0x99, 0xBA, 0xFE, 0xC1, 0x0A, 0x31, 0xC0, 0x2C, 0x30, 0x5A, 0x21, 0xA2, 0x88, 0x31,
+        0xC1, 0x21, 0xA6, 0x88, 0x31, 0xCE, 0xFE, 0xC1, 0x6B, 0x31, 0xDF, 0x88, 0x78, 0xFE, 0x40, 0x43,
+        0xFE, 0xC8, 0xC9, 0x66, 0xFE, 0x50, 0xE5, 0xFE, 0xD8, 0xCA, 0x28, 0xC0, 0x7A, 0xFE, 0x38, 0xE4,
+        0xFE, 0xD8, 0xA9, 0xA1, 0x57, 0xFE, 0x28, 0x62, 0x90, 0x47, 0x31, 0xC3, 0x96, 0x88, 0xAD, 0x99,
+        0x6E, 0x9D, 0x99, 0xC0, 0xA5, 0x88, 0xBA, 0x88, 0x80, 0x88, 0xD4, 0x39, 0x00, 0x80, 0x88, 0x31,
+        0xDD, 0xAE, 0x88, 0x19, 0x51, 0x66, 0x14, 0xAD, 0x88, 0x8C, 0x89, 0x31, 0xBB, 0x99, 0x00, 0x8A,
+        0x88, 0x31, 0xC1, 0x92, 0xDA, 0xFE, 0xD3, 0x10, 0x31, 0xC0, 0x8A, 0x88, 0x89, 0x99, 0xAE, 0x88,
+        0x55, 0x04, 0x11, 0x90, 0x88, 0xC0, 0xBD, 0x99, 0x39, 0x31, 0xCE, 0xFE, 0xC1, 0x09, 0x31, 0xDF,
+        0xA8, 0x99, 0xFE, 0xD0, 0xA9, 0xA2, 0x36, 0xFE, 0x10, 0xE3, 0x5A, 0xFE, 0x80, 0xE7, 0xFE, 0xC0,
+        0xC9, 0xC0, 0x0A, 0x3E, 0x01, 0x25, 0x71, 0xFE, 0x31, 0xE7, 0x31, 0xC3, 0x0D, 0x14, 0xAE, 0x88,
+        0xBF, 0x88, 0x15, 0x82, 0x88, 0x95, 0x99, 0x8C, 0x88, 0x31, 0xD3, 0x95, 0x99, 0x00, 0x83, 0x88,
+        0x31, 0xDD, 0xAF, 0x99, 0x05, 0x8A, 0x88, 0xA2, 0x88, 0x18, 0x05, 0xAB, 0x99, 0x31, 0x66, 0x11,
+        0x31, 0xC2, 0x02, 0x36, 0x31, 0xC0, 0x89, 0x99, 0x24, 0x31, 0xC1, 0x8F, 0x99, 0x8B, 0x88, 0x31,
+        0xD1, 0x2F, 0x31, 0xDF, 0xA1, 0xDA, 0xFE, 0xA0, 0xC8, 0x3B, 0x04, 0xA0, 0xD9, 0xFE, 0x60, 0xE5,
+        0x3B, 0xC0, 0x04, 0xA0, 0xFA, 0x07, 0x01, 0xFE, 0x98, 0xC7, 0xFE, 0x39, 0x46, 0x95, 0x67, 0xC3,
+        0x0D, 0x05, 0xB5, 0x99, 0x31, 0xC0, 0x93, 0x99, 0x00, 0xBB, 0x88, 0x31, 0x21, 0xBC, 0x88, 0x01,
+        0x38, 0x24, 0x31, 0xC0, 0x91, 0x99, 0xBE, 0x88, 0x01, 0xA9, 0x99, 0x34, 0x31, 0x87, 0x99, 0x89,
+        0x88, 0xB3, 0x99, 0x87, 0x88, 0xA4, 0x88, 0x81, 0x99, 0x31, 0x95, 0x99, 0x00, 0xB8, 0x78, 0x11,
+        0x15, 0x14, 0x31, 0xC1, 0xBE, 0x88, 0x8D, 0x99, 0x6E, 0xBA, 0x88, 0x31, 0xC0, 0x3D, 0xB3, 0x99,
+        0x95, 0x88, 0xA2, 0x89, 0xBA, 0x87, 0x38, 0xB8, 0x88, 0x38, 0xB7, 0x98, 0x8B, 0x89, 0xAA, 0x88,
+        0x31, 0xC0, 0xB3, 0x99, 0x20, 0x8D, 0x88, 0x31, 0xC1, 0x11, 0x91, 0x99, 0x31, 0xC1, 0x20, 0x00,
+        0x1D, 0x8E, 0x88, 0x3D, 0x86, 0x88, 0x31, 0xC1, 0x02, 0x36, 0x31, 0xC0, 0x10, 0xC0, 0x31, 0xC2,
+        0x24, 0x31, 0x82, 0x88, 0xB7, 0x99, 0x31, 0xC0, 0x35, 0x51, 0x34, 0xBC, 0x88, 0x31, 0xC0, 0x98,
+        0x88, 0xBD, 0x99, 0x6F, 0x50, 0x30, 0x31, 0xC1, 0x2F, 0x31, 0xDE, 0xB8, 0x78, 0x8D, 0xEA, 0xA3,
+        0x16, 0xFE, 0xA8, 0xC8, 0x2B, 0x5A, 0xA0, 0xA8, 0xFE, 0x40, 0xE5, 0xA0, 0xB8, 0x2B, 0x4A, 0x2B,
+        0xA1, 0x27, 0x31, 0xFE, 0x38, 0x83, 0xBE, 0x16, 0xBD, 0xA9, 0xC2, 0x96, 0x88, 0xAC, 0x88, 0xB6,
+        0x88, 0x31, 0xC0, 0x3C, 0x00, 0x84, 0x88, 0x31, 0x00, 0xA3, 0x88, 0x10, 0x83, 0x88, 0x00, 0x30,
+        0xA3, 0x88, 0x00, 0x11, 0xBB, 0x99, 0xBC, 0x88, 0x00, 0x2C, 0x83, 0x88, 0x80, 0x88, 0xA7, 0x99,
+        0x18, 0x88, 0x88, 0x00, 0x2C, 0x0D, 0x05, 0x28, 0xB6, 0x88, 0x8F, 0x88, 0x00, 0x8C, 0x88, 0x31,
+        0xB7, 0x99, 0x00, 0x21, 0x20, 0x00, 0x8B, 0x88, 0x31, 0xA3, 0x99, 0x19, 0x00, 0x1C, 0xB7, 0x88,
+        0x05, 0xC1, 0x87, 0x99, 0x11, 0x00, 0x31, 0x30, 0x00, 0xB1, 0x88, 0x31, 0xC2, 0x11, 0x00, 0x31,
+        0xC1, 0xAE, 0x88, 0x00, 0x2C, 0x2D, 0x00, 0x8F, 0x88, 0x31, 0xC1, 0x02, 0x36, 0x31, 0xC0, 0x10,
+        0x6E, 0x31, 0xC1, 0x9A, 0x88, 0x20, 0x31, 0xBA, 0x88, 0xBD, 0x99, 0x31, 0x08, 0xBC, 0x88, 0x31,
+        0xC0, 0xAC, 0x88, 0x91, 0x99, 0x2C, 0xAC, 0x88, 0x2C, 0x31, 0x1D, 0xAC, 0x88, 0x31, 0xC1, 0x2F,
+        0x31, 0xDD, 0x89, 0x79, 0xFE, 0x68, 0x24, 0xFE, 0xC0, 0xC9, 0xFE, 0x38, 0xE4, 0x2B, 0x4E, 0xC0,
+        0x2B, 0x27, 0xA0, 0xB9, 0xFE, 0xC8, 0xC9, 0x2A, 0xC0, 0x2E, 0xFE, 0x28, 0xE4, 0x9F, 0x1F, 0xFE,
+        0x40, 0x01, 0xFE, 0xCE, 0xBA, 0x31, 0xC1, 0x0D, 0x19, 0xA5, 0x99, 0xA6, 0x88, 0x10, 0x05, 0x24,
+        0x31, 0x18, 0x95, 0x88, 0x1C, 0x31, 0x8B, 0x99, 0x00, 0x88, 0x88, 0xAF, 0x88, 0x00, 0xBC, 0x88,
+        0x31, 0x09, 0x20, 0x31, 0x83, 0x99, 0x00, 0x1C, 0x31, 0x24, 0x00, 0x87, 0x88, 0x21, 0x00, 0x14,
+        0x31, 0xC0, 0x00, 0xB4, 0x88, 0x31, 0x00, 0xB5, 0x88, 0x31, 0xC0, 0xA6, 0x88, 0xAA, 0x88, 0x31,
+        0xA3, 0x99, 0x0C, 0x31, 0xC0, 0x8A, 0x88, 0x00, 0x82, 0x88, 0x31, 0xC0, 0x86, 0x88, 0x00, 0x25,
+        0x10, 0x00, 0x8D, 0x89, 0x31, 0xC2, 0x11, 0x95, 0x99, 0xB1, 0x89, 0x7E, 0x92, 0x88, 0x00, 0x08,
+        0x31, 0x2D, 0x00, 0x20, 0x31, 0xC1, 0x02, 0x36, 0x31, 0xC0, 0x15, 0x8F, 0x99, 0xB2, 0x78, 0x61,
+        0x9C, 0x88, 0x84, 0x88, 0x09, 0x31, 0xBB, 0x99, 0xBD, 0x88, 0x31, 0xB1, 0x99, 0x31, 0xC1, 0x25,
+        0xA5, 0x99, 0x8D, 0x88, 0x24, 0x31, 0xC1, 0x01, 0xC0, 0x31, 0xC0, 0x2F, 0x31, 0xDD, 0xB4, 0x67,
+        0xFE, 0xC8, 0x88, 0xA2, 0x47, 0x1E, 0x2B, 0x2A, 0x66, 0x2B, 0xFE, 0x30, 0xE4, 0xC0, 0x2E, 0x25,
+        0xC0, 0x2B, 0x0E, 0x2E, 0x9D, 0x37, 0xFE, 0x6B, 0xCE, 0x31, 0xC1, 0x96, 0x88, 0xAE, 0x88, 0xA7,
+        0x99, 0x30, 0x10, 0x9A, 0x88, 0x9A, 0x88, 0x31, 0xC0, 0x2D, 0x3C, 0x19, 0x3C, 0x19, 0x2D, 0x31,
+        0x04, 0x00, 0xC0, 0x3D, 0x82, 0x88, 0x31, 0x82, 0x88, 0x00, 0x94, 0x88, 0x31, 0x08, 0x00, 0xBE,
+        0x88, 0xBA, 0x88, 0x00, 0x81, 0x89, 0x31, 0xC0, 0xA2, 0x88, 0xAD, 0x99, 0x08, 0x14, 0xA5, 0x88,
+        0x3C, 0xC0, 0x05, 0x10, 0x31, 0x14, 0x39, 0x31, 0xC0, 0x15, 0x00, 0x8D, 0x88, 0x31, 0xC0, 0x9B,
+        0x99, 0x14, 0xBA, 0x88, 0x9A, 0x88, 0x05, 0x31, 0xC3, 0xB0, 0x88, 0x96, 0x88, 0x24, 0xC0, 0x20,
+        0xB0, 0x88, 0x31, 0xC0, 0x86, 0x88, 0xBB, 0x99, 0x90, 0x88, 0x31, 0xC1, 0x02, 0x36, 0x31, 0xC0,
+        0x15, 0x8F, 0x99, 0x15, 0x66, 0x20, 0x31, 0xC1, 0xBB, 0x99, 0x21, 0x66, 0x85, 0x88, 0x31, 0xC3,
+        0x09, 0xBB, 0x98, 0x31, 0xC1, 0x92, 0x88, 0x8E, 0x88, 0x80, 0x88, 0xC0, 0x2F, 0x31, 0xDD, 0xB5,
+        0x68, 0x90, 0x0F, 0xA3, 0x47, 0xFE, 0x00, 0xE2, 0xFE, 0xB0, 0xE8, 0x2B, 0xC0, 0xFE, 0x60, 0xE6,
+        0xFE, 0x10, 0xE3, 0xC0, 0x27, 0x2B, 0xC0, 0xFE, 0x88, 0xE7, 0xFE, 0x00, 0xE2, 0xFE, 0xC0, 0xC9,
+        0x9D, 0x47, 0xFE, 0x6B, 0xAE, 0x82, 0x98, 0xC1, 0x0D, 0x05, 0xB6, 0x88, 0x31, 0x8D, 0x99, 0x00,
+        0x09, 0x31, 0x94, 0x88, 0x00, 0xB9, 0x88, 0x31, 0x8C, 0x88, 0x00, 0x2D, 0x31, 0xC1, 0x8A, 0x88,
+        0x24, 0x00, 0x9C, 0x88, 0x86, 0x88, 0x00, 0x1C, 0x31, 0x90, 0x89, 0x00, 0x83, 0x88, 0xB4, 0x88,
+        0x00, 0x19, 0x31, 0xC0, 0x00, 0x34, 0x87, 0x88, 0x00, 0xB5, 0x88, 0x80, 0x88, 0x9C, 0x88, 0x39,
+        0xC0, 0x31, 0xA3, 0x99, 0x34, 0x31, 0xC0, 0x15, 0x00, 0x38, 0x31, 0xC1, 0x0C, 0x3C, 0x01, 0xAD,
+        0x99, 0x31, 0xC3, 0xB0, 0x88, 0x00, 0x31, 0xC4, 0x2D, 0x00, 0x20, 0x31, 0xC1, 0x02, 0x36, 0x31,
+        0xC0, 0x10, 0x15, 0x31, 0xC4, 0x04, 0x21, 0xA3, 0x99, 0xBC, 0x88, 0x31, 0xC3, 0x2C, 0xB3, 0x89,
+        0x31, 0xC1, 0x3D, 0x95, 0x99, 0x31, 0xC0, 0xFE, 0xC1, 0x09, 0x31, 0xDD, 0x8E, 0x78, 0xFE, 0x50,
+        0x43, 0x27, 0xFE, 0x08, 0xE3, 0xC0, 0xA0, 0xF9, 0xA0, 0x47, 0xFE, 0x90, 0xE7, 0x2B, 0x7B, 0xFE,
+        0x80, 0xE7, 0x3E, 0x0B, 0x3B, 0xA0, 0xE9, 0x37, 0x9B, 0x27, 0x97, 0x47, 0x31, 0xC1, 0x0D, 0x05,
+        0x1C, 0x31, 0xC0, 0xAC, 0x88, 0x00, 0x9D, 0x88, 0x25, 0x00, 0xB9, 0x88, 0x1D, 0xB8, 0x88, 0x05,
+        0x10, 0xA3, 0x88, 0x00, 0x28, 0x31, 0xBD, 0x99, 0x00, 0x98, 0x88, 0x19, 0x05, 0xB7, 0x99, 0xBE,
+        0x88, 0x11, 0x00, 0x1C, 0x55, 0x05, 0xAB, 0x99, 0x0D, 0x88, 0x88, 0x00, 0x81, 0x88, 0x31, 0xA9,
+        0x99, 0x9A, 0x88, 0x8C, 0x88, 0x1C, 0x08, 0x0C, 0x31, 0x14, 0x34, 0x31, 0xC0, 0x15, 0x00, 0x8C,
+        0x88, 0x31, 0xC1, 0x88, 0x88, 0xBC, 0x88, 0x51, 0x20, 0x31, 0xC3, 0x11, 0x00, 0x31, 0xC4, 0x2D,
+        0x00, 0x20, 0x31, 0xC1, 0x92, 0xD9, 0x36, 0x31, 0xC0, 0x89, 0x99, 0xC0, 0x31, 0xC4, 0xBB, 0x99,
+        0x1C, 0x31, 0x24, 0x31, 0xC1, 0xB8, 0x88, 0xBB, 0x99, 0x1C, 0xBD, 0x88, 0x31, 0xC1, 0xB1, 0x99,
+        0x87, 0x88, 0x31, 0xC0, 0x2F, 0x31, 0xDE, 0xAC, 0x68, 0xFE, 0x68, 0xC5, 0xFE, 0xC0, 0xC9, 0xFE,
+        0x58, 0xE5, 0xFE, 0x00, 0xE2, 0xFE, 0x60, 0xE6, 0x2B, 0x2A, 0xC0, 0x2B, 0xFE, 0x48, 0xE5, 0xA0,
+        0x06, 0xFE, 0xA8, 0xE8, 0xFE, 0xE0, 0xCA, 0xFE, 0x48, 0x84, 0xFE, 0x53, 0x0B, 0x87, 0xA9, 0xC2,
+        0x95, 0x99, 0x00, 0xB2, 0x88, 0x31, 0xC0, 0x29, 0x00, 0xB1, 0x88, 0x31, 0x20, 0x00, 0xC0, 0x11,
+        0x00, 0x18, 0x31, 0x35, 0x00, 0xC1, 0x1D, 0x31, 0x82, 0x89, 0x19, 0xA9, 0x99, 0x00, 0xC0, 0x09,
+        0x31, 0x93, 0x99, 0x00, 0xB2, 0x88, 0x00, 0xC0, 0x38, 0x92, 0x88, 0x31, 0x98, 0x88, 0xB1, 0x99,
+        0x00, 0xC0, 0x19, 0x8E, 0x88, 0x31, 0x00, 0xAE, 0x88, 0x31, 0xC0, 0x87, 0x99, 0x00, 0x8A, 0x88,
+        0x31, 0xC2, 0x05, 0xA5, 0x99, 0x31, 0xC4, 0xAB, 0x99, 0x00, 0x2C, 0x31, 0xC3, 0x83, 0x99, 0x00,
+        0x8E, 0x88, 0x31, 0xC1, 0x02, 0x36, 0x31, 0xC0, 0x2D, 0xC0, 0x31, 0xC4, 0xB7, 0x99, 0x0D, 0x31,
+        0x08, 0xB9, 0x88, 0x14, 0x1C, 0x18, 0x31, 0xC0, 0x85, 0x99, 0x8D, 0x88, 0xB2, 0x88, 0x8E, 0x89,
+        0xB5, 0x98, 0x31, 0xC1, 0x2F, 0x31, 0xDE, 0x83, 0x78, 0xFE, 0x90, 0x66, 0xA3, 0xEA, 0x2B, 0xFE,
+        0x48, 0xE5, 0x37, 0x28, 0x2A, 0xC0, 0x2B, 0x21, 0xFE, 0xA0, 0xE8, 0x28, 0xC0, 0xFE, 0x58, 0x43,
+        0xFE, 0xB5, 0xD7, 0x31, 0xC2, 0x66, 0x9C, 0x88, 0xA2, 0x88, 0x31, 0xC1, 0x9C, 0x88, 0x51, 0x31,
+        0xC0, 0x35, 0x09, 0x31, 0x04, 0x09, 0x31, 0xC0, 0x2C, 0x0D, 0x31, 0xC1, 0x82, 0x88, 0xBF, 0x99,
+        0x97, 0x88, 0x04, 0x09, 0x31, 0xC0, 0x2C, 0x9B, 0x89, 0x31, 0x2C, 0x21, 0x31, 0xC3, 0x04, 0x51,
+        0x31, 0xC1, 0x04, 0x09, 0x31, 0xC0, 0x51, 0x04, 0x2C, 0x31, 0xC2, 0x00, 0xB8, 0x88, 0x31, 0xC4,
+        0x09, 0x04, 0x31, 0xC4, 0x1D, 0x04, 0x2C, 0x31, 0xC1, 0x9A, 0xB9, 0xFE, 0xC1, 0x6B, 0x31, 0xC0,
+        0x55, 0x6B, 0x31, 0xC4, 0x18, 0x31, 0xC2, 0x93, 0x99, 0x18, 0x31, 0xC2, 0x1D, 0x96, 0x88, 0x2C,
+        0x31, 0xC1, 0x61, 0xFE, 0xC9, 0xCC, 0x31, 0xDE, 0x97, 0x89, 0xFE, 0x48, 0x02, 0x2B, 0x4A, 0x4D,
+        0xFE, 0x18, 0xE3, 0x28, 0x2B, 0xC0, 0x1D, 0xFE, 0x30, 0xE4, 0x2B, 0x2A, 0x2B, 0xFE, 0x40, 0x83,
+        0x99, 0x27, 0x31, 0xD8, 0x81, 0x99, 0x80, 0x88, 0x39, 0x31, 0xDA, 0x8B, 0x99, 0x81, 0x88, 0x00,
+        0x34, 0x31, 0xD3, 0xFE, 0xDB, 0x71, 0x9A, 0xA8, 0x2C, 0x31, 0xD6, 0x99, 0xB9, 0x25, 0xFE, 0xEE,
+        0x19, 0x31, 0xDF, 0xB7, 0x78, 0xFE, 0x78, 0x24, 0x2E, 0x28, 0x3E, 0xC0, 0xFE, 0x50, 0xE5, 0x5A,
+        0x3B, 0x21, 0xFE, 0xE0, 0xCA, 0x2E, 0xFE, 0x60, 0x03, 0xFE, 0x74, 0x30, 0x31, 0xD9, 0x2D, 0x10,
+        0x0D, 0x31, 0xDA, 0x80, 0x88, 0x85, 0x99, 0x2D, 0xBA, 0x88, 0xD5, 0xFE, 0xED, 0x77, 0xFE, 0xC9,
+        0xCC, 0xC0, 0xA2, 0x78, 0xD5, 0xA4, 0x77, 0xFE, 0xF6, 0x5A, 0x31, 0xE1, 0x81, 0x78, 0x82, 0xDA,
+        0xA3, 0x78, 0xA2, 0x77, 0xFE, 0x78, 0xE6, 0xA0, 0xCA, 0x17, 0xA0, 0x47, 0xFE, 0x18, 0xE3, 0x9D,
+        0xFA, 0xA1, 0x58, 0x81, 0x47, 0x31, 0xFD, 0xFD, 0xD7, 0x98, 0x88, 0xBB, 0x88, 0xFE, 0x40, 0x43,
+        0x2E, 0x2B, 0xC0, 0x26, 0xFE, 0x28, 0x42, 0xB4, 0x37, 0x86, 0x88, 0x31, 0xFD, 0xFD, 0xDA, 0x8F,
+        0x89, 0xB6, 0xC9, 0xFE, 0x68, 0x44, 0xC0, 0xFE, 0x28, 0xE4, 0x8E, 0x57, 0x31, 0xFD, 0xFD, 0xDE,
+        0x98, 0x78, 0xC0, 0x31, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+        0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+        0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+        0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+        0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xDC,
+};
+
+#endif
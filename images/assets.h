@@ -0,0 +1,59 @@
+//Asset registry generated by host/assetgen, do not edit
+//12 assets, 225169 bytes of const data
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include "Asset.h"
+#include "ImageData.h"
+#include "ekimemo.h"
+#include "ImageData_q565.h"
+#include "ekimemo_q565.h"
+#include "../fonts/Arial12x12.h"
+#include "../fonts/Arial24x23.h"
+#include "../fonts/Arial28x28.h"
+#include "../fonts/font_big.h"
+#include "../fonts/Arial12x12_atlas.h"
+#include "../fonts/Arial24x23_atlas.h"
+#include "../fonts/Arial28x28_atlas.h"
+#include "../fonts/Neu42x35_atlas.h"
+
+enum AssetId {
+    ASSET_GIMAGE_0INCH96_1,
+    ASSET_EKIMEMO_BMP,
+    ASSET_GIMAGE_0INCH96_1_Q565,
+    ASSET_EKIMEMO_BMP_Q565,
+    ASSET_ARIAL12X12,
+    ASSET_ARIAL24X23,
+    ASSET_ARIAL28X28,
+    ASSET_NEU42X35,
+    ASSET_ARIAL12X12_ATLAS,
+    ASSET_ARIAL24X23_ATLAS,
+    ASSET_ARIAL28X28_ATLAS,
+    ASSET_NEU42X35_ATLAS,
+    ASSET_COUNT
+};
+
+/** images and fonts by reference, indexed by AssetId */
+const Asset asset_table[ASSET_COUNT] = {
+    { "gImage_0inch96_1", ASSET_RGB565, 160, 80, 320, gImage_0inch96_1, sizeof(gImage_0inch96_1) },
+    { "ekimemo_bmp", ASSET_RGB565, 160, 284, 320, ekimemo_bmp, sizeof(ekimemo_bmp) },
+    { "gImage_0inch96_1_q565", ASSET_Q565, 160, 80, 0, gImage_0inch96_1_q565, sizeof(gImage_0inch96_1_q565) },
+    { "ekimemo_bmp_q565", ASSET_Q565, 160, 284, 0, ekimemo_bmp_q565, sizeof(ekimemo_bmp_q565) },
+    { "Arial12x12", ASSET_GLCD_FONT, 12, 12, 0, Arial12x12, sizeof(Arial12x12) },
+    { "Arial24x23", ASSET_GLCD_FONT, 24, 23, 0, Arial24x23, sizeof(Arial24x23) },
+    { "Arial28x28", ASSET_GLCD_FONT, 28, 28, 0, Arial28x28, sizeof(Arial28x28) },
+    { "Neu42x35", ASSET_GLCD_FONT, 42, 35, 0, Neu42x35, sizeof(Neu42x35) },
+    { "Arial12x12_atlas", ASSET_ATLAS_FONT, 12, 12, 0, &Arial12x12_atlas, sizeof(Arial12x12_atlas) + sizeof(Arial12x12_atlas_glyphs) + sizeof(Arial12x12_atlas_bitmap) },
+    { "Arial24x23_atlas", ASSET_ATLAS_FONT, 24, 23, 0, &Arial24x23_atlas, sizeof(Arial24x23_atlas) + sizeof(Arial24x23_atlas_glyphs) + sizeof(Arial24x23_atlas_bitmap) },
+    { "Arial28x28_atlas", ASSET_ATLAS_FONT, 28, 28, 0, &Arial28x28_atlas, sizeof(Arial28x28_atlas) + sizeof(Arial28x28_atlas_glyphs) + sizeof(Arial28x28_atlas_bitmap) },
+    { "Neu42x35_atlas", ASSET_ATLAS_FONT, 42, 35, 0, &Neu42x35_atlas, sizeof(Neu42x35_atlas) + sizeof(Neu42x35_atlas_glyphs) + sizeof(Neu42x35_atlas_bitmap) },
+};
+
+/** Look up an asset by name, NULL if there is none */
+inline const Asset *asset_find(const char *name)
+{
+    return asset_lookup(asset_table, ASSET_COUNT, name);
+}
+
+#endif
@@ -1,4 +1,7 @@
-unsigned char ekimemo_bmp[] = {
+#ifndef EKIMEMO_H
+#define EKIMEMO_H
+
+const unsigned char ekimemo_bmp[] = {
   0x5c, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x7c, 0xef, 0x7d, 0xf7, 0x9d, 0xf7,
   0x9d, 0xf7, 0x9d, 0xf7, 0x7c, 0xef, 0x3b, 0xe7, 0xda, 0xde, 0x38, 0xce,
   0xb5, 0xbd, 0x54, 0xb5, 0x33, 0xb5, 0xb5, 0xbd, 0x78, 0xd6, 0xda, 0xde,
@@ -7574,4 +7577,6 @@ unsigned char ekimemo_bmp[] = {
   0xd5, 0xc5, 0xb5, 0xc5, 0x37, 0xce, 0xb9, 0xde, 0x99, 0xd6, 0x99, 0xd6,
   0x99, 0xd6, 0x99, 0xd6
 };
-unsigned int ekimemo_bmp_len = 90880;
+const unsigned int ekimemo_bmp_len = 90880;
+
+#endif
@@ -0,0 +1,3119 @@
+//Q565 image of ekimemo.h generated by host/imgconv, do not edit
+//160 x 284, 90880 -> 49723 bytes
+
+#ifndef EKIMEMO_BMP_Q565_H
+#define EKIMEMO_BMP_Q565_H
+
+/** ekimemo_bmp compressed, draw with ST7735S::draw_image_q565 */
+const unsigned char ekimemo_bmp_q565[] = {
+        0x51, 0x35, 0x36, 0x35, 0xA0, 0x00, 0x1C, 0x01, 0x9A, 0x87, 0xC1, 0x6E, 0x7B, 0x6E, 0xC1, 0x02,
+        0x51, 0x9D, 0x99, 0x9B, 0x99, 0x9C, 0x87, 0x9D, 0x99, 0x65, 0x39, 0xA6, 0x88, 0x15, 0xA2, 0x88,
+        0xA4, 0x87, 0xA2, 0x88, 0x56, 0x7F, 0x1E, 0x25, 0x65, 0x65, 0xC0, 0x19, 0xC0, 0x66, 0xC0, 0x66,
+        0x14, 0xC1, 0x0F, 0xC0, 0x14, 0x0F, 0x14, 0xC0, 0x19, 0xC0, 0x9D, 0xAA, 0x66, 0x0A, 0x14, 0xC0,
+        0x6F, 0x25, 0x14, 0xC0, 0x0F, 0x05, 0x6B, 0x05, 0xC5, 0x69, 0x6E, 0x05, 0x0A, 0xC0, 0x5A, 0x14,
+        0x0F, 0x07, 0x66, 0x62, 0xC1, 0x6E, 0x02, 0x07, 0x14, 0x6B, 0x20, 0xC1, 0x51, 0x02, 0x56, 0x02,
+        0x07, 0x51, 0xC0, 0x3A, 0x07, 0x0C, 0xC0, 0x07, 0x5A, 0x3A, 0x66, 0x55, 0x6E, 0x33, 0xC0, 0x2B,
+        0xC0, 0x6B, 0x33, 0x6F, 0x04, 0x3F, 0x3A, 0x32, 0xC3, 0x3F, 0x04, 0x11, 0xC0, 0x16, 0xC0, 0x6B,
+        0xC2, 0x6E, 0x1D, 0xC6, 0x11, 0xC1, 0x56, 0x65, 0x2E, 0x15, 0x9C, 0x88, 0x9B, 0x99, 0x9D, 0x98,
+        0x55, 0x20, 0xA6, 0x78, 0xA7, 0x88, 0xA3, 0x89, 0x09, 0x1D, 0xC2, 0x16, 0x66, 0xC1, 0x3D, 0xC2,
+        0x09, 0x0C, 0x11, 0xC1, 0x55, 0x3D, 0x9D, 0x89, 0x9C, 0x98, 0x9C, 0x87, 0x9C, 0x98, 0x55, 0x6F,
+        0xA6, 0x88, 0xA4, 0x88, 0xA2, 0x88, 0xA4, 0x77, 0x1E, 0xC0, 0x6B, 0x1E, 0x66, 0xC0, 0x14, 0x0F,
+        0xC2, 0x0A, 0xC0, 0x6D, 0x14, 0x0F, 0x0A, 0xC4, 0x0F, 0xC0, 0x0A, 0x05, 0xC0, 0x0F, 0x14, 0xC3,
+        0x0F, 0x05, 0x6B, 0x05, 0xC2, 0x0F, 0x3E, 0x05, 0x66, 0x05, 0x5A, 0x0A, 0x55, 0xA2, 0x78, 0xA2,
+        0x88, 0x11, 0x0C, 0x3B, 0x38, 0xC2, 0x02, 0x1B, 0x20, 0x0C, 0x1B, 0x20, 0x0C, 0x51, 0x67, 0x62,
+        0x33, 0xC0, 0x07, 0xC1, 0x0C, 0x07, 0xA2, 0x78, 0x6E, 0xC0, 0x07, 0x33, 0x66, 0x3F, 0x3A, 0x35,
+        0x56, 0xC0, 0x2B, 0x33, 0xC0, 0x2B, 0xC0, 0x32, 0x2D, 0x32, 0xC1, 0x6D, 0x33, 0x11, 0x1D, 0xC0,
+        0x16, 0x11, 0x1D, 0xC1, 0x22, 0x1D, 0xC0, 0x22, 0x1D, 0xC4, 0x11, 0x5A, 0xC0, 0x65, 0x38, 0x51,
+        0x9D, 0x88, 0x9B, 0x99, 0x9D, 0x98, 0x50, 0xC0, 0x39, 0xA6, 0x88, 0x29, 0x3D, 0x11, 0x1D, 0xC1,
+        0x20, 0x16, 0xC0, 0x1D, 0x11, 0x56, 0x3D, 0xC1, 0x02, 0x0C, 0x11, 0xC1, 0x0C, 0x3D, 0x55, 0x15,
+        0x9C, 0x88, 0x9C, 0x98, 0x9D, 0x88, 0x66, 0x08, 0xA6, 0x87, 0xA3, 0x89, 0xA3, 0x88, 0xA3, 0x98,
+        0x6B, 0x1E, 0x19, 0x12, 0x66, 0x0F, 0xC0, 0x0A, 0xC0, 0x6B, 0xC0, 0x0A, 0xA2, 0x77, 0xC1, 0x0F,
+        0x0A, 0x05, 0xC0, 0x0A, 0x0F, 0x14, 0xC0, 0x0A, 0xC2, 0x0F, 0x0A, 0xC0, 0x0F, 0xC0, 0x0A, 0x05,
+        0xC1, 0x0F, 0x0A, 0xC0, 0x14, 0x0F, 0xC0, 0x00, 0x5A, 0xC0, 0x05, 0x0C, 0x19, 0x6B, 0xC0, 0x14,
+        0xC0, 0x9D, 0x9A, 0x3D, 0x66, 0x66, 0x3D, 0x07, 0x0C, 0xC1, 0x02, 0xC0, 0x3A, 0x62, 0xC0, 0x6D,
+        0x6E, 0x18, 0x0C, 0xC0, 0xA2, 0x78, 0x0C, 0xA3, 0x88, 0x22, 0x1D, 0x3F, 0x0C, 0x3A, 0x3F, 0x3A,
+        0x32, 0x66, 0xC0, 0x3A, 0x3F, 0x07, 0x3F, 0x32, 0xC3, 0x6B, 0x32, 0x0C, 0x6E, 0x16, 0xC1, 0x18,
+        0x1D, 0xC8, 0x16, 0x1D, 0x16, 0x11, 0x09, 0x69, 0x66, 0x29, 0x9D, 0x98, 0x21, 0x9C, 0x88, 0x9D,
+        0x99, 0x69, 0x28, 0xA5, 0x89, 0x15, 0x3D, 0x6F, 0x18, 0x1D, 0xC5, 0x11, 0x09, 0x3D, 0xC0, 0x02,
+        0xC0, 0x11, 0xC3, 0x09, 0x3D, 0x29, 0x9D, 0x98, 0x21, 0x39, 0x51, 0x7E, 0x21, 0xA7, 0x97, 0xA2,
+        0x89, 0x12, 0x14, 0x0D, 0x14, 0x0F, 0xC1, 0x0A, 0x6B, 0xC1, 0x0A, 0x0F, 0x0A, 0x0F, 0x14, 0x0F,
+        0x0A, 0x05, 0xC0, 0x0F, 0x14, 0x6E, 0x14, 0x0A, 0xC1, 0x0F, 0x05, 0xC2, 0x0A, 0x0F, 0x14, 0x0F,
+        0xC0, 0x14, 0xC0, 0x0F, 0xC0, 0x0A, 0x05, 0x56, 0xC0, 0x38, 0x3D, 0x6E, 0x07, 0x14, 0xC0, 0x6F,
+        0xC0, 0x07, 0x02, 0x3D, 0x02, 0xA2, 0x78, 0x20, 0xC1, 0x1B, 0x14, 0x02, 0x9D, 0x99, 0x30, 0xC0,
+        0x2E, 0x02, 0x18, 0x0C, 0x18, 0xC0, 0x0C, 0x18, 0x20, 0x18, 0xC0, 0x22, 0x18, 0x0C, 0x1D, 0x3F,
+        0x2B, 0x3A, 0xC0, 0x3F, 0x3A, 0x2B, 0x32, 0xC0, 0x6D, 0x2B, 0x32, 0xC0, 0x6E, 0x3F, 0x04, 0xC0,
+        0x0C, 0x5A, 0xC0, 0x1D, 0x09, 0x18, 0x1D, 0xC7, 0x65, 0x0E, 0x65, 0x66, 0x51, 0x9D, 0x99, 0x9D,
+        0x88, 0x08, 0x25, 0x65, 0x25, 0x08, 0x01, 0xA5, 0x88, 0x02, 0x11, 0x1D, 0xC0, 0x16, 0x1D, 0xC3,
+        0x11, 0x1D, 0x3D, 0xC1, 0x02, 0x0C, 0x11, 0xC2, 0x0E, 0x02, 0x56, 0x9D, 0xA8, 0x01, 0x1C, 0x34,
+        0x25, 0x08, 0x35, 0xA6, 0x97, 0x0D, 0x14, 0x0F, 0xC2, 0x69, 0x0A, 0xC4, 0x14, 0x6E, 0x14, 0x0A,
+        0x0F, 0x0A, 0xC0, 0x14, 0xC1, 0x0F, 0x14, 0x19, 0x0F, 0x0A, 0xC0, 0x05, 0x00, 0x05, 0x0F, 0xA3,
+        0x78, 0x19, 0xC0, 0x20, 0x14, 0x20, 0xC0, 0x1B, 0x20, 0x1B, 0x9D, 0x99, 0x66, 0xC0, 0x02, 0x0A,
+        0x0C, 0x20, 0x11, 0xC0, 0x20, 0x07, 0x1B, 0x02, 0x1B, 0x18, 0x20, 0x5A, 0x16, 0x19, 0x0C, 0x02,
+        0x56, 0x62, 0x6E, 0xC0, 0x69, 0x02, 0x07, 0x18, 0x13, 0x07, 0xC0, 0x18, 0xC1, 0x20, 0xC1, 0x18,
+        0x0C, 0x3F, 0xC0, 0x07, 0x3F, 0xC1, 0x04, 0x33, 0x5A, 0x3A, 0x30, 0x37, 0x3F, 0x11, 0xC1, 0x09,
+        0x04, 0x56, 0x7D, 0x04, 0x09, 0x1D, 0xC0, 0x22, 0x1D, 0xC2, 0x25, 0x1D, 0x11, 0x09, 0x3D, 0x55,
+        0x15, 0x9D, 0x98, 0x9C, 0x88, 0x9D, 0x98, 0x52, 0xC0, 0xA3, 0x88, 0xA5, 0x89, 0x29, 0xA3, 0x88,
+        0x0E, 0x1D, 0xC9, 0x3D, 0xC1, 0x09, 0x0C, 0x11, 0xC3, 0x0E, 0x02, 0x2E, 0x1A, 0x35, 0x0D, 0x34,
+        0x39, 0xA5, 0x98, 0x1E, 0x08, 0x0F, 0xC0, 0x14, 0xC1, 0x08, 0x0F, 0xC0, 0x0A, 0xC1, 0x0F, 0x14,
+        0x19, 0xC2, 0x14, 0x0A, 0xC0, 0x0F, 0xC0, 0x19, 0xC2, 0x1B, 0x05, 0x00, 0xC0, 0x05, 0x0A, 0x0F,
+        0x19, 0x6B, 0x16, 0x20, 0x19, 0xC0, 0x20, 0xC0, 0x0F, 0x52, 0x0F, 0x02, 0x14, 0x1B, 0x20, 0x14,
+        0x11, 0xC0, 0x1D, 0x1B, 0x20, 0x07, 0x18, 0x20, 0x1D, 0xC1, 0x16, 0x11, 0xC0, 0x07, 0x3A, 0x3F,
+        0x07, 0xC0, 0x0C, 0x07, 0x0C, 0x13, 0x04, 0x07, 0x18, 0x1D, 0x11, 0x20, 0xC2, 0x1D, 0x18, 0x0C,
+        0x1D, 0xC1, 0x11, 0x18, 0x3F, 0x04, 0x1D, 0x3F, 0x69, 0x0C, 0x04, 0x0C, 0x09, 0x04, 0x3C, 0x37,
+        0x3C, 0xC1, 0x09, 0x16, 0x22, 0x1D, 0x22, 0x1D, 0xC0, 0x25, 0x1D, 0x0E, 0x65, 0x38, 0x1A, 0x01,
+        0x9C, 0x88, 0x34, 0x51, 0xC0, 0x34, 0x1C, 0x15, 0x3D, 0x09, 0x11, 0x1D, 0xC0, 0x16, 0x1D, 0xC5,
+        0x22, 0x3D, 0xC1, 0x09, 0x0C, 0x11, 0xC4, 0x0E, 0x02, 0x2E, 0x15, 0x35, 0x60, 0x7F, 0xA4, 0x87,
+        0xA2, 0x79, 0x7F, 0x08, 0x6E, 0x14, 0x0D, 0xC0, 0x14, 0x6E, 0x0A, 0x0F, 0x0A, 0xC0, 0x0F, 0x14,
+        0x19, 0x14, 0x19, 0x14, 0xC0, 0x0A, 0x05, 0x0A, 0x1B, 0x6E, 0x19, 0x11, 0x19, 0x14, 0x05, 0x00,
+        0x6B, 0x05, 0x20, 0xC2, 0x16, 0xC0, 0x20, 0xC1, 0x1B, 0x51, 0x1B, 0xC0, 0x07, 0x19, 0xC0, 0x11,
+        0xC2, 0x16, 0x6B, 0xC0, 0x13, 0x16, 0x1D, 0xC1, 0x16, 0x11, 0xC1, 0x9D, 0xAA, 0x0C, 0x18, 0xC1,
+        0xA2, 0x87, 0xC0, 0x18, 0xC0, 0x0C, 0x18, 0x0C, 0x18, 0xC0, 0x1D, 0x20, 0xC1, 0x1D, 0xC0, 0x11,
+        0x1D, 0xC1, 0x25, 0x18, 0x04, 0x13, 0x20, 0x04, 0x0C, 0x16, 0x0C, 0x11, 0xC0, 0x09, 0x3C, 0xC0,
+        0x04, 0x5A, 0xC0, 0x09, 0x0E, 0x22, 0x1D, 0x16, 0x25, 0x1D, 0xC0, 0x22, 0x50, 0x66, 0x9D, 0x99,
+        0x9D, 0x98, 0x9D, 0x88, 0x9C, 0x99, 0x9D, 0x88, 0x66, 0xA2, 0x88, 0xA3, 0x88, 0xA5, 0x89, 0x2E,
+        0xA2, 0x89, 0x11, 0x1D, 0xC5, 0x22, 0xC1, 0x7A, 0x22, 0x09, 0x3D, 0xC0, 0x09, 0x0C, 0x11, 0xC5,
+        0x09, 0x3D, 0x29, 0x15, 0x35, 0x9D, 0x98, 0x0D, 0x21, 0xA7, 0xA8, 0x6F, 0xA3, 0x88, 0x14, 0x12,
+        0x14, 0x19, 0x14, 0x03, 0x0F, 0xC0, 0x0A, 0xC0, 0x19, 0x14, 0x11, 0xC1, 0x14, 0x0A, 0x05, 0x0A,
+        0x14, 0xC0, 0x19, 0xC1, 0x14, 0x0A, 0x05, 0xC0, 0x0A, 0xC0, 0x1B, 0x6E, 0xC0, 0x1D, 0x11, 0xC0,
+        0x16, 0x20, 0x0F, 0x0A, 0x20, 0x1B, 0x0F, 0x11, 0xC4, 0x16, 0xC0, 0x11, 0x16, 0x11, 0x16, 0x1D,
+        0xC1, 0x11, 0xC0, 0x14, 0x52, 0x18, 0x1D, 0x20, 0xC0, 0x25, 0xC1, 0x20, 0x07, 0x18, 0x0C, 0x04,
+        0x0C, 0x1D, 0x20, 0x1D, 0x20, 0x16, 0x20, 0x16, 0x1D, 0xC0, 0x18, 0xC0, 0x0C, 0x3F, 0x09, 0x11,
+        0x09, 0x1D, 0x16, 0x0C, 0x11, 0xC0, 0x09, 0xC1, 0x04, 0x09, 0xC3, 0x0E, 0x16, 0x22, 0x25, 0x1D,
+        0x22, 0x16, 0x36, 0x51, 0x9D, 0x89, 0x9B, 0x98, 0x9C, 0x98, 0x56, 0xC0, 0x08, 0xA4, 0x88, 0x29,
+        0x09, 0x11, 0x1D, 0xC5, 0x6E, 0x7A, 0xC3, 0x11, 0x09, 0x3D, 0x09, 0x0C, 0x11, 0xC5, 0x0E, 0x09,
+        0x3D, 0x29, 0x9D, 0x98, 0x21, 0x51, 0xA3, 0x98, 0xA4, 0x88, 0x51, 0xA6, 0x88, 0x6E, 0x7F, 0x19,
+        0x14, 0x0F, 0x69, 0x0F, 0x0A, 0x0F, 0xC0, 0x14, 0xC0, 0x5A, 0x0C, 0x14, 0x0F, 0x14, 0x0F, 0xC0,
+        0x14, 0xC0, 0x11, 0xC0, 0x19, 0xC0, 0x0A, 0x14, 0x0F, 0x20, 0xC0, 0x14, 0x20, 0x16, 0xC0, 0x11,
+        0xC0, 0x20, 0xC1, 0x1B, 0x20, 0x14, 0xC0, 0x11, 0xC4, 0x16, 0x11, 0xC0, 0x16, 0x11, 0x16, 0x1D,
+        0xC1, 0x11, 0xC2, 0x16, 0xC0, 0x1D, 0xC0, 0x25, 0xC0, 0x6E, 0x25, 0x18, 0x20, 0x18, 0x07, 0x0C,
+        0x18, 0xC0, 0x1D, 0x20, 0x1D, 0xC5, 0x51, 0x3F, 0x04, 0x13, 0x11, 0x1D, 0x16, 0x18, 0x0C, 0x09,
+        0x16, 0x11, 0x09, 0xC1, 0x04, 0x5A, 0x04, 0x1D, 0x22, 0x1D, 0x16, 0x1D, 0x22, 0xC0, 0x16, 0x36,
+        0x06, 0x12, 0x9D, 0x99, 0x51, 0x39, 0x7E, 0x29, 0xA4, 0x79, 0xA4, 0x88, 0x11, 0x1D, 0xC5, 0x22,
+        0x7A, 0xC1, 0x6F, 0xC1, 0x16, 0x0E, 0x02, 0xC0, 0x0C, 0x11, 0xC6, 0x0E, 0x02, 0x56, 0x1A, 0x9D,
+        0x99, 0x26, 0xA2, 0x97, 0x6B, 0x7E, 0x28, 0x6E, 0xA2, 0x88, 0x14, 0xC0, 0x0A, 0xC2, 0x0F, 0x20,
+        0x14, 0xC4, 0x19, 0x1B, 0x20, 0x0F, 0x20, 0x19, 0xC1, 0x14, 0x0F, 0x20, 0x1B, 0x20, 0xC3, 0x16,
+        0x19, 0x20, 0xC0, 0x11, 0x20, 0xC1, 0x14, 0x11, 0xC5, 0x16, 0xC0, 0x11, 0xC1, 0x16, 0xC2, 0x11,
+        0xC3, 0x16, 0x1D, 0xC0, 0x22, 0x25, 0xC1, 0x1D, 0xC0, 0x20, 0x18, 0xC0, 0x22, 0xC1, 0x1D, 0xC1,
+        0x16, 0x1D, 0xC1, 0x18, 0x0C, 0xC1, 0x09, 0x11, 0x1D, 0x11, 0x09, 0x3C, 0x09, 0x11, 0x04, 0xC1,
+        0x09, 0xC0, 0x56, 0x09, 0x0E, 0x1D, 0xC0, 0x22, 0xC0, 0x16, 0xC0, 0x55, 0x9C, 0x88, 0x9A, 0x99,
+        0x9C, 0x98, 0x59, 0x51, 0xA5, 0x88, 0x35, 0xA2, 0x88, 0x2E, 0x0E, 0x1D, 0xC6, 0x25, 0xC0, 0x6B,
+        0x31, 0xC2, 0x11, 0xC0, 0x56, 0x02, 0x0C, 0x11, 0xC7, 0x09, 0x02, 0x2E, 0x65, 0x9D, 0x99, 0xA1,
+        0xA8, 0x9D, 0x88, 0x3D, 0xA3, 0xA9, 0x03, 0x6E, 0x0F, 0x0A, 0xC0, 0x66, 0xC0, 0x0A, 0x0F, 0x20,
+        0x19, 0x66, 0xC0, 0x19, 0xC0, 0x11, 0xC0, 0x1B, 0x20, 0x1B, 0x0F, 0x20, 0xC1, 0x14, 0x20, 0x1D,
+        0x25, 0x20, 0x1D, 0xC1, 0x16, 0xC0, 0x20, 0x11, 0xC1, 0x16, 0x11, 0xC0, 0x19, 0x11, 0xC6, 0x16,
+        0x11, 0xC1, 0x16, 0xC2, 0x11, 0xC3, 0x16, 0x1D, 0xC0, 0x6E, 0x25, 0xC1, 0x22, 0xC1, 0x18, 0x25,
+        0x1D, 0xC2, 0x16, 0x1D, 0x16, 0x1D, 0x16, 0x1D, 0xC0, 0x18, 0x1D, 0xC2, 0x11, 0x04, 0x3C, 0xC0,
+        0x04, 0x11, 0x04, 0xC1, 0x0E, 0xC0, 0x01, 0x7E, 0x1D, 0x59, 0x1D, 0xC0, 0x16, 0x02, 0x66, 0x1F,
+        0x61, 0x26, 0x9D, 0x98, 0xA3, 0x88, 0x06, 0x0E, 0x66, 0xA3, 0x89, 0xA3, 0x89, 0x16, 0x1D, 0xC5,
+        0x25, 0xC0, 0x6F, 0xC4, 0x11, 0xC1, 0x0C, 0xC0, 0x11, 0xC8, 0x5A, 0x02, 0x65, 0x79, 0x7B, 0x9B,
+        0x88, 0xA2, 0x89, 0x65, 0xA3, 0x99, 0x03, 0x67, 0xC2, 0x0A, 0x0F, 0xA2, 0x78, 0x1B, 0x19, 0xC0,
+        0x0F, 0x19, 0x66, 0xC0, 0x19, 0x20, 0x1B, 0x0F, 0xC0, 0x1B, 0x19, 0x14, 0xC0, 0x11, 0x16, 0x25,
+        0x20, 0x1D, 0x16, 0x1D, 0x16, 0xC1, 0x11, 0xCA, 0x0C, 0x11, 0xC0, 0x16, 0x11, 0xC1, 0x16, 0xC2,
+        0x11, 0xC3, 0x16, 0x1D, 0xC0, 0x22, 0xC0, 0x25, 0xC0, 0x22, 0xC0, 0x25, 0x1D, 0x22, 0xC0, 0x1D,
+        0xC0, 0x16, 0xC2, 0x1D, 0x16, 0xC0, 0x1D, 0xC3, 0x11, 0xC1, 0x09, 0x04, 0xC1, 0x09, 0x52, 0x04,
+        0x09, 0x04, 0x01, 0x09, 0xC1, 0x0E, 0x1D, 0x16, 0x02, 0x2E, 0x35, 0xA2, 0x77, 0xC0, 0x17, 0x3F,
+        0xC0, 0xA4, 0x88, 0x62, 0x02, 0x16, 0xC0, 0x6B, 0xC4, 0x22, 0x25, 0x2C, 0x31, 0xC4, 0x11, 0xC2,
+        0x0C, 0x11, 0xC9, 0x7D, 0xC0, 0x0D, 0x0A, 0x9F, 0x86, 0xA0, 0x9A, 0x37, 0x67, 0x3E, 0x05, 0xC1,
+        0x0A, 0x14, 0x0F, 0x20, 0xC0, 0x14, 0x19, 0x0A, 0x0F, 0x14, 0xC2, 0x0F, 0xC1, 0x20, 0x14, 0x11,
+        0xC1, 0x16, 0x20, 0xC0, 0x16, 0xC0, 0x1D, 0x16, 0xC1, 0x11, 0xCA, 0x0C, 0x11, 0xC0, 0x16, 0x11,
+        0xC1, 0x16, 0xC1, 0x11, 0xC5, 0x1D, 0xC0, 0x20, 0x18, 0x25, 0xC0, 0x22, 0xC0, 0x20, 0x25, 0x22,
+        0x1D, 0xC1, 0x16, 0xC2, 0x1D, 0x16, 0x1D, 0xC0, 0x16, 0xC0, 0x1D, 0xC1, 0x11, 0x16, 0x11, 0xC1,
+        0x18, 0x01, 0x3C, 0x01, 0x09, 0x01, 0xC0, 0x6E, 0x09, 0x0E, 0x09, 0x0E, 0x11, 0x36, 0x2E, 0x9A,
+        0x88, 0xA4, 0x77, 0x17, 0xA2, 0x88, 0x2E, 0x6D, 0x07, 0xC0, 0xA2, 0x88, 0x16, 0x1D, 0xC4, 0x22,
+        0x25, 0x31, 0xC6, 0x11, 0xC3, 0x0C, 0x11, 0xC9, 0x19, 0x14, 0x0A, 0xC0, 0x05, 0xC4, 0x0A, 0x0F,
+        0xC0, 0x14, 0x6B, 0x25, 0x20, 0x0F, 0x05, 0xC0, 0x0A, 0xC0, 0x0F, 0x14, 0xC1, 0x1B, 0x20, 0x11,
+        0xC2, 0x16, 0x1D, 0xC0, 0x16, 0xC0, 0x1D, 0xC0, 0x16, 0xC1, 0x11, 0xC9, 0x0C, 0x11, 0xC0, 0x16,
+        0x11, 0xC1, 0x16, 0xC1, 0x11, 0xC3, 0x16, 0xC0, 0x19, 0x1D, 0x20, 0x0C, 0x25, 0x22, 0xC1, 0x25,
+        0xC0, 0x22, 0x1D, 0xC1, 0x16, 0xC4, 0x1D, 0xC0, 0x16, 0xC3, 0x11, 0x16, 0x11, 0xC0, 0x09, 0x11,
+        0x09, 0x01, 0xC4, 0x06, 0x09, 0x0E, 0xC0, 0x09, 0x2E, 0x56, 0x1A, 0x40, 0x76, 0xA2, 0x78, 0x06,
+        0x07, 0x0E, 0x16, 0x22, 0x25, 0x22, 0xC0, 0x1D, 0xC1, 0x22, 0x25, 0x31, 0xC7, 0x11, 0xC1, 0x16,
+        0x11, 0xC8, 0x16, 0x19, 0xC1, 0x0F, 0x0A, 0x67, 0xC1, 0x05, 0xC1, 0x3E, 0x34, 0x3D, 0x11, 0x20,
+        0xC0, 0x14, 0x0F, 0x0A, 0x05, 0xC0, 0x0F, 0x1B, 0x19, 0x14, 0x19, 0x20, 0xC1, 0x11, 0xC0, 0x66,
+        0x11, 0xC0, 0x1D, 0xC0, 0x20, 0x16, 0xC4, 0x11, 0xCC, 0x16, 0x11, 0xC1, 0x16, 0xC2, 0x11, 0xC4,
+        0x0C, 0xC2, 0x25, 0xC0, 0x1D, 0x22, 0x25, 0xC0, 0x22, 0xC0, 0x1D, 0xC0, 0x16, 0xCA, 0x11, 0xC2,
+        0x16, 0x11, 0x16, 0x09, 0xC2, 0x01, 0xC1, 0x0E, 0x13, 0x16, 0x02, 0x55, 0x6F, 0x57, 0x26, 0x9D,
+        0x97, 0xA3, 0x89, 0xA3, 0x89, 0x06, 0x6E, 0x0E, 0x16, 0xC0, 0x22, 0x25, 0xC1, 0x22, 0x25, 0xC0,
+        0x31, 0xC8, 0x16, 0xC1, 0x1D, 0xC0, 0x11, 0xC6, 0x16, 0x7E, 0x19, 0x14, 0xC0, 0x0F, 0x0A, 0x67,
+        0xC2, 0x66, 0x05, 0x39, 0x59, 0x5E, 0x3D, 0x19, 0x20, 0xC2, 0x0F, 0x0A, 0x14, 0xC1, 0x11, 0x14,
+        0xC1, 0x20, 0x14, 0x11, 0x66, 0xC0, 0x11, 0x1D, 0x16, 0x20, 0xC0, 0x16, 0xC3, 0x11, 0xC3, 0x14,
+        0x11, 0xC2, 0x1B, 0x11, 0xC1, 0x16, 0x11, 0xC1, 0x16, 0xC0, 0x1D, 0xC0, 0x11, 0xC1, 0x0C, 0x66,
+        0x0C, 0x07, 0x66, 0x5A, 0xA2, 0x88, 0x11, 0x1D, 0xC1, 0x22, 0xC2, 0x1D, 0xC0, 0x16, 0xC8, 0x1D,
+        0x16, 0x11, 0xC3, 0x16, 0x22, 0x09, 0x0E, 0x09, 0xC0, 0x06, 0x01, 0x0E, 0xC1, 0x16, 0x51, 0x2E,
+        0x5B, 0xA0, 0x8A, 0x32, 0x26, 0xA2, 0x88, 0x0B, 0x67, 0x0B, 0x0E, 0xC0, 0x16, 0x25, 0xC0, 0x22,
+        0x1D, 0x22, 0x25, 0x6F, 0xC9, 0x1D, 0xC5, 0x11, 0xC4, 0x16, 0xC0, 0x19, 0x25, 0x19, 0x14, 0x0F,
+        0x05, 0xC2, 0x66, 0x05, 0x64, 0x41, 0x56, 0x24, 0x3D, 0x1D, 0xC0, 0x20, 0xC1, 0x0F, 0x14, 0x11,
+        0xC3, 0x0C, 0x11, 0x14, 0x11, 0x0C, 0xC0, 0x11, 0x16, 0xC0, 0x77, 0x20, 0x16, 0x1D, 0xC0, 0x16,
+        0xC0, 0x11, 0xC3, 0x67, 0x11, 0x0F, 0x14, 0x07, 0xC0, 0x11, 0xC3, 0x18, 0x11, 0x16, 0x1D, 0x18,
+        0x1B, 0x11, 0xC1, 0x07, 0x66, 0x55, 0x66, 0x6B, 0xC0, 0x3F, 0x11, 0x16, 0xC0, 0x1D, 0x22, 0xC1,
+        0x1D, 0xC1, 0x16, 0xC8, 0x1D, 0x11, 0xC0, 0x0C, 0xC1, 0x11, 0x16, 0xC0, 0x1D, 0x22, 0x0E, 0x01,
+        0x6B, 0xC0, 0x09, 0x0E, 0x16, 0x3D, 0x9B, 0x98, 0x41, 0xA4, 0x79, 0xC0, 0x69, 0xA3, 0x98, 0x6E,
+        0x0B, 0x0D, 0x0B, 0x0E, 0x6E, 0x16, 0x22, 0x25, 0x22, 0xC0, 0x25, 0x31, 0xCA, 0x1D, 0xC2, 0x22,
+        0xC0, 0x1D, 0xC1, 0x16, 0x19, 0x16, 0x19, 0x6E, 0x19, 0xC2, 0x14, 0x0A, 0xC2, 0x05, 0xC0, 0x69,
+        0x39, 0x9C, 0x77, 0x46, 0xA2, 0x88, 0x29, 0xA3, 0x89, 0x1D, 0x25, 0x20, 0x16, 0x14, 0xC0, 0x0C,
+        0xC2, 0x09, 0x0C, 0xC1, 0x11, 0x0C, 0xC0, 0x11, 0x16, 0xC0, 0x1B, 0x0F, 0x16, 0x1B, 0x20, 0x16,
+        0xC0, 0x11, 0xC1, 0x1B, 0x11, 0xC0, 0x62, 0xC4, 0x11, 0x0C, 0x18, 0xC0, 0x02, 0x11, 0x18, 0xC1,
+        0x07, 0x6F, 0x11, 0xC0, 0x1B, 0x07, 0x52, 0x2E, 0xC1, 0x3A, 0x07, 0x11, 0x1D, 0xC0, 0x22, 0xC1,
+        0x1D, 0xC1, 0x16, 0xCA, 0x11, 0xC3, 0x16, 0x1D, 0x25, 0x22, 0x0E, 0x06, 0xC1, 0x09, 0x1D, 0x11,
+        0x15, 0x21, 0xA3, 0x89, 0x56, 0x64, 0xA2, 0x88, 0x1F, 0x0B, 0x0E, 0x0B, 0xC0, 0x0E, 0x1D, 0x22,
+        0x25, 0xC0, 0x22, 0x25, 0x6B, 0x31, 0xCA, 0x1D, 0x22, 0xC1, 0x25, 0xC1, 0x22, 0x1D, 0xC0, 0x1E,
+        0x19, 0xC1, 0x14, 0x0F, 0x19, 0x0F, 0xC0, 0x14, 0x0A, 0xC0, 0x05, 0xC1, 0x3B, 0x2F, 0x7B, 0x9D,
+        0x88, 0x5A, 0x15, 0xA3, 0x89, 0x11, 0x1D, 0xC1, 0x19, 0x14, 0x0C, 0xC6, 0x11, 0xC2, 0x6E, 0x20,
+        0x14, 0x02, 0x1B, 0x0C, 0x20, 0x16, 0x20, 0x14, 0x11, 0xC0, 0x14, 0x11, 0x0C, 0x02, 0x66, 0xC0,
+        0x07, 0xC0, 0x3D, 0x02, 0xC0, 0x07, 0x52, 0x11, 0xC0, 0x18, 0x1B, 0x0C, 0x3F, 0x07, 0x0C, 0xC1,
+        0x07, 0x3A, 0x02, 0x55, 0x3A, 0x0C, 0x11, 0x0C, 0x11, 0x20, 0xC0, 0x1D, 0x22, 0x1D, 0xC0, 0x16,
+        0xC2, 0x11, 0x16, 0xC0, 0x11, 0x16, 0xC0, 0x1D, 0xC1, 0x11, 0xC0, 0x16, 0x11, 0xC0, 0x16, 0x1D,
+        0xC0, 0x22, 0xC0, 0x0E, 0x6B, 0x0E, 0xC1, 0x61, 0x99, 0x98, 0x21, 0x32, 0x9B, 0x99, 0xA2, 0x88,
+        0xA6, 0x77, 0xA2, 0x98, 0xA5, 0x78, 0x6B, 0x56, 0x13, 0x0E, 0x13, 0x25, 0xC2, 0x2C, 0x31, 0xCB,
+        0x55, 0xC1, 0x25, 0xC5, 0x65, 0x25, 0x19, 0xC0, 0x14, 0x0A, 0xC1, 0x0F, 0x0A, 0x03, 0xC0, 0x0A,
+        0x66, 0x00, 0x0A, 0x51, 0x50, 0x66, 0x35, 0x01, 0xA2, 0x88, 0x3D, 0x18, 0x1D, 0xC0, 0x69, 0x14,
+        0x56, 0xC6, 0x11, 0xC3, 0x0F, 0x02, 0x66, 0xC0, 0x07, 0x02, 0x07, 0x6F, 0x14, 0x11, 0x7B, 0xC0,
+        0x18, 0x13, 0x02, 0x62, 0x3D, 0x07, 0xC0, 0x0C, 0x3A, 0x62, 0xC0, 0x07, 0x11, 0x16, 0x18, 0x0C,
+        0x13, 0x02, 0xC0, 0x07, 0x11, 0x14, 0x07, 0x11, 0x0C, 0x02, 0x0C, 0x07, 0x11, 0x16, 0xC0, 0x1D,
+        0x20, 0x1D, 0xC1, 0x20, 0x16, 0xC2, 0x11, 0x16, 0xC0, 0x11, 0x16, 0xC1, 0x1D, 0x16, 0xC0, 0x11,
+        0xC0, 0x16, 0x11, 0xC0, 0x16, 0x1D, 0x22, 0x16, 0x0E, 0x22, 0x1D, 0x16, 0x51, 0x1A, 0x2B, 0x21,
+        0x9D, 0x99, 0x6E, 0xA5, 0x88, 0x1F, 0x7F, 0xA4, 0x78, 0x0E, 0x0B, 0x13, 0xC0, 0x7E, 0x22, 0xC0,
+        0x25, 0xC0, 0x31, 0xCC, 0x22, 0x25, 0x22, 0xC0, 0x25, 0xC0, 0x2C, 0x6D, 0x25, 0xC0, 0x14, 0x19,
+        0x14, 0xC0, 0x0F, 0x0A, 0x05, 0xC1, 0x0A, 0xC0, 0x0F, 0xC0, 0x05, 0xC0, 0x0F, 0x9D, 0x88, 0x9C,
+        0x88, 0x3C, 0x65, 0x3C, 0x10, 0x29, 0x09, 0x1D, 0xC1, 0x11, 0xC0, 0x0C, 0xC6, 0x11, 0xC0, 0x14,
+        0x11, 0x0F, 0x52, 0x38, 0x66, 0x38, 0x07, 0x20, 0xC0, 0x14, 0x6B, 0xC0, 0x18, 0x07, 0xC2, 0x6F,
+        0x02, 0xC1, 0x52, 0x66, 0xC0, 0x6D, 0x07, 0x11, 0xC0, 0x0C, 0x07, 0x52, 0x69, 0x0C, 0x11, 0x14,
+        0x11, 0xC0, 0x0C, 0x07, 0x11, 0xC0, 0x61, 0x16, 0xC0, 0x1D, 0x11, 0x22, 0x1D, 0xC0, 0x16, 0xC8,
+        0x1D, 0xC0, 0x16, 0x11, 0x16, 0xC0, 0x11, 0x16, 0xC3, 0x22, 0x0E, 0x1D, 0xC0, 0x16, 0x51, 0x1A,
+        0x21, 0x9D, 0x89, 0x66, 0xC0, 0x26, 0x1F, 0x0E, 0x6E, 0x67, 0x0B, 0x67, 0x0B, 0x13, 0x16, 0x22,
+        0xC0, 0x2A, 0xC0, 0x31, 0xC4, 0x2A, 0x31, 0xC5, 0x25, 0xC5, 0x2A, 0x19, 0xC0, 0x0F, 0x19, 0x14,
+        0xC0, 0x0F, 0x62, 0xC1, 0x0A, 0x14, 0x19, 0x20, 0x0F, 0xC1, 0x14, 0x0F, 0x24, 0x04, 0x41, 0xC0,
+        0x3C, 0x10, 0xA4, 0x78, 0x09, 0x1D, 0x22, 0x1D, 0x11, 0x0C, 0xC3, 0x11, 0xC2, 0x14, 0x0F, 0x0A,
+        0x38, 0xA2, 0x77, 0x3D, 0x38, 0x3D, 0x02, 0xA2, 0x88, 0x1B, 0x16, 0x11, 0x1B, 0x56, 0x02, 0x0C,
+        0x07, 0x0C, 0x11, 0x07, 0x02, 0x0C, 0x2E, 0xC2, 0x07, 0xC0, 0x11, 0x07, 0x02, 0x2E, 0x07, 0x11,
+        0x14, 0x0C, 0xC0, 0x11, 0x0C, 0x07, 0x11, 0x07, 0x11, 0x6E, 0xC0, 0x1D, 0x0C, 0x1D, 0x16, 0x1D,
+        0x11, 0x16, 0xC2, 0x11, 0x16, 0xC2, 0x1D, 0x16, 0xC0, 0x51, 0x09, 0x16, 0x11, 0x16, 0x1D, 0x22,
+        0xC0, 0x1D, 0xC0, 0x0E, 0x1D, 0x11, 0x02, 0x65, 0x01, 0x08, 0x51, 0x00, 0xA2, 0x88, 0xA4, 0x87,
+        0x1A, 0x02, 0x16, 0x5A, 0x0B, 0x0D, 0x0B, 0x13, 0xC1, 0x22, 0xC1, 0x2A, 0x31, 0xC3, 0x22, 0x31,
+        0xC5, 0x25, 0xC1, 0x2A, 0x25, 0xC1, 0x2A, 0x19, 0x0F, 0xC1, 0x19, 0x66, 0x0A, 0xC0, 0x05, 0xC1,
+        0x0F, 0x14, 0x0F, 0x14, 0x19, 0x0F, 0x11, 0x51, 0x29, 0x51, 0x01, 0x2D, 0xC0, 0x01, 0x1A, 0xA2,
+        0x99, 0x11, 0x22, 0x25, 0x1D, 0x11, 0xC0, 0x0C, 0xC1, 0x11, 0x14, 0x0F, 0x0C, 0x0F, 0x07, 0x66,
+        0x66, 0x0C, 0x02, 0x3D, 0x66, 0x3D, 0x02, 0x1B, 0x07, 0xC1, 0x02, 0x3D, 0x02, 0xC0, 0x0C, 0xC0,
+        0x02, 0x2E, 0x3A, 0x61, 0x33, 0xC0, 0x3A, 0x33, 0x07, 0x02, 0x33, 0x2E, 0xC0, 0x07, 0x11, 0xC1,
+        0x0C, 0x02, 0x07, 0xC1, 0x02, 0x11, 0xC0, 0x16, 0xC0, 0x9D, 0xA9, 0x11, 0x20, 0xC0, 0x0C, 0x19,
+        0x16, 0xC1, 0x11, 0xC0, 0x16, 0xC3, 0x09, 0x66, 0x09, 0xC2, 0x0E, 0x16, 0xC0, 0x1D, 0x0E, 0xC0,
+        0x16, 0xC0, 0x55, 0x1A, 0x99, 0x99, 0x9D, 0x98, 0x34, 0x08, 0x2D, 0x10, 0xA3, 0x88, 0x0E, 0x16,
+        0x13, 0x0B, 0xC0, 0x0E, 0x13, 0xC1, 0x22, 0xC0, 0x2A, 0x31, 0xC4, 0x54, 0x2A, 0x31, 0xC1, 0x2A,
+        0x31, 0xC2, 0x2A, 0x25, 0xC0, 0x65, 0x14, 0xC0, 0x0F, 0x0A, 0xC0, 0x03, 0x0F, 0xC0, 0x05, 0x0A,
+        0x05, 0xC1, 0x0A, 0x0F, 0x6F, 0x11, 0xC0, 0x14, 0x11, 0x09, 0x65, 0x29, 0x15, 0x3C, 0x2D, 0x6F,
+        0xA2, 0x87, 0x24, 0x3D, 0x1D, 0x25, 0x22, 0x1D, 0x11, 0x0C, 0xC1, 0x69, 0x0C, 0x11, 0x0F, 0x02,
+        0x38, 0x66, 0x38, 0x6D, 0xA2, 0x78, 0x02, 0x9D, 0xA9, 0x30, 0x38, 0x02, 0x52, 0x7E, 0x0C, 0x3A,
+        0x3D, 0x35, 0x3A, 0x02, 0x07, 0xC0, 0x9C, 0x99, 0xC1, 0x2E, 0x35, 0x02, 0x55, 0x3D, 0x3F, 0x30,
+        0xC0, 0x33, 0x0C, 0xC0, 0x11, 0xC2, 0x3B, 0x35, 0xC0, 0xA2, 0x76, 0x00, 0x05, 0x11, 0x0C, 0x38,
+        0x11, 0x0C, 0x11, 0x00, 0x11, 0x05, 0x19, 0x16, 0x11, 0x16, 0xC0, 0x19, 0x16, 0x11, 0x55, 0x09,
+        0xC3, 0x5A, 0xC1, 0x09, 0x06, 0xC0, 0x0E, 0x13, 0x0E, 0x50, 0x99, 0xA9, 0x9B, 0x89, 0x51, 0x05,
+        0xA3, 0x99, 0xA4, 0x77, 0xA3, 0x99, 0xA2, 0x88, 0x11, 0xA2, 0x77, 0x13, 0xC0, 0x0B, 0x13, 0xC0,
+        0x6E, 0x67, 0x22, 0xC0, 0x7F, 0xC1, 0x2A, 0x1B, 0x2A, 0xC0, 0x13, 0x2A, 0x31, 0x2A, 0x1B, 0x2A,
+        0x31, 0x25, 0x31, 0xC1, 0x25, 0x31, 0x25, 0x19, 0xC0, 0x0F, 0x0A, 0xC4, 0x0F, 0x62, 0xC2, 0x19,
+        0x11, 0xC1, 0x14, 0x19, 0x11, 0x09, 0x3D, 0x24, 0x10, 0x39, 0x2D, 0x3C, 0x15, 0x29, 0x09, 0x22,
+        0x25, 0x22, 0x1D, 0x11, 0xC0, 0x0C, 0x11, 0xC0, 0x09, 0x11, 0x0F, 0x9D, 0x9A, 0x62, 0x6E, 0x69,
+        0x3D, 0xC0, 0x33, 0x30, 0xC0, 0x33, 0x38, 0x3D, 0xC0, 0x6E, 0xC0, 0x3D, 0x02, 0x3A, 0x2E, 0x66,
+        0x30, 0xC2, 0x29, 0xA2, 0x77, 0x11, 0x0C, 0x3A, 0x2E, 0x29, 0x33, 0x0C, 0x11, 0xC3, 0x07, 0x9D,
+        0x9A, 0xC0, 0x33, 0x11, 0xC0, 0x00, 0x56, 0x33, 0x0C, 0x00, 0xC0, 0x3F, 0x38, 0xA2, 0x87, 0x11,
+        0x16, 0x19, 0xC0, 0x16, 0x11, 0x16, 0xC0, 0x51, 0x09, 0xC2, 0x5A, 0x0D, 0x06, 0x0E, 0x06, 0x0D,
+        0xC1, 0x0B, 0x69, 0x15, 0x9A, 0x88, 0x9D, 0x98, 0x6B, 0xA4, 0x77, 0x01, 0x24, 0xA3, 0x88, 0x11,
+        0x16, 0x22, 0x13, 0x0E, 0x0B, 0x13, 0xC1, 0x1A, 0x13, 0x22, 0xC0, 0x7B, 0x6E, 0x25, 0x1B, 0x13,
+        0x1B, 0x13, 0x1B, 0xC0, 0x69, 0x1B, 0x31, 0xC0, 0x25, 0x31, 0xC0, 0x25, 0xC0, 0x31, 0x25, 0x61,
+        0x0F, 0x0A, 0xC0, 0x66, 0x0A, 0xC0, 0x05, 0x0A, 0xC2, 0x05, 0x0F, 0xC0, 0x20, 0x16, 0x11, 0xC3,
+        0x02, 0x52, 0x51, 0x01, 0x56, 0x2D, 0x01, 0x21, 0x35, 0x11, 0x1D, 0x25, 0xC1, 0x1D, 0x11, 0xC2,
+        0x14, 0x9D, 0x9A, 0x66, 0x66, 0x3D, 0x02, 0xC0, 0x38, 0x30, 0x29, 0x30, 0xC3, 0x02, 0x33, 0x02,
+        0xC1, 0x52, 0x30, 0xC4, 0x2E, 0x07, 0x0C, 0x33, 0xC2, 0x6E, 0x0C, 0x11, 0x61, 0x11, 0xC1, 0x33,
+        0x38, 0x00, 0x38, 0x0C, 0x3B, 0x33, 0x3A, 0x38, 0xC1, 0x3F, 0xC0, 0x00, 0x6E, 0xC0, 0x16, 0xC0,
+        0x7E, 0x16, 0xC1, 0x65, 0x09, 0xC1, 0x6B, 0xC0, 0x09, 0x13, 0x16, 0x13, 0x0B, 0x9F, 0x9B, 0xC0,
+        0x0D, 0x0B, 0x9D, 0x98, 0x99, 0x98, 0x9C, 0x99, 0x19, 0x3C, 0xA4, 0x77, 0x38, 0xA2, 0x77, 0x11,
+        0x16, 0x22, 0x13, 0x0B, 0xC1, 0x13, 0x22, 0x13, 0xC0, 0x22, 0x6E, 0x22, 0xC1, 0x1B, 0x13, 0x0B,
+        0x13, 0xC1, 0x1B, 0x31, 0xC0, 0x25, 0xC0, 0x31, 0x25, 0xC2, 0x65, 0x66, 0x0F, 0x66, 0xC0, 0x66,
+        0x0A, 0x05, 0xC1, 0x0A, 0x0F, 0x0A, 0xC0, 0x14, 0x25, 0xC0, 0x16, 0x11, 0xC4, 0x02, 0x38, 0x15,
+        0x01, 0x3C, 0xC0, 0xA2, 0x88, 0xA3, 0x88, 0xA2, 0x88, 0x11, 0x1D, 0x31, 0xC0, 0x25, 0x16, 0x14,
+        0xC1, 0x11, 0x9D, 0xAA, 0x66, 0x66, 0x69, 0x38, 0x31, 0x30, 0x31, 0x56, 0xC0, 0x30, 0xC2, 0x3D,
+        0x02, 0x14, 0x0C, 0xC0, 0x02, 0x29, 0x30, 0xC2, 0x29, 0x33, 0xC2, 0x6E, 0x3B, 0xC0, 0x38, 0x00,
+        0xC0, 0x0C, 0x6D, 0x11, 0x0C, 0x00, 0xC0, 0x6E, 0x00, 0x38, 0xC0, 0x3A, 0xC0, 0x3B, 0x00, 0xC0,
+        0x02, 0x00, 0x05, 0x0A, 0x05, 0x11, 0x0A, 0xC1, 0x11, 0x1B, 0x16, 0x0E, 0xC0, 0x67, 0xC0, 0x6E,
+        0x0E, 0x16, 0x59, 0x13, 0x0E, 0x5B, 0x0D, 0x0B, 0x60, 0x9C, 0x88, 0x26, 0x56, 0xA2, 0x98, 0xA3,
+        0x89, 0xA3, 0x88, 0xA2, 0x88, 0x11, 0x1B, 0x57, 0x13, 0x0E, 0x5A, 0xC1, 0x13, 0x1A, 0x0B, 0x6E,
+        0x7F, 0x22, 0xC1, 0x1B, 0x13, 0x0B, 0x12, 0xC0, 0x6E, 0x13, 0x1B, 0x2A, 0xC1, 0x25, 0xC0, 0x19,
+        0xC1, 0x25, 0x19, 0x0F, 0x66, 0xC0, 0x66, 0xC0, 0x0A, 0x05, 0xC3, 0x0A, 0x20, 0x14, 0x2C, 0x25,
+        0x22, 0x1D, 0x11, 0xC4, 0x0F, 0x2E, 0x15, 0x01, 0x3C, 0x7E, 0xA3, 0x99, 0x5E, 0x09, 0x11, 0x25,
+        0x6F, 0x25, 0xC0, 0x62, 0x14, 0xC0, 0x0F, 0x3D, 0x66, 0xC0, 0x30, 0xC2, 0x6D, 0x7A, 0x2E, 0x30,
+        0xC1, 0x6E, 0x2E, 0x07, 0x11, 0xC0, 0x66, 0x07, 0x66, 0x30, 0x35, 0x65, 0x2E, 0xC0, 0xA2, 0x77,
+        0x07, 0xC0, 0x00, 0xC0, 0x38, 0x66, 0x07, 0x33, 0xC0, 0xA3, 0x87, 0x11, 0xC0, 0x05, 0x11, 0xC3,
+        0x00, 0x3F, 0xC0, 0x00, 0xC3, 0x07, 0x05, 0xC0, 0x0C, 0xC0, 0x6D, 0xA2, 0x88, 0xC0, 0x16, 0x0E,
+        0xC2, 0x6B, 0x0E, 0x13, 0x7E, 0xC0, 0x16, 0x13, 0x0B, 0xC1, 0x50, 0x99, 0xA8, 0x9D, 0x9A, 0x2D,
+        0xA3, 0x99, 0xA3, 0x88, 0xA2, 0x88, 0x0C, 0x16, 0x22, 0xC2, 0x1A, 0x0B, 0x6E, 0x1F, 0x22, 0x18,
+        0xC0, 0x2A, 0x6B, 0x22, 0xC1, 0x13, 0x0B, 0x12, 0x6B, 0xC0, 0x13, 0x6D, 0x1B, 0xC0, 0x2A, 0x25,
+        0xC0, 0x20, 0x14, 0x6E, 0x14, 0xC0, 0x0F, 0x69, 0x67, 0xC3, 0x0F, 0x0A, 0x66, 0x0A, 0x0F, 0x14,
+        0xC0, 0x25, 0x31, 0x25, 0x22, 0x1D, 0x16, 0x66, 0xC1, 0x7B, 0x0F, 0x0C, 0x29, 0x51, 0x01, 0x7B,
+        0xA2, 0x98, 0x15, 0xA3, 0x89, 0x09, 0x20, 0x25, 0x20, 0x1B, 0x07, 0x0F, 0x07, 0x62, 0x66, 0xC0,
+        0x66, 0x5A, 0xC0, 0x33, 0xC0, 0x2E, 0xC0, 0x30, 0xC1, 0x3D, 0x07, 0x0C, 0x07, 0x0C, 0x11, 0xC1,
+        0x02, 0x3A, 0x69, 0xC0, 0x3B, 0x07, 0x11, 0xC0, 0x0C, 0x00, 0x0C, 0xC0, 0x33, 0xC0, 0x67, 0x3A,
+        0x6D, 0x0C, 0x11, 0x16, 0x11, 0x14, 0x0C, 0xC0, 0x00, 0xC0, 0x3B, 0x00, 0x6E, 0x6E, 0xC0, 0x05,
+        0x07, 0xC0, 0x6B, 0x0C, 0xC1, 0x0A, 0x16, 0x69, 0xC1, 0x16, 0xC0, 0x56, 0x13, 0x0E, 0x6D, 0x7F,
+        0x16, 0xC0, 0x0E, 0x65, 0x5E, 0x9C, 0x98, 0x6F, 0x69, 0x32, 0xA2, 0x99, 0x29, 0xA2, 0x88, 0x02,
+        0x11, 0x16, 0xC0, 0x1D, 0x25, 0x5A, 0xC0, 0x5A, 0x1A, 0x22, 0x13, 0xC1, 0x22, 0x2A, 0x22, 0xC1,
+        0x13, 0xC0, 0x12, 0xC0, 0x6D, 0x13, 0x18, 0x2A, 0x31, 0xC0, 0x25, 0xC1, 0x19, 0xC0, 0x20, 0x25,
+        0x19, 0x14, 0x62, 0xC1, 0x6E, 0x0A, 0xC0, 0x0F, 0x0A, 0xC0, 0x20, 0x2C, 0x25, 0xC0, 0x31, 0xC1,
+        0x22, 0x1D, 0xC0, 0x20, 0x16, 0x77, 0x0F, 0x14, 0x00, 0x3B, 0x9D, 0x88, 0x7B, 0x55, 0x5A, 0x29,
+        0x07, 0x14, 0x20, 0x1B, 0x66, 0x07, 0x0A, 0x56, 0x62, 0x66, 0xC2, 0x38, 0x65, 0x5A, 0xC0, 0x38,
+        0x30, 0x29, 0x2E, 0x07, 0x6E, 0x11, 0xC0, 0x0C, 0x11, 0x0C, 0x11, 0x07, 0x02, 0x0C, 0x11, 0x0C,
+        0x11, 0x6E, 0x11, 0x14, 0xC0, 0x00, 0x56, 0x66, 0x35, 0xC1, 0x38, 0x05, 0x6E, 0x16, 0xC1, 0x11,
+        0x00, 0xC0, 0x0C, 0x00, 0x11, 0x1E, 0x16, 0x1E, 0x05, 0x0C, 0xC1, 0x11, 0x0A, 0xC0, 0x6E, 0x1E,
+        0x69, 0x1E, 0x5A, 0xC0, 0x16, 0x1B, 0xC1, 0x0F, 0x16, 0x1B, 0xC0, 0x55, 0x9B, 0x99, 0xA2, 0x87,
+        0x9B, 0x9A, 0xA2, 0x78, 0x24, 0x1F, 0x7B, 0x38, 0xA2, 0x77, 0x11, 0xC1, 0x1D, 0xC0, 0x25, 0xC0,
+        0x31, 0x45, 0xC1, 0x55, 0xC1, 0x1A, 0x7E, 0xC1, 0x2A, 0x41, 0x10, 0x66, 0x13, 0xC0, 0x1B, 0x13,
+        0x22, 0x31, 0xC1, 0x2A, 0x25, 0x19, 0x25, 0xC0, 0x2A, 0x20, 0x14, 0x66, 0x03, 0x67, 0x6E, 0xC0,
+        0x20, 0x25, 0x14, 0x20, 0x66, 0x31, 0xC5, 0x25, 0x1D, 0x20, 0x1B, 0x14, 0x0A, 0x0F, 0x14, 0x0F,
+        0x3B, 0x36, 0x18, 0x27, 0x59, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x66, 0x66, 0xC0, 0x66, 0xC3, 0x55,
+        0x36, 0x66, 0x38, 0x35, 0x2E, 0xC1, 0x02, 0xA2, 0x77, 0x11, 0x0C, 0xC2, 0x11, 0xC7, 0x0C, 0xC0,
+        0x51, 0x33, 0x35, 0xC0, 0x3A, 0xC0, 0x38, 0xC0, 0xA2, 0x87, 0x16, 0x11, 0x16, 0xC0, 0x11, 0xC1,
+        0x05, 0x19, 0xC0, 0x16, 0x65, 0xC2, 0x11, 0xC0, 0x7D, 0x5A, 0x7E, 0x0F, 0x1E, 0xC0, 0x59, 0xC0,
+        0x6B, 0xC1, 0x1E, 0x1B, 0xC0, 0x14, 0x51, 0x9D, 0x99, 0x15, 0x2C, 0x9C, 0x89, 0xA5, 0x78, 0x9C,
+        0xA9, 0x7E, 0xA2, 0x89, 0x6E, 0x11, 0xC2, 0x6F, 0x25, 0xC1, 0x6F, 0x1F, 0x7A, 0xC0, 0x41, 0xC1,
+        0x10, 0x1F, 0xC0, 0x66, 0x22, 0x10, 0xC0, 0x13, 0x1B, 0x13, 0x1B, 0xC1, 0x6E, 0x2A, 0x31, 0xC0,
+        0x25, 0xC1, 0x66, 0x25, 0x61, 0x66, 0xC0, 0x66, 0x66, 0x03, 0x0A, 0x20, 0x25, 0xC0, 0x31, 0x20,
+        0x25, 0x31, 0xC4, 0x25, 0xC0, 0x20, 0x0F, 0x05, 0xC1, 0x0F, 0x0A, 0x05, 0x66, 0x36, 0xC0, 0x55,
+        0xA2, 0x89, 0xC0, 0x6D, 0x07, 0x0F, 0x07, 0x02, 0x0C, 0x9D, 0xAA, 0xC1, 0x07, 0x02, 0x2E, 0x02,
+        0x3A, 0x02, 0xC1, 0x07, 0x02, 0x11, 0xC2, 0x0C, 0xC1, 0x11, 0x0C, 0x11, 0x0C, 0x6D, 0x11, 0xC4,
+        0x0C, 0x33, 0x67, 0xC0, 0x33, 0x38, 0x00, 0x11, 0xC0, 0x12, 0x0A, 0x11, 0xC0, 0x19, 0xC1, 0x0A,
+        0x19, 0xC0, 0x0A, 0x6E, 0xC0, 0x0A, 0xC0, 0x11, 0xC0, 0x0F, 0x17, 0xC2, 0x1E, 0x59, 0xC0, 0x1E,
+        0x1B, 0xC0, 0x16, 0x0F, 0xC0, 0x6D, 0x56, 0x2C, 0x9D, 0x9A, 0xA4, 0x77, 0xC0, 0x0B, 0x60, 0xA2,
+        0x88, 0x0F, 0x11, 0xC1, 0x16, 0x1D, 0x25, 0x22, 0xC0, 0x6E, 0x22, 0x13, 0x10, 0x67, 0x59, 0x6B,
+        0xC1, 0x0B, 0xC0, 0x10, 0xC0, 0x13, 0x10, 0x7E, 0xC0, 0x1B, 0x18, 0xC0, 0x1B, 0xC0, 0x31, 0xC0,
+        0x2A, 0x25, 0x31, 0x25, 0x20, 0x19, 0x9D, 0xAA, 0xC1, 0x66, 0x0A, 0xC0, 0xA2, 0x78, 0xC0, 0x20,
+        0x2A, 0x31, 0xC0, 0x25, 0x31, 0xC3, 0x20, 0x1B, 0x0A, 0xC0, 0x05, 0x66, 0xC0, 0x05, 0xA2, 0x77,
+        0x05, 0x3D, 0xC0, 0x36, 0xC0, 0x00, 0x3D, 0x3E, 0x3B, 0x6F, 0x02, 0x07, 0xC1, 0x3D, 0x02, 0x36,
+        0x3D, 0xC1, 0x66, 0x02, 0x0C, 0x6F, 0x07, 0x1B, 0x07, 0x11, 0xC0, 0x0C, 0xC7, 0x69, 0x11, 0xC5,
+        0x9D, 0x99, 0x66, 0xC0, 0xA2, 0x77, 0x7A, 0x0C, 0x11, 0x16, 0x11, 0x69, 0x16, 0xC0, 0x11, 0x19,
+        0xC0, 0x17, 0x1E, 0x19, 0x1E, 0xC1, 0x65, 0xC0, 0x5A, 0x16, 0x12, 0x1E, 0xC0, 0x17, 0x6E, 0x1E,
+        0x5A, 0x7E, 0x16, 0xC2, 0x51, 0xC0, 0x65, 0x2C, 0xA2, 0x78, 0x13, 0x10, 0x67, 0xC0, 0x10, 0x16,
+        0xC1, 0x11, 0xC0, 0x16, 0x1D, 0x25, 0x2A, 0x13, 0xC2, 0x0B, 0x08, 0x0B, 0x08, 0xC0, 0x0B, 0x10,
+        0x08, 0xC0, 0x10, 0x13, 0x10, 0xC0, 0x13, 0x6E, 0x13, 0xC0, 0x1B, 0x27, 0x31, 0xC0, 0x25, 0x19,
+        0x25, 0xC0, 0x61, 0x66, 0x66, 0xC0, 0x66, 0xC0, 0x0A, 0x0F, 0x20, 0xC0, 0x14, 0x20, 0x2A, 0x31,
+        0xC7, 0x25, 0x62, 0x05, 0x66, 0xC3, 0x05, 0x5A, 0x66, 0x66, 0xC1, 0x6D, 0xC0, 0x3B, 0x3D, 0xC0,
+        0x02, 0x61, 0x3D, 0xC0, 0x02, 0x07, 0x3D, 0x30, 0xC0, 0x36, 0x07, 0xA2, 0x78, 0x0C, 0x11, 0xC2,
+        0x0C, 0xC7, 0x69, 0x0C, 0x11, 0xC3, 0x0C, 0xC0, 0x65, 0x07, 0x05, 0x11, 0xC4, 0x19, 0x11, 0xC0,
+        0x16, 0xC1, 0x1E, 0xC3, 0x65, 0x17, 0xC2, 0x1E, 0x17, 0xC0, 0x23, 0x1C, 0x23, 0xC0, 0x56, 0xC0,
+        0x16, 0x1B, 0x61, 0x55, 0x66, 0x15, 0xA3, 0x87, 0xA4, 0x77, 0x13, 0x57, 0xC0, 0x10, 0x13, 0x1B,
+        0xC0, 0x16, 0xC0, 0x22, 0x25, 0x2A, 0x5A, 0x22, 0x27, 0x52, 0x46, 0xC0, 0x66, 0x08, 0x0B, 0xC2,
+        0x0F, 0xC0, 0x10, 0xC0, 0x0F, 0xC0, 0x10, 0x13, 0xC0, 0x6E, 0x22, 0xC0, 0x27, 0x2A, 0x25, 0xC0,
+        0x14, 0x66, 0x66, 0xC3, 0x66, 0xC0, 0x0A, 0x0F, 0x20, 0x6F, 0x6E, 0xC8, 0x25, 0x62, 0x0A, 0x05,
+        0x66, 0xC1, 0x05, 0xC1, 0x02, 0x3D, 0x38, 0xC1, 0x69, 0xC0, 0x3D, 0x38, 0xC0, 0x3D, 0xC0, 0x02,
+        0x07, 0xC0, 0x0C, 0x02, 0x30, 0xC0, 0x33, 0x0C, 0x14, 0x11, 0xC4, 0x0C, 0xC7, 0x59, 0x0C, 0x11,
+        0xC3, 0x16, 0x65, 0xC0, 0x16, 0x11, 0xC0, 0x16, 0x11, 0x0C, 0x11, 0xC0, 0x0C, 0x11, 0xC1, 0x1E,
+        0xC0, 0x16, 0x19, 0x1E, 0x17, 0xC0, 0x1C, 0x17, 0x1E, 0x17, 0xC1, 0x23, 0x1E, 0x1C, 0x17, 0x23,
+        0x11, 0xC0, 0x0E, 0x69, 0x7E, 0x55, 0x6E, 0x65, 0xC0, 0xA1, 0x8A, 0x6E, 0x10, 0xC0, 0x13, 0xC1,
+        0x10, 0xA1, 0xA8, 0xC0, 0x2A, 0x27, 0x22, 0xC2, 0x13, 0x10, 0x57, 0xC0, 0x08, 0x10, 0x1A, 0x1F,
+        0x13, 0x0B, 0x08, 0x0B, 0x10, 0x08, 0x0F, 0x10, 0x18, 0x22, 0xC1, 0x7F, 0xC1, 0x25, 0x2A, 0x25,
+        0x14, 0x62, 0x66, 0x0A, 0xC2, 0x05, 0xA2, 0x77, 0x20, 0x31, 0xCB, 0x25, 0xC0, 0x20, 0x05, 0x66,
+        0xC0, 0x05, 0xC0, 0x0A, 0x3D, 0xC1, 0x38, 0x3D, 0x65, 0x69, 0x31, 0xC0, 0x3D, 0x6E, 0xC0, 0xA2,
+        0x77, 0xC3, 0x3D, 0x3F, 0x7E, 0x02, 0x07, 0xA2, 0x77, 0xC4, 0x0C, 0xC6, 0x59, 0xC0, 0x0C, 0x11,
+        0xC1, 0x16, 0x11, 0xC0, 0x16, 0x65, 0x11, 0x0A, 0x16, 0x69, 0x11, 0xC5, 0x16, 0x19, 0x11, 0xC0,
+        0x16, 0x17, 0xC0, 0x1C, 0xC0, 0x17, 0xC0, 0x1C, 0x17, 0xC0, 0x1C, 0xC0, 0x17, 0x0A, 0x1B, 0x16,
+        0x09, 0x65, 0x36, 0x56, 0xA3, 0x87, 0x0D, 0x5B, 0x69, 0x11, 0x66, 0x13, 0x18, 0x10, 0x1B, 0xC0,
+        0x13, 0x18, 0x13, 0x22, 0xC0, 0x13, 0xC0, 0x1F, 0x13, 0x18, 0x1F, 0x42, 0x10, 0x1F, 0x56, 0x10,
+        0xC0, 0x18, 0x10, 0x13, 0xC0, 0x10, 0xC2, 0x18, 0x13, 0x22, 0x7E, 0xC0, 0x6B, 0xC0, 0x1E, 0x19,
+        0x14, 0x19, 0x62, 0x66, 0xC1, 0x0F, 0xC1, 0x6F, 0x25, 0xC0, 0x31, 0xCC, 0x1B, 0x05, 0xC2, 0x0F,
+        0x1B, 0x9D, 0x99, 0xC0, 0x66, 0x02, 0xC0, 0x65, 0x9D, 0x88, 0x66, 0x13, 0x36, 0x07, 0x6E, 0x6E,
+        0x20, 0x25, 0x20, 0x07, 0xC0, 0x0C, 0x11, 0x16, 0x11, 0xC5, 0x0C, 0xC6, 0x59, 0xC0, 0x0C, 0x11,
+        0xC5, 0x69, 0x0C, 0x11, 0xC0, 0x6D, 0x11, 0xC5, 0x16, 0x11, 0xC2, 0x16, 0x11, 0x19, 0x6D, 0xC2,
+        0x1E, 0x25, 0x1C, 0xC0, 0x0F, 0x0A, 0x11, 0x16, 0x02, 0x65, 0x3B, 0x56, 0x7D, 0x0D, 0x6B, 0xC0,
+        0x57, 0x10, 0x13, 0xC0, 0x10, 0x18, 0x13, 0x10, 0xC4, 0x0B, 0x10, 0x1A, 0x22, 0x1A, 0xC0, 0x22,
+        0x1F, 0x22, 0xC2, 0x13, 0x22, 0x2A, 0x13, 0x10, 0xC0, 0x0B, 0x13, 0xC0, 0x27, 0x65, 0x2A, 0x31,
+        0xC0, 0x1E, 0x61, 0xC0, 0x67, 0xC1, 0x66, 0x0F, 0xC0, 0x6E, 0xC1, 0x31, 0xCD, 0x2C, 0x20, 0x0F,
+        0x05, 0x0F, 0x0A, 0xC2, 0x0F, 0x52, 0xC0, 0x0C, 0x61, 0x50, 0x9C, 0x89, 0x28, 0xA5, 0xA9, 0xA2,
+        0x77, 0xA2, 0x78, 0xA2, 0x99, 0x25, 0x31, 0x61, 0x07, 0x11, 0xD1, 0x0C, 0xC1, 0x11, 0xC6, 0x0C,
+        0x11, 0xD2, 0x17, 0x1C, 0x23, 0x2A, 0x1C, 0xC2, 0x65, 0x56, 0x36, 0x52, 0x6D, 0x6E, 0x39, 0xA2,
+        0x88, 0xC0, 0x5B, 0x13, 0x5A, 0xC8, 0x57, 0x69, 0x0F, 0x08, 0xA2, 0xA8, 0xC0, 0x10, 0x22, 0x31,
+        0x22, 0x31, 0xC2, 0x18, 0x22, 0x6E, 0x18, 0x10, 0x08, 0x0F, 0x10, 0xC1, 0x79, 0x7F, 0x25, 0x31,
+        0x25, 0x9D, 0xA8, 0x19, 0x0A, 0xC1, 0x05, 0xA2, 0x77, 0x14, 0xC2, 0x31, 0xCF, 0x14, 0x05, 0xA2,
+        0x78, 0x0F, 0xC0, 0x0A, 0xA2, 0x78, 0xC0, 0x07, 0x14, 0x0F, 0x3B, 0x40, 0x9D, 0x99, 0x9C, 0x78,
+        0xA2, 0xA8, 0xA3, 0x89, 0xA2, 0x78, 0xA4, 0x88, 0x25, 0x31, 0x20, 0x1B, 0x59, 0xC2, 0x6E, 0x11,
+        0xC4, 0x0C, 0x11, 0xC5, 0x0C, 0xC0, 0x11, 0xDB, 0x16, 0x1C, 0x23, 0x1C, 0xC1, 0x17, 0x56, 0xC0,
+        0x69, 0xC0, 0x0D, 0x00, 0x9D, 0x99, 0x08, 0x0D, 0x65, 0x0D, 0x5B, 0xC0, 0x67, 0x5B, 0xC0, 0x6B,
+        0x17, 0x10, 0xC3, 0x56, 0x6B, 0xC0, 0x08, 0x10, 0xC0, 0x0B, 0xA3, 0x98, 0x31, 0xC4, 0x22, 0x13,
+        0x10, 0x0B, 0x08, 0x0F, 0xC1, 0x6D, 0x10, 0x18, 0x2A, 0x31, 0xC0, 0x25, 0x9D, 0xA9, 0xA2, 0x77,
+        0x0A, 0x05, 0xC1, 0x0A, 0x0F, 0x14, 0x1B, 0x20, 0x31, 0xC7, 0x66, 0x31, 0xC4, 0x25, 0x1B, 0x05,
+        0x0C, 0x0F, 0xC0, 0x20, 0xC3, 0x14, 0x55, 0x9D, 0x99, 0x9D, 0x88, 0x9B, 0x99, 0x55, 0x33, 0x09,
+        0x29, 0xA4, 0x88, 0x25, 0xC0, 0x6B, 0x55, 0x11, 0xC1, 0x16, 0x11, 0xEB, 0x7D, 0x6E, 0x19, 0xA2,
+        0x76, 0x17, 0x1C, 0x17, 0x9D, 0x8A, 0x3D, 0x66, 0x29, 0x69, 0xA2, 0x87, 0xA4, 0x77, 0x6B, 0xC4,
+        0x5A, 0x10, 0x6B, 0x1E, 0x10, 0xC2, 0x69, 0x10, 0xC0, 0x08, 0x6B, 0x08, 0x1A, 0x13, 0x10, 0x1F,
+        0x7A, 0x31, 0xC3, 0x27, 0xC0, 0x1A, 0x10, 0x0F, 0x6B, 0xC0, 0x0F, 0x10, 0xC0, 0x27, 0xC0, 0x2A,
+        0x31, 0x9D, 0xA8, 0x03, 0xC1, 0x0A, 0x67, 0x69, 0xC0, 0x0A, 0x6E, 0x20, 0x25, 0x31, 0xC4, 0x2C,
+        0x20, 0x25, 0xC0, 0x2C, 0xC0, 0x25, 0xC0, 0x31, 0x20, 0x0F, 0x20, 0x05, 0x0F, 0x5A, 0x1B, 0x25,
+        0x20, 0x25, 0xC1, 0x20, 0x0C, 0x3D, 0x24, 0x3C, 0x9C, 0x87, 0xC0, 0x2D, 0xA3, 0x99, 0x38, 0xA3,
+        0x88, 0x2C, 0x31, 0xC0, 0x1D, 0x11, 0xC0, 0x6E, 0xC3, 0x11, 0xCB, 0x16, 0xC0, 0x11, 0xDA, 0xA2,
+        0x87, 0x1C, 0x16, 0x65, 0x6E, 0x02, 0x3D, 0x29, 0x15, 0x65, 0xA2, 0x77, 0x01, 0xA1, 0x8A, 0x6B,
+        0x14, 0xC3, 0x57, 0x5A, 0x17, 0x10, 0x1B, 0x22, 0x18, 0xC0, 0x22, 0x13, 0x10, 0xC4, 0x22, 0xC0,
+        0x31, 0xC3, 0x27, 0x1F, 0x17, 0x56, 0xC3, 0x6D, 0x10, 0x18, 0x22, 0x31, 0xC0, 0x9B, 0xB9, 0xC0,
+        0x05, 0xC1, 0x6B, 0xC0, 0x05, 0xA2, 0x77, 0xC0, 0x20, 0x25, 0xC0, 0x31, 0xC3, 0x2C, 0x60, 0xC0,
+        0x20, 0xC0, 0x25, 0x14, 0x0F, 0x25, 0x20, 0x0F, 0x0A, 0x52, 0x6E, 0x0F, 0x6F, 0x20, 0xC1, 0x25,
+        0x20, 0xC0, 0x11, 0x55, 0x2E, 0x9C, 0x99, 0x9C, 0x87, 0x9D, 0x89, 0x7E, 0xA4, 0x88, 0xA4, 0x78,
+        0xA3, 0x99, 0x1D, 0x31, 0xC1, 0x22, 0x16, 0xC5, 0x11, 0xCA, 0x16, 0xC0, 0x11, 0xC0, 0x16, 0xC0,
+        0x11, 0xD6, 0x1E, 0x1C, 0x52, 0x62, 0x3D, 0xC0, 0x29, 0x15, 0x09, 0x6E, 0xA2, 0x87, 0x6E, 0xA5,
+        0x89, 0xC0, 0x6E, 0x14, 0x6B, 0x19, 0x56, 0x18, 0xC0, 0x13, 0xC0, 0x69, 0x22, 0xC0, 0x13, 0xC0,
+        0x5A, 0x18, 0x10, 0x1F, 0x10, 0x08, 0x10, 0xC0, 0x1F, 0x31, 0xC1, 0x22, 0xC0, 0x10, 0x08, 0xC0,
+        0x6B, 0xC0, 0x08, 0x0F, 0xC1, 0x6D, 0x13, 0x27, 0x31, 0xC0, 0x9A, 0xBA, 0x69, 0xC0, 0x0A, 0x05,
+        0xC3, 0x0A, 0xA2, 0x77, 0x6F, 0x31, 0xC1, 0x25, 0x31, 0x20, 0xC0, 0x14, 0x0A, 0x6E, 0x6F, 0x25,
+        0x0F, 0x03, 0x0A, 0x0F, 0x0A, 0x62, 0x5A, 0xC0, 0x6E, 0x05, 0xA2, 0x67, 0x20, 0x1B, 0x25, 0x51,
+        0x25, 0x1D, 0x11, 0x51, 0x29, 0x9C, 0x88, 0x9B, 0x99, 0x51, 0xA3, 0x88, 0x01, 0x29, 0xA3, 0x89,
+        0x1D, 0x31, 0xC1, 0x22, 0x1D, 0x16, 0x1D, 0x16, 0xC1, 0x11, 0xCA, 0x16, 0xC0, 0x11, 0xC1, 0x16,
+        0x11, 0xD6, 0x1E, 0x69, 0x56, 0x62, 0x38, 0x29, 0x15, 0x01, 0xC1, 0x06, 0x2F, 0xA4, 0x78, 0x0F,
+        0x1E, 0x51, 0x14, 0x6E, 0x67, 0xC0, 0x18, 0xC1, 0x55, 0x27, 0xC0, 0x18, 0x10, 0xC1, 0x08, 0x10,
+        0x08, 0x6B, 0xC0, 0x0D, 0x22, 0x31, 0xC1, 0x22, 0x1F, 0x10, 0x08, 0x0F, 0xC1, 0x08, 0xC0, 0x0D,
+        0x10, 0xC0, 0x18, 0xC0, 0x22, 0x2A, 0x9A, 0xBB, 0x69, 0xC0, 0x6E, 0x03, 0xC0, 0x6F, 0x0A, 0x05,
+        0x0A, 0xA2, 0x77, 0xC0, 0x20, 0x25, 0xC0, 0x62, 0x20, 0x0A, 0x0F, 0x14, 0x05, 0xC1, 0x0A, 0x05,
+        0x0F, 0xC0, 0x05, 0x56, 0xC2, 0x07, 0x14, 0x11, 0x20, 0x1B, 0x5A, 0xC0, 0x25, 0xC0, 0x20, 0x11,
+        0x51, 0x1A, 0x2D, 0x9C, 0x88, 0xC0, 0xA2, 0x88, 0xA5, 0x89, 0xA4, 0x88, 0x11, 0x25, 0x31, 0xC0,
+        0x2A, 0x25, 0x1D, 0xC0, 0x16, 0xC1, 0x11, 0xCA, 0x16, 0xC1, 0x11, 0xC0, 0x16, 0x11, 0xC1, 0x16,
+        0x69, 0x11, 0xD1, 0x16, 0x0F, 0x17, 0x3D, 0x29, 0x15, 0x0D, 0x3C, 0xC0, 0x01, 0x15, 0xA7, 0x86,
+        0x57, 0x11, 0x1E, 0x0F, 0x6E, 0xC0, 0x6B, 0x6E, 0x10, 0xC1, 0x7E, 0x1B, 0x27, 0x18, 0x10, 0xC0,
+        0x0B, 0x5A, 0x6B, 0xC0, 0x5A, 0x0F, 0x08, 0x10, 0x1F, 0x27, 0x31, 0xC0, 0x27, 0x1F, 0x08, 0x0C,
+        0x0F, 0xC1, 0x10, 0x5A, 0x10, 0x18, 0x22, 0x31, 0x2A, 0x27, 0x0A, 0x03, 0x6F, 0x0A, 0x0F, 0xC0,
+        0x6E, 0xC0, 0x0A, 0x0F, 0xA2, 0x78, 0x66, 0x0F, 0xC0, 0x20, 0x0F, 0x0A, 0xC0, 0x0F, 0x62, 0xC0,
+        0x66, 0x05, 0xC1, 0x14, 0x0A, 0x05, 0x56, 0xC0, 0x02, 0xC0, 0x20, 0x1B, 0x20, 0x11, 0x62, 0x02,
+        0xA2, 0x77, 0x20, 0x25, 0xC0, 0x16, 0x11, 0x35, 0x9C, 0x98, 0x19, 0x51, 0xC0, 0x28, 0x15, 0xA4,
+        0x88, 0x16, 0x25, 0x31, 0xC0, 0x25, 0x22, 0x1D, 0xC0, 0x20, 0xC0, 0x1D, 0x16, 0xC4, 0x11, 0x7E,
+        0x16, 0xC0, 0x11, 0x1D, 0xC0, 0x16, 0xC4, 0x19, 0x1E, 0x17, 0x16, 0x19, 0x17, 0x56, 0x11, 0xCC,
+        0x16, 0xC1, 0x1C, 0x9A, 0x9A, 0x1A, 0x61, 0x3C, 0x5A, 0x3C, 0x10, 0xA3, 0x87, 0xA6, 0x76, 0x9D,
+        0x9B, 0x11, 0x16, 0x6D, 0x6B, 0xC0, 0x18, 0xC0, 0x56, 0x6B, 0x10, 0xC0, 0x13, 0x18, 0xC0, 0x10,
+        0x5B, 0x66, 0x08, 0x0F, 0x08, 0x5B, 0x0F, 0x6D, 0x17, 0x1F, 0x7A, 0x27, 0x7B, 0x22, 0x13, 0x10,
+        0x0F, 0xC0, 0x5B, 0x0F, 0x08, 0x0D, 0xA0, 0xA8, 0x18, 0x22, 0x2A, 0x31, 0xC0, 0x9C, 0xA8, 0x03,
+        0x19, 0x0F, 0x6E, 0xC0, 0x20, 0x14, 0xC0, 0x0F, 0xC0, 0x20, 0xC0, 0x0A, 0x66, 0xC1, 0x0A, 0xC0,
+        0x05, 0x00, 0xC3, 0x3B, 0x14, 0x0F, 0x52, 0x07, 0x0F, 0x02, 0x14, 0x25, 0x20, 0x66, 0x07, 0x02,
+        0x07, 0x20, 0x31, 0x25, 0x22, 0x16, 0x52, 0x29, 0x3C, 0x9D, 0x88, 0x51, 0x7F, 0x2D, 0xA5, 0x89,
+        0xA4, 0x87, 0x1D, 0x31, 0x25, 0x2A, 0x25, 0x22, 0x20, 0xC2, 0x69, 0x16, 0xC4, 0x19, 0xC0, 0x16,
+        0xC0, 0x1D, 0x20, 0xC0, 0x1E, 0xC0, 0x1D, 0x16, 0xC0, 0x19, 0x1E, 0x12, 0x6E, 0xC0, 0x69, 0x17,
+        0x19, 0x12, 0x16, 0xC2, 0x11, 0xC0, 0x16, 0x11, 0xC2, 0x16, 0x1E, 0x1C, 0x56, 0x10, 0x9A, 0x8A,
+        0x54, 0x9D, 0x9A, 0x2D, 0x3C, 0xA2, 0x78, 0x21, 0x36, 0xA4, 0x76, 0x16, 0x11, 0xC1, 0x16, 0xC0,
+        0x25, 0x59, 0x13, 0x5B, 0x69, 0x18, 0x27, 0x1B, 0x18, 0x10, 0x5B, 0x66, 0x08, 0x0B, 0x5E, 0x0F,
+        0x08, 0xC0, 0x17, 0xA1, 0xA8, 0xC1, 0x2A, 0x22, 0xC0, 0x1F, 0x10, 0x08, 0x0F, 0x14, 0x0D, 0x10,
+        0x18, 0x13, 0x22, 0x1F, 0x31, 0xC0, 0x0A, 0x6E, 0xC1, 0x6F, 0xC0, 0x69, 0x1B, 0x25, 0xC0, 0x20,
+        0x0F, 0x0A, 0xC0, 0x66, 0x6B, 0x05, 0x0A, 0x05, 0xC3, 0x00, 0xC0, 0x05, 0x07, 0x05, 0x0F, 0x14,
+        0x20, 0x51, 0x1B, 0xC0, 0x20, 0x25, 0x0C, 0xC0, 0x20, 0x56, 0x1B, 0x25, 0xC1, 0x16, 0x02, 0x21,
+        0x2D, 0x9D, 0x99, 0x55, 0x14, 0x3C, 0x29, 0xA4, 0x78, 0x22, 0x25, 0xC3, 0x20, 0x25, 0xC0, 0x19,
+        0x16, 0xC3, 0x19, 0xC0, 0x1E, 0x16, 0xC0, 0x20, 0xC0, 0x19, 0x1E, 0xC1, 0x1D, 0x16, 0x1E, 0xC1,
+        0x55, 0x7D, 0x66, 0x6F, 0xC1, 0x1C, 0xC0, 0x17, 0x16, 0x11, 0x16, 0x1C, 0x16, 0xC1, 0x11, 0xC0,
+        0x17, 0x6D, 0x1C, 0x10, 0x9E, 0x86, 0x9D, 0x8A, 0x32, 0x2D, 0xA3, 0x98, 0x1A, 0xA2, 0x88, 0x02,
+        0x1C, 0x57, 0x11, 0xC2, 0x1B, 0xC1, 0x5A, 0x56, 0xC1, 0x22, 0xC0, 0x10, 0xC0, 0x5B, 0x08, 0x0D,
+        0x18, 0x0D, 0x10, 0xC1, 0x7B, 0xC0, 0x22, 0x31, 0xC0, 0x27, 0x31, 0x1F, 0x10, 0xC1, 0x13, 0x10,
+        0x08, 0x10, 0xC1, 0x22, 0x2A, 0x27, 0x0A, 0xC2, 0xA2, 0x77, 0xC1, 0x20, 0x25, 0x31, 0xC0, 0x25,
+        0x9D, 0xA9, 0x62, 0x6B, 0x05, 0xC1, 0x0A, 0x05, 0xC0, 0x0A, 0xC0, 0x05, 0x5A, 0x0A, 0x0F, 0xC0,
+        0x14, 0xC0, 0x25, 0x65, 0x25, 0x2C, 0x31, 0x20, 0x56, 0x25, 0x20, 0x31, 0x2C, 0x25, 0xC0, 0x2A,
+        0x25, 0x16, 0x3D, 0x9C, 0x88, 0x2D, 0x9D, 0x99, 0x55, 0xA2, 0x88, 0x01, 0x2E, 0x11, 0x1D, 0x20,
+        0x25, 0xC1, 0x20, 0x25, 0xC0, 0x1D, 0xC0, 0x16, 0x7A, 0x1E, 0x19, 0x1E, 0x16, 0x25, 0x1E, 0xC1,
+        0x25, 0x1E, 0xC0, 0x25, 0x1E, 0xC2, 0x17, 0xC0, 0x56, 0xC1, 0x17, 0xC1, 0x1C, 0x1E, 0xC0, 0x23,
+        0x16, 0xC0, 0x1C, 0x19, 0xA2, 0x75, 0xC0, 0x1C, 0x1E, 0x1C, 0x15, 0xC1, 0x50, 0x98, 0x9A, 0x56,
+        0x01, 0xA5, 0x86, 0x34, 0xA0, 0x8A, 0x11, 0x1C, 0x1B, 0x11, 0xC0, 0x16, 0xC0, 0x25, 0x2A, 0xC0,
+        0x45, 0xC0, 0x1B, 0x18, 0x10, 0xC1, 0x18, 0x10, 0x0D, 0x10, 0xC0, 0x08, 0x1F, 0xC0, 0x22, 0xC1,
+        0x27, 0x2A, 0x31, 0x22, 0x1F, 0xC0, 0x10, 0x22, 0xC0, 0x18, 0xC0, 0x10, 0x0D, 0x67, 0x0D, 0x10,
+        0x13, 0x18, 0x0C, 0x69, 0xC1, 0xA2, 0x77, 0x25, 0xC0, 0x2A, 0x62, 0x2A, 0x25, 0x20, 0x0F, 0x05,
+        0x0C, 0x05, 0x0F, 0x0A, 0xC3, 0xA2, 0x77, 0x9D, 0x9A, 0x0A, 0x07, 0x14, 0x25, 0xC0, 0x31, 0xC0,
+        0x25, 0x31, 0xC1, 0x20, 0x25, 0x31, 0x25, 0x31, 0xC4, 0x22, 0x11, 0x2E, 0x9C, 0x99, 0x2D, 0x51,
+        0x66, 0xA2, 0x78, 0xA4, 0x88, 0x2E, 0xA2, 0x88, 0x16, 0xC1, 0x1D, 0x20, 0x6E, 0x22, 0xC1, 0x1D,
+        0x16, 0x1E, 0xC0, 0x25, 0x11, 0x1E, 0x25, 0x1E, 0xC1, 0x55, 0x7B, 0x1D, 0x1E, 0xC1, 0x17, 0xC0,
+        0x0F, 0xC0, 0x1D, 0x19, 0x1E, 0x17, 0xC0, 0x1C, 0x23, 0x1C, 0xC0, 0x17, 0x16, 0x1C, 0x1E, 0x19,
+        0x15, 0x1C, 0xC1, 0x15, 0xC1, 0x9D, 0x98, 0x69, 0x52, 0x6B, 0xA4, 0x78, 0x7D, 0x0F, 0x16, 0x1C,
+        0x1E, 0x16, 0x6D, 0x1B, 0x1D, 0x25, 0x2A, 0x27, 0x18, 0x1B, 0x22, 0x27, 0x18, 0x56, 0x18, 0x13,
+        0x10, 0x18, 0x1F, 0x10, 0xC0, 0x22, 0x27, 0x22, 0xC1, 0x6F, 0x22, 0x27, 0x22, 0x1F, 0x10, 0x22,
+        0xC0, 0x27, 0x10, 0xC1, 0x5A, 0x67, 0x0D, 0x18, 0x27, 0x31, 0x0C, 0x05, 0xC0, 0x0A, 0x6E, 0x6E,
+        0x20, 0x25, 0x62, 0x2A, 0xC0, 0x25, 0x0F, 0x0A, 0xC2, 0x0F, 0x03, 0xC0, 0x0F, 0xC0, 0x0A, 0x05,
+        0x0F, 0xC0, 0x14, 0x25, 0x2C, 0x31, 0xC4, 0x25, 0x31, 0xC7, 0x25, 0x1D, 0x61, 0x29, 0x9D, 0x89,
+        0x60, 0x51, 0x52, 0x2D, 0xA4, 0x88, 0xA3, 0x88, 0x11, 0xC1, 0x16, 0xC0, 0x25, 0xC1, 0x19, 0x16,
+        0x19, 0x1E, 0x16, 0xC0, 0x65, 0x16, 0xC0, 0x1E, 0x16, 0x69, 0x0A, 0x1E, 0xC3, 0x12, 0x59, 0x0F,
+        0x16, 0x20, 0x22, 0x69, 0x1E, 0x17, 0x1C, 0xC2, 0x17, 0xC0, 0x1C, 0xC7, 0x9F, 0x96, 0x9C, 0x88,
+        0xA4, 0x77, 0x9B, 0x9B, 0x2F, 0xA5, 0x87, 0xC0, 0x1C, 0xC1, 0x23, 0xC1, 0x1B, 0x22, 0x25, 0x2A,
+        0x1B, 0x27, 0x2A, 0xC1, 0x27, 0x18, 0x10, 0xC0, 0x18, 0x22, 0x18, 0xC1, 0x22, 0xC1, 0x1F, 0xC3,
+        0x22, 0x25, 0x10, 0x18, 0x13, 0x5B, 0x59, 0x10, 0x18, 0x10, 0xC1, 0x18, 0x1B, 0x22, 0x05, 0xC0,
+        0x6E, 0x6E, 0x20, 0xC0, 0x65, 0x20, 0x0F, 0x25, 0xC0, 0x20, 0x0F, 0x20, 0x14, 0x20, 0x14, 0x0A,
+        0xC0, 0x03, 0x0F, 0x0A, 0x3E, 0xC0, 0x0A, 0x0F, 0xC0, 0x20, 0x2C, 0x31, 0xCF, 0x25, 0x16, 0x3D,
+        0x29, 0x09, 0x04, 0x9C, 0x88, 0x21, 0x04, 0x6F, 0x3D, 0x7E, 0x6E, 0x11, 0x16, 0x7A, 0x16, 0x1E,
+        0x12, 0x19, 0x16, 0x11, 0xC0, 0x05, 0xC0, 0x0A, 0xC2, 0x05, 0x0A, 0x6E, 0xC0, 0x12, 0x6E, 0xC0,
+        0x0F, 0xC0, 0x12, 0x19, 0x1B, 0x22, 0x25, 0x1E, 0x17, 0x15, 0xC0, 0x17, 0xC0, 0x6E, 0xC6, 0x23,
+        0x2A, 0x23, 0x0E, 0x66, 0x6D, 0x56, 0xA0, 0x8A, 0x1C, 0xC0, 0x23, 0x1C, 0x5A, 0xC0, 0x6B, 0x23,
+        0x1E, 0x25, 0x2A, 0x20, 0xC0, 0x2A, 0xC0, 0x1B, 0x22, 0x1B, 0x18, 0x56, 0xC0, 0x18, 0x22, 0xC2,
+        0x27, 0x1F, 0xC0, 0x10, 0x1F, 0xC0, 0x66, 0x10, 0x22, 0xC0, 0x1F, 0x45, 0x66, 0x0D, 0x10, 0x0D,
+        0x18, 0x08, 0x18, 0x10, 0xC1, 0x18, 0x9B, 0xDC, 0x69, 0xA2, 0x77, 0x14, 0x25, 0xC0, 0x66, 0xC0,
+        0x9D, 0xA9, 0x20, 0xC0, 0x14, 0x20, 0x31, 0x20, 0xC0, 0x25, 0x0F, 0x3E, 0x0A, 0x05, 0xC2, 0x0A,
+        0x0F, 0x0A, 0x0F, 0x14, 0x6E, 0x25, 0xC0, 0x31, 0xCD, 0x25, 0x11, 0x3D, 0x24, 0x51, 0x79, 0x35,
+        0x7E, 0xA2, 0x88, 0xA3, 0x89, 0xA2, 0x87, 0x6F, 0xC0, 0x16, 0x0A, 0xC1, 0x52, 0x6D, 0x3E, 0xC0,
+        0x0A, 0x66, 0xC0, 0x0A, 0x69, 0x0A, 0xC0, 0x67, 0x0A, 0xC0, 0x6E, 0x7D, 0x0B, 0xC0, 0x0F, 0xC1,
+        0x19, 0x1E, 0xC1, 0x17, 0x10, 0x15, 0xC0, 0x10, 0x15, 0xC0, 0x1C, 0xC2, 0x15, 0x1C, 0x23, 0x2A,
+        0xC1, 0x15, 0x1C, 0x0E, 0x15, 0x1C, 0xC3, 0x23, 0x5A, 0x69, 0x66, 0xC0, 0x20, 0xC2, 0x2A, 0x27,
+        0x22, 0x7F, 0x2A, 0x18, 0xC0, 0x13, 0x5A, 0x22, 0x31, 0x2A, 0x1F, 0x22, 0x1F, 0x0D, 0xC0, 0x7B,
+        0x1F, 0x08, 0x0D, 0x10, 0xC0, 0x6E, 0x08, 0x6B, 0x08, 0xC0, 0x0D, 0x08, 0xC0, 0x0D, 0x08, 0xC0,
+        0x10, 0x22, 0x9B, 0xCA, 0x6E, 0x6E, 0x6E, 0x6F, 0xC0, 0x25, 0x14, 0x0A, 0x0F, 0x14, 0xC1, 0x20,
+        0x25, 0x20, 0x0F, 0x0A, 0x05, 0xC0, 0x0A, 0x05, 0xC0, 0x69, 0x0A, 0x0F, 0xC0, 0x14, 0x25, 0x2A,
+        0x31, 0xD0, 0x25, 0x16, 0x61, 0x51, 0x65, 0x66, 0x66, 0x69, 0x11, 0x6E, 0xA3, 0x99, 0x6E, 0x6F,
+        0x05, 0x39, 0x41, 0x66, 0x6D, 0xC0, 0x7E, 0xA2, 0x88, 0xC0, 0x3E, 0xC0, 0x03, 0xC0, 0x05, 0x0C,
+        0x6E, 0x03, 0x6E, 0xC0, 0x79, 0x69, 0x0B, 0xC0, 0xA0, 0x8A, 0x6B, 0x1E, 0x69, 0xC1, 0x69, 0x0E,
+        0x07, 0xC0, 0xA0, 0x8A, 0xC1, 0x1C, 0xC0, 0x15, 0xC2, 0xA0, 0x8A, 0xC0, 0x1C, 0x2A, 0xC0, 0x23,
+        0x2A, 0xC0, 0x23, 0x1C, 0xC1, 0x5B, 0x66, 0x6D, 0x23, 0xC0, 0x20, 0x27, 0x2A, 0x1B, 0x20, 0x1B,
+        0xC0, 0x27, 0x18, 0x1B, 0x6B, 0xC0, 0x27, 0x18, 0x22, 0xC0, 0x18, 0x1F, 0x1A, 0x0D, 0x67, 0x69,
+        0xC0, 0x0F, 0xC0, 0x08, 0xA2, 0x87, 0x66, 0x6B, 0x0D, 0x56, 0x08, 0x0F, 0x5A, 0x6B, 0x0F, 0xC0,
+        0x08, 0x1F, 0x22, 0x9C, 0xB9, 0xA2, 0x77, 0x6F, 0x6E, 0xC0, 0x20, 0x61, 0x0A, 0x66, 0x0A, 0x0F,
+        0x14, 0x6E, 0x20, 0x2A, 0x20, 0x14, 0x0A, 0x67, 0x05, 0xC1, 0x0A, 0x0F, 0xC0, 0x59, 0x0F, 0x20,
+        0x25, 0x6F, 0xD2, 0x25, 0x19, 0x55, 0x62, 0x66, 0x54, 0x66, 0x51, 0x6E, 0x25, 0x6E, 0x39, 0xC0,
+        0x2A, 0x65, 0x11, 0x69, 0xA2, 0x87, 0x55, 0x33, 0xA5, 0x98, 0x51, 0x56, 0xA4, 0x97, 0x37, 0xA0,
+        0x8B, 0xC0, 0x6D, 0x68, 0x69, 0x2B, 0x55, 0x35, 0x09, 0x5B, 0x7A, 0x6B, 0x10, 0xC0, 0x02, 0x09,
+        0x10, 0xA0, 0x85, 0xC0, 0x9D, 0x89, 0x6B, 0xC0, 0x7E, 0x3A, 0x09, 0x3A, 0x02, 0x3A, 0xA2, 0x89,
+        0x1F, 0x3A, 0xA2, 0x8B, 0x6B, 0x31, 0x2A, 0x31, 0x2A, 0x23, 0x69, 0x15, 0x1C, 0xC0, 0x5A, 0xC0,
+        0x6B, 0x23, 0x2A, 0xC0, 0x20, 0x1B, 0xC1, 0x18, 0xC1, 0x20, 0x22, 0x27, 0x31, 0x2A, 0x22, 0x18,
+        0x56, 0xC1, 0x57, 0xC0, 0x69, 0xC0, 0x0F, 0xC0, 0x08, 0xC0, 0x5B, 0x08, 0xC1, 0x5A, 0x0C, 0x13,
+        0xC0, 0x0C, 0x0F, 0x6D, 0xA0, 0xA8, 0x22, 0x9D, 0xB9, 0xA2, 0x77, 0x14, 0xC0, 0x0F, 0xC1, 0x66,
+        0x66, 0x0A, 0x14, 0x6F, 0x6E, 0x14, 0xC0, 0x0A, 0xC1, 0x05, 0xC0, 0x6D, 0x14, 0x19, 0x20, 0x25,
+        0xC0, 0x14, 0x20, 0x31, 0xD4, 0x25, 0x55, 0x61, 0x00, 0x56, 0x61, 0x65, 0x27, 0x9F, 0x86, 0xA2,
+        0x89, 0x7E, 0xC0, 0x40, 0x9D, 0x99, 0x42, 0x7E, 0xA5, 0x97, 0x9B, 0x89, 0x9C, 0x8A, 0xA7, 0x96,
+        0x7F, 0x0A, 0xA3, 0x88, 0x37, 0xA1, 0x8A, 0x69, 0x54, 0x3C, 0xC0, 0x35, 0xC1, 0x04, 0x5A, 0x04,
+        0x3D, 0x04, 0xA0, 0x75, 0x02, 0x3B, 0x6F, 0x0E, 0x9D, 0x98, 0x9B, 0x9A, 0x6E, 0xC0, 0x55, 0x0D,
+        0xA5, 0x87, 0x08, 0x5A, 0xA5, 0x96, 0x3B, 0x9C, 0x88, 0x27, 0x0E, 0x2A, 0xC0, 0x31, 0x2A, 0x69,
+        0x1C, 0xC0, 0x15, 0xC0, 0x1C, 0x5A, 0x1C, 0x19, 0xC0, 0x6B, 0xC0, 0x65, 0x6B, 0x18, 0xC3, 0x7F,
+        0x31, 0x2A, 0xC0, 0x22, 0xC0, 0x55, 0x10, 0xC1, 0x5A, 0x66, 0xC1, 0x0C, 0xC0, 0x08, 0xC0, 0x0C,
+        0x08, 0xC1, 0x0C, 0xC0, 0x6B, 0xC0, 0x0C, 0x08, 0x10, 0x18, 0x1B, 0x9D, 0xBA, 0xA3, 0x78, 0x6B,
+        0x25, 0x66, 0x65, 0x62, 0x66, 0x0A, 0xC0, 0x0F, 0xC0, 0x14, 0x0F, 0xC0, 0x14, 0xC0, 0x0A, 0x05,
+        0x0A, 0xC0, 0x14, 0x25, 0xC0, 0x31, 0xC0, 0x25, 0xC0, 0x31, 0xCF, 0x2A, 0x31, 0xC1, 0x25, 0x16,
+        0xC0, 0x7A, 0x51, 0x00, 0x57, 0x66, 0x66, 0xA0, 0x85, 0xA2, 0x87, 0x39, 0x54, 0x36, 0xA3, 0x88,
+        0x66, 0x5A, 0xA4, 0x98, 0x99, 0x88, 0x36, 0xA2, 0x77, 0x66, 0x2B, 0xA1, 0x8A, 0x03, 0xC0, 0x68,
+        0x9D, 0x99, 0x65, 0x35, 0x7A, 0x2E, 0x6F, 0x09, 0x3A, 0x3D, 0x9C, 0x87, 0xA4, 0x88, 0x33, 0x09,
+        0xA1, 0x8A, 0xC0, 0x9F, 0x95, 0x9A, 0x89, 0xA1, 0x9A, 0x6E, 0x68, 0x00, 0xC0, 0x2E, 0x97, 0x8C,
+        0x7D, 0x13, 0x06, 0x9D, 0x9A, 0x1F, 0x15, 0xA0, 0x8A, 0xC0, 0x2A, 0x23, 0xC0, 0x15, 0xC0, 0x6B,
+        0x15, 0x1C, 0xC2, 0x23, 0xC0, 0x55, 0xC1, 0x18, 0xC3, 0x1B, 0x6F, 0xC0, 0x2A, 0x31, 0xC0, 0x22,
+        0x5A, 0x55, 0x18, 0x1F, 0x56, 0x1F, 0x10, 0x08, 0xC2, 0x6B, 0x0C, 0x08, 0xC2, 0xA0, 0x7A, 0xC1,
+        0x0F, 0x08, 0x18, 0x1B, 0x72, 0x25, 0x31, 0xC0, 0x2A, 0x62, 0x61, 0x66, 0x0F, 0xC1, 0x0A, 0xC2,
+        0x0F, 0x0A, 0xC0, 0x66, 0x0A, 0x0F, 0xC0, 0x14, 0x19, 0x25, 0x31, 0xC0, 0x25, 0x31, 0xCF, 0x25,
+        0xC0, 0x2A, 0x25, 0x16, 0x25, 0x16, 0x65, 0x66, 0xC0, 0x56, 0x6B, 0x3F, 0xC0, 0x7E, 0x39, 0x3E,
+        0x51, 0x2F, 0x3E, 0xC1, 0x64, 0x28, 0x79, 0x32, 0x3C, 0xA0, 0x8B, 0x0A, 0x03, 0x3A, 0x7B, 0x3C,
+        0x0B, 0xC0, 0x09, 0x9D, 0x99, 0x04, 0x28, 0x09, 0x21, 0x3A, 0x09, 0x1C, 0x23, 0x1C, 0x68, 0xC0,
+        0x09, 0x0E, 0x02, 0x9B, 0x8A, 0x66, 0xA3, 0x88, 0x9A, 0x8A, 0x7A, 0xA2, 0x86, 0x34, 0xA2, 0x77,
+        0xA7, 0x98, 0x1C, 0xC0, 0x23, 0x1C, 0xC0, 0x15, 0xC0, 0x1C, 0xC4, 0x23, 0xC0, 0x1B, 0x23, 0xC0,
+        0x5A, 0x1B, 0x18, 0x69, 0x18, 0xC1, 0x22, 0x27, 0x7A, 0x31, 0xC0, 0x22, 0x27, 0x1F, 0x27, 0x1F,
+        0x22, 0x27, 0x10, 0x1F, 0x0D, 0x17, 0x55, 0x0C, 0x13, 0x0C, 0x69, 0xC0, 0x7B, 0x0C, 0xC0, 0x13,
+        0x0F, 0x10, 0x18, 0xC0, 0x9F, 0xB9, 0x6B, 0x25, 0x6B, 0x25, 0x20, 0x65, 0x66, 0x20, 0x0F, 0xC0,
+        0x66, 0xC1, 0x0F, 0xC0, 0x14, 0x0F, 0x0A, 0x69, 0x19, 0x25, 0xC1, 0x31, 0xC1, 0x25, 0x31, 0xCA,
+        0x2A, 0x31, 0xC2, 0x25, 0x19, 0xC0, 0x16, 0x66, 0x16, 0x11, 0x65, 0x66, 0xC1, 0x07, 0xC2, 0x05,
+        0xC2, 0x6B, 0xC1, 0x05, 0x6D, 0x6E, 0xC1, 0x6B, 0xC1, 0x7D, 0xC0, 0x08, 0x10, 0x6B, 0xC0, 0x10,
+        0x17, 0x08, 0x10, 0xC0, 0x15, 0xC0, 0x1C, 0xC1, 0x15, 0x10, 0x1C, 0xC0, 0x15, 0xC0, 0x10, 0x09,
+        0x37, 0x28, 0x35, 0x2E, 0xA2, 0x78, 0x15, 0x1C, 0xC3, 0x15, 0xC2, 0x1C, 0xC0, 0x5A, 0xC2, 0x23,
+        0x19, 0x23, 0x1B, 0x69, 0x1B, 0xC1, 0x27, 0xC2, 0x2A, 0x31, 0xC2, 0x22, 0x31, 0x1F, 0x22, 0x25,
+        0x1F, 0xC0, 0x55, 0x1F, 0x10, 0x47, 0x13, 0x0C, 0x66, 0x0C, 0x0D, 0x66, 0x0C, 0x7A, 0xC0, 0x08,
+        0x0D, 0xA1, 0xA7, 0x73, 0x25, 0x31, 0xC0, 0x2A, 0x31, 0x20, 0x65, 0x25, 0x14, 0x65, 0x6B, 0x0A,
+        0x0F, 0x14, 0x0F, 0x14, 0x6E, 0x0F, 0x14, 0x19, 0x31, 0xD1, 0x25, 0x31, 0xC2, 0x25, 0x16, 0xC1,
+        0x65, 0xC0, 0x05, 0xC1, 0x0A, 0x05, 0x00, 0x6B, 0xC0, 0x05, 0xC0, 0x69, 0xC0, 0x05, 0x6B, 0x6B,
+        0x0C, 0x0A, 0x6E, 0xC2, 0x17, 0x66, 0x17, 0xC0, 0x6B, 0xC0, 0x23, 0xC0, 0x1E, 0xC0, 0x1C, 0xC0,
+        0x1E, 0x1C, 0xC6, 0x23, 0x1C, 0xC0, 0x17, 0x11, 0xA2, 0x76, 0x0A, 0x56, 0x65, 0x51, 0x2F, 0x0E,
+        0x1C, 0xC0, 0x15, 0x1C, 0xC3, 0x15, 0xC0, 0x1C, 0x5B, 0x27, 0x20, 0x69, 0xC2, 0x23, 0x20, 0x14,
+        0x27, 0x20, 0x1B, 0x2A, 0x1B, 0x6B, 0x31, 0xC3, 0x22, 0x31, 0x22, 0xC0, 0x27, 0x22, 0xC0, 0x10,
+        0x1A, 0x1F, 0x41, 0x6B, 0x5A, 0xC5, 0x0D, 0x08, 0x0D, 0x79, 0x9F, 0xCA, 0x6F, 0x25, 0x2C, 0x20,
+        0x31, 0x20, 0x14, 0x20, 0x60, 0xC0, 0x6B, 0xC1, 0x14, 0x08, 0x25, 0x2A, 0x0F, 0x25, 0xC1, 0x31,
+        0xCF, 0x25, 0xC0, 0x31, 0xC0, 0x2A, 0x31, 0x20, 0x11, 0x16, 0x05, 0xC5, 0x00, 0x05, 0xC6, 0x6B,
+        0x0A, 0xC1, 0x6E, 0xC1, 0x17, 0xC1, 0x1E, 0xC0, 0x17, 0x23, 0x2A, 0xC0, 0x23, 0x2A, 0x23, 0x2A,
+        0xC0, 0x1C, 0x2A, 0xC0, 0x23, 0xC1, 0x1C, 0x23, 0xC1, 0x2A, 0xC0, 0x25, 0xC0, 0x56, 0x11, 0x56,
+        0x51, 0xA2, 0x86, 0x15, 0x1C, 0xC0, 0x23, 0xC1, 0x1C, 0xC1, 0x15, 0xC0, 0x1C, 0x5B, 0xC1, 0x19,
+        0x66, 0x19, 0xC0, 0x23, 0x20, 0xC0, 0x1B, 0xC2, 0x18, 0x27, 0x31, 0xC3, 0x27, 0x31, 0x2A, 0x31,
+        0x22, 0x1F, 0xC0, 0x10, 0x22, 0x1F, 0x0D, 0xC0, 0x67, 0x69, 0xC0, 0x0F, 0x5A, 0xC0, 0x0F, 0xC0,
+        0x08, 0x0D, 0x10, 0x9F, 0xC9, 0xC0, 0x25, 0x62, 0x6E, 0x25, 0x14, 0xC1, 0x66, 0xC0, 0x66, 0x0F,
+        0x14, 0x65, 0x14, 0x25, 0xC0, 0x14, 0x25, 0x31, 0xCE, 0x25, 0xC0, 0x2A, 0x16, 0x2A, 0x31, 0xC0,
+        0x25, 0x1E, 0x66, 0x55, 0xC0, 0x00, 0x05, 0xC0, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x12, 0x0A, 0x6E,
+        0x05, 0x6B, 0xC0, 0x05, 0x0A, 0xC0, 0x0F, 0x0A, 0x12, 0x17, 0x55, 0x12, 0xC0, 0x17, 0x23, 0x2A,
+        0x25, 0x1E, 0x23, 0x2A, 0x31, 0x2A, 0x31, 0x2A, 0x31, 0x2A, 0xC4, 0x31, 0x2A, 0x23, 0xC0, 0x2A,
+        0x31, 0x2A, 0xC0, 0x31, 0x2A, 0x25, 0x11, 0x3D, 0x0A, 0x0F, 0x6F, 0x1C, 0x23, 0x2A, 0x23, 0xC0,
+        0x1C, 0xC1, 0x15, 0x1C, 0x23, 0x5A, 0xC0, 0x69, 0x1C, 0x19, 0xC0, 0x20, 0xC2, 0x55, 0x18, 0xC0,
+        0x22, 0x2A, 0xC0, 0x31, 0xC6, 0x27, 0x1F, 0x10, 0xC0, 0x22, 0x1A, 0x0D, 0x66, 0xC3, 0x5B, 0xC1,
+        0x7A, 0xC1, 0x0D, 0x9E, 0xD8, 0x14, 0x6F, 0x14, 0x25, 0x20, 0x08, 0x67, 0xC3, 0x6E, 0x08, 0x66,
+        0x14, 0xC0, 0x6E, 0x65, 0x25, 0x31, 0x25, 0x31, 0xC9, 0x25, 0xC0, 0x19, 0x1E, 0x19, 0x16, 0xC0,
+        0x25, 0xC0, 0x2A, 0x25, 0x16, 0x65, 0x05, 0xC5, 0xA2, 0x77, 0xC0, 0x1E, 0xC0, 0x0F, 0xC0, 0x0A,
+        0x05, 0xC0, 0x0A, 0xC0, 0x0F, 0x19, 0x0F, 0x1E, 0xC0, 0x17, 0x0F, 0x12, 0x1E, 0x23, 0xC0, 0x2A,
+        0xC1, 0x31, 0xC0, 0x2A, 0x31, 0xC9, 0x2A, 0x23, 0x31, 0xC4, 0x2A, 0x16, 0x09, 0xC0, 0x7E, 0x22,
+        0x23, 0x2A, 0x31, 0x23, 0xC0, 0x1E, 0x15, 0xC0, 0x1C, 0xC1, 0x2A, 0x27, 0x69, 0x65, 0x69, 0x14,
+        0x6E, 0x14, 0xC0, 0x1B, 0x59, 0x18, 0x66, 0x1B, 0x22, 0x27, 0x31, 0xC0, 0x2A, 0x27, 0x31, 0xC1,
+        0x2A, 0x27, 0x1F, 0x1A, 0x10, 0xC0, 0x5A, 0xC1, 0x66, 0xC2, 0x0C, 0x6B, 0xC2, 0x7A, 0x69, 0x9F,
+        0xD8, 0xC1, 0xA2, 0x77, 0x6B, 0xC0, 0x65, 0x0F, 0x66, 0xC0, 0x6B, 0x0A, 0xC2, 0x6D, 0xC0, 0x12,
+        0x66, 0x19, 0x25, 0xC0, 0x31, 0xC8, 0x2A, 0x31, 0x2A, 0x51, 0x65, 0x6B, 0x05, 0x0A, 0x19, 0xC0,
+        0x16, 0x69, 0x0A, 0x05, 0xC4, 0x3E, 0x05, 0x19, 0x16, 0x1E, 0xC0, 0x0F, 0x16, 0x1E, 0x0F, 0x0A,
+        0xC0, 0x0F, 0x1E, 0xC7, 0x2A, 0x31, 0x2A, 0xC0, 0x31, 0xCE, 0x2A, 0x31, 0xC5, 0x1D, 0x11, 0x5A,
+        0x11, 0x25, 0x23, 0x2A, 0x31, 0x2A, 0x23, 0x1C, 0x15, 0x1C, 0x23, 0x1C, 0xC0, 0x2A, 0x27, 0x69,
+        0x69, 0xC0, 0x66, 0xC0, 0x19, 0x14, 0x18, 0xC1, 0x66, 0x18, 0xC0, 0x22, 0x31, 0x22, 0xC0, 0x31,
+        0xC3, 0x27, 0x1F, 0x27, 0x13, 0x10, 0x56, 0x6B, 0xC1, 0x0C, 0xC0, 0x08, 0x0C, 0x6B, 0xC1, 0x0C,
+        0x0F, 0xC0, 0x9E, 0xD8, 0xC1, 0xA2, 0x77, 0xC3, 0x66, 0x67, 0xC3, 0x0A, 0x6D, 0x39, 0x0D, 0x14,
+        0xC0, 0x6E, 0x25, 0xC2, 0x31, 0xC5, 0x25, 0x31, 0xC0, 0x19, 0x55, 0xC0, 0x05, 0x0A, 0x16, 0x1E,
+        0xC0, 0x12, 0x0A, 0x05, 0xC1, 0x0A, 0x05, 0x0A, 0x05, 0xC0, 0x0A, 0x1E, 0xC2, 0x2A, 0x25, 0x19,
+        0x1E, 0x55, 0x1E, 0x2A, 0xC0, 0x1E, 0xC1, 0x2A, 0xC1, 0x23, 0xC0, 0x31, 0xC0, 0x2A, 0x31, 0xC7,
+        0x2A, 0x31, 0xCC, 0x25, 0x51, 0xC0, 0x1D, 0x2A, 0x1C, 0xC0, 0x23, 0xC1, 0x1C, 0xC1, 0x23, 0x1C,
+        0xC1, 0x20, 0x27, 0x68, 0xC0, 0x66, 0xC0, 0x19, 0x14, 0x18, 0x1F, 0xC0, 0x68, 0x67, 0x18, 0xC2,
+        0x2A, 0x31, 0xC3, 0x22, 0x1F, 0xC0, 0x10, 0x1F, 0x46, 0x66, 0xC0, 0x0C, 0x6B, 0x0C, 0xC0, 0x13,
+        0xC0, 0x0C, 0xC1, 0x0F, 0x69, 0x9F, 0xD9, 0x66, 0xC0, 0x0F, 0x6E, 0x6E, 0x14, 0x65, 0x0F, 0x0A,
+        0x6B, 0xC0, 0x0A, 0x11, 0x0A, 0x0F, 0x08, 0xC0, 0x0F, 0xC0, 0x14, 0x19, 0xC0, 0x25, 0x2A, 0x31,
+        0xC5, 0x25, 0x2A, 0x1E, 0x55, 0x66, 0xC0, 0x05, 0x12, 0x19, 0x0F, 0xC0, 0x0A, 0x05, 0xC1, 0x6B,
+        0xC0, 0x05, 0xC0, 0x0C, 0xC0, 0x0A, 0x16, 0x1E, 0xC0, 0x23, 0x2A, 0xC1, 0x31, 0x1E, 0xC0, 0x31,
+        0x2A, 0xC0, 0x23, 0x31, 0xC0, 0x2A, 0x31, 0xC0, 0x2A, 0xC0, 0x31, 0xC8, 0x2A, 0x23, 0x31, 0xCC,
+        0x25, 0x1D, 0x16, 0x22, 0x2C, 0x25, 0x2A, 0x23, 0x1C, 0xC0, 0x23, 0xC0, 0x1C, 0xC1, 0x23, 0x1C,
+        0xC1, 0x5A, 0xC1, 0x66, 0x1B, 0x18, 0x1F, 0xC0, 0x18, 0xC0, 0x66, 0x10, 0xC0, 0x18, 0x27, 0x31,
+        0xC2, 0x22, 0xC0, 0x1F, 0xC0, 0x5A, 0x1A, 0x1F, 0x10, 0xC0, 0x5A, 0x66, 0x5A, 0x08, 0x05, 0x6B,
+        0x6B, 0x0C, 0xC0, 0x7A, 0x08, 0xC0, 0x9E, 0xD9, 0x6E, 0x69, 0x6F, 0x0F, 0x14, 0xC1, 0x0A, 0x11,
+        0xC1, 0x08, 0x0A, 0x08, 0x69, 0x39, 0x01, 0x08, 0xC0, 0x6E, 0x08, 0x5A, 0xA2, 0x88, 0x2A, 0x31,
+        0xC2, 0x2A, 0x1E, 0x25, 0x19, 0x12, 0x5A, 0x66, 0x05, 0xC0, 0x0A, 0xC0, 0x19, 0xC0, 0x0F, 0x65,
+        0x0A, 0x05, 0x6B, 0xC2, 0x05, 0xC1, 0x0F, 0x1E, 0xC2, 0x2A, 0x31, 0xC2, 0x1E, 0x2A, 0xC1, 0x31,
+        0xC5, 0x2A, 0xC0, 0x31, 0xC7, 0x2A, 0x23, 0x31, 0xCC, 0x2A, 0x22, 0xC0, 0x2A, 0x31, 0xC2, 0x2A,
+        0x68, 0xC4, 0x23, 0x1C, 0xC0, 0x23, 0xC0, 0x59, 0x66, 0x1B, 0x22, 0xC0, 0x1F, 0x18, 0x69, 0xC0,
+        0x67, 0x5B, 0xC0, 0x18, 0x22, 0xC0, 0x2A, 0xC0, 0x31, 0xC1, 0x27, 0x1F, 0x17, 0x1A, 0x10, 0xC1,
+        0x18, 0x42, 0x5A, 0x08, 0xC0, 0x5B, 0xC1, 0x08, 0xC0, 0x7D, 0x10, 0x9E, 0xC8, 0x67, 0x6E, 0x6E,
+        0x0F, 0xC0, 0x14, 0x08, 0x0F, 0x0A, 0xC1, 0x0F, 0xC0, 0x0D, 0x01, 0x9C, 0x89, 0x3E, 0x01, 0x0D,
+        0x01, 0x6E, 0x3E, 0x6B, 0xA2, 0x88, 0x25, 0x2A, 0x25, 0xC0, 0x31, 0x19, 0x12, 0x0D, 0x5A, 0xC1,
+        0x67, 0x05, 0x0A, 0x0D, 0x5E, 0x12, 0xC0, 0x0A, 0x05, 0x0C, 0x05, 0xC2, 0x0A, 0xC1, 0x0F, 0x1E,
+        0x2A, 0xC1, 0x31, 0xD9, 0x2A, 0x1C, 0x2A, 0x31, 0x2A, 0x31, 0xCA, 0x25, 0x23, 0x2A, 0x31, 0xC1,
+        0x2A, 0x23, 0xC0, 0x1C, 0xC1, 0x2A, 0xC0, 0x23, 0x1C, 0x23, 0xC0, 0x2A, 0xC0, 0x58, 0x1B, 0x22,
+        0xC0, 0x18, 0x79, 0xC1, 0x18, 0x17, 0xC0, 0x18, 0x27, 0x2A, 0x22, 0x2A, 0x31, 0xC1, 0x22, 0xC0,
+        0x1F, 0xC1, 0x22, 0x1F, 0x10, 0x56, 0x6E, 0x08, 0xC1, 0x0D, 0x08, 0x0D, 0x08, 0x10, 0x18, 0x9C,
+        0xCA, 0xC1, 0xA2, 0x77, 0x6E, 0xC0, 0x1E, 0x14, 0x65, 0x6B, 0x08, 0x19, 0x14, 0xC0, 0x69, 0x3E,
+        0x61, 0x39, 0xC0, 0x12, 0x56, 0x3E, 0xC0, 0x39, 0x05, 0x14, 0x1E, 0x25, 0x19, 0xC1, 0x0D, 0x0A,
+        0xC2, 0x6B, 0x0A, 0xC1, 0x19, 0xC0, 0x0A, 0xC0, 0x05, 0xC0, 0x0A, 0xC2, 0x6E, 0xC0, 0x1E, 0x25,
+        0x1E, 0x2A, 0xC1, 0x31, 0xD7, 0x2A, 0xC1, 0x1C, 0x2A, 0xC0, 0x23, 0x31, 0xCA, 0x2A, 0x23, 0x2A,
+        0x31, 0xC1, 0x2A, 0xC0, 0x23, 0x1C, 0x23, 0xC0, 0x2A, 0xC0, 0x23, 0x2A, 0x31, 0x2A, 0xC0, 0x23,
+        0x55, 0xC1, 0x1B, 0x14, 0xC0, 0x5A, 0xC1, 0x18, 0xC0, 0x13, 0x1B, 0x27, 0x1B, 0x31, 0xC3, 0x27,
+        0x22, 0xC3, 0x1F, 0x41, 0x6E, 0x67, 0x08, 0x0D, 0x10, 0x08, 0x10, 0xC0, 0x08, 0x10, 0x9D, 0xDA,
+        0xC0, 0x6E, 0x6E, 0x19, 0x14, 0xC0, 0x0F, 0x6D, 0x0F, 0x19, 0xC1, 0x12, 0x0B, 0x36, 0xC0, 0x39,
+        0x0D, 0x1E, 0xC0, 0x19, 0x0D, 0x05, 0xC1, 0x0D, 0x1E, 0xC0, 0x19, 0x0D, 0x5A, 0xC5, 0x12, 0x1E,
+        0x19, 0x59, 0x0A, 0xC0, 0x0C, 0x0A, 0xC1, 0x0F, 0x12, 0x1E, 0x0F, 0x2A, 0x31, 0xCE, 0x2A, 0xC0,
+        0x31, 0xC0, 0x2A, 0x23, 0x2A, 0x31, 0x2A, 0xC0, 0x31, 0xC1, 0x2A, 0xC0, 0x23, 0xC0, 0x1C, 0xC1,
+        0x2A, 0x31, 0x2A, 0xC0, 0x31, 0xC1, 0x2A, 0x31, 0xC0, 0x2A, 0xC0, 0x31, 0x2A, 0x1C, 0x2A, 0xC2,
+        0x1E, 0x52, 0x12, 0x1C, 0x1E, 0x2A, 0xC2, 0x31, 0xC0, 0x2A, 0x1C, 0xC1, 0x5A, 0xC0, 0x66, 0xC1,
+        0x18, 0x69, 0x18, 0x1A, 0x11, 0x13, 0x11, 0x1B, 0x18, 0x31, 0xC3, 0x22, 0x27, 0x31, 0x2A, 0x31,
+        0x1F, 0x10, 0x08, 0x6E, 0x67, 0x08, 0x10, 0xC0, 0x0D, 0x08, 0x0F, 0xC1, 0x9F, 0xD8, 0xC1, 0x25,
+        0x65, 0x66, 0xC0, 0x65, 0x14, 0xC0, 0x25, 0x2A, 0x1E, 0x0A, 0x3E, 0x36, 0x00, 0x14, 0x25, 0xC0,
+        0x2A, 0x31, 0x2A, 0x1E, 0x61, 0x05, 0x0A, 0x12, 0xC1, 0x0A, 0xC3, 0x12, 0xC1, 0x1E, 0xC1, 0x19,
+        0x59, 0x0A, 0x6B, 0x0A, 0x0F, 0x12, 0x0F, 0x25, 0x2A, 0x1E, 0x2A, 0x31, 0xC6, 0x2A, 0x31, 0xC6,
+        0x2A, 0xC0, 0x31, 0x2A, 0xC0, 0x23, 0xC0, 0x2A, 0xC0, 0x31, 0xC0, 0x2A, 0xC1, 0x23, 0x1C, 0xC3,
+        0x23, 0x1C, 0xC0, 0x23, 0x2A, 0xC1, 0x31, 0xC1, 0x23, 0x2A, 0x23, 0xC1, 0x16, 0x05, 0x06, 0x9D,
+        0x89, 0x9D, 0x99, 0x28, 0x04, 0x0A, 0xA3, 0x89, 0x31, 0xC3, 0x2A, 0xC0, 0x23, 0x2A, 0x23, 0x2A,
+        0x23, 0x55, 0xC0, 0x1B, 0x18, 0x1F, 0x57, 0x13, 0x6D, 0x18, 0x11, 0x18, 0x2A, 0xC0, 0x31, 0xC1,
+        0x27, 0x2A, 0xC0, 0x27, 0x22, 0x1F, 0x45, 0x66, 0x6B, 0x08, 0xC0, 0x0F, 0x08, 0xC0, 0x0D, 0x08,
+        0xA0, 0x8A, 0xC0, 0x9E, 0xD7, 0xA2, 0x77, 0x66, 0x14, 0xC2, 0x0F, 0x14, 0xC0, 0x25, 0x2A, 0xC0,
+        0x9D, 0x99, 0x9D, 0x98, 0xC0, 0x05, 0x25, 0x6F, 0xC0, 0x2A, 0x31, 0xC0, 0x2A, 0xC0, 0x19, 0x65,
+        0xA2, 0x77, 0x12, 0xC0, 0x56, 0x12, 0x0A, 0x12, 0xC0, 0x6F, 0x12, 0xC0, 0x2A, 0xC0, 0x23, 0xC0,
+        0x1E, 0x55, 0xC0, 0x12, 0x0F, 0x1E, 0xC0, 0x31, 0xC0, 0x23, 0x31, 0xC3, 0x2A, 0x31, 0xC1, 0x23,
+        0x2A, 0x31, 0xC0, 0x2A, 0x31, 0xC2, 0x2A, 0x23, 0xC0, 0x2A, 0x23, 0xC0, 0x1C, 0x2A, 0x23, 0x2A,
+        0xC0, 0x23, 0xC0, 0x1C, 0xC1, 0x23, 0xC0, 0x1C, 0xC0, 0x23, 0xC1, 0x2A, 0x23, 0x1C, 0x23, 0xC0,
+        0x2A, 0xC0, 0x23, 0xC0, 0x1C, 0xC0, 0x15, 0x37, 0x61, 0x55, 0x9D, 0x99, 0x9B, 0x9A, 0xA7, 0x85,
+        0xA3, 0x88, 0x00, 0x25, 0x31, 0xC7, 0x2A, 0x31, 0x2A, 0x58, 0xC0, 0x66, 0x5A, 0x1F, 0xC0, 0x13,
+        0x10, 0xC1, 0x7E, 0xC0, 0x1B, 0x31, 0xC1, 0x2A, 0xC0, 0x22, 0xC1, 0x1F, 0x10, 0x57, 0x08, 0x7F,
+        0x59, 0x57, 0xC0, 0x08, 0xC0, 0x0C, 0x16, 0xC0, 0x9E, 0xD7, 0x6E, 0x6E, 0x0F, 0xC0, 0x69, 0x14,
+        0xC0, 0x6E, 0xC0, 0x2A, 0x31, 0xC0, 0x50, 0x3D, 0x65, 0x05, 0x2A, 0x6B, 0xC3, 0x2A, 0x25, 0xC0,
+        0x1E, 0xC0, 0x12, 0x56, 0x12, 0x0A, 0x12, 0xC0, 0x5A, 0x1E, 0x12, 0xC0, 0x2A, 0x31, 0x2A, 0xC0,
+        0x1E, 0xC0, 0x0F, 0x1E, 0xC1, 0x2A, 0x31, 0xC0, 0x2A, 0x31, 0xC3, 0x25, 0x66, 0x25, 0xC0, 0x1E,
+        0x23, 0x2A, 0xC0, 0x23, 0x25, 0xC0, 0x23, 0xC1, 0x1E, 0x23, 0x1C, 0xC2, 0x23, 0x1C, 0x23, 0x1C,
+        0xC2, 0x23, 0x1C, 0xC0, 0x23, 0x1C, 0xC1, 0x23, 0xC2, 0x1C, 0x23, 0xC0, 0x1C, 0xC3, 0x68, 0xC0,
+        0x2E, 0x1D, 0x9A, 0x9A, 0x56, 0x9D, 0x98, 0xA9, 0x85, 0x9E, 0x8B, 0xA2, 0x7B, 0x25, 0x6F, 0xCA,
+        0x69, 0x58, 0x66, 0x18, 0x1F, 0x18, 0x10, 0xC1, 0x17, 0x10, 0x11, 0x2A, 0x31, 0xC0, 0x2A, 0xC2,
+        0x31, 0xC0, 0x22, 0x1F, 0x0D, 0x1A, 0x10, 0x0D, 0xC0, 0x0C, 0xC0, 0x79, 0x0C, 0xC0, 0x7A, 0xA0,
+        0xC6, 0x67, 0xC0, 0x66, 0xC0, 0x0F, 0xC0, 0xA2, 0x77, 0xC2, 0x25, 0x2A, 0x19, 0x02, 0x3D, 0xA2,
+        0x88, 0x2A, 0x31, 0xC4, 0x25, 0x19, 0xC1, 0x12, 0x56, 0x12, 0x0A, 0x6E, 0xC0, 0x7E, 0xC0, 0x1E,
+        0xC0, 0x2A, 0x31, 0x2A, 0xC1, 0x25, 0x1E, 0x25, 0x2A, 0xC0, 0x31, 0xC6, 0x51, 0x61, 0x02, 0x3D,
+        0xC1, 0x17, 0x1C, 0x17, 0xC0, 0x03, 0x17, 0x69, 0x03, 0x10, 0x15, 0x1C, 0xC1, 0x15, 0xC0, 0x1C,
+        0xC1, 0x10, 0x03, 0xC0, 0x10, 0xC0, 0x1C, 0xC0, 0x23, 0x1C, 0x15, 0x0E, 0x63, 0x1C, 0x15, 0x1C,
+        0xC1, 0x10, 0xC0, 0x64, 0x0E, 0x15, 0xC0, 0x68, 0x0E, 0x65, 0x9D, 0xA8, 0x55, 0x04, 0x16, 0x6F,
+        0x9B, 0xAB, 0xA5, 0x7A, 0x23, 0x2A, 0x31, 0xC8, 0x2A, 0xC0, 0x58, 0x14, 0x18, 0xC0, 0x69, 0xC0,
+        0x13, 0x5B, 0x6B, 0x17, 0x69, 0x18, 0x7B, 0x27, 0xC0, 0x2A, 0xC0, 0x31, 0xC1, 0x22, 0xC0, 0x10,
+        0x1A, 0x18, 0x10, 0x66, 0x08, 0x5B, 0xC0, 0x6B, 0xC0, 0x79, 0x0D, 0x6B, 0x66, 0x67, 0xC0, 0x0F,
+        0xC0, 0x14, 0xC0, 0x6E, 0xC1, 0x6E, 0xC0, 0x05, 0x5A, 0xA2, 0x88, 0x2A, 0x31, 0xC4, 0x2A, 0x1E,
+        0xC0, 0x12, 0x0D, 0x5B, 0x0D, 0x0A, 0x11, 0x12, 0x5A, 0x1E, 0x2A, 0xC1, 0x31, 0xC0, 0x2A, 0xC3,
+        0x31, 0xC8, 0x11, 0x51, 0xC0, 0x11, 0x1D, 0x16, 0x1E, 0x1C, 0xC3, 0x0A, 0x05, 0x03, 0x15, 0xC0,
+        0x1C, 0xC0, 0x15, 0xC0, 0x1C, 0xC2, 0x66, 0xC1, 0x69, 0x15, 0x1C, 0xC1, 0x15, 0x65, 0x03, 0x10,
+        0x15, 0x1C, 0x15, 0x1C, 0x09, 0x0E, 0x64, 0x07, 0x15, 0x0E, 0x15, 0x1C, 0x0E, 0x3B, 0x66, 0x50,
+        0x3B, 0x9B, 0xA9, 0x9E, 0x8B, 0xA6, 0x78, 0x23, 0x31, 0xC8, 0x2A, 0x23, 0xC0, 0x2A, 0x59, 0x65,
+        0x5A, 0xC1, 0x18, 0x56, 0x6B, 0x10, 0x18, 0xC0, 0x22, 0x18, 0x7A, 0x2A, 0xC0, 0x31, 0xC2, 0x22,
+        0x49, 0x22, 0x27, 0x18, 0x10, 0xC0, 0x57, 0x13, 0xC1, 0x0F, 0x9F, 0xD7, 0x6F, 0x19, 0x62, 0x08,
+        0xC0, 0x0F, 0xC0, 0x14, 0xC1, 0x1E, 0x2A, 0x66, 0x51, 0x05, 0x16, 0x2A, 0xC0, 0x31, 0xC1, 0x2A,
+        0xC0, 0x1E, 0x65, 0xC0, 0x0D, 0x14, 0x6B, 0x0D, 0x12, 0xC2, 0x1E, 0xC1, 0x2A, 0x31, 0xC1, 0x2A,
+        0xC0, 0x31, 0x2A, 0x31, 0xC8, 0x05, 0x0A, 0x2A, 0x31, 0x2A, 0x23, 0xC0, 0x1C, 0xC2, 0x23, 0x31,
+        0xC1, 0x23, 0x1C, 0xC4, 0x23, 0xC1, 0x2A, 0xC0, 0x23, 0xC0, 0x1C, 0x69, 0xC0, 0x1C, 0xC0, 0x15,
+        0xC0, 0x1C, 0x15, 0x1C, 0xC2, 0x15, 0x0E, 0xC0, 0x65, 0xC0, 0x07, 0x1C, 0xC0, 0x07, 0x3B, 0xC0,
+        0x02, 0x98, 0xA9, 0xA2, 0x78, 0x09, 0x23, 0x31, 0xC7, 0x2A, 0xC0, 0x31, 0xC1, 0x54, 0x20, 0x65,
+        0x1B, 0x18, 0x69, 0x17, 0xC0, 0x18, 0xC0, 0x1B, 0x27, 0xC0, 0x22, 0x2A, 0x25, 0x31, 0xC3, 0x1F,
+        0x31, 0xC0, 0x22, 0x45, 0xC0, 0x0C, 0xC0, 0x13, 0xC0, 0x0C, 0x0F, 0x19, 0x66, 0x08, 0x0D, 0xC0,
+        0x0F, 0x6B, 0x0F, 0x0D, 0x25, 0x31, 0xC0, 0x25, 0x05, 0xC0, 0x1E, 0x31, 0x1E, 0x2A, 0x31, 0x2A,
+        0xC0, 0x1E, 0x12, 0xC9, 0x1E, 0xC0, 0x2A, 0x31, 0xCF, 0x2C, 0x05, 0x1E, 0x31, 0xC2, 0x2A, 0x1C,
+        0xC2, 0x23, 0xC0, 0x2A, 0xC0, 0x23, 0x2A, 0x23, 0x1C, 0xC2, 0x23, 0xC3, 0x1C, 0x23, 0xC1, 0x1C,
+        0xC1, 0x15, 0x1C, 0xC0, 0x15, 0x1C, 0xC1, 0x2A, 0xC0, 0x0E, 0x07, 0x36, 0x38, 0x0E, 0xC2, 0x1C,
+        0x23, 0x02, 0x64, 0x3B, 0x0E, 0x2A, 0x31, 0xC8, 0x2A, 0x31, 0xC0, 0x2A, 0xC0, 0x23, 0x20, 0x2A,
+        0x1B, 0x18, 0x9F, 0x8B, 0x17, 0x18, 0x1B, 0x27, 0x22, 0xC0, 0x1F, 0x22, 0x31, 0xC4, 0x22, 0x31,
+        0xC0, 0x27, 0x10, 0x46, 0xC0, 0x0C, 0x13, 0xC0, 0x0C, 0x08, 0x0F, 0x08, 0xC0, 0x0D, 0x0F, 0xC2,
+        0x19, 0x6E, 0x2A, 0x31, 0x25, 0x51, 0xC0, 0x1E, 0x31, 0x25, 0x1E, 0x2A, 0x25, 0x2A, 0x25, 0x68,
+        0x12, 0xC6, 0x5A, 0xC0, 0x1E, 0x2A, 0x31, 0xD0, 0x2A, 0x11, 0x23, 0x2A, 0x31, 0x2A, 0x23, 0x1C,
+        0xC2, 0x23, 0x2A, 0xC0, 0x23, 0x1C, 0xC0, 0x23, 0x1C, 0xC2, 0x23, 0xC0, 0x2A, 0xC0, 0x1C, 0xC1,
+        0x23, 0xC1, 0x1C, 0x15, 0x1C, 0x23, 0xC0, 0x15, 0x1C, 0xC2, 0x23, 0xC0, 0x15, 0xC0, 0x0E, 0xC1,
+        0x07, 0x1C, 0x15, 0x23, 0xC0, 0x15, 0x3B, 0x0E, 0x15, 0x2A, 0x31, 0xC0, 0x2A, 0x31, 0xC5, 0x2A,
+        0xC0, 0x31, 0x2A, 0xC1, 0x23, 0x55, 0xC0, 0x18, 0x10, 0xC1, 0x18, 0x1B, 0xC0, 0x18, 0xC0, 0x1F,
+        0x22, 0xC0, 0x27, 0x31, 0xC3, 0x5A, 0x1F, 0x10, 0x0C, 0x13, 0xC1, 0x0C, 0xC0, 0x9F, 0xE8, 0x66,
+        0x0F, 0xC1, 0x6E, 0x0D, 0xC1, 0x25, 0x31, 0x2A, 0x31, 0x25, 0x11, 0xC0, 0x25, 0x2A, 0x31, 0x19,
+        0x1E, 0xC1, 0x17, 0xC0, 0x12, 0x19, 0xC0, 0x12, 0xC1, 0x1E, 0x17, 0xC1, 0x1E, 0x2A, 0xC0, 0x31,
+        0xCE, 0x2A, 0xC0, 0x1E, 0x23, 0x2A, 0xC0, 0x1C, 0x23, 0xC2, 0x2A, 0x23, 0x2A, 0x31, 0x23, 0x1C,
+        0x23, 0xC0, 0x1C, 0xC3, 0x23, 0xC0, 0x1C, 0xC2, 0x15, 0x1C, 0xC0, 0x15, 0xC0, 0x1C, 0x31, 0x2A,
+        0x1C, 0x15, 0x1C, 0x23, 0x1C, 0xC2, 0x15, 0x23, 0x1C, 0x15, 0xC0, 0x1C, 0xC0, 0x23, 0x1C, 0x15,
+        0x1C, 0x15, 0x66, 0x23, 0x2A, 0xC0, 0x23, 0x2A, 0x31, 0xC5, 0x23, 0x2A, 0xC0, 0x31, 0xC0, 0x23,
+        0x20, 0xC0, 0x18, 0x69, 0x18, 0x1B, 0x18, 0xC1, 0x66, 0x18, 0x22, 0x27, 0xC0, 0x31, 0xC0, 0x2A,
+        0x25, 0x31, 0x22, 0x1F, 0x55, 0x6B, 0x56, 0x5B, 0x0C, 0xC2, 0x0A, 0x16, 0xC0, 0x69, 0x0D, 0xC1,
+        0x12, 0x19, 0xC0, 0x31, 0xC1, 0x25, 0x51, 0x6E, 0x25, 0x2A, 0x25, 0x19, 0x12, 0xC0, 0x19, 0x6D,
+        0xC0, 0x12, 0xC0, 0xA0, 0x8A, 0xC0, 0x12, 0xC0, 0x1E, 0xC2, 0x23, 0x2A, 0x31, 0xCB, 0x2A, 0xC0,
+        0x31, 0xC0, 0x2A, 0xC0, 0x1C, 0xC0, 0x23, 0xC0, 0x1C, 0x23, 0xC0, 0x1C, 0x23, 0x31, 0x2A, 0x1C,
+        0x23, 0xC0, 0x1C, 0xC4, 0x15, 0xC0, 0x23, 0x2A, 0x23, 0xC0, 0x1C, 0xC1, 0x2A, 0x23, 0xC0, 0x1C,
+        0xC0, 0x2A, 0xC0, 0x23, 0x1C, 0x15, 0x1C, 0x23, 0x1C, 0x15, 0x1C, 0x23, 0xC0, 0x1C, 0x0E, 0x07,
+        0x1C, 0x2A, 0x1C, 0x0E, 0xC0, 0x1C, 0xC0, 0x15, 0x1C, 0x2A, 0x31, 0x23, 0x2A, 0x31, 0xC5, 0x2A,
+        0x23, 0xC0, 0x2A, 0x59, 0x2A, 0xC0, 0x20, 0x18, 0x1B, 0xC1, 0x27, 0x1B, 0x18, 0x66, 0x18, 0x22,
+        0xC0, 0x2A, 0x31, 0x22, 0x1F, 0x31, 0xC1, 0x22, 0x1F, 0x10, 0x56, 0x0C, 0xC0, 0x6B, 0x0C, 0xC0,
+        0x9E, 0xE9, 0x6E, 0xC0, 0x0F, 0xC2, 0x14, 0x19, 0x12, 0x1E, 0x2A, 0x31, 0x25, 0x55, 0xC0, 0x2A,
+        0x31, 0x2A, 0x12, 0x19, 0x12, 0x17, 0xC0, 0x1E, 0xC0, 0x12, 0x19, 0xC0, 0x12, 0x17, 0x23, 0x25,
+        0x2A, 0xC0, 0x1E, 0x9D, 0x8B, 0x31, 0xCC, 0x2A, 0x23, 0x2A, 0x23, 0xC0, 0x1C, 0xC3, 0x15, 0x1C,
+        0x23, 0xC0, 0x2A, 0x31, 0x2A, 0x23, 0xC0, 0x1C, 0xC5, 0x15, 0xC0, 0x1C, 0xC3, 0x23, 0x1C, 0xC4,
+        0x23, 0x1C, 0xC0, 0x15, 0x1C, 0xC5, 0x15, 0xC2, 0x1C, 0x0E, 0x07, 0x1C, 0x23, 0x15, 0xC1, 0x2A,
+        0xC0, 0x1C, 0x23, 0x31, 0x2A, 0xC0, 0x31, 0xC0, 0x2A, 0xC0, 0x23, 0x20, 0x69, 0x20, 0x2A, 0x31,
+        0x2A, 0x1B, 0x20, 0x1B, 0xC2, 0x27, 0x31, 0x22, 0x45, 0x1F, 0x18, 0x22, 0x1F, 0x18, 0x31, 0xC2,
+        0x27, 0x10, 0x5A, 0x76, 0x5B, 0x13, 0xC0, 0x0C, 0x05, 0x9F, 0xEA, 0x69, 0xC1, 0x6D, 0x14, 0xC0,
+        0x6E, 0x25, 0x1E, 0xC0, 0x2A, 0x31, 0x2A, 0x19, 0x5A, 0x2A, 0x25, 0x1E, 0xC0, 0x12, 0xC0, 0x1E,
+        0x17, 0x1E, 0x17, 0x12, 0x17, 0xC2, 0x2A, 0x31, 0xC0, 0x2A, 0x95, 0x8E, 0x9A, 0x9B, 0x31, 0xC8,
+        0x2A, 0x31, 0xC1, 0x2A, 0x23, 0x1C, 0xC8, 0x23, 0x1C, 0xC0, 0x31, 0x2A, 0x1C, 0xC3, 0x15, 0x1C,
+        0xC2, 0x15, 0x1C, 0x15, 0x1C, 0xC2, 0x15, 0x1C, 0xC7, 0x15, 0xC0, 0x1C, 0xC0, 0x15, 0x0E, 0xC0,
+        0x15, 0x0E, 0x07, 0xC0, 0x3B, 0x07, 0x64, 0x0E, 0x15, 0x0E, 0x1C, 0x15, 0x1C, 0xC1, 0x23, 0xC1,
+        0x31, 0xC1, 0x2A, 0xC0, 0x23, 0x20, 0x69, 0x20, 0x2A, 0xC0, 0x23, 0x55, 0x20, 0x1B, 0xC1, 0x27,
+        0x2A, 0xC0, 0x27, 0x18, 0x10, 0xC2, 0x2E, 0x31, 0xC0, 0x2A, 0x31, 0x22, 0xC0, 0x27, 0x22, 0x08,
+        0x0C, 0xC2, 0x9F, 0xE9, 0xC0, 0x0D, 0xC2, 0x6F, 0x1E, 0x2A, 0x31, 0xC2, 0x2A, 0x19, 0x1E, 0xC1,
+        0x2A, 0xC0, 0x17, 0x12, 0x17, 0xC3, 0x23, 0x17, 0x23, 0x1E, 0x23, 0x31, 0xC1, 0xFE, 0x94, 0xFE,
+        0xA8, 0x94, 0x31, 0xC7, 0x23, 0x2A, 0x31, 0xC1, 0x23, 0xC0, 0x1C, 0xC2, 0x0E, 0x15, 0x1C, 0xC3,
+        0x15, 0x1C, 0x23, 0x1C, 0x15, 0xC0, 0x1C, 0xC2, 0x23, 0x1C, 0xC0, 0x23, 0x1C, 0xC0, 0x23, 0x2A,
+        0x23, 0x1C, 0xC1, 0x23, 0x1C, 0xC1, 0x23, 0x15, 0x1C, 0x23, 0x1C, 0xC1, 0x2A, 0xC0, 0x1C, 0xA0,
+        0x84, 0x3B, 0x15, 0x07, 0x3B, 0xC0, 0x9A, 0x99, 0xA4, 0x77, 0x34, 0x3B, 0x6B, 0x0E, 0x15, 0xC2,
+        0x1C, 0xC1, 0x23, 0x2A, 0xC0, 0x31, 0x2A, 0x1C, 0x23, 0xC0, 0x59, 0x20, 0x2A, 0xC0, 0x20, 0xC0,
+        0x1B, 0x18, 0x69, 0x20, 0x22, 0x6E, 0x20, 0x18, 0xC0, 0x10, 0x5B, 0xC0, 0x10, 0x22, 0x27, 0x22,
+        0x27, 0x31, 0xC1, 0x27, 0x18, 0x10, 0x57, 0xC0, 0x08, 0xC0, 0x9F, 0xD9, 0x69, 0x6F, 0xC0, 0x0D,
+        0x12, 0x6B, 0x2A, 0xC0, 0x31, 0xC3, 0x19, 0x1E, 0x2A, 0x31, 0x2A, 0x1E, 0xC0, 0x17, 0x12, 0xC0,
+        0x17, 0xC0, 0x1E, 0x23, 0x1E, 0x23, 0x2A, 0x23, 0x2A, 0x31, 0x2A, 0xFE, 0x8C, 0xBD, 0xAA, 0x94,
+        0x31, 0x2A, 0xC0, 0x31, 0xC0, 0x2A, 0x23, 0x31, 0x2A, 0x17, 0x2A, 0x31, 0xC0, 0x2A, 0x1C, 0x23,
+        0xC0, 0x1C, 0xC1, 0x0E, 0xC0, 0x15, 0x1C, 0x15, 0x1C, 0xC0, 0x15, 0xC1, 0x1C, 0x23, 0x1C, 0xC5,
+        0x23, 0xC0, 0x1C, 0xC0, 0x23, 0x2A, 0x23, 0x1C, 0xC0, 0x23, 0xC1, 0x1C, 0xC0, 0x2A, 0x1C, 0x15,
+        0x1C, 0xC0, 0x23, 0xC0, 0x31, 0xC0, 0x1C, 0x38, 0x59, 0x0E, 0x07, 0x3B, 0x9D, 0x99, 0x32, 0xA3,
+        0x86, 0x00, 0x9B, 0xAA, 0xC0, 0xA3, 0x8B, 0x9D, 0xAA, 0x9D, 0xAB, 0x9D, 0xA9, 0x62, 0x5A, 0x6E,
+        0xA2, 0x77, 0x3C, 0x17, 0x23, 0xC0, 0x1C, 0xC1, 0x23, 0xC0, 0x59, 0xC0, 0x66, 0xC0, 0x1B, 0x18,
+        0xC2, 0x1B, 0x18, 0x1B, 0xC0, 0x18, 0x10, 0x6B, 0x5A, 0x18, 0x27, 0xC0, 0x51, 0x27, 0x31, 0xC1,
+        0x1F, 0x18, 0x10, 0x56, 0xC2, 0x0D, 0xC0, 0xA2, 0x78, 0x25, 0x1E, 0x12, 0x1E, 0x31, 0xC4, 0x2A,
+        0x61, 0x1E, 0x31, 0x2A, 0x1E, 0x69, 0xC0, 0x19, 0x1E, 0x19, 0x1E, 0x17, 0xC2, 0x23, 0x2A, 0xC1,
+        0x31, 0x2A, 0xFE, 0x84, 0x9D, 0x02, 0x31, 0x2A, 0x23, 0xC0, 0x2A, 0xC0, 0x23, 0x57, 0x9D, 0x87,
+        0x55, 0x54, 0x55, 0x69, 0x13, 0x7B, 0xA4, 0x99, 0x1C, 0x15, 0x1C, 0xC0, 0x15, 0x0E, 0xC0, 0x1C,
+        0xC1, 0x23, 0xC0, 0x1C, 0xC0, 0x15, 0x23, 0x1C, 0x15, 0x1C, 0xC2, 0x23, 0xC0, 0x1C, 0x23, 0x1C,
+        0x23, 0xC0, 0x1C, 0xC2, 0x23, 0x2A, 0x23, 0x1C, 0xC1, 0x15, 0x1C, 0x2A, 0x31, 0xC2, 0x23, 0x9D,
+        0xA7, 0x2B, 0xA2, 0x77, 0x36, 0x66, 0x06, 0x9D, 0x89, 0xA4, 0x85, 0xA4, 0x88, 0x99, 0xCE, 0x9B,
+        0xBD, 0xA2, 0x78, 0xA2, 0x77, 0x6E, 0x20, 0xC0, 0x65, 0xC0, 0x66, 0x9D, 0xAA, 0x55, 0xA3, 0x78,
+        0xA4, 0x66, 0xA8, 0x46, 0x23, 0xC0, 0x1C, 0xC0, 0x23, 0x59, 0x6B, 0x7B, 0x20, 0x65, 0x6B, 0xC0,
+        0x59, 0xC0, 0x18, 0x1B, 0x18, 0x56, 0xC3, 0x22, 0x18, 0x1F, 0xA1, 0xA9, 0x27, 0x22, 0xC0, 0x1F,
+        0x10, 0x5A, 0x08, 0xC2, 0xA0, 0xC8, 0x6E, 0x6F, 0x2A, 0xC0, 0x25, 0xC0, 0x31, 0xC5, 0x25, 0x1E,
+        0x2A, 0xC0, 0x1E, 0x17, 0xC0, 0x1E, 0xC1, 0x17, 0xC0, 0x23, 0xC1, 0x2A, 0xC1, 0x31, 0xC0, 0x2A,
+        0xFE, 0x74, 0x1E, 0x02, 0x31, 0xC0, 0x2A, 0x23, 0x69, 0x9D, 0x8A, 0x9D, 0x88, 0x6D, 0xA2, 0x86,
+        0x9E, 0x86, 0x69, 0xC0, 0x6F, 0x7F, 0xC0, 0x9B, 0x89, 0xA4, 0x9A, 0x7F, 0x6B, 0x6B, 0xA3, 0x87,
+        0x78, 0x0E, 0x1C, 0xC0, 0x6B, 0x6B, 0x23, 0x1C, 0x15, 0xC0, 0x1C, 0xC0, 0x23, 0x1C, 0xC2, 0x2A,
+        0x31, 0x2A, 0xC0, 0x1C, 0xCB, 0x15, 0x23, 0x31, 0xC3, 0x1E, 0x9B, 0x98, 0x9D, 0x99, 0xA2, 0x86,
+        0x7E, 0x17, 0x66, 0x9A, 0xAA, 0x9E, 0xBB, 0x0F, 0xA4, 0x67, 0x6E, 0x2A, 0x69, 0x2A, 0x2F, 0xC0,
+        0x2A, 0x23, 0x66, 0xC1, 0x62, 0x9D, 0x99, 0x9B, 0xBB, 0xA2, 0x77, 0xA8, 0x45, 0xAA, 0x34, 0xC0,
+        0x98, 0x89, 0xA6, 0x88, 0xA3, 0x99, 0xC0, 0x20, 0x14, 0x6B, 0x20, 0x55, 0x18, 0x10, 0xC4, 0x7A,
+        0x10, 0xC1, 0x27, 0x2A, 0xC0, 0x27, 0x66, 0x5A, 0x56, 0x08, 0xC0, 0x0D, 0x67, 0x08, 0xA0, 0xC8,
+        0x19, 0xC0, 0x6E, 0x2A, 0xC1, 0x31, 0xC5, 0x25, 0x1E, 0x2A, 0x69, 0x1E, 0xC0, 0x69, 0xC4, 0x23,
+        0xC0, 0x2A, 0xC0, 0x23, 0x2A, 0x31, 0xC0, 0x66, 0xFE, 0x6B, 0xFD, 0x02, 0x31, 0xC1, 0x13, 0x9C,
+        0x76, 0x7D, 0xA2, 0x86, 0x55, 0x9C, 0x88, 0x45, 0x7A, 0x2A, 0xA3, 0x89, 0x7A, 0x06, 0x9C, 0x77,
+        0x50, 0xA5, 0x99, 0x21, 0xC0, 0x9D, 0x8A, 0x66, 0xA5, 0x97, 0x15, 0x1C, 0x23, 0xC1, 0x1C, 0x15,
+        0xC1, 0x23, 0x6B, 0x1C, 0xC0, 0x23, 0x15, 0x23, 0x31, 0x2A, 0x1C, 0xC0, 0x23, 0x1C, 0xC0, 0x23,
+        0x2A, 0x1C, 0xC6, 0x23, 0xC0, 0x2A, 0x31, 0xC1, 0x19, 0x9B, 0x98, 0x51, 0x7D, 0x56, 0x66, 0x9D,
+        0xCC, 0x9F, 0x9B, 0xA4, 0x76, 0x69, 0x2A, 0x65, 0xC2, 0x2A, 0x2F, 0x2A, 0xC1, 0x66, 0x65, 0xC0,
+        0x66, 0x9B, 0xAA, 0x61, 0x31, 0x99, 0xAA, 0xFE, 0xA5, 0x35, 0x98, 0x79, 0xB3, 0x96, 0xAB, 0x97,
+        0xC0, 0x6B, 0x23, 0x45, 0xC0, 0x6B, 0x66, 0x5A, 0xC5, 0x5B, 0xC0, 0x69, 0x7E, 0x1F, 0x27, 0x7B,
+        0x22, 0x1F, 0x56, 0x10, 0x08, 0xC0, 0x5B, 0xC0, 0xA0, 0xD6, 0x6F, 0x6E, 0x2A, 0x31, 0xC8, 0x2A,
+        0x23, 0x2A, 0x31, 0xC0, 0x23, 0x64, 0x6B, 0xC1, 0x1E, 0x23, 0x17, 0x23, 0x2A, 0xC0, 0x23, 0x2A,
+        0x31, 0xC0, 0x56, 0xFE, 0x74, 0x1D, 0xB1, 0x91, 0x31, 0x2C, 0x9A, 0x66, 0x9F, 0x85, 0xA2, 0x96,
+        0x9B, 0x78, 0x41, 0x67, 0xA3, 0x88, 0x7F, 0x66, 0x55, 0x7E, 0xA7, 0x98, 0x9D, 0x97, 0x9C, 0x78,
+        0xA3, 0x98, 0x2B, 0x12, 0x66, 0x55, 0xA2, 0x87, 0x9C, 0x8A, 0xA1, 0x9A, 0xA7, 0xA9, 0x23, 0xC1,
+        0x69, 0x15, 0x1C, 0xC0, 0x23, 0xC0, 0x1C, 0xC0, 0x23, 0x15, 0x23, 0xA0, 0x8A, 0x23, 0x1C, 0x2A,
+        0xC0, 0x23, 0xC2, 0x2A, 0x23, 0xC0, 0x1C, 0xC2, 0x23, 0x2A, 0x31, 0xC3, 0x61, 0x9B, 0x97, 0x9D,
+        0x99, 0x05, 0x67, 0x9C, 0xCC, 0xA3, 0x78, 0x9C, 0xA9, 0xA4, 0x76, 0x6E, 0xC0, 0x19, 0x1E, 0xC0,
+        0x6F, 0x1E, 0xC3, 0x6B, 0x1E, 0x19, 0x66, 0x69, 0x67, 0x99, 0xBA, 0x9C, 0x67, 0x9C, 0x06, 0x9C,
+        0x89, 0xA8, 0x86, 0xB9, 0x97, 0xC1, 0x27, 0x64, 0x5B, 0xC0, 0x67, 0x5A, 0x69, 0x18, 0x10, 0xC2,
+        0x5B, 0x67, 0x69, 0x18, 0x2A, 0x27, 0x22, 0x27, 0x1F, 0x10, 0xC0, 0x08, 0x5B, 0x6B, 0x0C, 0xA0,
+        0xD6, 0x6F, 0x6E, 0xC0, 0x2A, 0x31, 0xC7, 0x2A, 0x23, 0xC0, 0x2A, 0xC0, 0x64, 0x69, 0x17, 0xC0,
+        0x10, 0x17, 0xC1, 0x23, 0xC0, 0x2A, 0xC1, 0x31, 0xC0, 0x9D, 0x89, 0xFE, 0x74, 0x3D, 0xB0, 0xA1,
+        0x22, 0x95, 0x66, 0xA3, 0x94, 0x9D, 0x88, 0x42, 0xA7, 0xB8, 0xA4, 0x88, 0x21, 0x12, 0x66, 0x7E,
+        0x1A, 0x21, 0x9C, 0x88, 0x9F, 0x96, 0x46, 0x7A, 0xA3, 0x89, 0xA0, 0x8A, 0x3E, 0x12, 0x39, 0x44,
+        0xA3, 0x99, 0x9C, 0x8C, 0xA8, 0xA8, 0x1C, 0xC4, 0x23, 0x1C, 0xC3, 0x2A, 0xC0, 0x23, 0x2A, 0x31,
+        0x2A, 0xC2, 0x23, 0x2A, 0xC0, 0x23, 0x1C, 0x2A, 0x23, 0xC2, 0x31, 0xC3, 0x19, 0x9A, 0x98, 0x51,
+        0x66, 0x9D, 0xCC, 0x72, 0x9D, 0x9A, 0xA8, 0x54, 0xC2, 0x66, 0xC1, 0x1E, 0xC2, 0x19, 0xC2, 0x1E,
+        0x19, 0x66, 0xC0, 0x5E, 0x0C, 0x92, 0xAA, 0xA2, 0x04, 0xFE, 0xC4, 0x14, 0xB5, 0x46, 0xA9, 0x56,
+        0x31, 0x23, 0x55, 0x18, 0x67, 0xC0, 0x59, 0x7A, 0x18, 0x10, 0xC2, 0x5B, 0x66, 0x6D, 0x10, 0xC0,
+        0x7F, 0x18, 0x22, 0x1F, 0x10, 0xC0, 0x08, 0xA0, 0x7A, 0xC1, 0xA1, 0xD6, 0x6E, 0xC0, 0x2A, 0x31,
+        0xC8, 0x2A, 0xC0, 0x23, 0x1E, 0x2A, 0x64, 0x23, 0xC0, 0x17, 0xC0, 0x1C, 0xC3, 0x23, 0xC0, 0x2A,
+        0x31, 0xC0, 0x9B, 0x9A, 0xFE, 0x7C, 0x5D, 0xAF, 0xA2, 0xFE, 0xAE, 0x55, 0xA4, 0xA4, 0x9A, 0x69,
+        0xA7, 0xA8, 0x21, 0x3E, 0xC1, 0x12, 0x15, 0x6E, 0xC0, 0x12, 0x9C, 0x86, 0xC1, 0x69, 0xA3, 0x9B,
+        0x21, 0x12, 0x9B, 0x89, 0x59, 0xA5, 0xB9, 0x39, 0x45, 0x9F, 0x9B, 0xA8, 0xAA, 0x7F, 0x69, 0xC0,
+        0x69, 0x1C, 0x15, 0x23, 0xC0, 0x1C, 0x23, 0x1C, 0x23, 0x9D, 0x9C, 0x31, 0xC6, 0x69, 0x23, 0xC0,
+        0x2A, 0x31, 0x23, 0x2A, 0xC0, 0x23, 0x2A, 0x31, 0xC2, 0x19, 0x9B, 0x98, 0x9D, 0x99, 0x1D, 0x9D,
+        0xB9, 0x9B, 0xAA, 0xA9, 0x55, 0xC2, 0x66, 0xC1, 0x1E, 0xC1, 0x19, 0x1E, 0x19, 0xC0, 0x66, 0x19,
+        0xC1, 0x14, 0x19, 0x2F, 0xA5, 0x68, 0x9D, 0xA9, 0xFE, 0xE4, 0x77, 0xAD, 0x46, 0x98, 0xCA, 0x02,
+        0x2A, 0x55, 0x69, 0x5B, 0x66, 0x5B, 0x10, 0x7D, 0x10, 0x18, 0x10, 0xC1, 0x67, 0x0D, 0x10, 0x18,
+        0x6B, 0x13, 0x7F, 0x1F, 0xC0, 0x18, 0x10, 0x57, 0x5A, 0xC0, 0x6B, 0xA2, 0xC5, 0x6B, 0xC0, 0x31,
+        0xC7, 0x2A, 0xC0, 0x23, 0x2A, 0xC0, 0x64, 0xC1, 0x1C, 0xC0, 0x17, 0xC0, 0x1E, 0x17, 0x1C, 0x23,
+        0xC0, 0x2A, 0x23, 0x2A, 0x31, 0xC0, 0x9A, 0x8A, 0xFE, 0x74, 0x1D, 0xA5, 0x61, 0xFE, 0xCE, 0xD3,
+        0x99, 0x6A, 0xAA, 0xB8, 0x6E, 0x9D, 0x88, 0xA4, 0x88, 0x1A, 0xC4, 0x66, 0x2B, 0x9D, 0x88, 0x7F,
+        0x6E, 0x1A, 0xC1, 0x65, 0x5A, 0x99, 0x8A, 0xA2, 0x87, 0x12, 0x9B, 0x8A, 0xA0, 0x8B, 0xA8, 0xA9,
+        0x23, 0x69, 0xC2, 0x23, 0xC0, 0x1C, 0x23, 0xC0, 0x9B, 0x9C, 0xFE, 0x94, 0xDE, 0xFE, 0xFF, 0xFE,
+        0x31, 0xC5, 0x2A, 0xC0, 0x31, 0x2A, 0xC1, 0x31, 0xC0, 0x2A, 0x23, 0x31, 0xC2, 0x25, 0x9A, 0x97,
+        0x9F, 0xAB, 0x9D, 0xBA, 0x94, 0xDB, 0xAB, 0x46, 0x6D, 0xC1, 0x19, 0x1E, 0x19, 0x1E, 0x25, 0x19,
+        0x1E, 0x19, 0x1E, 0x6F, 0x19, 0xC2, 0x2A, 0x25, 0x51, 0xA8, 0x56, 0xA4, 0x67, 0x66, 0x9A, 0xBA,
+        0xFE, 0xF4, 0x98, 0xAD, 0x35, 0x98, 0xBA, 0xA5, 0x67, 0xB0, 0x13, 0x5F, 0x1B, 0x18, 0xC1, 0x69,
+        0x10, 0x18, 0x10, 0xC0, 0x6B, 0x10, 0xC1, 0x18, 0x27, 0x7A, 0x22, 0x1F, 0x10, 0xC0, 0x5A, 0x10,
+        0xC0, 0x57, 0x0C, 0xA1, 0xD6, 0x1E, 0x2A, 0xC0, 0x6B, 0xC6, 0x2A, 0x23, 0x65, 0xC0, 0x1E, 0x17,
+        0x1E, 0xC0, 0x17, 0x1C, 0x69, 0x1C, 0xC2, 0x23, 0x2A, 0xC2, 0x31, 0x2A, 0x98, 0x8C, 0xFE, 0x63,
+        0xFD, 0xFE, 0x9D, 0x59, 0xFE, 0x9D, 0xF0, 0xAB, 0xB9, 0x55, 0x39, 0x1A, 0x21, 0xC0, 0x1A, 0xC1,
+        0x56, 0x9D, 0x89, 0x32, 0x9E, 0x86, 0x42, 0xA3, 0x98, 0xC0, 0xA4, 0x9A, 0x1A, 0x15, 0x69, 0xC1,
+        0x3E, 0x99, 0x79, 0xA8, 0xA7, 0x29, 0xA2, 0x8B, 0x2A, 0x23, 0x69, 0xC4, 0x2A, 0xC0, 0xFE, 0xAD,
+        0x7E, 0xC0, 0x31, 0xCA, 0x2A, 0x31, 0xC2, 0x2A, 0x31, 0xC2, 0x25, 0x9C, 0x98, 0x73, 0xFE, 0xFD,
+        0x39, 0xA8, 0x46, 0xA2, 0x77, 0x6E, 0x19, 0x1E, 0xC0, 0x6B, 0x19, 0xC1, 0x66, 0x1E, 0x19, 0xC0,
+        0x1E, 0xC0, 0x14, 0x2F, 0x00, 0xA2, 0x77, 0x66, 0x98, 0xBA, 0xA7, 0x57, 0xA6, 0x66, 0x2C, 0x9D,
+        0xA9, 0x99, 0xB9, 0xFE, 0xF4, 0x37, 0xAC, 0x34, 0x98, 0xBB, 0x1D, 0xAB, 0x34, 0xC0, 0x6E, 0x1B,
+        0x20, 0x11, 0xC0, 0x57, 0x6B, 0xC1, 0x10, 0xC1, 0x18, 0x22, 0x2A, 0x27, 0x1F, 0x10, 0x5A, 0x17,
+        0x1F, 0x10, 0x56, 0x5B, 0xA1, 0xD6, 0x6F, 0x2A, 0xC0, 0x31, 0xC6, 0x2A, 0x31, 0x23, 0xC0, 0x65,
+        0x1E, 0x25, 0xC0, 0x1C, 0x69, 0x1C, 0xC0, 0x15, 0x1C, 0xC3, 0x23, 0xC0, 0x2A, 0xC0, 0x96, 0x8C,
+        0xFE, 0x63, 0xDC, 0xA4, 0x71, 0xFE, 0xD7, 0x17, 0x6D, 0xA2, 0x9A, 0xA2, 0x99, 0xA0, 0x75, 0x6B,
+        0x1A, 0xC0, 0x99, 0x8A, 0x9B, 0x78, 0x38, 0xA3, 0x98, 0x6B, 0x54, 0x66, 0xA2, 0x87, 0x67, 0xA7,
+        0x89, 0x1A, 0x0E, 0xC2, 0x1A, 0x56, 0x95, 0x7A, 0xA7, 0xA6, 0x9D, 0x7C, 0xA7, 0xBC, 0xA4, 0x97,
+        0x1C, 0x23, 0x6B, 0x23, 0xC0, 0x1C, 0x23, 0x97, 0x8E, 0xFE, 0x7C, 0x5E, 0x03, 0x2A, 0x31, 0xD3,
+        0x25, 0x16, 0x9A, 0xB9, 0x91, 0xFD, 0xAD, 0x34, 0xC0, 0x56, 0x7A, 0x19, 0x2A, 0xC0, 0x65, 0xC0,
+        0x19, 0x61, 0x19, 0xC3, 0x1E, 0x2A, 0x0A, 0xA3, 0x78, 0xC0, 0x9B, 0xBA, 0x94, 0xDB, 0x16, 0xA3,
+        0x78, 0x61, 0x2A, 0x9A, 0xA9, 0xFE, 0xF4, 0x18, 0xAF, 0x22, 0xFE, 0xF3, 0xD7, 0xFE, 0xF7, 0x9D,
+        0xA3, 0x88, 0x31, 0x64, 0x5A, 0x59, 0xC0, 0x10, 0xA0, 0x8A, 0xC0, 0x59, 0x10, 0x18, 0xC0, 0x31,
+        0xC2, 0x1F, 0x18, 0x5A, 0x1F, 0x7A, 0x10, 0x56, 0x6B, 0xA1, 0xC7, 0x6E, 0xC0, 0x25, 0x31, 0xC5,
+        0x2A, 0xC0, 0x31, 0x2A, 0x23, 0x1C, 0x66, 0x25, 0x23, 0x1E, 0x17, 0x1E, 0xC0, 0x1C, 0x23, 0x1C,
+        0xC3, 0x23, 0xC0, 0x54, 0x89, 0x6F, 0xFE, 0x5B, 0xDA, 0xFE, 0xAE, 0x34, 0xAB, 0xBA, 0x56, 0x1B,
+        0x69, 0x1B, 0x65, 0x9F, 0x75, 0x96, 0x68, 0xA5, 0xB9, 0xA4, 0x87, 0x12, 0x1A, 0x21, 0xC0, 0x51,
+        0x06, 0x54, 0x9B, 0x8A, 0x5B, 0xA6, 0x97, 0x0E, 0x6E, 0x0E, 0x1A, 0x13, 0x63, 0x94, 0x48, 0xA9,
+        0xB6, 0x9D, 0x8E, 0xAB, 0xB9, 0x2A, 0x31, 0xC0, 0x68, 0x31, 0x2A, 0x14, 0xFE, 0x8C, 0xBE, 0xA5,
+        0x96, 0x31, 0xC4, 0x2A, 0xC0, 0x31, 0xC1, 0x2A, 0xC0, 0x31, 0xC0, 0x2A, 0xC0, 0x31, 0xC1, 0x2A,
+        0x23, 0x2A, 0x25, 0x0A, 0x92, 0xEC, 0x6E, 0xA6, 0x66, 0xC0, 0x9B, 0xAB, 0x2F, 0xC0, 0x0A, 0x66,
+        0x61, 0x9D, 0xAA, 0x19, 0x9C, 0xA9, 0x19, 0x34, 0x62, 0x65, 0x19, 0x1E, 0x34, 0x16, 0x6E, 0xA2,
+        0x78, 0x16, 0x96, 0xC9, 0x99, 0xCB, 0xB2, 0x04, 0x9D, 0xA9, 0x98, 0xC9, 0x3E, 0x9B, 0xAA, 0x9C,
+        0xA9, 0xA6, 0x57, 0x66, 0xFE, 0xFF, 0xFF, 0xC0, 0x69, 0xC0, 0x55, 0x18, 0x57, 0xC0, 0x6B, 0x17,
+        0x69, 0x18, 0xC0, 0x31, 0xC0, 0x59, 0x22, 0x27, 0x22, 0xC0, 0x55, 0x10, 0x1F, 0x10, 0x56, 0xA2,
+        0xB7, 0x2A, 0x1E, 0x2A, 0x31, 0xC3, 0x2A, 0xC0, 0x23, 0x2A, 0xC0, 0x23, 0x1C, 0xC0, 0x66, 0x1C,
+        0xC1, 0x17, 0x1C, 0x23, 0xC0, 0x1C, 0xC1, 0x2A, 0xC0, 0x1C, 0x69, 0x1C, 0x94, 0x57, 0x98, 0x9F,
+        0x9B, 0x56, 0xB6, 0xD5, 0x5B, 0x1B, 0x7B, 0x1E, 0x1B, 0x9E, 0x86, 0x95, 0x66, 0xA9, 0xAA, 0xA3,
+        0x9A, 0x9F, 0x96, 0x6E, 0x1A, 0xC0, 0x6F, 0x30, 0x65, 0x1A, 0xC0, 0x9D, 0x88, 0x99, 0x78, 0xA4,
+        0x9A, 0xA6, 0x86, 0x1A, 0xC1, 0x55, 0x01, 0x95, 0x58, 0xA9, 0xBA, 0xA2, 0x9D, 0xA6, 0x99, 0xC1,
+        0x69, 0x31, 0x2A, 0x91, 0x9F, 0xFE, 0x6B, 0xFD, 0xFE, 0xE7, 0x5E, 0x31, 0xC4, 0x23, 0xC1, 0x2A,
+        0x31, 0x2A, 0xC0, 0x31, 0x2A, 0x23, 0x2A, 0x31, 0xC1, 0x2A, 0x23, 0x1C, 0x9E, 0x9B, 0x2F, 0xFE,
+        0xF4, 0xB8, 0x19, 0x2F, 0xC0, 0x3D, 0x0A, 0xC0, 0x20, 0x16, 0xC0, 0x96, 0xCA, 0xA4, 0x76, 0x97,
+        0xDC, 0xA9, 0x46, 0x0A, 0x66, 0x34, 0x66, 0x2A, 0xA2, 0x67, 0xA5, 0x78, 0xC0, 0x20, 0x0A, 0x19,
+        0x91, 0xFC, 0x3E, 0xA3, 0x78, 0x61, 0x3E, 0xC0, 0x91, 0xFD, 0xAE, 0x24, 0x1B, 0xFE, 0xFF, 0x9E,
+        0xA3, 0x78, 0x69, 0x59, 0xC0, 0x18, 0x56, 0x6B, 0x10, 0x17, 0x10, 0x18, 0xC0, 0x7B, 0x27, 0x22,
+        0x31, 0xC0, 0x22, 0xC0, 0x31, 0x22, 0x1F, 0x10, 0x56, 0xA1, 0xC7, 0x1E, 0x12, 0x2A, 0xC2, 0x31,
+        0xC0, 0x2A, 0xC2, 0x69, 0x1C, 0x66, 0x1C, 0xC1, 0x15, 0xC1, 0x1C, 0x2A, 0x31, 0x2A, 0x1C, 0xC0,
+        0x23, 0xC0, 0x1C, 0xC0, 0x9B, 0x89, 0x98, 0x64, 0x9D, 0x8B, 0xA5, 0x98, 0x0F, 0x6F, 0x1E, 0x1B,
+        0x1E, 0x44, 0x93, 0x65, 0xAA, 0xBA, 0x0F, 0x6E, 0x69, 0x50, 0x28, 0xC0, 0x21, 0x7B, 0x6D, 0x1A,
+        0x66, 0x6D, 0x06, 0x98, 0x77, 0xA2, 0x8A, 0x1A, 0xC1, 0x13, 0x55, 0x96, 0x7A, 0xA4, 0x87, 0x9F,
+        0x9D, 0x31, 0xC2, 0x2A, 0x9D, 0x8A, 0xFE, 0x73, 0xFD, 0xAA, 0x94, 0x31, 0xC5, 0x68, 0xC4, 0x2A,
+        0x23, 0x69, 0x2A, 0x31, 0xC3, 0x2A, 0x25, 0x66, 0x98, 0xCA, 0xFE, 0xFC, 0x59, 0x34, 0xA5, 0x68,
+        0x51, 0x02, 0x20, 0x1B, 0xA2, 0x78, 0x20, 0xC0, 0x93, 0xEC, 0xA3, 0x88, 0x96, 0xCA, 0x34, 0x1B,
+        0xC0, 0x0A, 0xC1, 0x9A, 0xAA, 0xC0, 0xA7, 0x67, 0x0A, 0x34, 0x9B, 0xBA, 0x39, 0x94, 0xDB, 0xAD,
+        0x25, 0x3E, 0xC1, 0x9B, 0xAA, 0x9D, 0xA9, 0xA4, 0x67, 0xA3, 0x78, 0xB1, 0x03, 0x7B, 0xC0, 0x55,
+        0x18, 0xC0, 0x56, 0x69, 0xA0, 0x8A, 0x10, 0xC0, 0x18, 0x7B, 0x2A, 0x22, 0x31, 0x27, 0x18, 0x27,
+        0x31, 0x27, 0x1F, 0x08, 0xC0, 0xA2, 0xB7, 0x12, 0xC0, 0x1E, 0x6B, 0x2A, 0xC1, 0x1E, 0xC0, 0x69,
+        0x1E, 0x23, 0x1C, 0xC0, 0x17, 0x1C, 0xC2, 0x69, 0x1C, 0x23, 0x2A, 0xC0, 0x23, 0x1C, 0xC0, 0x23,
+        0xC1, 0x1C, 0x92, 0x57, 0xA6, 0xA4, 0x96, 0x5A, 0xAE, 0xB9, 0xA1, 0x9B, 0xA2, 0x88, 0xC0, 0x1B,
+        0x14, 0x93, 0x66, 0xA7, 0xA7, 0xA5, 0x9C, 0x1B, 0x14, 0x50, 0xC0, 0x6E, 0x6F, 0x23, 0xA2, 0x88,
+        0x3E, 0x30, 0x51, 0x69, 0x13, 0x51, 0x97, 0x78, 0xA5, 0xAB, 0x1A, 0xC0, 0x65, 0x04, 0x3F, 0x91,
+        0x6A, 0xAA, 0x98, 0xA5, 0xAF, 0x31, 0xC2, 0xFE, 0x9D, 0x3E, 0x91, 0x8F, 0xFE, 0xE7, 0x5E, 0x31,
+        0xC5, 0x2A, 0x68, 0x2A, 0x69, 0x68, 0x1C, 0xC1, 0x23, 0x31, 0xC0, 0x2A, 0xC0, 0x31, 0xC0, 0x2A,
+        0x62, 0xC0, 0x99, 0xCA, 0xFE, 0xF3, 0xD9, 0xFE, 0xF7, 0x5D, 0xA4, 0x78, 0x61, 0x02, 0x20, 0xC0,
+        0x2C, 0x1B, 0xC0, 0x99, 0xCA, 0x96, 0xDB, 0x56, 0xAB, 0x45, 0x1B, 0x20, 0x1B, 0x16, 0x1B, 0x9C,
+        0xA9, 0x99, 0xCA, 0x02, 0xA6, 0x56, 0x9D, 0xB9, 0x03, 0x66, 0x94, 0xDB, 0xA9, 0x46, 0x3E, 0xC2,
+        0x90, 0xFE, 0x03, 0x94, 0xDD, 0xFE, 0xF7, 0xBE, 0xA2, 0x87, 0xC0, 0x59, 0x6B, 0x65, 0x11, 0x67,
+        0x10, 0xC0, 0x09, 0x13, 0x6E, 0x7B, 0x18, 0x27, 0x52, 0x6E, 0x22, 0x1F, 0x1A, 0x10, 0x5A, 0x67,
+        0x12, 0x6B, 0xC0, 0x12, 0x1E, 0x2A, 0xC0, 0x31, 0x2A, 0x1E, 0xC1, 0x23, 0xC0, 0x15, 0x1C, 0xC1,
+        0x23, 0xC0, 0x1C, 0xC1, 0x23, 0x1C, 0xC2, 0x15, 0x1C, 0xC0, 0x9C, 0x78, 0x98, 0x64, 0x69, 0xA1,
+        0x8A, 0xA3, 0xA9, 0x21, 0xA1, 0x9A, 0x6B, 0x7F, 0x96, 0x68, 0xA1, 0x83, 0x39, 0x1B, 0x69, 0x65,
+        0x9A, 0x69, 0x14, 0x55, 0x14, 0x9D, 0x87, 0x05, 0x14, 0x69, 0x28, 0x6E, 0x37, 0x9F, 0x85, 0x9D,
+        0x98, 0x95, 0x59, 0xAC, 0xBA, 0x7C, 0x0E, 0x04, 0x69, 0x92, 0x7B, 0xA9, 0x97, 0x9E, 0x8E, 0xAB,
+        0xBB, 0xC1, 0x97, 0x9C, 0xFE, 0x4B, 0x3D, 0xB0, 0xB0, 0xFE, 0xFF, 0xFE, 0x6B, 0xC5, 0x2A, 0x15,
+        0xA0, 0x8A, 0xC0, 0x15, 0x1C, 0xC1, 0x23, 0xC1, 0x1C, 0x2A, 0x31, 0xC0, 0x23, 0x16, 0xA2, 0x77,
+        0x34, 0xFE, 0xF3, 0x18, 0xFE, 0xFF, 0x5D, 0x2C, 0x61, 0x91, 0xFD, 0x00, 0x20, 0xC0, 0x61, 0x62,
+        0x2F, 0xFE, 0xF4, 0x79, 0xA8, 0x45, 0xA4, 0x76, 0x0A, 0x20, 0xC0, 0x1B, 0x16, 0x0A, 0x99, 0xCA,
+        0x99, 0xBB, 0x9B, 0xBA, 0xA9, 0x55, 0xC0, 0x3E, 0x25, 0x97, 0xEC, 0x3E, 0xC0, 0x9D, 0x88, 0x9D,
+        0x78, 0xFE, 0xF4, 0x58, 0xAC, 0x34, 0x36, 0x62, 0x31, 0x2A, 0xC0, 0x55, 0xC0, 0x11, 0x5B, 0x10,
+        0xC1, 0x7A, 0x10, 0xC3, 0xA2, 0x99, 0x31, 0xC1, 0x1F, 0x10, 0x57, 0x17, 0x67, 0xC0, 0x17, 0x1E,
+        0xC1, 0x23, 0x2A, 0x23, 0xC2, 0x1C, 0xC1, 0x69, 0x1C, 0xC2, 0x23, 0x1C, 0xC2, 0x23, 0xC0, 0x1C,
+        0xC1, 0x96, 0x67, 0xA3, 0x94, 0x95, 0x6A, 0xAC, 0xA8, 0x65, 0xA4, 0x88, 0x21, 0x28, 0x9C, 0x87,
+        0x99, 0x67, 0x06, 0xA3, 0x9D, 0x08, 0x59, 0x9A, 0x77, 0xA5, 0x9B, 0xA2, 0x98, 0x1B, 0x14, 0x50,
+        0xA1, 0x9A, 0x1B, 0x14, 0x30, 0x05, 0x7E, 0x30, 0x06, 0x9B, 0x86, 0x9A, 0x6C, 0x04, 0xC0, 0x1A,
+        0x6B, 0x99, 0x77, 0x9A, 0x77, 0xA2, 0x9B, 0xAD, 0xCF, 0x2A, 0x22, 0xFE, 0x7C, 0x1D, 0x94, 0x7D,
+        0xFE, 0xEF, 0x7E, 0x2A, 0x31, 0xC0, 0x2A, 0x1C, 0x2A, 0xC0, 0x23, 0x1C, 0x15, 0x1C, 0x15, 0xC0,
+        0x23, 0xC0, 0x15, 0xC0, 0x23, 0x1C, 0x23, 0xC0, 0x2A, 0x23, 0x1E, 0x9C, 0xAB, 0x20, 0x9A, 0xBA,
+        0x3A, 0x2F, 0xA6, 0x57, 0x9C, 0xA9, 0x36, 0x63, 0x16, 0x00, 0x65, 0x2F, 0x9D, 0xA9, 0x90, 0xFE,
+        0x36, 0x94, 0xEC, 0xB3, 0x03, 0x11, 0x65, 0x0A, 0x52, 0x34, 0x9B, 0xAA, 0x97, 0xDC, 0x9C, 0xA9,
+        0xA4, 0x66, 0x7A, 0xA2, 0x77, 0xA2, 0x77, 0x93, 0xED, 0xAE, 0x13, 0x96, 0x67, 0x7B, 0x36, 0x16,
+        0x23, 0x03, 0x2C, 0xFE, 0xF6, 0xFD, 0xA8, 0x55, 0x55, 0xC1, 0x59, 0x6B, 0x56, 0x09, 0x18, 0x1B,
+        0xC0, 0x10, 0x5B, 0x66, 0x10, 0x18, 0x22, 0x31, 0x59, 0x13, 0x10, 0x56, 0xA1, 0xC8, 0x1E, 0xC1,
+        0x2A, 0x31, 0xC0, 0x2A, 0x31, 0x2A, 0x69, 0x2A, 0x23, 0xC0, 0x1C, 0xC1, 0x15, 0x1C, 0xC0, 0x23,
+        0xC0, 0x1C, 0x23, 0xC0, 0x1C, 0x23, 0x2A, 0x23, 0x1C, 0xC0, 0x92, 0x56, 0xA6, 0x94, 0x98, 0x6B,
+        0xA7, 0xA7, 0x1A, 0x21, 0xC0, 0x65, 0x93, 0x69, 0x2B, 0x28, 0xA1, 0x9A, 0x37, 0x28, 0x39, 0xAD,
+        0xBB, 0x0D, 0x67, 0x14, 0x9B, 0x77, 0xA2, 0x9A, 0x14, 0x0D, 0x28, 0xA2, 0x9C, 0x14, 0x3E, 0x99,
+        0x75, 0xA4, 0x96, 0x91, 0x69, 0xAF, 0xB9, 0x0E, 0x28, 0x37, 0x28, 0x8D, 0x66, 0xA8, 0x97, 0xFE,
+        0xE7, 0x5B, 0x23, 0xFE, 0xBD, 0xFD, 0xFE, 0x3A, 0xDC, 0xFE, 0xA5, 0x5D, 0x23, 0x69, 0x23, 0x31,
+        0x23, 0x68, 0x23, 0x2A, 0x1C, 0x15, 0x1C, 0x23, 0x1C, 0x23, 0xC0, 0x1C, 0xC0, 0x15, 0x1C, 0xC0,
+        0x2A, 0x23, 0xC0, 0x1C, 0x9C, 0xAB, 0x00, 0xA4, 0x67, 0x9C, 0xA8, 0xFE, 0xF4, 0x38, 0xAB, 0x35,
+        0xA9, 0x55, 0x62, 0x66, 0xFE, 0xF3, 0x58, 0xFE, 0xFE, 0xBC, 0x23, 0x66, 0x9D, 0x9A, 0x36, 0x9C,
+        0xAA, 0x27, 0xC0, 0x2C, 0x23, 0x19, 0x14, 0x19, 0x61, 0x67, 0x27, 0x9C, 0x9A, 0x71, 0xAF, 0x13,
+        0x16, 0x9C, 0xAA, 0x99, 0xB9, 0xA2, 0x14, 0xAC, 0x97, 0xA3, 0x89, 0xC0, 0x66, 0x97, 0xDB, 0xAB,
+        0x25, 0x2C, 0x27, 0xFE, 0xF7, 0xBE, 0xA2, 0x77, 0xC0, 0x54, 0x7B, 0x6B, 0x18, 0xC1, 0x66, 0x18,
+        0x56, 0x57, 0xC0, 0x10, 0x27, 0x31, 0x2E, 0x22, 0x1F, 0x10, 0x56, 0x9F, 0xB8, 0xA3, 0x98, 0x6F,
+        0xC1, 0x31, 0xC2, 0x2A, 0xC1, 0x1C, 0x6B, 0x1C, 0x23, 0x1C, 0xC3, 0x15, 0x1C, 0x31, 0x2A, 0x1C,
+        0xC1, 0x15, 0xC0, 0x5B, 0x91, 0x65, 0x7E, 0xA4, 0x88, 0xA2, 0xA9, 0x1A, 0xC0, 0x21, 0x13, 0x54,
+        0xA7, 0xA9, 0xA0, 0x9A, 0x30, 0x21, 0x96, 0x78, 0xA6, 0x99, 0x37, 0x30, 0x57, 0x7F, 0x97, 0x78,
+        0xA4, 0x89, 0xA5, 0xB9, 0x37, 0x0E, 0x1B, 0x69, 0x3E, 0x99, 0x76, 0x3F, 0x99, 0x77, 0x9F, 0x9D,
+        0x37, 0x3E, 0x14, 0x37, 0x8F, 0x69, 0xA8, 0x81, 0xFE, 0xBE, 0x76, 0xA9, 0xAB, 0xFE, 0x4A, 0xBC,
+        0x56, 0x0E, 0xA3, 0x98, 0x15, 0xC0, 0xA0, 0x8A, 0xC0, 0x15, 0x6B, 0xC0, 0x15, 0xC0, 0x1C, 0x2A,
+        0x23, 0x1C, 0xC4, 0x15, 0x1C, 0xC2, 0x98, 0xCD, 0x65, 0xA2, 0x78, 0x65, 0xFE, 0xF4, 0xB9, 0x9D,
+        0xAA, 0xB0, 0x12, 0xC1, 0x92, 0xED, 0x02, 0xA2, 0x78, 0x69, 0xA3, 0x78, 0x6F, 0x9B, 0xA9, 0xFE,
+        0xF2, 0xF7, 0x0C, 0x94, 0xEB, 0xB2, 0x03, 0x03, 0xC1, 0x36, 0x98, 0xCB, 0x36, 0x96, 0xDB, 0x9D,
+        0xAA, 0x9D, 0xA9, 0xB1, 0x13, 0xC0, 0x99, 0xC9, 0x98, 0xBB, 0xAD, 0x25, 0x3E, 0x9E, 0x6A, 0x56,
+        0xFE, 0xF4, 0x57, 0x3E, 0x94, 0xDC, 0xA7, 0x66, 0x5F, 0xFE, 0xF7, 0xDE, 0x1B, 0x18, 0x22, 0x7F,
+        0x22, 0x18, 0x66, 0x18, 0xC0, 0x10, 0xC3, 0x22, 0x31, 0xC1, 0x22, 0x10, 0x9F, 0xB9, 0xA2, 0x87,
+        0x6F, 0x67, 0x11, 0x31, 0xC0, 0x2A, 0xC1, 0x31, 0xC0, 0x2A, 0x1C, 0xC0, 0x2A, 0xC0, 0x23, 0x1C,
+        0xC2, 0x23, 0x2A, 0x31, 0x23, 0xC1, 0x1C, 0xC0, 0x9C, 0x78, 0x98, 0x64, 0x98, 0x69, 0xAB, 0xB8,
+        0x21, 0xC1, 0x1A, 0x93, 0x69, 0xAA, 0xA6, 0xA1, 0x9A, 0x21, 0xC0, 0x06, 0x93, 0x5A, 0x1A, 0x21,
+        0x65, 0x56, 0x15, 0x93, 0x59, 0xA2, 0x99, 0x21, 0x1A, 0x54, 0xA3, 0xAF, 0x55, 0x54, 0x9A, 0x85,
+        0x6F, 0x06, 0x93, 0x6A, 0xB0, 0xCB, 0x5E, 0x7A, 0x08, 0x94, 0x57, 0xA1, 0x80, 0xFE, 0x9D, 0xB2,
+        0xFE, 0xA5, 0x5D, 0xFE, 0x22, 0x1B, 0xFE, 0xBD, 0xFD, 0x1C, 0xA0, 0x8A, 0xA0, 0x85, 0x1C, 0xC0,
+        0x15, 0x1C, 0xC0, 0x23, 0x15, 0x1C, 0xC1, 0x23, 0x15, 0x1C, 0x23, 0xC1, 0x1C, 0x15, 0xC0, 0x1C,
+        0x23, 0x1C, 0x93, 0xFF, 0xA2, 0x76, 0x6F, 0x1E, 0x93, 0xED, 0x96, 0xDC, 0xAF, 0x23, 0xA5, 0x67,
+        0xC0, 0x39, 0xFE, 0xF2, 0xB7, 0xFE, 0xF5, 0xBA, 0xA4, 0x76, 0x0F, 0x08, 0xC0, 0x99, 0xBB, 0x96,
+        0xDA, 0x67, 0xA2, 0x75, 0xAB, 0x38, 0x03, 0x3E, 0x34, 0x3E, 0x9A, 0xAA, 0x3E, 0xFE, 0xF3, 0xD7,
+        0x92, 0xFD, 0xAE, 0x12, 0x39, 0x9C, 0xA8, 0x96, 0xCC, 0xA5, 0x27, 0x9B, 0x6D, 0xA4, 0x96, 0xAB,
+        0x93, 0x93, 0xFD, 0x03, 0x0C, 0xA5, 0x68, 0x9C, 0xA8, 0xAE, 0x13, 0xA8, 0x36, 0x7A, 0x6F, 0x1B,
+        0xC0, 0x18, 0x10, 0xC2, 0x18, 0x10, 0x18, 0x1F, 0x18, 0x7B, 0x7F, 0xC0, 0x22, 0x10, 0x9F, 0xB9,
+        0x9A, 0x87, 0x6B, 0xC0, 0xA3, 0x98, 0x41, 0xC1, 0xA7, 0x97, 0xA1, 0x8A, 0x6B, 0x2A, 0x23, 0x1C,
+        0xC0, 0x2A, 0x31, 0x23, 0x1C, 0xC0, 0x23, 0xC0, 0x2A, 0xC0, 0x31, 0x2A, 0x23, 0xC0, 0x1C, 0xC0,
+        0x99, 0x79, 0x9E, 0x63, 0x94, 0x6A, 0xAE, 0xB7, 0x21, 0xC0, 0x7A, 0x9B, 0x78, 0x9B, 0x87, 0xA6,
+        0x97, 0xA2, 0x89, 0xA2, 0x89, 0x66, 0x07, 0xAB, 0xA7, 0x1A, 0xC0, 0x65, 0x06, 0x99, 0x79, 0x9A,
+        0x68, 0xA1, 0xA9, 0xAC, 0xA6, 0x04, 0x06, 0x05, 0x21, 0x9D, 0x99, 0x9E, 0x76, 0x9E, 0x8B, 0xA6,
+        0x97, 0x8E, 0x46, 0xB3, 0xDB, 0xA1, 0x8A, 0x7B, 0x5D, 0x95, 0x99, 0x9C, 0x60, 0xFE, 0x74, 0x8F,
+        0xFE, 0x32, 0x3B, 0xA9, 0xA5, 0x1B, 0x7D, 0xC3, 0x6B, 0x6B, 0xC0, 0x23, 0x1C, 0x69, 0xC3, 0x1C,
+        0xC0, 0x2A, 0xC0, 0x1C, 0x15, 0xC0, 0x1C, 0x23, 0x9D, 0xA9, 0x95, 0xED, 0xC0, 0xA2, 0x77, 0x66,
+        0x98, 0xBA, 0x2E, 0xAC, 0x23, 0xAD, 0x34, 0x0F, 0xC0, 0x16, 0x92, 0xFC, 0xFE, 0xF5, 0xBA, 0xA4,
+        0x76, 0x52, 0x08, 0x03, 0x95, 0xDC, 0x9D, 0xA9, 0x9D, 0xA8, 0xA9, 0x44, 0x9E, 0x9C, 0xA9, 0x56,
+        0xC1, 0x9D, 0x99, 0x96, 0xDB, 0xAA, 0x36, 0xFE, 0xF3, 0x56, 0x99, 0xCB, 0xA7, 0x55, 0xAD, 0x24,
+        0xFE, 0xD3, 0x99, 0xAE, 0x13, 0xA5, 0xA5, 0x9B, 0xB9, 0x66, 0x99, 0xCC, 0x03, 0x39, 0xA6, 0x47,
+        0x98, 0xDA, 0x9A, 0xAA, 0xFE, 0xEF, 0x1D, 0xA5, 0x66, 0x6E, 0x7E, 0x66, 0x59, 0x10, 0x6B, 0x59,
+        0x10, 0xC1, 0x18, 0xA1, 0xAA, 0xC0, 0x55, 0xC0, 0x27, 0xC0, 0x18, 0x96, 0xA8, 0xA8, 0x88, 0xA2,
+        0x88, 0xC0, 0x0A, 0x9C, 0x88, 0xA5, 0x89, 0x7A, 0x9A, 0x88, 0x5A, 0xA6, 0x87, 0x1C, 0x15, 0x1C,
+        0x15, 0x23, 0xC0, 0x1C, 0xC1, 0x23, 0x2A, 0x31, 0xC0, 0x2A, 0xC0, 0x23, 0x1C, 0x15, 0xC0, 0x95,
+        0x79, 0xA1, 0x75, 0x98, 0x7A, 0xAB, 0xB7, 0x2B, 0x21, 0xC0, 0x94, 0x78, 0xA6, 0x85, 0x69, 0x7F,
+        0x6F, 0x99, 0x8A, 0x9D, 0x7A, 0xAE, 0xB7, 0x55, 0x66, 0xC1, 0x8C, 0x49, 0xA5, 0xA9, 0xA6, 0x97,
+        0xA8, 0x97, 0xA2, 0x86, 0x21, 0x1A, 0x04, 0x9B, 0x89, 0x54, 0x13, 0xA7, 0x96, 0x8B, 0x79, 0x30,
+        0xA2, 0x9A, 0xA2, 0x8A, 0x55, 0x9A, 0x88, 0x96, 0x73, 0xFE, 0x63, 0xB8, 0xFE, 0x19, 0xDA, 0xFE,
+        0xCE, 0x7C, 0x1C, 0xC4, 0x2A, 0x31, 0xC0, 0x2A, 0x1C, 0x69, 0x1C, 0xC0, 0x15, 0xC1, 0x1C, 0x23,
+        0x2A, 0x23, 0x1C, 0xC2, 0x97, 0xCC, 0x9D, 0xBA, 0x61, 0x6F, 0x66, 0x98, 0xBA, 0x6F, 0x9D, 0xA9,
+        0x9C, 0xA9, 0xA5, 0x67, 0xA8, 0x56, 0x08, 0x93, 0xED, 0x9C, 0xA7, 0xAB, 0x37, 0x36, 0xA2, 0x67,
+        0xA6, 0x45, 0xA4, 0x88, 0x97, 0xDA, 0x12, 0xA7, 0x56, 0xAB, 0x35, 0x93, 0xFE, 0x73, 0xA7, 0x35,
+        0x59, 0xA1, 0xAA, 0xFE, 0xF3, 0x76, 0xC0, 0xA8, 0x34, 0xA6, 0x64, 0x98, 0xCB, 0x98, 0xCE, 0x08,
+        0x03, 0x0F, 0xC0, 0x92, 0xEC, 0xAC, 0x34, 0xC0, 0xA8, 0x36, 0xA3, 0x78, 0xFE, 0xF5, 0x7B, 0x9C,
+        0xA9, 0xFE, 0xEF, 0x5D, 0xA4, 0x66, 0x1B, 0x18, 0x10, 0x17, 0x5B, 0x69, 0x69, 0x10, 0xC0, 0x1F,
+        0x2A, 0x6B, 0xC0, 0x55, 0x10, 0xC0, 0x0D, 0xA0, 0xC7, 0x1E, 0xC2, 0x12, 0x9A, 0x89, 0x56, 0xC1,
+        0xA5, 0x87, 0x1C, 0x69, 0xC0, 0x1C, 0xC0, 0x23, 0x15, 0x1C, 0xC0, 0x2A, 0xC1, 0x31, 0x2A, 0x23,
+        0x1C, 0xC0, 0x15, 0x1C, 0x94, 0x57, 0x9F, 0x86, 0x9B, 0x8A, 0xAE, 0xB7, 0xA2, 0x88, 0x55, 0x52,
+        0x96, 0x65, 0xA6, 0xA6, 0x5A, 0xC0, 0x42, 0x92, 0x5B, 0xAF, 0xD5, 0xA3, 0x99, 0x9C, 0x78, 0xA5,
+        0x99, 0x51, 0x98, 0x7A, 0x99, 0x9B, 0x41, 0xAA, 0x85, 0xAA, 0x96, 0x38, 0x9D, 0x77, 0x38, 0x59,
+        0x9B, 0x89, 0x9A, 0x88, 0xA8, 0x89, 0xA3, 0xA7, 0x91, 0x6A, 0xAC, 0x97, 0xA1, 0xAB, 0x21, 0x9F,
+        0x86, 0x9D, 0x9B, 0xFE, 0x64, 0x32, 0xFE, 0x19, 0xDB, 0xFE, 0x84, 0x3B, 0xFE, 0xFF, 0xFC, 0xC1,
+        0x23, 0x1C, 0x69, 0xC0, 0x23, 0x2A, 0x6B, 0x2A, 0x23, 0x1C, 0xC0, 0x23, 0xC0, 0x1C, 0x15, 0x1C,
+        0xC0, 0x23, 0x2A, 0x23, 0x1C, 0xC1, 0x92, 0xFF, 0x51, 0x08, 0x6F, 0xC0, 0x94, 0xDC, 0x0A, 0x51,
+        0x69, 0x9A, 0xCB, 0x96, 0xCA, 0xA5, 0x68, 0xA7, 0x56, 0x9A, 0xB9, 0x6C, 0xA0, 0x8A, 0x94, 0xEC,
+        0xA7, 0x34, 0x45, 0xA4, 0xAA, 0x69, 0xAC, 0x23, 0xAB, 0x47, 0xA2, 0x77, 0x94, 0xBA, 0x92, 0xEC,
+        0x9D, 0xDD, 0x2A, 0xA3, 0x78, 0x0A, 0x9C, 0x99, 0xFE, 0xF6, 0x98, 0x6E, 0xFE, 0xF3, 0xF3, 0xB1,
+        0x08, 0xA3, 0x87, 0x6E, 0x19, 0x94, 0xEC, 0xA6, 0x56, 0xA2, 0x77, 0xA6, 0x47, 0xA9, 0x34, 0x63,
+        0xFE, 0xF5, 0x5B, 0x9C, 0xA9, 0xFE, 0xEF, 0x5D, 0x11, 0xC0, 0x56, 0x10, 0x6B, 0x5A, 0x10, 0xC1,
+        0x18, 0x22, 0xC0, 0x7E, 0x6B, 0x22, 0xC0, 0x10, 0xA0, 0xB7, 0xC2, 0x6F, 0xC3, 0x9D, 0x89, 0x9D,
+        0x98, 0x56, 0x7D, 0x6F, 0xA3, 0x98, 0x1C, 0x6B, 0x1C, 0xC2, 0x23, 0x2A, 0xC0, 0x23, 0xC0, 0x1C,
+        0xC1, 0x23, 0x93, 0x56, 0x9D, 0x88, 0x55, 0xAE, 0xC7, 0x6F, 0x21, 0x97, 0x79, 0x01, 0x6E, 0xC0,
+        0x52, 0x91, 0x5C, 0xAC, 0xA5, 0xA4, 0xA6, 0x56, 0x6F, 0x69, 0x9C, 0x89, 0x97, 0xEF, 0x9C, 0x16,
+        0xA5, 0xA8, 0xA5, 0x84, 0xAB, 0xA9, 0x50, 0x59, 0xA1, 0x9A, 0x04, 0x9D, 0x89, 0x95, 0x8A, 0x1A,
+        0x64, 0x95, 0x7B, 0xA8, 0x99, 0xA2, 0x88, 0xA5, 0x98, 0x38, 0x42, 0xFE, 0x0A, 0x34, 0xFE, 0x19,
+        0xBA, 0xFE, 0xD6, 0x9C, 0x23, 0x1C, 0xC2, 0x15, 0x1C, 0x23, 0x2A, 0xC1, 0x23, 0x15, 0xC0, 0x2A,
+        0x6B, 0x1C, 0x15, 0xC0, 0x1C, 0x23, 0x2A, 0x1C, 0xC1, 0x9D, 0xAA, 0x95, 0xEE, 0x9D, 0x9A, 0x19,
+        0x66, 0x69, 0x91, 0xFF, 0x08, 0x66, 0xC0, 0x99, 0xBA, 0xA9, 0x44, 0xA8, 0x57, 0x98, 0xBB, 0x99,
+        0xCB, 0x97, 0x9A, 0xAB, 0x12, 0x9D, 0xAB, 0xFE, 0xCB, 0xB3, 0xB1, 0x13, 0xA6, 0x67, 0xA6, 0x98,
+        0xA2, 0x77, 0x6E, 0x56, 0x97, 0xA9, 0xA4, 0x88, 0x84, 0x7A, 0xA7, 0x8A, 0x9D, 0x98, 0x9A, 0xC8,
+        0xB9, 0x66, 0x06, 0x66, 0xFE, 0xF4, 0xB4, 0xAB, 0x3A, 0xA4, 0x76, 0x07, 0xA4, 0x77, 0x96, 0xDA,
+        0xA2, 0x77, 0xA4, 0x67, 0xA7, 0x58, 0xA7, 0x45, 0x18, 0x1B, 0xFE, 0xF5, 0x5A, 0x9D, 0xAA, 0xFE,
+        0xEF, 0xBC, 0x18, 0x09, 0x10, 0x17, 0xC0, 0x59, 0xC0, 0x10, 0x18, 0x7B, 0x2A, 0x22, 0xC1, 0x5A,
+        0x10, 0xA0, 0xB7, 0xC2, 0x6B, 0xC0, 0x6E, 0xC5, 0x19, 0x02, 0x9D, 0x99, 0xC0, 0x27, 0x7E, 0xA3,
+        0x89, 0x2A, 0xC1, 0x23, 0x1C, 0xC0, 0x15, 0x1C, 0xC0, 0xA0, 0x7A, 0x90, 0x53, 0x9F, 0x8B, 0xA4,
+        0xA6, 0xAA, 0x97, 0xC1, 0x91, 0x68, 0xA9, 0xA6, 0x69, 0x3E, 0x93, 0x6C, 0xA3, 0xA8, 0xAA, 0xA4,
+        0x32, 0xC0, 0x3A, 0x41, 0x95, 0xAE, 0xA3, 0xEB, 0x9C, 0x36, 0x9C, 0x36, 0xB0, 0xB3, 0x7E, 0x66,
+        0x59, 0x69, 0x1C, 0x64, 0x8F, 0x5E, 0xB3, 0xB3, 0x15, 0x9A, 0x8A, 0xA5, 0x9B, 0xA3, 0x88, 0xA5,
+        0xA7, 0xC0, 0x41, 0xFE, 0x0A, 0x91, 0xFE, 0x11, 0xB8, 0x0C, 0xA2, 0x98, 0xC0, 0x69, 0xC0, 0x69,
+        0xC0, 0x1C, 0xC0, 0x23, 0xC1, 0x1C, 0xC2, 0x2A, 0x1C, 0x15, 0xC0, 0x1C, 0x15, 0x1C, 0xC0, 0x15,
+        0xC0, 0x96, 0xDE, 0x6F, 0x59, 0x9D, 0xB9, 0x62, 0xC0, 0x92, 0xEC, 0xAC, 0x25, 0x61, 0x08, 0x96,
+        0xCB, 0xB1, 0x01, 0xA4, 0x68, 0x91, 0x8A, 0x99, 0x9A, 0xA8, 0x89, 0x9F, 0x9B, 0xA4, 0x76, 0x9A,
+        0x96, 0xAE, 0x86, 0xA3, 0x99, 0x12, 0xC1, 0x65, 0xC0, 0x93, 0x8A, 0xA0, 0x7B, 0xAD, 0x97, 0x98,
+        0x99, 0x92, 0x9A, 0xA3, 0x66, 0x9D, 0x97, 0x2A, 0xFE, 0xF5, 0x56, 0xA4, 0x6A, 0x19, 0x99, 0xAB,
+        0xA7, 0x77, 0x96, 0xDA, 0xA2, 0x77, 0xA4, 0x67, 0x02, 0xAF, 0x13, 0xC0, 0x6F, 0x9D, 0xA9, 0xFE,
+        0xF4, 0xB9, 0xA9, 0x46, 0x27, 0x1B, 0x5A, 0x10, 0xC1, 0x5B, 0x69, 0x18, 0xA1, 0xA9, 0x6B, 0x22,
+        0x18, 0x10, 0x0D, 0x66, 0xA1, 0xC7, 0xC1, 0x62, 0x69, 0xC0, 0x12, 0x6F, 0xC8, 0x6B, 0x65, 0x9D,
+        0x89, 0x51, 0x22, 0x2A, 0xC1, 0x69, 0x15, 0xC0, 0x6B, 0x9D, 0x8A, 0x91, 0x54, 0xA5, 0xAC, 0xA5,
+        0x94, 0xA5, 0x99, 0x69, 0x9D, 0x88, 0x94, 0x68, 0xA9, 0xA6, 0x56, 0x93, 0x6C, 0xA1, 0xA9, 0x3A,
+        0x6B, 0x59, 0x69, 0x9B, 0x8A, 0x99, 0x9D, 0xFE, 0xEE, 0x56, 0x95, 0x47, 0x66, 0xA5, 0x43, 0x24,
+        0xC0, 0x55, 0x0E, 0xC0, 0x52, 0x9A, 0x8A, 0x99, 0x8D, 0xAF, 0xA1, 0x0E, 0x9A, 0x8B, 0xA4, 0x89,
+        0xA2, 0x89, 0xA7, 0xA6, 0x6B, 0x9D, 0x89, 0xFE, 0x0A, 0x73, 0xA9, 0xC5, 0xFE, 0xF7, 0xFB, 0x1C,
+        0x23, 0x1C, 0xC0, 0x69, 0xC2, 0x1C, 0xC3, 0x23, 0x6B, 0xC0, 0x15, 0xC0, 0x1C, 0x23, 0x1C, 0xC1,
+        0x15, 0x67, 0x96, 0xDE, 0xA6, 0x54, 0x9C, 0xAA, 0x9C, 0xA9, 0x65, 0x9C, 0x9A, 0x9C, 0xAA, 0x65,
+        0xA8, 0x55, 0xC0, 0x94, 0xDA, 0xFE, 0xE6, 0xB8, 0x8B, 0x7B, 0xB0, 0x89, 0xAB, 0x88, 0x88, 0xBB,
+        0x89, 0xDD, 0xB4, 0x43, 0xBD, 0x55, 0x9D, 0x97, 0xA3, 0x98, 0xC4, 0x43, 0x9D, 0x99, 0x7B, 0x91,
+        0xAA, 0x82, 0xDD, 0xB4, 0x44, 0xB6, 0x45, 0x8C, 0x98, 0xA6, 0xF8, 0xA4, 0x9C, 0x03, 0x11, 0xAB,
+        0x35, 0xFE, 0xF4, 0x98, 0xAA, 0x45, 0x03, 0x36, 0xFE, 0xF7, 0x5C, 0xA5, 0x68, 0x7B, 0x2A, 0x96,
+        0xCB, 0xFE, 0xF3, 0xD8, 0xFE, 0xF7, 0x9E, 0xA2, 0x66, 0xC0, 0x56, 0xC3, 0x18, 0xC0, 0x6B, 0x7E,
+        0x18, 0xC0, 0x46, 0x66, 0x9D, 0xE8, 0x9C, 0x97, 0x9D, 0xA8, 0x98, 0x99, 0xA4, 0x39, 0x9D, 0xC8,
+        0xA7, 0x88, 0xA6, 0x78, 0xA4, 0x68, 0x6F, 0xC0, 0x6E, 0xC8, 0x98, 0x8A, 0x9B, 0x8E, 0x66, 0x5A,
+        0xA8, 0x83, 0xA7, 0x94, 0x15, 0xC0, 0x99, 0x7A, 0x98, 0x66, 0xA3, 0x9A, 0xA7, 0xA5, 0x1A, 0xC0,
+        0x96, 0x69, 0x9E, 0x86, 0xA5, 0xA7, 0x94, 0x8D, 0xA1, 0xCA, 0xA8, 0x74, 0x7E, 0x58, 0x9D, 0x79,
+        0x95, 0x4B, 0xA4, 0xA8, 0xAC, 0xFD, 0x9C, 0x88, 0x99, 0x78, 0x99, 0x26, 0xAF, 0xA1, 0x7E, 0xC0,
+        0x0E, 0xC0, 0x99, 0x8B, 0xC0, 0xFE, 0xA4, 0xAE, 0xA2, 0x65, 0xAC, 0x50, 0x0E, 0x98, 0x7A, 0xA5,
+        0x9A, 0xA4, 0x99, 0xA6, 0x86, 0x6B, 0x9B, 0x89, 0xFE, 0x4B, 0x34, 0xFE, 0x95, 0xAE, 0x1C, 0xC0,
+        0x69, 0xC0, 0x1C, 0x15, 0xC0, 0x1C, 0xC0, 0x15, 0x1C, 0xC0, 0x15, 0xC0, 0x1C, 0x23, 0x1C, 0xC2,
+        0x23, 0x15, 0x1C, 0x15, 0xC0, 0x9C, 0xAB, 0x9B, 0xBC, 0xA8, 0x43, 0x96, 0xCD, 0x71, 0x03, 0x02,
+        0xAA, 0x44, 0x02, 0xAC, 0x23, 0x03, 0x91, 0xEB, 0xFE, 0x83, 0xF0, 0xB4, 0x79, 0xA6, 0x97, 0x51,
+        0xFE, 0xC3, 0xF4, 0xA2, 0x87, 0x9C, 0x59, 0xAD, 0x56, 0xB0, 0x55, 0xA2, 0xA6, 0x6E, 0xC0, 0x6B,
+        0xC0, 0x9D, 0x89, 0x1D, 0x8D, 0xBA, 0xFE, 0xB2, 0xF1, 0xFE, 0xC9, 0xCE, 0xB6, 0x05, 0x93, 0x5A,
+        0xBE, 0x23, 0xA7, 0x78, 0x88, 0xA9, 0xFE, 0xED, 0x38, 0xA6, 0x67, 0x94, 0xEB, 0xAE, 0x15, 0x92,
+        0xFC, 0xAD, 0x25, 0x74, 0x91, 0xFF, 0xFE, 0xF6, 0x5C, 0xAC, 0x34, 0x6F, 0xC0, 0x66, 0xFE, 0xF4,
+        0xDA, 0xAF, 0x13, 0xA9, 0x35, 0xC1, 0x65, 0x5B, 0x7A, 0x10, 0xA2, 0x98, 0xC0, 0x65, 0xC0, 0x13,
+        0x10, 0xC0, 0x5A, 0xFE, 0xF5, 0xD4, 0x66, 0x42, 0xA9, 0x29, 0x31, 0x25, 0x97, 0x97, 0x97, 0xB9,
+        0xA4, 0xA8, 0xA7, 0x78, 0xA5, 0x69, 0x19, 0x1E, 0xC5, 0x25, 0x9C, 0x79, 0x94, 0x7F, 0xAB, 0x73,
+        0xC1, 0x97, 0x9D, 0x9D, 0xB9, 0xFE, 0xEF, 0x7B, 0xA4, 0x86, 0x94, 0x58, 0xA2, 0x98, 0x9B, 0x89,
+        0xAB, 0x95, 0x7A, 0x1A, 0x8D, 0x4B, 0xA6, 0xA6, 0x9C, 0xAA, 0xA5, 0xEC, 0xA2, 0x65, 0xA2, 0x97,
+        0x55, 0x99, 0x79, 0x9D, 0x6A, 0x9C, 0x57, 0xB3, 0xFB, 0xA3, 0x89, 0x97, 0x87, 0x96, 0x88, 0xA4,
+        0x53, 0xA7, 0x94, 0x59, 0xC0, 0x66, 0x97, 0x7B, 0x9D, 0x79, 0xA3, 0xEE, 0xA8, 0xDB, 0x99, 0x00,
+        0xA9, 0x94, 0x9D, 0x8A, 0x1D, 0xA8, 0xA8, 0xAA, 0xA8, 0xA2, 0x78, 0x69, 0x98, 0x8A, 0x97, 0x8C,
+        0xA6, 0x87, 0x1C, 0xC2, 0x23, 0x1C, 0x69, 0x1C, 0xC0, 0x23, 0xC0, 0x6B, 0x1C, 0x15, 0x69, 0x15,
+        0xC0, 0x1C, 0xC2, 0x15, 0x23, 0x1C, 0xC0, 0x98, 0xCD, 0xA2, 0x77, 0xA5, 0x65, 0x95, 0xEE, 0x61,
+        0x9D, 0xA9, 0x94, 0xDC, 0xA7, 0x56, 0xA3, 0x78, 0x20, 0x9D, 0x98, 0x8F, 0xFA, 0xFE, 0xB5, 0xD7,
+        0xB0, 0x98, 0x8A, 0xAA, 0xFE, 0xAA, 0x90, 0xA2, 0xB8, 0xA8, 0x36, 0x96, 0xEB, 0xFE, 0x9B, 0xB3,
+        0xBD, 0x63, 0x9B, 0x89, 0xA5, 0x97, 0xC1, 0x5A, 0x9D, 0x89, 0x19, 0x86, 0xBC, 0xFE, 0xC1, 0x8D,
+        0xFE, 0xCD, 0x58, 0x90, 0xFA, 0x96, 0xCA, 0xFE, 0xBD, 0x77, 0x2A, 0x91, 0x9A, 0xFE, 0xE5, 0x37,
+        0x2D, 0x95, 0xDC, 0xAD, 0x35, 0x94, 0xDC, 0x3E, 0xC0, 0x93, 0xED, 0xA5, 0x77, 0xAD, 0x16, 0xAB,
+        0x45, 0xC0, 0x65, 0x96, 0xCB, 0x65, 0xAA, 0x25, 0x10, 0x7E, 0x69, 0x10, 0xC1, 0x13, 0x7F, 0x6E,
+        0x22, 0x13, 0x10, 0x5A, 0xC0, 0xFE, 0xE5, 0x53, 0xA2, 0x49, 0xAA, 0x58, 0x31, 0xC1, 0x2A, 0x54,
+        0x97, 0xAA, 0x96, 0xC8, 0xA5, 0xA8, 0xA6, 0x68, 0xA6, 0x58, 0x19, 0xC1, 0x6E, 0xC2, 0xFE, 0xA5,
+        0x5E, 0xAF, 0x61, 0xA4, 0xA7, 0x7E, 0x3A, 0x5A, 0x9D, 0x9A, 0x94, 0xAE, 0xA1, 0xA8, 0xFE, 0x85,
+        0x52, 0xB1, 0xD9, 0x94, 0x45, 0xAC, 0xB6, 0x6E, 0x9D, 0x88, 0xFE, 0x53, 0xD3, 0xAB, 0xE2, 0xB0,
+        0x98, 0xA4, 0x78, 0xC0, 0x0D, 0x55, 0x6E, 0x97, 0x88, 0xA2, 0x88, 0xA2, 0x78, 0x03, 0x9B, 0x89,
+        0x92, 0xA6, 0xA7, 0x84, 0x69, 0x4D, 0x58, 0x97, 0x8C, 0x98, 0x5B, 0xA3, 0x98, 0xAE, 0xBA, 0x98,
+        0x98, 0xA5, 0x60, 0xA4, 0x97, 0x98, 0x6B, 0x96, 0x7B, 0xAC, 0xA6, 0xAE, 0xA8, 0x59, 0xC0, 0x94,
+        0x7B, 0xFE, 0x53, 0x39, 0xFE, 0xAE, 0x13, 0x1C, 0xC3, 0x6B, 0x2A, 0x1C, 0x23, 0xA0, 0x8A, 0x2A,
+        0x23, 0x2A, 0x1C, 0x23, 0x1C, 0xC5, 0x23, 0x1C, 0xC0, 0x96, 0xDE, 0xA6, 0x54, 0x12, 0x95, 0xDE,
+        0x9D, 0xB8, 0x9B, 0xAA, 0x9B, 0xBA, 0x62, 0xAF, 0x24, 0xA2, 0x77, 0x3E, 0x97, 0x98, 0xAB, 0x15,
+        0xAA, 0x79, 0x82, 0xDD, 0xFE, 0xB1, 0xCF, 0xA9, 0x87, 0xAD, 0x26, 0x9C, 0xCA, 0x9B, 0x48, 0xBB,
+        0x53, 0x9B, 0x8A, 0xA3, 0x98, 0x55, 0xC0, 0x56, 0xA4, 0x87, 0xA2, 0x87, 0x99, 0x8A, 0x92, 0xDB,
+        0xA3, 0x68, 0xA0, 0xC7, 0x90, 0xAB, 0xFE, 0xC5, 0xB8, 0xAC, 0x65, 0x98, 0xBB, 0x9C, 0xC9, 0x99,
+        0xDB, 0xA3, 0x87, 0x66, 0xA2, 0x78, 0xA6, 0x56, 0x3E, 0x3B, 0xAC, 0x26, 0x96, 0xDB, 0xFE, 0xFF,
+        0x7E, 0xA4, 0x67, 0xC0, 0x99, 0xCB, 0x9C, 0x98, 0xAA, 0x24, 0xC0, 0x10, 0xC1, 0x5B, 0xC0, 0x10,
+        0xA2, 0x98, 0xC1, 0x18, 0x46, 0xC1, 0x21, 0xAD, 0x79, 0x31, 0xC2, 0x2A, 0x17, 0xC0, 0x51, 0x95,
+        0xA9, 0x9A, 0xC9, 0xA5, 0x98, 0xA6, 0x68, 0xA6, 0x58, 0x6F, 0x6E, 0xC0, 0x19, 0x9A, 0x7B, 0x97,
+        0x6E, 0xAE, 0x91, 0x31, 0x41, 0x9C, 0x5A, 0x56, 0x72, 0x63, 0x40, 0x97, 0x76, 0xA2, 0xBF, 0xFE,
+        0x95, 0xD2, 0xAD, 0xC5, 0x6F, 0x96, 0x69, 0xFE, 0x53, 0x96, 0xFE, 0xD5, 0xD6, 0xA9, 0x68, 0x19,
+        0xC0, 0x69, 0xC1, 0x5A, 0x2D, 0x6F, 0x12, 0x51, 0x9C, 0x97, 0x9E, 0x86, 0x9C, 0x97, 0x9D, 0x97,
+        0x98, 0x5A, 0x9C, 0x9A, 0xAD, 0x79, 0x03, 0x2D, 0x8E, 0x95, 0x02, 0x9A, 0x6A, 0x95, 0xAE, 0xA2,
+        0x67, 0x01, 0xAC, 0x96, 0x79, 0xC0, 0x8B, 0x6E, 0x8C, 0x70, 0xFE, 0xBE, 0x56, 0xAD, 0xA8, 0xC2,
+        0x23, 0xC1, 0x1C, 0x23, 0x6B, 0x31, 0x2A, 0x31, 0x2A, 0xC0, 0x23, 0x1C, 0xC0, 0x23, 0x2A, 0x23,
+        0x1C, 0xC1, 0x0D, 0x98, 0xCD, 0x1E, 0x9D, 0xAA, 0x95, 0xDC, 0x9C, 0xA8, 0x9A, 0xBB, 0x66, 0xC0,
+        0xAE, 0x23, 0xC0, 0x99, 0xCB, 0x9B, 0x56, 0x0D, 0x3E, 0x93, 0xAC, 0x87, 0xFD, 0xB1, 0x77, 0xA4,
+        0x66, 0x7B, 0xA7, 0x77, 0xA3, 0x98, 0x9A, 0x8A, 0x69, 0xA2, 0x88, 0xA2, 0x88, 0x9D, 0x88, 0xA3,
+        0x88, 0xA4, 0x87, 0x6E, 0x5E, 0x9A, 0x98, 0x9D, 0x89, 0xA6, 0x77, 0xA8, 0x77, 0x69, 0x92, 0xAC,
+        0xA0, 0xCA, 0x92, 0xFC, 0xAC, 0x34, 0x94, 0xDD, 0xAE, 0x23, 0xC0, 0x6E, 0x9B, 0xBA, 0xA9, 0x37,
+        0x9D, 0xAA, 0x61, 0xAF, 0x24, 0x31, 0x99, 0xBA, 0x65, 0xA7, 0x56, 0x18, 0xC0, 0x69, 0x10, 0x6B,
+        0x5A, 0x10, 0xC2, 0x6D, 0x10, 0xC0, 0x5A, 0x9D, 0xC8, 0x25, 0x6F, 0xC0, 0x2A, 0x69, 0x1C, 0x66,
+        0xC2, 0x9D, 0x89, 0x93, 0xBA, 0x9F, 0xC7, 0x24, 0xA7, 0x58, 0xA5, 0x79, 0xA2, 0x78, 0x66, 0xFE,
+        0xB5, 0x9D, 0xA8, 0x45, 0xAA, 0xB4, 0x6E, 0x9A, 0x5A, 0x56, 0x66, 0x72, 0x66, 0x9A, 0x66, 0xA4,
+        0x9A, 0xC0, 0xFE, 0xA6, 0x12, 0xAB, 0xB6, 0x5A, 0x8D, 0x6D, 0xFE, 0x53, 0x58, 0xFE, 0xE6, 0xD9,
+        0xA2, 0x78, 0x90, 0x89, 0xAA, 0x87, 0xA5, 0x98, 0x9B, 0x99, 0xA2, 0x88, 0x0D, 0x06, 0x0D, 0x12,
+        0xC2, 0x61, 0x96, 0x87, 0x98, 0xA9, 0xA2, 0x48, 0xAD, 0xA9, 0x0D, 0x96, 0xC7, 0x99, 0x12, 0x5A,
+        0x95, 0x8C, 0xFE, 0xC4, 0xEF, 0xFE, 0x74, 0xC9, 0xAA, 0x99, 0xAA, 0xA5, 0x5B, 0x65, 0xFE, 0x2B,
+        0x31, 0xFE, 0x22, 0x57, 0xFE, 0xEF, 0x9B, 0xA3, 0x98, 0xC0, 0x6B, 0xC1, 0x6B, 0xC0, 0x23, 0x31,
+        0xC2, 0x2A, 0x23, 0x1C, 0xC3, 0x2A, 0xC0, 0x23, 0x1C, 0xC0, 0x98, 0xCC, 0x6B, 0x23, 0x99, 0xCC,
+        0x9A, 0xB9, 0x97, 0xCB, 0x9D, 0xAA, 0x9D, 0xA9, 0xA8, 0x46, 0xA9, 0x56, 0x14, 0x96, 0xCB, 0x9E,
+        0x42, 0xB0, 0x27, 0x06, 0x63, 0x65, 0x62, 0x28, 0x66, 0x66, 0x9D, 0x89, 0x9D, 0x99, 0xA5, 0x98,
+        0x65, 0x19, 0xC0, 0x9A, 0x79, 0xA6, 0x87, 0x2D, 0x32, 0x37, 0x01, 0x06, 0x5F, 0x96, 0xAA, 0x97,
+        0xEC, 0xA1, 0xA9, 0x9B, 0xBA, 0xA6, 0x66, 0x98, 0xBB, 0x3E, 0xC2, 0x11, 0xFE, 0xF7, 0x7D, 0x95,
+        0xED, 0xA7, 0x56, 0x2A, 0xFE, 0xF5, 0xDB, 0xA7, 0x56, 0xA9, 0x46, 0x59, 0x7A, 0x18, 0xC0, 0x10,
+        0x7A, 0x18, 0x22, 0x5A, 0x7E, 0x18, 0xC0, 0x1F, 0x10, 0xA0, 0xB6, 0xA1, 0x8A, 0x2A, 0xC2, 0x9F,
+        0x96, 0xC0, 0x1E, 0xC0, 0x17, 0x6D, 0x1C, 0x9B, 0x99, 0x97, 0xA9, 0x9A, 0xC9, 0xA6, 0x87, 0xA8,
+        0x58, 0x01, 0xFE, 0x94, 0x7D, 0xFE, 0xC7, 0x1E, 0xA7, 0xC6, 0x41, 0x9B, 0x5B, 0xC0, 0x62, 0x9D,
+        0xAB, 0x69, 0x9B, 0x76, 0x1D, 0x9C, 0x76, 0xFE, 0xBE, 0x93, 0xA7, 0x97, 0x9C, 0x87, 0xFE, 0x4B,
+        0xD3, 0xFE, 0x53, 0x38, 0xFE, 0xEF, 0x3B, 0x12, 0x39, 0x93, 0x89, 0x92, 0x88, 0x7F, 0xA8, 0x88,
+        0xA8, 0x87, 0x12, 0xC4, 0x51, 0x9C, 0x98, 0x65, 0xC0, 0x9C, 0x89, 0x9C, 0x98, 0x51, 0xA6, 0x57,
+        0xA5, 0x98, 0x99, 0xA9, 0x97, 0xC8, 0xFE, 0x74, 0xC9, 0xB0, 0xA7, 0x2E, 0xC0, 0x98, 0x88, 0x81,
+        0x60, 0xFE, 0x8D, 0x35, 0xB6, 0xB5, 0xC4, 0x2A, 0x6B, 0xC5, 0x2A, 0xC2, 0x23, 0x69, 0xC0, 0x69,
+        0x1C, 0x23, 0x2A, 0x96, 0xCC, 0xA5, 0x77, 0xA4, 0x67, 0x94, 0xEB, 0xA2, 0x76, 0x94, 0xDC, 0x5A,
+        0x9C, 0xBA, 0xA5, 0x66, 0xAA, 0x45, 0x62, 0x92, 0xFC, 0x9D, 0x31, 0xB6, 0x17, 0x9D, 0x8A, 0xA5,
+        0x98, 0xA1, 0xA9, 0x61, 0x66, 0x9D, 0x9A, 0x21, 0x7E, 0x19, 0xC3, 0x1E, 0x9B, 0x89, 0x56, 0xA4,
+        0x66, 0xA3, 0x88, 0xC0, 0x40, 0x9D, 0x9A, 0xFE, 0xE4, 0x57, 0xA9, 0x77, 0x95, 0xDB, 0xAE, 0x23,
+        0x94, 0xDD, 0xAC, 0x34, 0x6E, 0x9B, 0xAA, 0x3E, 0xC0, 0x96, 0xCB, 0xFE, 0xF7, 0x3C, 0x96, 0xDC,
+        0x6F, 0xAD, 0x24, 0xFE, 0xF4, 0x79, 0xAF, 0x13, 0xAD, 0x25, 0xC0, 0x18, 0x22, 0x69, 0x46, 0x1B,
+        0x18, 0x22, 0xC1, 0x5A, 0xC0, 0x22, 0x10, 0xA0, 0xB6, 0xA1, 0x8A, 0x6F, 0x69, 0x2A, 0x1E, 0x68,
+        0x17, 0xC0, 0x1E, 0x10, 0x1C, 0xC0, 0x15, 0xC0, 0x9D, 0x9A, 0x95, 0xAA, 0x9A, 0xC8, 0xA6, 0x87,
+        0xFE, 0x8C, 0x7D, 0xFE, 0xBE, 0xFE, 0xA6, 0xB6, 0x41, 0x2F, 0x2A, 0x9D, 0xAB, 0x66, 0x9D, 0x87,
+        0xA2, 0x89, 0x7B, 0x9A, 0x64, 0xFE, 0xCF, 0x14, 0xA2, 0x97, 0x92, 0x69, 0xFE, 0x4A, 0xF9, 0x7C,
+        0xFE, 0xF7, 0x7B, 0x12, 0xC2, 0x9D, 0x89, 0x9B, 0x98, 0x51, 0xA5, 0x99, 0x12, 0xC3, 0x9C, 0x98,
+        0x85, 0x8A, 0x9B, 0x8B, 0x90, 0x96, 0xB4, 0x77, 0xAE, 0x88, 0xAB, 0x87, 0x03, 0x12, 0x9B, 0xB8,
+        0x8A, 0x97, 0xFE, 0x7D, 0x2A, 0xB1, 0xC8, 0x5A, 0x69, 0x8C, 0x6D, 0xFE, 0x6C, 0x57, 0xB5, 0xB1,
+        0xA8, 0x99, 0x69, 0x23, 0x2A, 0x23, 0x31, 0x2A, 0xC0, 0x31, 0xC7, 0x2A, 0x23, 0xC0, 0x1C, 0xC1,
+        0x15, 0x1C, 0x93, 0xEF, 0xA8, 0x56, 0xA2, 0x77, 0x14, 0x6E, 0x97, 0xCB, 0x9D, 0xAA, 0xA3, 0x87,
+        0x0C, 0xA9, 0x56, 0x69, 0x92, 0xFC, 0x95, 0x74, 0xFE, 0xF7, 0x1A, 0xA4, 0x68, 0x98, 0x99, 0x9C,
+        0x99, 0x66, 0xC0, 0xA1, 0xA9, 0xA3, 0x99, 0x7E, 0xC5, 0xA2, 0x77, 0x6E, 0x56, 0x59, 0x6E, 0x97,
+        0xED, 0x92, 0xEC, 0x6E, 0x97, 0xBA, 0xB4, 0x13, 0x7A, 0x97, 0xCC, 0xAC, 0x34, 0x03, 0x98, 0xBB,
+        0x39, 0x3E, 0x5A, 0x67, 0x71, 0x5B, 0xA8, 0x45, 0x92, 0xFC, 0xB0, 0x03, 0xA9, 0x46, 0x66, 0x69,
+        0xC0, 0x5A, 0x56, 0x18, 0x1B, 0xC0, 0x18, 0x10, 0xC1, 0x7A, 0x4A, 0x0B, 0x12, 0x6E, 0xC1, 0x12,
+        0x17, 0x69, 0xC0, 0x17, 0xC0, 0x1C, 0xC0, 0x69, 0x1C, 0xC0, 0x23, 0x9D, 0x9A, 0x93, 0xA9, 0xFE,
+        0x84, 0x9C, 0xB3, 0x51, 0xC2, 0x76, 0x9D, 0xAB, 0xC0, 0x66, 0x1D, 0x18, 0x98, 0x51, 0xFE, 0xCF,
+        0x12, 0x55, 0xFE, 0x6C, 0x94, 0x9C, 0x9F, 0x98, 0xBC, 0xFE, 0xEF, 0x5B, 0xA3, 0x98, 0xCA, 0x0B,
+        0x9D, 0x89, 0x9F, 0x8B, 0x93, 0x9A, 0x84, 0xC6, 0x55, 0x9A, 0x69, 0xA8, 0x78, 0xA6, 0x88, 0xB4,
+        0x77, 0xA2, 0xD7, 0x95, 0x24, 0xAD, 0x76, 0x2E, 0xC0, 0x9D, 0x89, 0xFE, 0x43, 0x13, 0xFE, 0x8D,
+        0x92, 0xB2, 0xDC, 0x6E, 0x2A, 0x31, 0xC0, 0x23, 0x31, 0xCA, 0x2A, 0xC1, 0x1C, 0xC3, 0xFE, 0xF5,
+        0xFC, 0xA9, 0x46, 0x69, 0x1E, 0x9C, 0x9A, 0x61, 0x9A, 0xBA, 0xA7, 0x66, 0x9C, 0xA9, 0x56, 0x3E,
+        0x93, 0xEC, 0x8F, 0xC6, 0xFE, 0xDE, 0x36, 0xAC, 0x68, 0x65, 0x01, 0x62, 0x66, 0x2D, 0x66, 0xC4,
+        0x66, 0x28, 0x2D, 0x32, 0x37, 0x6E, 0x06, 0x99, 0xBA, 0x96, 0xD9, 0x99, 0x67, 0xFE, 0xE4, 0x16,
+        0x3E, 0x91, 0xFD, 0x3E, 0xC1, 0x39, 0x96, 0xCB, 0x3E, 0xC0, 0x38, 0xA5, 0x76, 0xA3, 0x68, 0x62,
+        0x9C, 0xA9, 0xFE, 0xF7, 0xBD, 0x5E, 0xC1, 0x13, 0x5A, 0x18, 0x10, 0x79, 0x18, 0xC0, 0x10, 0xC0,
+        0x56, 0x6B, 0xC0, 0x0B, 0x6B, 0xC0, 0x0B, 0xC0, 0x6F, 0x6B, 0x17, 0xC2, 0x1C, 0x17, 0x6D, 0x1C,
+        0x15, 0xC0, 0xA0, 0x8A, 0xC0, 0xFE, 0x84, 0x7D, 0xFE, 0xAE, 0xBD, 0xA2, 0x88, 0x69, 0xC0, 0x73,
+        0x63, 0xC0, 0x66, 0xC0, 0x55, 0xFE, 0x85, 0x51, 0xAD, 0xA1, 0x97, 0x8A, 0xFE, 0xA5, 0xFB, 0x9B,
+        0x70, 0xA7, 0xA5, 0xA4, 0xCE, 0x12, 0xC7, 0x01, 0x06, 0x12, 0xC0, 0x69, 0x1E, 0x57, 0x95, 0xAA,
+        0x89, 0xD7, 0x5A, 0xB2, 0x69, 0x94, 0x68, 0xA7, 0x8A, 0x89, 0x97, 0xA7, 0x41, 0xBC, 0x95, 0xA6,
+        0x96, 0x5A, 0xFE, 0x85, 0x31, 0x9A, 0x8C, 0xB5, 0xB6, 0xA7, 0xA9, 0x31, 0xC2, 0x23, 0x31, 0xCA,
+        0x2A, 0xC0, 0x23, 0x69, 0xC3, 0x19, 0x6F, 0x66, 0x6D, 0x9B, 0xAB, 0xA3, 0x76, 0x9B, 0xBB, 0x03,
+        0x3B, 0x92, 0xFD, 0xAE, 0x23, 0x97, 0xCB, 0x8A, 0xE7, 0xFE, 0xBC, 0x91, 0x06, 0x12, 0x06, 0x01,
+        0xC4, 0x6B, 0x3C, 0xC0, 0x37, 0xC1, 0x3C, 0x01, 0x6F, 0xC0, 0x01, 0x5A, 0xFE, 0xBB, 0xD0, 0xA9,
+        0xBC, 0x11, 0x62, 0xA7, 0x66, 0xA2, 0x77, 0xC1, 0x11, 0x6E, 0x3E, 0x98, 0xBB, 0x16, 0x9C, 0xAA,
+        0xA2, 0x78, 0xA5, 0x66, 0x2A, 0x5A, 0x55, 0x10, 0x6B, 0x5A, 0x10, 0xC0, 0x18, 0x10, 0x7A, 0x10,
+        0xC0, 0x57, 0xC1, 0xA1, 0xC5, 0xC0, 0x0D, 0x12, 0x0B, 0xC1, 0x6E, 0x12, 0x6F, 0xC0, 0x69, 0x1C,
+        0x15, 0xC0, 0x69, 0x15, 0x1C, 0xC0, 0xFE, 0x9D, 0x3E, 0xAA, 0x41, 0xA3, 0x98, 0xA2, 0x77, 0x67,
+        0x62, 0x73, 0x66, 0xC0, 0x09, 0x52, 0xFE, 0x95, 0x8E, 0xA9, 0xA6, 0xFE, 0x7D, 0x33, 0xA8, 0xAE,
+        0xFE, 0x8D, 0x8D, 0x75, 0xA3, 0xCF, 0x12, 0xC6, 0x0D, 0x9B, 0xA8, 0x06, 0x0B, 0x12, 0xC1, 0xA1,
+        0x8A, 0x9D, 0x89, 0x8F, 0xB9, 0x50, 0xA5, 0x89, 0xAD, 0x69, 0x94, 0x9A, 0xBF, 0x54, 0xB9, 0x72,
+        0xB4, 0xA6, 0x7A, 0x9C, 0x7A, 0xFE, 0x6C, 0x12, 0xB0, 0x72, 0xAF, 0xCB, 0x6B, 0xC3, 0x2A, 0x31,
+        0xCA, 0x2A, 0x23, 0x69, 0xC0, 0x15, 0x23, 0x1C, 0xC0, 0x2D, 0x93, 0xFE, 0x2C, 0x19, 0x66, 0x61,
+        0x5A, 0x9B, 0xBA, 0x6E, 0x94, 0xFC, 0xAE, 0x14, 0x9D, 0xA9, 0x8E, 0xDA, 0x99, 0x96, 0xFE, 0xDE,
+        0xB8, 0x12, 0xC5, 0x51, 0x90, 0xC8, 0x95, 0xD9, 0x7A, 0xAA, 0x38, 0x3E, 0x06, 0xC0, 0x6B, 0x12,
+        0xC1, 0x02, 0xFE, 0xCA, 0x50, 0xB9, 0x26, 0x93, 0xEC, 0xAC, 0x33, 0x56, 0x99, 0xCC, 0xA8, 0x55,
+        0xA5, 0x67, 0xC0, 0x97, 0xCB, 0xA4, 0x67, 0x3B, 0x66, 0xFE, 0xF3, 0x17, 0xAC, 0x23, 0xFE, 0xF7,
+        0x7E, 0xA3, 0x87, 0x5D, 0x66, 0x46, 0x6B, 0x6B, 0x17, 0x10, 0xC0, 0x79, 0x10, 0x5B, 0x66, 0xC0,
+        0x6D, 0x0F, 0x06, 0xC0, 0x0B, 0x12, 0x0B, 0x6F, 0xC0, 0x69, 0x12, 0x6B, 0x17, 0x10, 0x1C, 0xC3,
+        0x69, 0x1C, 0xFE, 0xA5, 0x7E, 0xAA, 0x42, 0x9D, 0x99, 0xA5, 0x87, 0xC0, 0x9D, 0xAC, 0x18, 0xC1,
+        0x56, 0x98, 0x87, 0xFE, 0xAE, 0x2F, 0x9D, 0x88, 0xFE, 0xA5, 0xDB, 0x44, 0xFE, 0xAE, 0x0E, 0x92,
+        0x4A, 0xAA, 0xD8, 0xAE, 0xBE, 0x12, 0xC6, 0x61, 0x0B, 0xC0, 0x12, 0xC3, 0x6F, 0xC1, 0x9A, 0x89,
+        0x87, 0xC8, 0xFE, 0x43, 0xA8, 0x1D, 0xA8, 0xA6, 0x4A, 0x8D, 0x7C, 0xA7, 0x9B, 0xB0, 0xCC, 0x31,
+        0xC4, 0x69, 0x31, 0xC9, 0x2A, 0x69, 0xC2, 0x1C, 0x2A, 0x23, 0x50, 0x9B, 0xAB, 0xFE, 0xF4, 0x19,
+        0xB0, 0x12, 0x9A, 0xAA, 0xA9, 0x45, 0x96, 0xDB, 0x9C, 0xAA, 0xA8, 0x44, 0x9C, 0xB8, 0x63, 0x52,
+        0x3E, 0x90, 0xFC, 0x99, 0x74, 0xA6, 0x36, 0xBE, 0x05, 0x12, 0xC4, 0x92, 0xA8, 0xFE, 0xEC, 0xB1,
+        0xA5, 0x68, 0x9D, 0x99, 0xA2, 0x88, 0xA5, 0x38, 0xAF, 0x67, 0x12, 0xC0, 0x0B, 0x12, 0x19, 0x8C,
+        0xA9, 0xFE, 0xF3, 0xF7, 0x6E, 0xAA, 0x44, 0xC2, 0x99, 0xBB, 0x1B, 0xAC, 0x34, 0xA3, 0x68, 0x95,
+        0xEC, 0xA7, 0x66, 0x3E, 0xFE, 0xF3, 0x57, 0x9D, 0x87, 0xFE, 0xDD, 0x76, 0xB4, 0x15, 0x55, 0x57,
+        0xC0, 0xA0, 0x8A, 0xC0, 0x69, 0x10, 0xC2, 0x14, 0x67, 0x68, 0x0D, 0xC0, 0x9F, 0xD7, 0xC2, 0x0B,
+        0xC0, 0x12, 0x0B, 0x6E, 0xC1, 0x6B, 0x1C, 0x69, 0xC0, 0x1C, 0xC2, 0xFE, 0xA5, 0x7D, 0x27, 0x9A,
+        0x9A, 0x69, 0xA5, 0x88, 0x62, 0x73, 0xC1, 0x56, 0x97, 0x65, 0xFE, 0xBE, 0x8F, 0xFE, 0x7D, 0x33,
+        0xA9, 0xBF, 0x96, 0x52, 0xFE, 0x9D, 0xCD, 0x93, 0x4E, 0xB2, 0xD1, 0xFE, 0xB5, 0xB4, 0x12, 0xD1,
+        0x9D, 0x98, 0x8C, 0xB8, 0xFE, 0x54, 0x28, 0xB3, 0xC4, 0xA3, 0x99, 0x94, 0x69, 0x9F, 0x8D, 0xB1,
+        0xCE, 0x31, 0xD3, 0x69, 0xC3, 0x69, 0x8F, 0xFA, 0x97, 0xDB, 0xA0, 0x9D, 0x99, 0xCB, 0xAA, 0x44,
+        0x5A, 0x0A, 0x69, 0x9B, 0xB9, 0x9D, 0xA9, 0xA2, 0x78, 0x93, 0xEE, 0xAE, 0x23, 0x98, 0xBA, 0xA4,
+        0x66, 0x93, 0xA6, 0xFE, 0xC5, 0x95, 0x12, 0x0B, 0x12, 0xC2, 0x55, 0x96, 0xA9, 0xA4, 0x78, 0xA4,
+        0x77, 0x9C, 0x98, 0xA3, 0x89, 0x12, 0xC1, 0x0B, 0x12, 0x9A, 0x78, 0xFE, 0xDB, 0x34, 0xA2, 0xA9,
+        0xAD, 0x34, 0x1C, 0x17, 0x66, 0x06, 0xC0, 0x66, 0x9A, 0xBB, 0xA2, 0x68, 0xAB, 0x45, 0x94, 0xDC,
+        0xAB, 0x35, 0xFE, 0xF3, 0xD7, 0x91, 0xE8, 0xA6, 0x65, 0xFE, 0xEF, 0x1A, 0xA7, 0x69, 0x54, 0x57,
+        0xA0, 0x8A, 0xC0, 0x69, 0x10, 0x7A, 0x6E, 0x10, 0x5A, 0x6B, 0x0D, 0x10, 0x13, 0x9F, 0xB7, 0xC4,
+        0x0B, 0x6F, 0xC0, 0x69, 0xC0, 0x17, 0xA1, 0x8A, 0x69, 0x69, 0x17, 0x1C, 0xC0, 0x15, 0xFE, 0xAD,
+        0x7D, 0xAC, 0x33, 0x69, 0x95, 0xAD, 0xA6, 0x76, 0xA2, 0x98, 0x73, 0x5A, 0xC0, 0x66, 0x99, 0x60,
+        0xA3, 0x92, 0xFE, 0xA5, 0xFC, 0x3C, 0xFE, 0x7D, 0x2C, 0x9E, 0x7E, 0x6E, 0xA0, 0xA3, 0xFE, 0x74,
+        0x55, 0xB3, 0xC3, 0xA8, 0x87, 0xCE, 0x0B, 0x12, 0x97, 0xC8, 0x8D, 0x14, 0xA9, 0x84, 0xAA, 0x96,
+        0x9B, 0x79, 0x96, 0x7E, 0xB2, 0xBD, 0xA8, 0xAA, 0xD2, 0x66, 0x69, 0x62, 0x2C, 0x31, 0xC0, 0x69,
+        0x9A, 0xA7, 0xFE, 0xF4, 0x94, 0x9B, 0xAA, 0x9C, 0xAD, 0xA6, 0x68, 0xA8, 0x44, 0xA8, 0x56, 0x65,
+        0x9A, 0xB9, 0x61, 0xC0, 0x5F, 0x06, 0x3B, 0x00, 0x61, 0xA7, 0x56, 0x50, 0xA9, 0x16, 0x12, 0xC4,
+        0x69, 0xC2, 0x12, 0xC1, 0x0B, 0x12, 0x9D, 0x89, 0x86, 0xDC, 0xFE, 0xE2, 0x75, 0x0C, 0xAB, 0x34,
+        0x17, 0xC2, 0x65, 0x62, 0x5A, 0xC0, 0x2F, 0xA9, 0x47, 0x96, 0xDB, 0x68, 0x8F, 0xF8, 0xA5, 0x9A,
+        0xFE, 0xDC, 0x72, 0xB1, 0x29, 0xA6, 0x57, 0xA3, 0x68, 0xC2, 0x69, 0x7E, 0x13, 0x10, 0xC3, 0x18,
+        0x9E, 0xB7, 0xC1, 0x6E, 0x06, 0xC0, 0x0B, 0xC0, 0x6E, 0xC1, 0x6B, 0x2A, 0xC0, 0x1C, 0x17, 0x1C,
+        0x6B, 0x1C, 0xFE, 0xB5, 0xBD, 0xA9, 0x34, 0x20, 0x18, 0x93, 0xBE, 0xA9, 0x85, 0x15, 0xC1, 0x65,
+        0xFE, 0x8D, 0x6E, 0xFE, 0x85, 0x36, 0xA8, 0xAD, 0x99, 0x65, 0xFE, 0x54, 0x8C, 0xFE, 0x9E, 0x1B,
+        0x8E, 0x50, 0xFE, 0x8D, 0x5A, 0x9E, 0x9B, 0x9A, 0xB5, 0xB8, 0x91, 0x12, 0xC0, 0x9C, 0x88, 0x9B,
+        0x88, 0x6F, 0xA3, 0xA8, 0x56, 0x51, 0x2A, 0x0B, 0x12, 0xC4, 0x55, 0x8C, 0xB8, 0x9D, 0x02, 0xAD,
+        0xA4, 0x65, 0x93, 0x7E, 0xAF, 0xAE, 0xAC, 0xBB, 0xD1, 0x61, 0x62, 0x9C, 0x99, 0x99, 0xCC, 0x9C,
+        0xA8, 0x66, 0xA5, 0x67, 0xA5, 0x77, 0x59, 0x8F, 0xF8, 0x9D, 0xCB, 0x9A, 0x98, 0xA0, 0x7A, 0xAC,
+        0x57, 0x6F, 0x9B, 0xBA, 0x9D, 0xA9, 0x75, 0xC0, 0x5A, 0xA3, 0x77, 0xA6, 0x56, 0x7F, 0x1B, 0x9A,
+        0xBA, 0xAB, 0x35, 0xA5, 0x76, 0x99, 0x89, 0xFE, 0xCE, 0x37, 0xAC, 0x87, 0xC0, 0x69, 0xC0, 0x12,
+        0xC3, 0x0B, 0x12, 0xC0, 0x56, 0x97, 0x99, 0x98, 0x7B, 0xFE, 0xCB, 0x13, 0xAA, 0x05, 0xB5, 0x45,
+        0xFE, 0xF5, 0x9A, 0x1B, 0x17, 0xC0, 0x69, 0x66, 0x01, 0x9C, 0x9A, 0x9D, 0xBA, 0x9D, 0x99, 0xA4,
+        0x67, 0xA7, 0x66, 0x96, 0xBA, 0x95, 0xE8, 0xA3, 0x88, 0x5F, 0xFE, 0xE5, 0x37, 0xA0, 0xAB, 0xAC,
+        0x05, 0x9F, 0x5A, 0x9A, 0x8A, 0xA5, 0x96, 0xAA, 0x73, 0xC2, 0x6B, 0x10, 0x69, 0x7F, 0xC0, 0x9D,
+        0xC8, 0x6E, 0xC0, 0x6F, 0x06, 0xC0, 0x6E, 0xC3, 0x6F, 0x69, 0xC0, 0x17, 0x10, 0x17, 0xA1, 0x8A,
+        0xC0, 0x92, 0x8D, 0xA3, 0x38, 0xA7, 0xC6, 0x7E, 0x98, 0x5B, 0x92, 0xAF, 0xAA, 0x84, 0x7F, 0xC0,
+        0x9C, 0x65, 0x9A, 0x60, 0xFE, 0x8C, 0xFC, 0xA9, 0x97, 0xFE, 0x54, 0x4F, 0xAA, 0xAD, 0xA3, 0x9A,
+        0x99, 0x76, 0xA7, 0xBD, 0x52, 0x9D, 0xD8, 0xFE, 0xC5, 0x73, 0x06, 0x6F, 0xFE, 0xC4, 0x0E, 0xA4,
+        0x89, 0xAB, 0x39, 0xA6, 0x58, 0xA5, 0x99, 0x25, 0x9C, 0x88, 0x35, 0xA8, 0x87, 0x12, 0xC2, 0x69,
+        0x96, 0xAA, 0x8F, 0x22, 0xA8, 0x84, 0xA8, 0x97, 0x90, 0x5C, 0xAD, 0xBD, 0xAF, 0xBC, 0x2A, 0x6B,
+        0xCF, 0x66, 0x16, 0x9D, 0x99, 0x97, 0xDC, 0xA4, 0x76, 0x46, 0x99, 0xAC, 0x98, 0xAC, 0x5E, 0xA4,
+        0x57, 0x99, 0x9A, 0x97, 0xE8, 0x9E, 0xC2, 0xFE, 0x92, 0xB7, 0xA5, 0x9A, 0xAC, 0xA0, 0xA2, 0x95,
+        0xC0, 0xA2, 0x77, 0x67, 0x69, 0x56, 0x72, 0x0B, 0xC0, 0x9B, 0xBB, 0x94, 0xDD, 0xAD, 0x23, 0x19,
+        0x9A, 0xAA, 0xA4, 0x14, 0xAD, 0x56, 0xA7, 0x98, 0xC6, 0x52, 0x21, 0x99, 0x8B, 0xA5, 0x8B, 0xC0,
+        0x99, 0xC8, 0x98, 0xC9, 0xAF, 0x05, 0xAF, 0x96, 0x9C, 0xAA, 0xFE, 0xF4, 0xF9, 0x9A, 0xB8, 0xA6,
+        0x57, 0xC0, 0x69, 0x3C, 0x34, 0x06, 0x05, 0xFE, 0xD3, 0x39, 0x9B, 0x68, 0x9A, 0xD0, 0xA1, 0x6E,
+        0xB0, 0x45, 0xA2, 0x6C, 0xA0, 0x2A, 0x96, 0x3E, 0xA5, 0x86, 0xA6, 0x95, 0xFE, 0xC6, 0x9D, 0xA9,
+        0x84, 0xC1, 0x14, 0x67, 0x69, 0x10, 0x7E, 0xC0, 0x9C, 0xC8, 0x6E, 0xC1, 0x6B, 0x6D, 0x6E, 0xA1,
+        0x8A, 0xC0, 0x69, 0x0B, 0x6E, 0xC4, 0x17, 0x1C, 0x95, 0x8F, 0x9E, 0x49, 0xAD, 0xD4, 0xC0, 0x9A,
+        0x4A, 0x97, 0x9C, 0x96, 0xAD, 0xAA, 0x74, 0x7E, 0x96, 0x53, 0xA3, 0xAD, 0x99, 0xBF, 0xAA, 0x61,
+        0x99, 0x64, 0xAC, 0x9D, 0x9D, 0x88, 0x7F, 0x9A, 0xAC, 0x65, 0xFE, 0xEF, 0x3C, 0x9A, 0xB6, 0x99,
+        0x79, 0xB1, 0x67, 0x88, 0xFA, 0xFE, 0xE3, 0x8D, 0xA6, 0x57, 0x66, 0x56, 0xA4, 0x68, 0xA7, 0x59,
+        0xA2, 0x68, 0xA3, 0x67, 0x12, 0xC1, 0x06, 0x97, 0x89, 0x8D, 0x55, 0xA9, 0x63, 0xA7, 0xB7, 0x95,
+        0x6E, 0xA4, 0x79, 0xB3, 0xEC, 0x1C, 0xC0, 0x23, 0x6B, 0x31, 0xCD, 0x9C, 0xA9, 0x9D, 0xAA, 0x9C,
+        0xA9, 0xA1, 0x58, 0x95, 0x5F, 0x9B, 0x6B, 0xA3, 0xC7, 0xA5, 0xB5, 0xA2, 0x97, 0x78, 0x9C, 0xBA,
+        0x9E, 0xB8, 0x94, 0x6B, 0xFE, 0x2B, 0x1E, 0x57, 0x9E, 0xB8, 0xFE, 0xAB, 0xBB, 0xFE, 0xEB, 0xD7,
+        0xA6, 0x66, 0xA4, 0x76, 0x6E, 0x65, 0x52, 0x99, 0xCB, 0x96, 0xDD, 0x66, 0xAD, 0x23, 0xC0, 0x2F,
+        0x20, 0xA3, 0x59, 0xA6, 0x05, 0x9E, 0x65, 0xA5, 0xA6, 0xA8, 0x78, 0xA6, 0x77, 0xA2, 0x99, 0x55,
+        0x9B, 0x99, 0x95, 0x99, 0x95, 0xD8, 0xA9, 0x3D, 0xA6, 0x78, 0x66, 0x32, 0x2D, 0xFE, 0xCA, 0xF1,
+        0xFE, 0x94, 0xB5, 0x92, 0x8E, 0xB0, 0x83, 0xAB, 0x87, 0xA4, 0xB6, 0x9C, 0xB9, 0x66, 0xC0, 0xA2,
+        0x77, 0x6E, 0xFE, 0xC4, 0x1B, 0xFE, 0x52, 0x3D, 0xFE, 0x02, 0x7E, 0x76, 0xFE, 0xA2, 0xD4, 0xAE,
+        0x58, 0x9B, 0x8B, 0xA4, 0x77, 0xA0, 0xC7, 0xAA, 0x52, 0x9D, 0xAA, 0xFE, 0xE7, 0xBD, 0xC2, 0x5A,
+        0x10, 0x5B, 0x10, 0x7E, 0x66, 0x18, 0x9C, 0xC8, 0xC0, 0x6B, 0xC0, 0x6F, 0x69, 0x6E, 0x6E, 0x6E,
+        0xC0, 0x1E, 0x12, 0x0B, 0x6E, 0x17, 0xC1, 0x6E, 0xC0, 0x98, 0x8C, 0x99, 0x5E, 0xAF, 0xC2, 0xC0,
+        0x9C, 0x59, 0x9B, 0x6B, 0x97, 0xBC, 0x98, 0x9D, 0xA9, 0x83, 0x99, 0x63, 0xA8, 0xBF, 0x96, 0x8A,
+        0x9F, 0x64, 0xAB, 0xA9, 0xA2, 0x79, 0x3E, 0x67, 0x9A, 0x89, 0xA2, 0xA7, 0x12, 0x61, 0xFE, 0xAC,
+        0x98, 0xA5, 0x73, 0xAC, 0x75, 0xFE, 0xC3, 0x4B, 0xA2, 0xA8, 0xC0, 0x55, 0x6B, 0xA3, 0x89, 0xA3,
+        0x78, 0xFE, 0xD6, 0x36, 0x12, 0x65, 0x97, 0x88, 0x94, 0x77, 0xA6, 0x61, 0x9A, 0x59, 0xA3, 0x98,
+        0x9F, 0x9D, 0xA5, 0x9B, 0xAB, 0xA9, 0x1C, 0xC0, 0xA0, 0x8A, 0xC0, 0x6B, 0xCD, 0x62, 0x98, 0xCA,
+        0xA4, 0x67, 0xA4, 0x66, 0x9B, 0xAA, 0x98, 0x7C, 0x9E, 0xD8, 0x9C, 0xB8, 0x53, 0x69, 0x9B, 0xCA,
+        0xA2, 0x78, 0xAC, 0x32, 0xFE, 0xAA, 0xF7, 0xFE, 0x23, 0x5F, 0x5A, 0x9D, 0xA9, 0x62, 0xFE, 0x6A,
+        0xBC, 0xFE, 0xCD, 0x19, 0x9D, 0xCA, 0x9C, 0xB8, 0x72, 0x9D, 0xB9, 0xC0, 0x6E, 0x5F, 0xA2, 0x77,
+        0xA2, 0x58, 0xA7, 0x47, 0xA6, 0x36, 0x5A, 0xC0, 0x99, 0x97, 0xFE, 0xE4, 0xD0, 0x6F, 0x9D, 0x79,
+        0x9C, 0x68, 0x65, 0xA4, 0xA8, 0xA5, 0xA8, 0x02, 0xFE, 0x8C, 0x74, 0xAD, 0x99, 0xA2, 0x87, 0xA3,
+        0x88, 0xA5, 0x98, 0xFE, 0xF4, 0xF6, 0xA4, 0x27, 0x89, 0x2E, 0x56, 0x9D, 0x9A, 0x67, 0xB4, 0x92,
+        0xB3, 0x83, 0xA8, 0x86, 0xC0, 0x96, 0x8D, 0xFE, 0x0A, 0x1E, 0xA4, 0x56, 0x6F, 0x9D, 0xB9, 0xFE,
+        0xAA, 0x31, 0xB6, 0x64, 0xA9, 0x56, 0xA2, 0x78, 0x55, 0x22, 0x9B, 0xBA, 0xA7, 0x46, 0xFE, 0xE7,
+        0x9D, 0x6F, 0xC0, 0x69, 0x5A, 0x10, 0x7E, 0x7B, 0x2A, 0x55, 0x9C, 0xB8, 0xC0, 0x6E, 0x3C, 0x6B,
+        0x01, 0x6E, 0x6F, 0x69, 0xC2, 0xA0, 0x8A, 0xC0, 0x12, 0x6F, 0x69, 0xC1, 0x9C, 0x7A, 0xFE, 0x95,
+        0x9E, 0x2A, 0x6B, 0x9C, 0x69, 0x9C, 0x49, 0x9D, 0xAB, 0x95, 0xBE, 0x98, 0x64, 0xAC, 0xA9, 0xA3,
+        0x89, 0x9A, 0x89, 0x9A, 0x77, 0x3E, 0x6E, 0x3E, 0x52, 0x9A, 0x9B, 0xA9, 0xC2, 0x06, 0x93, 0xAE,
+        0xFE, 0x6B, 0x5C, 0xFE, 0xB4, 0x92, 0xA6, 0x76, 0xA8, 0x78, 0x96, 0xB8, 0x9A, 0xB8, 0xC0, 0xA2,
+        0x78, 0xA7, 0x59, 0xAB, 0x57, 0xA2, 0x88, 0x95, 0xAA, 0x9D, 0x63, 0x9E, 0x55, 0xA8, 0x95, 0x94,
+        0x6B, 0xA4, 0x88, 0xA2, 0x9C, 0xAF, 0xBB, 0x9A, 0x78, 0xAC, 0xA9, 0xC0, 0x69, 0x23, 0xC1, 0x2A,
+        0xC0, 0x6B, 0xCA, 0x97, 0xCB, 0xA2, 0x87, 0x20, 0x9C, 0xA9, 0x00, 0x05, 0x6E, 0x05, 0x00, 0x9C,
+        0x99, 0x7A, 0x69, 0x99, 0xBB, 0x87, 0xDF, 0xFE, 0x23, 0x5E, 0x66, 0x9D, 0xE9, 0xA7, 0xB3, 0xA6,
+        0xC2, 0xFE, 0xC2, 0x90, 0xAE, 0x16, 0xAD, 0x28, 0xC1, 0x5A, 0x6E, 0x35, 0x32, 0xC1, 0x2D, 0x32,
+        0xC0, 0x9A, 0x97, 0xFE, 0xE4, 0xD1, 0xA2, 0x87, 0x7A, 0xC2, 0xA2, 0x78, 0x56, 0x93, 0x3B, 0xBD,
+        0x59, 0xA5, 0x88, 0x7E, 0xC0, 0x95, 0xDA, 0x93, 0xEA, 0xFE, 0x53, 0x11, 0x9F, 0x7B, 0x66, 0x69,
+        0x66, 0x9B, 0x9B, 0xBB, 0xA1, 0xB3, 0x84, 0x56, 0x94, 0x9E, 0xFE, 0x84, 0x5E, 0xFE, 0x0A, 0x3E,
+        0xA0, 0xA7, 0xFE, 0xD4, 0x34, 0xA3, 0x88, 0xA3, 0xAA, 0xA8, 0x46, 0xA2, 0x88, 0xC0, 0x14, 0x5A,
+        0x9B, 0xBB, 0xA7, 0x45, 0xA8, 0x36, 0x67, 0x9C, 0xA9, 0xA2, 0x87, 0x13, 0x6E, 0x31, 0x55, 0x06,
+        0x01, 0x66, 0xC1, 0x01, 0x12, 0x6F, 0x6F, 0x17, 0xC0, 0x65, 0x67, 0x12, 0x0B, 0x12, 0x6D, 0xC0,
+        0x6F, 0x52, 0xFE, 0x85, 0x3E, 0xFE, 0xEF, 0xBE, 0x31, 0x9B, 0x4A, 0x9C, 0x79, 0x63, 0x9C, 0xAB,
+        0x95, 0x89, 0xA0, 0x9B, 0xA8, 0x85, 0xC0, 0x94, 0x9D, 0xAD, 0x73, 0xA2, 0x77, 0x6B, 0x98, 0x9B,
+        0xC0, 0xFE, 0xE6, 0xBB, 0x65, 0xFE, 0x4A, 0x5C, 0xFE, 0xDE, 0xDC, 0x98, 0xB4, 0x9C, 0xD8, 0x9C,
+        0x59, 0xAE, 0x47, 0xA7, 0x89, 0x66, 0x9B, 0x98, 0x99, 0x99, 0x99, 0xC9, 0x9B, 0xA9, 0x7D, 0x9C,
+        0x47, 0xAD, 0x00, 0x96, 0x6B, 0xA4, 0xA7, 0xA3, 0xAE, 0xB5, 0xB9, 0x98, 0x77, 0x17, 0x6F, 0xC0,
+        0x69, 0xC0, 0x23, 0xC0, 0x2A, 0xC0, 0x31, 0xC9, 0x98, 0xBA, 0x25, 0xA4, 0x66, 0x9A, 0xAB, 0xA2,
+        0x88, 0x0A, 0x6F, 0x6E, 0x16, 0x0A, 0x9D, 0xA9, 0x62, 0x61, 0x91, 0xFD, 0x92, 0xA7, 0xFE, 0x3A,
+        0x9C, 0xFE, 0xA5, 0x7D, 0xB2, 0x90, 0x99, 0x89, 0x95, 0x9A, 0x77, 0x94, 0xF9, 0x99, 0xCA, 0xB3,
+        0x07, 0xA5, 0x68, 0x5E, 0xC7, 0x9C, 0x88, 0x9E, 0xF3, 0xAA, 0x77, 0x9D, 0x99, 0x61, 0xA3, 0x78,
+        0xA4, 0x78, 0xA4, 0x68, 0x62, 0x96, 0xB8, 0xA3, 0x2B, 0x31, 0xC1, 0x61, 0xFE, 0xF3, 0xF3, 0xFE,
+        0x84, 0x13, 0x97, 0x6D, 0xC3, 0x9D, 0x8A, 0xBC, 0xA0, 0xAE, 0x85, 0x7F, 0xC0, 0x93, 0x8F, 0xFE,
+        0x7A, 0xBC, 0xFE, 0xF5, 0x58, 0x89, 0xF9, 0xB6, 0x29, 0x9D, 0xAA, 0xA6, 0x55, 0xA6, 0x66, 0x6F,
+        0x52, 0x9D, 0xAA, 0xC0, 0x9C, 0xA9, 0x6B, 0xA3, 0x77, 0xC0, 0x99, 0xCB, 0xAE, 0x13, 0xAB, 0x35,
+        0x66, 0x06, 0xC0, 0x01, 0x66, 0xC0, 0x01, 0x06, 0x0B, 0x12, 0x0B, 0xC0, 0x12, 0xC1, 0x0B, 0xC0,
+        0x17, 0xC1, 0x23, 0xFE, 0x84, 0xFD, 0xB1, 0x70, 0xA2, 0x98, 0x9D, 0x69, 0x66, 0x67, 0x9C, 0xAB,
+        0x65, 0x96, 0x9D, 0x54, 0xA7, 0x87, 0x99, 0x9B, 0xA4, 0x87, 0xA7, 0x75, 0x67, 0x98, 0x9B, 0x69,
+        0xFE, 0xEE, 0x79, 0xFE, 0x83, 0x9B, 0xAD, 0x63, 0x06, 0x52, 0x9C, 0xA7, 0x93, 0xF9, 0x9C, 0x78,
+        0x9D, 0x89, 0x55, 0x3A, 0xA3, 0x98, 0xC0, 0x61, 0x16, 0xFE, 0x74, 0x4A, 0xA0, 0xCA, 0xA1, 0x35,
+        0xFE, 0x4B, 0x92, 0x80, 0xC1, 0x78, 0xC0, 0xA3, 0x89, 0x1C, 0xC1, 0x23, 0x31, 0xCA, 0x66, 0x95,
+        0x98, 0x65, 0x6E, 0x30, 0x35, 0xA2, 0x88, 0x35, 0x73, 0x7F, 0xA1, 0xA9, 0x9D, 0xBA, 0x5A, 0xA4,
+        0x67, 0xA2, 0x87, 0x95, 0xDC, 0x61, 0x90, 0xE7, 0xFE, 0xE6, 0xFC, 0x31, 0xC1, 0x2C, 0x97, 0x88,
+        0x93, 0x9B, 0xA1, 0xBA, 0xFE, 0xBB, 0x11, 0xB0, 0x06, 0x32, 0x66, 0x32, 0xC4, 0x7A, 0xA4, 0x77,
+        0x9B, 0x96, 0x12, 0xC0, 0x0B, 0x12, 0x0B, 0x12, 0xC0, 0x61, 0x8F, 0x9A, 0x31, 0xC2, 0xFE, 0xF4,
+        0x13, 0xFE, 0xA4, 0x94, 0x93, 0x4E, 0xC4, 0x63, 0xFE, 0xEF, 0x7C, 0x2A, 0xC0, 0x31, 0x52, 0xFE,
+        0xEC, 0xB8, 0x93, 0xD7, 0xAF, 0x26, 0x27, 0x9C, 0xA9, 0x27, 0xA3, 0x77, 0xA3, 0x88, 0xA4, 0x66,
+        0x9D, 0xAA, 0x5B, 0xA8, 0x56, 0xA2, 0x77, 0x61, 0x9B, 0xBA, 0x94, 0xDD, 0xAF, 0x03, 0xA6, 0x55,
+        0x06, 0x12, 0x01, 0x66, 0x67, 0x3C, 0x01, 0x06, 0x0B, 0xC0, 0xA1, 0x8A, 0x6E, 0x0B, 0x17, 0x0B,
+        0xC0, 0x17, 0xC1, 0x1C, 0xFE, 0x95, 0x3E, 0x1D, 0x5A, 0xC0, 0x66, 0x66, 0x9C, 0xBB, 0x67, 0x66,
+        0x97, 0x9C, 0x54, 0xA4, 0x87, 0x98, 0x8C, 0xAD, 0x83, 0x6F, 0x98, 0x9A, 0x66, 0x9F, 0xF4, 0xFE,
+        0x3A, 0x5D, 0xFE, 0xEF, 0x5C, 0x7D, 0x12, 0xC0, 0x9A, 0xB7, 0x95, 0xD9, 0x9D, 0xA8, 0x66, 0xC0,
+        0x1E, 0x6F, 0xA3, 0x79, 0x9B, 0x47, 0xFE, 0x5B, 0x52, 0x7B, 0xA3, 0x65, 0xFE, 0x93, 0x38, 0xFE,
+        0xAD, 0x15, 0xB5, 0x73, 0x7C, 0xA1, 0x8A, 0x1C, 0x23, 0xC1, 0x31, 0xC8, 0x9C, 0x88, 0x8F, 0xA8,
+        0xA3, 0x99, 0xA7, 0x87, 0x3E, 0x93, 0x9A, 0xA4, 0x97, 0xA8, 0x68, 0x9A, 0x99, 0x9B, 0x98, 0xAB,
+        0x88, 0x5E, 0x30, 0x9E, 0xBA, 0xA4, 0x98, 0x9B, 0xBB, 0x24, 0xA3, 0x77, 0x9D, 0x98, 0x95, 0xE7,
+        0xFE, 0xF7, 0x9E, 0x31, 0xC3, 0x02, 0x90, 0x9A, 0xAB, 0x89, 0xFE, 0xDC, 0x95, 0x52, 0xFE, 0xC6,
+        0x3B, 0x6B, 0x3A, 0x01, 0xA2, 0x87, 0xA2, 0x87, 0xA3, 0x98, 0xA4, 0x77, 0x31, 0x91, 0x99, 0xAC,
+        0x85, 0x12, 0xC4, 0x69, 0x8F, 0xCA, 0xAE, 0x3A, 0x31, 0xC1, 0xFE, 0xFC, 0xF6, 0x9C, 0x18, 0x94,
+        0x1D, 0xC4, 0x56, 0xB0, 0xA4, 0xB9, 0x82, 0x7B, 0x31, 0xC0, 0xFE, 0xF5, 0xBB, 0xFE, 0xDA, 0x91,
+        0xA4, 0x74, 0xFE, 0xF6, 0x1A, 0x7A, 0x6E, 0x0F, 0xA2, 0x77, 0x1E, 0x6F, 0x2F, 0xA3, 0x78, 0x61,
+        0x19, 0x14, 0x5B, 0x22, 0xAA, 0x35, 0x9E, 0xA6, 0x62, 0xC0, 0x66, 0x6B, 0x37, 0xA2, 0x77, 0x12,
+        0x6F, 0x6F, 0x31, 0x2A, 0x1E, 0xC0, 0x12, 0x69, 0x17, 0xC0, 0x6F, 0xC0, 0xFE, 0x9D, 0x3D, 0x1D,
+        0x56, 0xC1, 0x66, 0x9D, 0xBB, 0x9D, 0xAB, 0xC0, 0x59, 0x97, 0xAC, 0x41, 0x9C, 0x9A, 0xAA, 0x74,
+        0xA5, 0x88, 0x9B, 0x9A, 0x52, 0xFE, 0x42, 0x5C, 0xFE, 0xAD, 0x5C, 0xFE, 0xFF, 0xBB, 0x98, 0x99,
+        0xA2, 0x78, 0x0B, 0x12, 0x01, 0x61, 0x61, 0xC0, 0x6E, 0xA2, 0x78, 0x4A, 0xFE, 0x42, 0xD6, 0xFE,
+        0x19, 0xFA, 0xFE, 0x6C, 0x6C, 0xFE, 0xDD, 0xB6, 0x9C, 0xD5, 0x52, 0xA0, 0x28, 0xB3, 0x54, 0xA4,
+        0x8A, 0x1C, 0x23, 0x31, 0x69, 0x31, 0xC6, 0x9C, 0x88, 0x93, 0x98, 0x9C, 0x98, 0xA3, 0xA8, 0x97,
+        0x79, 0xB8, 0x77, 0x94, 0x99, 0xAA, 0x87, 0x88, 0x99, 0x0A, 0x94, 0x98, 0xAA, 0x89, 0x94, 0x98,
+        0x12, 0xC0, 0x90, 0x89, 0x9E, 0xBB, 0xB1, 0x67, 0x31, 0xC0, 0x93, 0xD9, 0x95, 0xEA, 0x31, 0xC4,
+        0x60, 0x9D, 0xA8, 0x05, 0xAA, 0x89, 0xFE, 0xF5, 0x16, 0x9C, 0xA9, 0xFE, 0xF7, 0x9E, 0x6F, 0x6E,
+        0x31, 0xC3, 0x09, 0x15, 0x06, 0x6E, 0x12, 0xC2, 0x9A, 0xA8, 0x90, 0x98, 0xAA, 0x4A, 0x31, 0xC1,
+        0xFE, 0xFD, 0x77, 0x99, 0x49, 0x93, 0x1E, 0xC5, 0x9B, 0x9B, 0xFE, 0xDF, 0x1C, 0x2A, 0xC0, 0x31,
+        0x98, 0xBA, 0xFE, 0xE4, 0x58, 0x96, 0xB3, 0xAB, 0x48, 0xAD, 0x69, 0x0F, 0xC0, 0xA2, 0x77, 0xC0,
+        0xA2, 0x77, 0x19, 0x96, 0xCC, 0x9C, 0xA9, 0xA3, 0x68, 0xA8, 0x55, 0xA9, 0x35, 0x9D, 0xAA, 0xA6,
+        0x57, 0x9D, 0xC6, 0x37, 0x6E, 0x37, 0xC1, 0x01, 0xC0, 0x12, 0x6F, 0x6B, 0x2A, 0xC1, 0x17, 0x0B,
+        0xC0, 0x17, 0xC0, 0x69, 0xFE, 0xB5, 0x9D, 0xA9, 0x24, 0x6E, 0xC1, 0x10, 0x9D, 0xAB, 0x9D, 0xAB,
+        0xC0, 0x66, 0x69, 0x9A, 0x8A, 0x9B, 0x9A, 0x52, 0xAD, 0x74, 0x3B, 0x65, 0xFE, 0x3A, 0x7D, 0xFE,
+        0xDE, 0xBB, 0x12, 0x9C, 0x98, 0x97, 0x89, 0x12, 0xC4, 0x0B, 0x12, 0x8C, 0x7E, 0xFE, 0x19, 0xDC,
+        0xFE, 0x3B, 0x72, 0xBC, 0xD0, 0xA5, 0xB9, 0x99, 0xB8, 0x95, 0xE9, 0x62, 0x9D, 0x49, 0xAB, 0x3B,
+        0xAD, 0x86, 0xA2, 0x87, 0xA0, 0x8A, 0xC5, 0x25, 0x94, 0x7F, 0x91, 0x9E, 0xFE, 0xBD, 0xD8, 0x99,
+        0xA6, 0xA5, 0x89, 0xA9, 0xA8, 0x15, 0xA9, 0x88, 0x9A, 0x99, 0xA5, 0x99, 0x91, 0x88, 0x12, 0x91,
+        0xAA, 0x37, 0x94, 0x88, 0x01, 0x56, 0x0B, 0x95, 0x89, 0xB4, 0x69, 0xA7, 0x98, 0xC0, 0x99, 0xA8,
+        0x62, 0x31, 0xC4, 0x9A, 0x88, 0x92, 0x9B, 0x8E, 0x7D, 0xA1, 0x85, 0xBE, 0x94, 0xFE, 0xF4, 0xD5,
+        0xA4, 0x68, 0x31, 0xC6, 0x8C, 0x98, 0xA1, 0xB7, 0x39, 0x12, 0xC2, 0x96, 0x98, 0xA7, 0x88, 0x92,
+        0x8B, 0xB3, 0x78, 0xC1, 0xFE, 0xF5, 0x98, 0x9B, 0x68, 0x90, 0x0E, 0xC5, 0x5A, 0xAE, 0xB5, 0x31,
+        0xC1, 0x22, 0xFE, 0xF5, 0xFB, 0x9F, 0x67, 0xA1, 0xA9, 0x97, 0xEB, 0xA4, 0x67, 0x03, 0x6E, 0x9D,
+        0xAA, 0x9C, 0x9A, 0xAA, 0x35, 0xA7, 0x46, 0x61, 0xC0, 0x62, 0x9B, 0xCA, 0x2E, 0xA7, 0x56, 0x9A,
+        0xD9, 0x37, 0x3C, 0xC0, 0x6E, 0x37, 0xA3, 0x78, 0x6F, 0x25, 0x6E, 0x25, 0x69, 0xC1, 0x12, 0x69,
+        0xC1, 0x6E, 0x6B, 0xFE, 0xCE, 0x3D, 0xA0, 0x18, 0xA5, 0x86, 0xA2, 0x97, 0x9D, 0x8A, 0xC0, 0x9D,
+        0xAB, 0x9D, 0xAB, 0x66, 0xC1, 0x69, 0x9B, 0x9A, 0x98, 0x8B, 0xA8, 0x75, 0x34, 0x66, 0x98, 0x8C,
+        0xFE, 0xE6, 0x58, 0x0D, 0x06, 0x9B, 0x9A, 0x12, 0xC1, 0x06, 0x9D, 0x99, 0x51, 0x12, 0x9B, 0x9A,
+        0xFE, 0x42, 0x9C, 0xA2, 0x76, 0xFE, 0xBE, 0x76, 0x12, 0xC1, 0x9C, 0xA8, 0x94, 0xD7, 0x9B, 0xB9,
+        0x9B, 0x6B, 0xFE, 0x9C, 0x9A, 0xB1, 0x74, 0xAA, 0x84, 0xC4, 0x9C, 0x89, 0x92, 0x7F, 0x94, 0x9B,
+        0xA9, 0x80, 0xFE, 0x62, 0xF5, 0xFE, 0xCE, 0x37, 0x7E, 0x9D, 0x99, 0xAC, 0x77, 0x93, 0x9A, 0x01,
+        0x99, 0x99, 0x46, 0xAA, 0x87, 0x10, 0x01, 0x9B, 0x89, 0x66, 0x0D, 0x3F, 0xA4, 0x88, 0x8A, 0x6B,
+        0xA8, 0x7D, 0xB5, 0x93, 0x24, 0xC0, 0x6E, 0x31, 0xC0, 0x66, 0x94, 0x8A, 0x8E, 0x7C, 0x90, 0x7C,
+        0x6D, 0x6E, 0x76, 0xAA, 0x93, 0xBD, 0x95, 0xFE, 0xF3, 0x92, 0xFE, 0xF6, 0x9B, 0x31, 0xC5, 0x9A,
+        0x88, 0x9A, 0x97, 0xA5, 0x87, 0xA5, 0x98, 0x12, 0xC1, 0x0B, 0xC0, 0x90, 0x9B, 0xB0, 0x68, 0x31,
+        0xC0, 0xFE, 0xFD, 0xB8, 0x99, 0x69, 0xFE, 0x4B, 0x12, 0x67, 0xC5, 0x9C, 0x8A, 0x85, 0xA0, 0x31,
+        0xC0, 0x55, 0xC0, 0x07, 0x90, 0xFD, 0xA2, 0x87, 0x9C, 0xAA, 0xAB, 0x35, 0x07, 0xA5, 0x67, 0xA9,
+        0x56, 0x6E, 0x55, 0x5A, 0x09, 0x5E, 0x18, 0x6B, 0x22, 0x9A, 0xC8, 0x6E, 0x3C, 0x0D, 0x6F, 0x3C,
+        0x0D, 0xA2, 0x78, 0x25, 0x31, 0xC0, 0x25, 0x1E, 0x19, 0x59, 0x06, 0x6E, 0xC0, 0x6E, 0x17, 0x98,
+        0x8C, 0x97, 0x2F, 0xAD, 0xB1, 0x31, 0x38, 0x9B, 0x5B, 0x73, 0x9C, 0xAB, 0x66, 0xC2, 0x66, 0x9C,
+        0x89, 0x9B, 0x89, 0xA7, 0x97, 0x15, 0xA4, 0x76, 0x95, 0xEB, 0xFE, 0xF6, 0xF9, 0x0B, 0x12, 0x0B,
+        0x12, 0x9B, 0x99, 0x92, 0xA8, 0xA5, 0x78, 0xAA, 0x79, 0x3E, 0xFE, 0x83, 0xFB, 0xFE, 0x42, 0x7D,
+        0xFE, 0xCE, 0x99, 0x12, 0x0B, 0x12, 0xC0, 0x0B, 0x01, 0x93, 0xE8, 0x98, 0xAB, 0xFE, 0x73, 0x9B,
+        0xB1, 0x72, 0xA9, 0x95, 0xA9, 0x95, 0xC1, 0x29, 0x9A, 0x8B, 0x97, 0x7C, 0x89, 0xAF, 0xA7, 0x90,
+        0xA6, 0x84, 0x78, 0xAA, 0x88, 0xAC, 0x87, 0x0D, 0xAA, 0x88, 0x98, 0x88, 0x12, 0x96, 0x88, 0x25,
+        0x12, 0x0D, 0x12, 0x66, 0x94, 0x88, 0x12, 0x90, 0x99, 0xAD, 0x98, 0x90, 0x78, 0x93, 0x8D, 0x9B,
+        0x6F, 0x9C, 0x9A, 0xA5, 0x86, 0x6F, 0x7E, 0xA7, 0x96, 0x9A, 0x9A, 0x92, 0x7C, 0xA8, 0x63, 0x6F,
+        0x04, 0x9D, 0x99, 0x56, 0x7A, 0xAF, 0x93, 0xB3, 0xD7, 0xFE, 0xF3, 0x51, 0xFE, 0xF7, 0x5D, 0xA5,
+        0x78, 0xC5, 0x8F, 0x99, 0x0D, 0x6E, 0xC0, 0x55, 0x9A, 0x99, 0x5A, 0x7F, 0x9D, 0x99, 0xA3, 0x69,
+        0x31, 0xC0, 0xFE, 0xFD, 0x77, 0x9D, 0x48, 0x8F, 0x1F, 0xC6, 0x10, 0xA7, 0xB8, 0x80, 0x80, 0x2A,
+        0x31, 0xC0, 0x59, 0x07, 0x61, 0xA6, 0x58, 0x31, 0xC0, 0x2A, 0x22, 0x1B, 0x5A, 0xC0, 0x56, 0x66,
+        0x18, 0x27, 0x22, 0x3C, 0x6F, 0xC0, 0x01, 0xA2, 0x79, 0x08, 0x0D, 0xA2, 0x79, 0xC0, 0x31, 0xC0,
+        0x2A, 0x96, 0xCC, 0x9B, 0xBA, 0x9A, 0xB9, 0x0D, 0x6D, 0xC1, 0x6E, 0x9D, 0x8B, 0xFE, 0x74, 0xFD,
+        0xFE, 0xEF, 0xBF, 0x31, 0x9E, 0x68, 0x98, 0x3B, 0x62, 0x9D, 0xBC, 0x62, 0xC3, 0x66, 0x41, 0x9C,
+        0x99, 0xA4, 0x87, 0x6E, 0x22, 0x97, 0xD9, 0xFE, 0xF7, 0x1A, 0x0B, 0x12, 0xC0, 0x9C, 0x88, 0x06,
+        0x12, 0x06, 0x90, 0x9F, 0xFE, 0x19, 0xDC, 0xFE, 0xC6, 0x1C, 0x12, 0x0B, 0x12, 0xC2, 0x61, 0x92,
+        0xD9, 0xFE, 0x8B, 0xBB, 0x22, 0x9B, 0x99, 0x7B, 0xB3, 0x90, 0xA4, 0x87, 0x03, 0x9F, 0x69, 0x9E,
+        0x69, 0xFE, 0x6B, 0x9B, 0xFE, 0xB5, 0x75, 0xA7, 0x87, 0xA4, 0x88, 0x9B, 0xA9, 0x40, 0xA5, 0x99,
+        0xA3, 0x99, 0x9B, 0x88, 0x2A, 0x12, 0x91, 0x99, 0xAE, 0x88, 0x12, 0x01, 0x12, 0xC0, 0x92, 0x89,
+        0x12, 0x3D, 0x61, 0xA8, 0x78, 0x83, 0x99, 0x9C, 0x4F, 0x9C, 0x8C, 0x9D, 0x99, 0xA7, 0x85, 0xC0,
+        0x56, 0x66, 0x56, 0xC0, 0x13, 0xC0, 0x5A, 0x61, 0x2B, 0x66, 0xB6, 0x91, 0xFE, 0xF5, 0xF9, 0x92,
+        0xFA, 0xFE, 0xFF, 0xBE, 0x31, 0xC4, 0x9B, 0x89, 0x99, 0x97, 0x39, 0x97, 0x89, 0x3D, 0xA5, 0x89,
+        0xA3, 0x98, 0x56, 0x1D, 0x9D, 0x89, 0xA4, 0x88, 0xA4, 0x88, 0xFE, 0xFD, 0x16, 0xA3, 0x17, 0x8C,
+        0x2E, 0x6E, 0xC0, 0x13, 0xC3, 0x10, 0x62, 0xB7, 0xA3, 0xB3, 0x95, 0xC1, 0x66, 0x31, 0x69, 0x59,
+        0x6B, 0x31, 0x55, 0x20, 0x56, 0x1B, 0x18, 0xC0, 0x66, 0x18, 0xC0, 0x22, 0x0D, 0x6B, 0x2A, 0x25,
+        0x65, 0x60, 0x12, 0x25, 0x31, 0xC1, 0x25, 0xFE, 0xF5, 0x9B, 0xA5, 0x76, 0x99, 0xCA, 0xAC, 0x24,
+        0xA8, 0x45, 0xC0, 0x65, 0xC1, 0xFE, 0x7C, 0xBD, 0xFE, 0xE7, 0x9E, 0xA3, 0xA8, 0x56, 0x97, 0x2B,
+        0x62, 0x9D, 0xAB, 0x73, 0xC4, 0x36, 0x1F, 0x3B, 0x56, 0x79, 0x57, 0x97, 0xCA, 0xFE, 0xEE, 0xBA,
+        0x0B, 0x6B, 0xC1, 0x0B, 0x9B, 0xAA, 0xFE, 0x5A, 0x9C, 0xAA, 0x63, 0xFE, 0xFF, 0x9C, 0x12, 0x0B,
+        0x12, 0xC1, 0x01, 0x94, 0xC9, 0xFE, 0x83, 0xFC, 0xAD, 0x54, 0x36, 0x3B, 0x9B, 0x9A, 0x66, 0xA7,
+        0x85, 0xA6, 0x65, 0x4A, 0x9A, 0x8A, 0xA2, 0xF7, 0xAC, 0x80, 0x12, 0x3E, 0x88, 0xB9, 0xA3, 0xB7,
+        0xA4, 0x89, 0xA2, 0x78, 0x9C, 0x68, 0xB1, 0x88, 0x01, 0x91, 0x89, 0x01, 0xC0, 0x8B, 0x99, 0xB1,
+        0xA8, 0xC0, 0x92, 0x79, 0xB0, 0x76, 0x9C, 0x99, 0x8A, 0x89, 0x01, 0x92, 0x89, 0x89, 0x7D, 0xA2,
+        0x5C, 0x9C, 0x9A, 0x9D, 0x8A, 0xA6, 0x85, 0xC7, 0x5A, 0x61, 0x64, 0xBC, 0x93, 0xFE, 0xF4, 0xF6,
+        0x6E, 0xFE, 0xF7, 0xDF, 0x7E, 0xC4, 0x92, 0x88, 0x8D, 0xB8, 0xB0, 0x97, 0x66, 0x9D, 0x88, 0xA2,
+        0x88, 0xA7, 0x88, 0xA9, 0x78, 0x12, 0x0D, 0x9C, 0x78, 0x94, 0xCA, 0x9C, 0x59, 0x9C, 0x69, 0xAC,
+        0x86, 0x9D, 0x99, 0x94, 0x7A, 0x97, 0x8C, 0x13, 0xC3, 0x9C, 0x8A, 0x83, 0xA0, 0x31, 0xC3, 0x2A,
+        0x1B, 0xC1, 0x5A, 0xC1, 0x56, 0x18, 0xC1, 0x66, 0x18, 0x76, 0x19, 0x6F, 0x31, 0x2A, 0x9C, 0xA7,
+        0x25, 0x31, 0xC3, 0xFE, 0xF5, 0x5B, 0x97, 0xDA, 0xA3, 0x77, 0xFE, 0xF7, 0x5B, 0xA3, 0x87, 0x6F,
+        0x0B, 0xC0, 0x19, 0xFE, 0x8C, 0xDD, 0xFE, 0xDF, 0x7E, 0x31, 0x56, 0x96, 0x2B, 0x03, 0x63, 0x3B,
+        0xC4, 0x55, 0x52, 0xA2, 0x98, 0x97, 0xE6, 0xFE, 0xD2, 0x91, 0xA7, 0x48, 0xFE, 0xAC, 0xBA, 0xA1,
+        0x5B, 0xAA, 0xC0, 0x01, 0x12, 0xC0, 0x0B, 0xFE, 0xCD, 0x59, 0xFE, 0x19, 0xBC, 0xFE, 0xD6, 0x9C,
+        0x0D, 0x0B, 0x12, 0xC0, 0x0B, 0x61, 0x91, 0xCE, 0x0F, 0xAB, 0x55, 0xC0, 0x3B, 0xC1, 0x6E, 0xA4,
+        0x75, 0xAA, 0xB3, 0x9A, 0x5A, 0x93, 0x7F, 0xAD, 0xF1, 0x12, 0xC1, 0x8E, 0x99, 0x94, 0xD7, 0xA8,
+        0xB8, 0x9A, 0x68, 0x56, 0xAA, 0xA7, 0xC0, 0x93, 0x5A, 0xAE, 0xB7, 0x6E, 0x8E, 0x59, 0xAE, 0xD7,
+        0x6E, 0x95, 0x5A, 0x1E, 0x9C, 0x79, 0x96, 0x59, 0x36, 0x9B, 0x69, 0x8F, 0x3D, 0xA2, 0x5D, 0xC0,
+        0x9B, 0x9B, 0xA3, 0x87, 0x13, 0xC6, 0x5A, 0x13, 0x56, 0xA1, 0xA5, 0xBF, 0xA4, 0xFE, 0xF4, 0x13,
+        0xAF, 0x17, 0x31, 0xC4, 0x92, 0x98, 0x50, 0xA7, 0x88, 0xA4, 0x88, 0xA2, 0x98, 0x12, 0x0D, 0x12,
+        0xC3, 0x41, 0x21, 0x96, 0x8A, 0xAB, 0x78, 0xAC, 0x97, 0x8E, 0x5E, 0x8D, 0xA9, 0x13, 0xC3, 0xA3,
+        0xA9, 0x83, 0x90, 0xA2, 0x88, 0xC2, 0x69, 0x5A, 0x54, 0x18, 0x56, 0xC2, 0x7A, 0x18, 0xC0, 0x10,
+        0x5A, 0xA0, 0xC8, 0x6E, 0x19, 0x25, 0xC0, 0x9D, 0xA8, 0x31, 0x25, 0x31, 0xC1, 0x9C, 0x99, 0xFE,
+        0xF4, 0xFA, 0xFE, 0xF7, 0x5D, 0xA3, 0x88, 0x1E, 0x60, 0xC0, 0x6B, 0xC0, 0x19, 0xFE, 0xA5, 0x3D,
+        0xAF, 0x41, 0xA6, 0xC7, 0x9D, 0x79, 0x9A, 0x3A, 0x03, 0x63, 0x9D, 0xBB, 0xC3, 0x69, 0x9B, 0x9B,
+        0x3B, 0xC0, 0x9D, 0xA8, 0xFE, 0xE2, 0x11, 0xA1, 0xAC, 0xA9, 0x06, 0xAB, 0x07, 0x9D, 0x5A, 0xA3,
+        0xA7, 0xFE, 0xEE, 0xDA, 0x06, 0x9D, 0x99, 0xFE, 0x73, 0x1B, 0xA7, 0x66, 0xFE, 0xFF, 0x9C, 0x6D,
+        0x0D, 0x9D, 0x89, 0x9C, 0x8B, 0x9B, 0x9B, 0x93, 0xBD, 0x9F, 0x3D, 0xA4, 0x76, 0xA4, 0x86, 0xA4,
+        0x87, 0xC1, 0x66, 0xA2, 0x67, 0xA9, 0xA3, 0xA7, 0xB6, 0x9D, 0x79, 0xFE, 0x74, 0xDD, 0xFE, 0xF7,
+        0x7C, 0xA2, 0x87, 0xC0, 0x0B, 0x99, 0x9A, 0x82, 0xC9, 0xAF, 0xD7, 0x98, 0x68, 0x7F, 0xA6, 0x97,
+        0xA2, 0x98, 0x93, 0x5A, 0x02, 0x19, 0x8E, 0x39, 0xB2, 0xC7, 0x19, 0x97, 0x5A, 0x19, 0x3B, 0x0A,
+        0x19, 0x94, 0x39, 0xFE, 0x4A, 0xD2, 0x5F, 0x7A, 0xC0, 0x56, 0x13, 0xC9, 0x0B, 0xA8, 0xA3, 0xBA,
+        0xA5, 0xFE, 0xF3, 0x72, 0xFE, 0xF6, 0x9B, 0x31, 0xC3, 0x8C, 0xA8, 0xA8, 0x96, 0x9D, 0x89, 0x61,
+        0xA7, 0x88, 0xA5, 0x89, 0x12, 0xC6, 0x69, 0x90, 0x8B, 0xB1, 0x89, 0x93, 0x6E, 0x94, 0x95, 0xFE,
+        0x3A, 0x53, 0xA3, 0x87, 0x13, 0x10, 0x13, 0x06, 0xB7, 0xB3, 0x31, 0xC2, 0x27, 0x55, 0x55, 0x6B,
+        0xC4, 0x7A, 0xC0, 0x10, 0xC0, 0x9F, 0xC8, 0x25, 0x69, 0x0D, 0x66, 0x0D, 0x25, 0x0D, 0x25, 0x31,
+        0xC0, 0xFE, 0xF5, 0x5B, 0xAF, 0x23, 0x25, 0x31, 0xC0, 0x1E, 0x60, 0xC0, 0x0D, 0x6B, 0x92, 0x7F,
+        0xA4, 0x16, 0xA4, 0x86, 0x56, 0x5A, 0x03, 0x67, 0x3D, 0x76, 0xC1, 0x66, 0x1A, 0x7E, 0x3B, 0xC1,
+        0xFE, 0xB4, 0x58, 0xFE, 0xF1, 0xD3, 0xA5, 0x78, 0xA3, 0x58, 0x98, 0xB6, 0xFE, 0xB3, 0xD7, 0xA4,
+        0x0C, 0xA5, 0xE2, 0x66, 0xFE, 0x19, 0x9C, 0xFE, 0xB4, 0xFA, 0x7E, 0x9C, 0x6D, 0x9E, 0x59, 0xA3,
+        0x88, 0xA2, 0x87, 0x51, 0x3B, 0x08, 0xA6, 0x85, 0x6F, 0xC3, 0xA2, 0x66, 0xAC, 0xB2, 0x31, 0x12,
+        0xFE, 0x74, 0xBD, 0xFE, 0xFF, 0x9C, 0x6E, 0xC1, 0x0D, 0x84, 0xB9, 0xA0, 0xC7, 0x55, 0xA7, 0xB8,
+        0x99, 0x59, 0xA9, 0xC8, 0x97, 0x6A, 0xA3, 0x98, 0xA5, 0xB8, 0x8E, 0x29, 0x16, 0x19, 0x96, 0x59,
+        0x14, 0x90, 0x5A, 0xAE, 0xA6, 0xA3, 0x87, 0xFE, 0x5A, 0xAE, 0xA2, 0x5C, 0xCE, 0x5A, 0x65, 0xB0,
+        0xA3, 0xB0, 0xC6, 0xFE, 0xF3, 0x51, 0xFE, 0xFE, 0xFC, 0x31, 0xC1, 0x66, 0x8D, 0xA7, 0xA9, 0x98,
+        0xA3, 0x88, 0xA4, 0x88, 0x0B, 0x06, 0x12, 0xC6, 0x0B, 0x8E, 0xAA, 0xB3, 0x69, 0x96, 0x6D, 0x94,
+        0x86, 0x8D, 0x8F, 0x9D, 0x9A, 0x9D, 0x9A, 0x6E, 0x10, 0x7A, 0x9D, 0x9B, 0xFE, 0xD6, 0x9B, 0xA5,
+        0x87, 0x31, 0xC0, 0x2A, 0xC0, 0x45, 0x57, 0x69, 0x17, 0x5A, 0x10, 0xC0, 0x7A, 0x59, 0x10, 0x5A,
+        0x9C, 0xE8, 0xA2, 0x78, 0xC0, 0x37, 0x66, 0x3C, 0xC0, 0xA2, 0x78, 0x25, 0x31, 0x97, 0xCB, 0x97,
+        0xDB, 0x2A, 0xC0, 0x31, 0x25, 0x65, 0x64, 0x0D, 0x6B, 0x0D, 0x97, 0x8D, 0x9B, 0x1C, 0xA7, 0x84,
+        0x6B, 0x66, 0x66, 0x67, 0x62, 0x73, 0xC0, 0x36, 0x5A, 0x9B, 0x9A, 0x3B, 0xC0, 0x36, 0x3B, 0x99,
+        0xFA, 0xFE, 0xE3, 0x17, 0xA5, 0x29, 0xFE, 0xF1, 0x95, 0xA2, 0x75, 0xA1, 0x75, 0xFE, 0xA5, 0x1B,
+        0xA4, 0x59, 0x99, 0x9C, 0x9B, 0x9B, 0xA2, 0x87, 0xA4, 0x86, 0x27, 0xA2, 0x88, 0x9D, 0x9A, 0x1A,
+        0x27, 0x3B, 0xC6, 0xA3, 0x66, 0xAC, 0xD3, 0x31, 0x9C, 0x69, 0xFE, 0x7C, 0xBD, 0xFE, 0xFF, 0xBC,
+        0xC1, 0x65, 0x66, 0x8E, 0x98, 0x8F, 0xB9, 0xAE, 0xC7, 0x99, 0x7A, 0x9C, 0x78, 0xAB, 0xB7, 0x51,
+        0x99, 0x69, 0xAB, 0xC8, 0x8E, 0x3A, 0x16, 0x19, 0x94, 0x49, 0xAB, 0xB8, 0xFE, 0xB2, 0x6F, 0xA7,
+        0xDA, 0xA0, 0x56, 0xFE, 0x52, 0xD2, 0x4F, 0x7A, 0xCF, 0x04, 0xB4, 0xA2, 0xAB, 0xD8, 0xFE, 0xF3,
+        0x51, 0xFE, 0xFE, 0xDB, 0xA9, 0x48, 0xC0, 0x51, 0x84, 0xD7, 0xA7, 0x98, 0xC0, 0xA2, 0x68, 0xA9,
+        0x88, 0xA6, 0x88, 0x12, 0xC6, 0x0B, 0x8D, 0xBB, 0xB4, 0x48, 0x97, 0x8D, 0x93, 0x88, 0x8F, 0x8D,
+        0xC1, 0x56, 0x96, 0xAD, 0xA3, 0x87, 0xA4, 0x76, 0xAF, 0xA5, 0xB8, 0x81, 0x99, 0x9A, 0x31, 0x59,
+        0x65, 0x56, 0x5B, 0x69, 0x17, 0x5A, 0x17, 0x10, 0xC0, 0x18, 0xC0, 0x10, 0x32, 0xC1, 0x65, 0xC0,
+        0x32, 0x3C, 0xA2, 0x78, 0x6F, 0x6F, 0xFE, 0xF4, 0xDA, 0xFE, 0xFF, 0x9E, 0x2A, 0x65, 0xC0, 0x12,
+        0xC0, 0x06, 0xC0, 0x0D, 0xC0, 0x9C, 0x79, 0xFE, 0x7D, 0x3D, 0xAC, 0x52, 0xC0, 0x08, 0x66, 0x66,
+        0x67, 0x62, 0x77, 0xC0, 0x99, 0x9B, 0xA6, 0x86, 0x3B, 0x36, 0x3B, 0x9C, 0xC9, 0xFE, 0xE3, 0x77,
+        0xFE, 0xA4, 0xBD, 0x9F, 0xC8, 0xFE, 0xE2, 0x34, 0x9F, 0x84, 0x6F, 0xFE, 0xB4, 0x16, 0xFE, 0x9D,
+        0xDF, 0x61, 0x9D, 0x9A, 0xC0, 0x36, 0x6D, 0x3B, 0xC9, 0x5E, 0xA2, 0x76, 0xAC, 0xC3, 0x31, 0x9B,
+        0x5A, 0xFE, 0x7C, 0x9D, 0x06, 0x30, 0x9A, 0xA8, 0x9B, 0xB8, 0x9C, 0xA8, 0x61, 0x9E, 0x68, 0x99,
+        0x8A, 0xA5, 0x97, 0x95, 0x6B, 0xA7, 0xA7, 0xA7, 0xB8, 0x92, 0x49, 0xAC, 0xB7, 0x93, 0x69, 0xB0,
+        0xB7, 0x19, 0x95, 0x5A, 0x5A, 0xFE, 0xE2, 0xF4, 0x63, 0x9C, 0x8B, 0x5E, 0xFE, 0x4A, 0xF3, 0xD0,
+        0x5A, 0x64, 0xB4, 0xB3, 0xAC, 0xB7, 0xFE, 0xF3, 0x52, 0xFE, 0xF5, 0xB8, 0x1D, 0x7F, 0x90, 0x98,
+        0xA8, 0x95, 0xA2, 0x89, 0xA2, 0x88, 0x06, 0xC0, 0x12, 0xC4, 0x69, 0x06, 0x01, 0x8D, 0xAA, 0xB6,
+        0x48, 0x96, 0x8D, 0x92, 0x77, 0x10, 0x13, 0xC1, 0x52, 0x55, 0x39, 0x97, 0x9D, 0xFE, 0xD6, 0x9C,
+        0xA8, 0x75, 0x97, 0x9A, 0xAA, 0x76, 0x18, 0x09, 0x17, 0xC1, 0x14, 0x69, 0x7A, 0x0D, 0x10, 0xC1,
+        0x9A, 0xE8, 0xA2, 0x78, 0x3C, 0x32, 0x26, 0xC0, 0x37, 0xC0, 0x3C, 0x96, 0xCD, 0xA3, 0x77, 0xAB,
+        0x46, 0xC0, 0x6E, 0x1E, 0xC0, 0x2A, 0x9D, 0xA7, 0xC1, 0x6E, 0x56, 0xFE, 0x6C, 0xBD, 0xB0, 0x50,
+        0xC0, 0x66, 0x76, 0x3E, 0x67, 0x66, 0x76, 0x9D, 0x8A, 0x62, 0xA4, 0x87, 0xC1, 0x9D, 0xB9, 0xFE,
+        0xEB, 0x77, 0xFE, 0xBC, 0x5B, 0x1A, 0xFE, 0xDB, 0xDA, 0x2C, 0xFE, 0xA5, 0xDE, 0x3B, 0xC2, 0x36,
+        0x34, 0x3B, 0x36, 0x3B, 0xC9, 0xA2, 0x66, 0x00, 0xAA, 0xC3, 0x7A, 0x97, 0x4B, 0xFE, 0x6B, 0xFC,
+        0xFE, 0xF5, 0xB4, 0x9C, 0xA8, 0x19, 0xC0, 0x5A, 0x19, 0x16, 0x93, 0x5A, 0xA2, 0xA9, 0xA3, 0x87,
+        0x53, 0xA2, 0x97, 0xA5, 0x97, 0x95, 0x5A, 0xA5, 0xAB, 0xA2, 0x94, 0x7F, 0xA0, 0x4A, 0xA2, 0x78,
+        0x98, 0xFD, 0xA1, 0x49, 0x93, 0xAD, 0xA1, 0x57, 0xA3, 0x27, 0x7F, 0xC0, 0x04, 0x6B, 0xC0, 0x6E,
+        0xC0, 0x0B, 0xC0, 0x7E, 0xC7, 0x10, 0x75, 0xB2, 0x92, 0xB1, 0xB7, 0xFE, 0xF4, 0x95, 0x9C, 0xA8,
+        0xFE, 0xF6, 0xBB, 0x9D, 0x58, 0x93, 0xA8, 0xA4, 0x97, 0xA2, 0x88, 0xA7, 0x98, 0xA8, 0x77, 0xA3,
+        0x78, 0x6B, 0xC0, 0x0B, 0x62, 0x9C, 0x98, 0x9B, 0xB8, 0x9C, 0x98, 0x9B, 0x99, 0x9D, 0x3C, 0xB3,
+        0x79, 0x96, 0x6D, 0x94, 0xA4, 0x10, 0x13, 0xC2, 0x56, 0x10, 0x13, 0x9C, 0x8A, 0xB1, 0xA4, 0xB4,
+        0x83, 0x61, 0x41, 0xA3, 0x88, 0xA5, 0x8A, 0x6E, 0x69, 0x69, 0x79, 0x18, 0x10, 0x18, 0xC1, 0x32,
+        0xC1, 0x69, 0x26, 0xC0, 0x37, 0xC1, 0xFE, 0xF4, 0x79, 0xFE, 0xFF, 0x9D, 0xA2, 0x78, 0xC1, 0x65,
+        0xC0, 0x12, 0x65, 0xA2, 0x79, 0x06, 0x6E, 0x6F, 0xFE, 0x74, 0x9D, 0xFE, 0x9E, 0xBC, 0xA6, 0xD7,
+        0x41, 0x9B, 0x4B, 0x76, 0x00, 0x66, 0x67, 0x99, 0xAA, 0xA6, 0x77, 0x7A, 0xC0, 0x71, 0xFE, 0xE3,
+        0x78, 0xA3, 0x58, 0x1A, 0xA3, 0x97, 0xFE, 0xEA, 0x76, 0xFE, 0xA5, 0x1D, 0x3B, 0xC6, 0x36, 0xC0,
+        0x5A, 0x3B, 0xC3, 0x33, 0xC0, 0x61, 0x55, 0x45, 0x55, 0xA4, 0xA6, 0xA2, 0xA7, 0x9A, 0x49, 0xFE,
+        0x53, 0x9B, 0xFE, 0xED, 0x12, 0x79, 0x16, 0x19, 0xC0, 0x46, 0x93, 0x5C, 0xFE, 0x39, 0xF5, 0x6B,
+        0xA7, 0x95, 0xB0, 0x73, 0xFE, 0x42, 0x36, 0xFE, 0x9C, 0xF7, 0xAD, 0x86, 0xFE, 0x94, 0xBD, 0xA6,
+        0x82, 0xA0, 0x85, 0x6F, 0x94, 0x8B, 0xFE, 0xAA, 0xB4, 0xFE, 0x52, 0x31, 0xFE, 0x99, 0xF3, 0xFE,
+        0x32, 0x51, 0xC4, 0x7A, 0xC2, 0x23, 0x30, 0x04, 0x6F, 0xC0, 0x7A, 0xC5, 0x04, 0xA9, 0xA4, 0xB7,
+        0x96, 0x9D, 0xEA, 0xFE, 0xF3, 0xB2, 0xA4, 0x58, 0xFE, 0xC5, 0x37, 0x9D, 0x85, 0xAC, 0x97, 0xA5,
+        0x78, 0x35, 0x6F, 0x9D, 0xA8, 0x9C, 0x98, 0x9A, 0xA8, 0x9A, 0xA8, 0x98, 0x89, 0x9A, 0x4A, 0x9A,
+        0x5B, 0xB1, 0x78, 0xA8, 0x8A, 0x9D, 0x7A, 0x9C, 0x87, 0x90, 0x89, 0xA1, 0x8A, 0x5A, 0x13, 0xC6,
+        0x77, 0x83, 0x90, 0xA6, 0x86, 0x9C, 0x89, 0x98, 0x89, 0xA6, 0x68, 0xA4, 0x86, 0xC0, 0x69, 0x6E,
+        0x7B, 0xC0, 0x7A, 0x6B, 0x9A, 0xC8, 0xA4, 0x67, 0x66, 0x2B, 0x66, 0xC1, 0xA2, 0x68, 0x96, 0xDC,
+        0xC0, 0x08, 0xC1, 0xA2, 0x78, 0x6F, 0x64, 0x01, 0x12, 0x19, 0x0B, 0x17, 0x25, 0xFE, 0x84, 0xDD,
+        0xFE, 0xCF, 0x5E, 0x2A, 0x6B, 0x97, 0x3B, 0x9D, 0x8A, 0x63, 0xC0, 0x62, 0x9B, 0x9A, 0xA4, 0x98,
+        0xC0, 0x2D, 0xFE, 0xE3, 0x78, 0x4F, 0xFE, 0x9D, 0x9E, 0x52, 0xA0, 0xC7, 0xFE, 0xE2, 0x76, 0x27,
+        0x7F, 0x3B, 0xC5, 0x52, 0x36, 0x1A, 0xA3, 0x88, 0x3B, 0x33, 0x51, 0x06, 0x51, 0x52, 0x65, 0x6E,
+        0x5E, 0x6D, 0x6E, 0x69, 0x6E, 0xFE, 0x53, 0xBB, 0xFE, 0xE4, 0xD2, 0x9B, 0x77, 0x95, 0x6E, 0xA2,
+        0x77, 0xA4, 0x87, 0x95, 0x6E, 0xFE, 0x39, 0xF6, 0xC2, 0xAE, 0x83, 0xA5, 0x87, 0x97, 0x9B, 0xBA,
+        0x80, 0xA8, 0x86, 0xFE, 0x8C, 0x7D, 0xFE, 0xF7, 0xBE, 0x93, 0x8B, 0xFE, 0x4A, 0x9B, 0xFE, 0xA1,
+        0xD6, 0xFE, 0x29, 0x73, 0xFE, 0xA1, 0xD4, 0xFE, 0x3A, 0x31, 0x5E, 0xC9, 0x7A, 0x6E, 0xA2, 0x88,
+        0x13, 0xC6, 0x56, 0x78, 0xB3, 0xA4, 0xB1, 0x87, 0x97, 0xFA, 0xFE, 0xF3, 0x92, 0x9D, 0x79, 0xA3,
+        0x16, 0xA6, 0x27, 0xA1, 0xA8, 0x64, 0x6B, 0x42, 0x5F, 0x93, 0xF9, 0xB0, 0x59, 0x9C, 0x37, 0x93,
+        0x8D, 0xA8, 0x86, 0xAB, 0x98, 0x98, 0x7C, 0x96, 0x97, 0x26, 0xA4, 0x78, 0x6E, 0x13, 0xC7, 0x9D,
+        0xBF, 0xFE, 0xDE, 0xFE, 0x31, 0x66, 0x96, 0x88, 0xA3, 0x77, 0xA6, 0x78, 0xC1, 0x7E, 0xC0, 0x22,
+        0x7E, 0x9A, 0xB8, 0xA2, 0x78, 0xC0, 0x37, 0xC0, 0x65, 0x37, 0x56, 0xFE, 0xF4, 0x79, 0xFE, 0xFF,
+        0x1B, 0x08, 0x69, 0xC0, 0x6F, 0xC0, 0x69, 0x01, 0x06, 0xA1, 0x8A, 0x12, 0xC0, 0x6F, 0xFE, 0x9C,
+        0xFD, 0xB2, 0x40, 0x31, 0xC0, 0x99, 0x5B, 0x9B, 0x6A, 0x63, 0xC0, 0x98, 0xAB, 0xA5, 0x88, 0x3D,
+        0x71, 0xFE, 0xE3, 0x98, 0x5B, 0xFE, 0x9D, 0x9E, 0x1A, 0xA3, 0x98, 0xFE, 0xC4, 0xBC, 0x96, 0xFA,
+        0x33, 0x7E, 0xC6, 0x9D, 0x9A, 0x3B, 0x9A, 0x89, 0x9D, 0x99, 0xA6, 0x87, 0x9B, 0x89, 0x9D, 0x99,
+        0xC3, 0x5E, 0x6D, 0x6E, 0x6E, 0x69, 0x6E, 0x99, 0x9E, 0xFE, 0x5A, 0x52, 0x9B, 0x69, 0xA0, 0x8A,
+        0xC2, 0x3A, 0xC3, 0xB3, 0x92, 0x98, 0x7A, 0xA8, 0x86, 0xBB, 0x90, 0x98, 0x8C, 0xFE, 0x84, 0x3C,
+        0x3C, 0xA0, 0x45, 0xFE, 0xA2, 0x5A, 0xFE, 0xC6, 0x3D, 0x9E, 0xC7, 0xFE, 0x92, 0x15, 0xFE, 0x29,
+        0xD2, 0xA3, 0x86, 0x26, 0xC1, 0x59, 0x6B, 0x79, 0x26, 0xC0, 0x23, 0x1C, 0x23, 0x26, 0x30, 0xA2,
+        0x88, 0x7F, 0xC5, 0x5A, 0x3F, 0xA3, 0x96, 0xB6, 0x94, 0xAD, 0x97, 0x97, 0xEA, 0xFE, 0xF3, 0xD3,
+        0x56, 0xFE, 0xE5, 0xB9, 0x9C, 0x37, 0xA7, 0x7A, 0xA7, 0x97, 0x62, 0xFE, 0xBA, 0xF0, 0xFE, 0xCD,
+        0xB8, 0xA2, 0x58, 0x86, 0x6D, 0x30, 0x66, 0x7D, 0x99, 0x9E, 0xC0, 0x2B, 0xA4, 0x78, 0x13, 0xC6,
+        0x6E, 0x9B, 0x9B, 0xFE, 0x42, 0x3A, 0x29, 0x7C, 0x1D, 0x9D, 0x89, 0x50, 0xA5, 0x78, 0xC1, 0x7E,
+        0x7A, 0x2A, 0x9B, 0xB9, 0xA2, 0x77, 0xC0, 0x9D, 0xA9, 0x6E, 0xC0, 0x6F, 0x9A, 0xBA, 0x91, 0xFE,
+        0x3C, 0xC0, 0x0D, 0x65, 0xC1, 0x0D, 0x01, 0x6E, 0x12, 0x69, 0x12, 0x6F, 0xFE, 0xA5, 0x5D, 0xAD,
+        0x42, 0x31, 0xC0, 0x9B, 0x5A, 0x99, 0x6B, 0x67, 0x00, 0x98, 0xAC, 0xA7, 0x75, 0x9D, 0xBA, 0xFE,
+        0xE3, 0x79, 0xA2, 0x66, 0xFE, 0xA5, 0x9E, 0xA2, 0x78, 0x9B, 0x9A, 0x3B, 0xFE, 0xD4, 0x3A, 0x42,
+        0x36, 0x3B, 0xC6, 0x22, 0x3B, 0x9A, 0x89, 0x9B, 0x99, 0xC6, 0x6E, 0x5E, 0x65, 0xA2, 0x77, 0x6E,
+        0x21, 0x9D, 0x9B, 0xFE, 0x21, 0x38, 0xFE, 0x31, 0xB1, 0x11, 0xC2, 0xA2, 0x7A, 0x3A, 0xC3, 0xB6,
+        0x81, 0x8D, 0x8E, 0xFE, 0xC6, 0x3C, 0xAD, 0x95, 0xFE, 0x9C, 0xFE, 0x8B, 0x5F, 0xA1, 0xD9, 0xFE,
+        0xE6, 0x7C, 0x2C, 0x5D, 0xFE, 0xF6, 0x1C, 0x9E, 0x68, 0xA1, 0x47, 0x93, 0x8C, 0xFE, 0x19, 0x33,
+        0xAF, 0x93, 0x9A, 0x8A, 0xAD, 0x74, 0xFE, 0x32, 0x57, 0x9C, 0x5B, 0xA1, 0xC4, 0x64, 0x52, 0x66,
+        0xC1, 0xA3, 0x86, 0xA4, 0x87, 0xA3, 0x87, 0x6F, 0x7E, 0xC4, 0x0B, 0x38, 0xA5, 0xA6, 0xB5, 0x95,
+        0x09, 0x98, 0xEA, 0xFE, 0xF4, 0x54, 0x96, 0xDA, 0xFE, 0xAB, 0xF2, 0xB9, 0x37, 0xA2, 0x78, 0xFE,
+        0xC4, 0x53, 0xAA, 0x07, 0xA5, 0x99, 0x86, 0x6D, 0x13, 0x5A, 0x04, 0x2B, 0x9B, 0x9C, 0x66, 0xA7,
+        0x75, 0x10, 0x7A, 0xC5, 0x6E, 0xC0, 0x97, 0x9F, 0xA5, 0x9D, 0xFE, 0xBD, 0xFC, 0xB0, 0x83, 0xC0,
+        0x95, 0x89, 0xA8, 0x77, 0x7E, 0x7F, 0xC0, 0x59, 0xC0, 0x9E, 0xB8, 0x65, 0x0D, 0x9D, 0xA9, 0xA2,
+        0x78, 0x37, 0xC0, 0x95, 0xDD, 0xA2, 0x77, 0x37, 0x65, 0x37, 0x6E, 0x65, 0x3C, 0xC0, 0x01, 0x6E,
+        0xC1, 0x6E, 0xC0, 0xFE, 0xB5, 0x9C, 0xA8, 0x25, 0x31, 0xC0, 0x9A, 0x5A, 0x03, 0x66, 0x67, 0x98,
+        0xAB, 0x2F, 0xFE, 0xE3, 0x98, 0x5F, 0xFE, 0xA5, 0xBF, 0x6E, 0x2F, 0x1A, 0x3B, 0xFE, 0xDB, 0x79,
+        0xFE, 0xB4, 0x7B, 0x3B, 0xC7, 0x1A, 0x3B, 0x9A, 0x89, 0x9A, 0x89, 0x67, 0xA2, 0x86, 0xC4, 0x6E,
+        0x9D, 0x8A, 0xA2, 0x76, 0x23, 0xC0, 0x6D, 0xC0, 0xFE, 0x29, 0xFA, 0x9E, 0xA1, 0x0A, 0x11, 0xC1,
+        0xA1, 0x8B, 0x7F, 0xC3, 0xA4, 0x87, 0xB1, 0x82, 0x91, 0x9E, 0xFE, 0xEF, 0x7E, 0x7E, 0xFE, 0x52,
+        0xBD, 0xFE, 0xCE, 0x7E, 0xAC, 0x82, 0x31, 0x96, 0x89, 0xA8, 0x87, 0x95, 0xEC, 0x99, 0x9A, 0x8A,
+        0x2D, 0xB7, 0x82, 0xA8, 0x79, 0xFE, 0x4B, 0x3A, 0x9C, 0x98, 0x9E, 0x68, 0xA4, 0x92, 0xC0, 0x7A,
+        0x56, 0x9D, 0x98, 0x55, 0x9C, 0x9C, 0x9D, 0x9A, 0xA3, 0x86, 0x67, 0xA3, 0x86, 0x0B, 0x7E, 0xC5,
+        0x04, 0xA2, 0x95, 0xAD, 0xA6, 0xA9, 0x88, 0xAA, 0x87, 0xA3, 0xA8, 0x99, 0xBA, 0x99, 0x58, 0xA7,
+        0x89, 0x92, 0x98, 0xAC, 0x78, 0x98, 0x88, 0x13, 0xC2, 0x5A, 0x9D, 0x99, 0x9A, 0x9A, 0x66, 0x37,
+        0x13, 0xC5, 0x6E, 0xC0, 0x97, 0xAE, 0x1F, 0xA5, 0xB8, 0xFE, 0xE7, 0x5E, 0x31, 0x9D, 0x89, 0x99,
+        0x98, 0xA9, 0x77, 0xC0, 0x27, 0x18, 0xC0, 0x9E, 0xB8, 0xC1, 0x9D, 0xA9, 0x6F, 0x3C, 0x37, 0xFE,
+        0xF4, 0x99, 0xB1, 0x01, 0x3C, 0xC0, 0x30, 0x66, 0xC1, 0x30, 0x3C, 0x6E, 0xC1, 0x6E, 0x6E, 0x34,
+        0xA1, 0x39, 0xAE, 0xD3, 0x7E, 0x98, 0x4A, 0x9C, 0x6A, 0x67, 0x00, 0x9B, 0xCA, 0xFE, 0xE3, 0x38,
+        0xA6, 0x46, 0x36, 0xC0, 0x6E, 0x1A, 0xA2, 0x88, 0x3B, 0xFE, 0xEA, 0xF7, 0xFE, 0xAC, 0xDC, 0xA8,
+        0x27, 0x36, 0x3B, 0xC4, 0x36, 0x9C, 0x88, 0x3B, 0x9A, 0x89, 0x98, 0x9A, 0x6B, 0xA3, 0x86, 0xC3,
+        0x56, 0x9C, 0x8B, 0xA6, 0x74, 0x6D, 0xA2, 0x77, 0x7E, 0xA5, 0xC7, 0x45, 0xFE, 0x4B, 0x5B, 0x93,
+        0xB7, 0x79, 0x69, 0x11, 0xC0, 0xA1, 0x8A, 0x3A, 0xC4, 0xAB, 0x85, 0xA7, 0x95, 0xA3, 0x89, 0xFE,
+        0xFF, 0xDE, 0x96, 0x7D, 0x97, 0x9C, 0x31, 0xC0, 0x9B, 0x89, 0x33, 0x42, 0x87, 0xDF, 0xB1, 0xD5,
+        0xA1, 0x2C, 0x8E, 0x2D, 0x10, 0x99, 0xAC, 0x54, 0xA5, 0x87, 0x10, 0x13, 0xC0, 0x55, 0x9C, 0x99,
+        0x5A, 0x9A, 0x9C, 0xA4, 0x85, 0xA3, 0x87, 0x3F, 0x10, 0x13, 0xC6, 0x56, 0xA1, 0xA6, 0xB4, 0x94,
+        0xA4, 0x89, 0x37, 0xA2, 0x88, 0x7E, 0x96, 0x79, 0x9C, 0x8E, 0xA5, 0x9C, 0x8E, 0x6D, 0x53, 0xA2,
+        0x83, 0xA4, 0x82, 0x10, 0x13, 0xC0, 0x9D, 0x99, 0x9A, 0x8B, 0x0C, 0xA6, 0x75, 0x10, 0x7A, 0xC4,
+        0x6E, 0x9A, 0xAC, 0x96, 0x8F, 0xAC, 0x53, 0xA9, 0xCA, 0xFE, 0xEF, 0x9E, 0x31, 0x9C, 0x88, 0x55,
+        0xA4, 0x77, 0xC0, 0x66, 0x18, 0x0D, 0xC0, 0x66, 0x9D, 0xA9, 0xC1, 0x65, 0xFE, 0xF4, 0x19, 0x32,
+        0x6E, 0x3C, 0xC0, 0x61, 0x67, 0x32, 0x37, 0x3C, 0x6E, 0xC1, 0x6E, 0x6F, 0x95, 0x8F, 0x9C, 0x1A,
+        0xAC, 0xB2, 0xA1, 0xA9, 0x99, 0x4B, 0x66, 0x05, 0x22, 0xFE, 0xEB, 0x38, 0xA2, 0x38, 0xFE, 0x95,
+        0x7D, 0x3B, 0xC1, 0x9B, 0x9A, 0x2E, 0x36, 0xFE, 0xEA, 0x96, 0xFE, 0x9D, 0x1D, 0x3B, 0xC6, 0x65,
+        0x9C, 0x89, 0x36, 0x98, 0x89, 0x9A, 0x9B, 0x5A, 0xA4, 0x86, 0x69, 0xC1, 0x9D, 0x9B, 0x52, 0xA6,
+        0x74, 0x5E, 0x69, 0x6E, 0xA4, 0xA7, 0xA5, 0xC6, 0x5E, 0x93, 0x5F, 0xFE, 0x21, 0x56, 0xA3, 0x93,
+        0x69, 0x11, 0xC0, 0x6F, 0xA1, 0x9B, 0xC5, 0x35, 0x9B, 0x9C, 0xB6, 0x80, 0x25, 0xFE, 0x94, 0xDE,
+        0xFE, 0xDF, 0x1E, 0xA7, 0x95, 0x67, 0x8F, 0x8B, 0x8A, 0x7E, 0xBF, 0x91, 0xFE, 0x74, 0x5D, 0xFE,
+        0x92, 0x96, 0x78, 0xFE, 0x4A, 0xF3, 0xC0, 0x27, 0x64, 0x3F, 0x13, 0xC1, 0x3F, 0x23, 0x62, 0x9D,
+        0x9B, 0x23, 0xA4, 0x88, 0x13, 0xC8, 0x0B, 0x64, 0xAA, 0x94, 0xAF, 0xA8, 0xA9, 0x87, 0x7F, 0xFE,
+        0x84, 0x5C, 0xFE, 0x22, 0x3B, 0xA4, 0x39, 0xFE, 0xA5, 0x79, 0xA6, 0x96, 0xFE, 0x19, 0xDC, 0xFE,
+        0x4A, 0xD4, 0x6D, 0xC2, 0x9D, 0x89, 0x96, 0xAD, 0x0E, 0xA6, 0x74, 0x3F, 0x13, 0xC0, 0x5A, 0x13,
+        0x0B, 0x99, 0xAC, 0xA0, 0x8B, 0xFE, 0x95, 0x19, 0xFE, 0x31, 0xF5, 0xA8, 0x68, 0xB0, 0xB5, 0xFE,
+        0xF7, 0xDE, 0x2C, 0x99, 0x78, 0xA7, 0x87, 0x22, 0x18, 0x66, 0x9D, 0xC8, 0x6F, 0x61, 0x66, 0x69,
+        0x26, 0x62, 0xFE, 0xF3, 0xF9, 0xFE, 0xFE, 0xFB, 0x37, 0x3C, 0xC0, 0x2B, 0x26, 0x32, 0x6D, 0xC0,
+        0xA2, 0x78, 0xC0, 0x6E, 0x6E, 0xC0, 0x98, 0x8D, 0x97, 0x1E, 0xA9, 0x74, 0x7A, 0x56, 0x76, 0xFE,
+        0xBD, 0x3B, 0xFE, 0xEB, 0x17, 0xFE, 0xC4, 0xFB, 0xA6, 0x08, 0x94, 0x8D, 0xAA, 0x84, 0xA3, 0x98,
+        0xC0, 0x9C, 0x89, 0x7E, 0xA1, 0xA8, 0xFE, 0xF2, 0x96, 0x1A, 0x36, 0x3B, 0xC5, 0x9B, 0x99, 0x2C,
+        0x1A, 0x99, 0x99, 0x9C, 0x8B, 0xA3, 0x86, 0x07, 0x19, 0xC0, 0x06, 0x7E, 0x19, 0xC0, 0xA2, 0x67,
+        0x69, 0x6E, 0xA2, 0x87, 0xA8, 0xC5, 0x76, 0x9D, 0x5A, 0xFE, 0x3A, 0x5A, 0x9B, 0xA2, 0x6B, 0xC0,
+        0x0A, 0xA0, 0x8A, 0xA2, 0x8A, 0xC6, 0xB6, 0x70, 0x94, 0x9E, 0xFE, 0xE7, 0x5E, 0x7E, 0xFE, 0x7B,
+        0xFE, 0xFE, 0xF7, 0xDE, 0x98, 0x8A, 0xFE, 0x42, 0x74, 0xFE, 0xCE, 0xBB, 0xFE, 0x74, 0x5D, 0x95,
+        0x76, 0x78, 0x9E, 0xF9, 0xFE, 0xB2, 0x75, 0xFE, 0x62, 0xD3, 0x10, 0x97, 0xBD, 0xA3, 0x75, 0x3F,
+        0xA2, 0x88, 0xC1, 0x9D, 0x99, 0x23, 0x99, 0xAD, 0x23, 0xA2, 0x87, 0x13, 0xCA, 0x56, 0x60, 0x7E,
+        0xFE, 0x42, 0x7C, 0xFE, 0xA5, 0x59, 0xAA, 0x94, 0xFE, 0x1A, 0x7C, 0x9F, 0xD8, 0xA2, 0x85, 0xFE,
+        0x11, 0xBD, 0xFE, 0x3A, 0x77, 0x13, 0xC2, 0x9D, 0x89, 0x9B, 0x9B, 0xA5, 0x87, 0x98, 0x9B, 0x1E,
+        0x30, 0x04, 0xC0, 0x3F, 0x18, 0x7B, 0xA8, 0x4A, 0xB7, 0xC2, 0x91, 0x97, 0xFE, 0x32, 0x56, 0xA5,
+        0x8B, 0xFE, 0xD6, 0x9E, 0xAA, 0x84, 0x99, 0x78, 0xA7, 0x98, 0xC0, 0x59, 0x56, 0x3C, 0xC0, 0x66,
+        0x26, 0xC1, 0x1C, 0xFE, 0xF4, 0x19, 0x37, 0x3C, 0xA2, 0x78, 0xC0, 0x3C, 0x37, 0x66, 0x6D, 0xC0,
+        0x3C, 0x6E, 0x6E, 0xC0, 0xA2, 0x79, 0x9B, 0x8C, 0x91, 0x2F, 0xAB, 0x83, 0x5A, 0x72, 0xFE, 0xD4,
+        0x79, 0xFE, 0xEB, 0x37, 0xFE, 0xB5, 0x7C, 0xA4, 0x38, 0xC0, 0x98, 0x9C, 0x9C, 0x98, 0xA9, 0x86,
+        0xA2, 0x88, 0x27, 0x9C, 0x9A, 0xA3, 0xA7, 0xFE, 0xF2, 0x56, 0xFE, 0x9D, 0x7E, 0x3B, 0xC6, 0x99,
+        0x9A, 0x27, 0x98, 0x9A, 0x55, 0x9C, 0x8A, 0x19, 0x09, 0x19, 0x9D, 0x9A, 0xA2, 0x87, 0xC0, 0x19,
+        0xC0, 0x5E, 0x6D, 0x6E, 0x6E, 0xA7, 0xD6, 0xA5, 0x87, 0xA7, 0x97, 0xFE, 0x74, 0xFD, 0x85, 0xDD,
+        0xA1, 0x95, 0x6B, 0xC1, 0xA2, 0x8A, 0x6B, 0xC5, 0xA4, 0x86, 0xB4, 0x83, 0x9C, 0x89, 0xFE, 0xFF,
+        0xDE, 0x94, 0x7E, 0x98, 0x8B, 0x8E, 0x88, 0xB7, 0x82, 0xFE, 0x95, 0x3E, 0x8E, 0x69, 0x13, 0xC1,
+        0x7A, 0xFE, 0xAA, 0x75, 0x49, 0xFE, 0x52, 0xD3, 0x97, 0x8D, 0xA4, 0x74, 0xA4, 0x88, 0x13, 0xC1,
+        0x9D, 0x88, 0x98, 0x9D, 0xA6, 0x74, 0x7A, 0x04, 0x13, 0xCB, 0x9D, 0x8C, 0xFE, 0x0A, 0x3E, 0xFE,
+        0x63, 0xD9, 0x9B, 0xAA, 0xAB, 0x97, 0xB1, 0x91, 0xA3, 0x98, 0x94, 0x88, 0x8B, 0x6D, 0x5B, 0x13,
+        0xC0, 0x10, 0x97, 0xAC, 0x23, 0x10, 0x66, 0x99, 0xAB, 0x9D, 0x9A, 0x1E, 0x66, 0x9C, 0x8B, 0xA6,
+        0x86, 0xA5, 0x86, 0xA1, 0x8A, 0xA7, 0x6E, 0xFE, 0xBE, 0x19, 0xFE, 0x3A, 0x54, 0xA8, 0x69, 0xA7,
+        0xB9, 0xFE, 0xF7, 0xBE, 0x9A, 0x78, 0xA7, 0x87, 0xC1, 0x56, 0x9E, 0xC8, 0x37, 0x32, 0xC0, 0x65,
+        0x32, 0x66, 0xFE, 0xF3, 0xF8, 0xFE, 0xF7, 0x1B, 0x08, 0xA2, 0x78, 0x3C, 0x37, 0xA3, 0x78, 0x37,
+        0x65, 0x32, 0x37, 0x3C, 0xA2, 0x77, 0x6F, 0x6F, 0x9D, 0x8A, 0xFE, 0x74, 0xDD, 0xAF, 0x51, 0x9B,
+        0xEA, 0xFE, 0xEB, 0x97, 0xA5, 0x48, 0xFE, 0xA6, 0x3D, 0x5F, 0x9A, 0x9A, 0x36, 0x66, 0x91, 0xAE,
+        0xA7, 0x85, 0xA7, 0x88, 0x7A, 0x97, 0x9C, 0xA6, 0xA4, 0x0E, 0xFE, 0x9D, 0x7E, 0xA3, 0x88, 0xC4,
+        0x69, 0x22, 0x9D, 0x8A, 0x32, 0x9D, 0x99, 0xC0, 0x06, 0x19, 0x53, 0x7D, 0x19, 0xC0, 0x13, 0x19,
+        0xC0, 0x5E, 0x6D, 0x6E, 0x6E, 0xA9, 0xB5, 0xAD, 0xB6, 0xA2, 0x87, 0x95, 0x4C, 0xFE, 0x29, 0x99,
+        0xA1, 0x91, 0xC1, 0x69, 0x11, 0x6F, 0xC0, 0x6B, 0x6B, 0x6E, 0x7B, 0xC1, 0xAF, 0x83, 0xA7, 0x98,
+        0xAC, 0x83, 0xAD, 0x94, 0xFE, 0x84, 0x1D, 0xA3, 0x82, 0xAF, 0x77, 0xFE, 0x32, 0xD9, 0xA1, 0xB2,
+        0xC4, 0x9F, 0xB9, 0x16, 0x46, 0x15, 0xA4, 0x74, 0xA5, 0x87, 0x13, 0xC0, 0x0B, 0x97, 0x9C, 0xA5,
+        0x85, 0xC0, 0xA2, 0x88, 0x13, 0xCC, 0xFE, 0x19, 0xFC, 0xA2, 0x69, 0xFE, 0x9C, 0xFD, 0xA9, 0x81,
+        0xAE, 0x86, 0x31, 0xC0, 0x8F, 0x8A, 0x8A, 0x7D, 0x47, 0x13, 0x9B, 0x9B, 0x9B, 0x9A, 0xA5, 0x85,
+        0xA3, 0x89, 0x9D, 0x99, 0x9D, 0x8A, 0x9C, 0x9B, 0x15, 0xA4, 0x76, 0xA5, 0x86, 0x13, 0x6E, 0xC0,
+        0xFE, 0x1A, 0xFD, 0xFE, 0xCE, 0x5B, 0x81, 0xED, 0xA1, 0x6D, 0xA5, 0x4B, 0xFE, 0xD6, 0x9E, 0xA2,
+        0x74, 0xA7, 0x87, 0x6E, 0x6B, 0x59, 0x9D, 0xD8, 0x62, 0x61, 0x6F, 0xC0, 0x26, 0x32, 0xFE, 0xFC,
+        0x79, 0xFE, 0xFE, 0xDB, 0xA7, 0x57, 0x65, 0x61, 0xC1, 0x37, 0x65, 0x32, 0xC0, 0x3C, 0x12, 0x25,
+        0xC0, 0x51, 0xFE, 0x74, 0x9D, 0xFE, 0xC5, 0x1A, 0xFE, 0xEB, 0x17, 0xFE, 0xC5, 0x3A, 0xFE, 0x9E,
+        0x9D, 0x03, 0x05, 0x96, 0xAC, 0xA7, 0x86, 0xC0, 0x99, 0xAB, 0x99, 0x9B, 0xA8, 0x85, 0xA4, 0x87,
+        0x92, 0x9E, 0x1C, 0xFE, 0xF2, 0x76, 0x27, 0xA2, 0x88, 0xC4, 0x66, 0x98, 0x8A, 0x06, 0x9B, 0x99,
+        0xC0, 0x67, 0x9D, 0x8A, 0x19, 0x66, 0x19, 0xC1, 0x52, 0xC0, 0x19, 0x6E, 0x5D, 0xA2, 0x77, 0xA6,
+        0x87, 0x08, 0xAA, 0xE5, 0x31, 0x9B, 0x5A, 0xFE, 0x64, 0x1C, 0x8D, 0xC8, 0xC7, 0x5A, 0x1D, 0x6B,
+        0x3A, 0xC0, 0xFE, 0xAD, 0x7A, 0x92, 0x8F, 0xFE, 0xEF, 0x7E, 0x52, 0xFE, 0x73, 0xDE, 0x9B, 0x58,
+        0x9E, 0xA1, 0x5A, 0x13, 0xC2, 0x10, 0x13, 0xC1, 0x10, 0x0E, 0xA4, 0x76, 0xA5, 0x87, 0x13, 0xC0,
+        0x99, 0x9B, 0x69, 0xA2, 0x77, 0x7A, 0x0B, 0x13, 0xCB, 0x9A, 0x8F, 0x79, 0xFE, 0xCE, 0x7B, 0x69,
+        0xAA, 0x87, 0xA2, 0x88, 0xC1, 0x8E, 0x89, 0x8A, 0x6D, 0xFE, 0x21, 0x93, 0x9B, 0xAA, 0xA4, 0x76,
+        0x6E, 0xA4, 0x87, 0xA3, 0x87, 0x0B, 0x13, 0xC3, 0x5E, 0x9E, 0xC7, 0xFE, 0x8A, 0x32, 0xA2, 0xF3,
+        0xA4, 0xB8, 0x5E, 0x9D, 0x2B, 0xFE, 0x9C, 0xFD, 0xFE, 0xD6, 0xBB, 0xAA, 0x76, 0xC0, 0x66, 0x5A,
+        0x9D, 0xC8, 0x37, 0x62, 0xC0, 0x37, 0x61, 0xC0, 0x92, 0xFF, 0xA5, 0x66, 0xAE, 0x13, 0x6E, 0xC0,
+        0x6B, 0x6E, 0x0D, 0x32, 0xC1, 0xA3, 0x77, 0x0D, 0x1E, 0x6B, 0x99, 0xB9, 0xFE, 0xDA, 0xD8, 0xA8,
+        0x54, 0xFE, 0xAE, 0x1B, 0xA4, 0x48, 0x5A, 0x76, 0x67, 0x95, 0xAD, 0xA8, 0x85, 0x6B, 0x65, 0x92,
+        0xAD, 0xA4, 0x75, 0xA7, 0x98, 0x97, 0x9C, 0xA4, 0xA6, 0xFE, 0xF2, 0xB6, 0xFE, 0x9D, 0x9E, 0x7F,
+        0x6E, 0xC2, 0x36, 0x9B, 0x89, 0x0E, 0xA3, 0x86, 0xC2, 0x9C, 0x8B, 0x19, 0xC4, 0x9C, 0x8A, 0x19,
+        0xC0, 0xA3, 0x77, 0xA8, 0x76, 0x05, 0xA2, 0x66, 0xA5, 0xC6, 0xA6, 0xC7, 0x9C, 0x59, 0x21, 0xFE,
+        0x21, 0x57, 0x11, 0x69, 0x11, 0xC7, 0x6B, 0x24, 0xA6, 0x87, 0xBA, 0x80, 0x99, 0x9C, 0xFE, 0xFF,
+        0xFE, 0xFE, 0xAD, 0x5E, 0x89, 0x5E, 0x13, 0xC0, 0x10, 0x13, 0xC6, 0x10, 0x98, 0xAC, 0x69, 0xA8,
+        0x64, 0x13, 0x9B, 0xAA, 0x9A, 0x7B, 0xA6, 0x74, 0xC0, 0xA3, 0x98, 0x13, 0xCA, 0x10, 0xC0, 0x9D,
+        0xA8, 0xBE, 0x91, 0x00, 0xAB, 0x98, 0x6E, 0xC1, 0x9C, 0x98, 0xFE, 0x9A, 0xCF, 0x97, 0x8A, 0xA3,
+        0x2A, 0xA2, 0x59, 0xA3, 0x88, 0x13, 0xC3, 0x6D, 0x62, 0x9D, 0xF7, 0xFE, 0xAA, 0x0C, 0xA1, 0xE9,
+        0xA4, 0x99, 0x7E, 0xA2, 0x78, 0x9E, 0x57, 0xFE, 0x7B, 0x36, 0xA5, 0x4D, 0xFE, 0xCE, 0x9B, 0x2A,
+        0x66, 0x31, 0x55, 0x3C, 0x6F, 0x3C, 0x62, 0xC2, 0x98, 0xCA, 0x94, 0xDE, 0xFE, 0xF7, 0x5C, 0xA3,
+        0x88, 0xC0, 0x5A, 0x76, 0x37, 0x6E, 0x37, 0x3C, 0xC0, 0xA4, 0x68, 0x9C, 0x9A, 0xFE, 0xF5, 0x39,
+        0xFE, 0xF3, 0x36, 0xFE, 0xBB, 0xDA, 0xFE, 0x9E, 0x9C, 0xA5, 0xB8, 0x69, 0x9B, 0x6B, 0xC0, 0x62,
+        0x93, 0xBF, 0xAA, 0x74, 0x6B, 0x66, 0x96, 0x9B, 0x64, 0xA3, 0x88, 0x6B, 0x9B, 0xCB, 0xFE, 0xF2,
+        0xD6, 0xFE, 0xA5, 0x5E, 0xA4, 0x67, 0x66, 0x3B, 0xC0, 0x36, 0x9C, 0x88, 0x94, 0x9D, 0x19, 0xC3,
+        0x9D, 0x9A, 0x19, 0xC4, 0x9B, 0x9C, 0x19, 0xC0, 0xA7, 0x76, 0xA7, 0x77, 0x6E, 0x08, 0x5A, 0xA4,
+        0xB6, 0x9E, 0x69, 0x05, 0xFE, 0x4B, 0x3B, 0x0A, 0x6B, 0xCA, 0x6F, 0xB6, 0x82, 0xA1, 0x9A, 0xB1,
+        0x83, 0xA7, 0x96, 0xFE, 0x4A, 0xBC, 0xFE, 0x4A, 0xD3, 0x5E, 0x13, 0xC9, 0x9B, 0x9B, 0x1B, 0xA4,
+        0xD4, 0xFE, 0xA9, 0x48, 0xFE, 0x58, 0xB0, 0xFE, 0x32, 0x31, 0xC0, 0xA2, 0x87, 0x0E, 0x13, 0xC9,
+        0x10, 0x13, 0x3F, 0xB1, 0xA3, 0xB3, 0x97, 0xA6, 0x87, 0xC2, 0x66, 0xFE, 0xDB, 0x92, 0x9B, 0x68,
+        0xFE, 0xD2, 0x0C, 0x9D, 0x29, 0xFE, 0x5A, 0xB1, 0x13, 0x6D, 0xA3, 0xA7, 0xA3, 0xA8, 0x9F, 0xC5,
+        0xFE, 0xA2, 0x0B, 0x32, 0xA3, 0xAA, 0xA2, 0x98, 0xC1, 0x33, 0x9C, 0x56, 0xA0, 0x0E, 0xFE, 0x53,
+        0x3B, 0xA2, 0x87, 0xFE, 0xC6, 0x5B, 0xAC, 0x84, 0x6F, 0x31, 0x55, 0x9D, 0xB7, 0xC0, 0x66, 0x62,
+        0x61, 0xA3, 0x78, 0xC0, 0x2D, 0xFE, 0xF4, 0xB9, 0xA4, 0x67, 0xFE, 0xF7, 0x9D, 0x6E, 0x0D, 0x62,
+        0x0D, 0x69, 0x3C, 0xA3, 0x79, 0x98, 0xBA, 0x94, 0xEC, 0xFE, 0xF3, 0x36, 0xB1, 0x03, 0xB0, 0x14,
+        0xFE, 0x8C, 0xDD, 0xB1, 0x50, 0xA8, 0xD6, 0xC0, 0x28, 0x05, 0x9D, 0xAA, 0x93, 0xBE, 0xAC, 0x74,
+        0x3D, 0xC0, 0x98, 0xAB, 0x9B, 0x99, 0x6D, 0xA1, 0x9A, 0x99, 0xBC, 0xFE, 0xF3, 0x16, 0xFE, 0xAD,
+        0x3D, 0xA5, 0x58, 0xC2, 0x9C, 0x89, 0x99, 0x9A, 0x9A, 0x9B, 0x19, 0xC2, 0x57, 0x65, 0x19, 0xC4,
+        0x18, 0x9D, 0x9A, 0xA5, 0x85, 0xA9, 0x77, 0x00, 0x6E, 0x6D, 0x5E, 0x6E, 0xC0, 0x76, 0x95, 0x9E,
+        0x83, 0xEE, 0xA1, 0x95, 0x6B, 0xCB, 0xBC, 0x81, 0x97, 0x8E, 0xFE, 0xF7, 0xDE, 0x93, 0x9F, 0xFE,
+        0x89, 0x56, 0xFE, 0x92, 0x0D, 0xFE, 0x5A, 0xB1, 0x13, 0xC9, 0x61, 0xFE, 0xB9, 0x8A, 0xA6, 0x9A,
+        0x94, 0x4A, 0xFE, 0x21, 0x92, 0xA5, 0x95, 0x5E, 0xA3, 0x98, 0x13, 0xCB, 0x0B, 0x9D, 0xB8, 0x84,
+        0x81, 0xA8, 0x87, 0x5A, 0x31, 0xC1, 0xFE, 0xF4, 0x54, 0xFE, 0xAC, 0x53, 0xFE, 0xFA, 0xB0, 0x33,
+        0x98, 0x56, 0xFE, 0x8A, 0xCD, 0xA3, 0xB8, 0xA0, 0xD9, 0x98, 0xDA, 0xA3, 0xA9, 0x36, 0xC0, 0x66,
+        0x36, 0x9D, 0x78, 0x9D, 0x69, 0xFE, 0xA3, 0xB4, 0xA6, 0x46, 0x9B, 0x6D, 0x9A, 0x7F, 0xA6, 0x74,
+        0xB2, 0xA1, 0xAE, 0x82, 0x6F, 0x7B, 0x27, 0x9C, 0xB7, 0x6B, 0x37, 0x9D, 0xA9, 0x6E, 0x32, 0x08,
+        0x65, 0x9B, 0xAB, 0xFE, 0xF4, 0x99, 0xA2, 0x77, 0xAA, 0x35, 0xA9, 0x45, 0x08, 0x66, 0x98, 0xBA,
+        0x99, 0xCB, 0x96, 0xDC, 0x98, 0xCA, 0x16, 0x3B, 0xA5, 0x78, 0x69, 0xFE, 0x9D, 0x1D, 0xB0, 0x40,
+        0xA7, 0xD7, 0xC0, 0x9D, 0x69, 0x05, 0x9A, 0xAA, 0x98, 0xAC, 0xAA, 0x75, 0x67, 0x79, 0x1A, 0x96,
+        0x9A, 0xA3, 0x87, 0x6F, 0x97, 0xAD, 0xFE, 0xE2, 0xF7, 0xFE, 0xBC, 0xFD, 0xA7, 0x27, 0x66, 0xC0,
+        0x1A, 0x25, 0x99, 0x9C, 0xA5, 0x95, 0x19, 0xC2, 0x56, 0x19, 0xC6, 0x9B, 0x9C, 0xA8, 0x74, 0xA9,
+        0x76, 0x6E, 0xA2, 0x77, 0x6D, 0x5E, 0xC1, 0x7E, 0x9D, 0x9A, 0xFE, 0x21, 0x79, 0xA2, 0x90, 0xCC,
+        0xA4, 0x86, 0xB0, 0x85, 0xB0, 0x85, 0xAD, 0x94, 0xFE, 0x7B, 0x7D, 0xFE, 0xE2, 0x92, 0x9D, 0x95,
+        0x9E, 0x29, 0xFE, 0x62, 0x90, 0xA3, 0x4A, 0xC7, 0xFE, 0x7A, 0x2E, 0xFE, 0xEA, 0x6E, 0x6F, 0x97,
+        0x58, 0xFE, 0x28, 0xF2, 0xA8, 0x53, 0x23, 0x7A, 0x0B, 0x13, 0xCA, 0x96, 0x9C, 0x14, 0xAE, 0xE2,
+        0xB9, 0x75, 0xA8, 0x58, 0x31, 0xC1, 0xFE, 0xFC, 0x74, 0xFE, 0xB4, 0xB4, 0xFE, 0xDA, 0x4D, 0x9C,
+        0x88, 0x9D, 0x88, 0x01, 0x33, 0x7A, 0xC0, 0x55, 0x10, 0x9D, 0x88, 0xA0, 0x48, 0x9F, 0x49, 0xA2,
+        0x2A, 0xFE, 0x22, 0x5A, 0xFE, 0x9D, 0x1B, 0x94, 0x87, 0xAB, 0x98, 0xFE, 0x63, 0x5C, 0xA5, 0x63,
+        0xAC, 0xA5, 0xB3, 0x91, 0x31, 0xC0, 0x69, 0x9C, 0xA7, 0x37, 0x61, 0x6F, 0x37, 0x65, 0xA2, 0x78,
+        0xC1, 0x32, 0x92, 0xEE, 0x97, 0xDB, 0x9C, 0xA9, 0x62, 0x9D, 0xA9, 0x02, 0xAC, 0x24, 0xAA, 0x34,
+        0xAB, 0x46, 0xA2, 0x77, 0x65, 0x1E, 0x66, 0xFE, 0xA5, 0x5D, 0xAC, 0x32, 0x31, 0xC0, 0x41, 0x96,
+        0x2C, 0x97, 0xAB, 0x9F, 0xAB, 0xA7, 0x86, 0x66, 0x3D, 0x9B, 0xAA, 0x97, 0x9A, 0xA2, 0x87, 0xC0,
+        0x9C, 0x8B, 0xFE, 0xDB, 0x38, 0xAA, 0x06, 0xFE, 0xA5, 0xDF, 0x66, 0x9C, 0x88, 0x19, 0x0C, 0x9D,
+        0x9B, 0x19, 0xC3, 0x66, 0x19, 0xC6, 0x06, 0xA9, 0x85, 0x3D, 0x6D, 0x6E, 0x03, 0x6E, 0x5A, 0x6E,
+        0xC0, 0x75, 0xFE, 0x53, 0x7C, 0x11, 0x69, 0x11, 0xCB, 0xAF, 0x82, 0x9F, 0x9C, 0x81, 0x80, 0x99,
+        0x9C, 0xFE, 0xA1, 0xB9, 0xFE, 0xFA, 0xB0, 0x69, 0x9D, 0x89, 0x9D, 0x48, 0xFE, 0x7A, 0x2E, 0xA5,
+        0x1A, 0x5F, 0x5A, 0x13, 0x10, 0x13, 0xFE, 0x82, 0x2D, 0xFE, 0xC9, 0xEB, 0x36, 0x56, 0x99, 0x57,
+        0xFE, 0x49, 0xCF, 0xFE, 0x18, 0xD3, 0xAB, 0x61, 0x6E, 0xA2, 0x88, 0xA3, 0x98, 0xC9, 0x9A, 0x8B,
+        0x9D, 0xA9, 0xA1, 0x8A, 0xA7, 0xA4, 0xFE, 0xDC, 0x34, 0xA5, 0x97, 0xFE, 0xF7, 0x1C, 0xA6, 0x68,
+        0x31, 0xFE, 0xF4, 0xD6, 0x9F, 0x27, 0xFE, 0xA1, 0x48, 0xA3, 0xAA, 0xA4, 0x98, 0x7A, 0x55, 0xA7,
+        0x47, 0xA6, 0x47, 0x9B, 0x4D, 0xA3, 0x65, 0x99, 0x5C, 0x43, 0x5E, 0xA0, 0x8A, 0xFE, 0x2A, 0xDC,
+        0xFE, 0xC6, 0x5D, 0xFE, 0x3A, 0x1A, 0xA3, 0x8A, 0xA3, 0x87, 0xFE, 0x64, 0x19, 0xA4, 0xB9, 0xFE,
+        0xEF, 0xBE, 0x7E, 0xC0, 0x6E, 0x99, 0xD9, 0x69, 0xA2, 0x78, 0x6E, 0x62, 0xC1, 0x62, 0xC0, 0xA3,
+        0x67, 0xA2, 0x88, 0xC0, 0x9B, 0xAA, 0x9C, 0xA9, 0x2A, 0x32, 0x12, 0x0D, 0xA2, 0x78, 0x12, 0x0D,
+        0x6F, 0x6F, 0x90, 0x8F, 0xA4, 0x26, 0x31, 0xC0, 0x9D, 0x79, 0x96, 0x3B, 0x93, 0xAE, 0xA9, 0x96,
+        0x00, 0x3B, 0x66, 0x06, 0x9B, 0x9A, 0x69, 0xC0, 0x9C, 0x8B, 0xFE, 0xD3, 0x78, 0xA3, 0x69, 0xFE,
+        0x95, 0x1D, 0x41, 0x19, 0xC0, 0x9A, 0x8C, 0x19, 0xCD, 0x20, 0xA2, 0x88, 0x36, 0x3B, 0x00, 0x6E,
+        0xA2, 0x76, 0x5A, 0x6E, 0x7A, 0x0A, 0x92, 0xBF, 0x84, 0xDF, 0xA2, 0x82, 0x11, 0xCA, 0x0A, 0x16,
+        0xB0, 0x82, 0xAC, 0x86, 0x22, 0xFE, 0x6A, 0xDC, 0xFE, 0xFA, 0x91, 0x6D, 0x66, 0x36, 0x55, 0x9C,
+        0x67, 0xA0, 0x18, 0xA5, 0x09, 0xAA, 0x47, 0x99, 0xAA, 0xFE, 0xA1, 0xAB, 0xA6, 0xE8, 0x36, 0x31,
+        0x2E, 0x99, 0x66, 0xFE, 0x59, 0xEE, 0x9F, 0x3D, 0x98, 0x9D, 0xAA, 0x71, 0x23, 0xA2, 0x88, 0x10,
+        0x7A, 0xC6, 0x9B, 0x9A, 0x29, 0xA5, 0x85, 0x67, 0xA3, 0xE3, 0xB3, 0x62, 0xAF, 0xA8, 0xFE, 0xF4,
+        0x54, 0xA2, 0x78, 0xFE, 0xF6, 0xDB, 0xFE, 0xF4, 0xF6, 0x9E, 0x18, 0xFE, 0x49, 0xF8, 0xA3, 0x83,
+        0xA4, 0x94, 0xA3, 0x86, 0xA5, 0x77, 0x5B, 0x9B, 0x8A, 0x9D, 0x99, 0x4B, 0x53, 0x67, 0x9F, 0x9C,
+        0x9E, 0x6D, 0xA0, 0x7B, 0xA2, 0x67, 0xA5, 0x76, 0xA1, 0xE8, 0xAA, 0xA1, 0x9D, 0x67, 0xA5, 0xB9,
+        0xFE, 0xEF, 0x7D, 0xA4, 0x77, 0x55, 0xC0, 0x97, 0xFA, 0xA2, 0x77, 0xA2, 0x78, 0xC0, 0x26, 0x66,
+        0x26, 0x1C, 0xC0, 0x26, 0x6F, 0x37, 0x3C, 0x37, 0x65, 0xC0, 0x37, 0xA2, 0x78, 0xA3, 0x78, 0x9D,
+        0xA8, 0x6E, 0x1E, 0xC0, 0x95, 0x8F, 0x9B, 0x2A, 0xAE, 0xC2, 0xA2, 0x98, 0x98, 0x4A, 0x99, 0x8A,
+        0x93, 0xBF, 0xB0, 0x62, 0x67, 0x3B, 0x66, 0x95, 0xAC, 0x69, 0xC1, 0x9C, 0x8A, 0xFE, 0xC3, 0x59,
+        0xA1, 0xB7, 0xFE, 0x7C, 0x7B, 0xC1, 0x9D, 0x9B, 0x56, 0x19, 0xCB, 0x66, 0x19, 0xC0, 0x53, 0xAD,
+        0x74, 0x6F, 0xA2, 0x76, 0x6E, 0x6D, 0x5E, 0xA5, 0xC6, 0xA6, 0xB7, 0x9B, 0x7A, 0x97, 0x4C, 0xFE,
+        0x19, 0x1A, 0x11, 0xCA, 0x69, 0x11, 0xC0, 0xB0, 0x82, 0x52, 0xBA, 0x81, 0xFE, 0x6B, 0x7D, 0xFE,
+        0xA1, 0xCC, 0xA1, 0xC7, 0xA2, 0xB9, 0xA3, 0x99, 0x7F, 0xC0, 0x66, 0x9D, 0x78, 0xA6, 0x26, 0x9F,
+        0x56, 0xFE, 0xDA, 0x4E, 0xA2, 0xA9, 0xC0, 0x9D, 0x77, 0x9A, 0x66, 0xA4, 0xA9, 0x9C, 0x27, 0xFE,
+        0x51, 0xEF, 0x9C, 0x6C, 0xA2, 0x7B, 0xA2, 0x63, 0x23, 0x7E, 0xA3, 0x88, 0x7F, 0xC2, 0x5A, 0x04,
+        0x99, 0xAC, 0x9E, 0x8B, 0xAC, 0x76, 0x94, 0x97, 0x9D, 0xE9, 0xFE, 0xA9, 0x6A, 0xA6, 0x99, 0xA8,
+        0x26, 0xFE, 0xBD, 0x97, 0xA7, 0xB8, 0x94, 0xFA, 0xFE, 0xF2, 0xF1, 0xFE, 0xB4, 0x95, 0xFE, 0x0A,
+        0x5D, 0x6B, 0x57, 0x61, 0x7A, 0x69, 0x7A, 0x20, 0x1D, 0xC0, 0x2E, 0xA2, 0x76, 0xA2, 0x78, 0x6D,
+        0x7B, 0xA1, 0xA8, 0xFE, 0x9D, 0x3E, 0x9B, 0x99, 0x9C, 0x57, 0xA6, 0xB9, 0xFE, 0xE7, 0x3C, 0xA6,
+        0x88, 0x59, 0x55, 0x96, 0xFA, 0xC0, 0x6D, 0x6B, 0x6E, 0xA2, 0x77, 0x21, 0x1C, 0xC0, 0x21, 0xA2,
+        0x78, 0x6E, 0x32, 0x65, 0xC0, 0x21, 0x26, 0x37, 0xC0, 0x69, 0x6F, 0xA3, 0x78, 0x6E, 0x9A, 0x8C,
+        0x92, 0x2F, 0xAB, 0x63, 0xC1, 0x98, 0xAA, 0x97, 0xAD, 0xAF, 0x73, 0x67, 0x66, 0x9D, 0x99, 0x93,
+        0xAE, 0x1E, 0xC0, 0x5A, 0x66, 0xFE, 0xA3, 0x39, 0xFE, 0xEB, 0x56, 0xFE, 0x84, 0x5B, 0x5E, 0xC0,
+        0x9A, 0x8C, 0x19, 0xCC, 0x6B, 0x7E, 0x19, 0xC0, 0xA6, 0x88, 0xA6, 0x65, 0x3B, 0x05, 0x03, 0x5E,
+        0xAA, 0xE5, 0x31, 0x22, 0x97, 0x2C, 0xFE, 0x42, 0xBD, 0x98, 0xA1, 0xCD, 0xAD, 0x83, 0xA4, 0x87,
+        0xAC, 0x85, 0xFE, 0x3A, 0x1C, 0x23, 0x76, 0x9F, 0xB7, 0xFE, 0x79, 0xAC, 0xFE, 0xB9, 0xCB, 0xA4,
+        0xB9, 0xA3, 0x99, 0x7A, 0xC0, 0x9A, 0x68, 0x9D, 0x77, 0x55, 0x6E, 0x51, 0xA3, 0xA9, 0xA2, 0x99,
+        0x0F, 0x5B, 0x41, 0xA1, 0x5A, 0xA9, 0x1C, 0x9A, 0x2B, 0x64, 0x23, 0xA2, 0x87, 0x7F, 0x6E, 0x56,
+        0x9C, 0x9A, 0x9A, 0x9C, 0xAC, 0x76, 0xAE, 0x95, 0x92, 0x99, 0x9A, 0x67, 0x14, 0xFE, 0x99, 0x6A,
+        0x34, 0xA4, 0x97, 0x5F, 0xA5, 0x07, 0xFE, 0xB5, 0x97, 0xA9, 0x98, 0x95, 0x99, 0xA1, 0x7E, 0x98,
+        0x8D, 0x92, 0x7F, 0x9A, 0x3C, 0xA2, 0x67, 0xA2, 0x78, 0x6E, 0xC0, 0x6E, 0x3D, 0xC0, 0x62, 0x27,
+        0xA0, 0xD8, 0x9B, 0xA9, 0xFE, 0x94, 0x9C, 0xFE, 0xEF, 0x7E, 0xFE, 0x84, 0x5C, 0x9E, 0x56, 0xA4,
+        0xB9, 0xFE, 0xEF, 0x7D, 0x31, 0xC0, 0x45, 0x96, 0xF9, 0xC0, 0x1C, 0xC0, 0x6E, 0xA3, 0x78, 0x9C,
+        0xA8, 0xA2, 0x78, 0x1C, 0xA3, 0x77, 0x32, 0x37, 0x26, 0xC1, 0x21, 0x26, 0x37, 0x69, 0x37, 0x6E,
+        0xA2, 0x78, 0x69, 0x53, 0xFE, 0x6C, 0xBD, 0xB0, 0x60, 0x0A, 0xC0, 0x96, 0xAA, 0x9C, 0x9C, 0xAD,
+        0x73, 0x03, 0x67, 0x97, 0xAB, 0x9A, 0x8A, 0xA2, 0x86, 0x6B, 0x76, 0x20, 0x9A, 0xBB, 0xFE, 0xF3,
+        0x56, 0xFE, 0xA3, 0xBA, 0xA6, 0x06, 0x56, 0x9C, 0x9A, 0x19, 0xCB, 0x66, 0x6B, 0xA7, 0x86, 0x19,
+        0xC0, 0xA4, 0x78, 0xA8, 0x76, 0x3B, 0x05, 0x6D, 0x5E, 0xA8, 0xD5, 0xA3, 0xB8, 0x69, 0x9A, 0x3A,
+        0xFE, 0x6C, 0xDD, 0x85, 0xEE, 0xA2, 0x84, 0xCB, 0x69, 0xB0, 0x83, 0xA2, 0x87, 0xA8, 0x77, 0xFE,
+        0x19, 0x1B, 0xFE, 0x29, 0xB3, 0x55, 0xA2, 0x87, 0xA2, 0x87, 0xA4, 0x94, 0xAC, 0xA7, 0xA2, 0xD7,
+        0x99, 0xF6, 0x96, 0xEA, 0x7F, 0x56, 0x41, 0xA8, 0x17, 0xFE, 0x82, 0x76, 0x94, 0xE8, 0xA5, 0xD0,
+        0xA8, 0xB9, 0x46, 0x9D, 0x69, 0x5A, 0x9D, 0x97, 0xA7, 0x1C, 0x97, 0x1D, 0x42, 0xA3, 0x7A, 0x6D,
+        0xA6, 0x86, 0xA7, 0xB6, 0xA8, 0x77, 0xA6, 0x87, 0x9B, 0x98, 0x8E, 0x8C, 0x48, 0x7E, 0x66, 0x26,
+        0x9E, 0xB7, 0x9C, 0xD9, 0xA2, 0x96, 0x9E, 0xD6, 0xA6, 0xFA, 0xA4, 0x47, 0xA1, 0x06, 0x83, 0x26,
+        0xA3, 0x88, 0xC0, 0x94, 0x89, 0xFE, 0x52, 0xF4, 0xFE, 0x21, 0x36, 0x6F, 0xA4, 0x76, 0xC1, 0x6D,
+        0x6B, 0xA9, 0x89, 0xFE, 0xA5, 0x59, 0x85, 0x8F, 0xBF, 0x91, 0xAD, 0x95, 0xFE, 0x6B, 0xBC, 0xA3,
+        0x65, 0xA4, 0xB8, 0xFE, 0xF7, 0xDE, 0x31, 0x22, 0x49, 0xFE, 0xFE, 0x99, 0x6B, 0xC0, 0x10, 0x6F,
+        0x6E, 0x65, 0x1C, 0x21, 0xA3, 0x78, 0x61, 0xC1, 0x6F, 0xC0, 0x26, 0xC0, 0x6E, 0xC0, 0x32, 0x37,
+        0xA2, 0x77, 0x6F, 0x6F, 0xFE, 0x74, 0x7C, 0xB2, 0x30, 0xC1, 0x96, 0xAA, 0xA0, 0x8B, 0x05, 0x08,
+        0x9D, 0x9A, 0x93, 0xAC, 0xA2, 0x87, 0x66, 0xC1, 0x77, 0x9D, 0x8A, 0xFE, 0xDB, 0x97, 0x47, 0xFE,
+        0x7C, 0x7B, 0x9B, 0x8C, 0x19, 0xCD, 0x67, 0xAB, 0x76, 0x97, 0x9A, 0x19, 0xA2, 0x88, 0xA9, 0x77,
+        0xA2, 0x76, 0xA2, 0x77, 0x6D, 0x5E, 0xA5, 0xC6, 0x31, 0xC0, 0x9D, 0x69, 0x93, 0x5E, 0xFE, 0x21,
+        0x19, 0xFE, 0x31, 0xB2, 0xCA, 0x69, 0x11, 0xB1, 0x82, 0xA7, 0x86, 0xFE, 0x7C, 0x1A, 0x91, 0x7F,
+        0xA6, 0x70, 0x63, 0x51, 0x62, 0x56, 0x6E, 0xAD, 0xA4, 0xA4, 0x87, 0x9D, 0xB9, 0x97, 0xAC, 0xA2,
+        0x8A, 0xA8, 0x68, 0xFE, 0x4A, 0x9E, 0x9C, 0x19, 0xFE, 0x81, 0x70, 0xFE, 0xEA, 0x8F, 0xA1, 0xA9,
+        0xC0, 0x46, 0x9D, 0x68, 0x42, 0x9D, 0x96, 0xFE, 0x69, 0xCD, 0x06, 0xB6, 0x93, 0xA3, 0x98, 0x65,
+        0x9C, 0x79, 0x99, 0x9A, 0x94, 0x7B, 0xA3, 0x86, 0xA2, 0x77, 0xC2, 0x66, 0x6D, 0x19, 0x52, 0xA3,
+        0xA6, 0xFE, 0x81, 0xAB, 0xFE, 0xD2, 0x0D, 0x9E, 0x36, 0xFE, 0xAD, 0x97, 0x31, 0xC0, 0x41, 0x9D,
+        0x99, 0x86, 0x8D, 0x93, 0x7C, 0x06, 0xA4, 0x86, 0xA3, 0x86, 0x6F, 0x9F, 0x7D, 0xAF, 0xA7, 0xA5,
+        0xA1, 0xFE, 0x31, 0xF4, 0xB9, 0x94, 0xA6, 0x83, 0xFE, 0x5B, 0x5B, 0xA6, 0x64, 0xAC, 0xB5, 0xB3,
+        0x90, 0x31, 0x59, 0x45, 0xFE, 0xFE, 0xB9, 0x10, 0xC1, 0x15, 0xC0, 0x10, 0x6B, 0x6E, 0xC0, 0x21,
+        0x6E, 0xA2, 0x78, 0x65, 0xC0, 0x26, 0xC0, 0x2B, 0x26, 0x6F, 0xC0, 0x37, 0x6E, 0xC0, 0xFE, 0x94,
+        0xDD, 0xAF, 0x11, 0xC0, 0x69, 0x95, 0xBD, 0xA4, 0x77, 0x0A, 0xC0, 0x98, 0xAA, 0x98, 0x9B, 0x7E,
+        0xC1, 0x66, 0xC0, 0x09, 0xFE, 0xAB, 0x99, 0xFE, 0xEB, 0x77, 0xFE, 0x84, 0x5B, 0x9C, 0x6B, 0xA6,
+        0x84, 0xC5, 0x66, 0xC6, 0xA2, 0x89, 0xA9, 0x86, 0x9A, 0x89, 0x19, 0x1E, 0xA9, 0x87, 0xA3, 0x77,
+        0xA2, 0x77, 0x6D, 0x5E, 0xA2, 0x97, 0x31, 0xC0, 0x56, 0x96, 0x2B, 0xFE, 0x21, 0x9B, 0xFE, 0x31,
+        0xB1, 0x6B, 0xCA, 0xAC, 0x83, 0x6E, 0xAF, 0x94, 0xFE, 0x52, 0xBC, 0x99, 0x3E, 0x5E, 0x7E, 0x5A,
+        0x1D, 0x79, 0x7A, 0xC0, 0x19, 0x1D, 0xA2, 0x78, 0xA2, 0x77, 0xA2, 0x77, 0x69, 0x9C, 0xCA, 0xFE,
+        0x99, 0xEF, 0xFE, 0xF2, 0x90, 0x36, 0x55, 0x41, 0x9D, 0x67, 0x9C, 0x58, 0xA3, 0x1B, 0xA3, 0x1A,
+        0x5B, 0xC0, 0x66, 0x1E, 0xC0, 0x6E, 0xC5, 0x19, 0x1E, 0x23, 0x19, 0x53, 0xA7, 0x74, 0xFE, 0x6A,
+        0x4F, 0x75, 0xA4, 0x09, 0xBE, 0xA2, 0xA9, 0x88, 0x06, 0x74, 0x6C, 0x94, 0x96, 0x9A, 0x7D, 0x9C,
+        0x89, 0x9A, 0x8C, 0xA5, 0x85, 0xA4, 0x5E, 0xB9, 0xC0, 0x9A, 0x84, 0xFE, 0x32, 0x36, 0xA6, 0x79,
+        0x9E, 0xAB, 0xA6, 0x64, 0xA3, 0x96, 0xB6, 0xA1, 0xAB, 0x72, 0x7B, 0x66, 0x9F, 0x68, 0xFE, 0xFE,
+        0xDA, 0x62, 0x66, 0x6D, 0xC0, 0x17, 0xC1, 0x6D, 0x21, 0x66, 0x21, 0x6E, 0xC1, 0x21, 0x26, 0xC0,
+        0x6B, 0x32, 0xC0, 0x6E, 0x6E, 0xA2, 0x77, 0xFE, 0xA5, 0x1D, 0xAD, 0x02, 0xA7, 0xF6, 0xC0, 0x8D,
+        0x5F, 0xAA, 0x55, 0xA3, 0x86, 0x62, 0x95, 0xAC, 0x9B, 0xAB, 0xA3, 0x87, 0x66, 0xC1, 0x66, 0x9D,
+        0x9B, 0x72, 0x3F, 0x9D, 0x3C, 0xFE, 0x74, 0x5B, 0xA2, 0x87, 0x5A, 0xC6, 0x1E, 0x66, 0xC2, 0x18,
+        0xA6, 0x87, 0xA6, 0x76, 0x62, 0x1E, 0x19, 0xA8, 0x76, 0xA5, 0x77, 0xA2, 0x77, 0x03, 0x5E, 0x0A,
+        0xA8, 0xE5, 0x31, 0xC0, 0x98, 0x3A, 0xFE, 0x53, 0x9D, 0x91, 0xC5, 0xCA, 0x6D, 0xB1, 0x83, 0xA3,
+        0x97, 0xA3, 0x9B, 0xFE, 0x09, 0x7E, 0x02, 0xCA, 0x9D, 0xA9, 0xA6, 0xF5, 0xFE, 0xBD, 0xFD, 0x92,
+        0xF4, 0xFE, 0xEA, 0x6F, 0xA2, 0x98, 0x99, 0x56, 0xFE, 0x71, 0xED, 0xA1, 0x59, 0x1A, 0x5F, 0xCC,
+        0x66, 0x66, 0xA3, 0x87, 0xA3, 0x88, 0x9D, 0x9B, 0x9B, 0x9A, 0x04, 0x7F, 0x04, 0xA1, 0xA7, 0xB7,
+        0x86, 0x7F, 0x88, 0x7A, 0x04, 0xC0, 0x13, 0xC1, 0x9B, 0x9B, 0x9A, 0x6F, 0xFE, 0xAD, 0x9B, 0x94,
+        0x78, 0xFE, 0x32, 0x56, 0xA9, 0x76, 0x9D, 0xBD, 0x30, 0x63, 0xFE, 0xDF, 0x3E, 0xA5, 0x85, 0x5A,
+        0xC0, 0x56, 0x21, 0x1C, 0x65, 0xC0, 0x6E, 0x10, 0xC0, 0x15, 0x21, 0x15, 0x21, 0xC1, 0x3C, 0xC0,
+        0x9D, 0xA9, 0xC1, 0x6E, 0x32, 0xC0, 0x6E, 0xA2, 0x77, 0xC0, 0xFE, 0xC5, 0xDC, 0xA5, 0x27, 0x31,
+        0xC0, 0x8E, 0x6D, 0xA9, 0x25, 0xC0, 0x98, 0xAB, 0x9A, 0x9A, 0x9B, 0x9B, 0xA5, 0x85, 0x67, 0xC0,
+        0x66, 0xC0, 0x0E, 0x69, 0xFE, 0xC3, 0x79, 0x9F, 0xD7, 0xFE, 0x84, 0x7B, 0x4E, 0xC3, 0x7A, 0xC1,
+        0x1B, 0xC0, 0x1E, 0xC0, 0x1B, 0xC0, 0x9A, 0x9C, 0xAF, 0x83, 0xA2, 0x78, 0x38, 0x9B, 0x99, 0x1E,
+        0xA5, 0x77, 0xA8, 0x76, 0x6E, 0x03, 0x6E, 0x5E, 0xA4, 0xC6, 0x31, 0xC0, 0x30, 0xFE, 0x6C, 0xFD,
+        0x85, 0xEC, 0x7D, 0xC9, 0xAF, 0x83, 0x7D, 0xAC, 0x85, 0xFE, 0x5A, 0xFB, 0x9B, 0x0E, 0x02, 0xC3,
+        0x66, 0x66, 0x66, 0x66, 0x61, 0x9F, 0xB8, 0xA1, 0xC5, 0xFE, 0x9C, 0xFA, 0xB5, 0x91, 0xA2, 0x89,
+        0x87, 0xC9, 0xFE, 0xD2, 0x2E, 0x79, 0xFE, 0x7A, 0x4E, 0xFE, 0x42, 0xF2, 0x9C, 0x99, 0x66, 0x5A,
+        0xC6, 0x66, 0xC0, 0x23, 0xC2, 0x26, 0x6B, 0xA5, 0x87, 0xC1, 0x9A, 0x8B, 0x65, 0x04, 0x13, 0x04,
+        0x79, 0xB5, 0x93, 0x04, 0x13, 0x5A, 0x13, 0xC2, 0xFE, 0x2A, 0xDB, 0xAA, 0xC3, 0x95, 0xA7, 0xFE,
+        0x31, 0xD8, 0xAA, 0x65, 0x9F, 0x9B, 0xA8, 0x71, 0x9E, 0x9C, 0xFE, 0xE7, 0xBD, 0x6D, 0x5B, 0x0D,
+        0xC0, 0xFE, 0xFE, 0xDA, 0xC2, 0x66, 0x15, 0xC0, 0x6E, 0x15, 0x1A, 0x21, 0x6E, 0xC0, 0x3C, 0x6E,
+        0x3C, 0x65, 0x66, 0xC0, 0x30, 0x6B, 0xC0, 0x3C, 0x01, 0x9A, 0x7B, 0x96, 0x3F, 0xB4, 0xB0, 0x76,
+        0x92, 0x7D, 0xA6, 0x04, 0x9D, 0x99, 0x97, 0xAB, 0x98, 0xAD, 0x28, 0x69, 0xC0, 0x67, 0x66, 0xC0,
+        0x9C, 0x9B, 0xA2, 0x86, 0x9E, 0xC9, 0xFE, 0xEB, 0x97, 0xA0, 0x19, 0xFE, 0x74, 0xBA, 0xC1, 0x6B,
+        0xC0, 0x19, 0xC0, 0x77, 0xC3, 0x1B, 0xC0, 0x9C, 0x9C, 0xAF, 0x72, 0x6B, 0x7A, 0x41, 0x1E, 0xA3,
+        0x87, 0xAA, 0x66, 0x03, 0x6E, 0x5A, 0x0A, 0x7D, 0xA7, 0xF7, 0x31, 0x99, 0x3A, 0x93, 0x8F, 0xFE,
+        0x29, 0x75, 0xA2, 0x84, 0xC7, 0x69, 0xA6, 0x86, 0xAC, 0x74, 0xA8, 0x96, 0x9B, 0x8D, 0xFE, 0x09,
+        0x3E, 0xA8, 0x44, 0x1D, 0x9F, 0xB8, 0x74, 0x79, 0x78, 0x6D, 0x6D, 0x7D, 0x68, 0xA2, 0x85, 0xAB,
+        0x94, 0xB7, 0x95, 0x31, 0xC0, 0x9A, 0x88, 0xBB, 0xCD, 0xFE, 0xA9, 0x48, 0xA7, 0x0A, 0xFE, 0x4A,
+        0xF3, 0x5A, 0x65, 0x9D, 0x99, 0x56, 0x26, 0x56, 0x23, 0xC4, 0x62, 0x7E, 0x23, 0xC0, 0xA2, 0x88,
+        0xA2, 0x98, 0x9D, 0x8A, 0x13, 0xC2, 0x98, 0x8C, 0xA3, 0x96, 0x10, 0x13, 0x56, 0x7C, 0x53, 0x13,
+        0xC3, 0x10, 0xFE, 0x32, 0xDA, 0xB5, 0xB2, 0xA2, 0xA3, 0x9D, 0x9A, 0xA9, 0x88, 0xFE, 0x53, 0x1C,
+        0xA7, 0x72, 0xA1, 0xBB, 0xFE, 0xE7, 0xBC, 0x0D, 0xC0, 0x5B, 0x69, 0xFE, 0xFE, 0xFA, 0xC0, 0xA4,
+        0x68, 0x26, 0x66, 0xC1, 0x65, 0xC2, 0x26, 0x08, 0x3C, 0x01, 0xC0, 0x3C, 0x66, 0xC0, 0x3C, 0x37,
+        0x66, 0x37, 0xA3, 0x78, 0x08, 0xFE, 0x6C, 0x7D, 0xFE, 0xEF, 0xBE, 0x31, 0x94, 0x7C, 0xA3, 0x16,
+        0x96, 0x9A, 0x9C, 0x9A, 0x99, 0xAE, 0xA8, 0x72, 0x66, 0xC1, 0x67, 0x66, 0x9C, 0x9B, 0xA3, 0x86,
+        0x52, 0xFE, 0xC3, 0x38, 0xA2, 0xC6, 0xFE, 0x84, 0x9A, 0x19, 0xC4, 0x6B, 0xC1, 0x1B, 0x7A, 0xC0,
+        0x56, 0xA3, 0x8A, 0xAA, 0x73, 0xC1, 0x66, 0x98, 0x89, 0x66, 0xAB, 0x75, 0xA2, 0x77, 0x6E, 0x5E,
+        0xC0, 0x69, 0xA2, 0x98, 0xA2, 0xA7, 0x9D, 0x5A, 0x99, 0xAC, 0xFE, 0x21, 0x57, 0xA3, 0x92, 0xC7,
+        0xA2, 0x87, 0xB1, 0x82, 0xA3, 0x97, 0xA3, 0x8A, 0xFE, 0x29, 0x9C, 0xA2, 0x71, 0x27, 0xA2, 0x85,
+        0xC0, 0x2B, 0x6E, 0x2B, 0x6B, 0x6E, 0xC0, 0xA2, 0x96, 0xAC, 0x87, 0xAC, 0x89, 0xAD, 0xA3, 0xA4,
+        0x87, 0x65, 0x2E, 0x92, 0x6D, 0xA0, 0xB7, 0x13, 0x5A, 0x13, 0xC0, 0x0B, 0x2B, 0x9C, 0x9A, 0xA2,
+        0x77, 0x6E, 0xC3, 0x62, 0x1E, 0x2B, 0x37, 0x0B, 0x13, 0xC0, 0x9D, 0x9A, 0x6E, 0x13, 0xC1, 0x10,
+        0x95, 0xAE, 0x37, 0x13, 0xC0, 0x10, 0x13, 0xC5, 0x3A, 0xFE, 0xAD, 0xDE, 0xA2, 0x93, 0x93, 0x9D,
+        0xB3, 0x94, 0xFE, 0x53, 0x7B, 0xA4, 0x84, 0xAA, 0xB6, 0xFE, 0xD7, 0x7C, 0xA2, 0x88, 0x6B, 0x59,
+        0x0D, 0xFE, 0xFE, 0xDA, 0x3C, 0x6B, 0x9D, 0xA8, 0xC0, 0x21, 0x66, 0x69, 0xC0, 0x1C, 0x15, 0x26,
+        0xA4, 0x68, 0x6E, 0xC1, 0x9D, 0xA9, 0x66, 0xC0, 0x37, 0xC2, 0xA2, 0x77, 0xC0, 0xFE, 0x94, 0xBD,
+        0x2D, 0xA5, 0xD8, 0x97, 0x6B, 0x9C, 0x37, 0x99, 0x9B, 0xFE, 0x53, 0xFB, 0xAA, 0x71, 0xC1, 0x66,
+        0xC0, 0x67, 0x66, 0x0E, 0xA3, 0x86, 0x9C, 0x9B, 0xA3, 0xA6, 0xFE, 0xEB, 0x77, 0xA1, 0x39, 0x1E,
+        0xC2, 0x19, 0xC4, 0x20, 0x66, 0x3E, 0xB1, 0x72, 0xA2, 0x77, 0x3B, 0xC0, 0x00, 0x99, 0x9A, 0x1E,
+        0xAA, 0x76, 0xA4, 0x76, 0x5A, 0x6E, 0x69, 0x6E, 0xC2, 0x9C, 0x9B, 0xFE, 0x21, 0x38, 0x11, 0xC7,
+        0xB2, 0x71, 0x62, 0xAB, 0x85, 0xFE, 0x4A, 0x7C, 0x9F, 0x62, 0xA3, 0x94, 0x04, 0x10, 0xC0, 0x13,
+        0xC4, 0x69, 0xA7, 0xA5, 0xAD, 0x87, 0xA3, 0x8E, 0xB1, 0xA0, 0x8D, 0x9B, 0x0C, 0x13, 0xC4, 0x52,
+        0x52, 0xA2, 0x86, 0x55, 0x62, 0x5A, 0xC1, 0x7E, 0x53, 0x04, 0x10, 0x13, 0xC2, 0x0B, 0x39, 0x13,
+        0xC2, 0x06, 0x99, 0x9B, 0x04, 0x7F, 0xC6, 0x5B, 0xFE, 0x12, 0xDE, 0xFE, 0xD7, 0x1E, 0x93, 0x99,
+        0x97, 0x9D, 0xA4, 0x8A, 0x99, 0x5A, 0x9D, 0xAB, 0xFE, 0xD6, 0x9C, 0xA6, 0x55, 0x14, 0x6D, 0x66,
+        0x12, 0x1C, 0xA2, 0x77, 0xC0, 0x6E, 0x6F, 0x26, 0xC0, 0x66, 0x15, 0x1C, 0x21, 0x26, 0xA3, 0x78,
+        0xA2, 0x68, 0x7A, 0x66, 0x60, 0x2B, 0xC0, 0x3C, 0xC4, 0xFE, 0xBD, 0xBC, 0xA5, 0x06, 0xA5, 0x76,
+        0x9C, 0x99, 0x98, 0x9A, 0x9A, 0x9C, 0x9D, 0x9A, 0xA8, 0x62, 0x77, 0xC0, 0x66, 0xC0, 0x66, 0x1E,
+        0x9D, 0x9A, 0x1E, 0x0E, 0x1E, 0xFE, 0xB3, 0xD8, 0xFE, 0xF3, 0x97, 0xFE, 0x94, 0x59, 0x1E, 0xC5,
+        0x19, 0xC2, 0x9F, 0x9C, 0xAD, 0x73, 0xC2, 0x6E, 0x9D, 0x99, 0x98, 0x89, 0xA9, 0x76, 0xA4, 0x87,
+        0x5A, 0x6E, 0x6D, 0xC3, 0x0A, 0xFE, 0x29, 0xDA, 0x9F, 0xA1, 0xC4, 0x69, 0x11, 0xAF, 0x92, 0x56,
+        0x1B, 0xFE, 0x5B, 0x1B, 0x9A, 0x68, 0xA5, 0x91, 0xCA, 0x10, 0x74, 0xB6, 0x89, 0xA5, 0xA1, 0x87,
+        0x6F, 0x13, 0xC3, 0x56, 0x39, 0xA2, 0x87, 0x13, 0xC1, 0x0B, 0x04, 0xC0, 0x0B, 0x52, 0x0B, 0x13,
+        0xC5, 0x9B, 0x9B, 0x13, 0xC3, 0x99, 0x9C, 0xA2, 0x86, 0x10, 0x13, 0xC5, 0xA0, 0x4F, 0xAE, 0xB5,
+        0xFE, 0xEF, 0x9E, 0x83, 0x7E, 0xA9, 0xA8, 0xFE, 0x6B, 0xBC, 0xA3, 0x64, 0xA3, 0xBB, 0xFE, 0xE7,
+        0x3C, 0xA2, 0x58, 0xA2, 0x88, 0x69, 0x5A, 0x12, 0xFE, 0xFE, 0xB9, 0x6F, 0xA2, 0x78, 0xA3, 0x78,
+        0x69, 0x9C, 0xA9, 0xC1, 0x21, 0x26, 0x37, 0x01, 0x61, 0x6F, 0xA2, 0x77, 0x01, 0x65, 0x01, 0xC0,
+        0x6F, 0x3C, 0x01, 0xC0, 0x37, 0x3C, 0x9A, 0x7B, 0x96, 0x0F, 0xAC, 0x61, 0x97, 0xAA, 0x28, 0xFE,
+        0x6B, 0xDC, 0xFE, 0x7D, 0x59, 0x49, 0x77, 0xC1, 0x66, 0x1C, 0x9D, 0x9B, 0x1E, 0xC0, 0x53, 0xA3,
+        0x86, 0x76, 0xFE, 0xDB, 0x77, 0x7A, 0x21, 0x1E, 0xC7, 0x9A, 0x9D, 0xAF, 0x73, 0xA3, 0x87, 0xC0,
+        0x69, 0xC0, 0x6F, 0x3E, 0x98, 0x9A, 0xA7, 0x76, 0xA3, 0x78, 0x6E, 0x03, 0x6E, 0xC3, 0x0A, 0xFE,
+        0x4B, 0x3B, 0x94, 0xB5, 0x69, 0x11, 0xC3, 0xAD, 0x84, 0xA2, 0x87, 0xAB, 0x95, 0xFE, 0x63, 0x7B,
+        0x96, 0x7B, 0x13, 0xCC, 0x64, 0xB2, 0x85, 0x90, 0x8B, 0x13, 0x10, 0x13, 0xC0, 0x0B, 0x9C, 0x8A,
+        0x7E, 0x13, 0xC2, 0x10, 0xC1, 0x13, 0x66, 0x34, 0x13, 0xC6, 0x2D, 0x13, 0xC3, 0x0B, 0x96, 0x9C,
+        0xA9, 0x84, 0x13, 0xC4, 0x9F, 0x6F, 0xA5, 0x9B, 0xFE, 0xE7, 0x7E, 0x93, 0x9A, 0x8C, 0x7E, 0xAD,
+        0xA9, 0x95, 0x6D, 0xA2, 0x86, 0xB3, 0xB3, 0xA6, 0x83, 0xA5, 0x67, 0x6E, 0x6E, 0xC0, 0x7A, 0xFE,
+        0xFE, 0x99, 0xA3, 0x78, 0xA3, 0x79, 0x6E, 0x37, 0x26, 0x2B, 0x26, 0x37, 0x2B, 0xC0, 0xA3, 0x78,
+        0x61, 0x01, 0x66, 0xC0, 0xA2, 0x78, 0xC0, 0x6B, 0x6D, 0xC0, 0x01, 0x0D, 0x3C, 0xC0, 0xA2, 0x77,
+        0xFE, 0x7C, 0xDD, 0xAB, 0x40, 0x99, 0xAB, 0x96, 0x9F, 0xAB, 0xE4, 0xA1, 0x55, 0x9E, 0x48, 0x6B,
+        0x76, 0xC0, 0x66, 0xC0, 0x9C, 0x9B, 0x23, 0x1E, 0xC0, 0x23, 0xC0, 0x9D, 0xE9, 0xFE, 0xF3, 0x96,
+        0xA0, 0x2A, 0x23, 0xC0, 0x1E, 0xC4, 0x23, 0x29, 0xAF, 0x61, 0xC5, 0x9D, 0x99, 0x6E, 0xA4, 0x67,
+        0x69, 0x6E, 0xC0, 0x6E, 0x7A, 0xA4, 0xC8, 0x9C, 0x58, 0x0A, 0xFE, 0x5C, 0x3C, 0x8C, 0xD8, 0x69,
+        0x11, 0xC2, 0xAB, 0x84, 0xA7, 0x86, 0xA8, 0x86, 0xFE, 0x6B, 0x7A, 0x94, 0x6E, 0xFE, 0x4A, 0xF4,
+        0x69, 0xCC, 0x65, 0xA2, 0x87, 0x47, 0x13, 0x10, 0x39, 0x52, 0x39, 0x13, 0xC8, 0x9B, 0x9B, 0x10,
+        0x13, 0xC6, 0x2C, 0x13, 0xC4, 0x2C, 0x2D, 0x13, 0xC2, 0x10, 0xFE, 0x32, 0xDA, 0xA6, 0x89, 0xFE,
+        0xDF, 0x3E, 0x9B, 0x98, 0x88, 0x6E, 0xA2, 0xA9, 0xA3, 0x8D, 0x9E, 0x65, 0x9D, 0xAD, 0xFE, 0xEF,
+        0x9F, 0x9A, 0x86, 0xA8, 0x57, 0xC0, 0x5A, 0xC0, 0x66, 0xFE, 0xFE, 0xBA, 0x6E, 0xA4, 0x67, 0x6E,
+        0x37, 0xC0, 0x21, 0xA2, 0x77, 0x01, 0xC0, 0x2B, 0xC0, 0x66, 0x30, 0x2B, 0xA4, 0x68, 0xC0, 0x6E,
+        0x6B, 0x0D, 0xA2, 0x78, 0x3C, 0x01, 0xC0, 0x35, 0x0D, 0x94, 0x7F, 0x99, 0x19, 0x69, 0xFE, 0x73,
+        0xFC, 0xFE, 0xBE, 0x1B, 0x9D, 0x79, 0x9D, 0x38, 0x7B, 0x66, 0xC0, 0x66, 0xC0, 0x53, 0x21, 0x66,
+        0x6F, 0x21, 0xC1, 0xFE, 0xB4, 0x18, 0xFE, 0xF3, 0xB7, 0xFE, 0xAC, 0x18, 0xFE, 0x74, 0xFA, 0xC4,
+        0x1C, 0x9A, 0x9D, 0xB0, 0x62, 0xA3, 0x87, 0x05, 0xC6, 0x6E, 0x6D, 0xC0, 0x6E, 0xC0, 0xA2, 0xB8,
+        0xA6, 0xE7, 0x9D, 0x69, 0x9A, 0x2A, 0xFE, 0x6C, 0xFD, 0x85, 0xEC, 0x7D, 0xC0, 0x69, 0x11, 0xAB,
+        0x84, 0xA8, 0x85, 0xA7, 0x97, 0xFE, 0x6B, 0x7B, 0x9E, 0x7C, 0x9D, 0x55, 0xA1, 0xB2, 0xCD, 0x0B,
+        0xC0, 0x9D, 0x99, 0x9D, 0x9A, 0x27, 0xA5, 0x86, 0x13, 0xC9, 0x9D, 0x9A, 0x5A, 0x13, 0xC7, 0x2C,
+        0x13, 0xC4, 0x0B, 0x97, 0xAC, 0x0B, 0x13, 0x5A, 0xA0, 0x8A, 0xFE, 0x22, 0xBC, 0xAC, 0xB4, 0xFE,
+        0xE7, 0x7E, 0x97, 0x99, 0x8A, 0x6D, 0x9C, 0x9B, 0xB2, 0xA6, 0x92, 0x5E, 0x2E, 0xAC, 0xB7, 0xFE,
+        0xF7, 0xBE, 0x99, 0x79, 0xA8, 0x66, 0xC0, 0x57, 0x69, 0xC0, 0xFE, 0xFE, 0xFA, 0x6E, 0x26, 0x37,
+        0x2B, 0xC0, 0x9D, 0xAA, 0x26, 0x37, 0xA2, 0x77, 0x37, 0x9D, 0xA9, 0x1C, 0x21, 0x2B, 0xA4, 0x68,
+        0xC0, 0x6E, 0x65, 0x01, 0x0D, 0x37, 0x01, 0x3C, 0x65, 0x01, 0x5B, 0xFE, 0x74, 0x7B, 0x9C, 0x6A,
+        0xAD, 0xD3, 0xA4, 0x85, 0x9D, 0x79, 0x9D, 0x38, 0x6B, 0xC0, 0x76, 0xC0, 0x9D, 0x9A, 0x26, 0xC0,
+        0x66, 0xC4, 0xFE, 0xCB, 0xB7, 0x9F, 0xE9, 0xFE, 0x94, 0x79, 0xA4, 0x26, 0xC0, 0x21, 0xC0, 0x6B,
+        0x23, 0xA3, 0x8A, 0xAB, 0x62, 0x6B, 0xC7, 0x08, 0xC1, 0x6E, 0xC0, 0x7A, 0x31, 0x56, 0x08, 0xFE,
+        0x75, 0x3D, 0x83, 0xEE, 0x7C, 0xC1, 0xAD, 0x83, 0xA7, 0x96, 0xA6, 0x87, 0xFE, 0x63, 0x3B, 0xA8,
+        0x73, 0xB3, 0x83, 0xFE, 0x2A, 0xBB, 0xFE, 0x4A, 0xF3, 0xC8, 0x0B, 0xC0, 0x3F, 0x56, 0x20, 0x52,
+        0x6E, 0xA4, 0x87, 0x0B, 0x7E, 0xCB, 0x27, 0x13, 0xC8, 0x27, 0x13, 0xC4, 0x5A, 0x97, 0xAD, 0x3F,
+        0x10, 0x9F, 0x7E, 0x9F, 0x5F, 0xFE, 0xA5, 0x9E, 0xB0, 0x90, 0x90, 0x8B, 0x8F, 0x6B, 0x9C, 0x9B,
+        0xB6, 0xA4, 0xFE, 0x7C, 0x3D, 0x9F, 0x65, 0x34, 0xFE, 0xEF, 0x7E, 0x9B, 0x88, 0xA6, 0x66, 0xA2,
+        0x77, 0x6B, 0x56, 0x6E, 0xC0, 0xFE, 0xFF, 0x3B, 0xA2, 0x77, 0x3C, 0x9C, 0xA9, 0x65, 0xC0, 0x6B,
+        0xC0, 0x21, 0xC1, 0x69, 0x1C, 0x21, 0xA2, 0x77, 0x01, 0x6F, 0x6E, 0x01, 0x3C, 0xC0, 0x37, 0x3C,
+        0xC1, 0x0D, 0xC0, 0x94, 0x7F, 0xFE, 0x6B, 0x9D, 0x32, 0xC0, 0x9D, 0x69, 0x9D, 0x48, 0x7A, 0x5B,
+        0x26, 0x56, 0xC0, 0x26, 0xC6, 0x76, 0xFE, 0xDB, 0x76, 0xA0, 0xA9, 0xFE, 0x84, 0xD9, 0xA2, 0x57,
+        0xC0, 0x26, 0x6B, 0x9A, 0xAD, 0xFE, 0x96, 0xBC, 0x6F, 0x69, 0xC0, 0x03, 0x08, 0xC0, 0x67, 0xC0,
+        0x03, 0x08, 0xC0, 0x6E, 0xC1, 0x6E, 0x0D, 0xFE, 0xF7, 0xFF, 0x31, 0x98, 0x2A, 0x94, 0x8E, 0x80,
+        0xEF, 0x11, 0x69, 0xB0, 0x73, 0xA4, 0x97, 0xA6, 0x77, 0xFE, 0x52, 0xBC, 0x95, 0x8A, 0xFE, 0x63,
+        0x94, 0xBE, 0x93, 0xFE, 0x12, 0xBD, 0xFE, 0x42, 0xF4, 0x13, 0x5A, 0xC0, 0x66, 0x69, 0x66, 0x56,
+        0x65, 0xC0, 0x52, 0x9D, 0x9B, 0x0E, 0x27, 0x37, 0x10, 0x7A, 0xCD, 0x2C, 0x0B, 0x13, 0xC8, 0x27,
+        0x13, 0xC5, 0x9D, 0x8A, 0x9D, 0x8A, 0xA4, 0x5F, 0xA8, 0xA6, 0xFE, 0xD6, 0xDE, 0xA2, 0x85, 0x8A,
+        0x7C, 0x97, 0x7C, 0x9C, 0xAB, 0xB5, 0x92, 0xA5, 0x9B, 0x8E, 0x5D, 0xA2, 0x87, 0xAD, 0xB6, 0xAF,
+        0x90, 0x9D, 0x88, 0xA7, 0x77, 0x55, 0xC0, 0x5B, 0x5A, 0x66, 0x9E, 0xE7, 0x66, 0x66, 0x61, 0x15,
+        0x66, 0x6B, 0x15, 0xC0, 0xA3, 0x78, 0x3C, 0x9C, 0xA9, 0xC1, 0x26, 0x30, 0x3C, 0x6F, 0x6E, 0x3C,
+        0x2B, 0x6B, 0x37, 0xC0, 0x3C, 0x06, 0xC0, 0x98, 0x8D, 0xFE, 0x94, 0xBC, 0xAB, 0x82, 0xC0, 0x9C,
+        0x38, 0x9E, 0x68, 0xC1, 0x6B, 0x62, 0xA2, 0x87, 0x66, 0xC0, 0x2B, 0xC0, 0x28, 0xC0, 0x21, 0x26,
+        0xC0, 0x9E, 0xB9, 0xFE, 0xE3, 0x96, 0x67, 0xFE, 0x7D, 0x18, 0x26, 0xC0, 0x99, 0xAF, 0xFE, 0x96,
+        0x9C, 0xA3, 0x77, 0xC0, 0x66, 0xC7, 0x0D, 0xC3, 0x6E, 0xFE, 0xF7, 0xFF, 0x31, 0x9A, 0x49, 0x93,
+        0x6F, 0xFE, 0x29, 0x75, 0xA3, 0x94, 0xB1, 0x72, 0xA4, 0x97, 0xA1, 0x9B, 0xFE, 0x3A, 0x1D, 0xA1,
+        0x64, 0x9C, 0x97, 0xA6, 0x81, 0xBD, 0xA2, 0xFE, 0x5B, 0xBC, 0x95, 0x97, 0xA1, 0x94, 0xC1, 0x56,
+        0xC0, 0x62, 0x52, 0x67, 0xA2, 0x88, 0xA3, 0x87, 0x0B, 0x7E, 0xD0, 0x9C, 0x8A, 0xC0, 0xA4, 0x76,
+        0x13, 0xC8, 0x2C, 0x13, 0xC5, 0x10, 0xFE, 0x09, 0x97, 0xBB, 0xB2, 0xFE, 0xEF, 0x9E, 0x93, 0x8A,
+        0x8A, 0x7D, 0x9B, 0x9B, 0xAA, 0x97, 0xB0, 0x82, 0xA3, 0x9A, 0xFE, 0x5B, 0x7C, 0xA4, 0x63, 0x9E,
+        0xBC, 0xFE, 0xEF, 0x9F, 0x99, 0x87, 0xA9, 0x87, 0xC0, 0x59, 0xC0, 0x5A, 0x57, 0x6B, 0x9D, 0xF7,
+        0x6E, 0x37, 0x9D, 0xA8, 0x66, 0x66, 0x6B, 0x15, 0xC0, 0x6F, 0x1A, 0xC0, 0x21, 0xC0, 0xA2, 0x77,
+        0x6E, 0x01, 0x6F, 0x01, 0x37, 0x2B, 0x6B, 0xC0, 0x37, 0x3C, 0xC0, 0x01, 0xFE, 0xBD, 0xFD, 0x9A,
+        0x58, 0xA6, 0xB6, 0x9F, 0x68, 0x9D, 0x38, 0x66, 0xC1, 0x67, 0xC0, 0x21, 0x28, 0xC0, 0x21, 0xC4,
+        0x7B, 0x21, 0x9C, 0xEA, 0xFE, 0xEB, 0x97, 0xA0, 0x58, 0xFE, 0x75, 0x39, 0x9B, 0x8D, 0xAF, 0x62,
+        0xA4, 0x86, 0xC4, 0x66, 0xC3, 0x0D, 0xC2, 0x6E, 0xC0, 0x7A, 0x31, 0xC0, 0x9B, 0x49, 0x14, 0x86,
+        0xEE, 0xFE, 0x84, 0x55, 0xA4, 0x87, 0xFE, 0x73, 0xFA, 0xFE, 0x4A, 0x9E, 0xFE, 0x94, 0xDD, 0x51,
+        0x9D, 0x99, 0x8D, 0x79, 0xB3, 0xA4, 0xA1, 0x7A, 0xFE, 0x19, 0xD7, 0x13, 0x66, 0xC0, 0x13, 0xA2,
+        0x88, 0x34, 0xA3, 0x87, 0xA2, 0x87, 0x5A, 0x13, 0xD1, 0x9D, 0x99, 0x9B, 0x8B, 0x13, 0xCA, 0x27,
+        0x13, 0xC5, 0x5B, 0x9E, 0x9D, 0x09, 0x8B, 0x7C, 0x90, 0x7D, 0x77, 0xB6, 0x93, 0xB0, 0x84, 0x6E,
+        0xFE, 0x84, 0x3C, 0x9D, 0x57, 0x7B, 0xB3, 0xB3, 0xA8, 0x82, 0x5E, 0xA4, 0x77, 0x69, 0xC0, 0x5A,
+        0xC0, 0x5A, 0x6B, 0xFE, 0xFF, 0x3A, 0x3C, 0x30, 0x1A, 0x6F, 0x66, 0x65, 0xC0, 0x26, 0xC0, 0x6E,
+        0x3C, 0x2B, 0xC0, 0x01, 0xC0, 0x6E, 0x6F, 0x6B, 0x01, 0x30, 0x2B, 0x32, 0x6E, 0xC0, 0x3C, 0x01,
+        0xFE, 0xAD, 0x5C, 0x23, 0xA2, 0x76, 0xC2, 0x66, 0xC0, 0x23, 0x21, 0xC9, 0x28, 0xC0, 0xFE, 0x94,
+        0xB7, 0xFE, 0xF3, 0xB7, 0x9E, 0x3A, 0xFE, 0x75, 0xFC, 0xA9, 0x83, 0x6B, 0x0D, 0xC5, 0x66, 0xC0,
+        0x0D, 0xC2, 0x12, 0xC1, 0xA2, 0xA7, 0x31, 0xC0, 0x9A, 0x29, 0x92, 0x8F, 0x97, 0xE7, 0x10, 0xFE,
+        0x52, 0xBC, 0x99, 0x6B, 0xA4, 0x96, 0xFE, 0xBD, 0xFC, 0xA6, 0x85, 0x89, 0x8F, 0x39, 0xB6, 0xA2,
+        0xA4, 0x7A, 0xFE, 0x12, 0x7C, 0xFE, 0x42, 0xD3, 0x13, 0xD8, 0x51, 0x98, 0x9C, 0x0B, 0x13, 0xCA,
+        0x27, 0x13, 0xC3, 0x5A, 0x13, 0xFE, 0x32, 0xDA, 0x99, 0xAB, 0xFE, 0x94, 0xF7, 0x8D, 0x8E, 0x21,
+        0xB6, 0x92, 0xA9, 0x86, 0xA2, 0x88, 0x93, 0x8E, 0xFE, 0x5B, 0x7B, 0xA4, 0x74, 0xA4, 0xAA, 0xFE,
+        0xDF, 0x1C, 0x55, 0xA8, 0x75, 0x47, 0xC1, 0x69, 0xC2, 0x30, 0x3C, 0x9D, 0xA9, 0x2B, 0x3C, 0xC0,
+        0x26, 0x3C, 0x30, 0xC0, 0x3C, 0x6E, 0x6F, 0x30, 0x0D, 0x6E, 0xC2, 0x01, 0x30, 0x6B, 0x3C, 0xC3,
+        0xFE, 0xAD, 0x1D, 0xFE, 0x6D, 0x58, 0x6E, 0xC2, 0x21, 0xCD, 0x7A, 0x21, 0xFE, 0xAC, 0x37, 0x0C,
+        0xFE, 0xC5, 0x9A, 0xFE, 0x8F, 0x3B, 0x77, 0xC0, 0xA0, 0xA8, 0xA2, 0xA8, 0x5A, 0x12, 0x66, 0xC4,
+        0x12, 0xC3, 0xA2, 0xA7, 0x31, 0x46, 0x99, 0x29, 0xFE, 0x75, 0x5D, 0x92, 0xED, 0xA1, 0x9A, 0xAE,
+        0x81, 0xFE, 0x2A, 0x3A, 0xA3, 0x75, 0xAD, 0xD7, 0xFE, 0xDF, 0x1D, 0xFE, 0x6B, 0x76, 0x13, 0xAA,
+        0x85, 0x1D, 0xFE, 0x63, 0xFE, 0x36, 0x13, 0xD7, 0x3F, 0x99, 0x9C, 0xA7, 0x86, 0xA2, 0x87, 0xCA,
+        0x56, 0x9B, 0x9A, 0x13, 0xC4, 0x17, 0xFE, 0x12, 0xBE, 0xFE, 0x6B, 0xD9, 0x95, 0x87, 0xAC, 0xA7,
+        0xB7, 0x93, 0xA8, 0x86, 0x6D, 0x98, 0x9C, 0xFE, 0x63, 0x7C, 0xA4, 0x53, 0x9C, 0xAD, 0xFE, 0xBD,
+        0xFB, 0xAB, 0x84, 0xA5, 0x77, 0x56, 0x5A, 0x6B, 0x12, 0x69, 0x5B, 0x12, 0xC0, 0xFE, 0xFE, 0xFA,
+        0xC0, 0x66, 0x3C, 0xA2, 0x78, 0x66, 0x9D, 0xA8, 0x0D, 0x65, 0xC0, 0x61, 0x0D, 0xC0, 0x30, 0x01,
+        0x0D, 0xC3, 0x3C, 0x30, 0x01, 0x3C, 0x0D, 0x69, 0x01, 0xFE, 0xB5, 0x7C, 0x23, 0xA2, 0x76, 0xC3,
+        0x66, 0xCD, 0x26, 0x99, 0xBF, 0xFE, 0xC4, 0x78, 0xFE, 0xF3, 0xD7, 0xFE, 0xB6, 0x3A, 0xA9, 0x36,
+        0xA3, 0xE9, 0x31, 0xC1, 0x9D, 0x69, 0x9C, 0x18, 0xC1, 0xA1, 0xB8, 0xA3, 0xC9, 0x0F, 0xC0, 0x9E,
+        0x58, 0x9E, 0x58, 0x12, 0xC1, 0xA3, 0xE9, 0x9E, 0x68, 0x9E, 0x58, 0xFE, 0x64, 0x7D, 0xA4, 0xD5,
+        0xB7, 0x80, 0x51, 0xFE, 0x73, 0xBD, 0x98, 0x37, 0x1A, 0xFE, 0x9D, 0x1A, 0x3D, 0x8A, 0x6D, 0x13,
+        0x38, 0xA6, 0x89, 0xFE, 0x22, 0xFE, 0xA0, 0xA1, 0x13, 0xD5, 0x55, 0x99, 0x9C, 0xA4, 0x87, 0x13,
+        0xCB, 0x9D, 0x9A, 0x39, 0x13, 0xC4, 0xFE, 0x2A, 0xDA, 0xAF, 0xC5, 0xA6, 0xA0, 0x8A, 0x7E, 0xBF,
+        0x91, 0xAA, 0x96, 0x31, 0x9B, 0x8A, 0xFE, 0x7C, 0x3D, 0x9D, 0x66, 0x67, 0xA8, 0xB5, 0xFE, 0xEF,
+        0x9D, 0xA3, 0x87, 0x5A, 0x56, 0x5A, 0xC1, 0x0B, 0xC0, 0x5B, 0xC0, 0xFE, 0xFE, 0xB9, 0xC0, 0x6E,
+        0x3C, 0xC1, 0x2B, 0xA3, 0x78, 0xC1, 0x30, 0x3C, 0x01, 0x2B, 0x01, 0x6F, 0xC0, 0x5A, 0x79, 0xC0,
+        0x01, 0x62, 0x06, 0xC0, 0x6F, 0xC0, 0x0D, 0x94, 0x7D, 0x95, 0x2D, 0xA6, 0x63, 0xA2, 0xD9, 0xA2,
+        0xA8, 0x9E, 0x47, 0x21, 0xCE, 0x9C, 0x9C, 0xAD, 0x64, 0xA3, 0x86, 0xFE, 0xDB, 0xF6, 0xA0, 0xA9,
+        0xFE, 0xF7, 0x7E, 0x31, 0x5A, 0x56, 0x69, 0x9D, 0x49, 0x9D, 0x59, 0xC1, 0xA4, 0xF8, 0x31, 0xC2,
+        0x29, 0x32, 0x12, 0xC0, 0x66, 0xC0, 0x66, 0xFE, 0x7C, 0xBD, 0xFE, 0xD6, 0xBA, 0xA9, 0x99, 0x09,
+        0x98, 0x8C, 0xFE, 0x2A, 0x3B, 0xA4, 0x62, 0xA2, 0xCC, 0xFE, 0xC6, 0x1C, 0x86, 0x7E, 0x4C, 0xA2,
+        0x97, 0x80, 0x91, 0x9B, 0x8D, 0xFE, 0x1A, 0xDE, 0x36, 0xA1, 0xA2, 0x79, 0x10, 0x13, 0xD0, 0x04,
+        0x9A, 0x9B, 0x6F, 0x13, 0xCC, 0x2C, 0xA4, 0x86, 0x13, 0xC2, 0x10, 0xA0, 0x8B, 0xFE, 0x22, 0xDE,
+        0xFE, 0xDF, 0x1E, 0x82, 0x8E, 0xAE, 0x85, 0xB4, 0x93, 0xA3, 0x87, 0x9C, 0x8A, 0xFE, 0x9C, 0xFD,
+        0x95, 0x6B, 0xA3, 0x86, 0x9F, 0xBC, 0x3A, 0xA5, 0x87, 0x1D, 0x59, 0x66, 0xC2, 0x0B, 0x6B, 0x5A,
+        0xC0, 0xFE, 0xFE, 0xB9, 0xC1, 0xA2, 0x78, 0xA2, 0x78, 0x2B, 0xA2, 0x78, 0xA2, 0x78, 0x2B, 0xC0,
+        0x26, 0xC0, 0x2B, 0x65, 0xA3, 0x78, 0xA2, 0x78, 0x0D, 0x5B, 0x0D, 0x01, 0x35, 0x66, 0x3C, 0x01,
+        0xC0, 0x06, 0x01, 0x9D, 0x7B, 0xFE, 0x53, 0xFB, 0x24, 0xA6, 0xE8, 0xC1, 0x9C, 0x48, 0x24, 0x5A,
+        0xC2, 0x24, 0x21, 0xC7, 0xA0, 0x9B, 0xAF, 0x52, 0x65, 0x9D, 0xEA, 0xFE, 0xF3, 0xF7, 0xA5, 0x67,
+        0xFE, 0xCF, 0x7D, 0x9E, 0x37, 0x9D, 0x8B, 0x9B, 0x9B, 0x63, 0xA3, 0x86, 0xA4, 0x86, 0xA2, 0x77,
+        0xA1, 0xA8, 0xA3, 0xD9, 0xA2, 0xA8, 0xA1, 0xA8, 0xC2, 0x9B, 0x39, 0x9D, 0x59, 0xC1, 0x9D, 0xAB,
+        0x96, 0xFC, 0xFE, 0xD6, 0x98, 0xAA, 0x79, 0x31, 0xC0, 0x07, 0x1B, 0xC0, 0xAD, 0xD6, 0xA7, 0x82,
+        0x8C, 0x6D, 0xA3, 0x86, 0xA7, 0xA7, 0xBB, 0xA3, 0x3B, 0xFE, 0x74, 0x7E, 0x92, 0x2F, 0xA1, 0xC5,
+        0xA0, 0xA4, 0xA1, 0x95, 0x79, 0xCE, 0x3F, 0x9B, 0x9A, 0x27, 0xA7, 0x75, 0x13, 0xCC, 0x97, 0x9D,
+        0xA8, 0x73, 0x10, 0x13, 0xC0, 0x10, 0xA0, 0x7C, 0xFE, 0x12, 0xBE, 0xFE, 0xB6, 0x3E, 0x9F, 0xA5,
+        0xFE, 0x4A, 0x94, 0xFE, 0xDE, 0xDC, 0x2A, 0x18, 0x90, 0x8F, 0x8E, 0x5F, 0xA4, 0x74, 0x9E, 0xAB,
+        0xFE, 0xD7, 0x1C, 0xA7, 0x86, 0x65, 0x6E, 0xC0, 0x1D, 0x5A, 0x0E, 0x1D, 0x46, 0x69, 0x12, 0xC0,
+        0x15, 0xC0, 0x6E, 0xC0, 0x6F, 0xC0, 0xA4, 0x67, 0x6F, 0x66, 0x9D, 0xA8, 0x1A, 0xC0, 0x26, 0xC0,
+        0xA2, 0x77, 0x01, 0x06, 0x0A, 0xC0, 0x06, 0x30, 0x67, 0x30, 0x01, 0xA2, 0x78, 0xC1, 0x06, 0xFE,
+        0x73, 0xFC, 0xFE, 0x75, 0x58, 0xA5, 0xF9, 0x6E, 0xC0, 0x56, 0x21, 0x24, 0x21, 0xC9, 0x24, 0x9C,
+        0x8C, 0xB1, 0x61, 0xA2, 0x78, 0x66, 0xA4, 0xD7, 0xFE, 0xEE, 0xBC, 0xFE, 0xF3, 0xB7, 0xFE, 0xCD,
+        0x39, 0xFE, 0x75, 0xBC, 0xFE, 0x52, 0xDD, 0xA9, 0x84, 0x7E, 0x9D, 0x99, 0x17, 0xA6, 0x55, 0xAF,
+        0x51, 0xAA, 0x62, 0xA3, 0x86, 0xA2, 0xA9, 0xA2, 0xD8, 0xA3, 0xA7, 0x31, 0x9D, 0x59, 0x9B, 0x39,
+        0xC0, 0x66, 0xFE, 0x75, 0x3D, 0xFE, 0xDE, 0xF9, 0xA5, 0x96, 0x97, 0x8D, 0xAC, 0x87, 0x31, 0x9D,
+        0x89, 0xFE, 0x4A, 0xDC, 0x9F, 0x64, 0x9C, 0x9D, 0xFE, 0x9D, 0x1C, 0x9A, 0x97, 0x93, 0x5A, 0xA2,
+        0x87, 0xA2, 0x97, 0xB6, 0x93, 0x15, 0x3B, 0x94, 0x7E, 0xFE, 0x5B, 0xBE, 0x3E, 0xA0, 0xB6, 0xA1,
+        0xA5, 0xA1, 0xA4, 0x78, 0xCA, 0x9D, 0x89, 0x9B, 0x9A, 0xA2, 0x89, 0x13, 0xCD, 0x52, 0x9A, 0x8A,
+        0xA7, 0x86, 0x13, 0xC0, 0x1E, 0x9E, 0x7F, 0xA4, 0x69, 0xFE, 0xC6, 0x7E, 0xA4, 0x94, 0x81, 0x6F,
+        0xAE, 0xA6, 0xB0, 0x83, 0xA5, 0x99, 0x95, 0x9D, 0xFE, 0x53, 0x3C, 0xA5, 0x73, 0x9D, 0xAC, 0xFE,
+        0xC6, 0xBE, 0xAA, 0x71, 0x0E, 0x16, 0x1D, 0xC0, 0x56, 0x13, 0x0E, 0x15, 0x59, 0xC2, 0xFE, 0xFE,
+        0xB9, 0x6E, 0xC1, 0x15, 0x2B, 0xA2, 0x78, 0xA2, 0x77, 0x01, 0x30, 0x1A, 0x6B, 0x1A, 0x6E, 0x2B,
+        0x3C, 0x01, 0xC0, 0x3C, 0x69, 0xC0, 0x30, 0x3C, 0x01, 0xA2, 0x78, 0xC1, 0x01, 0xFE, 0xBD, 0xBC,
+        0x98, 0x1A, 0xA9, 0xD4, 0x32, 0xC0, 0x2D, 0x9D, 0x48, 0x9E, 0x58, 0xCA, 0x67, 0xA7, 0x77, 0xA8,
+        0x75, 0x6E, 0x69, 0x7F, 0xA2, 0xE8, 0xFE, 0xC4, 0xF8, 0xFE, 0xF3, 0xB7, 0x9A, 0x0F, 0xB3, 0x10,
+        0x6D, 0xC2, 0x57, 0x98, 0x8C, 0x95, 0x9F, 0xA6, 0x45, 0xAE, 0x50, 0xAB, 0x63, 0xA2, 0xA7, 0xA3,
+        0xB8, 0x9D, 0x59, 0x56, 0xC0, 0x99, 0xBD, 0xFE, 0x9C, 0xBB, 0xFE, 0xF7, 0x55, 0x7F, 0x9C, 0x79,
+        0x9B, 0x8F, 0xAC, 0x88, 0x31, 0x94, 0x8D, 0xFE, 0x2A, 0x5A, 0xA3, 0x84, 0x9D, 0xBE, 0xFE, 0xAD,
+        0x7C, 0x9D, 0x87, 0x8F, 0x8D, 0x9D, 0x88, 0xA3, 0x77, 0x20, 0xAF, 0xA5, 0xAB, 0x97, 0xA8, 0x86,
+        0x57, 0x97, 0x8D, 0x95, 0x6E, 0xFE, 0x1A, 0xDE, 0xA0, 0xA5, 0xA1, 0xB1, 0x79, 0xC6, 0x10, 0x9D,
+        0x98, 0x9A, 0x9C, 0xA4, 0x87, 0xA5, 0x86, 0xCE, 0x98, 0x9C, 0xA4, 0x75, 0x10, 0xA0, 0x7B, 0x3A,
+        0x09, 0xFE, 0x95, 0x3E, 0xFE, 0xE7, 0x7E, 0x99, 0x99, 0x86, 0x6E, 0x97, 0xAD, 0xFE, 0xDF, 0x1D,
+        0xA5, 0x97, 0x91, 0x8D, 0xFE, 0x5B, 0x3C, 0xA4, 0x63, 0x6B, 0xB1, 0xA4, 0xB0, 0x70, 0x6D, 0x69,
+        0x76, 0x16, 0x13, 0xC1, 0x0E, 0x0B, 0xC3, 0x2B, 0x66, 0x65, 0x66, 0x1A, 0x2B, 0xA3, 0x78, 0x06,
+        0x01, 0x3C, 0x26, 0x69, 0xC2, 0x2B, 0x35, 0xC0, 0x01, 0x06, 0xC1, 0x3C, 0xA3, 0x78, 0xC0, 0x69,
+        0x12, 0x06, 0x52, 0xFE, 0x63, 0xBC, 0xFE, 0x85, 0x79, 0x2D, 0x6E, 0x2D, 0x9D, 0x59, 0x9F, 0x47,
+        0x66, 0xC8, 0x7A, 0xA1, 0x8B, 0xAD, 0x63, 0x6E, 0x69, 0xC2, 0x97, 0xBD, 0xFE, 0xCA, 0x78, 0xA9,
+        0x83, 0xFE, 0xB5, 0x5B, 0x5E, 0xC5, 0xFE, 0xA2, 0xF7, 0xFE, 0xB8, 0x34, 0xFE, 0x72, 0x57, 0xFE,
+        0x64, 0xBC, 0xA6, 0x75, 0xA5, 0x86, 0x67, 0x96, 0xAD, 0xA0, 0xE4, 0x0F, 0x98, 0x9A, 0xA6, 0x77,
+        0x9C, 0x98, 0x9C, 0x8B, 0xA5, 0x6C, 0x31, 0x65, 0xFE, 0x8C, 0x9D, 0x90, 0x4B, 0x7D, 0x9F, 0xBD,
+        0xFE, 0xAD, 0x9C, 0x7C, 0x55, 0x99, 0x9A, 0x90, 0x7C, 0x4A, 0xA2, 0x87, 0x7E, 0xAA, 0x96, 0xAC,
+        0x95, 0xAC, 0x86, 0x5B, 0xFE, 0x84, 0xBE, 0x90, 0x2F, 0xA2, 0xC0, 0xA0, 0xA5, 0xC0, 0x10, 0x13,
+        0xC1, 0x55, 0x9D, 0x99, 0x9A, 0x9C, 0xA6, 0x76, 0x13, 0xCA, 0x10, 0x13, 0xA0, 0x7A, 0x9F, 0x7D,
+        0x57, 0x98, 0x99, 0xA7, 0x69, 0xA1, 0x6B, 0xA6, 0xC5, 0xB0, 0xB0, 0x05, 0x75, 0x8E, 0x7B, 0x8F,
+        0x7D, 0x97, 0xAD, 0xB7, 0x94, 0xB6, 0x81, 0x98, 0x8B, 0xFE, 0x5B, 0x3C, 0xA4, 0x63, 0x7F, 0xAC,
+        0x95, 0xFE, 0xEF, 0xDC, 0xA1, 0x7A, 0x69, 0x69, 0xC1, 0x7A, 0xC0, 0x6B, 0xC0, 0x1A, 0x55, 0x6E,
+        0x0B, 0x6B, 0x9B, 0xF8, 0x62, 0x65, 0xC1, 0x26, 0xA3, 0x78, 0xA2, 0x78, 0xC0, 0x30, 0x61, 0x6F,
+        0x69, 0x26, 0xC1, 0x3C, 0x0D, 0x5A, 0x0D, 0xC0, 0x0A, 0x75, 0x0D, 0x0A, 0x7E, 0xC1, 0x3C, 0xFE,
+        0xB5, 0x5B, 0x98, 0x1C, 0xAA, 0x91, 0x2D, 0x5E, 0x9B, 0x49, 0x45, 0xC1, 0x7A, 0xC0, 0x21, 0xC4,
+        0xA2, 0x88, 0xAA, 0x65, 0xA3, 0x88, 0xA2, 0xC8, 0xA1, 0xC9, 0x9E, 0x27, 0x45, 0x5A, 0xFE, 0x4B,
+        0xBD, 0xFE, 0xAC, 0x9B, 0xFE, 0xF3, 0x97, 0xA3, 0x38, 0xFE, 0xAD, 0x7B, 0x6E, 0x7F, 0xC0, 0x13,
+        0xC0, 0x9B, 0xAA, 0xFE, 0xB9, 0x8F, 0xFE, 0xBB, 0x8D, 0xAE, 0x36, 0xA2, 0x78, 0x9B, 0x8D, 0xA0,
+        0x8A, 0xA6, 0x76, 0x9E, 0x95, 0xA6, 0x83, 0xA5, 0x86, 0x98, 0x9D, 0xA7, 0x86, 0x52, 0x9A, 0x9A,
+        0xA0, 0x5A, 0xB1, 0x79, 0x7F, 0x9D, 0x89, 0xFE, 0x5B, 0x3C, 0x9C, 0x56, 0x59, 0x9D, 0xCE, 0xFE,
+        0xA5, 0x5B, 0xA6, 0x95, 0xA8, 0x86, 0xA2, 0x88, 0x93, 0x8B, 0x92, 0x8C, 0x94, 0x7A, 0xA2, 0x77,
+        0xA2, 0x87, 0x6E, 0xB5, 0xA4, 0xB0, 0x95, 0xFE, 0xAD, 0xDE, 0xFE, 0x1A, 0xDE, 0xA0, 0xB2, 0xA1,
+        0xA4, 0x13, 0xC1, 0x56, 0x9C, 0x88, 0x0E, 0x06, 0x13, 0xCB, 0x17, 0x9F, 0x6F, 0xA0, 0x7C, 0xB1,
+        0xD0, 0x94, 0xA9, 0xAA, 0x85, 0xAE, 0x74, 0xA6, 0x85, 0xA4, 0x86, 0x99, 0x99, 0x91, 0x8C, 0x13,
+        0x9C, 0x8A, 0x99, 0x9D, 0xA8, 0x67, 0x9E, 0xAD, 0xB5, 0xA0, 0x91, 0x7F, 0xA5, 0x63, 0x7B, 0x07,
+        0xFE, 0xF7, 0xDD, 0x5E, 0x16, 0x5B, 0x69, 0xC0, 0xA0, 0xA9, 0x6B, 0x1D, 0x27, 0xC0, 0x1D, 0x1A,
+        0x66, 0xC0, 0x5A, 0x9A, 0xF8, 0xC0, 0x62, 0x6E, 0xC0, 0xA3, 0x78, 0x65, 0xC0, 0x6E, 0x9D, 0xA9,
+        0x2B, 0x26, 0x2B, 0xC0, 0x26, 0x6D, 0x35, 0xA2, 0x79, 0x0A, 0x0D, 0x0A, 0x66, 0x7D, 0x0D, 0x0A,
+        0x7E, 0x06, 0xC0, 0x01, 0x8F, 0xAE, 0xFE, 0x52, 0xDB, 0xFE, 0x6C, 0xFA, 0xA3, 0x96, 0xC0, 0x49,
+        0xC0, 0x7A, 0xA2, 0xA8, 0xA3, 0xC9, 0xC1, 0x41, 0x3E, 0x24, 0x5E, 0x7A, 0xA9, 0x77, 0xA4, 0x77,
+        0xA4, 0xD7, 0x31, 0xC0, 0x02, 0x10, 0x94, 0xAF, 0xFE, 0x73, 0xDD, 0xAD, 0x90, 0xFE, 0xD4, 0x39,
+        0x9C, 0xE8, 0xFE, 0xCD, 0xDC, 0xA8, 0x56, 0xA2, 0x88, 0x98, 0x8A, 0x9B, 0x9A, 0x13, 0x92, 0xEA,
+        0xFE, 0xCC, 0xF0, 0xA5, 0x68, 0xC0, 0x6B, 0x6D, 0xA3, 0x97, 0xA4, 0x77, 0x9A, 0x9B, 0x6D, 0x7B,
+        0x39, 0xA5, 0x86, 0x6F, 0x01, 0xA4, 0x68, 0xA6, 0x6C, 0x31, 0xC0, 0x99, 0x8B, 0xFE, 0x3A, 0x7B,
+        0xA2, 0x53, 0x1C, 0x9D, 0xAE, 0xFE, 0x9D, 0x1C, 0xA8, 0x84, 0xA6, 0x96, 0xA7, 0x86, 0x9C, 0x89,
+        0x98, 0x8A, 0x92, 0x8C, 0x90, 0x6B, 0xA4, 0x86, 0xC0, 0xAD, 0x95, 0xB8, 0x94, 0x9B, 0x8B, 0xFE,
+        0x6C, 0x3E, 0x94, 0x3D, 0xA1, 0xA6, 0xA0, 0xA7, 0x1C, 0x9A, 0xA8, 0x9E, 0x6C, 0xA9, 0x94, 0xA1,
+        0x94, 0x13, 0xCA, 0xA0, 0x7A, 0xFE, 0x1A, 0xBD, 0xB2, 0xC0, 0xFE, 0xE7, 0x5E, 0x9A, 0x88, 0x91,
+        0x9D, 0xA7, 0x87, 0x54, 0x9A, 0x89, 0x94, 0x7B, 0x13, 0x9B, 0x9B, 0x9D, 0x9B, 0x9E, 0x7D, 0xA8,
+        0x64, 0x7E, 0x9E, 0x9B, 0x7B, 0xA8, 0x62, 0x7B, 0xA5, 0xB8, 0xFE, 0xE7, 0x5C, 0xA5, 0x87, 0x16,
+        0xC0, 0x5B, 0xC0, 0x69, 0x7B, 0xC1, 0xA0, 0xA9, 0x5A, 0xC0, 0x5A, 0x1A, 0xC0, 0x45, 0x30, 0x62,
+        0x6E, 0x30, 0xC0, 0xA2, 0x78, 0x6E, 0xC0, 0x9D, 0xA8, 0x6F, 0x6B, 0x35, 0x06, 0x01, 0xC0, 0x30,
+        0x06, 0xC1, 0x5B, 0xC0, 0x67, 0x0A, 0x06, 0xA0, 0x7A, 0x0A, 0x06, 0x3C, 0xC0, 0x91, 0xAE, 0x94,
+        0x5D, 0xFE, 0x53, 0x1C, 0xFE, 0x6D, 0x38, 0x6F, 0x21, 0xC0, 0x6E, 0xA3, 0xF9, 0xA1, 0xB9, 0x5E,
+        0x30, 0x32, 0x2D, 0x9E, 0x58, 0x26, 0xA4, 0x87, 0xA9, 0x76, 0xA2, 0xA8, 0xFE, 0xFF, 0xFF, 0xC1,
+        0x9C, 0x48, 0x9C, 0x39, 0xFE, 0x4A, 0xFD, 0xFE, 0xA5, 0x5C, 0x7D, 0x00, 0xFE, 0xF4, 0x18, 0xA6,
+        0x57, 0xFE, 0xE7, 0x3F, 0x52, 0x96, 0x8A, 0x13, 0x9C, 0x99, 0x9D, 0xC3, 0xA8, 0x73, 0xC1, 0x7A,
+        0x6E, 0xA2, 0x87, 0x04, 0x9C, 0x9B, 0xC0, 0x6E, 0xC0, 0xA2, 0x87, 0xA4, 0x76, 0x7A, 0x6B, 0x9C,
+        0x5E, 0x31, 0xC0, 0x65, 0x94, 0x8D, 0xFE, 0x32, 0x5B, 0xA3, 0x73, 0x5A, 0x9D, 0xAD, 0xAF, 0xC3,
+        0xAE, 0x81, 0xA5, 0x96, 0xA9, 0x86, 0x6B, 0x96, 0x89, 0x98, 0x8B, 0x88, 0x7E, 0xA4, 0x75, 0x5A,
+        0xA5, 0xA7, 0xB6, 0x94, 0x1D, 0x9B, 0x8B, 0x98, 0x7C, 0x94, 0x8D, 0x90, 0x8C, 0xFE, 0xBD, 0xFA,
+        0x04, 0xFE, 0x5B, 0xFE, 0x96, 0x5B, 0xA2, 0xB1, 0x10, 0x13, 0xC6, 0x10, 0x9F, 0x7E, 0xA0, 0x5E,
+        0x04, 0xA7, 0xA3, 0x8A, 0x7C, 0xFE, 0x29, 0xD3, 0xA5, 0x84, 0x10, 0x66, 0x9D, 0x9A, 0x9D, 0x9A,
+        0xAE, 0x94, 0xB1, 0x95, 0xAC, 0x85, 0xFE, 0x9D, 0x1D, 0x8C, 0x5E, 0x29, 0xA4, 0x85, 0xA5, 0x75,
+        0x7B, 0xAE, 0xB5, 0xFE, 0xCE, 0x9A, 0xAA, 0x86, 0x5D, 0xC1, 0x5A, 0xC1, 0x7B, 0x7B, 0xC3, 0x1D,
+        0x5A, 0xC0, 0x55, 0xFE, 0xFE, 0xFA, 0xA2, 0x77, 0xC0, 0x6F, 0xA2, 0x77, 0xC0, 0x01, 0x06, 0x61,
+        0x06, 0x65, 0x01, 0x06, 0x6B, 0x06, 0x35, 0x0D, 0x06, 0x0D, 0xC0, 0x5A, 0x67, 0x0A, 0x7D, 0x0D,
+        0x06, 0x01, 0xC0, 0x3C, 0x94, 0x9C, 0x97, 0x6D, 0x9B, 0x7B, 0xFE, 0x4A, 0xFC, 0xFE, 0x6D, 0x19,
+        0xA2, 0x76, 0xC1, 0xA2, 0xB8, 0x32, 0xC3, 0x42, 0x9D, 0x27, 0xAA, 0x76, 0xA5, 0xB7, 0xA4, 0xD8,
+        0x31, 0xC0, 0x56, 0x9B, 0x18, 0xFE, 0x6D, 0x3D, 0x99, 0xFC, 0xAB, 0x92, 0xA7, 0x87, 0x02, 0xFE,
+        0xED, 0xBB, 0xFE, 0xF3, 0x96, 0xFE, 0xE6, 0xDE, 0x21, 0x97, 0x9B, 0x69, 0x94, 0xCA, 0xFE, 0xD5,
+        0x92, 0x6E, 0xC0, 0x28, 0x2D, 0xC0, 0x7E, 0x6B, 0x5A, 0xC2, 0x7E, 0xA4, 0x75, 0x63, 0x01, 0x5B,
+        0x20, 0xAB, 0x88, 0xA3, 0x99, 0x31, 0x95, 0x9D, 0xFE, 0x3A, 0x7B, 0x1C, 0xC0, 0x57, 0xA2, 0xCB,
+        0xFE, 0xA5, 0x3C, 0xA8, 0x84, 0xA8, 0x85, 0x99, 0x9A, 0x6F, 0x9C, 0x88, 0x92, 0x8C, 0x91, 0x7C,
+        0xA3, 0x87, 0xA2, 0x87, 0xA4, 0x87, 0xAA, 0x95, 0xA4, 0x98, 0x93, 0x8D, 0x59, 0xAA, 0x84, 0xA7,
+        0xA8, 0xAB, 0x87, 0x99, 0x7D, 0xFE, 0x33, 0x1E, 0x9E, 0x85, 0xA1, 0xB3, 0x13, 0xC0, 0x5E, 0x66,
+        0x13, 0x5B, 0x9F, 0x7E, 0x9F, 0x6D, 0xAC, 0xB3, 0xFE, 0xD6, 0xFE, 0x99, 0x98, 0x88, 0x6D, 0x9A,
+        0x9B, 0x9C, 0x89, 0xA2, 0x87, 0xAB, 0xA7, 0xA8, 0x86, 0xA9, 0x96, 0xA6, 0x87, 0xA2, 0x86, 0xAA,
+        0x76, 0x9D, 0x99, 0x94, 0x8E, 0xFE, 0x31, 0xFD, 0xA8, 0x60, 0xA4, 0x75, 0x9E, 0xAC, 0xB5, 0xA1,
+        0xA9, 0x91, 0xA3, 0x87, 0x16, 0xC2, 0x5A, 0xC1, 0x7B, 0x7B, 0xC0, 0x7B, 0xC0, 0x2A, 0x27, 0xC1,
+        0x1D, 0x98, 0xE9, 0x30, 0x6F, 0xA2, 0x78, 0x5A, 0xC0, 0x79, 0x3C, 0x69, 0x06, 0x66, 0xC0, 0x35,
+        0x01, 0x06, 0x35, 0xC0, 0x06, 0x0D, 0xC0, 0x56, 0x0C, 0x05, 0xA2, 0x87, 0x69, 0x0D, 0x0B, 0xC0,
+        0x01, 0x96, 0x9C, 0x96, 0x6D, 0x5E, 0x99, 0x9B, 0xFE, 0x4A, 0xFC, 0xFE, 0x6C, 0xF9, 0xA3, 0x77,
+        0x69, 0x7A, 0xA3, 0xB9, 0xA2, 0xB8, 0x32, 0xC1, 0x9C, 0x58, 0xA2, 0x47, 0xAB, 0x76, 0xFE, 0xF7,
+        0xFF, 0x31, 0xC0, 0x2E, 0x9B, 0x38, 0x99, 0x7C, 0xFE, 0x5A, 0xFE, 0xFE, 0xBD, 0xFC, 0xA8, 0x76,
+        0xA2, 0x88, 0x7A, 0x56, 0xFE, 0xF3, 0xD7, 0xAC, 0x16, 0x34, 0x9C, 0x8A, 0x35, 0x9C, 0xC4, 0xA9,
+        0x82, 0x2D, 0xC3, 0x6E, 0x39, 0xC1, 0x7A, 0xC1, 0x6E, 0xC0, 0x6B, 0x6D, 0xA3, 0x87, 0x9A, 0x7D,
+        0x57, 0xA5, 0x78, 0xA7, 0x99, 0x9F, 0x8B, 0xFE, 0x53, 0x1B, 0x9C, 0x57, 0x7E, 0x59, 0x9C, 0x9D,
+        0xA9, 0xD7, 0xFE, 0xAD, 0x9C, 0xA2, 0x94, 0xA3, 0x88, 0x2C, 0x22, 0x9A, 0x8A, 0x93, 0x9C, 0x99,
+        0x89, 0x9B, 0x9B, 0x9B, 0x89, 0x94, 0x7B, 0xA8, 0x75, 0x7E, 0xC1, 0x6E, 0xB2, 0xA4, 0xAF, 0x86,
+        0xFE, 0x95, 0x5E, 0xFE, 0x22, 0xDE, 0x58, 0xA0, 0xA7, 0x79, 0x57, 0x3B, 0xA0, 0x8A, 0xB0, 0xD0,
+        0xAF, 0xA1, 0xA5, 0x95, 0x8D, 0x8C, 0x13, 0x9B, 0x8B, 0x9B, 0xBB, 0xB7, 0x82, 0xAC, 0x86, 0xA5,
+        0x96, 0xA5, 0x98, 0xA4, 0x77, 0x79, 0x96, 0x8A, 0x9B, 0x8B, 0xFE, 0x7C, 0x3D, 0x92, 0x6D, 0xA5,
+        0x83, 0xA2, 0x88, 0xA0, 0xAB, 0xFE, 0xD6, 0x9E, 0xA2, 0x84, 0xA4, 0x65, 0x16, 0xC1, 0x5A, 0xC0,
+        0x16, 0xC0, 0x13, 0x7B, 0x7B, 0x7B, 0xC2, 0x27, 0x5A, 0xC0, 0x31, 0x98, 0xC7, 0xA3, 0x77, 0xA2,
+        0x78, 0xC0, 0x5B, 0x7A, 0x06, 0x35, 0x66, 0xA2, 0x78, 0x06, 0xC0, 0x01, 0x35, 0x30, 0xC1, 0x06,
+        0xC0, 0x0D, 0x0A, 0x67, 0x0A, 0xC0, 0x05, 0xC0, 0x0A, 0x7D, 0x06, 0x99, 0x9B, 0xFE, 0xA4, 0xBA,
+        0xA6, 0x66, 0x56, 0x99, 0x9A, 0xFE, 0x5B, 0x1B, 0xA6, 0x45, 0xAA, 0x61, 0xA2, 0x77, 0x21, 0x7A,
+        0xA2, 0x98, 0xC0, 0x55, 0x4A, 0xA9, 0x77, 0xA4, 0x87, 0xA5, 0xF8, 0xA2, 0xB8, 0x9E, 0x68, 0x9D,
+        0x38, 0x9B, 0x8B, 0xFE, 0x4B, 0x5D, 0xFE, 0xBE, 0x1E, 0x02, 0x6E, 0x7A, 0x07, 0xC0, 0xFE, 0xED,
+        0x3A, 0x95, 0xFC, 0x1F, 0x13, 0x92, 0xEC, 0xFE, 0xD5, 0x93, 0x6D, 0xC0, 0x32, 0xC0, 0x6B, 0xC0,
+        0x7A, 0xC0, 0x6E, 0xC4, 0x6B, 0x01, 0xA2, 0x77, 0x67, 0x01, 0xC0, 0x08, 0x9E, 0x69, 0xA6, 0x6B,
+        0xA8, 0x88, 0xFE, 0x84, 0x3D, 0x91, 0x5C, 0x19, 0x7A, 0x57, 0x9B, 0xAE, 0xAE, 0xB2, 0xB1, 0x90,
+        0xA9, 0x85, 0xA6, 0x86, 0x31, 0x66, 0x41, 0x34, 0x9C, 0x8A, 0x8C, 0x8C, 0x8F, 0x8D, 0x57, 0xA2,
+        0x86, 0xA3, 0x87, 0xA3, 0x87, 0x7E, 0xA5, 0x97, 0xB6, 0x93, 0xA9, 0x88, 0x9A, 0x8B, 0x9B, 0x8B,
+        0x66, 0x04, 0x26, 0x15, 0x9B, 0x99, 0x92, 0x7B, 0x8F, 0x7C, 0x0B, 0x22, 0xB0, 0x94, 0xB1, 0x84,
+        0x2F, 0x1D, 0x31, 0xC0, 0x9D, 0x99, 0x1A, 0xFE, 0x84, 0x7D, 0x8F, 0x7F, 0xA4, 0x73, 0xA2, 0x77,
+        0x9F, 0xAB, 0xAD, 0xC5, 0xFE, 0xE7, 0x5E, 0x9B, 0x97, 0xA6, 0x76, 0xA4, 0x87, 0xC0, 0x5A, 0x5A,
+        0xC1, 0x16, 0x6B, 0xC0, 0x16, 0xA0, 0xAA, 0x31, 0xC2, 0x59, 0x1D, 0x27, 0x31, 0x99, 0xC6, 0xA2,
+        0x78, 0xC0, 0x06, 0x6F, 0x06, 0x62, 0x30, 0x24, 0x30, 0x35, 0x6F, 0x35, 0xC0, 0x62, 0x24, 0x5B,
+        0x35, 0x06, 0x5B, 0xC0, 0x6B, 0x0C, 0xC1, 0x59, 0x0A, 0x7A, 0x12, 0x9B, 0x9A, 0xFE, 0x9C, 0x59,
+        0xA9, 0x66, 0xC0, 0x56, 0x9C, 0x89, 0x9A, 0x8A, 0x99, 0x8E, 0xA2, 0x67, 0xA7, 0x65, 0x1E, 0xA2,
+        0x86, 0x5A, 0xC0, 0xA5, 0x88, 0xA8, 0x76, 0x6E, 0xC0, 0x7A, 0x12, 0x9A, 0x9C, 0xFE, 0x53, 0x5D,
+        0xFE, 0xBE, 0x3E, 0x07, 0xC3, 0x7A, 0x9B, 0xB9, 0xFE, 0xF3, 0x56, 0xFE, 0xB5, 0x1A, 0x47, 0x9E,
+        0xC2, 0xA8, 0x73, 0x7D, 0x5A, 0x7B, 0x6E, 0xC2, 0x6E, 0xC1, 0x6B, 0xC7, 0x66, 0x06, 0xC0, 0x5B,
+        0xA5, 0x6C, 0xA9, 0x88, 0x93, 0x9F, 0xFE, 0x4A, 0xBB, 0x9F, 0x56, 0x1C, 0xC0, 0x1B, 0x9B, 0xBE,
+        0xAE, 0xA3, 0x1F, 0x2F, 0xA6, 0x86, 0x31, 0xC0, 0x65, 0x95, 0x9B, 0x9B, 0x7B, 0xFE, 0x2A, 0x1B,
+        0xA4, 0x72, 0x51, 0x9B, 0xAB, 0xA3, 0x95, 0xA5, 0x85, 0xA2, 0x77, 0xA4, 0x97, 0xAC, 0x95, 0xA6,
+        0x87, 0xA2, 0x87, 0x66, 0x9B, 0x89, 0x94, 0x7B, 0x9A, 0x8A, 0x56, 0x9B, 0x9B, 0xAD, 0xB6, 0x25,
+        0x2F, 0xA6, 0x87, 0x31, 0x69, 0x1D, 0x95, 0x9D, 0xFE, 0x7C, 0x1D, 0x91, 0x7E, 0xA4, 0x63, 0x6E,
+        0x7B, 0xA4, 0xA9, 0xFE, 0xCE, 0x5E, 0x1D, 0x97, 0x89, 0xA9, 0x85, 0x19, 0x59, 0xC0, 0x16, 0xC0,
+        0x5A, 0xC0, 0x16, 0xA0, 0x9A, 0x2A, 0x59, 0x27, 0x31, 0x27, 0xC2, 0x45, 0x7F, 0x31, 0x30, 0x69,
+        0x6F, 0x6E, 0x35, 0xC0, 0x30, 0x65, 0x67, 0x6E, 0x30, 0x35, 0xC0, 0x30, 0xC0, 0x24, 0x30, 0xC0,
+        0xA3, 0x78, 0x6F, 0x56, 0xC0, 0x66, 0x6B, 0xC0, 0x02, 0x05, 0x0A, 0x7D, 0x0A, 0xFE, 0x9C, 0x18,
+        0xAB, 0x56, 0xC2, 0x52, 0x9B, 0x99, 0x9D, 0x89, 0x9C, 0x8B, 0x9A, 0x8D, 0x4B, 0xA6, 0x55, 0xA9,
+        0x73, 0xAD, 0x73, 0xA4, 0x76, 0xC0, 0x66, 0x9A, 0x9B, 0xFE, 0x5C, 0x7D, 0x9C, 0xEB, 0xFE, 0xD6,
+        0xBE, 0xA4, 0x87, 0x07, 0xC4, 0x76, 0xFE, 0xEB, 0x76, 0xA6, 0x18, 0x9E, 0x37, 0xFE, 0xD5, 0xB3,
+        0x6D, 0x3C, 0x6E, 0xC1, 0x6E, 0xC0, 0x6B, 0x7E, 0xC9, 0x0D, 0xC1, 0x06, 0xA2, 0x87, 0x9C, 0x7C,
+        0xAA, 0x59, 0x31, 0x9D, 0x89, 0xFE, 0xAD, 0x7D, 0xFE, 0x3A, 0x7B, 0xA1, 0x75, 0x5D, 0x23, 0x5A,
+        0x9C, 0x9C, 0xA2, 0xB9, 0xB1, 0x91, 0xAC, 0x82, 0xA9, 0x95, 0x69, 0x9A, 0x78, 0xFE, 0x7B, 0xFD,
+        0x19, 0x7A, 0x19, 0x9D, 0xCF, 0xFE, 0xB5, 0xDC, 0x99, 0x99, 0x90, 0x7B, 0x39, 0xA3, 0x87, 0x7E,
+        0xC1, 0x5A, 0x9D, 0xAA, 0x66, 0xAF, 0x95, 0xA9, 0x96, 0xAD, 0x86, 0xA5, 0x97, 0xA2, 0x88, 0x69,
+        0x98, 0x8C, 0x93, 0x8E, 0xFE, 0x52, 0xFC, 0x9A, 0x69, 0x1C, 0xC0, 0x9F, 0x9B, 0xA3, 0xB9, 0xFE,
+        0xBD, 0xFE, 0x1D, 0x22, 0x96, 0x89, 0xA9, 0x86, 0x16, 0xC2, 0x5A, 0xC1, 0x16, 0xC0, 0x6B, 0x27,
+        0xC0, 0x69, 0x27, 0x1D, 0x5A, 0x13, 0x1A, 0xC0, 0x66, 0x1D, 0x99, 0xE9, 0x69, 0x6F, 0xA3, 0x78,
+        0xC0, 0x9D, 0xA8, 0x24, 0x2B, 0x66, 0x5E, 0x6E, 0x30, 0xC1, 0x29, 0x30, 0x6E, 0xC1, 0x06, 0x5B,
+        0x57, 0x7A, 0xC2, 0x69, 0xA2, 0x87, 0x69, 0x9F, 0x8B, 0xFE, 0xA4, 0x38, 0xAA, 0x46, 0xC4, 0x52,
+        0x51, 0x9B, 0x99, 0x56, 0x9C, 0x8C, 0x9A, 0xCC, 0xA8, 0x45, 0x96, 0x8E, 0xA3, 0x87, 0xA3, 0x97,
+        0xAB, 0x84, 0xAC, 0x82, 0xA7, 0x85, 0x07, 0xC5, 0x7A, 0x9D, 0x89, 0xFE, 0xE3, 0xD7, 0x98, 0xAB,
+        0xFE, 0xBC, 0xB4, 0xA9, 0x73, 0xC0, 0x79, 0x6F, 0xC0, 0x6E, 0xC0, 0x0D, 0x7E, 0xC2, 0x6E, 0xC4,
+        0x15, 0xC1, 0x0D, 0xC2, 0x6E, 0x9C, 0x7B, 0xA8, 0x69, 0xA8, 0x88, 0x6F, 0x9C, 0x99, 0x21, 0xFE,
+        0x42, 0x9B, 0x9F, 0x67, 0xA2, 0x75, 0x1C, 0xC0, 0x57, 0x9C, 0x9C, 0xA1, 0xBA, 0xAA, 0x93, 0xA8,
+        0x85, 0x12, 0xA5, 0x74, 0x1C, 0x1D, 0xB1, 0xC3, 0xB2, 0x90, 0xA7, 0x86, 0x9B, 0x9A, 0x94, 0x7B,
+        0x7A, 0x99, 0x8A, 0x9C, 0x88, 0xA3, 0x98, 0xA7, 0x87, 0xA8, 0x86, 0xA8, 0x87, 0x7E, 0x92, 0x8B,
+        0x03, 0x9A, 0x8B, 0x96, 0x8C, 0x90, 0x7F, 0x98, 0x5A, 0xA3, 0x84, 0x20, 0x23, 0x9D, 0x9C, 0xA8,
+        0xB6, 0xB3, 0x90, 0xAC, 0x82, 0x69, 0x9D, 0x99, 0x41, 0xA9, 0x85, 0xA2, 0x88, 0x5A, 0x6B, 0xC0,
+        0x16, 0x5B, 0xC0, 0x69, 0xC0, 0x16, 0x7B, 0xC0, 0x27, 0xC1, 0x1D, 0x49, 0xC0, 0x66, 0x10, 0x5A,
+        0x7B, 0xFE, 0xFF, 0x1A, 0x69, 0x6E, 0x3A, 0x66, 0x29, 0xC1, 0x24, 0xC0, 0x35, 0x3A, 0x35, 0xC1,
+        0x30, 0xC0, 0x3A, 0x6F, 0xC1, 0x5B, 0x67, 0xC2, 0x0A, 0x7D, 0x0A, 0x66, 0xFE, 0xAC, 0x79, 0xA8,
+        0x46, 0xC6, 0x99, 0x9A, 0x3D, 0x62, 0xAD, 0xA3, 0x9D, 0x9A, 0xAD, 0x67, 0xA2, 0x77, 0x00, 0x7B,
+        0x03, 0x5B, 0xC7, 0x98, 0x9A, 0xFE, 0xD4, 0x18, 0x99, 0xE9, 0xFE, 0xCD, 0xB3, 0x7E, 0xC0, 0x79,
+        0x6B, 0x6E, 0x6E, 0xC0, 0x6B, 0xC0, 0x15, 0xC1, 0x6E, 0xC0, 0x15, 0xC5, 0x0D, 0x06, 0xC0, 0x0D,
+        0x7A, 0x15, 0x0D, 0x04, 0x57, 0x6E, 0xA3, 0x78, 0xA3, 0x8B, 0x02, 0xFE, 0x63, 0x7C, 0x96, 0x5B,
+        0x1B, 0x6D, 0x7A, 0xC0, 0x19, 0x9E, 0x9B, 0x63, 0x53, 0x66, 0x53, 0xB2, 0xA0, 0xAC, 0x93, 0x02,
+        0x9D, 0x99, 0x66, 0xA8, 0x75, 0x7E, 0x5A, 0x1C, 0x9D, 0x9A, 0x9D, 0x8A, 0x9D, 0x89, 0x98, 0x8C,
+        0x91, 0x7E, 0x42, 0x1D, 0xA2, 0x85, 0xC0, 0x5A, 0x1D, 0x9F, 0xBB, 0xAF, 0xA2, 0xA6, 0x83, 0xAB,
+        0x82, 0xA4, 0x86, 0xA2, 0x88, 0xA3, 0x97, 0xA2, 0x89, 0xA2, 0x77, 0xC1, 0x5A, 0xC1, 0x5A, 0x6B,
+        0xC0, 0x13, 0xC0, 0x7B, 0xC0, 0x20, 0xC2, 0x1D, 0x49, 0x5A, 0x6B, 0x0D, 0xC1, 0x28, 0x69, 0x7E,
+        0x6E, 0x56, 0xA2, 0x89, 0x65, 0x30, 0x35, 0x29, 0x35, 0xA2, 0x78, 0x35, 0xC1, 0x29, 0xC0, 0x3A,
+        0xA2, 0x78, 0x6B, 0xC0, 0x56, 0x05, 0x6B, 0x05, 0x6F, 0x0A, 0x05, 0x5A, 0x6B, 0xFE, 0xAC, 0x79,
+        0xA8, 0x46, 0xC5, 0x56, 0x98, 0x8A, 0x3D, 0x9A, 0xCA, 0xFE, 0xEE, 0xFA, 0x91, 0x9F, 0x07, 0xCB,
+        0x36, 0x95, 0x8C, 0xFE, 0xC3, 0xF8, 0xFE, 0xF3, 0x55, 0xFE, 0xCD, 0xB2, 0x7F, 0x69, 0xC0, 0x7E,
+        0x6B, 0x6E, 0xC2, 0x6B, 0x15, 0xC8, 0x66, 0xC0, 0x06, 0xC1, 0x10, 0xC0, 0x15, 0xC0, 0x6B, 0x6E,
+        0xA6, 0x75, 0x9B, 0x8B, 0x9C, 0x6D, 0xAB, 0x88, 0x9C, 0x8A, 0x94, 0x8F, 0x22, 0x17, 0xA3, 0x85,
+        0x7D, 0x5A, 0x1C, 0xC4, 0x1B, 0xC0, 0x66, 0x6B, 0xC1, 0x16, 0x1B, 0x7A, 0x19, 0xC1, 0x1C, 0x1B,
+        0x9E, 0x9B, 0xA1, 0xA9, 0xB1, 0xA2, 0xAE, 0x82, 0xA5, 0x94, 0x9B, 0x88, 0xAB, 0x95, 0xA2, 0x88,
+        0xC1, 0x5A, 0xC2, 0x5A, 0x6B, 0x16, 0xC1, 0x5A, 0xC1, 0x16, 0x1D, 0x7B, 0x7B, 0xC0, 0x27, 0x16,
+        0x13, 0x4A, 0x6B, 0xC0, 0x0D, 0xC1, 0x2B, 0xC1, 0x29, 0x35, 0xA2, 0x78, 0x65, 0x29, 0x35, 0xC0,
+        0x29, 0xC0, 0x30, 0x29, 0xC0, 0x56, 0x7A, 0x35, 0x06, 0x6B, 0x06, 0x0D, 0x0A, 0x0C, 0x0A, 0xC1,
+        0x66, 0x02, 0x9D, 0xAA, 0xFE, 0x9C, 0x38, 0xAA, 0x56, 0xC5, 0x9B, 0x8A, 0x3D, 0xC0, 0xA5, 0xC6,
+        0xA9, 0x84, 0xA5, 0x6B, 0x07, 0xCB, 0x99, 0x9A, 0x97, 0xAB, 0xFE, 0xBA, 0xF5, 0xFE, 0xF2, 0xB5,
+        0xFE, 0xD5, 0xB2, 0xC0, 0x6E, 0xC0, 0x7A, 0x6F, 0xC0, 0x6E, 0xC1, 0x6B, 0xC0, 0x15, 0xC7, 0x10,
+        0xC0, 0x06, 0x01, 0xC0, 0x0D, 0x10, 0xC0, 0x0D, 0x15, 0x6B, 0xA3, 0x86, 0xA2, 0x77, 0x82, 0x6F,
+        0xA5, 0x8A, 0xA7, 0x98, 0xAD, 0x87, 0xAA, 0x88, 0x53, 0x97, 0x8E, 0x96, 0x8B, 0x94, 0x8D, 0x96,
+        0x6C, 0x6D, 0x6D, 0x6D, 0x1B, 0x6E, 0x79, 0x6B, 0x1C, 0xC1, 0x23, 0xC0, 0x1B, 0x16, 0x18, 0x63,
+        0xA3, 0xA8, 0xAF, 0x93, 0xAA, 0x94, 0xA6, 0x84, 0xA7, 0x85, 0x09, 0x9A, 0x89, 0x68, 0xAA, 0x86,
+        0xC3, 0x19, 0xC1, 0x5B, 0xC1, 0x69, 0xC0, 0x69, 0x5B, 0x16, 0x1D, 0x7A, 0x6B, 0xC1, 0x7A, 0xC0,
+        0x1D, 0x49, 0x5A, 0x6B, 0xC1, 0x59, 0x10, 0x9A, 0xE9, 0x7A, 0xC1, 0x29, 0x2E, 0x6B, 0x29, 0xC3,
+        0x2D, 0x35, 0x29, 0x67, 0xC0, 0x30, 0x35, 0xA2, 0x78, 0x6D, 0x9F, 0x8B, 0xC2, 0x6E, 0x79, 0x0C,
+        0xC0, 0x93, 0xAC, 0x9A, 0x7C, 0xA3, 0x77, 0xC4, 0x9D, 0x89, 0x3D, 0xC0, 0x62, 0xAE, 0xA1, 0x99,
+        0xAD, 0x07, 0xCB, 0x62, 0x95, 0x9B, 0x92, 0xCA, 0xA8, 0xB1, 0xFE, 0xF2, 0xB5, 0xFE, 0xCD, 0xB3,
+        0x7A, 0x39, 0x79, 0x6E, 0x01, 0x6E, 0xC2, 0x6B, 0x7E, 0xC8, 0x66, 0xC0, 0x0D, 0xC0, 0x66, 0xC0,
+        0x0D, 0xC2, 0x15, 0x6E, 0x6F, 0x81, 0x6D, 0xA2, 0x88, 0x9D, 0x89, 0x7B, 0xB3, 0x78, 0xB4, 0x86,
+        0xA5, 0x99, 0xC1, 0x9D, 0x8A, 0x9A, 0x9A, 0x9A, 0x7B, 0x9A, 0x8A, 0x3F, 0x9D, 0x9A, 0x52, 0x51,
+        0xC0, 0x6E, 0xC0, 0xA2, 0x87, 0x2D, 0xA4, 0x76, 0xA4, 0x96, 0xA7, 0x86, 0xA6, 0x95, 0xA5, 0x87,
+        0x9C, 0x87, 0x99, 0x9A, 0xA3, 0x87, 0xA3, 0x88, 0x66, 0xA5, 0x88, 0xA3, 0x96, 0xC0, 0x6B, 0x5A,
+        0x69, 0x1C, 0x19, 0xC1, 0x5A, 0x1D, 0x16, 0xC0, 0x19, 0xC0, 0x16, 0xA0, 0x9A, 0xC1, 0x7B, 0xC2,
+        0x27, 0x1D, 0x49, 0x5A, 0x6B, 0xC1, 0x59, 0x10, 0x9A, 0xF9, 0xC2, 0x59, 0x2E, 0x6B, 0x29, 0x30,
+        0x29, 0xC2, 0x26, 0x29, 0x2B, 0x30, 0x35, 0x6E, 0x6F, 0x69, 0x12, 0x0B, 0x12, 0x05, 0x7E, 0x0B,
+        0x57, 0x67, 0xFE, 0xAC, 0x58, 0x13, 0xC4, 0x37, 0x9A, 0x89, 0x66, 0xC0, 0x9A, 0xCA, 0xAE, 0x82,
+        0xA9, 0x69, 0xA7, 0x67, 0xCB, 0x98, 0x9A, 0x93, 0xBC, 0xA2, 0xA2, 0xA2, 0xB5, 0xFE, 0xF2, 0xD5,
+        0xFE, 0xD5, 0xD2, 0x39, 0x7A, 0x6D, 0x01, 0xC0, 0x6E, 0xC2, 0x15, 0xC1, 0x1A, 0xC4, 0x15, 0xC1,
+        0x66, 0xC0, 0x5A, 0xC1, 0x10, 0x0D, 0xC0, 0x10, 0x15, 0x6F, 0x55, 0x83, 0x6D, 0xA2, 0x88, 0xC0,
+        0x56, 0x51, 0xAC, 0x89, 0xB1, 0x87, 0xAA, 0x88, 0xA4, 0x98, 0xC0, 0x09, 0x9C, 0x88, 0x9D, 0x9A,
+        0xA2, 0x87, 0xA5, 0x89, 0xC0, 0x66, 0xC0, 0x10, 0xC0, 0x7E, 0x6E, 0xC1, 0x01, 0x99, 0x99, 0x9C,
+        0x88, 0xA9, 0x88, 0xA6, 0x97, 0x2A, 0x23, 0x69, 0xC2, 0x27, 0xC0, 0x19, 0xC0, 0x69, 0xC0, 0x19,
+        0x5A, 0xC2, 0x19, 0x20, 0x16, 0x2A, 0x31, 0x2A, 0xC0, 0x31, 0xC1, 0x48, 0x49, 0x5A, 0xC0, 0x6B,
+        0xC2, 0x0D, 0x30, 0xC3, 0x29, 0x2E, 0xC0, 0x29, 0x35, 0x6E, 0xC0, 0x35, 0xC0, 0x29, 0xC0, 0x5A,
+        0x3A, 0xC2, 0x6F, 0x6E, 0xC0, 0x0A, 0xC0, 0x06, 0x6B, 0x99, 0x9B, 0x90, 0x8E, 0xA6, 0x67, 0xC3,
+        0x9D, 0x8A, 0x02, 0x66, 0x5A, 0x33, 0xA8, 0xB3, 0x9F, 0x8B, 0xB3, 0x55, 0xC0, 0x07, 0xC9, 0x9D,
+        0x99, 0x94, 0x9B, 0x97, 0xD8, 0xFE, 0xDE, 0x13, 0x1E, 0xFE, 0xF3, 0x55, 0xFE, 0xDE, 0x32, 0x39,
+        0x7E, 0xC2, 0x06, 0xC2, 0x15, 0xC1, 0x6E, 0xC3, 0x6B, 0x1A, 0xC0, 0x15, 0xC0, 0x56, 0xC4, 0x7A,
+        0x15, 0xC0, 0x21, 0x0D, 0x08, 0xA2, 0x88, 0xC2, 0x08, 0x6B, 0xA9, 0x89, 0xA6, 0x87, 0xC0, 0x9B,
+        0x89, 0x9A, 0x88, 0x0F, 0xA5, 0x89, 0xAA, 0x88, 0xAF, 0x97, 0x09, 0x31, 0xC0, 0x9D, 0x89, 0x34,
+        0x96, 0x78, 0x9C, 0x89, 0x51, 0x9B, 0x98, 0xAA, 0x87, 0xB7, 0x86, 0x23, 0xC2, 0x69, 0xC1, 0x19,
+        0xA0, 0x8A, 0x69, 0x19, 0xC3, 0x16, 0x69, 0x16, 0xC2, 0x20, 0x31, 0xC1, 0x27, 0x1D, 0xC1, 0x48,
+        0x6B, 0x5A, 0xC1, 0x6B, 0xC1, 0x0D, 0xFE, 0xFF, 0x3A, 0xC0, 0x35, 0x56, 0x6D, 0x7A, 0x6F, 0x2B,
+        0x3A, 0xC3, 0x35, 0x2E, 0x66, 0x26, 0x2E, 0x35, 0xC1, 0xA2, 0x78, 0x0B, 0xC2, 0x62, 0x0B, 0xFE,
+        0xBD, 0x18, 0x0E, 0x13, 0xC2, 0x56, 0x98, 0x99, 0x3D, 0xC0, 0x66, 0xA0, 0xC7, 0xAF, 0x72, 0xA2,
+        0x7C, 0x07, 0xCA, 0x66, 0x97, 0x9A, 0x91, 0xCC, 0xFE, 0xDD, 0xF3, 0xC0, 0x94, 0xFF, 0x7A, 0xAD,
+        0x01, 0x39, 0xC0, 0x01, 0xC4, 0x06, 0x6B, 0x7E, 0xC1, 0x1A, 0xC4, 0x15, 0xC0, 0x0D, 0x06, 0xC2,
+        0x0D, 0xC1, 0x7A, 0xC0, 0x15, 0x39, 0x08, 0xA2, 0x88, 0xC5, 0x56, 0x69, 0xC0, 0x14, 0xC0, 0x08,
+        0x9D, 0x89, 0xA7, 0x98, 0xA8, 0x89, 0xA8, 0x78, 0xA2, 0x88, 0x97, 0x98, 0x97, 0x99, 0x1C, 0xC0,
+        0x9D, 0x89, 0xB2, 0x87, 0xB9, 0x88, 0x7C, 0x69, 0x1C, 0xC2, 0x2A, 0xC0, 0x1C, 0xC0, 0x19, 0xC3,
+        0x16, 0xC3, 0x5A, 0x16, 0x20, 0x27, 0xC3, 0x13, 0x5A, 0xC1, 0x5A, 0xC2, 0x6B, 0xC0, 0x0D, 0x2E,
+        0xC1, 0x6B, 0xC0, 0x2E, 0xC0, 0x3A, 0xA2, 0x78, 0x65, 0x3A, 0xC0, 0x2E, 0x2B, 0x2E, 0x29, 0x26,
+        0xC0, 0x2E, 0x5B, 0x35, 0x3A, 0xC0, 0x3F, 0x6B, 0x3A, 0x35, 0x52, 0xFE, 0x9C, 0x39, 0xAA, 0x55,
+        0xC3, 0x9C, 0x89, 0x9A, 0x89, 0xC1, 0x9B, 0xBA, 0xFE, 0xE6, 0xDA, 0x90, 0xAF, 0xB3, 0x44, 0x6B,
+        0xCA, 0x9A, 0x9A, 0x95, 0xAB, 0x9C, 0xC3, 0xAF, 0x60, 0x9B, 0x9A, 0xFE, 0xEC, 0x14, 0xA7, 0x45,
+        0xA6, 0x34, 0x69, 0x39, 0x79, 0x01, 0xC5, 0x6E, 0x6B, 0x7E, 0xC7, 0x06, 0x01, 0xC1, 0x06, 0xC0,
+        0x0D, 0xC3, 0x9D, 0x89, 0x88, 0x5B, 0x7F, 0xCA, 0x9D, 0x89, 0x66, 0x1C, 0xC5, 0x00, 0xAB, 0x97,
+        0xBF, 0x87, 0x2A, 0x69, 0x69, 0xC3, 0x2A, 0xC0, 0x19, 0xC2, 0x20, 0x16, 0xC4, 0x5A, 0xC0, 0x16,
+        0x6B, 0xC0, 0x27, 0x20, 0xC0, 0x27, 0x1D, 0x13, 0x4A, 0x14, 0xC0, 0x0D, 0xC0, 0x10, 0xC0, 0x0D,
+        0xC0, 0xFE, 0xFF, 0x5A, 0x5A, 0x35, 0xC2, 0x6D, 0x3A, 0x6F, 0xC0, 0x3F, 0x0B, 0x3A, 0x2E, 0x2B,
+        0x26, 0x6B, 0x2E, 0x35, 0x2B, 0x2D, 0x35, 0xC0, 0x3A, 0x6B, 0x3A, 0x35, 0x21, 0x99, 0x6E, 0xA3,
+        0x88, 0xC3, 0x9C, 0x89, 0x3D, 0xC1, 0xA0, 0xD8, 0xB4, 0x50, 0x99, 0x9E, 0x07, 0xCA, 0x51, 0x96,
+        0x8B, 0x93, 0xEA, 0xFE, 0xE6, 0x53, 0xA3, 0x87, 0x51, 0xFE, 0xF2, 0xB5, 0xFE, 0xDD, 0x72, 0xA2,
+        0x57, 0xC0, 0x7A, 0x6E, 0xC3, 0x3C, 0x6E, 0xC1, 0x6E, 0xC0, 0x6B, 0xC0, 0x15, 0xC2, 0x0D, 0x06,
+        0x01, 0xC4, 0x06, 0xC0, 0x01, 0xC0, 0x0D, 0x9B, 0x89, 0x8A, 0x5B, 0x7F, 0xCA, 0x3B, 0x7E, 0x1C,
+        0xC4, 0x00, 0xA2, 0x88, 0x84, 0x86, 0xA6, 0x86, 0xC4, 0x69, 0xC0, 0x23, 0x1C, 0x59, 0xC1, 0x19,
+        0xA0, 0x7A, 0x69, 0x69, 0xC0, 0x19, 0x16, 0xC0, 0x5A, 0xC0, 0x16, 0x27, 0x7B, 0xC1, 0x27, 0x1D,
+        0x10, 0xC0, 0x5A, 0x6B, 0xC0, 0x0D, 0x10, 0xC0, 0x0D, 0xC0, 0x10, 0x9B, 0xF9, 0xC5, 0x6D, 0x3F,
+        0xA1, 0x8A, 0x0B, 0xC0, 0x3F, 0x35, 0xC1, 0x56, 0x7D, 0x35, 0x66, 0xC1, 0x35, 0x3F, 0x0B, 0x3F,
+        0x66, 0xFE, 0xB4, 0xD8, 0xA5, 0x59, 0xC4, 0x56, 0x99, 0x9A, 0x51, 0x62, 0xB1, 0xA1, 0x99, 0xAB,
+        0xAF, 0x47, 0x0A, 0x07, 0xC8, 0x02, 0x97, 0x9A, 0x97, 0xAB, 0xFE, 0xCD, 0x94, 0xAD, 0x72, 0x6B,
+        0x9B, 0xBB, 0xFE, 0xEB, 0x34, 0xFE, 0xDE, 0x12, 0x66, 0x32, 0x66, 0xC0, 0x32, 0xC0, 0x3A, 0x32,
+        0x3C, 0x01, 0xC1, 0x06, 0xC0, 0x6B, 0x7E, 0xC3, 0x0D, 0x06, 0x01, 0xC8, 0x6B, 0x9C, 0x78, 0x8A,
+        0x5B, 0x7F, 0xC9, 0x56, 0x2C, 0x14, 0x1C, 0xC2, 0x14, 0x9D, 0x99, 0xA2, 0x87, 0x80, 0x84, 0xAB,
+        0x88, 0x6B, 0xC5, 0x15, 0x1C, 0xC1, 0x59, 0xC0, 0x19, 0x24, 0x69, 0x16, 0xC0, 0x19, 0x16, 0xC1,
+        0x5A, 0xA0, 0xA9, 0xC0, 0x27, 0x7A, 0x6B, 0x27, 0x1D, 0x13, 0x10, 0x5A, 0xC3, 0x6B, 0x0D, 0x10,
+        0xC0, 0x9C, 0xE7, 0x35, 0xC2, 0x6E, 0xC1, 0xA2, 0x78, 0x6B, 0x0B, 0xC0, 0x65, 0x3A, 0x35, 0xC1,
+        0x3A, 0x2E, 0x67, 0xC0, 0x35, 0xC0, 0x3A, 0xC0, 0xA2, 0x77, 0x3A, 0xFE, 0xA4, 0x38, 0xAA, 0x46,
+        0xC5, 0x9D, 0x89, 0x99, 0x9A, 0x9A, 0xCA, 0xFE, 0xEF, 0x3A, 0x2F, 0x07, 0xCA, 0x9C, 0x89, 0x13,
+        0x94, 0xDA, 0xFE, 0xDE, 0x33, 0xA5, 0x98, 0xA6, 0x66, 0xFE, 0xF5, 0x56, 0x6C, 0xA7, 0x34, 0x9D,
+        0x89, 0x52, 0x2D, 0xC0, 0x32, 0x7E, 0xA2, 0x87, 0x3A, 0x01, 0xC1, 0x6E, 0xC1, 0x7F, 0xC6, 0x06,
+        0xC4, 0x01, 0x06, 0x01, 0xC0, 0x6B, 0x9B, 0x88, 0x8B, 0x5C, 0x7F, 0xC9, 0x9C, 0x89, 0x55, 0xA4,
+        0x88, 0x1C, 0xC0, 0x51, 0x00, 0x52, 0xA8, 0x96, 0xB6, 0x96, 0xAA, 0x86, 0xA5, 0x78, 0xA1, 0x8A,
+        0xC1, 0x69, 0x1C, 0xC3, 0x6B, 0x1C, 0x59, 0x19, 0xC0, 0x16, 0xC5, 0x1D, 0x59, 0xA0, 0xBA, 0xC0,
+        0x27, 0xC1, 0x1D, 0x5A, 0x13, 0x10, 0x5A, 0xC1, 0x6B, 0x0D, 0xC1, 0x10, 0xC0, 0x9C, 0xE8, 0xC1,
+        0x69, 0xC0, 0x5B, 0x33, 0x3A, 0xA2, 0x78, 0x6B, 0x04, 0x0B, 0xC1, 0x3A, 0x37, 0x2B, 0x3A, 0xC0,
+        0x35, 0x5A, 0xC0, 0x3A, 0x0B, 0x0F, 0x66, 0x9B, 0xA9, 0xFE, 0x9C, 0x79, 0xA8, 0x66, 0xC5, 0x56,
+        0x98, 0x89, 0xA1, 0xD7, 0xB4, 0x60, 0xFE, 0xC5, 0xDC, 0xAB, 0x66, 0xC9, 0x66, 0x96, 0x8A, 0x99,
+        0xAA, 0xA2, 0xC1, 0xAC, 0x62, 0x94, 0xFF, 0x9C, 0xAB, 0xFE, 0xF2, 0x34, 0xFE, 0xF6, 0x75, 0x25,
+        0x9A, 0x9A, 0x52, 0x3A, 0x56, 0x7A, 0xA5, 0x87, 0x6D, 0x3A, 0x01, 0x06, 0xC1, 0x7F, 0xC1, 0x6E,
+        0xC4, 0x15, 0xC0, 0x06, 0xC6, 0x67, 0x6E, 0x98, 0x89, 0x8D, 0x5C, 0x7E, 0xC8, 0x14, 0x9C, 0x89,
+        0xAE, 0xA6, 0xA8, 0x87, 0x8C, 0x6A, 0x61, 0xC0, 0x38, 0xB0, 0x95, 0xAC, 0x86, 0x6B, 0xA7, 0x87,
+        0xA3, 0x7A, 0x6B, 0xC1, 0x15, 0x1C, 0xC0, 0x23, 0x1C, 0xC0, 0x23, 0x59, 0xC2, 0x16, 0x19, 0x16,
+        0xC1, 0x5A, 0xC0, 0x16, 0x13, 0xA0, 0xA9, 0x27, 0xC0, 0x2A, 0x6B, 0x27, 0x1D, 0x5A, 0x10, 0x5A,
+        0xC7, 0x3F, 0xC0, 0x66, 0xC0, 0x5A, 0x69, 0x3F, 0x69, 0x3F, 0x6F, 0x3F, 0x0B, 0x12, 0x3F, 0x0B,
+        0x3F, 0xC1, 0x3A, 0x2E, 0x3A, 0xC1, 0x3F, 0x0B, 0x56, 0x97, 0xAB, 0x94, 0x7F, 0xA4, 0x77, 0xC5,
+        0x51, 0x96, 0x9B, 0xFE, 0xD6, 0x38, 0xA2, 0x87, 0x9E, 0x7D, 0x07, 0xC9, 0x9B, 0x9A, 0x13, 0x95,
+        0xDB, 0xFE, 0xEE, 0xD4, 0xFE, 0xF5, 0x56, 0xAC, 0x38, 0x90, 0xFD, 0x92, 0xFC, 0xA6, 0x55, 0xFE,
+        0xF6, 0xF4, 0x59, 0x9A, 0x9A, 0x7E, 0x62, 0x6E, 0xA6, 0x76, 0x51, 0x9B, 0x9B, 0x01, 0x6E, 0x7F,
+        0xC1, 0x6E, 0xC2, 0x7F, 0xC1, 0x69, 0x1A, 0xC0, 0x15, 0xC1, 0x69, 0x06, 0xC2, 0x6B, 0xC0, 0x98,
+        0x79, 0x14, 0x7E, 0xC8, 0x00, 0x51, 0x80, 0xA5, 0xA6, 0x97, 0x9D, 0x88, 0x65, 0x6B, 0x32, 0x7D,
+        0xA3, 0x88, 0xA4, 0x77, 0xA2, 0x79, 0x6E, 0xA0, 0x8A, 0x6B, 0xC0, 0x23, 0x1C, 0xC1, 0x15, 0x5A,
+        0x19, 0xC0, 0x20, 0x23, 0x20, 0x58, 0x19, 0x16, 0xC1, 0x5A, 0xC2, 0x7B, 0x20, 0x27, 0x20, 0x27,
+        0xC1, 0x13, 0xC0, 0x10, 0xC1, 0x5A, 0x10, 0xC0, 0x13, 0x10, 0x0D, 0x9C, 0xF7, 0xC0, 0x30, 0xA0,
+        0x8A, 0x37, 0xC0, 0x3A, 0x6D, 0x6B, 0xC1, 0xA1, 0x7A, 0x0B, 0xC0, 0x0F, 0x0B, 0xC0, 0x57, 0x79,
+        0x33, 0x3F, 0x06, 0x0B, 0xC1, 0x69, 0x92, 0xAE, 0x9A, 0x6D, 0xA2, 0x77, 0xC5, 0x9A, 0x89, 0x97,
+        0xDB, 0xFE, 0xF7, 0x59, 0x97, 0x9B, 0xA1, 0x7D, 0xA7, 0x78, 0xC8, 0x66, 0x96, 0x8A, 0x35, 0xA8,
+        0xA0, 0xAC, 0x62, 0xFE, 0xF4, 0xF9, 0xAD, 0x35, 0x94, 0xEA, 0x9D, 0xA9, 0x56, 0xA7, 0x42, 0x39,
+        0x6D, 0x65, 0x9D, 0x9B, 0xA4, 0x77, 0x61, 0x3E, 0x98, 0x9A, 0x6B, 0x0E, 0xC0, 0x6B, 0xC0, 0x1A,
+        0xC0, 0x29, 0xC3, 0x22, 0x6E, 0x1A, 0x15, 0xC0, 0x0E, 0xC0, 0x15, 0x06, 0x0E, 0xC0, 0x15, 0x56,
+        0x9B, 0x88, 0x8A, 0x5C, 0x7F, 0xC7, 0x14, 0x9C, 0x89, 0xB2, 0x95, 0xB5, 0xA6, 0x66, 0x6D, 0x7E,
+        0x9D, 0x8A, 0x65, 0xA3, 0x86, 0xA2, 0x87, 0x5B, 0xA3, 0x89, 0xA2, 0x78, 0x6B, 0xA0, 0x8A, 0xC0,
+        0x6B, 0x1C, 0xC1, 0x5B, 0x19, 0x69, 0x1C, 0x23, 0x6B, 0xC0, 0x19, 0x23, 0x5B, 0x20, 0x58, 0x6B,
+        0x1D, 0x59, 0x1D, 0x2A, 0x6B, 0xC0, 0x27, 0x1D, 0x27, 0xC0, 0x13, 0x20, 0x4A, 0x10, 0x13, 0x10,
+        0xC0, 0x1D, 0xC0, 0x10, 0xC0, 0x9D, 0xE8, 0x66, 0x5A, 0x3A, 0x37, 0xC0, 0x3A, 0x37, 0x3A, 0xC0,
+        0x3F, 0x0B, 0x04, 0x0A, 0x67, 0xA2, 0x76, 0x0A, 0xC0, 0x0B, 0x3F, 0x0B, 0xC2, 0x6B, 0x04, 0x90,
+        0xAE, 0x9D, 0x6D, 0x6E, 0xC4, 0x56, 0x97, 0x9A, 0xA8, 0xB4, 0xB0, 0x62, 0x96, 0x9B, 0xA0, 0x8C,
+        0xAA, 0x56, 0xC8, 0x9C, 0x99, 0x13, 0x97, 0xC9, 0xFE, 0xF7, 0xB8, 0x7D, 0xFE, 0xF3, 0xF6, 0xA8,
+        0x56, 0x65, 0xC0, 0x9C, 0x99, 0xAC, 0x20, 0xA6, 0x44, 0xA5, 0x87, 0xA4, 0x66, 0x9D, 0xAA, 0x6F,
+        0x9C, 0x98, 0xA3, 0x89, 0x97, 0xAA, 0x56, 0xA3, 0x98, 0x52, 0xC0, 0x6B, 0x20, 0x53, 0xC1, 0x22,
+        0xC0, 0x5A, 0x22, 0xA3, 0x87, 0x1A, 0x15, 0x0E, 0x1B, 0xC0, 0x0E, 0x56, 0x0E, 0x1B, 0x15, 0x5A,
+        0xA4, 0x85, 0x83, 0x6F, 0x52, 0xC7, 0x00, 0x65, 0x84, 0x93, 0xA2, 0x99, 0xC0, 0x69, 0xA3, 0x87,
+        0x13, 0x65, 0xA5, 0x76, 0x69, 0x9B, 0xAB, 0x25, 0xA3, 0x77, 0xA1, 0x8A, 0xA0, 0x8A, 0x6B, 0xC2,
+        0x19, 0x27, 0x69, 0x19, 0xC1, 0x20, 0xC0, 0x16, 0xA0, 0xAA, 0x20, 0xC0, 0x1D, 0x16, 0x1D, 0xC1,
+        0x27, 0x31, 0xC0, 0x27, 0x1D, 0x5A, 0x1D, 0x59, 0xC0, 0x10, 0xC3, 0x1D, 0x13, 0xC0, 0x1D, 0x9D,
+        0xC7, 0x66, 0xC4, 0x37, 0xC1, 0x3F, 0xC0, 0x6F, 0x53, 0x6B, 0x05, 0x6F, 0x0A, 0x0B, 0x04, 0x0A,
+        0xC0, 0x6E, 0x7A, 0xC0, 0x0B, 0x91, 0xBE, 0x9B, 0x6D, 0xA2, 0x77, 0xC4, 0x9B, 0x8A, 0x95, 0xDB,
+        0xFE, 0xEF, 0x1A, 0x6D, 0x24, 0x98, 0x9F, 0xB0, 0x45, 0xC8, 0x97, 0x9B, 0x94, 0xBA, 0xFE, 0xDE,
+        0x97, 0x34, 0xC0, 0xFE, 0xF5, 0xF7, 0xFE, 0xF4, 0x16, 0xA2, 0x87, 0x9B, 0xBA, 0x59, 0xFE, 0xFF,
+        0x34, 0x2D, 0xA5, 0x67, 0xA2, 0x88, 0xC1, 0x61, 0xC0, 0x98, 0xAA, 0xA3, 0x87, 0x57, 0x9B, 0x9B,
+        0xC0, 0xA2, 0x87, 0x32, 0x9B, 0x9C, 0x66, 0x1A, 0xC0, 0x22, 0x1A, 0xA2, 0x87, 0x39, 0x15, 0x59,
+        0x25, 0x14, 0x6F, 0xA2, 0x88, 0x13, 0x0E, 0x34, 0x0E, 0xA2, 0x87, 0xA6, 0x66, 0x94, 0x8B, 0x88,
+        0x6E, 0x7E, 0xC5, 0x55, 0x9C, 0x8A, 0xB4, 0xA4, 0xB8, 0x74, 0xC0, 0x9C, 0xAA, 0xC0, 0xA4, 0x65,
+        0x62, 0x6E, 0x69, 0x61, 0xA3, 0x78, 0x9C, 0x9A, 0x2F, 0x36, 0x04, 0xA2, 0x79, 0x69, 0x1C, 0xC0,
+        0x19, 0x6B, 0x19, 0xC0, 0x20, 0x7A, 0x20, 0xC0, 0x16, 0xC1, 0x20, 0x7B, 0x1D, 0x59, 0x1D, 0xC0,
+        0x16, 0x20, 0x2A, 0x5A, 0xC0, 0x49, 0x59, 0xC2, 0x5A, 0xC0, 0x10, 0xC1, 0x1A, 0xC0, 0x1D, 0x3F,
+        0x67, 0x3A, 0x3F, 0xC1, 0x3A, 0x5A, 0xC0, 0x6B, 0x37, 0x3F, 0x6F, 0xC0, 0x0A, 0xC1, 0x0B, 0xC0,
+        0x6B, 0xC0, 0x05, 0xC1, 0x0B, 0xC0, 0x93, 0xAD, 0x98, 0x6E, 0xA3, 0x87, 0xC3, 0x56, 0x97, 0xAA,
+        0xA7, 0xB5, 0xB2, 0x51, 0x9A, 0x9A, 0x9A, 0x8A, 0xFE, 0x93, 0xB9, 0x02, 0x07, 0xC6, 0x9C, 0x99,
+        0x95, 0x9B, 0x9C, 0xC5, 0xFE, 0xFF, 0xD7, 0x69, 0x21, 0x28, 0x95, 0xDC, 0x98, 0xCC, 0xC0, 0x1B,
+        0xA9, 0x65, 0x61, 0x28, 0x2D, 0xC1, 0x6E, 0x2D, 0x04, 0x51, 0x63, 0x9B, 0x8A, 0x66, 0xA4, 0x87,
+        0x03, 0x98, 0xAB, 0x6B, 0x20, 0x67, 0xA4, 0x75, 0x22, 0x39, 0x03, 0x15, 0xA4, 0x75, 0xA3, 0x87,
+        0x1B, 0x9D, 0x9A, 0x25, 0x03, 0x25, 0xA3, 0x88, 0x25, 0xA5, 0x88, 0x9B, 0x9A, 0x18, 0x92, 0x7B,
+        0x8F, 0x7C, 0xA2, 0x88, 0xC4, 0x9C, 0x88, 0x6B, 0x81, 0xB4, 0xA6, 0x87, 0xA6, 0x55, 0x66, 0x61,
+        0x3B, 0xC1, 0x9D, 0xA9, 0x11, 0xA6, 0x66, 0x9D, 0xA9, 0x6F, 0x52, 0xA1, 0x8A, 0xA3, 0x89, 0x6B,
+        0xC0, 0x19, 0xC4, 0x6B, 0x19, 0x5A, 0x5A, 0x16, 0xC2, 0x13, 0x10, 0x13, 0xC0, 0x7B, 0x16, 0x13,
+        0xC1, 0x10, 0x0D, 0xC0, 0x10, 0x0D, 0xC1, 0x10, 0x1D, 0xC0, 0x27, 0x1A, 0x1D, 0x9D, 0xC7, 0xC4,
+        0x5A, 0x66, 0xC2, 0x79, 0x3F, 0xC0, 0x6E, 0x6F, 0x67, 0x10, 0x12, 0x0A, 0x7D, 0x0A, 0xC0, 0x0B,
+        0xC0, 0x3C, 0x96, 0xAC, 0x95, 0x7F, 0xA4, 0x77, 0xC3, 0x9B, 0x89, 0x95, 0xCC, 0xFE, 0xEE, 0xF9,
+        0x3C, 0x98, 0x9A, 0xFE, 0xA4, 0xF9, 0xFE, 0x69, 0xF9, 0xFE, 0xC6, 0x3D, 0x07, 0xC5, 0x62, 0x96,
+        0x8A, 0x92, 0xDA, 0xFE, 0xEE, 0xB3, 0xA7, 0x77, 0x39, 0x00, 0x65, 0x28, 0x60, 0x32, 0x9C, 0x88,
+        0xA6, 0x76, 0xA5, 0x7A, 0x39, 0xC1, 0x00, 0xC0, 0x39, 0x64, 0xC0, 0x9C, 0xA9, 0x55, 0x9C, 0x99,
+        0xA5, 0x78, 0x3E, 0x9A, 0x9A, 0xC0, 0xA2, 0x87, 0x3E, 0xA4, 0x76, 0x08, 0x7B, 0x17, 0x9B, 0xAA,
+        0x1C, 0x25, 0x13, 0x1B, 0xC0, 0x32, 0x1C, 0xC0, 0x6E, 0x08, 0x1B, 0x0E, 0x6F, 0x91, 0x7A, 0x8F,
+        0x7D, 0x14, 0x7E, 0xC1, 0x9D, 0x89, 0x52, 0xBA, 0x92, 0xB0, 0x96, 0x52, 0xA5, 0x77, 0xC0, 0x6F,
+        0x6B, 0x07, 0x69, 0x65, 0x2F, 0x00, 0xC0, 0x07, 0x3B, 0x0E, 0x66, 0xA1, 0x8A, 0xC2, 0x59, 0xC0,
+        0x6B, 0xC0, 0x16, 0xC0, 0x5B, 0xC0, 0x69, 0xC0, 0x16, 0xC0, 0x13, 0x5A, 0xC0, 0x13, 0x1D, 0xC0,
+        0x13, 0x10, 0xC1, 0x0D, 0xC1, 0x10, 0xC1, 0x1A, 0x1D, 0xC0, 0x7B, 0x10, 0x1D, 0x3F, 0x6B, 0xC0,
+        0x3F, 0xC0, 0x69, 0x5A, 0x3F, 0x37, 0xC0, 0x7A, 0x38, 0x04, 0xC0, 0x6F, 0xC0, 0x66, 0xC0, 0x57,
+        0x0C, 0x0F, 0x0B, 0x6B, 0x0B, 0xC0, 0x04, 0x98, 0x9B, 0xFE, 0xA4, 0x9A, 0xA7, 0x66, 0xC2, 0x56,
+        0x98, 0x89, 0xA1, 0xD7, 0xB6, 0x51, 0x6C, 0x9D, 0x98, 0xFE, 0x8C, 0x5A, 0xFE, 0x29, 0xB8, 0xAD,
+        0xE1, 0xB7, 0x43, 0xA5, 0x87, 0xA2, 0x88, 0x6E, 0x7A, 0x02, 0x2E, 0x98, 0x8A, 0x93, 0xDB, 0xFE,
+        0xEE, 0xF6, 0x2F, 0x0E, 0x69, 0x1C, 0x69, 0x2D, 0x21, 0x6E, 0x2D, 0xC0, 0x0E, 0x15, 0x07, 0x39,
+        0x69, 0x07, 0x39, 0x32, 0x39, 0x9B, 0xB7, 0x26, 0xC1, 0x3E, 0x61, 0xA2, 0x77, 0x67, 0xA2, 0x88,
+        0x34, 0x00, 0x64, 0x34, 0x2D, 0x9C, 0xA9, 0x97, 0xAB, 0xC0, 0xA5, 0x87, 0xA4, 0x76, 0x66, 0x21,
+        0xA2, 0x79, 0xC0, 0x21, 0x03, 0x9D, 0xA9, 0x37, 0xA4, 0x68, 0x8E, 0x8D, 0x87, 0x8D, 0xA2, 0x88,
+        0x7F, 0x51, 0xA4, 0x86, 0xB7, 0x85, 0xAE, 0x95, 0x39, 0x66, 0x07, 0xC0, 0xA0, 0x8A, 0x1C, 0x15,
+        0x69, 0xC2, 0x15, 0xC0, 0x0E, 0x60, 0x53, 0x0E, 0x1C, 0x6B, 0x59, 0x69, 0x19, 0x6B, 0x7B, 0x20,
+        0x19, 0x5A, 0x5A, 0x16, 0x1D, 0xC0, 0x16, 0x13, 0xC0, 0x5A, 0x1D, 0x27, 0x1D, 0x16, 0x10, 0x5B,
+        0x69, 0x10, 0xC2, 0x1D, 0x1A, 0x1D, 0x27, 0x1D, 0x1A, 0x0D, 0x10, 0x3F, 0x6B, 0xC1, 0x3F, 0x69,
+        0xC0, 0x3F, 0xC0, 0x3A, 0x3F, 0x38, 0xA1, 0x8A, 0xC0, 0x69, 0x0B, 0x3F, 0x0B, 0x6B, 0x0B, 0x12,
+        0x0B, 0x3F, 0xC2, 0x9C, 0x8A, 0xFE, 0x9C, 0x59, 0xA9, 0x66, 0xC2, 0x9C, 0x79, 0x96, 0xBA, 0xFE,
+        0xDE, 0x79, 0xA9, 0x75, 0x9C, 0x98, 0x9B, 0x99, 0xFE, 0x83, 0xDA, 0x8F, 0x4F, 0xA1, 0xB7, 0xAB,
+        0xE3, 0xAF, 0x54, 0xA4, 0x78, 0xA3, 0x87, 0x6F, 0x34, 0x13, 0x95, 0xDB, 0xFE, 0xE6, 0x95, 0xAA,
+        0x65, 0x07, 0x69, 0x69, 0x1C, 0x15, 0x9E, 0x94, 0xC0, 0x65, 0x69, 0x26, 0x0E, 0xA0, 0x8A, 0x0E,
+        0x39, 0x69, 0x0E, 0x00, 0x07, 0x0E, 0x34, 0x39, 0x00, 0xC0, 0x28, 0x61, 0x9B, 0xAA, 0x56, 0x34,
+        0xA7, 0x68, 0x00, 0x0E, 0xC0, 0x07, 0x28, 0x9D, 0x98, 0x2D, 0x6E, 0x28, 0x9D, 0xA8, 0x28, 0x39,
+        0x65, 0x65, 0x15, 0x32, 0x0B, 0xA2, 0x78, 0xA2, 0x7A, 0x93, 0x8C, 0x8C, 0x8B, 0x7E, 0xB0, 0x75,
+        0xAC, 0x94, 0x28, 0x39, 0x00, 0x07, 0x0E, 0xC0, 0x6B, 0xC0, 0x0E, 0xC0, 0x07, 0xC0, 0x0E, 0xA0,
+        0x8A, 0xC0, 0x15, 0x07, 0xC0, 0x5B, 0x1C, 0x23, 0x19, 0xC0, 0x23, 0x6B, 0xC1, 0x20, 0xC0, 0x16,
+        0xC2, 0x5A, 0xC0, 0x5A, 0x13, 0x7B, 0x27, 0xC0, 0x1D, 0x10, 0x0D, 0x14, 0xC0, 0x0D, 0x10, 0xC3,
+        0x1A, 0xC0, 0x0D, 0xC1, 0x9E, 0xE7, 0x57, 0x06, 0x03, 0x79, 0x38, 0x6E, 0x3F, 0x5A, 0x3A, 0xC0,
+        0x38, 0x3F, 0x04, 0xC0, 0x3F, 0xC0, 0x6F, 0xC0, 0x6E, 0x6B, 0x0B, 0x3F, 0xC2, 0x52, 0xFE, 0x9C,
+        0x38, 0xAA, 0x56, 0xC1, 0x66, 0x99, 0x8A, 0x9C, 0xC8, 0x3C, 0x30, 0x50, 0x9A, 0x99, 0xFE, 0x7B,
+        0x9A, 0x91, 0x4D, 0xC0, 0x7A, 0xA3, 0xF7, 0xAB, 0x83, 0xA8, 0x76, 0xC0, 0x9D, 0x9A, 0x9F, 0xA6,
+        0xFE, 0xDE, 0x13, 0xA9, 0x75, 0x00, 0x07, 0x00, 0x28, 0x00, 0x21, 0x62, 0x99, 0xAA, 0xC0, 0xA7,
+        0x76, 0xA3, 0x7A, 0x69, 0xA1, 0x8C, 0x07, 0x00, 0xC0, 0x39, 0x0E, 0x6B, 0x1C, 0x0E, 0xC0, 0x15,
+        0xC0, 0x39, 0x10, 0x9B, 0xAB, 0xA4, 0x77, 0x5A, 0x3B, 0x07, 0x0E, 0x1C, 0x0E, 0x2D, 0xC0, 0x9C,
+        0xA8, 0x17, 0x2D, 0x28, 0x39, 0x9D, 0xA8, 0x3E, 0x17, 0xA4, 0x67, 0x28, 0x66, 0x28, 0x0E, 0x00,
+        0x15, 0x07, 0x0E, 0x9F, 0x96, 0x9D, 0xAA, 0xA2, 0x77, 0x00, 0x15, 0xC0, 0x0E, 0xC0, 0x07, 0xC0,
+        0x0E, 0xC1, 0x15, 0x0E, 0xC2, 0x00, 0xA0, 0x7A, 0x6B, 0x19, 0xC0, 0x2A, 0x6B, 0x2A, 0xC1, 0x31,
+        0x27, 0x16, 0x7B, 0x16, 0x5A, 0x5A, 0xC1, 0x13, 0x20, 0xC0, 0x31, 0x1D, 0x10, 0xC0, 0x0D, 0x14,
+        0x0D, 0x10, 0x1D, 0x10, 0xC0, 0x13, 0x1D, 0x10, 0x0D, 0xC0, 0x10, 0x04, 0x3F, 0xC5, 0x67, 0x59,
+        0xC0, 0x3A, 0x69, 0x3F, 0xC0, 0x3C, 0x3F, 0xC0, 0x04, 0x6F, 0x67, 0x69, 0x66, 0x04, 0xC0, 0x38,
+        0x53, 0xFE, 0x9C, 0x38, 0xAA, 0x57, 0x69, 0xC0, 0x52, 0x96, 0x9A, 0xAF, 0xA1, 0x32, 0x9B, 0x8A,
+        0x9C, 0x88, 0x9B, 0xA8, 0xFE, 0x6B, 0x5A, 0x93, 0x5D, 0x2B, 0xC1, 0x32, 0xA2, 0xD9, 0xFE, 0xB4,
+        0xD3, 0xA3, 0x96, 0xA7, 0x85, 0xA3, 0x87, 0xA7, 0x77, 0xA2, 0x88, 0x28, 0x34, 0x03, 0x28, 0x99,
+        0xA9, 0x7F, 0xA2, 0x86, 0x03, 0x3E, 0x61, 0xA7, 0x67, 0xA2, 0x78, 0x00, 0x0E, 0x07, 0x0E, 0xA0,
+        0x8A, 0x6B, 0x1C, 0x0E, 0x00, 0x0E, 0xC0, 0x00, 0x69, 0x65, 0x21, 0x32, 0x00, 0x07, 0x0E, 0x07,
+        0x00, 0x39, 0x9D, 0xA8, 0x28, 0xC0, 0x39, 0xC0, 0x28, 0x60, 0x62, 0x55, 0xA6, 0x66, 0x07, 0xC0,
+        0x0E, 0x07, 0x39, 0x15, 0x07, 0x3B, 0x00, 0x28, 0x34, 0x07, 0xC0, 0x15, 0xC0, 0x07, 0xC1, 0x3B,
+        0x0E, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0E, 0x5B, 0x6B, 0xC2, 0x20, 0x23, 0x6B, 0xC1, 0x31, 0x2A,
+        0x1D, 0x31, 0x20, 0x49, 0x5A, 0x6B, 0xC0, 0x13, 0x6B, 0x1D, 0x27, 0x13, 0xC0, 0x0D, 0xC3, 0x10,
+        0x1A, 0x10, 0xC1, 0x13, 0x1A, 0x10, 0x13, 0x9F, 0xC8, 0x04, 0xC4, 0x66, 0x6B, 0x01, 0x59, 0x3A,
+        0x69, 0x3F, 0xC1, 0x3C, 0xC0, 0x04, 0xC1, 0x10, 0x0B, 0x04, 0x0B, 0xC0, 0xFE, 0xB5, 0x9B, 0x93,
+        0x9E, 0xAC, 0x74, 0x69, 0xC0, 0x9B, 0x8A, 0x95, 0xDB, 0xFE, 0xEF, 0x1A, 0xA2, 0x76, 0x99, 0x9B,
+        0x9C, 0x88, 0x9B, 0xA8, 0xFE, 0x83, 0xB8, 0xFE, 0x11, 0x7A, 0x2B, 0xC0, 0x6B, 0xA1, 0xBB, 0xFE,
+        0xAC, 0xB4, 0xA5, 0x93, 0x7E, 0xA7, 0x86, 0xA5, 0x87, 0x52, 0x67, 0xA4, 0x77, 0x2C, 0xA6, 0x76,
+        0xA2, 0x78, 0x96, 0xAA, 0x66, 0xA2, 0x86, 0x9D, 0x9B, 0x56, 0x13, 0xA9, 0x75, 0xC0, 0x34, 0x39,
+        0x00, 0x07, 0x6B, 0x23, 0xC0, 0x68, 0x0E, 0x15, 0x07, 0x39, 0xC0, 0x69, 0x39, 0xC0, 0x15, 0x6B,
+        0x15, 0x07, 0xC0, 0x00, 0xC0, 0x39, 0x07, 0x00, 0x2D, 0x17, 0x65, 0x9C, 0x99, 0x05, 0xA6, 0x66,
+        0x07, 0x1C, 0x15, 0x00, 0x07, 0x0E, 0x36, 0x66, 0x34, 0x39, 0x3B, 0x60, 0x39, 0x00, 0x15, 0xC0,
+        0x07, 0x00, 0xC0, 0x0E, 0x00, 0x07, 0x00, 0x2D, 0x34, 0x00, 0x12, 0xA0, 0x8B, 0xC0, 0x1D, 0x79,
+        0xC0, 0x7B, 0xA0, 0x8A, 0xC0, 0x69, 0x31, 0x2A, 0x20, 0x27, 0x1D, 0xC0, 0x59, 0x5B, 0xC0, 0x69,
+        0x27, 0x2A, 0x1D, 0x13, 0x10, 0x5A, 0xC2, 0x10, 0xC1, 0x0D, 0xC0, 0x10, 0x1D, 0xC0, 0x10, 0x1D,
+        0x9F, 0xB7, 0x65, 0xC1, 0x6B, 0x04, 0xC0, 0x38, 0x3F, 0xC0, 0x3C, 0x37, 0xC0, 0x3A, 0xC1, 0x38,
+        0x04, 0x0B, 0x5A, 0x66, 0x0B, 0xC0, 0x08, 0x10, 0x03, 0xFE, 0x52, 0xFC, 0xA7, 0xD3, 0xAD, 0x53,
+        0xC1, 0x98, 0x8A, 0x92, 0xDE, 0xAF, 0x45, 0xFE, 0xE6, 0xF9, 0x9B, 0x99, 0x9B, 0x89, 0x9B, 0xA8,
+        0x51, 0xFE, 0x7B, 0x97, 0xFE, 0x39, 0xFB, 0x9A, 0x6B, 0xAE, 0xB0, 0xFE, 0xB4, 0xD2, 0xA3, 0x96,
+        0x6E, 0x7E, 0xA9, 0x84, 0x9D, 0x8B, 0x9D, 0x9B, 0xA4, 0x77, 0xA2, 0x87, 0x9B, 0xAA, 0x18, 0xA9,
+        0x75, 0x96, 0xAB, 0x01, 0xC2, 0x6D, 0xA7, 0x86, 0xA4, 0x78, 0x55, 0x2D, 0x61, 0x21, 0x00, 0x0E,
+        0xC0, 0x9F, 0x96, 0x21, 0x07, 0x34, 0x6D, 0x28, 0x9B, 0xA9, 0xA2, 0x87, 0x28, 0x07, 0xA0, 0x8A,
+        0x34, 0x0F, 0x17, 0x08, 0x34, 0x07, 0x0E, 0x00, 0x69, 0x1C, 0x9D, 0xA9, 0x9B, 0x9A, 0x7E, 0x2D,
+        0x0E, 0xC0, 0x15, 0x6B, 0x0E, 0xC0, 0x00, 0xC0, 0x39, 0x9D, 0xAA, 0x9C, 0xA9, 0x6E, 0x2D, 0x9D,
+        0xAA, 0x07, 0x15, 0x1C, 0x15, 0xC0, 0x07, 0x00, 0x07, 0x39, 0x2D, 0x9D, 0x9A, 0x66, 0xA5, 0x69,
+        0xA0, 0x8C, 0xC0, 0x5A, 0x79, 0x20, 0x27, 0x7A, 0x31, 0xC1, 0x2A, 0x48, 0x20, 0xC0, 0x27, 0x48,
+        0x5A, 0xC0, 0x13, 0x10, 0x1D, 0xC0, 0x13, 0x10, 0x5A, 0xC0, 0x10, 0xC2, 0x59, 0x0D, 0x10, 0x7B,
+        0x1D, 0x1A, 0x10, 0xC0, 0x9F, 0xD7, 0x6B, 0xC2, 0x65, 0x3D, 0x04, 0x66, 0xC2, 0x37, 0xC0, 0x3A,
+        0x3F, 0xC0, 0x6F, 0x10, 0x9D, 0x9B, 0x5A, 0x7E, 0x05, 0x02, 0xA2, 0x97, 0x99, 0x8B, 0xFE, 0x19,
+        0xBC, 0xFE, 0x93, 0xF9, 0xAC, 0x54, 0xC0, 0x56, 0x95, 0xAB, 0xFE, 0x41, 0xB9, 0x9F, 0x69, 0xFE,
+        0xEF, 0x38, 0x98, 0x9A, 0x99, 0x99, 0x50, 0xA2, 0x85, 0x52, 0xA6, 0x86, 0x9D, 0x9A, 0xA5, 0x97,
+        0x99, 0x8B, 0x7A, 0xC0, 0xA3, 0x87, 0xA2, 0x87, 0x9E, 0x8B, 0xA2, 0x88, 0xA2, 0x88, 0x69, 0x39,
+        0x7D, 0xA6, 0x75, 0x9C, 0x9A, 0x9D, 0x8A, 0x39, 0x32, 0xC1, 0xA9, 0x84, 0x6E, 0x1E, 0xA4, 0x77,
+        0x1E, 0x30, 0xA5, 0x79, 0xA2, 0x79, 0x21, 0x2D, 0x9D, 0xA8, 0x2D, 0xC0, 0x66, 0xC0, 0x3E, 0x7E,
+        0xA2, 0x78, 0x21, 0x34, 0x17, 0x52, 0x9D, 0xA9, 0xC0, 0x21, 0xA2, 0x7A, 0x6B, 0x00, 0x2D, 0x60,
+        0x06, 0x6E, 0xA3, 0x77, 0x2D, 0x00, 0xC0, 0xA0, 0x8C, 0x69, 0xC1, 0x07, 0xA0, 0x85, 0x9C, 0xAB,
+        0x9D, 0xAA, 0x51, 0xA2, 0x86, 0xA4, 0x66, 0x2D, 0x00, 0x15, 0x2A, 0x23, 0xA0, 0x85, 0xC0, 0x15,
+        0xC0, 0x00, 0x9A, 0xA9, 0x52, 0xA5, 0x76, 0xA2, 0x7A, 0x69, 0xA1, 0x8A, 0x19, 0xC0, 0x6B, 0xC1,
+        0x2A, 0x31, 0xC0, 0x27, 0x20, 0x31, 0xC0, 0x2A, 0xA0, 0x56, 0x7B, 0xC0, 0x27, 0x1D, 0xC0, 0x69,
+        0x4A, 0xC0, 0x5A, 0xC1, 0x10, 0x0D, 0x10, 0xC1, 0x1D, 0x4A, 0x1D, 0xC0, 0x10, 0x0D, 0x09, 0xA0,
+        0x8A, 0xC1, 0x69, 0xC2, 0x61, 0x6E, 0x3F, 0x69, 0x3F, 0x59, 0x3F, 0xC0, 0x04, 0x10, 0x09, 0x67,
+        0x43, 0xC1, 0x6B, 0x7D, 0x94, 0x7E, 0xFE, 0x11, 0x9D, 0xFE, 0x94, 0x3A, 0xAA, 0x64, 0xC0, 0x9D,
+        0x89, 0x94, 0xAC, 0xFE, 0x19, 0x7A, 0xA8, 0x93, 0xFE, 0xEF, 0x37, 0x97, 0x9A, 0x9D, 0x98, 0xA3,
+        0x96, 0x9C, 0x99, 0x9C, 0x89, 0xA5, 0x87, 0xA6, 0x96, 0x56, 0x9B, 0x9A, 0x9D, 0x8A, 0x66, 0x0A,
+        0x6B, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0x39, 0x55, 0x7A, 0xA2, 0x86, 0x2D, 0xC3, 0xA3, 0x86, 0xA4,
+        0x76, 0x9B, 0x9B, 0x6B, 0xA4, 0x86, 0xC0, 0x0C, 0x2B, 0xA6, 0x68, 0x9D, 0xA8, 0x1A, 0x6F, 0x61,
+        0xA2, 0x7A, 0x00, 0x69, 0x9C, 0xA7, 0x9C, 0x99, 0x52, 0x3C, 0xA3, 0x8A, 0x9A, 0xA8, 0x5A, 0xA2,
+        0x87, 0xA2, 0x88, 0xA2, 0x78, 0x39, 0x00, 0x68, 0x1C, 0x15, 0x9D, 0xA9, 0xA2, 0x77, 0x6E, 0x09,
+        0x00, 0xA0, 0x8B, 0x69, 0xA0, 0x8A, 0xA0, 0x8A, 0x69, 0x0E, 0xC0, 0x69, 0x3B, 0x9C, 0xA8, 0x9D,
+        0x99, 0x62, 0xA3, 0x77, 0x34, 0x1C, 0x2A, 0xC0, 0x23, 0x1C, 0x2A, 0x23, 0x0E, 0x54, 0xC0, 0x6F,
+        0x9C, 0x96, 0x6B, 0x38, 0x9D, 0x9B, 0xA4, 0x78, 0x20, 0x2A, 0x31, 0x2A, 0xC0, 0x31, 0x59, 0xC0,
+        0x31, 0xC0, 0x20, 0x49, 0x2A, 0x27, 0xC2, 0x1D, 0x13, 0x1D, 0x49, 0x5A, 0xC0, 0x10, 0x7B, 0x1D,
+        0xC0, 0x1A, 0xC1, 0x5A, 0x1D, 0x10, 0xC0, 0x9D, 0xDA, 0xC0, 0xA2, 0x87, 0x69, 0x17, 0x66, 0x10,
+        0x65, 0x65, 0x04, 0x55, 0x38, 0xC3, 0x5F, 0x7B, 0xC0, 0x53, 0x02, 0xC3, 0xFE, 0xA5, 0x3C, 0xFE,
+        0x21, 0x9C, 0xFE, 0x8C, 0x7C, 0xA8, 0x84, 0x69, 0x9A, 0x89, 0x94, 0x9E, 0x93, 0x4F, 0xFE, 0x7B,
+        0xD9, 0xFE, 0xF7, 0x55, 0x9B, 0x9A, 0x60, 0x9D, 0x99, 0x9A, 0x89, 0x24, 0x6E, 0x37, 0x9D, 0x98,
+        0x9D, 0x9A, 0x24, 0x9D, 0x9A, 0xC0, 0xA2, 0x78, 0x6F, 0xA1, 0x9A, 0x65, 0x56, 0x65, 0xC0, 0x7E,
+        0xC2, 0x5A, 0xC0, 0x30, 0x23, 0x66, 0x2A, 0x2D, 0x66, 0x6D, 0xA5, 0x86, 0xA8, 0x67, 0x9A, 0xA9,
+        0xA2, 0x77, 0xA4, 0x77, 0xA1, 0x8A, 0x34, 0x0E, 0x07, 0x9F, 0x96, 0x62, 0x0F, 0x79, 0x21, 0x3E,
+        0x99, 0xAB, 0xA2, 0x77, 0xA2, 0x87, 0xA4, 0x77, 0x34, 0x2D, 0x69, 0x06, 0x08, 0x21, 0x99, 0xB9,
+        0x03, 0xA6, 0x67, 0xA0, 0x8A, 0x15, 0xC1, 0x69, 0xC0, 0x3B, 0x62, 0x66, 0x69, 0x51, 0x9D, 0xA9,
+        0x56, 0x11, 0x00, 0x0E, 0xA0, 0x8B, 0x6B, 0x1C, 0x0E, 0x15, 0x1C, 0x07, 0x60, 0x5F, 0x9C, 0xA9,
+        0x9B, 0x99, 0xA4, 0x76, 0x6F, 0x9B, 0x9C, 0xA7, 0x77, 0xA3, 0x89, 0x20, 0xA0, 0x9A, 0x2A, 0x27,
+        0x2A, 0x49, 0x27, 0x31, 0x2A, 0x16, 0x20, 0x1D, 0xC0, 0x20, 0x27, 0x49, 0x59, 0xC2, 0x5A, 0xC0,
+        0xA0, 0xA8, 0x1A, 0xC0, 0x1D, 0xC0, 0x13, 0x10, 0x0D, 0x10, 0xC1, 0x02, 0x0A, 0xA2, 0x86, 0xC1,
+        0x6B, 0xC0, 0x04, 0x3D, 0x66, 0x6B, 0xC4, 0x5E, 0x10, 0x0A, 0xC2, 0x02, 0xC0, 0x0A, 0xFE, 0x9D,
+        0x1B, 0xFE, 0x51, 0xBB, 0xB0, 0x42, 0xFE, 0xAD, 0x7B, 0xC0, 0x9A, 0x8B, 0xFE, 0x39, 0xFB, 0x9C,
+        0x68, 0xFE, 0xAD, 0x7A, 0xFE, 0xFF, 0x76, 0x9B, 0x98, 0x05, 0x9D, 0x99, 0x59, 0xA3, 0x98, 0x2B,
+        0xA3, 0x8A, 0x65, 0x37, 0x50, 0x67, 0x52, 0x9C, 0x89, 0x9F, 0x8C, 0x7E, 0x39, 0x55, 0xC1, 0x7A,
+        0x6E, 0xC3, 0x2A, 0x66, 0xC0, 0x2A, 0xC0, 0x65, 0x7E, 0x6E, 0xA9, 0x85, 0x30, 0x3A, 0xA2, 0x77,
+        0xA3, 0x87, 0xA8, 0x77, 0x00, 0x64, 0x9A, 0xA9, 0x9C, 0x99, 0xA2, 0x87, 0x5A, 0xA6, 0x76, 0x3E,
+        0x99, 0x9C, 0xA2, 0x87, 0x3E, 0xA2, 0x88, 0x6E, 0x06, 0x0B, 0x1C, 0x2B, 0x21, 0xC1, 0x6E, 0xA1,
+        0x8C, 0xA0, 0x8B, 0x69, 0xA0, 0x84, 0x00, 0x39, 0x00, 0x9D, 0xAA, 0x9C, 0x9A, 0xC0, 0x65, 0x69,
+        0xA4, 0x76, 0x00, 0xC0, 0x66, 0x15, 0x1C, 0x68, 0x15, 0x0E, 0x69, 0x3B, 0x55, 0x9B, 0xBA, 0x9C,
+        0x8B, 0x55, 0xA5, 0x86, 0x9C, 0x89, 0x53, 0xA8, 0x76, 0xA2, 0x89, 0x1C, 0xA0, 0x8A, 0xC0, 0x59,
+        0x27, 0x48, 0x2A, 0xC0, 0x20, 0x59, 0x27, 0xC0, 0x20, 0x4A, 0x59, 0xC0, 0x0D, 0x10, 0xC0, 0x13,
+        0xC0, 0x10, 0x1A, 0x7A, 0x13, 0x10, 0x1A, 0xC0, 0x0D, 0xC0, 0x10, 0x1A, 0x13, 0x02, 0xA2, 0x87,
+        0xC0, 0x0A, 0x7E, 0x6D, 0xC0, 0x65, 0xC0, 0x3F, 0xC5, 0x3C, 0x7F, 0xC0, 0x12, 0x0A, 0x66, 0x02,
+        0xC0, 0x7D, 0x96, 0x8E, 0xFE, 0x83, 0x9B, 0x96, 0x5E, 0xFE, 0xAD, 0x7B, 0x9D, 0x8B, 0xFE, 0x42,
+        0x3C, 0x9D, 0x89, 0x9E, 0x57, 0xFE, 0xDE, 0x98, 0xA6, 0x92, 0x9D, 0x98, 0x65, 0xC1, 0x32, 0x06,
+        0xA2, 0x7A, 0x6E, 0x17, 0x2B, 0x99, 0x9B, 0x9D, 0x8A, 0xA1, 0x8A, 0xA2, 0x88, 0xC0, 0x65, 0x66,
+        0xC1, 0x3E, 0xC3, 0x39, 0x69, 0x56, 0xC0, 0x7A, 0xC0, 0x56, 0x69, 0x7E, 0xA6, 0x75, 0x32, 0xC0,
+        0xA4, 0x86, 0xA5, 0x77, 0x62, 0xA8, 0x67, 0x9A, 0xA9, 0xA2, 0x77, 0x18, 0xA3, 0x88, 0x66, 0xA7,
+        0x76, 0x39, 0x1F, 0xA5, 0x86, 0x39, 0x9C, 0x99, 0x3E, 0x9D, 0xAA, 0x55, 0xA9, 0x66, 0x6F, 0x69,
+        0x07, 0xC1, 0x00, 0x69, 0x00, 0x17, 0x34, 0x21, 0x67, 0x34, 0x9C, 0xAB, 0x67, 0x68, 0x1C, 0x28,
+        0x9D, 0xAA, 0x9D, 0x99, 0x19, 0xA5, 0x68, 0x07, 0x0E, 0x3B, 0x07, 0x66, 0x27, 0xA2, 0x76, 0x9B,
+        0x9B, 0x62, 0x59, 0xC0, 0x9B, 0x9A, 0x6B, 0xA9, 0x65, 0xA5, 0x88, 0xA1, 0x8A, 0x1D, 0x7A, 0x1D,
+        0x59, 0xC0, 0x1D, 0xC2, 0x7B, 0x1D, 0x27, 0x1D, 0x49, 0x0D, 0xC0, 0x10, 0x13, 0x1A, 0x27, 0x1A,
+        0xC0, 0x7B, 0x13, 0x1A, 0xC0, 0x10, 0x0D, 0x5A, 0x10, 0x1A, 0x10, 0x9C, 0xCA, 0x0F, 0x62, 0x6B,
+        0x0F, 0x7E, 0x68, 0x04, 0x66, 0xC4, 0x3C, 0x3F, 0x04, 0xC1, 0x9F, 0x8B, 0x05, 0x6D, 0x05, 0x0A,
+        0x0F, 0xFE, 0xB5, 0xBC, 0x9D, 0x89, 0xFE, 0x4A, 0x7D, 0xAC, 0x81, 0xFE, 0x42, 0x1D, 0xAC, 0x70,
+        0x9D, 0x9A, 0xA6, 0x94, 0x3E, 0xC0, 0x66, 0x65, 0x9D, 0x88, 0x79, 0xA5, 0x89, 0xA3, 0x79, 0xA1,
+        0x8B, 0x2A, 0x23, 0x64, 0x9D, 0x99, 0x9D, 0x99, 0x53, 0x9F, 0x8B, 0x55, 0x66, 0x65, 0xC0, 0x7E,
+        0x6B, 0xC3, 0x3E, 0x66, 0x32, 0x39, 0xC0, 0x65, 0x56, 0x69, 0xC0, 0xA4, 0x87, 0x32, 0x3E, 0xA2,
+        0x87, 0x06, 0x18, 0x21, 0x99, 0xBB, 0x5A, 0x7E, 0x31, 0x17, 0xA3, 0x78, 0x9C, 0x99, 0x7A, 0x39,
+        0x9B, 0x9B, 0x1F, 0x7D, 0xC0, 0x52, 0x34, 0xA9, 0x57, 0x07, 0xA0, 0x8B, 0xC0, 0x00, 0x21, 0x9C,
+        0xA9, 0x23, 0x28, 0x2D, 0x9B, 0xAB, 0x63, 0xA3, 0x88, 0x6F, 0x66, 0x27, 0x69, 0x52, 0x61, 0xC0,
+        0xA5, 0x76, 0x6B, 0x6F, 0xA3, 0x79, 0x9D, 0xA9, 0x07, 0x61, 0x9B, 0xAB, 0x13, 0x66, 0x52, 0xC0,
+        0x55, 0x9D, 0x9A, 0x55, 0xA4, 0x77, 0xA9, 0x67, 0x6B, 0x16, 0xC0, 0x5A, 0x5A, 0xC0, 0x13, 0xA0,
+        0xA9, 0x13, 0xA0, 0xAA, 0x7B, 0x1D, 0xC0, 0x5A, 0x13, 0x10, 0xC2, 0x13, 0x27, 0xC0, 0x1A, 0x24,
+        0x1A, 0xC3, 0x10, 0x5A, 0xC0, 0x10, 0x9C, 0xDA, 0xC1, 0x6F, 0xA2, 0x86, 0x69, 0x04, 0x66, 0x04,
+        0x3C, 0xC0, 0x03, 0x3C, 0x3F, 0xC1, 0x38, 0x04, 0x09, 0x67, 0x57, 0x10, 0x0B, 0xC0, 0x47, 0xFE,
+        0x8C, 0x7C, 0xA3, 0x87, 0xFE, 0x4A, 0x7D, 0x9B, 0x7B, 0xFE, 0x9C, 0xFC, 0x9D, 0x87, 0xFE, 0x5A,
+        0xFB, 0x3D, 0xA4, 0x91, 0x62, 0x6F, 0x69, 0x65, 0x69, 0x06, 0x6D, 0x23, 0x69, 0x04, 0x37, 0x2B,
+        0x9D, 0x8B, 0xA2, 0x88, 0x9D, 0x8B, 0x62, 0x65, 0x69, 0x0D, 0x6E, 0xC4, 0x06, 0x56, 0xC2, 0x65,
+        0x62, 0x69, 0xC0, 0xA3, 0x88, 0x6B, 0xC0, 0x06, 0xC0, 0xA3, 0x88, 0xA8, 0x75, 0x34, 0xA3, 0x78,
+        0xA3, 0x88, 0x6E, 0xA2, 0x78, 0x6B, 0x65, 0x9A, 0xA9, 0x9C, 0x99, 0x52, 0xC1, 0x2D, 0xA3, 0x88,
+        0x17, 0xA4, 0x6A, 0xA0, 0x8A, 0x6B, 0x15, 0x9F, 0x94, 0x65, 0x06, 0x56, 0x2D, 0x21, 0x9A, 0xAC,
+        0x0E, 0xA2, 0x88, 0x2E, 0x6F, 0x2E, 0x29, 0x55, 0x0E, 0xC0, 0xA3, 0x86, 0x53, 0xA2, 0x79, 0xA4,
+        0x76, 0xC1, 0x66, 0x9C, 0x9A, 0x1A, 0x66, 0x56, 0x65, 0x56, 0x65, 0x5A, 0x66, 0xA9, 0x66, 0xA3,
+        0x79, 0xA1, 0x9A, 0x5A, 0x5A, 0x5A, 0xC3, 0x7B, 0x7A, 0xC0, 0x13, 0x10, 0xC1, 0x13, 0xC0, 0x1A,
+        0x1D, 0xC2, 0x7B, 0x13, 0xC0, 0x1A, 0x27, 0x13, 0xC0, 0x4A, 0x5A, 0x0D, 0x9C, 0xDA, 0xC0, 0x7B,
+        0x6E, 0xC1, 0xA2, 0x86, 0x0B, 0x3F, 0xC0, 0x5B, 0xC1, 0x3F, 0xC1, 0x69, 0x6F, 0xC0, 0x0B, 0x09,
+        0xC0, 0x9E, 0x8B, 0xA2, 0x86, 0xFE, 0xBD, 0xDD, 0xFE, 0x3A, 0x7D, 0x9D, 0xAA, 0xFE, 0x84, 0x5C,
+        0xFE, 0x3A, 0x3D, 0xFE, 0x8C, 0x9C, 0x9E, 0x86, 0xFE, 0x5A, 0xDB, 0xFE, 0xDE, 0x54, 0xA5, 0x95,
+        0xA0, 0x8A, 0x69, 0x79, 0x6E, 0x6E, 0xC0, 0xA2, 0x78, 0x23, 0xC0, 0x21, 0x99, 0xA9, 0x53, 0xA3,
+        0x88, 0xA4, 0x76, 0x99, 0xAD, 0x9D, 0x9A, 0x65, 0x12, 0xC6, 0x65, 0x56, 0xC2, 0x66, 0x61, 0x69,
+        0x6F, 0x6E, 0x3E, 0x7A, 0x06, 0x0D, 0x1F, 0xA5, 0x86, 0x9A, 0x9B, 0xC0, 0xA2, 0x87, 0x0F, 0xA5,
+        0x78, 0xA0, 0x8A, 0x34, 0x65, 0x65, 0x0F, 0x9D, 0xA9, 0x9C, 0x9A, 0x6D, 0x1C, 0xA3, 0x79, 0x07,
+        0xC0, 0xA0, 0x8A, 0xA0, 0x85, 0x39, 0x9B, 0xB7, 0x3A, 0x6F, 0xA3, 0x77, 0x6E, 0x99, 0xBE, 0x0E,
+        0x6F, 0x2E, 0x6F, 0x66, 0x2E, 0x65, 0x55, 0x0E, 0xC1, 0xA2, 0x79, 0x38, 0xA2, 0x77, 0x3B, 0x33,
+        0x29, 0x56, 0x65, 0x56, 0x65, 0x56, 0xC0, 0x2A, 0xA3, 0x77, 0xA6, 0x67, 0xA3, 0x89, 0x5B, 0x16,
+        0x5A, 0x5A, 0xC2, 0x5A, 0x10, 0x13, 0xC1, 0x10, 0xC0, 0x7B, 0xC1, 0x7A, 0x7B, 0xC0, 0x1D, 0xC1,
+        0x13, 0x1D, 0x1A, 0x24, 0x1A, 0x10, 0x0D, 0x5B, 0x0D, 0x9C, 0xDA, 0x7B, 0x6E, 0xC1, 0x6E, 0x7C,
+        0x0B, 0x69, 0x3C, 0x03, 0xC1, 0x7A, 0x69, 0xC1, 0x38, 0x3F, 0xC0, 0x04, 0xC0, 0x10, 0x56, 0xFE,
+        0x5A, 0xFD, 0xA7, 0x84, 0xAC, 0x82, 0x7D, 0x98, 0x7D, 0xFE, 0x3A, 0x3C, 0xAD, 0x90, 0xA3, 0xA7,
+        0x18, 0xA3, 0x87, 0xA1, 0x9A, 0x79, 0x69, 0x6F, 0x6E, 0x6E, 0xA1, 0x8A, 0x6F, 0x6E, 0x69, 0x60,
+        0x0F, 0x1C, 0xC0, 0x97, 0xAD, 0x51, 0x66, 0x69, 0xC0, 0xA2, 0x87, 0x0D, 0xC0, 0x06, 0xC1, 0x56,
+        0xC3, 0x32, 0x2D, 0x66, 0xC0, 0x2D, 0x32, 0x7F, 0xC0, 0x06, 0x7E, 0x20, 0x12, 0x7E, 0xA4, 0x87,
+        0xA3, 0x77, 0xA2, 0x87, 0xA2, 0x78, 0x17, 0x2C, 0x31, 0xA2, 0x87, 0xA2, 0x88, 0x17, 0x6D, 0xA2,
+        0x78, 0xA1, 0x8B, 0x07, 0x00, 0xA0, 0x8A, 0x07, 0x68, 0x26, 0x17, 0x9C, 0x99, 0x31, 0xA3, 0x87,
+        0x9C, 0x9B, 0x6B, 0xA2, 0x88, 0x29, 0x6E, 0xC0, 0x29, 0x65, 0x0E, 0xC2, 0x6F, 0x2E, 0x38, 0xC0,
+        0x2E, 0x29, 0x21, 0x65, 0x56, 0x69, 0x66, 0x56, 0x59, 0xA3, 0x77, 0xA5, 0x78, 0xA3, 0x78, 0x6B,
+        0xA0, 0x9A, 0x5A, 0xC0, 0x16, 0x4A, 0x5B, 0xC0, 0x10, 0xC0, 0x13, 0x10, 0xC1, 0xA0, 0xA9, 0xC0,
+        0x27, 0xC1, 0x7B, 0x27, 0x1D, 0x5A, 0xC0, 0x27, 0x24, 0x1A, 0xC0, 0x49, 0xC0, 0x10, 0x0D, 0x0C,
+        0x11, 0xC2, 0xA2, 0x85, 0x69, 0x10, 0x65, 0x3F, 0x5A, 0xC1, 0x3F, 0xC3, 0x38, 0xC1, 0x3F, 0x6F,
+        0x95, 0x8E, 0xFE, 0x84, 0x3C, 0xAA, 0x82, 0x6B, 0x13, 0xC0, 0xFE, 0x52, 0xBC, 0x98, 0x7C, 0xFE,
+        0x9C, 0x78, 0xFE, 0xD5, 0xF1, 0xA6, 0x86, 0x61, 0xA2, 0x77, 0x37, 0x7B, 0x6E, 0xC0, 0x6E, 0xA2,
+        0x79, 0xC0, 0x68, 0x60, 0x9D, 0x9B, 0xA6, 0x68, 0x51, 0x97, 0xBC, 0x18, 0x9D, 0x9A, 0xC0, 0x20,
+        0x41, 0x9D, 0x9B, 0xC0, 0x7A, 0x3E, 0x79, 0x3E, 0xC3, 0x65, 0x2D, 0x65, 0x5A, 0x7B, 0x2D, 0x32,
+        0x6B, 0x01, 0xC0, 0x06, 0xC0, 0x1A, 0x6E, 0x61, 0x0F, 0x9C, 0xA9, 0x5A, 0x62, 0x06, 0x6B, 0x7E,
+        0x18, 0x03, 0xA6, 0x68, 0x07, 0x39, 0xC0, 0x07, 0x6B, 0x39, 0x9C, 0xA7, 0x98, 0xAB, 0x15, 0x1A,
+        0x27, 0x67, 0x6E, 0x6F, 0xA2, 0x89, 0xA2, 0x77, 0x7B, 0x1F, 0x66, 0x65, 0x65, 0xC1, 0x0E, 0x7F,
+        0xA2, 0x78, 0xC0, 0x29, 0x56, 0xC0, 0x15, 0x56, 0x65, 0xC0, 0xA3, 0x77, 0xA2, 0x78, 0x9D, 0x89,
+        0x51, 0xA5, 0x77, 0xA4, 0x78, 0x77, 0xA2, 0x59, 0x7A, 0xC0, 0x10, 0x5B, 0x69, 0x10, 0xC3, 0xA0,
+        0xA9, 0x5A, 0x1D, 0xA0, 0xAA, 0x59, 0x1D, 0xC0, 0x1A, 0xC0, 0x10, 0xC0, 0x1D, 0x27, 0x1A, 0x0D,
+        0xC1, 0x10, 0xC0, 0x11, 0xC4, 0xA2, 0x86, 0xC0, 0x69, 0x3F, 0x04, 0x3F, 0xC6, 0x38, 0x3F, 0xC0,
+        0x3C, 0xFE, 0xAD, 0x3C, 0x98, 0x7D, 0xAA, 0x81, 0xC2, 0x96, 0x8C, 0xFE, 0x19, 0x1C, 0xFE, 0xA4,
+        0xB5, 0x30, 0xA4, 0x86, 0x51, 0xA4, 0x97, 0x56, 0xA2, 0x88, 0x7E, 0x6E, 0x6E, 0xA2, 0x79, 0xC0,
+        0x9D, 0x98, 0x10, 0xA2, 0x78, 0xA1, 0x8B, 0x1C, 0x9B, 0xAA, 0x69, 0x99, 0x9B, 0xA4, 0x87, 0x6D,
+        0x99, 0x9C, 0xC1, 0x2D, 0x32, 0x3F, 0x2D, 0x6F, 0xC2, 0x2D, 0x28, 0x59, 0x66, 0x1E, 0x6B, 0x2D,
+        0xC0, 0x32, 0xC1, 0x39, 0x7E, 0xC0, 0x06, 0xA8, 0x75, 0x9A, 0x9A, 0x06, 0x13, 0x9D, 0x99, 0x01,
+        0x06, 0x20, 0xA6, 0x75, 0x21, 0xA2, 0x79, 0x66, 0xC0, 0x00, 0xC0, 0x68, 0x9D, 0xA8, 0x99, 0xAB,
+        0x9C, 0x9A, 0xC0, 0x6B, 0xC0, 0x6F, 0x7E, 0xA2, 0x79, 0xA2, 0x88, 0x6E, 0xC0, 0x15, 0x65, 0x55,
+        0xC2, 0xA2, 0x88, 0xA1, 0x8A, 0x6E, 0xC0, 0x21, 0x1A, 0x15, 0x56, 0x69, 0x6E, 0x6E, 0x51, 0x2F,
+        0xA2, 0x77, 0x51, 0xA7, 0x68, 0xA4, 0x79, 0x5B, 0xC1, 0x7A, 0x4A, 0xC1, 0x10, 0xC2, 0x1D, 0xC1,
+        0x31, 0xC2, 0x24, 0x10, 0xC1, 0x7B, 0xC0, 0x13, 0x0D, 0x10, 0x0D, 0xC0, 0x13, 0x11, 0xC4, 0x17,
+        0xC0, 0x69, 0x65, 0x10, 0x04, 0xC0, 0x65, 0x6B, 0xC6, 0x38, 0xFE, 0x9C, 0xBC, 0x95, 0x7F, 0xFE,
+        0xAD, 0x7B, 0xC1, 0x52, 0x98, 0x8A, 0xFE, 0x4A, 0x5C, 0xFE, 0xB5, 0x52, 0xA6, 0x94, 0x9B, 0xAA,
+        0xA5, 0x86, 0xA4, 0x87, 0xC0, 0xA2, 0x88, 0x9D, 0x98, 0xA4, 0x77, 0x33, 0x24, 0xA3, 0x8A, 0xC0,
+        0xA3, 0x79, 0xA0, 0x8C, 0x6D, 0x34, 0x9B, 0xA7, 0x62, 0x55, 0xA2, 0x98, 0x98, 0x8B, 0x9C, 0x9A,
+        0x2D, 0x6E, 0x52, 0x3F, 0x66, 0x42, 0xC0, 0x7F, 0xC1, 0x25, 0x1E, 0x19, 0xC2, 0x25, 0xC0, 0x28,
+        0x2D, 0xC1, 0x39, 0xC0, 0x3A, 0xA6, 0x76, 0x99, 0xAB, 0x32, 0xC2, 0xA3, 0x87, 0xA3, 0x97, 0x12,
+        0xA7, 0x78, 0x3E, 0x03, 0x37, 0xA1, 0x8A, 0xA3, 0x88, 0x9F, 0x96, 0x9D, 0x98, 0x9D, 0xAB, 0x9C,
+        0x8A, 0x57, 0xC0, 0x6B, 0x7E, 0x6E, 0xA2, 0x89, 0xA2, 0x78, 0x7F, 0xC0, 0x65, 0x55, 0x35, 0x69,
+        0xC1, 0x3A, 0x15, 0x1F, 0x6B, 0x66, 0x15, 0xC1, 0x06, 0x56, 0x6D, 0xA2, 0x77, 0xA2, 0x78, 0xA2,
+        0x67, 0xC0, 0xA2, 0x78, 0xA1, 0x8B, 0xA0, 0x8A, 0x69, 0xC1, 0x14, 0x69, 0x10, 0x0D, 0xC1, 0xA0,
+        0xA8, 0x1D, 0x7A, 0x27, 0xC0, 0x7B, 0xC0, 0x27, 0x5A, 0x59, 0x17, 0x1A, 0x27, 0x24, 0x10, 0x1A,
+        0x10, 0x0D, 0x5B, 0x0D, 0x9D, 0xEB, 0x6E, 0xC0, 0x69, 0x11, 0x7D, 0x6E, 0x6B, 0x68, 0xC2, 0x65,
+        0xC1, 0x66, 0xC0, 0x6B, 0xC2, 0x3F, 0x5A, 0xFE, 0x94, 0x9C, 0xFE, 0x21, 0xFC, 0xFE, 0x8C, 0xBC,
+        0xA6, 0x94, 0xC0, 0x9A, 0x8A, 0xFE, 0x52, 0xDC, 0xA7, 0xB1, 0xFE, 0xC5, 0x71, 0x51, 0x69, 0x7F,
+        0xA7, 0x85, 0xA4, 0x98, 0x6E, 0x9D, 0x99, 0x51, 0xA3, 0x88, 0x7E, 0x33, 0x37, 0xA5, 0x79, 0x04,
+        0x6E, 0x68, 0x28, 0x1C, 0x65, 0x9D, 0x98, 0x9A, 0x9B, 0x9C, 0x99, 0x56, 0xA3, 0x88, 0x51, 0xA5,
+        0x87, 0x26, 0x57, 0x2A, 0x2D, 0x6B, 0x2D, 0x25, 0x65, 0x66, 0x19, 0xC2, 0x25, 0xC2, 0x7A, 0x2D,
+        0xC0, 0xA2, 0x77, 0x07, 0x26, 0x2D, 0xC2, 0x6F, 0x79, 0x3F, 0xA7, 0x86, 0x98, 0x9B, 0x18, 0x32,
+        0x9B, 0x9B, 0xA3, 0x87, 0x03, 0x07, 0x3A, 0x35, 0x3A, 0x6B, 0xC0, 0x6E, 0x7F, 0x6F, 0xA3, 0x88,
+        0x6F, 0x6F, 0x75, 0x56, 0x65, 0x65, 0xC0, 0x5A, 0x29, 0x06, 0xA4, 0x77, 0x1F, 0x62, 0xC0, 0x66,
+        0x1F, 0x06, 0x52, 0x06, 0x5A, 0x51, 0xC0, 0xA3, 0x67, 0xA2, 0x77, 0xA6, 0x69, 0xA0, 0x8A, 0xC1,
+        0x5A, 0x6B, 0xC0, 0x10, 0x0D, 0xC1, 0x10, 0x7B, 0x27, 0x31, 0xC2, 0x27, 0xC0, 0x1D, 0x1A, 0xC0,
+        0x7B, 0x1D, 0x24, 0x1D, 0x0D, 0xC1, 0x10, 0x17, 0x6E, 0x65, 0x17, 0x0F, 0x7A, 0x5B, 0x66, 0x10,
+        0x17, 0x52, 0x12, 0x6C, 0x04, 0xC0, 0x66, 0x5B, 0xC0, 0x7A, 0xC0, 0x3F, 0x06, 0xC0, 0xFE, 0x94,
+        0xBC, 0xFE, 0x22, 0x5B, 0x9D, 0x9B, 0xA7, 0xB5, 0xA4, 0x96, 0x96, 0x8C, 0x63, 0xFE, 0xAC, 0xD3,
+        0xA1, 0x95, 0x65, 0xA3, 0x87, 0x7F, 0xA3, 0x97, 0xA7, 0x86, 0xC0, 0x66, 0x52, 0x51, 0xA3, 0x88,
+        0xA8, 0x76, 0xA2, 0x79, 0x6F, 0xA0, 0x8B, 0x6D, 0x69, 0xC1, 0x69, 0x9C, 0xA6, 0x56, 0x62, 0x9C,
+        0x89, 0x6B, 0x7E, 0x07, 0x9C, 0x89, 0x6F, 0xC0, 0x67, 0xC0, 0x69, 0x51, 0xC0, 0x66, 0x19, 0xC1,
+        0x6E, 0x6B, 0xC2, 0x7A, 0x2D, 0xC0, 0x32, 0x69, 0x26, 0xC0, 0x2D, 0xC1, 0x32, 0xC0, 0xA3, 0x87,
+        0xA3, 0x97, 0x2D, 0x37, 0x11, 0x9C, 0x9B, 0x6E, 0xA8, 0x75, 0x98, 0x9A, 0x62, 0xC2, 0x01, 0x06,
+        0xC0, 0x21, 0xA2, 0x88, 0xA2, 0x78, 0x6F, 0x06, 0x66, 0x35, 0x65, 0xC0, 0x5A, 0xC0, 0xA3, 0x88,
+        0xA6, 0x76, 0x9D, 0x9B, 0x67, 0x69, 0x15, 0xA5, 0x65, 0x62, 0x01, 0x5A, 0xA5, 0x76, 0x9D, 0x9A,
+        0x9C, 0x99, 0xA8, 0x45, 0x55, 0xA3, 0x88, 0xA2, 0x7A, 0xA0, 0x7A, 0xC3, 0x7A, 0x0D, 0x6B, 0xC0,
+        0x0D, 0x10, 0x7B, 0x24, 0x7A, 0x31, 0xC1, 0x48, 0x1A, 0x10, 0x1A, 0xC0, 0x69, 0x1A, 0x10, 0xC1,
+        0x6B, 0x10, 0xA0, 0xC8, 0x65, 0xC0, 0x0F, 0x67, 0xC2, 0x69, 0x16, 0x7D, 0x10, 0x09, 0x66, 0x38,
+        0x6B, 0x3C, 0x03, 0x3C, 0xC0, 0x3F, 0xC1, 0xFE, 0xAD, 0x5C, 0xFE, 0x1A, 0x3B, 0x6E, 0x69, 0x62,
+        0x9A, 0xBC, 0xFE, 0x94, 0x56, 0xA4, 0x91, 0x65, 0x6E, 0x7E, 0x7E, 0xA9, 0x85, 0x2E, 0xA2, 0x77,
+        0x9B, 0x9A, 0x38, 0xA3, 0x97, 0x00, 0xA5, 0x87, 0xA6, 0x67, 0xA1, 0x8A, 0xA0, 0x8A, 0x3B, 0x69,
+        0x3B, 0x34, 0xC0, 0x64, 0x15, 0x66, 0x26, 0xA2, 0x78, 0x7F, 0x9B, 0x99, 0x07, 0x56, 0x56, 0x67,
+        0x66, 0x69, 0x51, 0xC2, 0x1E, 0x25, 0x7A, 0x2D, 0xC3, 0x39, 0xC0, 0x32, 0x2D, 0xC3, 0x32, 0x39,
+        0xC0, 0x0C, 0x9D, 0x9A, 0x2D, 0x39, 0x7E, 0x39, 0x6E, 0xA4, 0x85, 0x3F, 0x2D, 0xC0, 0x7E, 0xC0,
+        0x01, 0xC0, 0x6E, 0x7F, 0xA2, 0x89, 0xA3, 0x78, 0x7F, 0xC0, 0x65, 0x55, 0x65, 0x69, 0x6E, 0x29,
+        0xA5, 0x77, 0xA6, 0x56, 0x9C, 0xAB, 0x63, 0x24, 0x62, 0xA4, 0x66, 0xA3, 0x67, 0x9C, 0xAA, 0x9C,
+        0xA9, 0xA4, 0x66, 0xA2, 0x68, 0x9C, 0xA8, 0xA5, 0x68, 0x59, 0x5B, 0x6B, 0x7B, 0xA1, 0x8A, 0xC0,
+        0x13, 0x10, 0x1D, 0x10, 0x5A, 0xC0, 0x10, 0x7B, 0xC1, 0x1D, 0x7B, 0x7B, 0x27, 0x13, 0xC0, 0x10,
+        0xC0, 0x1D, 0x1A, 0x7B, 0x1A, 0x13, 0xC0, 0x1D, 0x10, 0x1C, 0xC0, 0x17, 0x0A, 0x6B, 0xC0, 0x66,
+        0xC0, 0x11, 0xC0, 0x6D, 0x17, 0x69, 0x66, 0x04, 0xC0, 0x3C, 0xC2, 0x7A, 0xC1, 0x97, 0x8E, 0x18,
+        0x20, 0xC0, 0x9A, 0xBA, 0xFE, 0x83, 0xF8, 0xFE, 0xB4, 0xF1, 0x55, 0x66, 0x7E, 0x6E, 0xA5, 0x96,
+        0xA3, 0x97, 0x9B, 0x8B, 0x2B, 0x12, 0x19, 0xA4, 0x86, 0x38, 0xA4, 0x87, 0xA7, 0x78, 0xA2, 0x79,
+        0x69, 0x6E, 0xC0, 0xA0, 0x8A, 0x6B, 0x68, 0x2D, 0x9D, 0xA7, 0x6B, 0x66, 0x10, 0x17, 0x9B, 0xA9,
+        0x55, 0xA3, 0x87, 0x19, 0x39, 0xC0, 0x37, 0x9D, 0x99, 0x66, 0x1E, 0x7F, 0xC2, 0x6E, 0xC2, 0x39,
+        0xA2, 0x87, 0xC0, 0x39, 0x32, 0xC4, 0x01, 0xC0, 0x6D, 0x2D, 0xC0, 0x39, 0x01, 0x3E, 0xC0, 0x79,
+        0x3F, 0x2D, 0xC0, 0x32, 0x7A, 0x01, 0xC0, 0x6F, 0x7E, 0xA2, 0x89, 0xA3, 0x78, 0x7F, 0xC1, 0x65,
+        0x51, 0x69, 0xA5, 0x77, 0x9D, 0x99, 0xA5, 0x77, 0xA3, 0x78, 0x67, 0x9D, 0xAA, 0xA3, 0x78, 0x61,
+        0xC0, 0xA4, 0x57, 0xC0, 0x61, 0x65, 0xA3, 0x69, 0x66, 0x5F, 0x69, 0x55, 0x9A, 0xB9, 0xA3, 0x89,
+        0x3D, 0x13, 0x1D, 0x49, 0x13, 0x1D, 0x10, 0x1A, 0xC0, 0x27, 0x7B, 0xC0, 0x27, 0xC2, 0x1A, 0x10,
+        0x5A, 0x10, 0xC1, 0x1A, 0xC0, 0x13, 0x1D, 0x27, 0x1D, 0x1C, 0x67, 0x52, 0xC1, 0x0C, 0xC0, 0x11,
+        0xC0, 0x7D, 0x6E, 0xC0, 0x69, 0x66, 0x10, 0x04, 0xC0, 0x56, 0x03, 0x3C, 0x7A, 0xC1, 0x3C, 0xFE,
+        0xB5, 0xBC, 0xFE, 0x3A, 0x5C, 0x9B, 0x8B, 0xFE, 0x94, 0x59, 0xFE, 0xB5, 0x32, 0x78, 0x9D, 0x9A,
+        0x5A, 0x30, 0xA2, 0x87, 0xA5, 0x96, 0x0A, 0xC0, 0x19, 0xC1, 0xA2, 0x87, 0xA2, 0x88, 0xA8, 0x76,
+        0xA3, 0x88, 0x2F, 0x6D, 0x2F, 0x34, 0x6B, 0x6B, 0x28, 0x69, 0x61, 0xC0, 0x2D, 0xC0, 0x10, 0x6B,
+        0xC0, 0x9D, 0x99, 0x6E, 0x99, 0x9B, 0x9D, 0x9A, 0xA4, 0x85, 0x99, 0xAC, 0x59, 0xA3, 0x97, 0x05,
+        0x07, 0x32, 0x6B, 0x7E, 0xC3, 0xA4, 0x76, 0xC0, 0x01, 0xC4, 0x6E, 0xC0, 0x6B, 0x01, 0x51, 0x32,
+        0x06, 0xC0, 0x67, 0x01, 0xC0, 0x65, 0x2D, 0xC0, 0x32, 0x35, 0x01, 0x06, 0x7F, 0x6F, 0x7F, 0xA3,
+        0x78, 0xA2, 0x88, 0xC0, 0xA2, 0x86, 0xC0, 0x51, 0x62, 0xA2, 0x76, 0xA4, 0x67, 0xA2, 0x78, 0x6E,
+        0xA0, 0x7A, 0x9D, 0xC9, 0x5F, 0xA2, 0x77, 0x61, 0x01, 0x6B, 0x5A, 0xC0, 0x5A, 0x6B, 0xC0, 0x02,
+        0x9F, 0x86, 0x9B, 0xAA, 0xA2, 0x88, 0x7F, 0xA3, 0x8A, 0x9E, 0xBA, 0xA2, 0x67, 0x1D, 0x7B, 0x13,
+        0x27, 0xC0, 0x5A, 0xA0, 0xA9, 0xC1, 0x24, 0x59, 0xC0, 0x5A, 0x59, 0xC1, 0x7A, 0x0D, 0xC0, 0x10,
+        0xC0, 0x1D, 0x7A, 0x1D, 0x9F, 0xB8, 0x57, 0x66, 0xC1, 0x66, 0x6D, 0xC0, 0x0F, 0xC1, 0x7D, 0xC0,
+        0x17, 0x10, 0x65, 0xC1, 0x3C, 0xC4, 0x7D, 0x50, 0x9B, 0xAA, 0x18, 0x99, 0x8A, 0x79, 0x9B, 0x8A,
+        0x67, 0xA2, 0x87, 0xA2, 0x87, 0x7E, 0x53, 0x6E, 0xC0, 0x19, 0x1E, 0x28, 0xA5, 0x87, 0x38, 0xA4,
+        0x86, 0xA3, 0x77, 0xC0, 0x6B, 0x6E, 0xC0, 0x34, 0x9F, 0x96, 0x6F, 0x21, 0xC0, 0x3B, 0xA1, 0x8A,
+        0xA0, 0x85, 0x9B, 0xA8, 0x9B, 0xA9, 0x9D, 0x8B, 0xA4, 0x87, 0xA5, 0x77, 0x99, 0xAA, 0xA3, 0x87,
+        0x99, 0xAB, 0x1E, 0x6F, 0x9B, 0x9A, 0x1E, 0x9A, 0x9C, 0xC0, 0x6F, 0xC2, 0x6E, 0xA8, 0x75, 0x9C,
+        0x99, 0x9B, 0x9A, 0xC5, 0x12, 0x6E, 0x06, 0x32, 0x3F, 0x18, 0x06, 0x0D, 0xC0, 0x01, 0x56, 0x32,
+        0xC0, 0x35, 0x6E, 0x01, 0x06, 0x15, 0x6F, 0xA2, 0x88, 0xA2, 0x78, 0xA2, 0x88, 0x6F, 0x79, 0xA3,
+        0x77, 0x6E, 0x34, 0x5A, 0x6F, 0x6B, 0x59, 0xA0, 0x8A, 0x9D, 0xB8, 0xA2, 0x78, 0x08, 0xC0, 0x05,
+        0xC0, 0x6B, 0x5B, 0xC0, 0x09, 0xC1, 0x68, 0x9D, 0x97, 0x9A, 0xAB, 0x72, 0xA9, 0x58, 0x9E, 0xBA,
+        0xA3, 0x88, 0x5F, 0x27, 0x13, 0x27, 0x7B, 0x69, 0xC0, 0x31, 0xC0, 0x27, 0x1D, 0x5A, 0x10, 0x5A,
+        0x5B, 0x0D, 0x10, 0x0D, 0x10, 0x13, 0x10, 0x1D, 0x69, 0x1D, 0x1C, 0x66, 0xC0, 0x0F, 0x66, 0xC0,
+        0x6B, 0x0A, 0xC0, 0x11, 0xC0, 0x7D, 0x0F, 0x17, 0x69, 0x0B, 0x69, 0x66, 0x3C, 0x69, 0x3C, 0x6B,
+        0xC0, 0x3C, 0x7D, 0x9E, 0x96, 0x9D, 0x98, 0x9D, 0x99, 0x50, 0x9B, 0x9A, 0x1F, 0x24, 0xC0, 0x9D,
+        0x9A, 0x52, 0x6E, 0x6B, 0x19, 0x6E, 0x6B, 0x32, 0xA6, 0x87, 0xA3, 0x89, 0x69, 0xA2, 0x87, 0x6D,
+        0xA2, 0x77, 0x2D, 0xC2, 0x34, 0x2D, 0xC0, 0xA1, 0x8B, 0xA0, 0x8A, 0x9F, 0x96, 0x9E, 0x96, 0x65,
+        0x2F, 0x9B, 0xAB, 0xA9, 0x66, 0x28, 0x55, 0x10, 0x9C, 0x9A, 0x99, 0x9A, 0x66, 0xAA, 0x65, 0x98,
+        0xAB, 0x56, 0x6E, 0x6B, 0x18, 0x63, 0x6E, 0x28, 0x99, 0xAB, 0x12, 0x0B, 0xC0, 0x12, 0x13, 0x15,
+        0x0B, 0x12, 0xA2, 0x87, 0x1A, 0x01, 0xA4, 0x86, 0x6E, 0x9C, 0x8B, 0xC2, 0x01, 0x32, 0x7A, 0xC0,
+        0x3A, 0x01, 0x06, 0x15, 0x21, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x78, 0x7F, 0xC0, 0x22, 0x6D, 0x59,
+        0xA3, 0x78, 0xA2, 0x79, 0x08, 0xC0, 0x6B, 0x08, 0x0F, 0xC0, 0x0C, 0xC1, 0x5A, 0xA0, 0x8A, 0x69,
+        0x09, 0x69, 0xC0, 0x69, 0x50, 0x98, 0xBA, 0xA2, 0x79, 0xA7, 0x77, 0x73, 0xA1, 0xAA, 0xA2, 0x78,
+        0x6B, 0x1D, 0x27, 0xC0, 0x31, 0xC0, 0x27, 0xC0, 0x5A, 0x27, 0x49, 0x10, 0x5A, 0x5B, 0x69, 0x0D,
+        0x10, 0x7A, 0x10, 0x0D, 0x13, 0xC1, 0xA0, 0xB7, 0x6B, 0xC0, 0x66, 0xC1, 0x0F, 0x66, 0x6B, 0xC3,
+        0x17, 0x69, 0xC0, 0x65, 0x66, 0x5E, 0x3C, 0xC1, 0x6B, 0x3F, 0x69, 0x68, 0x9D, 0x98, 0x39, 0x65,
+        0x9D, 0x98, 0x9C, 0x89, 0x9C, 0x89, 0x05, 0x6E, 0x7A, 0x6E, 0x0D, 0xA2, 0x88, 0xA2, 0x87, 0x6B,
+        0x06, 0xA5, 0x88, 0x57, 0xC0, 0x33, 0x2D, 0xA5, 0x77, 0xA3, 0x77, 0xA0, 0x8A, 0xC0, 0xA0, 0x8A,
+        0x6B, 0x6B, 0x3B, 0x6E, 0xC0, 0x3B, 0x9F, 0x95, 0x61, 0xA2, 0x79, 0x28, 0x2D, 0x07, 0x00, 0x9B,
+        0xB7, 0x9A, 0x89, 0x62, 0x66, 0xAA, 0x66, 0x1B, 0x56, 0xA3, 0x87, 0x9C, 0x9B, 0xA4, 0x76, 0xA2,
+        0x77, 0x66, 0x3B, 0x2C, 0x9D, 0x9A, 0x18, 0x52, 0x6B, 0x13, 0xA2, 0x88, 0x2C, 0x52, 0x6B, 0x2C,
+        0x13, 0xA4, 0x86, 0x18, 0x06, 0xA2, 0x77, 0xC0, 0x63, 0x65, 0x35, 0xC0, 0x3A, 0xC0, 0x01, 0x06,
+        0x15, 0xA2, 0x87, 0xA0, 0x8A, 0xA3, 0x77, 0xA2, 0x89, 0xA4, 0x76, 0x63, 0x29, 0x31, 0x6D, 0xA2,
+        0x67, 0x6B, 0x5B, 0xA0, 0x8A, 0x6B, 0x59, 0x0F, 0x0C, 0x6B, 0x0C, 0x69, 0x5B, 0xC1, 0x69, 0x79,
+        0x5A, 0x09, 0x58, 0x9C, 0x98, 0x9B, 0xBA, 0x7A, 0xA0, 0x9A, 0xA2, 0x9A, 0xA5, 0x78, 0xA2, 0x88,
+        0x1D, 0x7B, 0x24, 0x27, 0xC0, 0x24, 0x1D, 0xC0, 0x27, 0x1D, 0x49, 0x5A, 0x5A, 0x6B, 0x0D, 0xC0,
+        0x10, 0xC0, 0x0D, 0x10, 0xC1, 0x1C, 0x66, 0xC1, 0x69, 0x6E, 0xC0, 0x17, 0x56, 0x66, 0xC0, 0x6B,
+        0x0F, 0x17, 0xC0, 0x10, 0x04, 0x10, 0xC0, 0x04, 0x66, 0x3C, 0xC0, 0x3F, 0x31, 0x64, 0x9D, 0x99,
+        0x61, 0x25, 0x60, 0x9D, 0x89, 0x9C, 0x99, 0x5B, 0x7E, 0xA3, 0x86, 0x1F, 0x6B, 0xC0, 0xA7, 0x85,
+        0x9D, 0x9B, 0x6F, 0xA1, 0x8B, 0x32, 0x2D, 0x68, 0xA3, 0x96, 0xA3, 0x78, 0x9D, 0x99, 0x03, 0x61,
+        0x21, 0xA1, 0x8B, 0x69, 0x9E, 0x96, 0x21, 0x6F, 0xA1, 0x8B, 0x00, 0x2D, 0xC0, 0x00, 0x69, 0x07,
+        0x00, 0x9D, 0xA7, 0x15, 0x69, 0x9A, 0x9A, 0x1C, 0x03, 0x6E, 0x9A, 0xAA, 0x9D, 0x9A, 0x18, 0x19,
+        0x1C, 0x00, 0x9A, 0xA8, 0x6E, 0x20, 0x0B, 0xC1, 0x0E, 0xA4, 0x77, 0x05, 0x66, 0x05, 0x69, 0x20,
+        0xC0, 0x1F, 0x20, 0x5A, 0x9C, 0x9B, 0x65, 0x6D, 0x3A, 0x3F, 0xA3, 0x87, 0x9D, 0xAA, 0x06, 0x7F,
+        0xA4, 0x86, 0x57, 0x00, 0xA5, 0x68, 0x7F, 0x29, 0x6D, 0xA4, 0x55, 0x6E, 0x3D, 0xA0, 0x7A, 0xC0,
+        0xA0, 0x7A, 0xC1, 0x0C, 0xC0, 0x13, 0x0C, 0x09, 0x69, 0x79, 0xC0, 0x02, 0x69, 0x02, 0x5A, 0x38,
+        0x9A, 0xA9, 0x98, 0xBA, 0x76, 0xA2, 0x89, 0xA4, 0x89, 0xA5, 0x88, 0xA4, 0x78, 0x5A, 0xC1, 0x24,
+        0x59, 0x13, 0x5A, 0x1A, 0xC0, 0x10, 0xC0, 0x5A, 0xC0, 0x5B, 0x0D, 0xC0, 0x10, 0xC0, 0x0D, 0x10,
+        0xC1, 0xA0, 0xC8, 0xC1, 0x66, 0x69, 0xC0, 0x69, 0xC0, 0x10, 0x57, 0x66, 0x6B, 0xC1, 0x7D, 0x10,
+        0x17, 0xC0, 0x10, 0x04, 0xC1, 0x5A, 0x75, 0x68, 0x60, 0x00, 0x9E, 0x86, 0x61, 0x9C, 0x88, 0xA4,
+        0x87, 0x9C, 0x8A, 0xA2, 0x87, 0xA5, 0x87, 0x39, 0x57, 0x9D, 0x99, 0xA2, 0x88, 0xA7, 0x86, 0x20,
+        0x43, 0xA4, 0x88, 0x52, 0x61, 0x68, 0xA4, 0x86, 0x9B, 0x9B, 0x56, 0x1B, 0xA2, 0x77, 0xA5, 0x86,
+        0xA3, 0x79, 0x61, 0x66, 0xA3, 0x77, 0x28, 0x07, 0x6B, 0x34, 0x28, 0x07, 0xC0, 0x69, 0x69, 0x34,
+        0x9A, 0xA7, 0x1E, 0x10, 0x34, 0x39, 0x1A, 0x66, 0xA0, 0x8A, 0xC0, 0x28, 0x0E, 0x6B, 0x34, 0x98,
+        0xA9, 0x9B, 0x9A, 0x06, 0xC0, 0xA3, 0x87, 0x0B, 0x06, 0xA3, 0x88, 0xA6, 0x77, 0x23, 0x65, 0x2D,
+        0xC0, 0x25, 0x31, 0x66, 0x06, 0xC0, 0xA3, 0x85, 0x7F, 0x9D, 0x99, 0xA7, 0x75, 0x6B, 0x13, 0x66,
+        0x03, 0x2C, 0xA4, 0x77, 0xA6, 0x68, 0x2A, 0x9D, 0xAB, 0x2A, 0xA2, 0x67, 0x3D, 0x60, 0xA2, 0x6A,
+        0x08, 0x6B, 0x0C, 0x3E, 0x0C, 0x08, 0x0C, 0x5A, 0xC0, 0x3E, 0x3B, 0x3E, 0x65, 0xC0, 0x65, 0xA2,
+        0x68, 0x67, 0x97, 0xCA, 0x9D, 0x99, 0x52, 0x7B, 0xA4, 0x88, 0xA6, 0x78, 0xA4, 0x78, 0x27, 0x59,
+        0xC2, 0x59, 0x5A, 0xC3, 0x5A, 0xC3, 0x10, 0xC0, 0x0D, 0xC0, 0x6B, 0x0D, 0x9F, 0xE9, 0xC0, 0x6D,
+        0xC0, 0x1C, 0xC1, 0x65, 0xC0, 0x67, 0x57, 0xC2, 0x17, 0xC0, 0x56, 0x17, 0xC0, 0x10, 0x65, 0xC0,
+        0x69, 0x65, 0x64, 0x9D, 0x98, 0x66, 0x60, 0xC0, 0x9D, 0x98, 0xA2, 0x88, 0x6E, 0x37, 0x65, 0x9C,
+        0x99, 0x9D, 0x89, 0x7F, 0xC0, 0x19, 0x39, 0x53, 0xA3, 0x88, 0x9A, 0x9B, 0x64, 0xA2, 0x76, 0x65,
+        0x3A, 0x6B, 0xA2, 0x76, 0xA2, 0x97, 0x9D, 0x9B, 0x03, 0xA3, 0x88, 0x61, 0xA2, 0x77, 0x61, 0xA4,
+        0x6B, 0x07, 0x69, 0x07, 0xC0, 0xA0, 0x8A, 0xC0, 0xA0, 0x84, 0x64, 0x1C, 0xC0, 0x6F, 0xA2, 0x7B,
+        0xC0, 0x00, 0x28, 0x69, 0xC0, 0x07, 0xA0, 0x8C, 0xC0, 0x07, 0x28, 0x0A, 0x9C, 0x98, 0x0C, 0x25,
+        0x0C, 0x6B, 0x2C, 0xA2, 0x88, 0x1E, 0x65, 0x3E, 0x2D, 0x6F, 0xC0, 0x0A, 0x9B, 0xAA, 0x20, 0x9D,
+        0x89, 0xA5, 0x86, 0x66, 0x19, 0x26, 0x1C, 0x9A, 0x99, 0xA5, 0x87, 0xC0, 0xA3, 0x6A, 0x7E, 0x65,
+        0x31, 0x6F, 0xC0, 0x08, 0xC0, 0x6B, 0xA0, 0x7A, 0xC0, 0x68, 0x68, 0x6B, 0x5B, 0xC0, 0x6B, 0x02,
+        0x3E, 0x02, 0x05, 0x9D, 0xA8, 0x65, 0x6E, 0x9D, 0x99, 0xA3, 0x79, 0x9A, 0xA9, 0x97, 0xCC, 0x55,
+        0xA2, 0x78, 0xA4, 0x88, 0xA5, 0x89, 0xA5, 0x88, 0xA3, 0x79, 0x59, 0x1A, 0x1D, 0x1A, 0x10, 0xC1,
+        0x5A, 0xC3, 0x10, 0x0D, 0x10, 0x0D, 0xC0, 0x6B, 0x0D, 0x10, 0x7A, 0xA0, 0xB8, 0x52, 0x1C, 0x0A,
+        0xC0, 0x7E, 0x17, 0x69, 0x0F, 0x0A, 0xC0, 0x11, 0xC0, 0x0A, 0x17, 0xC1, 0x10, 0xC0, 0x66, 0x69,
+        0xC0, 0x66, 0xA1, 0x85, 0x9C, 0x98, 0x9D, 0xA8, 0x1E, 0x19, 0x2D, 0x7F, 0x6E, 0xC0, 0x69, 0x50,
+        0x62, 0x5A, 0xA2, 0x88, 0x1F, 0x2B, 0xA4, 0x79, 0x6B, 0x9D, 0x99, 0x00, 0x69, 0x19, 0x9C, 0x8A,
+        0x52, 0xC3, 0x23, 0xA3, 0x88, 0x7F, 0x6E, 0xA2, 0x79, 0x69, 0x07, 0x68, 0x69, 0x07, 0x1C, 0x69,
+        0xA0, 0x85, 0x9F, 0x96, 0x65, 0x2B, 0x3C, 0xA5, 0x79, 0x00, 0x2D, 0x61, 0x0B, 0x1C, 0x00, 0x15,
+        0x07, 0x28, 0x9B, 0xA9, 0xC0, 0x37, 0x61, 0x3C, 0x20, 0x9D, 0x89, 0x20, 0xA2, 0x78, 0x05, 0x61,
+        0x55, 0x0B, 0x17, 0x3E, 0x0A, 0x20, 0x2A, 0x99, 0x9B, 0x3F, 0x10, 0x26, 0x2D, 0x69, 0xA0, 0x8A,
+        0x00, 0xC0, 0x55, 0x69, 0x3D, 0x69, 0xA0, 0x8A, 0xC0, 0x5B, 0x6B, 0xC0, 0x13, 0x0C, 0x68, 0xC1,
+        0x0C, 0xA0, 0x7A, 0x69, 0x78, 0x02, 0xC0, 0x05, 0x9D, 0xA8, 0x9B, 0xB9, 0xC0, 0x9C, 0x9A, 0xA4,
+        0x66, 0x6F, 0x97, 0xBB, 0x30, 0xC0, 0xA4, 0x78, 0xA7, 0x78, 0xA6, 0x78, 0xA2, 0x88, 0x27, 0x24,
+        0x1D, 0x5A, 0x10, 0xC1, 0x0D, 0x5A, 0x6B, 0x0A, 0x0D, 0xC3, 0x14, 0xC1, 0x10, 0xC0, 0xA0, 0xC8,
+        0xC1, 0x52, 0x7E, 0x1C, 0x17, 0x0F, 0x66, 0x6B, 0x65, 0x11, 0xC0, 0x0A, 0x0F, 0x11, 0xA2, 0x87,
+        0x17, 0xC0, 0x65, 0x69, 0x67, 0x69, 0x68, 0x9E, 0x86, 0x9D, 0xA9, 0x64, 0xC0, 0x6B, 0xA2, 0x89,
+        0x6F, 0x69, 0x68, 0x65, 0x1F, 0x7F, 0x33, 0x6E, 0x6F, 0x2F, 0xC0, 0x65, 0x03, 0x9B, 0x99, 0x9A,
+        0x9B, 0x66, 0x6D, 0x2D, 0xC1, 0xA2, 0x87, 0xA6, 0x75, 0xA2, 0x88, 0xA2, 0x88, 0xA3, 0x78, 0xC0,
+        0x6F, 0xA2, 0x78, 0x00, 0xC0, 0x39, 0x00, 0x07, 0x21, 0x9B, 0xAA, 0xA2, 0x76, 0x38, 0xA2, 0x79,
+        0x9D, 0x98, 0x39, 0x65, 0x39, 0x00, 0xC0, 0x9F, 0x96, 0x07, 0x9C, 0xA6, 0x21, 0x97, 0xAB, 0x9C,
+        0x99, 0x6E, 0x19, 0x03, 0x32, 0x5A, 0x76, 0x06, 0x9D, 0x9A, 0x5A, 0x9B, 0xA9, 0xA3, 0x88, 0xA6,
+        0x76, 0x17, 0x1C, 0xC0, 0x3C, 0x16, 0x75, 0xA8, 0x66, 0x21, 0xA2, 0x78, 0x00, 0x39, 0xA0, 0x8C,
+        0x5B, 0xA0, 0x85, 0x3D, 0xA0, 0x8A, 0x04, 0x65, 0x04, 0xA0, 0x7A, 0x6B, 0x0F, 0x5A, 0x68, 0xC0,
+        0x9E, 0xA6, 0x66, 0xA3, 0x6B, 0xA0, 0x7A, 0xC0, 0x05, 0x74, 0x5B, 0x65, 0x62, 0x6E, 0x9B, 0xB9,
+        0x9B, 0xAB, 0x2A, 0xA4, 0x67, 0x9A, 0xAA, 0x9D, 0x99, 0x55, 0xA4, 0x78, 0xA5, 0x88, 0xA4, 0x78,
+        0x1B, 0x5E, 0x24, 0x10, 0xC1, 0x5A, 0xC2, 0x5B, 0xC0, 0x0D, 0x10, 0xC0, 0x0D, 0x6B, 0x6B, 0x14,
+        0xC0, 0x7A, 0xC0, 0xA0, 0xC7, 0xC3, 0x62, 0x0A, 0x66, 0x5B, 0x7A, 0xC0, 0x6E, 0xC3, 0x6E, 0x7C,
+        0xC0, 0x66, 0x69, 0xC0, 0x59, 0x75, 0x9D, 0xA8, 0x08, 0x54, 0x61, 0x6F, 0xA3, 0x89, 0x14, 0x6E,
+        0x06, 0x2E, 0x56, 0xA3, 0x87, 0x6F, 0x6F, 0x6F, 0xA1, 0x8A, 0xC0, 0x60, 0x9A, 0x99, 0x32, 0x9A,
+        0x8A, 0x9C, 0x9A, 0xA5, 0x85, 0x9D, 0x9B, 0x56, 0xC0, 0xA3, 0x96, 0xC0, 0xA2, 0x77, 0xA5, 0x89,
+        0x10, 0xA2, 0x79, 0x1C, 0x28, 0x6E, 0x1C, 0x6E, 0x65, 0x17, 0x28, 0x1E, 0x04, 0x1E, 0x26, 0xA4,
+        0x77, 0xA4, 0x6A, 0x21, 0xA2, 0x7A, 0x0E, 0x00, 0xC0, 0x6B, 0x03, 0x7E, 0x15, 0x25, 0x26, 0xA4,
+        0x67, 0x6F, 0xA1, 0x9A, 0x0B, 0x51, 0x67, 0x55, 0xC0, 0x9D, 0x99, 0xA3, 0x98, 0x17, 0x23, 0x34,
+        0x69, 0x10, 0x15, 0x65, 0xA2, 0x78, 0x07, 0x0E, 0xC1, 0x5A, 0x6B, 0x0B, 0x69, 0x0B, 0x12, 0x0F,
+        0x69, 0x69, 0x08, 0x68, 0x5B, 0x6B, 0xC0, 0xA0, 0x85, 0x6B, 0x66, 0x3E, 0x76, 0x05, 0xC0, 0x9A,
+        0xB8, 0x6F, 0x9B, 0xBA, 0x6D, 0x6F, 0x55, 0x9D, 0xAA, 0x6E, 0x52, 0x9D, 0x9A, 0x54, 0x6F, 0x29,
+        0xA7, 0x78, 0xA5, 0x78, 0x1D, 0x5A, 0x59, 0xC0, 0x5A, 0xC0, 0x1A, 0xC0, 0x0D, 0xC2, 0x1A, 0x69,
+        0x10, 0x0D, 0x6B, 0xC0, 0x10, 0x13, 0xC0, 0xA0, 0xB7, 0x6B, 0xC1, 0x52, 0x62, 0x0C, 0x59, 0xC0,
+        0x0C, 0xC2, 0x6E, 0xC1, 0x16, 0x6D, 0x79, 0x65, 0x6B, 0xC0, 0x04, 0x65, 0x60, 0x61, 0x54, 0x26,
+        0x7F, 0x6E, 0xA2, 0x78, 0x6B, 0x19, 0x0B, 0x69, 0x65, 0x04, 0x6F, 0x17, 0x2D, 0x28, 0x9C, 0x99,
+        0x25, 0xA2, 0x86, 0xA2, 0x78, 0x98, 0xAB, 0xA6, 0x76, 0x07, 0xA2, 0x77, 0x32, 0x9B, 0x9A, 0x9D,
+        0x9A, 0x32, 0x26, 0xA3, 0x88, 0x9D, 0x8A, 0xA6, 0x77, 0xC0, 0x9C, 0x99, 0x2A, 0x10, 0x6D, 0x32,
+        0x6E, 0x10, 0x3C, 0x3E, 0x32, 0x1C, 0x34, 0xC0, 0x6E, 0xC0, 0x00, 0xC0, 0x39, 0x28, 0x10, 0x03,
+        0x1C, 0x69, 0x2D, 0x3B, 0x34, 0x1C, 0x37, 0x53, 0x0B, 0x10, 0x15, 0x0B, 0x17, 0x28, 0x00, 0x9C,
+        0xA8, 0x9C, 0x98, 0x32, 0x10, 0x2D, 0xA1, 0x8B, 0xA0, 0x8A, 0xC1, 0x59, 0x3D, 0x68, 0x0B, 0xA0,
+        0x8A, 0x5A, 0x68, 0x01, 0xC1, 0x69, 0x5B, 0xC1, 0x69, 0x65, 0x99, 0xDA, 0xA5, 0x69, 0x62, 0xA3,
+        0x78, 0xA2, 0x68, 0x9B, 0xB8, 0x62, 0x9D, 0xAA, 0x66, 0x65, 0x5A, 0x66, 0xC0, 0x56, 0x66, 0x59,
+        0x66, 0x6F, 0xA5, 0x89, 0xA5, 0x88, 0xA3, 0x89, 0xA2, 0x77, 0x1A, 0x49, 0xC0, 0x7A, 0xC0, 0x0D,
+        0x13, 0x10, 0x13, 0x10, 0xC3, 0x0D, 0x10, 0xC0, 0x13, 0xC0, 0xA0, 0xB7, 0x6B, 0xC2, 0x52, 0x62,
+        0x02, 0xC0, 0x7B, 0xC2, 0x6E, 0xC1, 0x16, 0xC1, 0x68, 0x79, 0x6B, 0xC0, 0x9E, 0x96, 0x60, 0x65,
+        0x26, 0x6E, 0x26, 0x3F, 0x38, 0xA1, 0x8A, 0x1E, 0x69, 0x64, 0x6E, 0x6F, 0x6B, 0x6E, 0x6F, 0x21,
+        0x17, 0x9A, 0xA9, 0x55, 0x0B, 0x17, 0x69, 0x03, 0x0B, 0x99, 0x9A, 0x9C, 0x9A, 0xA5, 0x87, 0x19,
+        0x9C, 0x8A, 0xA3, 0x97, 0x53, 0xA3, 0x88, 0x03, 0x62, 0x9D, 0x89, 0x66, 0xA7, 0x75, 0x03, 0x3F,
+        0xA8, 0x74, 0x2B, 0x9B, 0x9B, 0xA6, 0x76, 0x2D, 0x07, 0x00, 0x69, 0xC0, 0x07, 0xA0, 0x8A, 0x00,
+        0x12, 0x51, 0x3C, 0x10, 0x39, 0xA0, 0x8B, 0x15, 0x07, 0xA0, 0x85, 0x1C, 0x9C, 0x9A, 0xC0, 0x17,
+        0x10, 0xA2, 0x79, 0xC0, 0x00, 0x21, 0x9D, 0x99, 0x3E, 0x08, 0x2D, 0x07, 0x0E, 0x15, 0x0E, 0x5B,
+        0xA0, 0x85, 0xC0, 0xA0, 0x8A, 0xA0, 0x8A, 0x59, 0xC0, 0x69, 0x69, 0xC0, 0x69, 0xC0, 0x5A, 0x70,
+        0x6E, 0x52, 0xC0, 0x62, 0x7B, 0x62, 0xA4, 0x67, 0x62, 0x6D, 0x9C, 0x9A, 0x62, 0x66, 0x69, 0x66,
+        0x25, 0xC0, 0x66, 0x5A, 0xA5, 0x67, 0x9A, 0xA9, 0x6B, 0xA6, 0x67, 0xA6, 0x77, 0xA0, 0x9A, 0xA3,
+        0x78, 0x5A, 0x59, 0x0D, 0x10, 0xC0, 0x1A, 0x1D, 0x13, 0x1A, 0x1D, 0x10, 0x13, 0x1D, 0xC0, 0x10,
+        0x13, 0xC0, 0x10, 0xC0, 0xA0, 0xC8, 0xC1, 0x52, 0xC1, 0x66, 0x02, 0xC0, 0x7B, 0xC1, 0x6E, 0xC1,
+        0x16, 0xC0, 0x11, 0x0F, 0x7C, 0x69, 0x66, 0x66, 0x2C, 0x61, 0x05, 0x9F, 0x96, 0x9C, 0x99, 0x55,
+        0x30, 0xA2, 0x89, 0x65, 0xA2, 0x78, 0xC1, 0x59, 0x28, 0x6B, 0x6B, 0x2F, 0x6C, 0x10, 0x3F, 0x10,
+        0x6F, 0x3B, 0xC0, 0x1C, 0x98, 0xAA, 0x9B, 0x9B, 0xA2, 0x76, 0x7E, 0x9D, 0x9A, 0x56, 0xA2, 0x87,
+        0x6F, 0x6B, 0x7E, 0x31, 0x18, 0x9D, 0x9B, 0x20, 0x1C, 0x18, 0xA4, 0x76, 0x3C, 0x9A, 0x9A, 0xA5,
+        0x87, 0x26, 0x6B, 0x3C, 0x17, 0x26, 0x00, 0xA0, 0x8B, 0x68, 0x68, 0xC2, 0x07, 0x15, 0x6B, 0x68,
+        0x00, 0x28, 0x23, 0x69, 0x69, 0x2D, 0x39, 0x07, 0x00, 0x26, 0x2D, 0x26, 0x00, 0xC0, 0x0E, 0x6B,
+        0xC0, 0x59, 0xC1, 0x68, 0x0B, 0x1D, 0x69, 0x69, 0xC0, 0x69, 0xC0, 0x68, 0x5B, 0x74, 0x99, 0xC9,
+        0xA4, 0x67, 0x99, 0xBB, 0x66, 0xA5, 0x67, 0xA3, 0x88, 0x63, 0x67, 0x66, 0x65, 0x5A, 0x62, 0x6E,
+        0x39, 0x65, 0x2A, 0xA2, 0x77, 0x25, 0xA2, 0x67, 0xA5, 0x77, 0x97, 0xBC, 0xA2, 0x77, 0xA4, 0x77,
+        0xA8, 0x57, 0xA1, 0xA9, 0x1D, 0xC0, 0x49, 0xC0, 0x59, 0x1D, 0xA0, 0xA9, 0xC0, 0x59, 0xC0, 0x1D,
+        0xC0, 0x20, 0x6B, 0x1D, 0x10, 0x13, 0xC2, 0xA0, 0xB8, 0x69, 0x1C, 0x66, 0x9D, 0x9A, 0xA2, 0x77,
+        0x0A, 0x56, 0xC0, 0x7B, 0xC0, 0x6E, 0xC5, 0x0A, 0x50, 0xA0, 0x95, 0xA2, 0x87, 0x55, 0x77, 0x66,
+        0x69, 0x2B, 0x9B, 0x98, 0xA4, 0x87, 0xA2, 0x88, 0x6F, 0x6F, 0xC0, 0x6F, 0x23, 0x6F, 0x6B, 0xA0,
+        0x8B, 0xC0, 0x68, 0x6C, 0x64, 0x65, 0xC0, 0x28, 0x3B, 0x6B, 0x21, 0x9C, 0x99, 0x9D, 0x99, 0x9C,
+        0x9A, 0x52, 0x01, 0x5A, 0x01, 0x0D, 0x6F, 0x69, 0xA2, 0x87, 0x69, 0x13, 0x18, 0x03, 0x23, 0x65,
+        0x10, 0x03, 0xA3, 0x86, 0x21, 0x2A, 0x7F, 0x69, 0xA5, 0x78, 0xC0, 0xA3, 0x79, 0x69, 0x9C, 0x98,
+        0x9D, 0xAB, 0xA2, 0x87, 0x21, 0x39, 0x00, 0x07, 0x6B, 0x9F, 0x95, 0x28, 0xC0, 0x51, 0x12, 0x28,
+        0x07, 0xC0, 0x39, 0x2D, 0x15, 0x51, 0x3C, 0x15, 0x00, 0x0E, 0x07, 0x58, 0x6B, 0x6B, 0x3D, 0xC0,
+        0x08, 0x3A, 0xC0, 0xA0, 0x8B, 0x08, 0xC0, 0x5A, 0x79, 0x9C, 0xA7, 0x99, 0xCB, 0xA2, 0x77, 0x24,
+        0x1A, 0xC0, 0x2E, 0xA3, 0x79, 0xC0, 0x6B, 0x66, 0x65, 0x5A, 0xA2, 0x77, 0xC0, 0x3E, 0x65, 0xA3,
+        0x68, 0x65, 0xA3, 0x78, 0x52, 0x9B, 0xBA, 0x51, 0xA8, 0x46, 0xA7, 0x68, 0x7B, 0x7B, 0x6B, 0x49,
+        0xC0, 0x7A, 0xA0, 0xB9, 0x7B, 0x66, 0x27, 0xC0, 0x20, 0x27, 0x2A, 0x27, 0x16, 0x10, 0x13, 0x7B,
+        0x20, 0x1D, 0xA0, 0xA6, 0xC0, 0x67, 0x6E, 0x0A, 0x7E, 0xC0, 0x52, 0x0A, 0x0C, 0x11, 0xC2, 0x6E,
+        0x11, 0xC0, 0x56, 0x54, 0x9C, 0xA9, 0xA4, 0x83, 0x6D, 0x9D, 0xA8, 0x7F, 0xC0, 0x9D, 0x98, 0x6E,
+        0x68, 0x9C, 0x99, 0x6F, 0xA2, 0x88, 0xA5, 0x78, 0x6B, 0xA1, 0x8A, 0x6F, 0x6B, 0x6B, 0xA0, 0x8A,
+        0x6C, 0x34, 0x21, 0x69, 0x6E, 0x6B, 0x6B, 0x28, 0xC0, 0x21, 0x98, 0xAA, 0x9D, 0x9B, 0x55, 0x66,
+        0xC0, 0x66, 0x6F, 0x6E, 0x19, 0x12, 0xC0, 0xA2, 0x86, 0xA2, 0x88, 0x03, 0xA3, 0x88, 0x07, 0xC0,
+        0x00, 0x17, 0x3C, 0x03, 0x06, 0x25, 0x32, 0x56, 0x3E, 0xA7, 0x67, 0x1C, 0x28, 0x9C, 0x99, 0x1E,
+        0xA4, 0x67, 0x26, 0x2D, 0x39, 0x07, 0xC0, 0x28, 0x9A, 0xAA, 0x52, 0xC0, 0x28, 0x34, 0x32, 0x28,
+        0x17, 0xC0, 0x9C, 0x99, 0x28, 0x32, 0x6B, 0xC0, 0x59, 0xA0, 0x8A, 0x69, 0x3D, 0x36, 0x65, 0x3D,
+        0x2A, 0x5F, 0xA0, 0x8A, 0xA0, 0x7C, 0x13, 0x78, 0x3A, 0x9C, 0xB9, 0x9C, 0x99, 0x61, 0x2E, 0x61,
+        0x5A, 0x7F, 0xA2, 0x78, 0xA1, 0x8A, 0x6E, 0xC0, 0x65, 0x56, 0x6E, 0xA4, 0x66, 0xA2, 0x78, 0x17,
+        0x0F, 0xA3, 0x77, 0x6F, 0x99, 0xBB, 0xA4, 0x67, 0x9B, 0xA9, 0xA2, 0x78, 0xA7, 0x67, 0xA1, 0x9A,
+        0x5B, 0xC2, 0x13, 0x20, 0x77, 0xC0, 0x6E, 0xC0, 0x69, 0x20, 0xC1, 0x59, 0x4A, 0xA0, 0xA9, 0x27,
+        0x20, 0xC0, 0x15, 0x53, 0x7D, 0x15, 0x0F, 0xC0, 0xA2, 0x87, 0x0F, 0xC0, 0x66, 0x11, 0xC1, 0x6E,
+        0x11, 0xC1, 0x55, 0x9D, 0x99, 0x9F, 0x96, 0xA3, 0x95, 0x97, 0x9A, 0xA2, 0x97, 0xA5, 0x87, 0x60,
+        0xC0, 0x9B, 0x9A, 0x6E, 0x26, 0x2B, 0x9D, 0x99, 0xA5, 0x88, 0x30, 0xA4, 0x7A, 0xA1, 0x8A, 0xA0,
+        0x8A, 0x6B, 0x6B, 0x0B, 0x3B, 0x21, 0xC0, 0x6E, 0x21, 0x9B, 0xA9, 0xA4, 0x78, 0x9D, 0xA9, 0x21,
+        0x9D, 0xAA, 0x98, 0x8B, 0x66, 0xC0, 0x66, 0x69, 0x0D, 0xA2, 0x78, 0xC0, 0x19, 0x12, 0xC0, 0x0D,
+        0xA4, 0x86, 0xA9, 0x66, 0x15, 0xC0, 0x39, 0x9B, 0xB8, 0x2B, 0x57, 0x9B, 0x9B, 0x7E, 0x2A, 0x62,
+        0xA6, 0x67, 0x39, 0x99, 0xBA, 0x16, 0x28, 0x39, 0x2D, 0x1C, 0x21, 0x39, 0xC1, 0x2D, 0x16, 0x62,
+        0xA3, 0x87, 0x28, 0x9C, 0x98, 0x7E, 0x21, 0x34, 0x26, 0x65, 0x39, 0xC0, 0x2D, 0xC0, 0x9E, 0x86,
+        0x6F, 0x2F, 0x9D, 0xA8, 0xC0, 0x62, 0xA3, 0x79, 0x9D, 0x98, 0xA3, 0x7A, 0x01, 0xA0, 0x7C, 0xC0,
+        0xA0, 0x95, 0x60, 0x9D, 0xBA, 0x9C, 0x98, 0x6D, 0x9D, 0xAA, 0x66, 0xC0, 0x59, 0xA1, 0x9A, 0xA2,
+        0x78, 0x6B, 0x6E, 0x0D, 0x55, 0x66, 0xC0, 0xA3, 0x77, 0xA4, 0x67, 0xA3, 0x67, 0x6F, 0xC0, 0x9B,
+        0xB9, 0x56, 0xA3, 0x78, 0x5A, 0xA2, 0x78, 0x7B, 0xA1, 0x8A, 0x5B, 0xC0, 0x0D, 0xC0, 0x1D, 0x7B,
+        0xC0, 0x76, 0xC0, 0x5D, 0xC0, 0x1D, 0xC0, 0x59, 0xC0, 0x7A, 0x1D, 0xC0, 0x20, 0x15, 0x6B, 0x10,
+        0x15, 0x56, 0x67, 0x1C, 0xC1, 0x66, 0x53, 0xC1, 0x6B, 0xC0, 0x11, 0x56, 0x60, 0x50, 0x9F, 0x96,
+        0x64, 0x99, 0x9B, 0xA6, 0x85, 0x7E, 0x69, 0xA2, 0x88, 0xC0, 0x37, 0x2B, 0xA2, 0x87, 0xA1, 0x8A,
+        0x69, 0x38, 0x28, 0x6B, 0xA0, 0x8A, 0xA0, 0x8A, 0xC0, 0x6C, 0x65, 0x26, 0x69, 0x62, 0x6E, 0x32,
+        0xA2, 0x88, 0xA3, 0x78, 0x9C, 0x99, 0x28, 0x25, 0xC0, 0x52, 0x9D, 0x9B, 0xC0, 0x6E, 0x6F, 0xC0,
+        0x19, 0xC0, 0xA2, 0x86, 0xA5, 0x87, 0x28, 0x34, 0x6F, 0x07, 0x68, 0x28, 0x9F, 0x96, 0x9D, 0x9A,
+        0x9D, 0x9B, 0x2C, 0x32, 0xA2, 0x79, 0xA2, 0x87, 0x00, 0x9A, 0xA9, 0x6E, 0x28, 0xA2, 0x77, 0x2D,
+        0x1C, 0x21, 0xC0, 0x15, 0x53, 0xA2, 0x88, 0x0A, 0x7E, 0x23, 0x9B, 0x99, 0x3E, 0x66, 0x2C, 0x0F,
+        0x00, 0xC0, 0xA0, 0x8B, 0xC0, 0x34, 0x2D, 0x37, 0x9C, 0x89, 0xA9, 0x67, 0x99, 0xB9, 0x2A, 0xA5,
+        0x77, 0x53, 0x99, 0xAB, 0xA3, 0x88, 0xA9, 0x58, 0xA1, 0x7A, 0xC1, 0x70, 0x9A, 0xB9, 0x62, 0xA2,
+        0x76, 0x6E, 0x9B, 0xBA, 0xC0, 0xA2, 0x77, 0x29, 0x01, 0x6E, 0x6F, 0xC0, 0x01, 0x56, 0xC0, 0x6E,
+        0xA5, 0x67, 0xA4, 0x56, 0xA1, 0x8A, 0x5A, 0x65, 0x22, 0xA3, 0x68, 0xA0, 0x8A, 0x59, 0x03, 0x6B,
+        0x6B, 0xC0, 0x79, 0xC0, 0xA0, 0xB9, 0xC1, 0x9F, 0xBA, 0x27, 0x20, 0x66, 0x20, 0x1D, 0x13, 0x0C,
+        0x13, 0xC2, 0xA0, 0xB8, 0xC0, 0x66, 0x15, 0x69, 0x17, 0x1C, 0xC1, 0x52, 0x6B, 0xC0, 0x7E, 0x1B,
+        0x62, 0xC0, 0x51, 0x51, 0x9D, 0x97, 0x9F, 0x96, 0x9D, 0x99, 0x64, 0xA4, 0x86, 0x9D, 0x9A, 0xA3,
+        0x97, 0xC0, 0x9C, 0x88, 0xA3, 0x98, 0xA6, 0x78, 0xA2, 0x79, 0x6F, 0x9F, 0x96, 0x6E, 0xA1, 0x8B,
+        0x69, 0xA1, 0x8A, 0x9F, 0x9B, 0x6F, 0x68, 0x34, 0xC1, 0x2D, 0x26, 0x9C, 0x99, 0xC0, 0x21, 0x97,
+        0xBB, 0xA8, 0x66, 0x9D, 0x98, 0xA1, 0x9A, 0x9A, 0x8A, 0x9C, 0x9A, 0x69, 0xA2, 0x79, 0xC0, 0x1F,
+        0x66, 0xA2, 0x87, 0xA5, 0x76, 0x08, 0x9D, 0xA9, 0x57, 0xA5, 0x87, 0x28, 0x34, 0x9B, 0xB7, 0x50,
+        0x2B, 0xA1, 0x8A, 0x31, 0x65, 0x28, 0x2D, 0x34, 0x9C, 0x99, 0x28, 0x52, 0x65, 0x26, 0x28, 0x32,
+        0x15, 0x9D, 0xAA, 0x9D, 0x89, 0x2D, 0x17, 0x52, 0x9C, 0x9A, 0x9D, 0x89, 0x2C, 0xA6, 0x76, 0x16,
+        0x9D, 0xA9, 0x28, 0xA2, 0x78, 0xA0, 0x8D, 0x6B, 0xA0, 0x74, 0x9E, 0x95, 0x19, 0x9C, 0x89, 0x08,
+        0x98, 0x9A, 0x9D, 0xAA, 0x2A, 0x56, 0x9C, 0xAB, 0xAA, 0x45, 0xA2, 0x79, 0x66, 0xA2, 0x78, 0x62,
+        0xA3, 0x67, 0x2B, 0x9A, 0xBA, 0x33, 0xA5, 0x67, 0x9D, 0x99, 0x33, 0x5E, 0x1A, 0xA3, 0x89, 0xA4,
+        0x67, 0x67, 0x66, 0x51, 0x66, 0x69, 0xA3, 0x78, 0xA3, 0x78, 0x14, 0xA4, 0x67, 0x65, 0x52, 0xA4,
+        0x68, 0xA0, 0x7A, 0xA0, 0x8A, 0x58, 0x69, 0x03, 0x11, 0xC1, 0x69, 0x7A, 0x7A, 0x1D, 0x7A, 0x6B,
+        0x20, 0x66, 0x20, 0xC0, 0x0C, 0x5A, 0x7B, 0xC0, 0x10, 0xC0, 0xA0, 0xC7, 0xC3, 0x1C, 0xC5, 0x6B,
+        0x52, 0x66, 0x56, 0x61, 0x9D, 0x88, 0x9C, 0x98, 0x9C, 0x88, 0x9C, 0x97, 0x78, 0xA2, 0x76, 0x7F,
+        0xA3, 0x97, 0x52, 0xA3, 0x96, 0xA4, 0x87, 0x3F, 0xA2, 0x7B, 0x6E, 0x69, 0x6F, 0x6B, 0x34, 0x2D,
+        0x34, 0x02, 0x6B, 0x02, 0xC0, 0x09, 0x34, 0x21, 0xC0, 0x28, 0x65, 0x61, 0x21, 0x1C, 0x65, 0x9D,
+        0x9A, 0x9D, 0x99, 0xA2, 0x77, 0x31, 0x2C, 0xA2, 0x87, 0x2C, 0xC0, 0x9D, 0x9A, 0x2C, 0x65, 0x25,
+        0x31, 0x39, 0x2D, 0x25, 0x61, 0x5A, 0xA4, 0x87, 0x23, 0x34, 0x6F, 0xA0, 0x8C, 0xA0, 0x85, 0x28,
+        0x9C, 0x9A, 0x9B, 0x9A, 0xA3, 0x87, 0x39, 0x23, 0x50, 0x10, 0x3F, 0x23, 0x9D, 0x99, 0x0F, 0x9B,
+        0x9B, 0x9D, 0xAA, 0x55, 0x66, 0xA2, 0x76, 0xA6, 0x77, 0x34, 0x07, 0xA0, 0x8A, 0x0E, 0x5A, 0x9E,
+        0x95, 0x60, 0xC0, 0x9D, 0xA9, 0x6E, 0x97, 0xAC, 0x52, 0xA4, 0x76, 0x67, 0xA4, 0x77, 0xA5, 0x78,
+        0x30, 0x06, 0xA6, 0x56, 0x9B, 0xBB, 0xA2, 0x77, 0x2B, 0x61, 0x2E, 0x35, 0xA6, 0x56, 0x61, 0x61,
+        0x67, 0xA3, 0x78, 0x9D, 0xBB, 0x06, 0x6B, 0xC0, 0x51, 0x69, 0xA2, 0x67, 0xA3, 0x88, 0xA2, 0x68,
+        0x65, 0xC0, 0x9D, 0x99, 0xA6, 0x57, 0x5E, 0x03, 0x59, 0xC0, 0x03, 0xA0, 0x8A, 0xC1, 0x7A, 0x69,
+        0x7A, 0xC0, 0x7A, 0x6B, 0xA0, 0xA8, 0xC2, 0x58, 0x6B, 0x13, 0x10, 0xC0, 0x6B, 0x15, 0xC0, 0x6B,
+        0xC6, 0x67, 0x56, 0xC0, 0x66, 0xC0, 0x51, 0x51, 0x9D, 0x98, 0x9B, 0x99, 0x9C, 0x87, 0x9D, 0x98,
+        0x65, 0xA2, 0x96, 0x52, 0xA6, 0x86, 0x51, 0xA2, 0x87, 0x7F, 0xA3, 0x87, 0xA7, 0x88, 0x3C, 0x7F,
+        0x36, 0x6F, 0xC1, 0x69, 0x02, 0x3B, 0xC0, 0xA0, 0x8A, 0xC0, 0x3B, 0x02, 0xC1, 0x9F, 0x95, 0xC0,
+        0x34, 0xC0, 0x21, 0x28, 0x08, 0x7E, 0x31, 0xA3, 0x88, 0xA3, 0x87, 0x10, 0x2C, 0x9C, 0x8A, 0xA7,
+        0x86, 0x50, 0x19, 0x57, 0xA4, 0x87, 0x10, 0x9B, 0x99, 0x97, 0xAD, 0xA2, 0x77, 0x66, 0xA3, 0x87,
+        0x3C, 0x07, 0xA0, 0x8C, 0x0E, 0x3B, 0x9C, 0x98, 0x2C, 0x31, 0x65, 0xA3, 0x87, 0x34, 0xC0, 0x28,
+        0x9A, 0x99, 0x12, 0xA3, 0x87, 0x6B, 0x52, 0x61, 0x65, 0x6E, 0x24, 0xA8, 0x76, 0x07, 0x0E, 0x5A,
+        0x9C, 0xA5, 0x61, 0x97, 0xAA, 0x33, 0xA5, 0x77, 0xA3, 0x87, 0x9B, 0xAA, 0x32, 0xC0, 0xA2, 0x77,
+        0x22, 0x9D, 0x9A, 0x66, 0x2B, 0xA4, 0x78, 0x62, 0x6B, 0x6D, 0xA3, 0x76, 0x56, 0x65, 0xA5, 0x67,
+        0x6E, 0x5A, 0x9C, 0xB9, 0x9A, 0xAA, 0x77, 0xA4, 0x68, 0x6E, 0x7F, 0x9D, 0x99, 0xA3, 0x66, 0xA2,
+        0x78, 0x62, 0xA2, 0x78, 0x9B, 0xB9, 0xA5, 0x57, 0x69, 0xA2, 0x68, 0xC0, 0xA2, 0x79, 0x65, 0x62,
+        0x66, 0xA4, 0x69, 0xA0, 0x8A, 0xC2, 0x79, 0xC0, 0x7A, 0xA0, 0xA9, 0x7A, 0x1B, 0x20, 0x59, 0x0C,
+        0x16, 0x5A, 0x10, 0x6B, 0xC0, 0xA0, 0xC7, 0x15, 0xC0, 0x1C, 0xC1, 0x6B, 0x1C, 0xC1, 0x67, 0x56,
+        0x66, 0xC0, 0x56, 0x61, 0x40, 0x9C, 0x98, 0x9B, 0x99, 0x9C, 0x97, 0x51, 0x64, 0xC1, 0xA6, 0x85,
+        0x62, 0x9D, 0x9A, 0x6E, 0xAB, 0x85, 0x65, 0xA2, 0x78, 0xA2, 0x87, 0xA4, 0x79, 0x6D, 0x34, 0x69,
+        0x61, 0x2D, 0x02, 0xC1, 0x3B, 0xC0, 0x34, 0xA0, 0x8C, 0x69, 0x34, 0x68, 0x2D, 0xC0, 0x65, 0xC0,
+        0x61, 0x17, 0x6F, 0x6E, 0xA2, 0x79, 0x10, 0xC0, 0x0A, 0x23, 0x31, 0x36, 0x2A, 0xA4, 0x78, 0x9A,
+        0xA9, 0x68, 0x99, 0x9C, 0x56, 0x7F, 0xA8, 0x74, 0xA5, 0x78, 0x1C, 0x3B, 0x6C, 0x9C, 0x9A, 0x7F,
+        0x23, 0x9E, 0x86, 0x37, 0x6F, 0x34, 0x00, 0x28, 0x3E, 0x31, 0x52, 0xC1, 0x9C, 0x9A, 0x69, 0x18,
+        0x2C, 0xA2, 0x88, 0x34, 0x6F, 0x34, 0x51, 0x64, 0x96, 0xAA, 0x9B, 0xAB, 0x26, 0x33, 0xC0, 0x2D,
+        0xC0, 0x6E, 0x6E, 0x32, 0x06, 0xA6, 0x66, 0xA0, 0x8A, 0x67, 0xC0, 0xA2, 0x77, 0x61, 0x66, 0x3F,
+        0xA6, 0x46, 0x6F, 0x21, 0x61, 0x9C, 0xA9, 0x3F, 0xA3, 0x79, 0x62, 0xA4, 0x67, 0xC0, 0x5E, 0x9C,
+        0xA9, 0xC0, 0x66, 0x61, 0xA5, 0x57, 0xC0, 0x5A, 0xA3, 0x78, 0x29, 0x9A, 0xB9, 0xA3, 0x78, 0xA2,
+        0x68, 0xA2, 0x8A, 0x7B, 0xC2, 0x7A, 0xC0, 0x7A, 0xC0, 0x1D, 0x76, 0xC0, 0x13, 0x59, 0x13, 0xC1,
+        0x5B, 0x6B, 0xA0, 0xC5, 0x0E, 0x15, 0x6B, 0xC1, 0x6B, 0x1C, 0xC0, 0x15, 0xC0, 0x67, 0x11, 0xC0,
+        0x51, 0x51, 0x9D, 0x99, 0x9C, 0x87, 0x9B, 0x99, 0x9D, 0x98, 0x60, 0x65, 0xC0, 0x6E, 0xA4, 0x86,
+        0x66, 0x52, 0xA3, 0x97, 0xA9, 0x85, 0x9B, 0x99, 0x6F, 0xA2, 0x87, 0xA9, 0x78, 0x6E, 0x3B, 0x68,
+        0x28, 0xC0, 0x6F, 0x02, 0x3B, 0x34, 0x3B, 0x02, 0x6B, 0x34, 0x2D, 0xC0, 0x69, 0x65, 0x9D, 0xAA,
+        0x3B, 0x07, 0x00, 0x07, 0x34, 0x00, 0x99, 0xB8, 0xA3, 0x88, 0xA2, 0x77, 0x00, 0x9C, 0x97, 0x28,
+        0xC0, 0x98, 0xA9, 0x04, 0x79, 0x9C, 0x8A, 0xC0, 0x7E, 0xA2, 0x77, 0x19, 0xA8, 0x67, 0x9D, 0x98,
+        0x28, 0x2C, 0x9C, 0x8B, 0x6D, 0x65, 0xA2, 0x85, 0xA6, 0x78, 0x1C, 0x28, 0x1C, 0x97, 0xAA, 0x0B,
+        0x6B, 0xA7, 0x76, 0x24, 0x9B, 0x9B, 0x65, 0xC0, 0x6E, 0x02, 0xA3, 0x88, 0x6D, 0x02, 0x17, 0x22,
+        0x79, 0x38, 0x9C, 0x9A, 0x26, 0x6B, 0x21, 0xC0, 0x5B, 0x2D, 0xC0, 0x6E, 0xA5, 0x78, 0xA8, 0x67,
+        0x08, 0xC0, 0xA3, 0x77, 0x37, 0xA4, 0x66, 0xA4, 0x66, 0x59, 0x66, 0x6F, 0x9D, 0xA8, 0x1C, 0x10,
+        0x2F, 0x76, 0x5F, 0xA1, 0x7A, 0x2F, 0x9C, 0xA9, 0xA2, 0x77, 0x61, 0x1E, 0x5E, 0xA2, 0x69, 0xC1,
+        0x65, 0x62, 0xA2, 0x78, 0x65, 0x29, 0xA1, 0x8B, 0xA0, 0xA8, 0x6B, 0xC1, 0x13, 0xC0, 0x7A, 0xC0,
+        0x1D, 0xC0, 0x13, 0xC0, 0xA0, 0xA9, 0x16, 0x13, 0xC0, 0x6B, 0xA0, 0xB6, 0xC0, 0x6B, 0xC0, 0x23,
+        0xC0, 0x1C, 0xC4, 0x57, 0x9D, 0x9A, 0x61, 0x9D, 0x88, 0x9D, 0x98, 0x9B, 0x99, 0x9D, 0x98, 0x9D,
+        0x98, 0x65, 0x65, 0x6E, 0xC0, 0xA2, 0x97, 0x6E, 0x3D, 0xA5, 0x95, 0xA2, 0x87, 0x6B, 0xA4, 0x77,
+        0x2B, 0xA5, 0x79, 0xA1, 0x8A, 0xA1, 0x8B, 0x3B, 0x64, 0xC0, 0x6E, 0x34, 0xC0, 0x2D, 0xC0, 0xA0,
+        0x8B, 0xC0, 0x2D, 0x69, 0x9D, 0xA8, 0x9D, 0x99, 0xA5, 0x79, 0x65, 0x21, 0xA2, 0x7A, 0x0E, 0x6B,
+        0x0E, 0x07, 0x2F, 0x2D, 0x6F, 0x07, 0xC0, 0x0E, 0x34, 0x9B, 0xA8, 0x9D, 0xA8, 0x9B, 0x9A, 0x31,
+        0x0A, 0x33, 0xC0, 0x26, 0x21, 0x9B, 0xA9, 0x03, 0x9D, 0x99, 0x12, 0x66, 0x6D, 0xA7, 0x86, 0x2A,
+        0x11, 0xA4, 0x87, 0xA4, 0x77, 0x56, 0x0B, 0x22, 0xA7, 0x88, 0x96, 0x9B, 0x9D, 0x9A, 0x65, 0xC0,
+        0xA2, 0x87, 0xAA, 0x66, 0x9B, 0x99, 0xA2, 0x87, 0x66, 0x0D, 0x39, 0x64, 0x6D, 0x6B, 0x26, 0xC0,
+        0x66, 0xC0, 0x5A, 0xC0, 0x26, 0xA2, 0x78, 0x6F, 0xA8, 0x67, 0xA6, 0x57, 0x61, 0x6F, 0x21, 0xA3,
+        0x78, 0x9A, 0xA8, 0x69, 0x3F, 0xA2, 0x78, 0x9D, 0x99, 0xA2, 0x78, 0xA4, 0x68, 0x77, 0xA1, 0x7A,
+        0x6B, 0xC0, 0x78, 0xC0, 0x59, 0x65, 0xA1, 0x8A, 0xC0, 0x5B, 0xC0, 0x5A, 0x79, 0x1F, 0x9B, 0xBA,
+        0x9D, 0xA9, 0xA6, 0x56, 0xA4, 0x69, 0x9D, 0xC9, 0xA1, 0x9A, 0xA3, 0x68, 0xC0, 0x1D, 0x69, 0x13,
+        0x16, 0x13, 0xC1, 0x10, 0x16, 0x13, 0xC0, 0x0C, 0x13, 0x15, 0x6B, 0xC1, 0x6B, 0xC0, 0x1C, 0x15,
+        0x1C, 0x67, 0x56, 0xC0, 0x66, 0x51, 0x51, 0x9D, 0x99, 0x9C, 0x87, 0x9C, 0x98, 0x9C, 0x88, 0x60,
+        0xC0, 0x69, 0xC0, 0x7E, 0xC0, 0x7E, 0x69, 0xA2, 0x87, 0x3E, 0x05, 0x6E, 0xA6, 0x85, 0xAA, 0x77,
+        0xA3, 0x7A, 0xA1, 0x8B, 0x68, 0x28, 0x51, 0xA2, 0x87, 0xC0, 0x6E, 0x6B, 0x34, 0x09, 0x02, 0x2D,
+        0x26, 0x9B, 0xA8, 0x9D, 0xAA, 0xA4, 0x77, 0x69, 0x21, 0xA2, 0x7A, 0xA0, 0x8A, 0x1C, 0xC0, 0x15,
+        0x07, 0x68, 0x0E, 0x15, 0x0E, 0x15, 0x00, 0x9B, 0xA7, 0x9A, 0xA8, 0x52, 0x52, 0x26, 0xA2, 0x78,
+        0x0B, 0x55, 0x21, 0x66, 0x9B, 0xA9, 0xA2, 0x78, 0x9C, 0x9A, 0x9D, 0x89, 0xA4, 0x87, 0x9D, 0x98,
+        0x38, 0xA3, 0x87, 0x7B, 0x37, 0x1C, 0x03, 0xA3, 0x89, 0x52, 0x97, 0xAB, 0x65, 0x66, 0x56, 0xA5,
+        0x86, 0x36, 0x17, 0xC1, 0x0D, 0x55, 0x9D, 0x99, 0x7D, 0x33, 0xA3, 0x77, 0x38, 0x26, 0xA2, 0x77,
+        0xC0, 0x9D, 0x9A, 0x26, 0xA7, 0x66, 0x62, 0xA2, 0x79, 0xAA, 0x47, 0x6F, 0xC1, 0x9C, 0xA8, 0x9C,
+        0x98, 0x3A, 0xA4, 0x68, 0x5E, 0xC0, 0x66, 0x2A, 0xA0, 0x8B, 0x6B, 0x3F, 0x06, 0x3F, 0x69, 0x3F,
+        0xC1, 0x5B, 0xC1, 0x69, 0x64, 0x9C, 0xA9, 0x9C, 0xA9, 0x9D, 0xAA, 0xA5, 0x67, 0xA3, 0x78, 0x9C,
+        0xBA, 0xA5, 0x78, 0xA3, 0x79, 0x7A, 0x10, 0x13, 0xC1, 0x59, 0x10, 0xC1, 0x13, 0xC3, 0x15, 0x6B,
+        0x15, 0x1C, 0xC0, 0x6B, 0x1C, 0xC0, 0x15, 0x1C, 0x67, 0x52, 0x56, 0x51, 0x50, 0x9C, 0x99, 0x9C,
+        0x87, 0x9C, 0x98, 0x9D, 0x98, 0x65, 0x69, 0xC0, 0x7E, 0xC0, 0x7E, 0xC4, 0x6E, 0xA6, 0x85, 0x0B,
+        0x16, 0x34, 0x65, 0x9C, 0x98, 0x9C, 0x98, 0x7D, 0xA5, 0x77, 0x6B, 0x2D, 0x3B, 0x6B, 0xC0, 0x9F,
+        0x95, 0x69, 0x9D, 0xA8, 0x52, 0x62, 0x3D, 0xA4, 0x69, 0xA1, 0x8A, 0x15, 0xC0, 0x1C, 0x23, 0xA0,
+        0x85, 0x07, 0xC1, 0x00, 0x21, 0x52, 0x7E, 0x3D, 0x98, 0x9A, 0xA2, 0x89, 0xA4, 0x77, 0x66, 0xA2,
+        0x87, 0x21, 0x00, 0xC0, 0x1C, 0x9B, 0xAA, 0x9B, 0x8C, 0x18, 0x52, 0x9C, 0x99, 0xA2, 0x86, 0xA8,
+        0x75, 0xA3, 0x78, 0x7B, 0xA4, 0x68, 0x00, 0x07, 0x9B, 0xA7, 0xC0, 0x03, 0x9A, 0x99, 0x9C, 0x8B,
+        0x18, 0x12, 0x6B, 0x65, 0x12, 0xC0, 0x0D, 0x54, 0xA2, 0x86, 0x9C, 0x9A, 0xA8, 0x65, 0xA2, 0x78,
+        0x98, 0xAA, 0xA4, 0x77, 0x2C, 0x9A, 0x9A, 0xA4, 0x77, 0xA5, 0x67, 0x61, 0xA4, 0x69, 0xA3, 0x8A,
+        0x5B, 0x6B, 0x74, 0x50, 0x6E, 0x6D, 0x2A, 0xC3, 0x38, 0x06, 0x69, 0x79, 0x3F, 0xC1, 0x38, 0xA0,
+        0x7A, 0x6B, 0xC0, 0x68, 0xC0, 0x29, 0x64, 0x6B, 0x99, 0xCB, 0xA3, 0x78, 0xC0, 0x04, 0x02, 0x6B,
+        0x13, 0x10, 0xC3, 0x6B, 0x6B, 0xC0, 0x17, 0x7A, 0xC2, 0xA0, 0xB7, 0xC0, 0x15, 0x1C, 0xC2, 0x6B,
+        0x1C, 0x15, 0xC0, 0x53, 0x9D, 0x9A, 0x51, 0x9D, 0x99, 0x9C, 0x87, 0x9C, 0x88, 0x9C, 0x98, 0x60,
+        0x35, 0xC0, 0x6E, 0x7E, 0x05, 0xC5, 0x7E, 0xA6, 0x77, 0xA4, 0x79, 0xA3, 0x89, 0x2F, 0x99, 0xA9,
+        0x36, 0x9A, 0x99, 0xA2, 0x86, 0xA8, 0x75, 0xA2, 0x7A, 0x2D, 0xC0, 0x34, 0x6B, 0x2D, 0x60, 0xC0,
+        0x6E, 0x9C, 0xA9, 0x1A, 0x2D, 0x00, 0x07, 0x00, 0xA0, 0x8B, 0x69, 0xC0, 0x00, 0x2D, 0x6F, 0x2D,
+        0x9C, 0xA9, 0x36, 0x11, 0xA6, 0x76, 0xC0, 0x9D, 0xA9, 0xA5, 0x78, 0x66, 0x10, 0x1A, 0x34, 0x39,
+        0x2D, 0x2F, 0x9A, 0x99, 0x9B, 0xAA, 0x9D, 0x9A, 0x54, 0x66, 0xA5, 0x85, 0x3C, 0xA5, 0x79, 0x0E,
+        0x1C, 0xC0, 0x07, 0x2F, 0x98, 0x99, 0x08, 0x5A, 0x7D, 0x6B, 0x19, 0xC0, 0x6E, 0x2B, 0x19, 0xA3,
+        0x85, 0x1B, 0x99, 0xAB, 0x22, 0x6E, 0xA2, 0x78, 0x1F, 0xA3, 0x87, 0xA4, 0x68, 0x5A, 0x9C, 0xA9,
+        0xA3, 0x78, 0xA3, 0x79, 0x7A, 0xA1, 0x7B, 0xC0, 0x3E, 0x2B, 0x5F, 0x69, 0x2A, 0xC4, 0x6B, 0x6B,
+        0x7A, 0x5B, 0x6B, 0x3F, 0xC0, 0x03, 0x6B, 0xC0, 0x03, 0xC0, 0x68, 0xC0, 0x60, 0x9C, 0xAA, 0xA3,
+        0x78, 0x65, 0x9D, 0xAA, 0xA6, 0x67, 0xA1, 0x9A, 0x6B, 0xC0, 0x17, 0x10, 0x7A, 0xC0, 0x17, 0x6B,
+        0x17, 0xC0, 0x7A, 0x13, 0xC1, 0x1C, 0xC2, 0x15, 0xC0, 0x1C, 0xC3, 0x9C, 0x8A, 0x52, 0x60, 0x9C,
+        0x89, 0x9C, 0x87, 0x9C, 0x98, 0x9D, 0x98, 0x55, 0x79, 0xC0, 0x7E, 0x6E, 0x7F, 0xC1, 0x69, 0xC2,
+        0x7F, 0xA3, 0x89, 0xA5, 0x79, 0xA4, 0x86, 0xA3, 0x87, 0x98, 0x9B, 0x60, 0x69, 0xA5, 0x86, 0xA3,
+        0x87, 0x67, 0xA3, 0x88, 0xA4, 0x67, 0x6B, 0x6B, 0xC1, 0x21, 0x2D, 0x26, 0xA1, 0x8A, 0x68, 0x00,
+        0xC0, 0x07, 0x00, 0xC0, 0x2D, 0x07, 0x39, 0x34, 0x9B, 0xA8, 0xA3, 0x87, 0x66, 0x99, 0xAA, 0xA3,
+        0x87, 0xA4, 0x77, 0x6E, 0x15, 0xC0, 0x6E, 0x15, 0xA1, 0x8A, 0x21, 0x9D, 0x98, 0xA2, 0x8A, 0x66,
+        0x51, 0x9C, 0x98, 0x9A, 0x9A, 0xC1, 0xA3, 0x87, 0x28, 0xA2, 0x7C, 0xA0, 0x8B, 0x69, 0xA0, 0x85,
+        0x9D, 0xA7, 0x98, 0x99, 0x9C, 0x9A, 0x66, 0x0D, 0xA2, 0x78, 0x7E, 0x6E, 0xA2, 0x87, 0xA3, 0x88,
+        0x9C, 0x89, 0xA4, 0x76, 0x2C, 0x9D, 0xA9, 0x22, 0x3F, 0xA9, 0x56, 0xA4, 0x68, 0xC0, 0x61, 0x55,
+        0xA4, 0x69, 0x6F, 0xC1, 0x7A, 0xC0, 0xA0, 0x7A, 0x74, 0x3B, 0x34, 0x31, 0x6B, 0xC1, 0x68, 0x69,
+        0x9D, 0xAA, 0x7F, 0xA2, 0x6A, 0xC0, 0x02, 0x34, 0x31, 0x3F, 0x6B, 0xC0, 0x5A, 0xC1, 0x68, 0xC0,
+        0x65, 0xC0, 0x9C, 0xA9, 0x9C, 0xA9, 0xA8, 0x48, 0xA1, 0x9A, 0x7A, 0xC0, 0x17, 0x10, 0xC0, 0x13,
+        0x10, 0x17, 0xC0, 0x13, 0x7A, 0x69, 0x13, 0x6B, 0x1C, 0xC2, 0x15, 0xC3, 0x1C, 0xC0, 0x9C, 0x9A,
+        0x51, 0x50, 0x9A, 0x8A, 0x9C, 0x87, 0x9C, 0x98, 0x50, 0x65, 0x7E, 0x6E, 0x7E, 0x7F, 0xC0, 0x7A,
+        0xC0, 0x11, 0xC1, 0x7E, 0x6F, 0xA4, 0x89, 0xA3, 0x89, 0x04, 0x7A, 0x9A, 0x8A, 0x50, 0x79, 0xA2,
+        0x77, 0x66, 0xA4, 0x87, 0xA3, 0x86, 0xA5, 0x78, 0xA2, 0x79, 0xC1, 0x21, 0xA1, 0x8A, 0xC0, 0x00,
+        0x69, 0xA0, 0x8A, 0x6B, 0xC1, 0xA0, 0x84, 0x00, 0x2D, 0x00, 0x07, 0x34, 0xC0, 0x39, 0x21, 0x9C,
+        0x98, 0xA2, 0x88, 0x15, 0x34, 0x2D, 0x10, 0x6F, 0x2D, 0xC0, 0x64, 0x9D, 0x9A, 0xA0, 0x9A, 0x9D,
+        0x8A, 0x7D, 0x24, 0x9C, 0x99, 0xA4, 0x85, 0xA4, 0x77, 0x21, 0x00, 0xC0, 0xA0, 0x8C, 0x07, 0x00,
+        0xC0, 0x60, 0x05, 0x9A, 0x8A, 0x67, 0xA2, 0x86, 0xA5, 0x78, 0xA2, 0x87, 0x66, 0xA3, 0x77, 0xA2,
+        0x79, 0x69, 0x50, 0x66, 0x9D, 0x98, 0x3D, 0xA2, 0x78, 0xA4, 0x69, 0x69, 0x9D, 0xA8, 0x5A, 0xA3,
+        0x79, 0x3B, 0xC0, 0x64, 0x77, 0x66, 0xA2, 0x77, 0xA1, 0x7A, 0xC0, 0x68, 0x69, 0xA0, 0x7A, 0x6B,
+        0x38, 0x69, 0x2A, 0x61, 0x6F, 0x7B, 0x34, 0x3B, 0x34, 0x31, 0x38, 0x31, 0x3F, 0xC0, 0x03, 0xC0,
+        0x69, 0x69, 0x69, 0xC0, 0x29, 0x6B, 0x03, 0xA0, 0x9A, 0x79, 0xC1, 0x6B, 0x10, 0xC1, 0x17, 0xC0,
+        0x7A, 0x69, 0xC0, 0x1A, 0xC0, 0x1C, 0xC4, 0x69, 0xC0, 0x1C, 0x66, 0x1C, 0x51, 0x62, 0x99, 0x99,
+        0x9B, 0x89, 0x9C, 0x98, 0x9D, 0x98, 0x54, 0x66, 0x7E, 0x7E, 0xA2, 0x87, 0x6B, 0x7E, 0xC1, 0x66,
+        0x19, 0xC0, 0x6E, 0xA3, 0x89, 0xA4, 0x79, 0x7F, 0x7D, 0x69, 0x9C, 0x89, 0x61, 0xC1, 0xA2, 0x77,
+        0xA5, 0x96, 0x52, 0xA4, 0x76, 0x21, 0x66, 0xA2, 0x77, 0x9D, 0xA8, 0x26, 0x00, 0xA0, 0x8A, 0x07,
+        0x00, 0x0E, 0xA0, 0x8C, 0x68, 0x07, 0x68, 0x69, 0x0E, 0x15, 0x0E, 0x9F, 0x95, 0x9D, 0xA9, 0x6E,
+        0x21, 0x2D, 0xC0, 0x00, 0x39, 0xC0, 0x32, 0x39, 0xC0, 0x9E, 0x96, 0x62, 0xA2, 0x7A, 0xC0, 0x61,
+        0x9B, 0x9A, 0x68, 0xA6, 0x76, 0xA3, 0x78, 0x2D, 0x15, 0xA2, 0x7A, 0x00, 0xC0, 0x34, 0x9C, 0x99,
+        0x9D, 0x99, 0xC0, 0x61, 0x9D, 0x8B, 0xC0, 0x7F, 0xA3, 0x77, 0xA5, 0x87, 0xA3, 0x77, 0xA1, 0x8A,
+        0x5A, 0x69, 0x64, 0x9A, 0xA8, 0x9B, 0xAA, 0xA7, 0x68, 0xA3, 0x78, 0xC0, 0x61, 0x9B, 0xA9, 0xA8,
+        0x47, 0x6F, 0xC0, 0x3B, 0x02, 0x3B, 0x02, 0x6B, 0x3F, 0x02, 0x3B, 0x5A, 0x3F, 0x68, 0x69, 0xC0,
+        0x9C, 0xA8, 0xA2, 0x79, 0x76, 0x3B, 0x3F, 0x74, 0x38, 0x74, 0x38, 0xC0, 0x3F, 0xC0, 0x03, 0x69,
+        0x69, 0xC2, 0x3F, 0x3C, 0xA0, 0x9A, 0x7A, 0xC2, 0x13, 0x7A, 0x13, 0x5B, 0x13, 0xC0, 0x69, 0x13,
+        0xC0, 0x16, 0xA0, 0xA7, 0x6B, 0xC1, 0x15, 0x1C, 0xC0, 0x6B, 0x1C, 0xC1, 0x15, 0x9D, 0x98, 0x99,
+        0x9A, 0x9D, 0x98, 0x9D, 0x98, 0x9B, 0x99, 0x9D, 0x99, 0x66, 0x7E, 0xA2, 0x77, 0x11, 0x19, 0xC4,
+        0x6F, 0x7E, 0xA4, 0x79, 0xA3, 0x89, 0xC0, 0x69, 0x66, 0x12, 0x66, 0x06, 0xC0, 0x7E, 0xC1, 0xA8,
+        0x66, 0x9D, 0x99, 0xA2, 0x87, 0xA2, 0x76, 0x26, 0x66, 0x34, 0x00, 0x07, 0x15, 0x69, 0x23, 0x1C,
+        0x0E, 0x00, 0x69, 0x0E, 0xC0, 0x00, 0x64, 0xC0, 0x34, 0x2D, 0x00, 0x0E, 0xC0, 0x39, 0x0E, 0x1C,
+        0xC0, 0x00, 0x9D, 0xA7, 0xC0, 0x00, 0xC1, 0x39, 0x2D, 0x9D, 0xA8, 0x2D, 0x00, 0x2D, 0x00, 0x68,
+        0x07, 0x00, 0x22, 0x9D, 0xAA, 0x9D, 0x99, 0x51, 0x66, 0x26, 0x6B, 0x26, 0xA4, 0x77, 0xA7, 0x66,
+        0xA1, 0x7A, 0xC0, 0x69, 0x27, 0x9D, 0xA8, 0x5F, 0x9D, 0xA9, 0x24, 0x66, 0xA4, 0x68, 0xA3, 0x77,
+        0x66, 0x66, 0xA5, 0x68, 0xA0, 0x7A, 0x7B, 0x09, 0xC0, 0x5B, 0x09, 0x68, 0x2F, 0x6E, 0x5A, 0x28,
+        0x69, 0x2A, 0x66, 0xC0, 0xA0, 0x9A, 0x2F, 0x67, 0x3B, 0xC0, 0x55, 0x38, 0x2C, 0x2F, 0x3F, 0xC1,
+        0x3C, 0x03, 0x68, 0x29, 0x2C, 0x3C, 0x7B, 0x7B, 0xC0, 0x7A, 0xC4, 0x16, 0xC0, 0x13, 0x0F, 0x16,
+        0x7A, 0x7A, 0xC4, 0x23, 0xC0, 0x1C, 0x15, 0x1C, 0x15, 0x64, 0x99, 0x99, 0x98, 0x8A, 0x9B, 0xA8,
+        0x9C, 0x89, 0xC0, 0x7E, 0x7E, 0x11, 0xC0, 0x7E, 0xC2, 0x6E, 0xC0, 0x7F, 0xA2, 0x88, 0xA4, 0x79,
+        0xA2, 0x78, 0x66, 0x69, 0x26, 0x12, 0x66, 0xC0, 0x69, 0x7E, 0x5A, 0xA5, 0x97, 0x5A, 0x0E, 0x31,
+        0x18, 0xA9, 0x76, 0xA2, 0x78, 0x6E, 0x65, 0x32, 0xA0, 0x8C, 0x15, 0x0E, 0x07, 0xC1, 0x68, 0x2D,
+        0x00, 0x39, 0x32, 0x39, 0xC0, 0x00, 0x0E, 0x15, 0xC0, 0x0E, 0xC0, 0x23, 0xC0, 0x15, 0x39, 0x00,
+        0x07, 0x00, 0x65, 0x9C, 0xA9, 0x6D, 0x39, 0x0E, 0xC0, 0x39, 0x32, 0x39, 0x07, 0x00, 0x9D, 0xA9,
+        0x04, 0x69, 0x9C, 0x9A, 0x66, 0x26, 0xA3, 0x88, 0x3D, 0xA2, 0x77, 0xA2, 0x88, 0xA4, 0x68, 0x3A,
+        0x65, 0x27, 0x64, 0x53, 0x9C, 0xA8, 0x6E, 0x9A, 0xAA, 0x6E, 0xAB, 0x37, 0x9B, 0xB9, 0xA3, 0x79,
+        0xA3, 0x78, 0x3B, 0xA0, 0x7A, 0xA0, 0x8A, 0x69, 0x10, 0x68, 0x3B, 0xC0, 0x69, 0x2D, 0x5B, 0x28,
+        0x31, 0x3C, 0x69, 0x34, 0x71, 0x63, 0x36, 0x06, 0x69, 0xC0, 0x38, 0x3F, 0x03, 0x06, 0x3F, 0x3C,
+        0xC0, 0x35, 0x29, 0x6E, 0x3F, 0xC1, 0x9B, 0xC9, 0xA4, 0x79, 0x0F, 0x13, 0x16, 0xC2, 0x79, 0x16,
+        0xC0, 0x7A, 0x66, 0x15, 0xC0, 0x6B, 0x15, 0xA0, 0x8A, 0xC0, 0x6B, 0x1C, 0x23, 0x1C, 0x15, 0x69,
+        0x64, 0x96, 0x99, 0x96, 0x9B, 0xA2, 0x86, 0x9A, 0x8A, 0x30, 0xA3, 0x87, 0xA4, 0x86, 0x9D, 0xAB,
+        0xC0, 0x6E, 0xC1, 0x1E, 0xC0, 0x7F, 0x6F, 0xA3, 0x89, 0x3E, 0xC0, 0x66, 0x69, 0x61, 0x55, 0xC3,
+        0x7D, 0xA3, 0x88, 0x0B, 0xC0, 0xA3, 0x97, 0xC0, 0xA7, 0x77, 0xA4, 0x68, 0x60, 0x6E, 0x39, 0x0E,
+        0xC0, 0x00, 0x6B, 0x00, 0x39, 0xC0, 0x65, 0x00, 0x07, 0x39, 0x26, 0x21, 0xC0, 0x39, 0x0E, 0x07,
+        0x0E, 0x6B, 0x23, 0x69, 0x0E, 0x39, 0x00, 0x39, 0x00, 0x9C, 0xA8, 0x6E, 0x26, 0x6F, 0x0E, 0xC1,
+        0x00, 0xC1, 0x39, 0x63, 0x69, 0x23, 0x9A, 0x9A, 0x9D, 0x9A, 0xC0, 0x04, 0xC0, 0x69, 0xA4, 0x77,
+        0xA2, 0x77, 0xA2, 0x6A, 0x64, 0x58, 0x61, 0x99, 0xBA, 0x24, 0x18, 0x09, 0x24, 0xA6, 0x57, 0x61,
+        0x6B, 0x28, 0xA1, 0x7A, 0xA0, 0x8A, 0xA0, 0x8A, 0x0D, 0x79, 0x78, 0x69, 0x61, 0xC0, 0xA2, 0x67,
+        0xC0, 0x61, 0x2D, 0x3C, 0x35, 0x78, 0x34, 0x6B, 0x5B, 0x06, 0xC0, 0x3F, 0x38, 0x3F, 0xA0, 0x7A,
+        0x06, 0x38, 0x31, 0x38, 0x3C, 0x29, 0xC0, 0x9D, 0xBA, 0x6E, 0x6E, 0x9D, 0xAA, 0x7F, 0xA3, 0x99,
+        0x0F, 0x77, 0xC0, 0x0F, 0x7B, 0x62, 0xC0, 0x19, 0x16, 0x19, 0x7A, 0xC2, 0xA0, 0x8A, 0xC0, 0x6B,
+        0x68, 0xC0, 0x15, 0xC0, 0x0E, 0x00, 0x9B, 0x99, 0x96, 0x98, 0x7B, 0x97, 0x9B, 0xA7, 0x86, 0xA4,
+        0x86, 0x9A, 0x9A, 0x11, 0x7E, 0xC2, 0x6E, 0x7F, 0x6E, 0xA1, 0x9A, 0xA4, 0x78, 0xA3, 0x79, 0x65,
+        0xC0, 0x65, 0x61, 0x12, 0xC3, 0x7D, 0x0B, 0x66, 0x0B, 0xA5, 0x85, 0xA6, 0x76, 0xA2, 0x7A, 0x00,
+        0xC0, 0x07, 0x15, 0x1C, 0x68, 0x00, 0x07, 0x00, 0x68, 0xC1, 0x00, 0x0E, 0x00, 0x65, 0x39, 0xC0,
+        0x64, 0x00, 0x26, 0x39, 0x15, 0x1C, 0x15, 0x07, 0x0E, 0x00, 0x34, 0x39, 0x00, 0x2D, 0x1A, 0x2D,
+        0x07, 0xC0, 0x39, 0x00, 0x07, 0x00, 0x39, 0x9D, 0xAA, 0xA2, 0x78, 0x64, 0x9D, 0x99, 0x9C, 0x9A,
+        0x33, 0x1B, 0x25, 0xC0, 0xA2, 0x68, 0xC0, 0x01, 0x37, 0xC0, 0x9E, 0x96, 0x9D, 0xAA, 0xA2, 0x77,
+        0x9C, 0x98, 0x9D, 0xA9, 0xA3, 0x77, 0x10, 0x66, 0x6F, 0xA3, 0x78, 0x6B, 0x3F, 0x6B, 0x7A, 0xC0,
+        0x68, 0x75, 0x66, 0x69, 0x5E, 0x6D, 0x6B, 0x28, 0x5A, 0xA1, 0x8A, 0x69, 0x28, 0x3B, 0x06, 0xC2,
+        0x3F, 0x38, 0x3F, 0xC0, 0x38, 0xC0, 0x3F, 0xA0, 0x7A, 0x68, 0x9C, 0xA6, 0x9B, 0xBB, 0xA4, 0x77,
+        0x51, 0xC0, 0xA2, 0x99, 0xA1, 0x9A, 0x7F, 0xA2, 0x78, 0x72, 0xA3, 0x76, 0x14, 0x9D, 0x9A, 0xC0,
+        0x0A, 0xA3, 0x77, 0x12, 0x9E, 0x9B, 0xC0, 0xA2, 0x87, 0x15, 0x23, 0x6B, 0xC0, 0x23, 0x2A, 0x1C,
+        0x07, 0x9D, 0x98, 0x6D, 0x62, 0x1F, 0x75, 0x6B, 0x6D, 0x96, 0x9B, 0x67, 0x7A, 0x6E, 0xC1, 0x1E,
+        0xC0, 0x7F, 0x6F, 0xA3, 0x88, 0x3E, 0x7F, 0x51, 0xC0, 0x65, 0x12, 0xC2, 0x66, 0x69, 0xC0, 0x0D,
+        0x06, 0xC0, 0x0D, 0xA5, 0x85, 0xA9, 0x66, 0x07, 0x0E, 0x07, 0x23, 0xC0, 0x0E, 0x07, 0x69, 0x69,
+        0x65, 0xC0, 0x62, 0xA2, 0x78, 0x00, 0x39, 0x34, 0x00, 0x39, 0x69, 0x39, 0x9D, 0xA6, 0x32, 0x39,
+        0xA0, 0x8B, 0x1C, 0xC0, 0x15, 0x07, 0xC1, 0x00, 0x39, 0xC0, 0x00, 0x0E, 0x07, 0x39, 0xC0, 0x0E,
+        0x07, 0x0E, 0x00, 0x0E, 0x23, 0x55, 0x62, 0xA3, 0x78, 0x69, 0xA3, 0x79, 0x61, 0x20, 0xA2, 0x68,
+        0x6F, 0x37, 0x69, 0x9C, 0xA7, 0x99, 0xBA, 0xA3, 0x88, 0x5A, 0x13, 0x1F, 0xA3, 0x78, 0x6B, 0xA2,
+        0x77, 0x10, 0x28, 0x6F, 0xC0, 0xA0, 0x8A, 0x74, 0x02, 0x79, 0x61, 0x32, 0x34, 0x69, 0xC0, 0x10,
+        0xA2, 0x78, 0x5F, 0x38, 0xC0, 0x03, 0xC0, 0x7A, 0xC1, 0x3F, 0x74, 0x38, 0x2F, 0x65, 0x28, 0x3F,
+        0xC0, 0x38, 0x3D, 0x33, 0xA3, 0x88, 0x9C, 0x99, 0x65, 0xA0, 0x8A, 0xA1, 0xAA, 0xA3, 0x89, 0xA4,
+        0x76, 0x67, 0x6E, 0xC0, 0x02, 0x66, 0xC0, 0x07, 0xA3, 0x86, 0x9D, 0xAC, 0xA2, 0x87, 0x15, 0xC0,
+        0x1C, 0xC1, 0x15, 0x1C, 0x15, 0x68, 0x19, 0xA0, 0x9A, 0x9D, 0x88, 0xA2, 0x9A, 0x59, 0x9B, 0xA7,
+        0x0F, 0x52, 0x7F, 0x7E, 0xC2, 0x6E, 0x7B, 0x6E, 0xA2, 0x78, 0xA4, 0x89, 0xA3, 0x79, 0x65, 0x66,
+        0x69, 0x61, 0x55, 0xC1, 0x0D, 0x69, 0xC3, 0x6E, 0xA4, 0x86, 0xA6, 0x77, 0xA2, 0x77, 0xA1, 0x8A,
+        0xA1, 0x8A, 0x0E, 0xA0, 0x8B, 0x1C, 0xA0, 0x84, 0x69, 0x00, 0x39, 0x69, 0x9D, 0xA9, 0x17, 0xA3,
+        0x78, 0x32, 0x39, 0xC3, 0x32, 0x1A, 0x26, 0x32, 0x39, 0x07, 0x23, 0x69, 0x00, 0x0E, 0xC0, 0x39,
+        0x32, 0xC0, 0x0E, 0x15, 0x00, 0xC0, 0x0E, 0x1C, 0x23, 0x1C, 0x0E, 0x07, 0x54, 0xC0, 0x65, 0x6B,
+        0xC0, 0x01, 0x3A, 0x65, 0x6E, 0x3A, 0x5B, 0x9E, 0x96, 0x64, 0x62, 0x9B, 0xAA, 0xA4, 0x67, 0x65,
+        0x3A, 0xA2, 0x78, 0xA3, 0x79, 0x69, 0x62, 0xA3, 0x79, 0x69, 0xC0, 0x3B, 0x75, 0x3E, 0xA0, 0x7A,
+        0x3B, 0x3F, 0xC0, 0x34, 0x9C, 0xA8, 0x9B, 0xB9, 0x21, 0xA1, 0x7A, 0x38, 0x5A, 0xA0, 0x9A, 0xC0,
+        0x3F, 0x3E, 0x56, 0xC0, 0x3B, 0x9D, 0xA8, 0x62, 0x2F, 0xC0, 0x14, 0xA3, 0x67, 0xC0, 0x9B, 0xBA,
+        0x96, 0xBB, 0xA5, 0x78, 0x66, 0x52, 0xC0, 0xA3, 0x99, 0xA3, 0x89, 0xA3, 0x88, 0x3D, 0xC0, 0x6E,
+        0x3D, 0xC2, 0xA2, 0x77, 0x7B, 0x6E, 0x7D, 0x1C, 0x69, 0x1C, 0x15, 0x1C, 0xC0, 0x0E, 0x64, 0x50,
+        0x27, 0x62, 0xA1, 0x9A, 0x69, 0x2A, 0x9D, 0x88, 0x9C, 0x99, 0x9C, 0x9A, 0x67, 0x19, 0xC1, 0x6E,
+        0x7F, 0x6E, 0x0D, 0xA4, 0x79, 0x0A, 0x65, 0x39, 0x65, 0x60, 0x5A, 0xC1, 0x0D, 0x69, 0xC2, 0x6E,
+        0xA4, 0x86, 0xA2, 0x88, 0x9D, 0x99, 0xC0, 0xA8, 0x65, 0xA1, 0x8A, 0x0E, 0x23, 0x0E, 0xA0, 0x85,
+        0x66, 0x39, 0x0E, 0x3B, 0x34, 0x39, 0x9C, 0xA8, 0x28, 0x69, 0x6F, 0xA1, 0x8A, 0xC1, 0x2D, 0x1A,
+        0x26, 0x9A, 0xA9, 0xA3, 0x88, 0x39, 0x00, 0xC0, 0x0E, 0xC1, 0x2D, 0xC0, 0x39, 0x0E, 0x6B, 0x68,
+        0x0E, 0x1C, 0xA0, 0x8A, 0xC0, 0x23, 0x2A, 0x58, 0x69, 0x68, 0x64, 0x65, 0xA2, 0x79, 0xA0, 0x7A,
+        0x68, 0x01, 0x5B, 0xA0, 0x8A, 0x69, 0x9F, 0x94, 0xC0, 0x51, 0x61, 0xA3, 0x78, 0xC0, 0x6B, 0xA2,
+        0x78, 0x6B, 0x2D, 0x1C, 0xC0, 0x6E, 0x2D, 0xA0, 0x8A, 0x7A, 0xC0, 0x5B, 0x5B, 0x6B, 0x06, 0x34,
+        0x65, 0x61, 0x21, 0x5F, 0x6B, 0x2A, 0x38, 0x3B, 0x9D, 0xB9, 0x36, 0xC0, 0x61, 0x3B, 0x9D, 0xA8,
+        0xC0, 0x67, 0x9A, 0xB9, 0x69, 0xA3, 0x68, 0x9C, 0xA8, 0xA7, 0x58, 0x98, 0xBA, 0x9C, 0x99, 0xA1,
+        0x9A, 0x56, 0x66, 0xA3, 0x88, 0xA4, 0x88, 0xA3, 0x89, 0x7F, 0x6E, 0xC4, 0x6E, 0xA2, 0x89, 0x69,
+        0x6D, 0x7E, 0x69, 0x1C, 0x15, 0x1C, 0x23, 0x1C, 0x9F, 0x96, 0x65, 0x9F, 0x9B, 0x33, 0x9F, 0x86,
+        0x7A, 0x50, 0x9A, 0x87, 0x9C, 0x9A, 0x9D, 0x9A, 0x57, 0x7A, 0xC0, 0x6E, 0xC0, 0x7F, 0x32, 0xA3,
+        0x8A, 0xA4, 0x78, 0xC0, 0x66, 0x69, 0x61, 0x51, 0x69, 0xC0, 0x0D, 0x06, 0xC3, 0x0B, 0xC0, 0x06,
+        0xC0, 0xA5, 0x85, 0xA3, 0x89, 0x55, 0x07, 0x15, 0x07, 0x69, 0x65, 0x07, 0x15, 0x07, 0x9D, 0xA7,
+        0x51, 0x23, 0xC0, 0x0F, 0xA5, 0x78, 0x07, 0xC0, 0x00, 0x9E, 0x96, 0x65, 0x9A, 0x9A, 0x06, 0xA9,
+        0x75, 0xA5, 0x78, 0x61, 0x6F, 0x1C, 0x07, 0x0E, 0x00, 0x39, 0x69, 0x00, 0x0E, 0xC0, 0x6B, 0xA0,
+        0x8A, 0x6B, 0x6B, 0x59, 0xC1, 0x69, 0x04, 0x68, 0xC0, 0x01, 0x6B, 0x3A, 0xC0, 0x05, 0xA0, 0x8B,
+        0x59, 0xA0, 0x84, 0x64, 0xC0, 0x66, 0x21, 0x6E, 0x1C, 0x69, 0x5F, 0xC0, 0x21, 0x6B, 0x5E, 0x6B,
+        0xA0, 0x9A, 0xC0, 0x5B, 0xC0, 0x6B, 0xC0, 0x68, 0x34, 0x26, 0x9B, 0xBA, 0x66, 0xA2, 0x78, 0xC0,
+        0xA3, 0x68, 0x99, 0xDA, 0xA5, 0x68, 0x9C, 0xBA, 0xC0, 0xA2, 0x78, 0xA3, 0x77, 0x59, 0x28, 0x98,
+        0xCB, 0x9D, 0xAA, 0x66, 0xA2, 0x76, 0x5A, 0x9B, 0xAA, 0xA3, 0x77, 0xA5, 0x78, 0x98, 0xAA, 0x67,
+        0xA2, 0x88, 0x52, 0x6E, 0x35, 0xA3, 0x89, 0x2E, 0x3D, 0xC4, 0x6E, 0x1D, 0x65, 0x6E, 0x7D, 0x6D,
+        0xC1, 0x6B, 0x6B, 0x15, 0x9E, 0x85, 0xA0, 0x9A, 0x63, 0x9F, 0x85, 0x2F, 0x9D, 0x99, 0x3E, 0x9A,
+        0x88, 0x98, 0x9B, 0xC3, 0x7F, 0xC0, 0x6F, 0xA2, 0x88, 0x2A, 0xA2, 0x89, 0x65, 0x69, 0x66, 0x50,
+        0x65, 0x66, 0xCA, 0x6D, 0x66, 0xA7, 0x77, 0xA8, 0x66, 0x6F, 0x66, 0xC1, 0x39, 0x07, 0x65, 0x64,
+        0x2D, 0x39, 0xC0, 0x69, 0x2D, 0x32, 0x00, 0x07, 0x00, 0x9C, 0xA6, 0x99, 0xAB, 0xC0, 0xA8, 0x66,
+        0x9C, 0x98, 0x20, 0xA7, 0x75, 0x28, 0x0E, 0x07, 0xA0, 0x8B, 0x07, 0xC0, 0x39, 0x0E, 0xC1, 0x15,
+        0x1C, 0xA0, 0x8A, 0x27, 0xC2, 0xA0, 0x85, 0xA0, 0x75, 0x36, 0x5A, 0xA0, 0x8A, 0x33, 0x3A, 0x5B,
+        0x6B, 0x5A, 0xA0, 0x85, 0x6B, 0x2D, 0x21, 0xC1, 0x65, 0x66, 0x65, 0x5B, 0x66, 0xA4, 0x67, 0x6F,
+        0xA0, 0x8A, 0x6B, 0x6B, 0xC0, 0xA0, 0x8A, 0x5A, 0x14, 0x3F, 0x68, 0x9A, 0xC8, 0x0B, 0xA2, 0x77,
+        0x2B, 0xA2, 0x77, 0xA4, 0x58, 0x0B, 0xA5, 0x68, 0xA3, 0x89, 0x66, 0x67, 0xA3, 0x77, 0x59, 0xA2,
+        0x77, 0x98, 0xCA, 0x6B, 0xC0, 0x61, 0x51, 0x57, 0x50, 0xA4, 0x77, 0x56, 0x9C, 0x9A, 0xA3, 0x89,
+        0x6F, 0x61, 0xA3, 0x88, 0xA4, 0x88, 0x29, 0x6F, 0x7E, 0xC2, 0x66, 0x3D, 0xA2, 0x88, 0xC1, 0x6D,
+        0xA2, 0x86, 0x52, 0x15, 0x65, 0x0E, 0x9E, 0x96, 0xC0, 0x9C, 0x87, 0xA1, 0x9B, 0x9D, 0x97, 0x69,
+        0x98, 0x99, 0x69, 0x16, 0x97, 0xAA, 0x6B, 0x52, 0xC0, 0x6E, 0x7A, 0x6F, 0x25, 0xA3, 0x89, 0xA5,
+        0x89, 0x6E, 0x51, 0x7A, 0x51, 0x60, 0xC8, 0x59, 0xC0, 0x66, 0xC1, 0x7E, 0xAA, 0x65, 0xC0, 0xA2,
+        0x88, 0x52, 0x66, 0xA2, 0x77, 0xA3, 0x88, 0xC1, 0x66, 0x28, 0x6F, 0x28, 0x17, 0xA2, 0x77, 0x28,
+        0x34, 0x0E, 0x68, 0x28, 0x17, 0x68, 0x56, 0x9A, 0xAA, 0x52, 0xA4, 0x87, 0xA6, 0x67, 0x0E, 0xA0,
+        0x8A, 0xA0, 0x8A, 0x1C, 0xA0, 0x83, 0xC0, 0x07, 0x15, 0x07, 0xC0, 0x59, 0x6B, 0xA0, 0x8A, 0xA0,
+        0x8A, 0x27, 0xC0, 0xA0, 0x84, 0x59, 0x69, 0xC1, 0x01, 0x59, 0xC0, 0x65, 0xA1, 0x8A, 0x26, 0x6B,
+        0xC0, 0x65, 0x9D, 0xA8, 0x62, 0x04, 0x9D, 0xAA, 0xA3, 0x68, 0xA3, 0x78, 0xC1, 0x6F, 0x31, 0x3F,
+        0xA0, 0x8A, 0x6B, 0x06, 0x14, 0x59, 0x06, 0x68, 0x9C, 0xB6, 0x9A, 0xBA, 0xA4, 0x56, 0x9D, 0xB9,
+        0x5A, 0x6B, 0x9C, 0xA9, 0x63, 0xA4, 0x78, 0xA2, 0x88, 0xA4, 0x67, 0xA3, 0x78, 0x5E, 0x61, 0x9C,
+        0xA8, 0x9A, 0xBA, 0x6B, 0x66, 0x51, 0x5A, 0x55, 0x62, 0x3A, 0x52, 0x7F, 0xA3, 0x88, 0x56, 0xC0,
+        0xA4, 0x88, 0xA3, 0x89, 0xA3, 0x88, 0x7F, 0xC1, 0x5A, 0x2E, 0x3D, 0x6F, 0x11, 0xC0, 0xA2, 0x76,
+        0x62, 0xA2, 0x86, 0x55, 0x51, 0xA2, 0x87, 0x24, 0xA5, 0x9A, 0x61, 0x6B, 0x05, 0x9E, 0x86, 0x9C,
+        0x88, 0x99, 0x9B, 0xA3, 0x97, 0x7E, 0x29, 0x9A, 0x9B, 0xC1, 0x7E, 0x6F, 0xA2, 0x78, 0xA4, 0x89,
+        0xA3, 0x89, 0x5A, 0x61, 0x1E, 0x61, 0x32, 0xCA, 0x66, 0xC1, 0xA5, 0x86, 0xA2, 0x78, 0x6B, 0x6B,
+        0xA2, 0x86, 0x6B, 0xC0, 0x66, 0xA4, 0x76, 0xA5, 0x77, 0x9C, 0x9A, 0x60, 0x0A, 0x0F, 0x99, 0xAB,
+        0xA3, 0x86, 0xA2, 0x86, 0xA3, 0x89, 0xA3, 0x7A, 0x60, 0x9C, 0x98, 0x9B, 0x9A, 0x69, 0x9D, 0x9B,
+        0xA3, 0x97, 0x23, 0x1C, 0x07, 0xA0, 0x8C, 0xC1, 0x68, 0x00, 0x68, 0x6B, 0x07, 0xC0, 0x00, 0xC0,
+        0x5A, 0xA0, 0x8C, 0x6B, 0xC0, 0x58, 0x69, 0x68, 0xC0, 0x08, 0x69, 0x5B, 0xC0, 0x69, 0x69, 0x3E,
+        0x9E, 0x96, 0x0B, 0x6E, 0x04, 0xC0, 0x99, 0xCA, 0xA2, 0x78, 0x9C, 0x99, 0xA6, 0x57, 0xA6, 0x57,
+        0x6E, 0x1E, 0x6F, 0x6B, 0x6B, 0xA0, 0x8A, 0x6B, 0x06, 0xC0, 0x0D, 0x06, 0xC0, 0x9F, 0x96, 0x64,
+        0x9A, 0xB9, 0x99, 0xCA, 0x66, 0xC0, 0xA3, 0x77, 0x9C, 0xAA, 0xA3, 0x8A, 0xA2, 0x78, 0xA3, 0x77,
+        0xA6, 0x67, 0x3E, 0x51, 0x9C, 0xA9, 0x9C, 0xA9, 0x9D, 0xA9, 0x25, 0x51, 0x55, 0x66, 0x51, 0x6B,
+        0xC0, 0x5A, 0xA3, 0x89, 0x7E, 0x0D, 0xA2, 0x88, 0xA4, 0x88, 0xA3, 0x89, 0xA2, 0x88, 0xC1, 0x56,
+        0x2E, 0xC0, 0xA3, 0x99, 0x6E, 0x56, 0x7D, 0x7E, 0x6E, 0x9B, 0x99, 0x50, 0xA4, 0x85, 0x9B, 0x99,
+        0xA3, 0x98, 0xA1, 0x8A, 0x65, 0x60, 0x97, 0x98, 0x7E, 0xA3, 0x87, 0x9D, 0x99, 0x9B, 0x9B, 0xA6,
+        0x87, 0x9A, 0x8A, 0x52, 0x7E, 0xC0, 0x6F, 0x32, 0x25, 0xA2, 0x88, 0x25, 0x1E, 0x66, 0x9D, 0x98,
+        0x65, 0xCA, 0x69, 0xC1, 0xA3, 0x87, 0x9F, 0x9B, 0x1E, 0x25, 0x1E, 0xC0, 0x7D, 0x6E, 0xA2, 0x87,
+        0xA3, 0x88, 0x24, 0x31, 0x24, 0x7E, 0x31, 0x0C, 0xA5, 0x87, 0x0C, 0xAA, 0x66, 0x99, 0xA9, 0x66,
+        0x66, 0xC0, 0x00, 0xA5, 0x87, 0xA3, 0x87, 0xA2, 0x79, 0xA3, 0x7A, 0xA1, 0x8C, 0xA0, 0x8A, 0x07,
+        0x69, 0x9C, 0xA5, 0xA2, 0x79, 0xA2, 0x79, 0x00, 0xA0, 0x8A, 0xC0, 0x5A, 0xC0, 0x20, 0xC1, 0x58,
+        0x68, 0x9F, 0x96, 0x6F, 0xA0, 0x7B, 0x6B, 0xC1, 0x3E, 0x05, 0x9D, 0xA7, 0x50, 0x65, 0x9D, 0x99,
+        0xA4, 0x66, 0x7B, 0x9A, 0xA9, 0x66, 0xA2, 0x78, 0x21, 0xA7, 0x57, 0xC0, 0x6F, 0xA1, 0x8A, 0xC0,
+        0xA0, 0x8A, 0xC0, 0x6B, 0xC0, 0x3F, 0x06, 0x5B, 0x69, 0x78, 0x9C, 0xA6, 0x97, 0xDA, 0x2D, 0xC1,
+        0x6E, 0x2D, 0xA2, 0x78, 0xA5, 0x79, 0xA2, 0x77, 0xA2, 0x78, 0xA5, 0x78, 0x9C, 0x98, 0x9C, 0xA9,
+        0x39, 0x34, 0xC0, 0x9D, 0x99, 0x02, 0x6B, 0x61, 0x55, 0x30, 0x5A, 0x7F, 0xA3, 0x89, 0x65, 0x6E,
+        0xA3, 0x89, 0xA4, 0x78, 0xA2, 0x89, 0x3D, 0xC0, 0x35, 0x65, 0xC0, 0xA6, 0x87, 0x23, 0x17, 0xC0,
+        0x6E, 0xC0, 0x9C, 0x98, 0x9E, 0x86, 0xA2, 0x85, 0x52, 0x7B, 0xA1, 0x8A, 0x7A, 0x9F, 0x86, 0x51,
+        0x9D, 0x98, 0x9B, 0x99, 0xA2, 0x88, 0x99, 0x9B, 0xA8, 0x85, 0x9D, 0x99, 0x9C, 0x8A, 0xA3, 0x87,
+        0x0D, 0xA2, 0x88, 0xA3, 0x7A, 0xA5, 0x79, 0x65, 0x65, 0xC0, 0x9D, 0xA9, 0x50, 0x21, 0xC0, 0x6E,
+        0xC2, 0x2D, 0xC2, 0x26, 0x21, 0xC2, 0x26, 0x3E, 0x25, 0x65, 0xC1, 0x69, 0x19, 0x12, 0x1F, 0x6E,
+        0x1F, 0x56, 0x12, 0xA5, 0x86, 0x9A, 0x99, 0x7E, 0x65, 0xAA, 0x55, 0x9A, 0xAA, 0x9A, 0x8A, 0xA2,
+        0x87, 0x19, 0xC0, 0xA3, 0x87, 0xA4, 0x77, 0x6B, 0xA3, 0x79, 0x00, 0xA0, 0x8B, 0x9E, 0x94, 0xA2,
+        0x77, 0x09, 0x9D, 0xA9, 0x5E, 0xA3, 0x8A, 0xA3, 0x79, 0x5A, 0xC0, 0xA0, 0x8A, 0xA0, 0x8D, 0x5A,
+        0x27, 0xA0, 0x74, 0xC0, 0x68, 0x6B, 0x68, 0xA0, 0x7A, 0x0C, 0xC0, 0x5B, 0x69, 0x9F, 0xA6, 0x60,
+        0x9D, 0x98, 0x9C, 0x98, 0xA8, 0x47, 0x61, 0x95, 0xEB, 0x9D, 0x9A, 0xA2, 0x87, 0xA6, 0x57, 0x6D,
+        0xA2, 0x78, 0xA4, 0x68, 0xA3, 0x79, 0x5B, 0xA0, 0x8A, 0x7A, 0xC1, 0x69, 0xA0, 0x8A, 0x5B, 0xC0,
+        0x38, 0x9E, 0x96, 0x1C, 0x99, 0xCB, 0x21, 0xC2, 0x6F, 0xA4, 0x79, 0xA2, 0x78, 0xA5, 0x67, 0x7B,
+        0x55, 0x2A, 0x51, 0xC1, 0x25, 0x51, 0x02, 0x66, 0x51, 0x6B, 0xC0, 0x5A, 0xA3, 0x89, 0x7F, 0x65,
+        0xA2, 0x78, 0xA4, 0x88, 0xA3, 0x89, 0xA2, 0x88, 0xC0, 0x55, 0x29, 0xC0, 0xA4, 0x88, 0x69, 0x6E,
+        0xA2, 0x87, 0xC1, 0x9E, 0x86, 0x9D, 0x97, 0x60, 0x99, 0x9B, 0xA4, 0x86, 0x1D, 0xA1, 0x9A, 0x64,
+        0x9E, 0x85, 0x95, 0x9A, 0x67, 0xAA, 0x75, 0x9A, 0x9A, 0xA2, 0x87, 0xA3, 0x88, 0x05, 0x9C, 0x89,
+        0x66, 0xA4, 0x78, 0xA2, 0x7A, 0xA2, 0x89, 0x2A, 0x65, 0x65, 0x60, 0x9D, 0x99, 0xC7, 0x26, 0x21,
+        0xC4, 0x26, 0xA3, 0x8A, 0x25, 0x19, 0xC0, 0x0D, 0x12, 0x19, 0x0D, 0x19, 0x12, 0xC0, 0x0D, 0xC0,
+        0xA4, 0x76, 0x60, 0x9D, 0x99, 0x0C, 0xA6, 0x75, 0x99, 0xAB, 0x38, 0xA3, 0x98, 0xA2, 0x87, 0xA4,
+        0x77, 0x66, 0x56, 0x30, 0xA2, 0x79, 0x28, 0xA2, 0x79, 0x9B, 0xA8, 0x64, 0xA3, 0x87, 0x30, 0x66,
+        0xC0, 0xA5, 0x68, 0x6D, 0xA1, 0x8B, 0x6B, 0xA1, 0x8C, 0x5A, 0x6B, 0xC0, 0x0F, 0x59, 0x69, 0xA0,
+        0x95, 0x3E, 0xA0, 0x8A, 0x5B, 0x6B, 0x68, 0x69, 0x64, 0x9D, 0x97, 0x6E, 0xA2, 0x78, 0x0D, 0x98,
+        0xC9, 0x9D, 0x99, 0x0B, 0xA4, 0x67, 0x10, 0xA4, 0x67, 0x0D, 0x6E, 0xA2, 0x69, 0x7A, 0x6B, 0x6B,
+        0x79, 0xA0, 0x7A, 0xC1, 0x5A, 0x74, 0x9C, 0xA7, 0x61, 0x9C, 0xA9, 0x9B, 0xBA, 0x9D, 0x99, 0xC2,
+        0xA3, 0x89, 0xA4, 0x79, 0xA4, 0x67, 0x9D, 0xAA, 0x7E, 0x55, 0x9D, 0x99, 0xC0, 0x66, 0x25, 0x56,
+        0x51, 0xC0, 0x61, 0x56, 0x6E, 0x30, 0x6F, 0xA4, 0x78, 0x66, 0xC0, 0xA4, 0x78, 0xA3, 0x99, 0xA2,
+        0x78, 0x6E, 0x2E, 0x29, 0x56, 0xA4, 0x88, 0x3D, 0x0A, 0xA2, 0x87, 0x6E, 0x69, 0x9D, 0x97, 0x9B,
+        0x99, 0x9A, 0x98, 0x51, 0xA8, 0x86, 0x7F, 0xA3, 0x8A, 0x9E, 0x86, 0x9F, 0x96, 0x9C, 0x89, 0x9B,
+        0x9A, 0xA7, 0x97, 0x6B, 0xA3, 0x77, 0xA2, 0x89, 0x9D, 0x98, 0x26, 0x2D, 0xA3, 0x78, 0xA0, 0x8A,
+        0x52, 0x9C, 0x99, 0x23, 0x7D, 0x9B, 0x99, 0x9D, 0xA9, 0xCE, 0x6F, 0xA4, 0x78, 0x6F, 0x61, 0x19,
+        0x0D, 0xC0, 0x6B, 0x0D, 0x19, 0x0D, 0x19, 0x12, 0x0D, 0x12, 0x68, 0x07, 0xA3, 0x87, 0xA3, 0x87,
+        0x9B, 0xAB, 0x07, 0x66, 0x19, 0xA4, 0x87, 0xA3, 0x77, 0x9B, 0xAA, 0xA6, 0x67, 0x6F, 0x63, 0xA3,
+        0x78, 0x28, 0x9C, 0xA8, 0x9F, 0x86, 0x9C, 0x9A, 0x9A, 0x9B, 0xA2, 0x77, 0xAA, 0x65, 0x29, 0x9D,
+        0x9B, 0xA7, 0x68, 0xA3, 0x7A, 0xC0, 0x5B, 0x6B, 0xA0, 0x8A, 0x5A, 0x68, 0x69, 0x69, 0x05, 0xA0,
+        0x7A, 0xC0, 0xA0, 0x85, 0x3E, 0x3B, 0x69, 0x5B, 0x64, 0x69, 0x99, 0xC9, 0x61, 0x66, 0x9C, 0x99,
+        0x62, 0xA3, 0x77, 0x1A, 0xA3, 0x79, 0x1E, 0x9D, 0xA9, 0x1E, 0x31, 0x3F, 0x38, 0x3B, 0x3F, 0x70,
+        0x5E, 0x95, 0xFA, 0x9B, 0xA9, 0xC1, 0x65, 0x66, 0x5A, 0xC0, 0xA2, 0x89, 0xA4, 0x78, 0xA4, 0x67,
+        0x9C, 0xAA, 0xA2, 0x88, 0x55, 0x61, 0x6B, 0x55, 0x20, 0x25, 0x11, 0x66, 0x5A, 0x51, 0xC1, 0x66,
+        0xA4, 0x78, 0x6F, 0x66, 0xA2, 0x78, 0xA4, 0x88, 0xA2, 0x88, 0x7F, 0x29, 0x56, 0xC0, 0xA2, 0x88,
+        0x7D, 0x7F, 0x6D, 0xA2, 0x88, 0x9C, 0x87, 0x9B, 0x99, 0x99, 0x99, 0xA4, 0x85, 0xA2, 0x86, 0x9C,
+        0x99, 0xC0, 0xA6, 0x87, 0xA4, 0x88, 0x2B, 0x51, 0x66, 0xA6, 0x78, 0x5A, 0xA3, 0x89, 0x6F, 0x9D,
+        0xA8, 0x9B, 0x98, 0x62, 0x0A, 0xA1, 0x8A, 0x62, 0x9D, 0x98, 0xA2, 0x88, 0x9C, 0x87, 0x32, 0x26,
+        0xC4, 0x6B, 0x26, 0xC2, 0x66, 0xC3, 0xA2, 0x79, 0x1E, 0xC0, 0x61, 0x14, 0x0D, 0x6F, 0x0D, 0xC0,
+        0x19, 0x14, 0x19, 0xC1, 0x7D, 0x69, 0x69, 0xA2, 0x87, 0x6E, 0x9C, 0x99, 0x6B, 0x0C, 0x00, 0x1E,
+        0xA7, 0x77, 0x66, 0xA2, 0x78, 0xA2, 0x7A, 0xC0, 0x69, 0x65, 0x9A, 0xA9, 0x9B, 0x98, 0x9C, 0x9A,
+        0x26, 0xA3, 0x87, 0x23, 0x07, 0x04, 0xAA, 0x67, 0xA4, 0x67, 0x9D, 0xA9, 0xA2, 0x78, 0x5F, 0xA0,
+        0x8B, 0x5A, 0x69, 0xA0, 0x85, 0x76, 0x0C, 0x59, 0x79, 0x5A, 0x71, 0x3E, 0x59, 0x5B, 0x69, 0x65,
+        0x9D, 0xA8, 0x65, 0x9C, 0x98, 0x77, 0x65, 0x61, 0x6B, 0x3C, 0x37, 0x10, 0x37, 0xA1, 0x9A, 0x3B,
+        0x5B, 0xC0, 0x02, 0x9B, 0xB8, 0xA3, 0x78, 0x9C, 0xA8, 0x32, 0x66, 0x65, 0xC3, 0x2D, 0xA5, 0x78,
+        0x2F, 0x62, 0xA2, 0x88, 0xC0, 0x25, 0xC0, 0x66, 0x69, 0xA2, 0x79, 0x25, 0x11, 0xC0, 0x51, 0x56,
+        0xC0, 0x66, 0xA2, 0x78, 0xA3, 0x89, 0xC1, 0xA3, 0x89, 0xA3, 0x99, 0xA2, 0x77, 0x29, 0x56, 0x69,
+        0x29, 0x2E, 0x7B, 0xA2, 0x87, 0xA2, 0x76, 0x98, 0x9A, 0x9E, 0x86, 0x9C, 0x86, 0x9B, 0xAA, 0x9D,
+        0x99, 0x65, 0xAB, 0x85, 0x9D, 0x99, 0xAA, 0x76, 0xA3, 0x88, 0x9B, 0x98, 0xA5, 0x8A, 0xA3, 0x78,
+        0x62, 0x69, 0x23, 0x9E, 0x96, 0x37, 0x9D, 0x9A, 0xA7, 0x79, 0xA2, 0x78, 0x2A, 0x1B, 0x76, 0x13,
+        0x9D, 0x99, 0x32, 0x66, 0xC1, 0x26, 0x2D, 0xC3, 0x26, 0x66, 0xC2, 0x6B, 0xA3, 0x89, 0xA3, 0x79,
+        0x65, 0xC1, 0x65, 0x19, 0x0D, 0x6B, 0x19, 0x14, 0xA2, 0x77, 0x7A, 0xA2, 0x77, 0xC0, 0x3A, 0x65,
+        0xA3, 0x87, 0x6E, 0x52, 0xC0, 0x52, 0x38, 0xA2, 0x88, 0x37, 0xA6, 0x68, 0x6F, 0xA0, 0x8B, 0x68,
+        0x39, 0xC0, 0x9B, 0xA8, 0x0C, 0x3A, 0x2B, 0x33, 0xA4, 0x77, 0x3A, 0x0C, 0xAA, 0x56, 0x9D, 0x9B,
+        0x9A, 0xAA, 0xA7, 0x66, 0xA5, 0x69, 0x64, 0x5F, 0x61, 0x37, 0x76, 0x37, 0x66, 0x26, 0xC0, 0x5F,
+        0x37, 0x34, 0x59, 0xC0, 0x5B, 0x7A, 0x54, 0x9A, 0xC8, 0x99, 0xBA, 0x9B, 0xBB, 0x6E, 0xA4, 0x76,
+        0xA5, 0x68, 0x66, 0x9B, 0xBA, 0xA4, 0x66, 0xA4, 0x79, 0xA6, 0x59, 0xA1, 0x7A, 0xC0, 0x78, 0x99,
+        0xCA, 0x61, 0xA3, 0x77, 0x98, 0xC9, 0x9C, 0x99, 0xC3, 0x69, 0x2D, 0xA3, 0x88, 0xA3, 0x7A, 0xC1,
+        0xA2, 0x89, 0x51, 0x25, 0xC0, 0x20, 0x25, 0x31, 0x51, 0x69, 0x66, 0x9D, 0x99, 0x5A, 0xC0, 0x30,
+        0xA4, 0x78, 0xA2, 0x89, 0x55, 0xA2, 0x88, 0xA3, 0x89, 0xA2, 0x88, 0xC0, 0x56, 0x15, 0x29, 0xC0,
+        0x6F, 0x03, 0x9D, 0x99, 0x30, 0x9B, 0x98, 0x9C, 0x87, 0x9D, 0x99, 0x65, 0xA2, 0x86, 0xA7, 0x95,
+        0xA7, 0x88, 0xA4, 0x76, 0xA5, 0x7B, 0x9D, 0x97, 0xA2, 0x89, 0x34, 0x28, 0x65, 0xC0, 0x9D, 0xA8,
+        0x9D, 0x89, 0x1C, 0x00, 0x6B, 0x00, 0xC0, 0x17, 0x99, 0xAA, 0x9C, 0x89, 0x62, 0x2D, 0xC1, 0xA4,
+        0x85, 0x9D, 0x9A, 0x2D, 0xC4, 0x26, 0x66, 0xC0, 0x2D, 0xA3, 0x89, 0x25, 0x65, 0xC1, 0x0D, 0x19,
+        0x0D, 0x19, 0xC1, 0x6E, 0xC1, 0x65, 0x2D, 0x2E, 0x26, 0xA4, 0x87, 0x26, 0x21, 0x26, 0x3D, 0xA3,
+        0x88, 0xA5, 0x87, 0x34, 0xA1, 0x8A, 0x6B, 0x07, 0x0E, 0xA0, 0x85, 0x99, 0xB9, 0x3F, 0x35, 0x5A,
+        0x69, 0xA2, 0x87, 0x32, 0xA5, 0x86, 0xA6, 0x77, 0x9B, 0x9C, 0x6B, 0xA9, 0x55, 0x62, 0x9D, 0x99,
+        0xA6, 0x67, 0x99, 0xB9, 0xA7, 0x57, 0x6E, 0x62, 0x06, 0xA2, 0x77, 0x06, 0x62, 0xA7, 0x57, 0xA2,
+        0x67, 0x50, 0xA2, 0x79, 0x5A, 0x69, 0x1B, 0x70, 0x9A, 0xAA, 0x99, 0xCA, 0x62, 0xA3, 0x78, 0x75,
+        0xA3, 0x78, 0x9D, 0xAA, 0xA2, 0x77, 0xA2, 0x78, 0xA9, 0x59, 0x02, 0xC1, 0x9B, 0xC9, 0x9A, 0xA9,
+        0xC0, 0x60, 0x9C, 0x98, 0x66, 0xC4, 0xA2, 0x78, 0xA3, 0x89, 0x7F, 0x5A, 0xA1, 0x9A, 0x05, 0x9D,
+        0x98, 0x2A, 0x25, 0xC0, 0xA2, 0x88, 0x2A, 0x51, 0xC0, 0x52, 0x51, 0x7F, 0x35, 0x6F, 0xA3, 0x99,
+        0x6F, 0xC0, 0xA3, 0x88, 0xA2, 0x89, 0xC0, 0x1A, 0x15, 0x24, 0x6E, 0xC0, 0xA2, 0x86, 0x9C, 0x89,
+        0x9A, 0x99, 0x9B, 0x98, 0x9E, 0x86, 0x7D, 0x23, 0x6E, 0x7E, 0xA6, 0x76, 0xA7, 0x89, 0xA2, 0x77,
+        0x60, 0x62, 0xA2, 0x78, 0x65, 0x98, 0xAA, 0xA3, 0x87, 0xA3, 0x88, 0x53, 0xA5, 0x79, 0xA3, 0x7B,
+        0x68, 0xC0, 0x68, 0x99, 0xB9, 0x98, 0x9A, 0x62, 0x6E, 0x35, 0x32, 0x3F, 0xA6, 0x75, 0x35, 0x32,
+        0xC1, 0x66, 0xC2, 0x69, 0x21, 0x2D, 0xA4, 0x79, 0xA2, 0x78, 0x19, 0xC1, 0x69, 0x19, 0x0D, 0x19,
+        0xC1, 0x25, 0x19, 0x1E, 0x0D, 0x2D, 0x26, 0x56, 0xA2, 0x97, 0xC0, 0x21, 0xA2, 0x77, 0xA4, 0x86,
+        0xA6, 0x77, 0x1C, 0xA2, 0x78, 0x15, 0x6B, 0x15, 0x9D, 0xA5, 0x9D, 0x9A, 0x65, 0x9A, 0x99, 0x32,
+        0xC3, 0xA3, 0x87, 0xA2, 0x89, 0xA0, 0x8A, 0xA4, 0x76, 0xA4, 0x77, 0x99, 0xAB, 0xA3, 0x77, 0xA5,
+        0x76, 0x9D, 0xA9, 0xA3, 0x79, 0x1D, 0x67, 0x51, 0x01, 0xC0, 0x62, 0xA8, 0x46, 0x5D, 0x9C, 0xA8,
+        0x5E, 0xA2, 0x67, 0x61, 0x9D, 0xBA, 0x99, 0xCA, 0x6E, 0x51, 0x9D, 0xAA, 0x1E, 0xC0, 0xA3, 0x88,
+        0x26, 0x6B, 0xA5, 0x67, 0xAB, 0x48, 0x72, 0x2A, 0x9C, 0xB9, 0xA4, 0x58, 0x9D, 0xA8, 0x9B, 0xCA,
+        0x9D, 0x99, 0x9D, 0xA8, 0x55, 0xC0, 0x35, 0x32, 0x2D, 0xC0, 0x32, 0xA3, 0x89, 0xA2, 0x89, 0xC0,
+        0x6F, 0x6F, 0x51, 0x25, 0x6E, 0x25, 0x31, 0x39, 0x25, 0x16, 0x66, 0x51, 0x66, 0x5F, 0x66, 0xA3,
+        0x89, 0xA3, 0x88, 0x66, 0xA2, 0x78, 0xA2, 0x88, 0x6F, 0x15, 0xC0, 0x21, 0x7A, 0x29, 0x65, 0x35,
+        0x9B, 0x99, 0x9C, 0x87, 0x9D, 0x98, 0x79, 0xA4, 0x86, 0x3F, 0xA6, 0x76, 0xA5, 0x78, 0xA4, 0x79,
+        0x6B, 0x9E, 0x96, 0x9D, 0x98, 0xA2, 0x87, 0x9A, 0xA8, 0x57, 0xC0, 0x10, 0x28, 0x07, 0xA0, 0x8A,
+        0x69, 0x07, 0xA0, 0x85, 0x9C, 0xA9, 0x98, 0x99, 0x62, 0x0C, 0xC0, 0x3A, 0xA9, 0x75, 0x2A, 0x98,
+        0x9B, 0xC0, 0x7A, 0xC0, 0x32, 0x66, 0x32, 0x33, 0x2D, 0xC0, 0x6F, 0x25, 0xC0, 0x65, 0xC0, 0x12,
+        0x19, 0xC0, 0x66, 0x19, 0xC1, 0x25, 0x19, 0x6E, 0x61, 0x2D, 0x65, 0xC0, 0x26, 0x3A, 0x2D, 0x32,
+        0x3F, 0x20, 0xA4, 0x77, 0xA7, 0x68, 0xA0, 0x8D, 0xC0, 0x0E, 0x9F, 0x96, 0x9B, 0xAA, 0x9B, 0x99,
+        0x7E, 0x07, 0x3A, 0x35, 0x32, 0xC0, 0x7F, 0x1E, 0xA2, 0x88, 0x04, 0x57, 0xC0, 0xA3, 0x86, 0xC0,
+        0x56, 0xA2, 0x88, 0x06, 0x62, 0x32, 0x56, 0xA2, 0x87, 0xC0, 0xA7, 0x56, 0x06, 0x98, 0xA9, 0xA8,
+        0x45, 0x65, 0x9D, 0xA9, 0xA5, 0x68, 0x95, 0xDB, 0x62, 0x66, 0xC1, 0x1E, 0xA2, 0x88, 0x2D, 0x32,
+        0xAA, 0x36, 0x77, 0x77, 0xA4, 0x67, 0x9B, 0xBA, 0x6F, 0xA2, 0x76, 0x06, 0x9C, 0x9A, 0x9C, 0xA8,
+        0x35, 0xC3, 0x32, 0xC0, 0x0D, 0xA3, 0x89, 0x6B, 0xC0, 0x05, 0xC0, 0x2A, 0xC0, 0x25, 0xC0, 0xA2,
+        0x89, 0x31, 0x60, 0x6B, 0x41, 0x38, 0x6F, 0x56, 0x6F, 0x30, 0x6E, 0xC0, 0xA2, 0x88, 0x6F, 0xC0,
+        0x66, 0x15, 0x6F, 0x69, 0x10, 0x9C, 0x87, 0x9B, 0x99, 0x9C, 0x97, 0x51, 0x69, 0x7A, 0xA2, 0x88,
+        0xA5, 0x86, 0xAB, 0x86, 0xA5, 0x78, 0x6F, 0x9C, 0x97, 0x9B, 0xA9, 0xA6, 0x77, 0x9C, 0x98, 0xC0,
+        0xA3, 0x88, 0xA3, 0x78, 0x34, 0xA1, 0x8C, 0x1C, 0x15, 0x68, 0x9F, 0x96, 0x9C, 0xA6, 0x52, 0x6E,
+        0x9A, 0x9B, 0xA6, 0x77, 0x9B, 0xA9, 0xA9, 0x67, 0x30, 0x0C, 0x3A, 0xA2, 0x87, 0x0C, 0x32, 0x3F,
+        0x1E, 0x3F, 0x9D, 0x9A, 0x32, 0x0D, 0x2A, 0x25, 0x65, 0x6E, 0x19, 0x1E, 0x19, 0xC0, 0x25, 0x19,
+        0x1E, 0xC0, 0x19, 0x1E, 0x9D, 0xA9, 0x2D, 0x69, 0x2D, 0xC0, 0x7E, 0x32, 0x3A, 0x11, 0xA7, 0x77,
+        0xA2, 0x89, 0x55, 0x34, 0xA1, 0x8B, 0x60, 0x23, 0x9D, 0x9A, 0x9A, 0x9A, 0x50, 0x13, 0x3F, 0x3A,
+        0xC1, 0x6F, 0x1E, 0xA2, 0x88, 0xC0, 0xA2, 0x78, 0x66, 0x69, 0x65, 0x37, 0xA2, 0x77, 0x66, 0x37,
+        0x3E, 0x61, 0x32, 0x37, 0x03, 0x2D, 0x9D, 0x87, 0xA8, 0x45, 0x98, 0xCA, 0x9D, 0xA9, 0xA9, 0x46,
+        0x3C, 0x9C, 0xA9, 0x5A, 0xC0, 0x21, 0x6B, 0x6E, 0xC0, 0xA4, 0x66, 0xA3, 0x79, 0x12, 0xA3, 0x8A,
+        0xA4, 0x66, 0x3E, 0x0A, 0x3E, 0x65, 0x39, 0x50, 0x9D, 0xA8, 0x3A, 0xC1, 0x35, 0xC1, 0x01, 0x1E,
+        0x39, 0xC0, 0x05, 0x0A, 0x39, 0x2A, 0xC0, 0x25, 0x39, 0xC0, 0x25, 0xC0, 0x56, 0x9D, 0x98, 0x5B,
+        0x7A, 0x56, 0xA3, 0x89, 0xA3, 0x89, 0x69, 0x6F, 0x7F, 0xC2, 0x6E, 0xC0, 0x3C, 0x9C, 0x87, 0x9B,
+        0x99, 0x9D, 0x98, 0x65, 0x79, 0x6E, 0x0F, 0xA7, 0x87, 0x66, 0xA9, 0x77, 0x9C, 0x98, 0xA3, 0x88,
+        0x9C, 0x97, 0xA5, 0x88, 0x9B, 0x9A, 0x52, 0x1E, 0xA7, 0x77, 0xA3, 0x7C, 0xA0, 0x8C, 0x69, 0x69,
+        0x0E, 0x9F, 0x96, 0x9E, 0x95, 0xA2, 0x79, 0x6F, 0x9A, 0xA8, 0xA4, 0x78, 0x6B, 0xC0, 0x9D, 0x97,
+        0x21, 0x1E, 0x6B, 0xC0, 0x13, 0x08, 0x9A, 0xAA, 0x3A, 0x56, 0xC0, 0x19, 0x39, 0x51, 0xC0, 0x69,
+        0x19, 0x25, 0x19, 0xC0, 0x25, 0x19, 0x25, 0x1E, 0xC0, 0x19, 0x60, 0x2D, 0xC2, 0x32, 0x6B, 0x0C,
+        0xA6, 0x76, 0x57, 0x18, 0xA3, 0x88, 0xA5, 0x87, 0xA1, 0x7B, 0xA2, 0x88, 0x9A, 0xA8, 0x52, 0x9C,
+        0x99, 0x06, 0xC1, 0x01, 0xC1, 0x06, 0x21, 0xA2, 0x79, 0x69, 0x3E, 0xC0, 0x61, 0x32, 0x2B, 0x32,
+        0xA2, 0x77, 0x9D, 0x9A, 0x39, 0x2D, 0xC1, 0x32, 0x39, 0x12, 0xA5, 0x55, 0x98, 0xBA, 0x62, 0xA3,
+        0x77, 0xA2, 0x88, 0x9B, 0xBA, 0xC2, 0x6B, 0x6E, 0x6E, 0x01, 0x63, 0x7F, 0xA3, 0x89, 0x0A, 0x65,
+        0x05, 0xC0, 0x64, 0x39, 0x2D, 0x0D, 0x65, 0xC1, 0x3A, 0xC1, 0x01, 0x19, 0x39, 0xC1, 0xA3, 0x89,
+        0x05, 0x2A, 0x6B, 0x25, 0x2A, 0x05, 0x61, 0x25, 0xC0, 0x9D, 0x99, 0x41, 0x7F, 0x56, 0x6F, 0xA5,
+        0x88, 0x6F, 0xC0, 0x6E, 0xC0, 0x01, 0x10, 0x6E, 0x65, 0x9D, 0x99, 0x3C, 0x9C, 0x88, 0x50, 0x65,
+        0x7A, 0xA2, 0x88, 0xA3, 0x87, 0x1E, 0xA2, 0x88, 0xAC, 0x64, 0x11, 0x6E, 0xA4, 0x97, 0xA2, 0x78,
+        0x17, 0x99, 0xA9, 0x6F, 0xA9, 0x67, 0xA1, 0x8C, 0x1C, 0x69, 0x0E, 0xC0, 0xA0, 0x85, 0xC0, 0x68,
+        0x39, 0x2D, 0x0E, 0x1C, 0xA0, 0x84, 0x26, 0x9D, 0x99, 0xA2, 0x89, 0x60, 0x08, 0xA2, 0x89, 0x9B,
+        0xA9, 0x98, 0x9B, 0x66, 0x5A, 0x6E, 0xA3, 0x8A, 0xA2, 0x88, 0x25, 0xC0, 0x69, 0x66, 0x25, 0x19,
+        0x1E, 0xC1, 0x7B, 0x1E, 0xC0, 0x19, 0x3E, 0x61, 0x32, 0xC2, 0x7E, 0xA2, 0x78, 0xC0, 0x12, 0xC0,
+        0x2C, 0x6B, 0xA1, 0x8A, 0xA8, 0x65, 0x9B, 0xAA, 0x9C, 0x8A, 0x28, 0x50, 0x69, 0xC1, 0x01, 0xC0,
+        0x06, 0xA2, 0x89, 0x39, 0xC0, 0x3E, 0xC0, 0x65, 0xC0, 0x1E, 0x7F, 0xA2, 0x77, 0x2A, 0x39, 0x2A,
+        0x2D, 0xC1, 0x39, 0x19, 0xA1, 0x75, 0x9A, 0xBA, 0xC0, 0x6E, 0xA2, 0x78, 0x26, 0x67, 0x21, 0x28,
+        0x6E, 0xC0, 0x6E, 0x01, 0xC0, 0x6E, 0xA3, 0x8A, 0x0A, 0x3E, 0x05, 0x7E, 0x39, 0xC0, 0x69, 0x12,
+        0x06, 0x01, 0xC4, 0x12, 0x32, 0x3E, 0x39, 0x0A, 0x6B, 0x2D, 0x31, 0x2A, 0x25, 0x39, 0x3E, 0x25,
+        0xC0, 0x1D, 0x38, 0x6F, 0x5A, 0x66, 0xA4, 0x78, 0x09, 0x56, 0xC2,
+};
+
+#endif
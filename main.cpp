@@ -6,13 +6,13 @@
 #include "mbed.h"
 #include "USBSerial.h"
 #include "ST7735S.h"
+#include "NumberField.h"
 
-#include "fonts/Arial12x12.h"
-#include "fonts/Arial24x23.h"
-#include "fonts/Arial28x28.h"
-#include "fonts/font_big.h"
-#include "images/ImageData.h"
-#include "images/ekimemo.h"
+#include "fonts/Arial12x12_atlas.h"
+#include "fonts/Arial24x23_atlas.h"
+#include "fonts/Arial28x28_atlas.h"
+#include "fonts/Neu42x35_atlas.h"
+#include "images/assets.h"
 
 const uint16_t color[18] = {
     Black,
@@ -36,7 +36,8 @@ const uint16_t color[18] = {
 };
 
 DigitalOut back_light(p25);
-ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET);
+// use ST7735S::FRAMEBUFFER to render into RAM, the demos call flush() after drawing
+ST7735S tft(ST7735S_MOSI, ST7735S_MISO, ST7735S_SCLK, ST7735S_CS, ST7735S_RS, ST7735S_RESET, "TFT", ST7735S::DIRECT);
 
 #define DEMO_COLOR      0
 #define DEMO_RECT       0
@@ -53,14 +54,16 @@ int main()
     tft.claim(stdout);      // send stdout to the TFT display
     tft.background(Black);
     tft.cls();
+    tft.flush();
     tft.disp(1);
 
     while(1) {
 #if DEMO_COLOR
         // Color bar
         for(int i = 0; i < 16; i++) {
-            tft.fillrect(i * (_width / 16), 0, (i + 1) * (_width / 16), 79, color[i+1]);
+            tft.fillrect(i * (tft.width() / 16), 0, (i + 1) * (tft.width() / 16), tft.height() - 1, color[i+1]);
         }
+        tft.flush();
         ThisThread::sleep_for(4000ms);
 #endif
 
@@ -76,12 +79,13 @@ int main()
             }
         }
         tft.rect(0, 0, 159, 79, DarkGrey);
+        tft.flush();
         ThisThread::sleep_for(4000ms);
 #endif
 
 #if DEMO_ANIMATION
         // Animation
-        tft.set_font((unsigned char*) Arial12x12);
+        tft.set_font(&Arial12x12_atlas);
         tft.background(Blue);
         tft.foreground(White);
         tft.fillrect(0, 0, 159, 79, Blue);
@@ -92,6 +96,7 @@ int main()
             }
             tft.locate(10,10);
             tft.printf("X=%3d, y=%2d", x, x/2);
+            tft.flush();
             ThisThread::sleep_for(30ms);
             tft.rect(0, 0, x, (x/2), Blue);
             if (x - 119 > 0) {
@@ -106,15 +111,16 @@ int main()
         tft.foreground(Yellow);
         tft.background(Navy);
         tft.cls();
-        tft.set_font((unsigned char*) Arial12x12);
+        tft.set_font(&Arial12x12_atlas);
         tft.locate(2, 4);
         tft.printf("ABCDabcd1234");
-        tft.set_font((unsigned char*) Arial24x23);
+        tft.set_font(&Arial24x23_atlas);
         tft.locate(2, 18);
         tft.printf("ABCDabcd");
-        tft.set_font((unsigned char*) Arial28x28);
+        tft.set_font(&Arial28x28_atlas);
         tft.locate(2, 46);
         tft.printf("ABCDabcd");
+        tft.flush();
         ThisThread::sleep_for(4000ms);
 #endif
 
@@ -123,12 +129,11 @@ int main()
         tft.foreground(Yellow);
         tft.background(DarkGrey);
         tft.cls();
-        tft.set_font((unsigned char*) Neu42x35);
-        char s[6];
+        tft.set_font(&Neu42x35_atlas);
+        NumberField clock(tft, 20, 40-(35/2));     // sends only the digits that changed
         for (int i = 0; i < 5; i++) {
-            tft.locate(20, 40-(35/2));
-            sprintf(s, "12:3%c", i + '0');
-            tft.printf("%s", s);
+            clock.printf("12:3%c", i + '0');
+            tft.flush();
             ThisThread::sleep_for(1000ms);
         }
         ThisThread::sleep_for(2000ms);
@@ -136,17 +141,27 @@ int main()
 
 #if DEMO_BITMAP
         // Bitmap
-        tft.Paint_DrawImage(gImage_0inch96_1, 0, 0, 160, 80);
+        tft.Paint_DrawImage(asset_table[ASSET_GIMAGE_0INCH96_1], 0, 0);
+        tft.flush();
         ThisThread::sleep_for(4000ms);
 #endif
 
 #if DEMO_SCROLL
-        // Scroll
-        for (int i = 0; i < (284 - 80); i+=2) {
-            tft.Paint_DrawImage(ekimemo_bmp + (i * 160 * 2), 0, 0, 160, 80);
-            ThisThread::sleep_for(1ms);
+        // Scroll: the controller scrolls along x in landscape, so the 160 x 284
+        // image slides in band by band from the right, 2 new columns per step
+        tft.Paint_DrawImage(asset_table[ASSET_EKIMEMO_BMP], 0, 0);     // clipped to the top 80 rows
+        tft.flush();
+        tft.scroll_area(0, 159);
+        const int bands[] = { 80, 160, 284 - 80 };    // first image row of each band
+        for (int band : bands) {
+            ThisThread::sleep_for(1000ms);
+            for (int i = 0; i < 160; i += 2) {
+                tft.scroll_image(ekimemo_bmp + (band * 160 + i) * 2, 160, 2);
+                tft.flush();
+                ThisThread::sleep_for(1ms);
+            }
         }
-        tft.Paint_DrawImage(ekimemo_bmp, 0, 0, 160, 80);
+        tft.scroll_reset();
         ThisThread::sleep_for(4000ms);
 #endif
 